@@ -1,5 +1,11 @@
 #include "CServer.h"
 #include "UserManager.h"
+#include "FriendCache.h"
+#include "RouteCache.h"
+#include "OfflineInbox.h"
+#include "StatusGrpcClient.h"
+#include "ConfigManager.h"
+#include "LogicSystem.h"
 #include "Logger.h"
 
 CServer::CServer(boost::asio::io_context& ioc, size_t port):
@@ -18,19 +24,41 @@ CServer::~CServer()
 
 void CServer::clearSession(std::string session)
 {
-	if (_sessions.find(session) != _sessions.end()) {
-		UserManager::GetInstance()->removeUserSession(_sessions[session]->GetSessionUid());
-
-		{
-			std::lock_guard<std::mutex> lock(_mutex);
-			_sessions.erase(session);
+	std::shared_ptr<CSession> removed;
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		auto iter = _sessions.find(session);
+		if (iter == _sessions.end()) {
+			LOG_WARN("Attempted to remove non-existent session: {}", session);
+			return;
 		}
-
+		removed = iter->second;
+		_sessions.erase(iter);
 		LOG_DEBUG("Session {} removed, remaining sessions: {}", session, _sessions.size());
 	}
-	else {
-		LOG_WARN("Attempted to remove non-existent session: {}", session);
+
+	// a newer login of the same user may already own the uid, its relation set and its route
+	auto userUid = removed->GetUserUid();
+	if (userUid.empty() || !UserManager::GetInstance()->removeUserSession(userUid, removed)) {
+		return;
 	}
+
+	FriendCache::GetInstance()->Evict(userUid);
+	RouteCache::GetInstance()->Invalidate(userUid);
+	OfflineInbox::GetInstance()->MarkOffline(userUid);
+	auto serverName = ConfigManager::GetInstance().getValue("SelfServer", "name");
+	// the session key is written on the logic thread, like at login, which also
+	// orders this after any login of the same user on this server
+	LogicSystem::GetInstance()->PostTask([userUid, serverName]() {
+		if (!UserManager::GetInstance()->GetSession(userUid)) {
+			RouteCache::GetInstance()->Logout(userUid, serverName);
+		}
+	});
+	StatusGrpcClient::GetInstance()->ReportOfflineAsync(userUid, serverName, [userUid](const status::OfflineReportResp& resp) {
+		if (resp.error() != 0) {
+			LOG_WARN("Failed to report UID {} offline, error: {}", userUid, resp.error());
+		}
+	});
 }
 
 void CServer::handlerAccept(std::shared_ptr<CSession> newSession, const boost::system::error_code& error)
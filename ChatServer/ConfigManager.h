@@ -25,6 +25,7 @@ public:
 	ConfigManager& operator=(const ConfigManager&) = delete;
 
 	std::string getValue(const std::string &section,const std::string& key);
+	int getIntValue(const std::string& section, const std::string& key, int defaultValue);
 
 	SectionInfo operator[](const std::string&);
 
@@ -0,0 +1,98 @@
+#include "FriendApplyWriter.h"
+#include "ConfigManager.h"
+#include "LogicSystem.h"
+#include "MySQLManager.h"
+#include "Logger.h"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+FriendApplyWriter::FriendApplyWriter() : _b_stop(false)
+{
+	auto& cfg = ConfigManager::GetInstance();
+	_maxBatch = static_cast<std::size_t>(std::max(1, cfg.getIntValue("FriendApplyWriter", "MaxBatch", 128)));
+	_linger = std::chrono::milliseconds(cfg.getIntValue("FriendApplyWriter", "LingerMs", 5));
+
+	LOG_INFO("Friend apply writer started - max batch: {}, linger: {}ms", _maxBatch, _linger.count());
+	_thread = std::thread(&FriendApplyWriter::Run, this);
+}
+
+FriendApplyWriter::~FriendApplyWriter()
+{
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_b_stop = true;
+	}
+	_cond.notify_all();
+	if (_thread.joinable()) {
+		_thread.join();
+	}
+}
+
+std::future<bool> FriendApplyWriter::Submit(const FriendRelation& relation, const std::string& comments, Callback callback)
+{
+	Pending pending{ relation, comments, std::promise<bool>(), std::move(callback) };
+	auto future = pending.promise.get_future();
+
+	std::size_t queued = 0;
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_queue.push_back(std::move(pending));
+		queued = _queue.size();
+	}
+	if (queued == 1 || queued >= _maxBatch) {
+		_cond.notify_one();
+	}
+	return future;
+}
+
+void FriendApplyWriter::Run()
+{
+	std::unique_lock<std::mutex> lock(_mutex);
+	while (true) {
+		_cond.wait(lock, [this]() { return _b_stop || !_queue.empty(); });
+		if (_queue.empty()) {
+			break;
+		}
+
+		// Linger so concurrent applications share the commit
+		if (!_b_stop && _queue.size() < _maxBatch && _linger.count() > 0) {
+			_cond.wait_for(lock, _linger, [this]() { return _b_stop || _queue.size() >= _maxBatch; });
+		}
+
+		std::deque<Pending> batch;
+		auto count = std::min(_maxBatch, _queue.size());
+		std::move(_queue.begin(), _queue.begin() + count, std::back_inserter(batch));
+		_queue.erase(_queue.begin(), _queue.begin() + count);
+
+		lock.unlock();
+		Flush(batch);
+		lock.lock();
+	}
+	LOG_INFO("Friend apply writer stopped");
+}
+
+void FriendApplyWriter::Flush(std::deque<Pending>& batch)
+{
+	std::vector<std::pair<FriendRelation, std::string>> applies;
+	applies.reserve(batch.size());
+	for (const auto& pending : batch) {
+		applies.emplace_back(pending.relation, pending.comments);
+	}
+
+	auto results = MySQLManager::GetInstance()->AddFriends(applies);
+
+	for (std::size_t i = 0; i < batch.size(); ++i) {
+		bool success = i < results.size() && results[i];
+		batch[i].promise.set_value(success);
+		if (batch[i].callback) {
+			// follow-up work (caches, notifications) blocks, so it belongs on the logic thread
+			LogicSystem::GetInstance()->PostTask(
+				[callback = std::move(batch[i].callback), success]() {
+					callback(success);
+				});
+		}
+	}
+	LOG_DEBUG("Flushed {} friend applications", batch.size());
+}
@@ -0,0 +1,63 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "Singleton.h"
+#include "UserInfo.h"
+
+/**
+ * @class FriendApplyWriter
+ * @brief Group commit for friend applications.
+ *
+ * Submitted applications are collected for up to LingerMs or MaxBatch rows and
+ * written by one background thread as a single transaction, so a burst of
+ * requests shares one commit instead of paying for one each. Every caller
+ * still gets its own result.
+ */
+class FriendApplyWriter : public Singleton<FriendApplyWriter>
+{
+	friend class Singleton<FriendApplyWriter>;
+
+public:
+	using Callback = std::function<void(bool)>;
+
+	~FriendApplyWriter();
+
+	/**
+	 * @brief Queue an application for the next batch
+	 *
+	 * @param relation
+	 * @param comments
+	 * @param callback optional, runs on the logic thread once the batch is committed
+	 * @return std::future<bool> result of this application
+	 */
+	std::future<bool> Submit(const FriendRelation& relation, const std::string& comments, Callback callback = nullptr);
+
+private:
+	struct Pending {
+		FriendRelation relation;
+		std::string comments;
+		std::promise<bool> promise;
+		Callback callback;
+	};
+
+	FriendApplyWriter();
+
+	void Run();
+	void Flush(std::deque<Pending>& batch);
+
+	std::size_t _maxBatch;
+	std::chrono::milliseconds _linger;
+
+	std::mutex _mutex;
+	std::condition_variable _cond;
+	std::deque<Pending> _queue;
+	std::atomic<bool> _b_stop;
+	std::thread _thread;
+};
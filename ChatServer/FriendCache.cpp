@@ -0,0 +1,228 @@
+#include "FriendCache.h"
+#include "Logger.h"
+#include "const.h"
+
+#include <algorithm>
+#include <charconv>
+
+void FriendCache::Load(const std::string& uid,
+	const std::vector<std::shared_ptr<FriendInfo>>& friends,
+	const std::vector<std::shared_ptr<FriendListInfo>>& applies,
+	const std::vector<std::shared_ptr<FriendInfo>>& sent)
+{
+	RelationSet set;
+	set.Reserve(friends.size() + applies.size() + sent.size());
+
+	// a pending application reads as NotConsent from both sides, as the apply paths set it
+	uint64_t friendUid = 0;
+	for (const auto& apply : applies) {
+		if (apply && apply->_status == static_cast<int>(ApplyStatusCodes::Pending) && ParseUid(apply->_uid, friendUid)) {
+			set.Upsert(friendUid, static_cast<int>(AddStatusCodes::NotConsent), "", "");
+		}
+	}
+	for (const auto& apply : sent) {
+		if (apply && apply->_user && ParseUid(apply->_user->_uid, friendUid)) {
+			set.Upsert(friendUid, static_cast<int>(AddStatusCodes::NotConsent), apply->_group, apply->_remark);
+		}
+	}
+	// a mutual friendship wins over any stale application between the same users
+	for (const auto& contact : friends) {
+		if (contact && contact->_user && ParseUid(contact->_user->_uid, friendUid)) {
+			set.Upsert(friendUid, static_cast<int>(AddStatusCodes::MutualFriend), contact->_group, contact->_remark);
+		}
+	}
+
+	std::lock_guard<std::mutex> lock(_mutex);
+	_sets[uid] = std::move(set);
+	LOG_DEBUG("Loaded {} friends, {} applications received and {} sent for UID {}, cached users: {}",
+		friends.size(), applies.size(), sent.size(), uid, _sets.size());
+}
+
+void FriendCache::Evict(const std::string& uid)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_sets.erase(uid);
+}
+
+bool FriendCache::IsLoaded(const std::string& uid)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _sets.find(uid) != _sets.end();
+}
+
+void FriendCache::Upsert(const std::string& uid, const std::string& friendUid, int status, const std::string& group, const std::string& remark)
+{
+	uint64_t id = 0;
+	if (!ParseUid(friendUid, id)) {
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(_mutex);
+	auto iter = _sets.find(uid);
+	if (iter != _sets.end()) {
+		iter->second.Upsert(id, status, group, remark);
+	}
+}
+
+void FriendCache::SetStatus(const std::string& uid, const std::string& friendUid, int status)
+{
+	uint64_t id = 0;
+	if (!ParseUid(friendUid, id)) {
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(_mutex);
+	auto iter = _sets.find(uid);
+	if (iter != _sets.end() && !iter->second.SetStatus(id, status)) {
+		iter->second.Upsert(id, status, "", "");
+	}
+}
+
+bool FriendCache::GetRelation(const std::string& uid, const std::string& friendUid, Relation& out)
+{
+	uint64_t id = 0;
+	if (!ParseUid(friendUid, id)) {
+		return false;
+	}
+
+	std::lock_guard<std::mutex> lock(_mutex);
+	auto iter = _sets.find(uid);
+	if (iter == _sets.end()) {
+		return false;
+	}
+
+	auto entry = iter->second.Find(id);
+	if (entry == nullptr) {
+		return false;
+	}
+
+	out.status = entry->status;
+	out.group = iter->second.Group(*entry);
+	out.remark = iter->second.Remark(*entry);
+	return true;
+}
+
+int FriendCache::GetStatus(const std::string& uid, const std::string& friendUid)
+{
+	uint64_t id = 0;
+	if (!ParseUid(friendUid, id)) {
+		return static_cast<int>(AddStatusCodes::NotFriend);
+	}
+
+	std::lock_guard<std::mutex> lock(_mutex);
+	auto iter = _sets.find(uid);
+	if (iter == _sets.end()) {
+		return static_cast<int>(AddStatusCodes::NotFriend);
+	}
+
+	auto entry = iter->second.Find(id);
+	return entry == nullptr ? static_cast<int>(AddStatusCodes::NotFriend) : entry->status;
+}
+
+bool FriendCache::ParseUid(const std::string& uid, uint64_t& out)
+{
+	auto [ptr, ec] = std::from_chars(uid.data(), uid.data() + uid.size(), out);
+	if (ec != std::errc() || ptr != uid.data() + uid.size() || uid.empty()) {
+		LOG_WARN("Ignoring relation with non-numeric uid: {}", uid);
+		return false;
+	}
+	return true;
+}
+
+void FriendCache::RelationSet::Reserve(std::size_t count)
+{
+	_entries.reserve(count);
+}
+
+void FriendCache::RelationSet::Upsert(uint64_t uid, int status, const std::string& group, const std::string& remark)
+{
+	auto iter = std::lower_bound(_entries.begin(), _entries.end(), uid,
+		[](const Entry& entry, uint64_t value) {
+			return entry.uid < value;
+		}
+	);
+
+	if (iter != _entries.end() && iter->uid == uid) {
+		_garbage += iter->groupLength + iter->remarkLength;
+		iter->groupLength = 0;
+		iter->remarkLength = 0;
+		auto index = iter - _entries.begin();
+		auto groupOffset = Append(group);
+		auto remarkOffset = Append(remark);
+		// Append may have compacted the arena, which rewrites offsets but keeps positions
+		auto& entry = _entries[index];
+		entry.status = status;
+		entry.groupOffset = groupOffset;
+		entry.groupLength = static_cast<uint32_t>(group.size());
+		entry.remarkOffset = remarkOffset;
+		entry.remarkLength = static_cast<uint32_t>(remark.size());
+		return;
+	}
+
+	auto index = iter - _entries.begin();
+	Entry entry{ uid, status, 0, static_cast<uint32_t>(group.size()), 0, static_cast<uint32_t>(remark.size()) };
+	entry.groupOffset = Append(group);
+	entry.remarkOffset = Append(remark);
+	_entries.insert(_entries.begin() + index, entry);
+}
+
+bool FriendCache::RelationSet::SetStatus(uint64_t uid, int status)
+{
+	auto iter = std::lower_bound(_entries.begin(), _entries.end(), uid,
+		[](const Entry& entry, uint64_t value) {
+			return entry.uid < value;
+		}
+	);
+	if (iter == _entries.end() || iter->uid != uid) {
+		return false;
+	}
+	iter->status = status;
+	return true;
+}
+
+const FriendCache::RelationSet::Entry* FriendCache::RelationSet::Find(uint64_t uid) const
+{
+	auto iter = std::lower_bound(_entries.begin(), _entries.end(), uid,
+		[](const Entry& entry, uint64_t value) {
+			return entry.uid < value;
+		}
+	);
+	return (iter != _entries.end() && iter->uid == uid) ? &*iter : nullptr;
+}
+
+std::string FriendCache::RelationSet::Group(const Entry& entry) const
+{
+	return _arena.substr(entry.groupOffset, entry.groupLength);
+}
+
+std::string FriendCache::RelationSet::Remark(const Entry& entry) const
+{
+	return _arena.substr(entry.remarkOffset, entry.remarkLength);
+}
+
+uint32_t FriendCache::RelationSet::Append(const std::string& text)
+{
+	if (_garbage > 4096 && _garbage * 2 > _arena.size()) {
+		CompactArena();
+	}
+
+	auto offset = static_cast<uint32_t>(_arena.size());
+	_arena.append(text);
+	return offset;
+}
+
+void FriendCache::RelationSet::CompactArena()
+{
+	std::string arena;
+	arena.reserve(_arena.size() - _garbage);
+	for (auto& entry : _entries) {
+		auto groupOffset = static_cast<uint32_t>(arena.size());
+		arena.append(_arena, entry.groupOffset, entry.groupLength);
+		auto remarkOffset = static_cast<uint32_t>(arena.size());
+		arena.append(_arena, entry.remarkOffset, entry.remarkLength);
+		entry.groupOffset = groupOffset;
+		entry.remarkOffset = remarkOffset;
+	}
+	_arena.swap(arena);
+	_garbage = 0;
+}
@@ -0,0 +1,108 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "Singleton.h"
+#include "UserInfo.h"
+
+/**
+ * @class FriendCache
+ * @brief Relation sets of the users logged in on this server.
+ *
+ * Each set is a vector of fixed-size entries sorted by numeric friend uid;
+ * group and remark strings live in one per-user arena and entries refer to
+ * them by offset. Loaded at login, updated by the apply/approve paths and
+ * evicted on logout, so relation checks never reach MySQL.
+ */
+class FriendCache : public Singleton<FriendCache>
+{
+	friend class Singleton<FriendCache>;
+
+public:
+	struct Relation {
+		int status;
+		std::string group;
+		std::string remark;
+	};
+
+	~FriendCache() = default;
+
+	/**
+	 * @brief Replace the relation set of uid with what login read from MySQL
+	 *
+	 * @param uid
+	 * @param friends mutual friends
+	 * @param applies applications addressed to uid
+	 * @param sent pending applications uid made to others
+	 */
+	void Load(const std::string& uid,
+		const std::vector<std::shared_ptr<FriendInfo>>& friends,
+		const std::vector<std::shared_ptr<FriendListInfo>>& applies,
+		const std::vector<std::shared_ptr<FriendInfo>>& sent);
+
+	void Evict(const std::string& uid);
+	bool IsLoaded(const std::string& uid);
+
+	/**
+	 * @brief Insert or overwrite one relation; ignored unless uid is loaded
+	 *
+	 * @param uid owner of the set
+	 * @param friendUid
+	 * @param status AddStatusCodes value
+	 * @param group
+	 * @param remark
+	 */
+	void Upsert(const std::string& uid, const std::string& friendUid, int status, const std::string& group, const std::string& remark);
+
+	/**
+	 * @brief Change the status of a relation, keeping its group and remark
+	 */
+	void SetStatus(const std::string& uid, const std::string& friendUid, int status);
+
+	bool GetRelation(const std::string& uid, const std::string& friendUid, Relation& out);
+
+	/**
+	 * @brief Status of friendUid as seen by uid
+	 *
+	 * @return AddStatusCodes::NotFriend when there is no relation
+	 */
+	int GetStatus(const std::string& uid, const std::string& friendUid);
+
+private:
+	class RelationSet {
+	public:
+		struct Entry {
+			uint64_t uid;
+			int32_t status;
+			uint32_t groupOffset;
+			uint32_t groupLength;
+			uint32_t remarkOffset;
+			uint32_t remarkLength;
+		};
+
+		void Reserve(std::size_t count);
+		void Upsert(uint64_t uid, int status, const std::string& group, const std::string& remark);
+		bool SetStatus(uint64_t uid, int status);
+		const Entry* Find(uint64_t uid) const;
+		std::string Group(const Entry& entry) const;
+		std::string Remark(const Entry& entry) const;
+
+	private:
+		uint32_t Append(const std::string& text);
+		void CompactArena();
+
+		std::vector<Entry> _entries;
+		std::string _arena;
+		std::size_t _garbage = 0;
+	};
+
+	FriendCache() = default;
+
+	static bool ParseUid(const std::string& uid, uint64_t& out);
+
+	std::mutex _mutex;
+	std::unordered_map<std::string, RelationSet> _sets;
+};
@@ -4,6 +4,9 @@
 #include "Defer.h"
 #include "Logger.h"
 
+#include <nlohmann/json.hpp>
+using json = nlohmann::json;
+
 bool FriendDAO::Insert(const FriendRelation& relation)
 {
 	return true;
@@ -17,8 +20,12 @@ bool FriendDAO::Update(const FriendRelation& relation)
 	};
 
 	try {
+		if (!conn) {
+			return {};
+		}
+
 		LOG_INFO("Updating relationship: uid_a={}, uid_b={}", relation._a_uid, relation._b_uid);
-		auto result = conn->sql("CALL sp_update_friend(?, ?, ?, ?, ?, @success)")
+		auto result = conn->sql("CALL sp_update_friend(?, ?, ?, ?, ?)")
 			.bind(relation._a_uid)
 			.bind(relation._b_uid)
 			.bind(relation._status)
@@ -26,9 +33,7 @@ bool FriendDAO::Update(const FriendRelation& relation)
 			.bind(relation._remark.empty() ? relation._b_uid : relation._remark)
 			.execute();
 
-		auto statusResult = conn->sql("SELECT @success").execute();
-		auto row = statusResult.fetchOne();
-		bool success = row[0].get<bool>();
+		bool success = IsSuccess(ReadCall(result));
 
 		if (success) {
 			LOG_INFO("Update relationship success: uid_a={}, uid_b={}", relation._a_uid, relation._b_uid);
@@ -40,6 +45,7 @@ bool FriendDAO::Update(const FriendRelation& relation)
 
 	}
 	catch (const mysqlx::Error& error) {
+		MarkSuspect(conn);
 		LOG_ERROR("MySQL Error on update: {} (uid_a={}, uid_b={})", error.what(), relation._a_uid, relation._b_uid);
 		return false;
 	}
@@ -63,8 +69,12 @@ bool FriendDAO::InsertApply(const FriendRelation& relation, const std::string& c
 	};
 
 	try {
+		if (!conn) {
+			return {};
+		}
+
 		LOG_INFO("Inserting relationship: uid_a={}, uid_b={}", relation._a_uid, relation._b_uid);
-		auto result = conn->sql("CALL sp_insert_friend(?, ?, ?, ?, ?, ?, @success)")
+		auto result = conn->sql("CALL sp_insert_friend(?, ?, ?, ?, ?, ?)")
 			.bind(relation._a_uid)
 			.bind(relation._b_uid)
 			.bind(relation._status)
@@ -73,9 +83,7 @@ bool FriendDAO::InsertApply(const FriendRelation& relation, const std::string& c
 			.bind(relation._remark.empty() ? relation._b_uid : relation._remark)
 			.execute();
 
-		auto statusResult = conn->sql("SELECT @success").execute();
-		auto row = statusResult.fetchOne();
-		bool success = row[0].get<bool>();
+		bool success = IsSuccess(ReadCall(result));
 
 		if (success) {
 			LOG_INFO("Insert relationship success: uid_a={}, uid_b={}", relation._a_uid, relation._b_uid);
@@ -86,11 +94,90 @@ bool FriendDAO::InsertApply(const FriendRelation& relation, const std::string& c
 		return success;
 	}
 	catch (const mysqlx::Error& error) {
+		MarkSuspect(conn);
 		LOG_ERROR("MySQL Error on insert: {} (uid_a={}, uid_b={})", error.what(), relation._a_uid, relation._b_uid);
 		return false;
 	}
 }
 
+std::vector<bool> FriendDAO::InsertApplyBatch(const std::vector<std::pair<FriendRelation, std::string>>& applies)
+{
+	std::vector<bool> results(applies.size(), false);
+	if (applies.empty()) {
+		return results;
+	}
+
+	bool batchFailed = false;
+	{
+		auto conn = GetConnection();
+		defer{
+			ReleaseConnection(std::move(conn));
+		};
+
+		try {
+			if (!conn) {
+				return results;
+			}
+
+			json rows = json::array();
+			for (const auto& [relation, comments] : applies) {
+				json row;
+				row["a_uid"] = relation._a_uid;
+				row["b_uid"] = relation._b_uid;
+				row["status"] = relation._status;
+				row["comments"] = comments;
+				row["group"] = relation._group.empty() ? "MyFriends" : relation._group;
+				row["remark"] = relation._remark.empty() ? relation._b_uid : relation._remark;
+				rows.push_back(std::move(row));
+			}
+
+			LOG_INFO("Inserting relationship batch: rows={}", applies.size());
+			// sp_insert_friend_batch applies sp_insert_friend to every element of the JSON
+			// array and selects (idx, success) per element before its overall status
+			conn->startTransaction();
+			auto result = conn->sql("CALL sp_insert_friend_batch(?)")
+				.bind(rows.dump())
+				.execute();
+
+			std::vector<mysqlx::Row> perRow;
+			bool success = IsSuccess(ReadCall(result, &perRow));
+			if (!success) {
+				conn->rollback();
+				LOG_WARN("Insert relationship batch rejected: rows={}", applies.size());
+				batchFailed = true;
+			}
+			else {
+				conn->commit();
+				for (const auto& row : perRow) {
+					auto idx = row[0].get<std::size_t>();
+					if (idx < results.size()) {
+						results[idx] = row[1].get<bool>();
+					}
+				}
+				LOG_INFO("Insert relationship batch committed: rows={}", applies.size());
+			}
+		}
+		catch (const mysqlx::Error& error) {
+			MarkSuspect(conn);
+			LOG_ERROR("MySQL Error on batch insert: {} (rows={})", error.what(), applies.size());
+			try {
+				conn->rollback();
+			}
+			catch (const mysqlx::Error&) {
+			}
+			batchFailed = true;
+		}
+	}
+
+	if (batchFailed && applies.size() > 1) {
+		// isolate the offending rows instead of failing everyone in the batch
+		for (std::size_t i = 0; i < applies.size(); ++i) {
+			results[i] = InsertApply(applies[i].first, applies[i].second);
+		}
+	}
+	return results;
+}
+
 bool FriendDAO::DeleteFriendShip(const std::string& a_uid, const std::string& b_uid)
 {
 	auto conn = GetConnection();
@@ -99,15 +186,17 @@ bool FriendDAO::DeleteFriendShip(const std::string& a_uid, const std::string& b_
 	};
 
 	try {
+		if (!conn) {
+			return {};
+		}
+
 		LOG_INFO("Delete relationship: uid_a={}, uid_b={}", a_uid, b_uid);
-		auto result = conn->sql("CALL sp_delete_friend(?, ?, @success)")
+		auto result = conn->sql("CALL sp_delete_friend(?, ?)")
 			.bind(a_uid)
 			.bind(b_uid)
 			.execute();
 
-		auto statusResult = conn->sql("SELECT @success").execute();
-		auto row = statusResult.fetchOne();
-		bool success = row && row[0].get<bool>();
+		bool success = IsSuccess(ReadCall(result));
 
 		if (success) {
 			LOG_INFO("Delete relationship success: uid_a={}, uid_b={}", a_uid, b_uid);
@@ -118,6 +207,7 @@ bool FriendDAO::DeleteFriendShip(const std::string& a_uid, const std::string& b_
 		return success;
 	}
 	catch (const mysqlx::Error& error) {
+		MarkSuspect(conn);
 		LOG_ERROR("MySQL Error on Delete: {} ( uid_a={}, uid_b={} )", error.what(), a_uid, b_uid);
 		return false;
 	}
@@ -132,28 +222,22 @@ std::vector<std::shared_ptr<FriendInfo>> FriendDAO::GetUserFriends(const std::st
 	};
 
 	try {
+		if (!conn) {
+			return {};
+		}
+
 		LOG_INFO("Finding relationship: uid={}", uid);
-		auto result = conn->sql("CALL sp_search_friend(?, @success)")
+		auto result = conn->sql("CALL sp_search_friend(?)")
 			.bind(uid)
 			.execute();
 		std::vector<mysqlx::Row> rows;
-		do{
-			if (result.hasData()) {
-				auto part = result.fetchAll();
-				rows.insert(rows.end(), part.begin(), part.end());
-			}
-		} while (result.nextResult());
-		
-
-		auto statusResult = conn->sql("SELECT @success").execute();
-		auto statusRow = statusResult.fetchOne();
-		bool found = statusRow && statusRow[0].get<bool>();
+		bool found = IsSuccess(ReadCall(result, &rows));
 
 		if (!found) {
 			LOG_WARN("Get User Friends failed: uid={}", uid);
 		}
 		else {
-			for (auto row : rows) {
+			for (const auto& row : rows) {
 				auto relationship = std::make_shared<FriendInfo>(
 					std::make_shared<UserInfo>(
 						row[0].get<std::string>(), // uid
@@ -174,6 +258,7 @@ std::vector<std::shared_ptr<FriendInfo>> FriendDAO::GetUserFriends(const std::st
 		}
 	}
 	catch (const mysqlx::Error& error) {
+		MarkSuspect(conn);
 		LOG_ERROR("MySQL Error on Delete: {} ( uid={} )", error.what(), uid);
 	}
 	return friends;
@@ -189,22 +274,18 @@ std::vector<std::shared_ptr<FriendListInfo>> FriendDAO::GetApplyList(const std::
 	};
 
 	try {
+		if (!conn) {
+			return {};
+		}
+
 		LOG_INFO("Finding Apply List: uid={}", uid);
-		auto result = conn->sql("CALL sp_apply_list_friend(?, @success)")
+		auto result = conn->sql("CALL sp_apply_list_friend(?)")
 			.bind(uid)
 			.execute();
 
 		std::vector<mysqlx::Row> rows;
-		do {
-			if (result.hasData()) {
-				auto part = result.fetchAll();
-				rows.insert(rows.end(), part.begin(), part.end());
-			}
-		} while (result.nextResult());
 
-		auto statusResult = conn->sql("SELECT @success").execute();
-		auto statusRow = statusResult.fetchOne();
-		bool found = statusRow && statusRow[0].get<bool>();
+		bool found = IsSuccess(ReadCall(result, &rows));
 
 		if (!found) {
 			LOG_WARN("Get Apply List failed: uid={}", uid);
@@ -214,7 +295,7 @@ std::vector<std::shared_ptr<FriendListInfo>> FriendDAO::GetApplyList(const std::
 				LOG_WARN("No pending friend requests: uid={}", uid);
 			}
 			else {
-				for (auto row : rows) {
+				for (const auto& row : rows) {
 					auto applyInfo = std::make_shared<FriendListInfo>(
 						row[0].get<std::string>(),
 						row[1].get<std::string>(),
@@ -231,6 +312,7 @@ std::vector<std::shared_ptr<FriendListInfo>> FriendDAO::GetApplyList(const std::
 		}
 	}
 	catch (const mysqlx::Error& error) {
+		MarkSuspect(conn);
 		LOG_ERROR("MySQL Error on GetApplyList: {} ( uid={} )", error.what(), uid);
 	}
 	return friends;
@@ -246,29 +328,25 @@ std::vector<std::shared_ptr<SearchInfo>> FriendDAO::Search(const std::string& ui
 	};
 
 	try {
+		if (!conn) {
+			return {};
+		}
+
 		LOG_INFO("Finding User by Fuzzy Search: uid={}, pattern={}", uid, pattern);
-		auto result = conn->sql("CALL sp_fuzzy_search_uid_email(?, ?, @success)")
+		auto result = conn->sql("CALL sp_fuzzy_search_uid_email(?, ?)")
 			.bind(uid)
 			.bind(pattern)
 			.execute();
 
 		std::vector<mysqlx::Row> rows;
-		do {
-			if (result.hasData()) {
-				auto part = result.fetchAll();
-				rows.insert(rows.end(), part.begin(), part.end());
-			}
-		} while (result.nextResult());
 
-		auto statusResult = conn->sql("SELECT @success").execute();
-		auto statusRow = statusResult.fetchOne();
-		bool found = statusRow && statusRow[0].get<bool>();
+		bool found = IsSuccess(ReadCall(result, &rows));
 
 		if (!found) {
 			LOG_WARN("Fuzzy Search failed: uid={}, pattern={}", uid, pattern);
 		}
 		else {
-			for (auto row : rows) {
+			for (const auto& row : rows) {
 				auto user = std::make_shared<SearchInfo>(
 					row[0].get<std::string>(),
 					row[1].get<std::string>(),
@@ -282,7 +360,108 @@ std::vector<std::shared_ptr<SearchInfo>> FriendDAO::Search(const std::string& ui
 		}
 	}
 	catch (const mysqlx::Error& error) {
+		MarkSuspect(conn);
 		LOG_ERROR("MySQL Error on Fuzzy Search: {} (uid={}, pattern={})", error.what(), uid, pattern);
 	}
 	return results;
-}
\ No newline at end of file
+}
+
+std::vector<std::shared_ptr<FriendInfo>> FriendDAO::GetUserFriendEdges(const std::string& uid)
+{
+	// sp_search_friend_edges selects (friend_uid, group, remark) from the friend table only
+	return ReadFriendEdges("sp_search_friend_edges", uid);
+}
+
+std::vector<std::shared_ptr<FriendInfo>> FriendDAO::GetSentApplyEdges(const std::string& uid)
+{
+	// sp_sent_apply_edges selects the same columns for uid's rows still waiting on consent
+	return ReadFriendEdges("sp_sent_apply_edges", uid);
+}
+
+std::vector<std::shared_ptr<FriendInfo>> FriendDAO::ReadFriendEdges(const std::string& procedure, const std::string& uid)
+{
+	auto conn = GetConnection();
+	std::vector<std::shared_ptr<FriendInfo>> friends;
+	defer{
+		ReleaseConnection(std::move(conn));
+	};
+
+	try {
+		if (!conn) {
+			return {};
+		}
+
+		LOG_INFO("Finding relationship edges: uid={}, procedure={}", uid, procedure);
+		auto result = conn->sql("CALL " + procedure + "(?)")
+			.bind(uid)
+			.execute();
+		std::vector<mysqlx::Row> rows;
+		bool found = IsSuccess(ReadCall(result, &rows));
+
+		if (!found) {
+			LOG_WARN("Get relationship edges failed: uid={}, procedure={}", uid, procedure);
+		}
+		else {
+			for (const auto& row : rows) {
+				auto user = std::make_shared<UserInfo>();
+				user->_uid = row[0].get<std::string>();
+				friends.emplace_back(std::make_shared<FriendInfo>(
+					user,
+					row[1].isNull() ? "" : row[1].get<std::string>(), // group
+					row[2].isNull() ? "" : row[2].get<std::string>() // remark
+				));
+			}
+			LOG_INFO("Get relationship edges success: uid={}, procedure={}, entries={}", uid, procedure, friends.size());
+		}
+	}
+	catch (const mysqlx::Error& error) {
+		MarkSuspect(conn);
+		LOG_ERROR("MySQL Error on {}: {} ( uid={} )", procedure, error.what(), uid);
+	}
+	return friends;
+}
+
+std::vector<std::shared_ptr<FriendListInfo>> FriendDAO::GetApplyEdges(const std::string& uid)
+{
+	auto conn = GetConnection();
+	std::vector<std::shared_ptr<FriendListInfo>> applies;
+	defer{
+		ReleaseConnection(std::move(conn));
+	};
+
+	try {
+		if (!conn) {
+			return {};
+		}
+
+		LOG_INFO("Finding Apply edges: uid={}", uid);
+		// sp_apply_list_edges selects (from_uid, comments, time, status) from the apply table only
+		auto result = conn->sql("CALL sp_apply_list_edges(?)")
+			.bind(uid)
+			.execute();
+		std::vector<mysqlx::Row> rows;
+		bool found = IsSuccess(ReadCall(result, &rows));
+
+		if (!found) {
+			LOG_WARN("Get Apply edges failed: uid={}", uid);
+		}
+		else {
+			for (const auto& row : rows) {
+				applies.emplace_back(std::make_shared<FriendListInfo>(
+					row[0].get<std::string>(),
+					"",
+					"",
+					row[1].get<std::string>(),
+					row[2].get<size_t>(),
+					row[3].get<int>()
+				));
+			}
+			LOG_INFO("Get Apply edges success: uid={}, entries={}", uid, applies.size());
+		}
+	}
+	catch (const mysqlx::Error& error) {
+		MarkSuspect(conn);
+		LOG_ERROR("MySQL Error on GetApplyEdges: {} ( uid={} )", error.what(), uid);
+	}
+	return applies;
+}
@@ -3,21 +3,59 @@
 #include "UserInfo.h"
 
 #include <mysqlx/xdevapi.h>
+#include <utility>
 class FriendDAO:public BaseDAO<FriendRelation>
 {
 public:
+	using BaseDAO<FriendRelation>::BaseDAO;
+
 	bool Insert(const FriendRelation& relation) override;
 	bool Update(const FriendRelation& relation) override;
 	bool Delete(const std::string& uid) override;
 	std::unique_ptr<FriendRelation> Search(const std::string& uid) override;
 
 	bool InsertApply(const FriendRelation& relation, const std::string& comments);
+
+	/**
+	 * @brief Insert many applications in one call and one commit
+	 *
+	 * Falls back to one InsertApply per row if the batch fails as a whole.
+	 *
+	 * @param applies relation and comments per application
+	 * @return std::vector<bool> result of applies[i] at index i
+	 */
+	std::vector<bool> InsertApplyBatch(const std::vector<std::pair<FriendRelation, std::string>>& applies);
 	bool DeleteFriendShip(const std::string& a_uid, const std::string& b_uid);
 	std::vector<std::shared_ptr<FriendInfo>> GetUserFriends(const std::string& uid);
 	std::vector<std::shared_ptr<FriendListInfo>> GetApplyList(const std::string& uid);
+
+	/**
+	 * @brief Friends of uid without joining the users table
+	 *
+	 * For sharded deployments, where a friend's user row may live on another shard.
+	 * Only _user->_uid, _group and _remark are filled in.
+	 */
+	std::vector<std::shared_ptr<FriendInfo>> GetUserFriendEdges(const std::string& uid);
+
+	/**
+	 * @brief Applications to uid without joining the users table
+	 *
+	 * Like GetUserFriendEdges; _username and _avatar are left empty.
+	 */
+	std::vector<std::shared_ptr<FriendListInfo>> GetApplyEdges(const std::string& uid);
+
+	/**
+	 * @brief Applications uid made that are still waiting on consent
+	 *
+	 * Filled in like GetUserFriendEdges, from uid's side of each relation.
+	 */
+	std::vector<std::shared_ptr<FriendInfo>> GetSentApplyEdges(const std::string& uid);
 	std::vector<std::shared_ptr<SearchInfo>> Search(const std::string& uid, const std::string& pattern);
 
 private:
+	// procedure selects (friend_uid, group, remark) rows, then the status row
+	std::vector<std::shared_ptr<FriendInfo>> ReadFriendEdges(const std::string& procedure, const std::string& uid);
+
 	const std::string ENCRYPTION_KEY = "print-secret-key";
 };
 
@@ -1,90 +1,180 @@
 ﻿#include "FriendGrpcClient.h"
 #include "ConfigManager.h"
-#include "Defer.h"
 #include "Logger.h"
+#include "PeerDiscovery.h"
 #include "const.h"
 
-message::FriendResponse FriendGrpcClient::SendFriend(const std::string server_ip, const message::FriendRequest& request)
+#include <algorithm>
+#include <sstream>
+
+void FriendGrpcClient::SendFriend(const std::string server_ip, const message::FriendRequest& request, FriendCallback callback)
 {
-	grpc::ClientContext context;
-	message::FriendResponse response;
+	LOG_INFO("Forwarding friend request from applicant: {} to recipient: {} on {}", request.applicant(), request.recipient(), server_ip);
 
-	auto applicant = request.applicant();
-	auto recipient = request.recipient();
+	message::NotifyFrame frame;
+	*frame.mutable_friend_request() = request;
+	Post(server_ip, std::move(frame), [applicant = request.applicant(), recipient = request.recipient(), callback](bool delivered) {
+		if (!callback) {
+			return;
+		}
+		message::FriendResponse response;
+		response.set_applicant(applicant);
+		response.set_recipient(recipient);
+		response.set_error(static_cast<int>(delivered ? ErrorCodes::SUCCESS : ErrorCodes::RPC_FAILED));
+		callback(response);
+	});
+}
 
-	LOG_INFO("applicant: {} ,and recipient: {}", applicant, recipient);
+void FriendGrpcClient::HandleFriend(const std::string server_ip, const message::FriendApprovalRequest& request, ApprovalCallback callback)
+{
+	LOG_INFO("Forwarding friend approval from applicant: {} to recipient: {} on {}", request.applicant(), request.recipient(), server_ip);
 
-	defer{
+	message::NotifyFrame frame;
+	*frame.mutable_friend_approval() = request;
+	Post(server_ip, std::move(frame), [applicant = request.applicant(), recipient = request.recipient(), callback](bool delivered) {
+		if (!callback) {
+			return;
+		}
+		message::FriendApprovalResponse response;
 		response.set_applicant(applicant);
 		response.set_recipient(recipient);
-		response.set_error(static_cast<int>(ErrorCodes::SUCCESS));
-	};
+		response.set_error(static_cast<int>(delivered ? ErrorCodes::SUCCESS : ErrorCodes::RPC_FAILED));
+		callback(response);
+	});
+}
 
-	auto iter = _pools.find(server_ip);
+void FriendGrpcClient::Post(const std::string& server_ip, message::NotifyFrame frame, PeerStream::Delivered delivered)
+{
+	PeerStream::Delivered dropped;
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		auto iter = _peers.find(server_ip);
+		if (iter != _peers.end()) {
+			PostLocked(server_ip, iter->second, std::move(frame), std::move(delivered));
+			return;
+		}
 
-	if (iter == _pools.end()) {
-		return response;
+		auto& parked = _parked[server_ip];
+		if (parked.frames.empty()) {
+			parked.since = Clock::now();
+		}
+		if (parked.frames.size() >= _maxParked) {
+			LOG_WARN("Too many notifications parked for unknown server {}, dropping the oldest", server_ip);
+			dropped = std::move(parked.frames.front().delivered);
+			parked.frames.pop_front();
+		}
+		parked.frames.push_back(Pending{ std::move(frame), std::move(delivered) });
 	}
 
-	auto& pool = iter->second;
-	auto stub = pool->GetConnection();
-	LOG_INFO("Calling SendFriend from applicant: {} to recipient: {} on {}", applicant, recipient, server_ip);
-	auto status = stub->SendFriend(&context, request, &response);
-
-	if (!status.ok()) {
-		response.set_error(static_cast<int>(ErrorCodes::RPC_FAILED));
-		LOG_ERROR("gRPC SendFriend Failed:{}", status.error_message());
-		return response;
+	if (dropped) {
+		dropped(false);
 	}
-	LOG_DEBUG("gRPC FriendGrpcClient succeeded from applicant: {} to recipient: {} on {}", applicant, recipient);
-	pool->ReturnConnection(std::move(stub));
-
-	return response;
+	LOG_INFO("Server {} is not known yet, parked notification until discovery finds it", server_ip);
+	PeerDiscovery::GetInstance()->RequestRefresh();
 }
 
-message::FriendApprovalResponse FriendGrpcClient::HandleFriend(const std::string server_ip, const message::FriendApprovalRequest& request)
+void FriendGrpcClient::PostLocked(const std::string& name, Peer& peer, message::NotifyFrame frame, PeerStream::Delivered delivered)
 {
-	grpc::ClientContext context;
-	message::FriendApprovalResponse response;
+	if (!peer.stream) {
+		peer.stream = std::make_unique<PeerStream>(name, peer.host, peer.port);
+	}
+	peer.lastUsed = Clock::now();
+	peer.stream->Post(std::move(frame), std::move(delivered));
+}
 
-	auto applicant = request.applicant();
-	auto recipient = request.recipient();
+void FriendGrpcClient::UpdatePeers(const std::vector<PeerAddress>& peers)
+{
+	// PeerStream's destructor joins its thread, so closed streams are destroyed outside the lock
+	std::vector<std::unique_ptr<PeerStream>> closed;
+	std::vector<PeerStream::Delivered> expired;
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		std::unordered_map<std::string, const PeerAddress*> live;
+		for (const auto& address : peers) {
+			live[address.name] = &address;
+		}
 
-	LOG_INFO("applicant: {} ,and recipient: {}", applicant, recipient);
+		for (auto iter = _peers.begin(); iter != _peers.end();) {
+			auto& peer = iter->second;
+			auto found = live.find(iter->first);
+			if (found == live.end()) {
+				if (peer.isStatic) {
+					++iter;
+					continue;
+				}
+				LOG_INFO("Peer {} left the registry, closing it", iter->first);
+				closed.push_back(std::move(peer.stream));
+				iter = _peers.erase(iter);
+				continue;
+			}
+
+			if (peer.host != found->second->host || peer.port != found->second->port) {
+				LOG_INFO("Peer {} moved to {}:{}", iter->first, found->second->host, found->second->port);
+				peer.host = found->second->host;
+				peer.port = found->second->port;
+				closed.push_back(std::move(peer.stream));
+			}
+			live.erase(found);
+			++iter;
+		}
 
-	defer{
-		response.set_applicant(applicant);
-		response.set_recipient(recipient);
-		response.set_error(static_cast<int>(ErrorCodes::SUCCESS));
-	};
+		for (const auto& [name, address] : live) {
+			LOG_INFO("Discovered peer {} at {}:{}", name, address->host, address->port);
+			auto& peer = _peers[name];
+			peer.host = address->host;
+			peer.port = address->port;
+		}
 
-	auto iter = _pools.find(server_ip);
-	
-	if (iter == _pools.end()) {
-		return response;
+		auto now = Clock::now();
+		for (auto iter = _parked.begin(); iter != _parked.end();) {
+			auto peer = _peers.find(iter->first);
+			if (peer != _peers.end()) {
+				LOG_INFO("Flushing {} parked notifications to {}", iter->second.frames.size(), iter->first);
+				for (auto& pending : iter->second.frames) {
+					PostLocked(iter->first, peer->second, std::move(pending.frame), std::move(pending.delivered));
+				}
+				iter = _parked.erase(iter);
+			}
+			else if (now - iter->second.since > _parkedTTL) {
+				LOG_WARN("Server {} never showed up, dropped {} parked notifications", iter->first, iter->second.frames.size());
+				for (auto& pending : iter->second.frames) {
+					expired.push_back(std::move(pending.delivered));
+				}
+				iter = _parked.erase(iter);
+			}
+			else {
+				++iter;
+			}
+		}
 	}
 
-	auto& pool = iter->second;
-	auto stub = pool->GetConnection();
-	LOG_INFO("Calling HandleFriend from applicant: {} to recipient: {} on {}", applicant, recipient, server_ip);
-	auto status = stub->HandleFriend(&context, request, &response);
-
-	if (!status.ok()) {
-		response.set_error(static_cast<int>(ErrorCodes::RPC_FAILED));
-		LOG_ERROR("gRPC HandleFriend Failed:{}", status.error_message());
-		return response;
+	for (auto& delivered : expired) {
+		if (delivered) {
+			delivered(false);
+		}
 	}
+}
 
-	LOG_DEBUG("gRPC HandleFriend succeeded from applicant: {} to recipient: {} on {}", applicant, recipient);
-	pool->ReturnConnection(std::move(stub));
-
-
-	return response;
+void FriendGrpcClient::CloseIdlePeers(std::chrono::seconds idle)
+{
+	std::vector<std::unique_ptr<PeerStream>> closed;
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		auto now = Clock::now();
+		for (auto& [name, peer] : _peers) {
+			if (peer.stream && now - peer.lastUsed > idle && peer.stream->Pending() == 0) {
+				LOG_INFO("Closing idle stream to {}", name);
+				closed.push_back(std::move(peer.stream));
+			}
+		}
+	}
 }
 
 FriendGrpcClient::FriendGrpcClient() 
 {
 	auto& cfg = ConfigManager::GetInstance();
+	_maxParked = static_cast<std::size_t>(std::max(1, cfg.getIntValue("PeerDiscovery", "MaxParked", 1000)));
+	_parkedTTL = std::chrono::seconds(cfg.getIntValue("PeerDiscovery", "ParkedTTL", 30));
 	
 	auto serverList = cfg["PeerServer"]["ServerList"];
 
@@ -96,15 +186,14 @@ FriendGrpcClient::FriendGrpcClient()
 		servers.emplace_back(serverName);
 	}
 
+	// static peers seed the table; streams open on first use
 	for (auto& serverName : servers) {
 		if (cfg[serverName]["name"].empty()) {
 			continue;
 		}
-		_pools[cfg[serverName]["name"]] =
-			std::make_unique<ChatConPool>(
-				(size_t)(std::thread::hardware_concurrency()),
-				cfg[serverName]["host"],
-				cfg[serverName]["port"]
-			);
+		auto& peer = _peers[cfg[serverName]["name"]];
+		peer.host = cfg[serverName]["host"];
+		peer.port = cfg[serverName]["port"];
+		peer.isStatic = true;
 	}
-}
\ No newline at end of file
+}
@@ -1,24 +1,88 @@
 ﻿#pragma once
 
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <mutex>
 #include <unordered_map>
+#include <vector>
 #include <grpcpp/grpcpp.h>
 #include "message.grpc.pb.h"
 #include "Singleton.h"
-#include "GrpcPool.h"
+#include "PeerStream.h"
 #include "const.h"
 
+/**
+ * @class FriendGrpcClient
+ * @brief Forwards friend notifications to other ChatServers.
+ *
+ * Peers come from the static [PeerServer] list and from StatusServer's node
+ * registry (see PeerDiscovery). A peer's PeerStream is opened on first use and
+ * closed again once it has been idle. Frames for a server name that is not
+ * known yet are parked briefly and flushed when discovery finds it.
+ * Sending only queues a frame; the callback reports SUCCESS once the peer has
+ * acknowledged it and RPC_FAILED when it was dropped, from a PeerStream thread.
+ */
 class FriendGrpcClient:public Singleton<FriendGrpcClient>
 {
-	using ChatConPool = GrpcPool<message::FriendService, message::FriendService::Stub>;
 	friend class Singleton<FriendGrpcClient>;
 
 public:
-	message::FriendResponse SendFriend(const std::string server_ip, const message::FriendRequest& request);
-	message::FriendApprovalResponse HandleFriend(const std::string server_ip, const message::FriendApprovalRequest& request);
+	struct PeerAddress {
+		std::string name;
+		std::string host;
+		std::string port;
+	};
 
+	using FriendCallback = std::function<void(const message::FriendResponse&)>;
+	using ApprovalCallback = std::function<void(const message::FriendApprovalResponse&)>;
+
+	void SendFriend(const std::string server_ip, const message::FriendRequest& request, FriendCallback callback = nullptr);
+	void HandleFriend(const std::string server_ip, const message::FriendApprovalRequest& request, ApprovalCallback callback = nullptr);
+
+	/**
+	 * @brief Replace the discovered peer set; static peers are only re-addressed, never removed
+	 *
+	 * @param peers every live ChatServer except this one
+	 */
+	void UpdatePeers(const std::vector<PeerAddress>& peers);
+
+	/**
+	 * @brief Close streams that carried nothing for idle and have nothing left to deliver
+	 *
+	 * @param idle
+	 */
+	void CloseIdlePeers(std::chrono::seconds idle);
 
 private:
+	using Clock = std::chrono::steady_clock;
+
+	struct Peer {
+		std::string host;
+		std::string port;
+		bool isStatic = false;
+		std::unique_ptr<PeerStream> stream;
+		Clock::time_point lastUsed;
+	};
+
+	struct Pending {
+		message::NotifyFrame frame;
+		PeerStream::Delivered delivered;
+	};
+
+	struct Parked {
+		std::deque<Pending> frames;
+		Clock::time_point since;
+	};
+
 	FriendGrpcClient();
-	std::unordered_map<std::string, std::unique_ptr<ChatConPool>> _pools;
-};
 
+	void Post(const std::string& server_ip, message::NotifyFrame frame, PeerStream::Delivered delivered);
+	void PostLocked(const std::string& name, Peer& peer, message::NotifyFrame frame, PeerStream::Delivered delivered);
+
+	std::mutex _mutex;
+	std::unordered_map<std::string, Peer> _peers;
+	std::unordered_map<std::string, Parked> _parked;
+	std::size_t _maxParked;
+	std::chrono::seconds _parkedTTL;
+};
@@ -3,167 +3,179 @@
 #include "CSession.h"
 #include "const.h"
 #include "Logger.h"
-#include "Defer.h"
+#include "ConfigManager.h"
 #include "RedisConPool.h"
-#include "MySQLManager.h"
+#include "UserInfoCache.h"
+#include "FriendCache.h"
+#include "OfflineInbox.h"
 
+#include <algorithm>
 #include <nlohmann/json.hpp>
 using json = nlohmann::json;
 
 FriendServerImpl::FriendServerImpl()
 {
-
+	_window = static_cast<uint32_t>(std::max(1, ConfigManager::GetInstance().getIntValue("PeerStream", "Window", 1024)));
 }
 
 grpc::Status FriendServerImpl::SendFriend(grpc::ServerContext* context, const message::FriendRequest* request, message::FriendResponse* response)
 {
-	auto applicant = request->applicant();
-	auto recipient = request->recipient();
+	DeliverFriendRequest(*request);
 
-	LOG_INFO("Received friend request from {} to {}", applicant, recipient);
-	auto session = UserManager::GetInstance()->GetSession(request->recipient());
+	response->set_error(static_cast<int>(ErrorCodes::SUCCESS));
+	response->set_applicant(request->applicant());
+	response->set_recipient(request->recipient());
+	return grpc::Status::OK;
+}
 
+grpc::Status FriendServerImpl::HandleFriend(grpc::ServerContext* context, const message::FriendApprovalRequest* request, message::FriendApprovalResponse* response)
+{
+	DeliverFriendApproval(*request);
 
-	defer{
-		response->set_error(static_cast<int>(ErrorCodes::SUCCESS));
-		response->set_applicant(applicant);
-		response->set_recipient(recipient);
-	};
+	response->set_error(static_cast<int>(ErrorCodes::SUCCESS));
+	response->set_applicant(request->applicant());
+	response->set_recipient(request->recipient());
+	return grpc::Status::OK;
+}
 
-	if (session == nullptr) {
+grpc::Status FriendServerImpl::NotifyStream(grpc::ServerContext* context, grpc::ServerReaderWriter<message::NotifyAck, message::NotifyBatch>* stream)
+{
+	LOG_INFO("Notify stream opened by {}", context->peer());
+
+	message::NotifyAck ack;
+	ack.set_acked_seq(0);
+	ack.set_window(_window);
+	if (!stream->Write(ack)) {
 		return grpc::Status::OK;
 	}
 
+	message::NotifyBatch batch;
+	std::size_t frames = 0;
+	while (stream->Read(&batch)) {
+		frames += batch.frames_size();
+		ack.set_acked_seq(ApplyBatch(batch));
+		if (!stream->Write(ack)) {
+			break;
+		}
+	}
+
+	LOG_INFO("Notify stream from {} closed after {} frames", context->peer(), frames);
+	return grpc::Status::OK;
+}
+
+uint64_t FriendServerImpl::ApplyBatch(const message::NotifyBatch& batch)
+{
+	PeerCursor cursor{ batch.epoch(), 0 };
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		auto iter = _cursors.find(batch.source());
+		// a new epoch means the sender restarted and its sequence started over
+		if (iter != _cursors.end() && iter->second.epoch == batch.epoch()) {
+			cursor = iter->second;
+		}
+	}
+
+	for (const auto& frame : batch.frames()) {
+		if (frame.seq() <= cursor.lastSeq) {
+			continue;
+		}
+
+		switch (frame.payload_case()) {
+		case message::NotifyFrame::kFriendRequest:
+			DeliverFriendRequest(frame.friend_request());
+			break;
+		case message::NotifyFrame::kFriendApproval:
+			DeliverFriendApproval(frame.friend_approval());
+			break;
+		default:
+			LOG_WARN("Ignoring notify frame {} from {} without payload", frame.seq(), batch.source());
+			break;
+		}
+		cursor.lastSeq = frame.seq();
+	}
+
+	std::lock_guard<std::mutex> lock(_mutex);
+	auto& stored = _cursors[batch.source()];
+	if (stored.epoch != cursor.epoch || stored.lastSeq < cursor.lastSeq) {
+		stored = cursor;
+	}
+	return stored.lastSeq;
+}
+
+void FriendServerImpl::DeliverFriendRequest(const message::FriendRequest& request)
+{
+	auto applicant = request.applicant();
+	auto recipient = request.recipient();
+
+	LOG_INFO("Received friend request from {} to {}", applicant, recipient);
+
 	json notify;
 	notify["error"] = static_cast<int>(ErrorCodes::SUCCESS);
-	notify["uid"] = request->applicant();
-	notify["avatar"] = request->avatar();
-	notify["comments"] = request->message();
-	notify["time"] = request->time();
-	notify["username"] = request->username();
+	notify["uid"] = request.applicant();
+	notify["avatar"] = request.avatar();
+	notify["comments"] = request.message();
+	notify["time"] = request.time();
+	notify["username"] = request.username();
+
+	auto session = UserManager::GetInstance()->GetSession(recipient);
+	if (session == nullptr) {
+		// logged out since the sender looked up the route
+		OfflineInbox::GetInstance()->Append(recipient, static_cast<int>(MessageID::MESSAGE_NOTIFY_ADD_FRIEND), notify.dump());
+		return;
+	}
+
+	FriendCache::GetInstance()->SetStatus(recipient, applicant, static_cast<int>(AddStatusCodes::NotConsent));
 
 	session->Send(notify.dump(4), static_cast<int>(MessageID::MESSAGE_NOTIFY_ADD_FRIEND));
 	LOG_INFO("Send json is {}", notify.dump(4));
-
-	return grpc::Status::OK;
 }
 
-grpc::Status FriendServerImpl::HandleFriend(grpc::ServerContext* context, const message::FriendApprovalRequest* request, message::FriendApprovalResponse* response)
+void FriendServerImpl::DeliverFriendApproval(const message::FriendApprovalRequest& request)
 {
-	auto applicant = request->applicant();
-	auto recipient = request->recipient();
+	auto applicant = request.applicant();
+	auto recipient = request.recipient();
 
 	LOG_INFO("Received friend approval from {} to {}", applicant, recipient);
-	auto session = UserManager::GetInstance()->GetSession(request->recipient());
-
-	defer{
-		response->set_error(static_cast<int>(ErrorCodes::SUCCESS));
-		response->set_applicant(applicant);
-		response->set_recipient(recipient);
-	};
-
-	if (session == nullptr) {
-		return grpc::Status::OK;
+	auto session = UserManager::GetInstance()->GetSession(recipient);
+	if (session != nullptr) {
+		FriendCache::GetInstance()->SetStatus(recipient, applicant, static_cast<int>(AddStatusCodes::MutualFriend));
 	}
 
 	auto userInfo = std::make_shared<UserInfo>();
-	std::string baseKey = ChatServiceConstant::USER_INFO_PREFIX + request->applicant();
-
 
 	json notify;
-	auto baseInfoExists = GetUserInfo(baseKey,request->applicant(),userInfo);
+	auto baseInfoExists = UserInfoCache::GetInstance()->GetUserInfo(applicant, userInfo);
 
 	if (!baseInfoExists) {
 		notify["error"] = static_cast<int>(ErrorCodes::UID_INVALID);
 	}
 	else {
 		notify["error"] = static_cast<int>(ErrorCodes::SUCCESS);
-		notify["uid"] = request->applicant();
+		notify["uid"] = applicant;
 		notify["username"] = userInfo->_username;
 		notify["avatar"] = userInfo->_avatar;
 		notify["email"] = userInfo->_email;
 		notify["birth"] = userInfo->_birth;
 		notify["sex"] = userInfo->_sex;
 
-		notify["grouping"] = request->grouping();
-
-		std::string localRemark;
-		try {
-			auto friends = MySQLManager::GetInstance()->GetFriendList(recipient);
-			for (const auto& f : friends) {
-				if (f && f->_user && f->_user->_uid == applicant) {
-					localRemark = f->_remark;
-					break;
-				}
-			}
-		}
-		catch (const std::exception& e) {
-			LOG_WARN("Failed to fetch friend list to obtain local remark: {}", e.what());
-		}
+		notify["grouping"] = request.grouping();
 
-		if (!localRemark.empty()) {
-			notify["remark"] = localRemark;
+		FriendCache::Relation relation;
+		if (FriendCache::GetInstance()->GetRelation(recipient, applicant, relation) && !relation.remark.empty()) {
+			notify["remark"] = relation.remark;
 		}
 		else {
-			notify["remark"] = request->remark();
-		}
-	}
-	
-	session->Send(notify.dump(4),static_cast<int>(MessageID::MESSAGE_NOTIFY_APPROVAL_FRIEND));
-	LOG_INFO("Send json is {}", notify.dump(4));
-
-	return grpc::Status::OK;
-}
-
-bool FriendServerImpl::GetUserInfo(const std::string& baseKey, const std::string& uid, std::shared_ptr<UserInfo>& userInfo)
-{
-	auto baseInfo = RedisConPool::GetInstance().get(baseKey).value();
-
-	if (!baseInfo.empty()) {
-		try {
-			auto src = json::parse(baseInfo);
-			userInfo->_uid = src["uid"].get<std::string>();
-			userInfo->_username = src["username"].get<std::string>();
-			userInfo->_password = src["password"].get<std::string>();
-			userInfo->_avatar = src["avatar"].get<std::string>();
-			userInfo->_birth = src["birth"].get<std::string>();
-			userInfo->_sex = src["sex"].get<std::string>();
-			userInfo->_email = src["email"].get<std::string>();
-
-			LOG_INFO("Retrieved user info for uid: {}", uid);
-		}
-		catch (const json::parse_error& e) {
-			LOG_WARN("Failed to parse JSON in GetUserInfo: {}", e.what());
-			return false;
+			notify["remark"] = request.remark();
 		}
-		return true;
 	}
-	else {
-		LOG_ERROR("No user info found for uid: {}", uid);
-
-		std::shared_ptr<UserInfo> tmp_userInfo = nullptr;
-		tmp_userInfo = MySQLManager::GetInstance()->GetUser(uid);
 
-		if (tmp_userInfo == nullptr) {
-			LOG_ERROR("No user found in MySQL for uid: {}", uid);
-			return false;
+	if (session == nullptr) {
+		if (baseInfoExists) {
+			OfflineInbox::GetInstance()->Append(recipient, static_cast<int>(MessageID::MESSAGE_NOTIFY_APPROVAL_FRIEND), notify.dump());
 		}
-
-		userInfo = tmp_userInfo;
-
-		json root;
-		root["uid"] = userInfo->_uid;
-		root["username"] = userInfo->_username;
-		root["email"] = userInfo->_email;
-		root["password"] = userInfo->_password;
-		root["birth"] = userInfo->_birth;
-		root["avatar"] = userInfo->_avatar;
-		root["sex"] = userInfo->_sex;
-
-		std::string redisString = root.dump(4);
-		RedisConPool::GetInstance().set(baseKey, redisString);
-		LOG_INFO("Cached user info for uid: {}", uid);
+		return;
 	}
-
-	return true;
+	
+	session->Send(notify.dump(4),static_cast<int>(MessageID::MESSAGE_NOTIFY_APPROVAL_FRIEND));
+	LOG_INFO("Send json is {}", notify.dump(4));
 }
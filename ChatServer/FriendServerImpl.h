@@ -1,5 +1,9 @@
 ﻿#pragma once
 
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
 #include <grpcpp/grpcpp.h>
 #include "message.grpc.pb.h"
 #include "UserInfo.h"
@@ -11,8 +15,27 @@ public:
 
 	grpc::Status SendFriend(grpc::ServerContext* context, const message::FriendRequest* request, message::FriendResponse* response) override;
 	grpc::Status HandleFriend(grpc::ServerContext* context, const message::FriendApprovalRequest* request, message::FriendApprovalResponse* response) override;
+	grpc::Status NotifyStream(grpc::ServerContext* context, grpc::ServerReaderWriter<message::NotifyAck, message::NotifyBatch>* stream) override;
 
 private:
-	bool GetUserInfo(const std::string& baseKey,const std::string& uid,std::shared_ptr<UserInfo>& userInfo);
+	struct PeerCursor {
+		uint64_t epoch;
+		uint64_t lastSeq;
+	};
+
+	/**
+	 * @brief Deliver the frames of a batch that were not delivered before
+	 *
+	 * @param batch
+	 * @return highest sequence delivered from batch.source()
+	 */
+	uint64_t ApplyBatch(const message::NotifyBatch& batch);
+
+	void DeliverFriendRequest(const message::FriendRequest& request);
+	void DeliverFriendApproval(const message::FriendApprovalRequest& request);
+
+	uint32_t _window;
+	std::mutex _mutex;
+	std::unordered_map<std::string, PeerCursor> _cursors;
 };
 
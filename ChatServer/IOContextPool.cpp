@@ -1,4 +1,5 @@
 #include "IOContextPool.h"
+#include "RedisConPool.h"
 
 IOContextPool::~IOContextPool()
 {
@@ -41,6 +42,7 @@ IOContextPool::IOContextPool(std::size_t size /*= std::thread::hardware_concurre
 	for (std::size_t i = 0; i < size; ++i) {
 		_threads.emplace_back(
 			[this, i]() {
+				RedisConPool::BindThread();
 				_ioContext[i].run();
 			}
 		);
@@ -2,12 +2,23 @@
 #include "StatusGrpcClient.h"
 #include "MySQLManager.h"
 #include "RedisConPool.h"
+#include "RedisBatcher.h"
+#include "ValueCodec.h"
 #include "ConfigManager.h"
 #include "UserManager.h"
+#include "NegativeCache.h"
+#include "UserInfoCache.h"
+#include "UserGrpcClient.h"
+#include "SearchCache.h"
+#include "FriendCache.h"
+#include "RouteCache.h"
+#include "OfflineInbox.h"
+#include "FriendApplyWriter.h"
 #include "Defer.h"
 #include "Logger.h"
 
 #include <chrono>
+#include <optional>
 #include "FriendGrpcClient.h"
 
 LogicSystem::~LogicSystem()
@@ -34,6 +45,23 @@ void LogicSystem::PostMessageToQueue(std::shared_ptr<LogicNode> message)
     }
 }
 
+void LogicSystem::PostTask(std::function<void()> task)
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    _tasks.push(std::move(task));
+
+    if (_tasks.size() == 1 && _messageQueue.empty()) {
+        lock.unlock();
+        _consume.notify_one();
+    }
+}
+
+std::size_t LogicSystem::QueueDepth()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _messageQueue.size() + _tasks.size();
+}
+
 LogicSystem::LogicSystem():
     _b_stop(false)
 {
@@ -46,14 +74,19 @@ LogicSystem::LogicSystem():
 void LogicSystem::DealMessage()
 {
     LOG_INFO("Message processing thread started");
+    RedisConPool::BindThread();
     while (true) {
         std::unique_lock<std::mutex> lock(_mutex);
-        while (_messageQueue.empty() && !_b_stop) {
+        while (_messageQueue.empty() && _tasks.empty() && !_b_stop) {
             _consume.wait(lock);
         }
 
         if (_b_stop) {
-            LOG_INFO("Stopping message processing, remaining messages: {}", _messageQueue.size());
+            LOG_INFO("Stopping message processing, remaining messages: {}, tasks: {}", _messageQueue.size(), _tasks.size());
+            while (!_tasks.empty()) {
+                _tasks.front()();
+                _tasks.pop();
+            }
             while (!_messageQueue.empty()) {
                 auto messageNode = _messageQueue.front();
 
@@ -74,6 +107,14 @@ void LogicSystem::DealMessage()
             break;
         }
 
+        if (!_tasks.empty()) {
+            auto task = std::move(_tasks.front());
+            _tasks.pop();
+            RedisBatcher::Tick tick;
+            task();
+            continue;
+        }
+
         auto messageNode = _messageQueue.front();
         LOG_DEBUG("Processing message ID: {}", messageNode->_receiveNode->GetId());
 
@@ -83,11 +124,15 @@ void LogicSystem::DealMessage()
             _messageQueue.pop();
             continue;
         }
-        callBackIter->second(
-            messageNode->_session,
-            messageNode->_receiveNode->GetId(),
-            std::string(messageNode->_receiveNode->_data, messageNode->_receiveNode->_currentLength)
-        );
+        {
+            // Redis commands a handler issues through RedisBatcher share round trips
+            RedisBatcher::Tick tick;
+            callBackIter->second(
+                messageNode->_session,
+                messageNode->_receiveNode->GetId(),
+                std::string(messageNode->_receiveNode->_data, messageNode->_receiveNode->_currentLength)
+            );
+        }
         _messageQueue.pop();
         LOG_DEBUG("Message processed, remaining queue size: {}", _messageQueue.size());
     }
@@ -134,10 +179,14 @@ void LogicSystem::LoginHandler(std::shared_ptr<CSession> session, const size_t&
     LOG_INFO("Processing login request...");
 
     json root;
+    // cleared once the login is handed to FinishLogin, which answers it instead
+    bool respond = true;
     defer{
-		std::string returnStr = root.dump(4);
-		session->Send(returnStr, static_cast<size_t>(MessageID::MESSAGE_CHAT_LOGIN_RESPONSE));
-        LOG_INFO("Send json is {}", returnStr);
+        if (respond) {
+            std::string returnStr = root.dump(4);
+            session->Send(returnStr, static_cast<size_t>(MessageID::MESSAGE_CHAT_LOGIN_RESPONSE));
+            LOG_INFO("Send json is {}", returnStr);
+        }
     };
 
     try {
@@ -147,30 +196,110 @@ void LogicSystem::LoginHandler(std::shared_ptr<CSession> session, const size_t&
         std::string token = src["token"].get<std::string>();
         LOG_INFO("Login attempt - UID: {}, Token length: {}", uid, token.length());
 
-        std::string sessionOpt = RedisConPool::GetInstance().get(ChatServiceConstant::USER_SESSION_PREFIX + uid).value();
-        auto ttlTime = RedisConPool::GetInstance().ttl(ChatServiceConstant::USER_SESSION_PREFIX + uid);
-        auto sessionJson = json::parse(sessionOpt);
+        auto batcher = RedisBatcher::GetInstance();
+        auto sessionKey = RedisConPool::UserKey(ChatServiceConstant::USER_SESSION_PREFIX, uid);
+        json sessionJson;
+        long long ttlTime = 0;
+        // degraded: Redis can't be reached, so the StatusServer checks the token
+        // and nothing about this login is written to Redis
+        bool degraded = false;
+        try {
+            auto sessionReply = batcher->Get(sessionKey);
+            auto ttlReply = batcher->Ttl(sessionKey);
+            std::string sessionOpt = sessionReply.get().value();
+            ttlTime = ttlReply.get();
+            if (!ValueCodec::GetInstance()->Decode(sessionOpt, sessionJson)) {
+                root["error"] = static_cast<int>(ErrorCodes::ERROR_JSON);
+                return;
+            }
+        }
+        catch (const sw::redis::Error& e) {
+            LOG_WARN("Redis unavailable during login of UID {}: {}, verifying token with StatusServer", uid, e.what());
+            degraded = true;
+        }
+
+        if (degraded) {
+            // The call is bounded by the StatusGrpcClient deadline and doesn't hold up the
+            // logic thread; the answer comes back on the session's executor and the login
+            // carries on as a logic thread task
+            respond = false;
+            auto serverName = ConfigManager::GetInstance().getValue("SelfServer", "name");
+            StatusGrpcClient::GetInstance()->VerifyTokenAsync(uid, token, serverName,
+                [this, session, src, uid](const status::VerifyTokenResp& reply) {
+                    PostTask([this, session, src, uid, reply]() {
+                        if (reply.error() == 0 && reply.valid()) {
+                            FinishLogin(session, src, json(), 0, true);
+                            return;
+                        }
+                        json root;
+                        if (reply.error() != 0) {
+                            LOG_ERROR("Token check for UID {} failed, StatusServer error: {}", uid, reply.error());
+                            root["error"] = static_cast<size_t>(ErrorCodes::RPC_FAILED);
+                        }
+                        else {
+                            LOG_ERROR("Token rejected by StatusServer for UID: {}", uid);
+                            root["error"] = static_cast<size_t>(ErrorCodes::TOKEN_INVALID);
+                        }
+                        std::string returnStr = root.dump(4);
+                        session->Send(returnStr, static_cast<size_t>(MessageID::MESSAGE_CHAT_LOGIN_RESPONSE));
+                        LOG_INFO("Send json is {}", returnStr);
+                    });
+                },
+                session->GetSocket().get_executor());
+            return;
+        }
 
         std::string tokenValue = sessionJson["token"].get<std::string>();
 
-		if (tokenValue.empty()) {
-			LOG_ERROR("Token not found in Redis for UID: {}", uid);
-			root["error"] = static_cast<size_t>(ErrorCodes::UID_INVALID);
-			return;
-		}
+        if (tokenValue.empty()) {
+            LOG_ERROR("Token not found in Redis for UID: {}", uid);
+            root["error"] = static_cast<size_t>(ErrorCodes::UID_INVALID);
+            return;
+        }
 
-		if (tokenValue != token) {
-			LOG_ERROR("Token mismatch for UID: {}", uid);
-			root["error"] = static_cast<size_t>(ErrorCodes::TOKEN_INVALID);
-			return;
-		}
+        if (tokenValue != token) {
+            LOG_ERROR("Token mismatch for UID: {}", uid);
+            root["error"] = static_cast<size_t>(ErrorCodes::TOKEN_INVALID);
+            return;
+        }
 
+        respond = false;
+        FinishLogin(session, src, sessionJson, ttlTime, false);
+    }
+    catch (const json::parse_error& e) {
+        LOG_WARN("Failed to parse JSON in LoginHandler: {}", e.what());
+        root["error"] = static_cast<int>(ErrorCodes::ERROR_JSON);
+    }
+}
+
+void LogicSystem::FinishLogin(std::shared_ptr<CSession> session, const json& src, json sessionJson, long long ttlTime, bool degraded)
+{
+    // declared first so it runs after the login response has been queued
+    std::string drainUid;
+    defer{
+        if (!drainUid.empty()) {
+            OfflineInbox::GetInstance()->Drain(drainUid, session);
+        }
+    };
+
+    json root;
+    defer{
+		std::string returnStr = root.dump(4);
+		session->Send(returnStr, static_cast<size_t>(MessageID::MESSAGE_CHAT_LOGIN_RESPONSE));
+        LOG_INFO("Send json is {}", returnStr);
+    };
+
+    try {
+        std::string uid = src["uid"].get<std::string>();
+        std::string token = src["token"].get<std::string>();
+
+        auto batcher = RedisBatcher::GetInstance();
+        auto serverName = ConfigManager::GetInstance().getValue("SelfServer", "name");
+        auto sessionKey = RedisConPool::UserKey(ChatServiceConstant::USER_SESSION_PREFIX, uid);
 
 		root["error"] = static_cast<size_t>(ErrorCodes::SUCCESS);
-		std::string baseKey = ChatServiceConstant::USER_INFO_PREFIX + uid;
         auto userInfo = std::make_shared<UserInfo>();
-        
-        auto baseInfoExists = GetUserInfo(baseKey, uid, userInfo);
+        auto baseInfoExists = UserInfoCache::GetInstance()->GetUserInfo(uid, userInfo);
 
 		if (!baseInfoExists) {
 			LOG_ERROR("User info not found for UID: {}", uid);
@@ -187,10 +316,16 @@ void LogicSystem::LoginHandler(std::shared_ptr<CSession> session, const size_t&
 		root["sex"] = userInfo->_sex;
         root["token"] = token;
 
+        // A client that still has its lists from the last session only needs what changed since,
+        // which the offline inbox holds as long as it is complete
+        bool incremental = src.contains("incremental") && src["incremental"].get<bool>()
+            && OfflineInbox::GetInstance()->IsComplete(uid);
+        root["incremental"] = incremental;
+
         root["apply_list"] = json::array();
         
 		auto applyList = MySQLManager::GetInstance()->GetApplyList(uid);
-        if (!applyList.empty()) {
+        if (!incremental && !applyList.empty()) {
 			for (const auto& apply : applyList) {
 				json apply_json;
 				apply_json["uid"] = apply->_uid;
@@ -210,7 +345,7 @@ void LogicSystem::LoginHandler(std::shared_ptr<CSession> session, const size_t&
         root["contact_friend_list"] = json::array();
 
         auto contactList = MySQLManager::GetInstance()->GetFriendList(uid);
-        if (!contactList.empty()) {
+        if (!incremental && !contactList.empty()) {
             for (const auto& contact : contactList) {
                 json contact_json;
                 contact_json["uid"] = contact->_user->_uid;
@@ -229,44 +364,77 @@ void LogicSystem::LoginHandler(std::shared_ptr<CSession> session, const size_t&
             }
         }
 
-		auto serverName = ConfigManager::GetInstance().getValue("SelfServer", "name");
-        auto loginTimes = sessionJson["times"].get<std::string>();
+        FriendCache::GetInstance()->Load(uid, contactList, applyList, MySQLManager::GetInstance()->GetSentApplies(uid));
 
-        if (std::stoi(loginTimes) == 0) {
-            sessionJson["times"] = "1";
+		session->SetUserUid(uid);
+		RouteCache::GetInstance()->Set(uid, serverName);
+
+        if (!degraded) {
+            try {
+                auto loginTimes = sessionJson["times"].get<std::string>();
+
+                // the writes below are queued and sent together by the first get()
+                std::vector<RedisFuture<bool>> writes;
+                std::optional<RedisFuture<long long>> loginCount;
+                if (std::stoi(loginTimes) == 0) {
+                    sessionJson["times"] = "1";
+                    loginCount = batcher->Hincrby(ChatServiceConstant::LOGIN_COUNT, serverName, 1);
+                }
+                else {
+                    sessionJson["times"] = std::to_string(std::stoi(loginTimes) + 1);
 
-            auto redisResult = RedisConPool::GetInstance().hget(ChatServiceConstant::LOGIN_COUNT, serverName).value();
-			int loginCount = 0;
+                }
+                // keep the session's own expiry; one without is given its family's TTL
+                auto codec = ValueCodec::GetInstance();
+                auto sessionTTL = ttlTime > 0 ? ttlTime : codec->TTL(ChatServiceConstant::USER_SESSION_PREFIX);
+                writes.push_back(batcher->Setex(sessionKey, sessionTTL, codec->Encode(sessionJson)));
+
+                std::string apply_list = RedisConPool::UserKey(ChatServiceConstant::FRIEND_REQUEST_PREFIX, uid) + "_apply";
+                std::string contact_list = RedisConPool::UserKey(ChatServiceConstant::FRIEND_REQUEST_PREFIX, uid) + "_contact";
+
+                if (!incremental) {
+                    auto listTTL = codec->TTL(ChatServiceConstant::FRIEND_REQUEST_PREFIX);
+                    writes.push_back(batcher->Setex(apply_list, listTTL, codec->Encode(root["apply_list"])));
+                    writes.push_back(batcher->Setex(contact_list, listTTL, codec->Encode(root["contact_friend_list"])));
+                }
+                for (auto& write : writes) {
+                    write.get();
+                }
+                RedisConPool::InvalidateCached(sessionKey);
+                if (loginCount) {
+                    loginCount->get();
+                }
+            }
+            catch (const sw::redis::Error& e) {
+                // the token is verified and the lists are built; losing the bookkeeping beats failing the login
+                LOG_WARN("Failed to record login of UID {} in Redis: {}", uid, e.what());
+            }
+        }
 
-			if (!redisResult.empty()) {
-				loginCount = std::stoi(redisResult);
-			}
+		UserManager::GetInstance()->setUserSession(uid, session);
+        // the route goes online here and offline again in CServer::clearSession
+        auto& cfg = ConfigManager::GetInstance();
+        StatusGrpcClient::GetInstance()->ReportOnlineAsync(uid, serverName, cfg["SelfServer"]["host"],
+            atoi(cfg["SelfServer"]["port"].c_str()), token, session->GetGeneration(), [uid](const status::OnlineReportResp& resp) {
+                if (resp.error() != 0) {
+                    LOG_WARN("Failed to report UID {} online, error: {}", uid, resp.error());
+                }
+            });
 
-			loginCount++;
-            RedisConPool::GetInstance().hset(ChatServiceConstant::LOGIN_COUNT, serverName, std::to_string(loginCount));
+        if (incremental) {
+            drainUid = uid;
         }
         else {
-            sessionJson["times"] = std::to_string(std::stoi(loginTimes) + 1);
-
+            // the full lists already reflect everything the inbox held
+            OfflineInbox::GetInstance()->Discard(uid);
         }
-        RedisConPool::GetInstance().setex(ChatServiceConstant::USER_SESSION_PREFIX + uid, ttlTime, sessionJson.dump());
-
-		session->SetUserUid(uid);
-
-        std::string apply_list = ChatServiceConstant::FRIEND_REQUEST_PREFIX + uid + "_apply";
-		std::string contact_list = ChatServiceConstant::FRIEND_REQUEST_PREFIX + uid + "_contact";
-
-        RedisConPool::GetInstance().set(apply_list, root["apply_list"].dump(4));
-		RedisConPool::GetInstance().set(contact_list, root["contact_friend_list"].dump(4));
-
-		UserManager::GetInstance()->setUserSession(uid, session);
 
 		LOG_INFO("Login successful for UID: {}", uid);
 
 		return;
     }
-    catch (const json::parse_error& e) {
-        LOG_WARN("Failed to parse JSON in LoginHandler: {}", e.what());
+    catch (const json::exception& e) {
+        LOG_WARN("Bad login request in FinishLogin: {}", e.what());
         root["error"] = static_cast<int>(ErrorCodes::ERROR_JSON);
     }
 }
@@ -285,31 +453,53 @@ void LogicSystem::SearchHandler(std::shared_ptr<CSession> session, const size_t&
     try {
         auto src = json::parse(messageData);
 
-        std::string uid = src["uid"].get<std::string>();
+        std::string pattern = SearchCache::Normalize(src["uid"].get<std::string>());
         std::string selfUid = src["self"].get<std::string>();
+        int page = src.contains("page") ? src["page"].get<int>() : 0;
 
-        LOG_INFO("Search attempt - UID: {}", uid);
+        LOG_INFO("Search attempt - pattern: {}, page: {}", pattern, page);
 
         root["error"] = static_cast<int>(ErrorCodes::SUCCESS);
         root["users"] = json::array();
+        root["page"] = page;
+        root["has_more"] = false;
+
+        if (pattern.empty() || page < 0) {
+            root["error"] = static_cast<int>(ErrorCodes::UID_INVALID);
+            return;
+        }
+
+        std::string searchVersion;
+        if (NegativeCache::GetInstance()->IsSearchEmpty(selfUid, pattern, searchVersion)) {
+            root["error"] = static_cast<int>(ErrorCodes::UID_INVALID);
+            return;
+        }
 
-        auto users = MySQLManager::GetInstance()->FuzzySearchUsers(selfUid, uid);
+        auto searchCache = SearchCache::GetInstance();
+        std::vector<std::shared_ptr<SearchInfo>> results;
+        if (!searchCache->Get(selfUid, pattern, results)) {
+            results = FetchSearchResults(selfUid, pattern);
+            searchCache->Put(selfUid, pattern, results);
+        }
+        auto result = searchCache->Slice(results, page);
 
-        for (const auto& user : users) {
+        auto friendCache = FriendCache::GetInstance();
+        for (const auto& user : result.users) {
             json user_json;
             user_json["uid"] = user->_uid;
             user_json["username"] = user->_username;
             user_json["avatar"] = user->_avatar;
-            user_json["add_status"] = user->_status;
+            user_json["add_status"] = friendCache->GetStatus(selfUid, user->_uid);
 
             root["users"].push_back(user_json);
-
-            std::string baseKey = ChatServiceConstant::USER_FRIEND_STATUS + user->_uid;
-            RedisConPool::GetInstance().set(baseKey, user_json.dump(4));
         }
+        root["has_more"] = result.hasMore;
 
         if (root["users"].empty()) {
             root["error"] = static_cast<int>(ErrorCodes::UID_INVALID);
+            if (page == 0) {
+                NegativeCache::GetInstance()->MarkSearchEmpty(selfUid, pattern, searchVersion);
+            }
         }
        
     }
@@ -324,7 +514,11 @@ void LogicSystem::ApplyFriendHandler(std::shared_ptr<CSession> session, const si
 	LOG_INFO("Processing Apply Friend request...");
 
 	json root;
+	bool submitted = false;
 	defer{
+		if (submitted) {
+			return;
+		}
 		std::string returnStr = root.dump(4);
 		session->Send(returnStr, static_cast<size_t>(MessageID::MESSAGE_APPLY_FRIEND_RESPONSE));
         LOG_INFO("Send json is {}", returnStr);
@@ -340,6 +534,7 @@ void LogicSystem::ApplyFriendHandler(std::shared_ptr<CSession> session, const si
         std::string comments = src["comments"].get<std::string>();
         std::string remark_other = src["remark"].get<std::string>();
         auto now_time = std::chrono::system_clock::now().time_since_epoch();
+        auto timeMs = std::chrono::duration_cast<std::chrono::milliseconds>(now_time).count();
 
 
         LOG_INFO("Friend attempt - UID: {}", from_uid);
@@ -347,65 +542,87 @@ void LogicSystem::ApplyFriendHandler(std::shared_ptr<CSession> session, const si
         root["uid"] = to_uid;
         root["error"] = static_cast<int>(ErrorCodes::SUCCESS);
         auto relation = FriendRelation(from_uid, to_uid, static_cast<int>(AddStatusCodes::NotConsent), group_other, remark_other);
-        auto success = MySQLManager::GetInstance()->AddFriend(relation,comments);
 
-        if (!success) {
-            return;
-        }
+        // The insert joins the writer's next group commit; the response and
+        // notification follow once it is durable, without holding this thread
+        submitted = true;
+        FriendApplyWriter::GetInstance()->Submit(relation, comments,
+            [this, session, root, from_uid, to_uid, comments, group_other, remark_other, timeMs](bool success) mutable {
+                if (!success) {
+                    root["error"] = static_cast<int>(ErrorCodes::RPC_FAILED);
+                }
+                std::string returnStr = root.dump(4);
+                session->Send(returnStr, static_cast<size_t>(MessageID::MESSAGE_APPLY_FRIEND_RESPONSE));
+                LOG_INFO("Send json is {}", returnStr);
 
-        std::string sessionOpt = RedisConPool::GetInstance().get(ChatServiceConstant::USER_SESSION_PREFIX + to_uid).value();
-        auto sessionJson = json::parse(sessionOpt);
+                if (success) {
+                    NotifyFriendApply(from_uid, to_uid, comments, group_other, remark_other, timeMs);
+                }
+            });
+	}
+	catch (const json::parse_error& e) {
+		LOG_WARN("Failed to parse JSON in ApplyFriendHandler: {}", e.what());
+        root["error"] = static_cast<int>(ErrorCodes::ERROR_JSON);
+	}
+}
 
-        auto to_ip_value = sessionJson["server_name"].get<std::string>();
+void LogicSystem::NotifyFriendApply(const std::string& from_uid, const std::string& to_uid, const std::string& comments,
+    const std::string& group_other, const std::string& remark_other, long long timeMs)
+{
+    FriendCache::GetInstance()->Upsert(from_uid, to_uid, static_cast<int>(AddStatusCodes::NotConsent), group_other, remark_other);
 
-        if (to_ip_value.empty()) {
-            return;
-        }
+    auto to_ip_value = RouteCache::GetInstance()->GetServer(to_uid);
 
+    auto& cfg = ConfigManager::GetInstance();
+    auto selfServer = cfg["SelfServer"]["name"];
 
-        auto& cfg = ConfigManager::GetInstance();
-        auto selfServer = cfg["SelfServer"]["name"];
+    auto userInfo = std::make_shared<UserInfo>();
+    bool userFind = UserInfoCache::GetInstance()->GetUserInfo(from_uid, userInfo);
 
-        std::string baseKey = ChatServiceConstant::USER_INFO_PREFIX + from_uid;
-        auto userInfo = std::make_shared<UserInfo>();
-        bool userFind = GetUserInfo(baseKey, from_uid, userInfo);
+    json notify;
+    notify["error"] = static_cast<int>(ErrorCodes::SUCCESS);
+    notify["comments"] = comments;
+    notify["uid"] = from_uid;
+    notify["time"] = timeMs;
 
-        if (to_ip_value == selfServer) {
-            auto session = UserManager::GetInstance()->GetSession(to_uid);
-            
-            if (session) {
-                json notify;
-                notify["error"] = static_cast<int>(ErrorCodes::SUCCESS);
-                notify["comments"] = comments;
-                notify["uid"] = from_uid;
-                notify["time"] = std::chrono::duration_cast<std::chrono::milliseconds>(now_time).count();
-                
-                if (userFind) {
-                    notify["avatar"] = userInfo->_avatar;
-                    notify["username"] = userInfo->_username;
-                }
+    if (userFind) {
+        notify["avatar"] = userInfo->_avatar;
+        notify["username"] = userInfo->_username;
+    }
 
-                session->Send(notify.dump(4), static_cast<int>(MessageID::MESSAGE_NOTIFY_ADD_FRIEND));
-            }
-            return;
+    if (to_ip_value.empty() || to_ip_value == selfServer) {
+        auto session = to_ip_value.empty() ? nullptr : UserManager::GetInstance()->GetSession(to_uid);
+        if (session) {
+            FriendCache::GetInstance()->SetStatus(to_uid, from_uid, static_cast<int>(AddStatusCodes::NotConsent));
+            session->Send(notify.dump(4), static_cast<int>(MessageID::MESSAGE_NOTIFY_ADD_FRIEND));
         }
-
-        message::FriendRequest request;
-        request.set_applicant(from_uid);
-        request.set_recipient(to_uid);
-        request.set_message(comments);
-        request.set_time(std::chrono::duration_cast<std::chrono::milliseconds>(now_time).count());
-        if (userFind) {
-            request.set_avatar(userInfo->_avatar);
-            request.set_username(userInfo->_username);
+        else {
+            OfflineInbox::GetInstance()->Append(to_uid, static_cast<int>(MessageID::MESSAGE_NOTIFY_ADD_FRIEND), notify.dump());
         }
+        return;
+    }
 
-        FriendGrpcClient::GetInstance()->SendFriend(to_ip_value,request);
-	}
-	catch (const json::parse_error& e) {
-		LOG_WARN("Failed to parse JSON in ApplyFriendHandler: {}", e.what());
-        root["error"] = static_cast<int>(ErrorCodes::ERROR_JSON);
-	}
+    message::FriendRequest request;
+    request.set_applicant(from_uid);
+    request.set_recipient(to_uid);
+    request.set_message(comments);
+    request.set_time(timeMs);
+    if (userFind) {
+        request.set_avatar(userInfo->_avatar);
+        request.set_username(userInfo->_username);
+    }
+
+    // the recipient's server never acknowledged it, so it waits for the next login instead
+    FriendGrpcClient::GetInstance()->SendFriend(to_ip_value, request,
+        [this, to_uid, to_ip_value, body = notify.dump()](const message::FriendResponse& response) {
+            if (response.error() == static_cast<int>(ErrorCodes::SUCCESS)) {
+                return;
+            }
+            LOG_WARN("Friend request for {} was not delivered to {}, keeping it offline", to_uid, to_ip_value);
+            PostTask([to_uid, body]() {
+                OfflineInbox::GetInstance()->Append(to_uid, static_cast<int>(MessageID::MESSAGE_NOTIFY_ADD_FRIEND), body);
+            });
+        });
 }
 
 void LogicSystem::ApprovalFriendHandler(std::shared_ptr<CSession> session, const size_t& messageId, const std::string& messageData)
@@ -437,12 +654,12 @@ void LogicSystem::ApprovalFriendHandler(std::shared_ptr<CSession> session, const
             return;
         }
 
+        FriendCache::GetInstance()->Upsert(from_uid, to_uid, static_cast<int>(AddStatusCodes::MutualFriend), group_other, remark_other);
+
 
         root["error"] = static_cast<int>(ErrorCodes::SUCCESS);
-        std::string baseKey = ChatServiceConstant::USER_INFO_PREFIX + to_uid;
         auto userInfo = std::make_shared<UserInfo>();
-        
-		auto baseInfoExists = GetUserInfo(baseKey, to_uid, userInfo);
+		auto baseInfoExists = UserInfoCache::GetInstance()->GetUserInfo(to_uid, userInfo);
 
         if (!baseInfoExists) {
 			LOG_ERROR("User info not found for UID: {}", to_uid);
@@ -460,34 +677,31 @@ void LogicSystem::ApprovalFriendHandler(std::shared_ptr<CSession> session, const
 		root["remark"] = remark_other;
 
 
-		auto sessionOpt = RedisConPool::GetInstance().get(ChatServiceConstant::USER_SESSION_PREFIX + to_uid).value();
-		auto sessionJson = json::parse(sessionOpt);
-
-		auto to_ip_value = sessionJson["server_name"].get<std::string>();
-
-		if (to_ip_value.empty()) {
-			return;
-		}
-
+		auto to_ip_value = RouteCache::GetInstance()->GetServer(to_uid);
         
         auto& cfg = ConfigManager::GetInstance();
         auto selfServer = cfg["SelfServer"]["name"];
 
-        if (to_ip_value == selfServer) {
-            auto session = UserManager::GetInstance()->GetSession(to_uid);
+        json notify;
+        notify["uid"] = userInfo->_uid;
+        notify["username"] = userInfo->_username;
+        notify["email"] = userInfo->_email;
+        notify["birth"] = userInfo->_birth;
+        notify["avatar"] = userInfo->_avatar;
+        notify["sex"] = userInfo->_sex;
+
+        notify["grouping"] = group_other;
+        notify["remark"] = remark_other;
+
+        if (to_ip_value.empty() || to_ip_value == selfServer) {
+            auto session = to_ip_value.empty() ? nullptr : UserManager::GetInstance()->GetSession(to_uid);
             if (session) {
-                json notify;
-                notify["uid"] = userInfo->_uid;
-                notify["username"] = userInfo->_username;
-				notify["email"] = userInfo->_email;
-				notify["birth"] = userInfo->_birth;
-                notify["avatar"] = userInfo->_avatar;
-                notify["sex"] = userInfo->_sex;
-
-                notify["grouping"] = group_other;
-				notify["remark"] = remark_other;
+                FriendCache::GetInstance()->SetStatus(to_uid, from_uid, static_cast<int>(AddStatusCodes::MutualFriend));
                 session->Send(notify.dump(4), static_cast<int>(MessageID::MESSAGE_NOTIFY_APPROVAL_FRIEND));
             }
+            else {
+                OfflineInbox::GetInstance()->Append(to_uid, static_cast<int>(MessageID::MESSAGE_NOTIFY_APPROVAL_FRIEND), notify.dump());
+            }
             return;
         }
 
@@ -497,7 +711,16 @@ void LogicSystem::ApprovalFriendHandler(std::shared_ptr<CSession> session, const
         request.set_grouping(group_other);
         request.set_remark(remark_other);
 
-		FriendGrpcClient::GetInstance()->HandleFriend(to_ip_value, request);
+		FriendGrpcClient::GetInstance()->HandleFriend(to_ip_value, request,
+            [this, to_uid, to_ip_value, body = notify.dump()](const message::FriendApprovalResponse& response) {
+                if (response.error() == static_cast<int>(ErrorCodes::SUCCESS)) {
+                    return;
+                }
+                LOG_WARN("Friend approval for {} was not delivered to {}, keeping it offline", to_uid, to_ip_value);
+                PostTask([to_uid, body]() {
+                    OfflineInbox::GetInstance()->Append(to_uid, static_cast<int>(MessageID::MESSAGE_NOTIFY_APPROVAL_FRIEND), body);
+                });
+            });
     }
     catch (const json::parse_error& e) {
         LOG_WARN("Failed to parse JSON in ApprovalFriendHandler: {}", e.what());
@@ -505,55 +728,27 @@ void LogicSystem::ApprovalFriendHandler(std::shared_ptr<CSession> session, const
 	}
 }
 
-bool LogicSystem::GetUserInfo(std::string baseKey, std::string uid, std::shared_ptr<UserInfo>& userInfo)
+std::vector<std::shared_ptr<SearchInfo>> LogicSystem::FetchSearchResults(const std::string& selfUid, const std::string& pattern)
 {
-	auto baseInfo = RedisConPool::GetInstance().get(baseKey).value();
-
-	if (!baseInfo.empty()) {
-        try {
-            auto src = json::parse(baseInfo);
-            userInfo->_uid = src["uid"].get<std::string>();
-            userInfo->_username = src["username"].get<std::string>();
-            userInfo->_password = src["password"].get<std::string>();
-            userInfo->_avatar = src["avatar"].get<std::string>();
-            userInfo->_birth = src["birth"].get<std::string>();
-            userInfo->_sex = src["sex"].get<std::string>();
-            userInfo->_email = src["email"].get<std::string>();
-
-			LOG_INFO("Retrieved user info for uid: {}", uid);
-        }
-        catch(const json::parse_error& e){
-			LOG_WARN("Failed to parse JSON in GetUserInfo: {}", e.what());
-            return false;
-        }
-        return true;
-	}
-	else {
-		LOG_ERROR("No user info found for uid: {}", uid);
-
-		std::shared_ptr<UserInfo> tmp_userInfo = nullptr;
-		tmp_userInfo = MySQLManager::GetInstance()->GetUser(uid);
-
-		if (tmp_userInfo == nullptr) {
-			LOG_ERROR("No user found in MySQL for uid: {}", uid);
-			return false;
+	std::vector<std::shared_ptr<SearchInfo>> users;
+	auto maxResults = SearchCache::GetInstance()->GetMaxResults();
+
+	// UserServer answers from its in-memory index; MySQL is only the fallback when it is unreachable
+	auto resp = UserGrpcClient::GetInstance()->FuzzySearchUser(selfUid, pattern);
+	if (resp.error() == static_cast<int>(ErrorCodes::SUCCESS)) {
+		for (const auto& hit : resp.results()) {
+			if (users.size() >= maxResults) {
+				break;
+			}
+			users.push_back(std::make_shared<SearchInfo>(hit.uid(), hit.username(), hit.avatar(), static_cast<int>(AddStatusCodes::NotFriend)));
 		}
-
-		userInfo = tmp_userInfo;
-
-        json root;
-        root["uid"] = userInfo->_uid;
-        root["username"] = userInfo->_username;
-        root["email"] = userInfo->_email;
-        root["password"] = userInfo->_password;
-        root["birth"] = userInfo->_birth;
-        root["avatar"] = userInfo->_avatar;
-        root["sex"] = userInfo->_sex;
-
-        std::string redisString = root.dump(4);
-		RedisConPool::GetInstance().set(baseKey, redisString);
-		LOG_INFO("Cached user info for uid: {}", uid);
+		return users;
 	}
 
-	return true;
+	LOG_WARN("Search index unavailable, falling back to MySQL for pattern: {}", pattern);
+	users = MySQLManager::GetInstance()->FuzzySearchUsers(selfUid, pattern);
+	if (users.size() > maxResults) {
+		users.resize(maxResults);
+	}
+	return users;
 }
@@ -12,6 +12,7 @@
 #include <queue>
 #include <thread>
 #include <unordered_map>
+#include <vector>
 
 #include <nlohmann/json.hpp>
 using json = nlohmann::json;
@@ -24,25 +25,36 @@ class LogicSystem:public Singleton<LogicSystem>
 public:
 	~LogicSystem();
 	void PostMessageToQueue(std::shared_ptr<LogicNode> message);
+	// run task on the logic thread, ahead of queued messages; how async calls made by
+	// a handler get back to it
+	void PostTask(std::function<void()> task);
+	// messages waiting for the logic thread
+	std::size_t QueueDepth();
 
 private:
 	LogicSystem();
 	void DealMessage();
 	void RegisterCallBack();
 	void LoginHandler(std::shared_ptr<CSession> session, const size_t& messageId, const std::string& messageData);
+	// the part of a login after its token is accepted; sends the login response
+	void FinishLogin(std::shared_ptr<CSession> session, const json& src, json sessionJson, long long ttlTime, bool degraded);
 	void SearchHandler(std::shared_ptr<CSession> session, const size_t& messageId, const std::string& messageData);
 	void ApplyFriendHandler(std::shared_ptr<CSession> session, const size_t& messageId, const std::string& messageData);
 	void ApprovalFriendHandler(std::shared_ptr<CSession> session, const size_t& messageId, const std::string& messageData);
 
-	bool GetUserInfo(std::string baseKey, std::string uid, std::shared_ptr<UserInfo>& userInfo);
-	
+	// runs on an IO context thread once the application is committed
+	void NotifyFriendApply(const std::string& from_uid, const std::string& to_uid, const std::string& comments,
+		const std::string& group_other, const std::string& remark_other, long long timeMs);
+
+	std::vector<std::shared_ptr<SearchInfo>> FetchSearchResults(const std::string& selfUid, const std::string& pattern);
+
 private:
 	std::thread _thread;
 	std::mutex _mutex;
 	std::condition_variable _consume;
 	std::atomic<bool> _b_stop;
 	std::queue < std::shared_ptr<LogicNode>> _messageQueue;
+	std::queue<std::function<void()>> _tasks;
 
 	std::map<size_t, FunCallBack> _funcCallBack;
-	std::unordered_map < std::string, std::shared_ptr<UserInfo> > _users;
 };
\ No newline at end of file
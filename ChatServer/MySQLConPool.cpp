@@ -2,111 +2,292 @@
 #include "ConfigManager.h"
 #include "Logger.h"
 
+#include <algorithm>
+#include <sstream>
+#include <vector>
+
 MySQLConPool& MySQLConPool::GetInstance()
 {
-	static MySQLConPool instance;
+	static MySQLConPool instance("MySQL");
 	return instance;
 }
 
 std::unique_ptr<mysqlx::Session> MySQLConPool::GetConnection()
 {
+	auto start = Clock::now();
+	auto deadline = start + _acquireTimeout;
+
 	std::unique_lock<std::mutex> lock(_mutex);
-    LOG_DEBUG("Waiting for available connection, current pool size: {}", _pool.size());
+	while (!_b_stop) {
+		if (!_idle.empty()) {
+			auto idle = std::move(_idle.back());
+			_idle.pop_back();
 
-	_condition.wait(
-		lock, 
-		[this]() {
-			if (_b_stop) {
-				return true;
+			bool check = idle.suspect || Clock::now() - idle.since >= _validateAfter;
+			if (!check) {
+				RecordWait(Clock::now() - start);
+				return std::move(idle.session);
+			}
+
+			lock.unlock();
+			bool alive = Validate(*idle.session);
+			if (!alive) {
+				idle.session.reset();
 			}
-			return !_pool.empty();
+			lock.lock();
+
+			if (alive) {
+				RecordWait(Clock::now() - start);
+				return std::move(idle.session);
+			}
+			--_total;
+			++_stats.closed;
+			++_stats.validationFailures;
+			LOG_WARN("Dropped dead MySQL connection, pool size: {}", _total);
+			continue;
+		}
+
+		if (_total < _maxSize) {
+			// reserve the slot before connecting so concurrent borrowers don't overshoot
+			++_total;
+			lock.unlock();
+			auto conn = CreateConnection();
+			lock.lock();
+
+			if (conn) {
+				++_stats.created;
+				LOG_DEBUG("Grew MySQL pool to {} connections", _total);
+				RecordWait(Clock::now() - start);
+				return conn;
+			}
+			--_total;
+			_condition.notify_one();
+		}
+
+		++_waiting;
+		auto status = _condition.wait_until(lock, deadline);
+		--_waiting;
+		if (status == std::cv_status::timeout && _idle.empty()) {
+			++_stats.timeouts;
+			LOG_ERROR("Timed out after {}ms waiting for a MySQL connection, pool size: {}/{}",
+				_acquireTimeout.count(), _total, _maxSize);
+			return nullptr;
 		}
-	);
-	if (_b_stop) {
-        LOG_WARN("Connection pool is stopping, returning nullptr");
-		return nullptr;
 	}
-	std::unique_ptr<mysqlx::Session> con(std::move(_pool.front()));
-	_pool.pop();
-    LOG_DEBUG("Connection acquired, remaining connections: {}", _pool.size());
-	return con;
+
+	LOG_WARN("Connection pool is stopping, returning nullptr");
+	return nullptr;
 }
 
 void MySQLConPool::ReleaseConnection(std::unique_ptr<mysqlx::Session> con)
 {
 	if (!con) {
-        LOG_WARN("Attempting to release null connection");
 		return;
 	}
 
 	std::unique_lock<std::mutex> lock(_mutex);
+	bool suspect = _suspects.erase(con.get()) > 0;
 	if (_b_stop) {
-        LOG_INFO("Pool is stopping, released connection will be destroyed");
+		--_total;
 		return;
 	}
-	_pool.push(std::move(con));
-    LOG_DEBUG("Connection released back to pool, current size: {}", _pool.size());
+	_idle.push_back(Idle{ std::move(con), Clock::now(), suspect });
 	_condition.notify_one();
 }
 
+void MySQLConPool::MarkSuspect(const mysqlx::Session* session)
+{
+	if (session == nullptr) {
+		return;
+	}
+	std::lock_guard<std::mutex> lock(_mutex);
+	_suspects.insert(session);
+}
+
+MySQLConPool::Stats MySQLConPool::GetStats()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	auto stats = _stats;
+	stats.total = _total;
+	stats.idle = _idle.size();
+	stats.waiting = _waiting;
+	return stats;
+}
+
 MySQLConPool::~MySQLConPool()
 {
-    LOG_INFO("Destroying connection pool");
-	std::unique_lock<std::mutex> lock(_mutex);
-	while (!_pool.empty()) {
-		_pool.pop();
+	LOG_INFO("Destroying connection pool");
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_b_stop = true;
 	}
-    LOG_INFO("All connections cleared");
+	_condition.notify_all();
+	if (_maintainer.joinable()) {
+		_maintainer.join();
+	}
+
+	std::lock_guard<std::mutex> lock(_mutex);
+	_idle.clear();
+	LOG_INFO("All connections cleared");
 }
 
-MySQLConPool::MySQLConPool():
-	_b_stop(false),_poolSize(std::thread::hardware_concurrency())
+MySQLConPool::MySQLConPool(const std::string& section) :
+	_section(section), _port(0), _total(0), _waiting(0), _b_stop(false)
 {
-    try {
-        auto& configManager = ConfigManager::GetInstance();
-        _host = configManager["MySQL"]["host"];
-        _port = std::stoi(configManager["MySQL"]["port"]);
-        _user = configManager["MySQL"]["user"];
-        _password = configManager["MySQL"]["password"];
-        _schema = configManager["MySQL"]["schema"];
-
-        LOG_INFO("Initializing pool with {} connections", _poolSize);
-        LOG_DEBUG("Connection parameters - Host: {}, Port: {}, Schema: {}, User: {}",
-            _host, _port, _schema, _user);
-
-        for (std::size_t i = 0; i < _poolSize; ++i) {
-            auto conn = CreateConnection();
-            if (conn) {
-                _pool.push(std::move(conn));
-                LOG_DEBUG("Created connection {}/{}", i + 1, _poolSize);
-            }
-            else {
-                LOG_ERROR("Failed to create connection {}/{}", i + 1, _poolSize);
-            }
-        }
-
-        LOG_INFO("Pool initialization completed, active connections: {}", _pool.size());
-    }
-    catch (const mysqlx::Error& error) {
-        LOG_CRITICAL("Pool initialization failed: {}", error.what());
-        throw;
-    }
+	try {
+		_host = Setting("host");
+		_port = std::stoi(Setting("port"));
+		_user = Setting("user");
+		_password = Setting("password");
+		_schema = Setting("schema");
+
+		int cores = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+		_minSize = static_cast<std::size_t>(std::max(0, IntSetting("MinPoolSize", 2)));
+		_maxSize = static_cast<std::size_t>(std::max(1, IntSetting("MaxPoolSize", cores * 2)));
+		_minSize = std::min(_minSize, _maxSize);
+		_acquireTimeout = std::chrono::milliseconds(IntSetting("AcquireTimeoutMs", 3000));
+		_validateAfter = std::chrono::milliseconds(IntSetting("ValidateAfterMs", 30000));
+		_idleTimeout = std::chrono::seconds(IntSetting("IdleTimeoutSec", 300));
+		_maintainInterval = std::chrono::seconds(std::max(1, IntSetting("MaintainSec", 30)));
+
+		LOG_INFO("Initializing pool [{}] - min: {}, max: {}, acquire timeout: {}ms",
+			_section, _minSize, _maxSize, _acquireTimeout.count());
+		LOG_DEBUG("Connection parameters - Host: {}, Port: {}, Schema: {}, User: {}",
+			_host, _port, _schema, _user);
+
+		for (std::size_t i = 0; i < _minSize; ++i) {
+			auto conn = CreateConnection();
+			if (!conn) {
+				// the maintainer keeps retrying up to MinPoolSize
+				LOG_ERROR("Failed to create connection {}/{}", i + 1, _minSize);
+				continue;
+			}
+			_idle.push_back(Idle{ std::move(conn), Clock::now(), false });
+			++_total;
+			++_stats.created;
+		}
+
+		LOG_INFO("Pool initialization completed, active connections: {}", _total);
+		_maintainer = std::thread(&MySQLConPool::Maintain, this);
+	}
+	catch (const mysqlx::Error& error) {
+		LOG_CRITICAL("Pool initialization failed: {}", error.what());
+		throw;
+	}
 }
 
 std::unique_ptr<mysqlx::Session> MySQLConPool::CreateConnection()
 {
-    try {
-        std::string connStr = "mysqlx://" + _user + ":" + _password +
-            "@" + _host + ":" + std::to_string(_port) +
-            "/" + _schema;
-        LOG_DEBUG("Attempting to create new connection");
-
-        auto session = std::make_unique<mysqlx::Session>(connStr);
-        LOG_DEBUG("Successfully created new connection");
-        return session;
-    }
-    catch (const mysqlx::Error& error) {
-        LOG_ERROR("Failed to create connection: {}", error.what());
-        return nullptr;
-    }
-} 
\ No newline at end of file
+	try {
+		std::string connStr = "mysqlx://" + _user + ":" + _password +
+			"@" + _host + ":" + std::to_string(_port) +
+			"/" + _schema;
+		LOG_DEBUG("Attempting to create new connection");
+
+		auto session = std::make_unique<mysqlx::Session>(connStr);
+		LOG_DEBUG("Successfully created new connection");
+		return session;
+	}
+	catch (const mysqlx::Error& error) {
+		LOG_ERROR("Failed to create connection: {}", error.what());
+		return nullptr;
+	}
+}
+
+bool MySQLConPool::Validate(mysqlx::Session& session)
+{
+	try {
+		session.sql("SELECT 1").execute();
+		return true;
+	}
+	catch (const mysqlx::Error& error) {
+		LOG_WARN("MySQL connection failed validation: {}", error.what());
+		return false;
+	}
+}
+
+std::string MySQLConPool::Setting(const std::string& key)
+{
+	auto& configManager = ConfigManager::GetInstance();
+	auto value = configManager[_section][key];
+	return value.empty() ? configManager["MySQL"][key] : value;
+}
+
+int MySQLConPool::IntSetting(const std::string& key, int defaultValue)
+{
+	auto& configManager = ConfigManager::GetInstance();
+	return configManager.getIntValue(_section, key, configManager.getIntValue("MySQL", key, defaultValue));
+}
+
+void MySQLConPool::RecordWait(Clock::duration waited)
+{
+	auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(waited).count();
+	auto bucket = std::lower_bound(WAIT_BUCKETS_MS.begin(), WAIT_BUCKETS_MS.end(), ms) - WAIT_BUCKETS_MS.begin();
+	++_stats.waits[bucket];
+}
+
+void MySQLConPool::Maintain()
+{
+	while (true) {
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+			_condition.wait_for(lock, _maintainInterval, [this]() { return _b_stop.load(); });
+			if (_b_stop) {
+				return;
+			}
+		}
+
+		// Shrink: close the longest-idle sessions above MinPoolSize
+		std::vector<std::unique_ptr<mysqlx::Session>> expired;
+		std::size_t missing = 0;
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			auto now = Clock::now();
+			while (!_idle.empty() && _total > _minSize && now - _idle.front().since > _idleTimeout) {
+				expired.push_back(std::move(_idle.front().session));
+				_idle.pop_front();
+				--_total;
+				++_stats.closed;
+			}
+			missing = _total < _minSize ? _minSize - _total : 0;
+			_total += missing;
+		}
+		if (!expired.empty()) {
+			LOG_INFO("Closed {} idle MySQL connections", expired.size());
+		}
+		expired.clear();
+
+		// Top up after failed connects or dropped sessions
+		for (std::size_t i = 0; i < missing; ++i) {
+			auto conn = CreateConnection();
+			std::lock_guard<std::mutex> lock(_mutex);
+			if (!conn) {
+				--_total;
+				continue;
+			}
+			++_stats.created;
+			_idle.push_back(Idle{ std::move(conn), Clock::now(), false });
+			_condition.notify_one();
+		}
+
+		LogStats();
+	}
+}
+
+void MySQLConPool::LogStats()
+{
+	auto stats = GetStats();
+
+	std::ostringstream waits;
+	for (std::size_t i = 0; i < stats.waits.size(); ++i) {
+		if (i < WAIT_BUCKETS_MS.size()) {
+			waits << "<=" << WAIT_BUCKETS_MS[i] << "ms:" << stats.waits[i] << " ";
+		}
+		else {
+			waits << ">" << WAIT_BUCKETS_MS.back() << "ms:" << stats.waits[i];
+		}
+	}
+
+	LOG_INFO("MySQL pool [{}] - total: {}, idle: {}, waiting: {}, created: {}, closed: {}, validation failures: {}, timeouts: {}, acquire wait: {}",
+		_section, stats.total, stats.idle, stats.waiting, stats.created, stats.closed, stats.validationFailures, stats.timeouts, waits.str());
+}
@@ -1,36 +1,105 @@
 #pragma once  
+#include <array>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>  
+#include <deque>
 #include <memory>  
 #include <mutex>  
 #include <mysqlx/xdevapi.h>
-#include <queue>  
 #include <string>  
+#include <thread>
+#include <unordered_set>
 
+/**
+ * @class MySQLConPool
+ * @brief Elastic pool of X DevAPI sessions.
+ *
+ * Starts with MinPoolSize sessions and grows up to MaxPoolSize when borrowers
+ * would otherwise wait; sessions idle longer than IdleTimeoutSec are closed
+ * down to MinPoolSize again. Sessions that sat idle past ValidateAfterMs, or
+ * that a DAO saw fail, are pinged before being handed out and replaced if
+ * dead. GetConnection gives up after AcquireTimeoutMs and returns nullptr.
+ *
+ * GetInstance() is the primary from [MySQL]; read replicas get their own
+ * instance from their config section, with missing keys taken from [MySQL].
+ */
 class MySQLConPool
 {
 public:
+	// Upper bounds (ms) of the acquire wait histogram; the last bucket is open
+	static constexpr std::array<long long, 8> WAIT_BUCKETS_MS = { 0, 1, 5, 10, 50, 100, 500, 1000 };
+
+	struct Stats {
+		std::size_t total = 0;
+		std::size_t idle = 0;
+		std::size_t waiting = 0;
+		uint64_t created = 0;
+		uint64_t closed = 0;
+		uint64_t validationFailures = 0;
+		uint64_t timeouts = 0;
+		std::array<uint64_t, WAIT_BUCKETS_MS.size() + 1> waits{};
+	};
+
 	static MySQLConPool& GetInstance();
+
+	explicit MySQLConPool(const std::string& section);
 	std::unique_ptr<mysqlx::Session> GetConnection();
 	void ReleaseConnection(std::unique_ptr<mysqlx::Session>);
+
+	/**
+	 * @brief Have the session checked before it is handed out again, e.g. after a MySQL error
+	 *
+	 * @param session still borrowed
+	 */
+	void MarkSuspect(const mysqlx::Session* session);
+
+	Stats GetStats();
 	~MySQLConPool();
 
 private:
-	MySQLConPool();
+	using Clock = std::chrono::steady_clock;
+
+	struct Idle {
+		std::unique_ptr<mysqlx::Session> session;
+		Clock::time_point since;
+		bool suspect;
+	};
+
 	MySQLConPool(const MySQLConPool&) = delete;
 	MySQLConPool& operator=(const MySQLConPool&) = delete;
 
 	std::unique_ptr<mysqlx::Session> CreateConnection();
+	bool Validate(mysqlx::Session& session);
+	std::string Setting(const std::string& key);
+	int IntSetting(const std::string& key, int defaultValue);
+	void RecordWait(Clock::duration waited);
+	void Maintain();
+	void LogStats();
 
+	std::string _section;
 	std::string _host;
 	std::size_t _port;
 	std::string _user;
 	std::string _password;
 	std::string _schema;
-	std::size_t _poolSize;
 
-	std::queue < std::unique_ptr<mysqlx::Session> > _pool;
+	std::size_t _minSize;
+	std::size_t _maxSize;
+	std::chrono::milliseconds _acquireTimeout;
+	std::chrono::milliseconds _validateAfter;
+	std::chrono::seconds _idleTimeout;
+	std::chrono::seconds _maintainInterval;
+
+	// most recently released at the back, so the front ages out first
+	std::deque<Idle> _idle;
+	std::unordered_set<const mysqlx::Session*> _suspects;
+	std::size_t _total;
+	std::size_t _waiting;
+	Stats _stats;
+
 	std::mutex _mutex;
 	std::condition_variable _condition;
 	std::atomic<bool> _b_stop;
+	std::thread _maintainer;
 };
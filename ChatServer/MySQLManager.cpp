@@ -3,11 +3,14 @@
 #include <boost/uuid/uuid_io.hpp>
 #include <random>
 #include "Logger.h"
+#include "ShardMirror.h"
+#include <iterator>
+#include <unordered_map>
 
 bool MySQLManager::RegisterUser(UserInfo& user)
 {
     LOG_INFO("Processing user registration request - Email: {}", user._email);
-	auto verify = _userDAO.VerifyUser(user._email, user._password, user._uid);
+	auto verify = VerifyOnAnyShard(user._email, user._password, user._uid);
 	if (verify) {
         LOG_WARN("Registration failed - User already exists - Email: {}", user._email);
 		return false;
@@ -44,7 +47,8 @@ bool MySQLManager::RegisterUser(UserInfo& user)
 	}
 
     try {
-        _userDAO.Insert(user);
+        UserDAO(ShardMap::GetInstance()->Primary(user._uid)).Insert(user);
+        ShardMap::GetInstance()->Router(user._uid).NoteWrite(user._uid);
         LOG_INFO("User registration successful - Email: {}, UID: {}", user._email, user._uid);
         return true;
     }
@@ -56,10 +60,33 @@ bool MySQLManager::RegisterUser(UserInfo& user)
 
 bool MySQLManager::ResetPassword(UserInfo& user)
 {
-    LOG_INFO("Processing password reset request - UID: {}", user._uid);
+    LOG_INFO("Processing password reset request - Email: {}, UID: {}", user._email, user._uid);
 
     try {
-        bool result = _userDAO.Update(user);
+        // the uid picks the shard; when an email is given it is the verified one and decides the user
+        if (!user._email.empty()) {
+            std::string uid;
+            if (!FindUidOnAnyShard(user._email, uid) || (!user._uid.empty() && user._uid != uid)) {
+                LOG_WARN("Password reset failed - User not found - Email: {}, UID: {}", user._email, user._uid);
+                return false;
+            }
+            user._uid = uid;
+        }
+        if (user._uid.empty()) {
+            LOG_WARN("Password reset failed - Neither email nor UID given");
+            return false;
+        }
+
+        auto shards = ShardMap::GetInstance();
+        UserDAO dao(shards->Primary(user._uid));
+        // Update writes the whole row, so keep the rest of the stored profile
+        auto stored = dao.Search(user._uid);
+        bool result = false;
+        if (stored != nullptr) {
+            stored->_password = user._password;
+            result = dao.Update(*stored);
+        }
+        shards->Router(user._uid).NoteWrite(user._uid);
         if (result) {
             LOG_INFO("Password reset successful - UID: {}", user._uid);
         }
@@ -78,7 +105,7 @@ bool MySQLManager::UserLogin(UserInfo& user)
 {
     if (!user._email.empty()) {
         LOG_DEBUG("Attempting login with email: {}", user._email);
-        auto verify = _userDAO.VerifyUser(user._email, user._password, user._uid);
+        auto verify = VerifyOnAnyShard(user._email, user._password, user._uid);
         if (verify) {
             LOG_INFO("Login successful - Email: {}", user._email);
         }
@@ -90,7 +117,7 @@ bool MySQLManager::UserLogin(UserInfo& user)
 
     if (!user._uid.empty()) {
         LOG_DEBUG("Attempting login with UID: {}", user._uid);
-        auto sqlUser = _userDAO.Search(user._uid);
+        auto sqlUser = UserDAO(ShardMap::GetInstance()->Primary(user._uid)).Search(user._uid);
         if (sqlUser == nullptr) {
             LOG_WARN("Login failed - User not found - UID: {}", user._uid);
             return false;
@@ -111,7 +138,7 @@ std::unique_ptr<UserInfo> MySQLManager::GetUser(const std::string& uid)
 {
     LOG_DEBUG("Fetching user info - UID: {}", uid);
 
-    auto user = _userDAO.Search(uid);
+    auto user = UserDAO(ShardMap::GetInstance()->Router(uid).ForRead(uid)).Search(uid);
     if (user) {
         LOG_DEBUG("User info found - UID: {}, Email: {}", uid, user->_email);
     }
@@ -121,15 +148,43 @@ std::unique_ptr<UserInfo> MySQLManager::GetUser(const std::string& uid)
     return user;
 }
 
+std::vector<std::unique_ptr<UserInfo>> MySQLManager::GetUsers(const std::vector<std::string>& uids)
+{
+    LOG_DEBUG("Fetching user info in batch - count: {}", uids.size());
+    auto shards = ShardMap::GetInstance();
+    std::vector<std::unique_ptr<UserInfo>> users;
+    for (auto& [shard, part] : shards->Partition(uids)) {
+        auto found = UserDAO(shards->Router(shard).ForRead(part)).SearchBatch(part);
+        std::move(found.begin(), found.end(), std::back_inserter(users));
+    }
+    return users;
+}
+
 std::vector <std::shared_ptr<SearchInfo>> MySQLManager::FuzzySearchUsers(const std::string& uid, const std::string& pattern)
 {
-    return _friendDAO.Search(uid, pattern);
+    // every shard holds the relations of its own users with uid, so each can annotate its matches
+    auto shards = ShardMap::GetInstance();
+    std::vector<std::shared_ptr<SearchInfo>> results;
+    for (std::size_t shard = 0; shard < shards->Count(); ++shard) {
+        auto found = FriendDAO(shards->Router(shard).ForRead(uid)).Search(uid, pattern);
+        std::move(found.begin(), found.end(), std::back_inserter(results));
+    }
+    return results;
 }
 
 bool MySQLManager::AddFriend(FriendRelation& relation, const std::string& comments)
 {
     try {
-        auto result = _friendDAO.InsertApply(relation,comments);
+        auto shards = ShardMap::GetInstance();
+        auto result = FriendDAO(shards->Primary(relation._a_uid)).InsertApply(relation, comments);
+        shards->Router(relation._a_uid).NoteWrite(relation._a_uid);
+        if (result) {
+            MirrorFriendWrite(relation, "apply",
+                [relation, comments](FriendDAO& dao) {
+                    return dao.InsertApply(relation, comments);
+                }
+            );
+        }
         return result;
     }
     catch (const std::exception& e) {
@@ -138,10 +193,62 @@ bool MySQLManager::AddFriend(FriendRelation& relation, const std::string& commen
     }
 }
 
+std::vector<bool> MySQLManager::AddFriends(const std::vector<std::pair<FriendRelation, std::string>>& applies)
+{
+    try {
+        auto shards = ShardMap::GetInstance();
+        std::vector<bool> results(applies.size(), false);
+
+        // one batch per applicant shard, keeping track of where each row came from
+        std::unordered_map<std::size_t, std::vector<std::size_t>> byShard;
+        for (std::size_t i = 0; i < applies.size(); ++i) {
+            byShard[shards->ShardOf(applies[i].first._a_uid)].push_back(i);
+        }
+        for (const auto& [shard, indexes] : byShard) {
+            std::vector<std::pair<FriendRelation, std::string>> batch;
+            batch.reserve(indexes.size());
+            for (auto i : indexes) {
+                batch.push_back(applies[i]);
+            }
+            auto batchResults = FriendDAO(shards->Primary(shard)).InsertApplyBatch(batch);
+            for (std::size_t j = 0; j < indexes.size(); ++j) {
+                results[indexes[j]] = batchResults[j];
+            }
+        }
+
+        for (std::size_t i = 0; i < applies.size(); ++i) {
+            const auto& [relation, comments] = applies[i];
+            shards->Router(relation._a_uid).NoteWrite(relation._a_uid);
+            if (results[i]) {
+                MirrorFriendWrite(relation, "apply",
+                    [relation = relation, comments = comments](FriendDAO& dao) {
+                        return dao.InsertApply(relation, comments);
+                    }
+                );
+            }
+        }
+        return results;
+    }
+    catch (const std::exception& e) {
+        LOG_ERROR("AddFriends Exception: {} (rows={})", e.what(), applies.size());
+        return std::vector<bool>(applies.size(), false);
+    }
+}
+
 bool MySQLManager::UpdateFriendStatus(FriendRelation& relation)
 {
     try {
-		auto result = _friendDAO.Update(relation);
+        // step 1 on the approver's shard, step 2 on the applicant's
+        auto shards = ShardMap::GetInstance();
+        auto result = FriendDAO(shards->Primary(relation._a_uid)).Update(relation);
+        shards->Router(relation._a_uid).NoteWrite(relation._a_uid);
+        if (result) {
+            MirrorFriendWrite(relation, "approval",
+                [relation](FriendDAO& dao) {
+                    return dao.Update(relation);
+                }
+            );
+        }
         return result;
     }
     catch (const std::exception& e) {
@@ -152,10 +259,111 @@ bool MySQLManager::UpdateFriendStatus(FriendRelation& relation)
 
 std::vector<std::shared_ptr<FriendListInfo>> MySQLManager::GetApplyList(const std::string& uid)
 {
-	return _friendDAO.GetApplyList(uid);
+    auto shards = ShardMap::GetInstance();
+    FriendDAO dao(shards->Router(uid).ForRead(uid));
+    if (shards->Count() == 1) {
+        return dao.GetApplyList(uid);
+    }
+
+    // applicants may live on other shards: read the edges here, the profiles from their owners
+    auto applies = dao.GetApplyEdges(uid);
+    std::vector<std::string> uids;
+    uids.reserve(applies.size());
+    for (const auto& apply : applies) {
+        uids.push_back(apply->_uid);
+    }
+
+    std::unordered_map<std::string, std::unique_ptr<UserInfo>> users;
+    for (auto& user : GetUsers(uids)) {
+        users.emplace(user->_uid, std::move(user));
+    }
+    for (auto& apply : applies) {
+        auto iter = users.find(apply->_uid);
+        if (iter == users.end()) {
+            LOG_WARN("Applicant profile not found - UID: {}, applicant: {}", uid, apply->_uid);
+            continue;
+        }
+        apply->_username = iter->second->_username;
+        apply->_avatar = iter->second->_avatar;
+    }
+    return applies;
 }
 
 std::vector<std::shared_ptr<FriendInfo>> MySQLManager::GetFriendList(const std::string& uid)
 {
-    return _friendDAO.GetUserFriends(uid);
+    auto shards = ShardMap::GetInstance();
+    FriendDAO dao(shards->Router(uid).ForRead(uid));
+    if (shards->Count() == 1) {
+        return dao.GetUserFriends(uid);
+    }
+
+    auto friends = dao.GetUserFriendEdges(uid);
+    std::vector<std::string> uids;
+    uids.reserve(friends.size());
+    for (const auto& info : friends) {
+        uids.push_back(info->_user->_uid);
+    }
+
+    std::unordered_map<std::string, std::unique_ptr<UserInfo>> users;
+    for (auto& user : GetUsers(uids)) {
+        users.emplace(user->_uid, std::move(user));
+    }
+    for (auto& info : friends) {
+        auto iter = users.find(info->_user->_uid);
+        if (iter == users.end()) {
+            LOG_WARN("Friend profile not found - UID: {}, friend: {}", uid, info->_user->_uid);
+            continue;
+        }
+        info->_user = std::make_shared<UserInfo>(std::move(*iter->second));
+    }
+    return friends;
+}
+
+std::vector<std::shared_ptr<FriendInfo>> MySQLManager::GetSentApplies(const std::string& uid)
+{
+    // the applicant's side of a relation is written on the applicant's shard first
+    auto shards = ShardMap::GetInstance();
+    return FriendDAO(shards->Router(uid).ForRead(uid)).GetSentApplyEdges(uid);
+}
+
+bool MySQLManager::VerifyOnAnyShard(const std::string& email, const std::string& password, std::string& uid)
+{
+    auto shards = ShardMap::GetInstance();
+    for (std::size_t shard = 0; shard < shards->Count(); ++shard) {
+        if (UserDAO(shards->Primary(shard)).VerifyUser(email, password, uid)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool MySQLManager::FindUidOnAnyShard(const std::string& email, std::string& uid)
+{
+    auto shards = ShardMap::GetInstance();
+    for (std::size_t shard = 0; shard < shards->Count(); ++shard) {
+        if (UserDAO(shards->Primary(shard)).FindUid(email, uid)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void MySQLManager::MirrorFriendWrite(const FriendRelation& relation, const std::string& what,
+    const std::function<bool(FriendDAO&)>& write)
+{
+    auto shards = ShardMap::GetInstance();
+    auto shard = shards->ShardOf(relation._b_uid);
+    shards->Router(shard).NoteWrite(relation._b_uid);
+    if (shard == shards->ShardOf(relation._a_uid)) {
+        return;
+    }
+
+    auto step = [shard, write]() {
+        FriendDAO dao(ShardMap::GetInstance()->Primary(shard));
+        return write(dao);
+    };
+    if (!step()) {
+        ShardMirror::GetInstance()->Retry(
+            what + " " + relation._a_uid + " -> " + relation._b_uid + " on shard " + std::to_string(shard), step);
+    }
 }
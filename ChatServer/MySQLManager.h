@@ -2,7 +2,10 @@
 #include "Singleton.h"
 #include "UserDAO.h"
 #include "FriendDAO.h"
+#include "ShardMap.h"
+#include <functional>
 
+// Writes and logins use the owning shard's primary; reads go through its ReplicaRouter
 class MySQLManager :public Singleton<MySQLManager>
 {
 	friend class Singleton<MySQLManager>;
@@ -13,17 +16,37 @@ public:
 	bool ResetPassword(UserInfo& user);
 	bool UserLogin(UserInfo& user);
 	std::unique_ptr<UserInfo> GetUser(const std::string& uid);
+	std::vector<std::unique_ptr<UserInfo>> GetUsers(const std::vector<std::string>& uids);
 	std::vector<std::shared_ptr<SearchInfo>> FuzzySearchUsers(const std::string& uid,const std::string& pattern);
 
+	/*
+	 * Friend relations are stored on both endpoints' shards, written in two steps:
+	 *  1. the shard of relation._a_uid (the user acting) is written first and
+	 *     decides the result returned to the caller;
+	 *  2. if relation._b_uid lives on another shard, the same call is mirrored
+	 *     there. A failed mirror does not fail the request; it is handed to
+	 *     ShardMirror and retried until applied.
+	 * Both steps run the same procedure with the same arguments; the procedures
+	 * upsert, so a retried step converges instead of failing on the first copy.
+	 * Until step 2 lands, b's own lists may lag behind a's.
+	 */
 	bool AddFriend(FriendRelation& relation,const std::string& comments);
+	std::vector<bool> AddFriends(const std::vector<std::pair<FriendRelation, std::string>>& applies);
 	bool UpdateFriendStatus(FriendRelation& relation);
 
 	std::vector<std::shared_ptr<FriendListInfo>> GetApplyList(const std::string& uid);
 	std::vector<std::shared_ptr<FriendInfo>> GetFriendList(const std::string& uid);
+	// uid's pending applications to others; only uids, groups and remarks, no profiles
+	std::vector<std::shared_ptr<FriendInfo>> GetSentApplies(const std::string& uid);
 private:
 	MySQLManager() = default;
 
-	UserDAO _userDAO;
-	FriendDAO _friendDAO;
+	// the email is not a shard key, so every shard is asked in turn
+	bool VerifyOnAnyShard(const std::string& email, const std::string& password, std::string& uid);
+	bool FindUidOnAnyShard(const std::string& email, std::string& uid);
+
+	// step 2 of a friend write: apply write on b's shard when it differs from a's
+	void MirrorFriendWrite(const FriendRelation& relation, const std::string& what,
+		const std::function<bool(FriendDAO&)>& write);
 };
 
@@ -0,0 +1,146 @@
+#include "NegativeCache.h"
+#include "ConfigManager.h"
+#include "RedisConPool.h"
+#include "MySQLManager.h"
+#include "Logger.h"
+#include "const.h"
+
+#include <chrono>
+
+namespace {
+	constexpr uint64_t STATS_REPORT_INTERVAL = 1000;
+}
+
+bool NegativeCache::IsUserAbsent(const std::string& uid, const std::string& cachedValue)
+{
+	if (cachedValue != ChatServiceConstant::USER_TOMBSTONE) {
+		return false;
+	}
+
+	auto hits = ++_userHits;
+	if (hits % STATS_REPORT_INTERVAL == 0) {
+		ReportStats();
+	}
+
+	if (_sampleRate <= 0 || hits % _sampleRate != 0) {
+		LOG_DEBUG("Rejected unknown uid {} from tombstone", uid);
+		return true;
+	}
+
+	// Sampled hit: ask MySQL anyway so the false-positive rate stays measurable.
+	++_sampled;
+	auto user = MySQLManager::GetInstance()->GetUser(uid);
+	if (user == nullptr) {
+		return true;
+	}
+
+	++_falsePositives;
+	LOG_WARN("Tombstone for uid {} is stale, dropping it", uid);
+	try {
+		auto key = RedisConPool::UserKey(ChatServiceConstant::USER_INFO_PREFIX, uid);
+		RedisConPool::ForKey(key).del(key);
+		RedisConPool::InvalidateCached(key);
+	}
+	catch (const sw::redis::Error& e) {
+		LOG_WARN("Failed to drop tombstone for uid {}: {}", uid, e.what());
+	}
+	return false;
+}
+
+void NegativeCache::MarkUserAbsent(const std::string& uid)
+{
+	if (_userTTL <= 0) {
+		return;
+	}
+
+	try {
+		auto key = RedisConPool::UserKey(ChatServiceConstant::USER_INFO_PREFIX, uid);
+		RedisConPool::ForKey(key).setex(key, _userTTL, ChatServiceConstant::USER_TOMBSTONE);
+		RedisConPool::InvalidateCached(key);
+		LOG_DEBUG("Cached tombstone for uid {}, ttl {}s", uid, _userTTL);
+	}
+	catch (const sw::redis::Error& e) {
+		LOG_WARN("Failed to cache tombstone for uid {}: {}", uid, e.what());
+	}
+}
+
+bool NegativeCache::IsSearchEmpty(const std::string& selfUid, const std::string& pattern, std::string& version)
+{
+	version.clear();
+	if (_searchTTL <= 0) {
+		return false;
+	}
+
+	try {
+		auto current = RedisConPool::ForKey(ChatServiceConstant::SEARCH_EMPTY_VERSION).get(ChatServiceConstant::SEARCH_EMPTY_VERSION);
+		version = current ? *current : "0";
+
+		auto key = SearchKey(selfUid, pattern, version);
+		auto value = RedisConPool::ForKey(key).get(key);
+		if (!value) {
+			return false;
+		}
+	}
+	catch (const sw::redis::Error& e) {
+		LOG_WARN("Failed to read search tombstone for pattern {}: {}", pattern, e.what());
+		return false;
+	}
+
+	++_searchHits;
+	LOG_DEBUG("Rejected search for pattern {} from tombstone", pattern);
+	return true;
+}
+
+void NegativeCache::MarkSearchEmpty(const std::string& selfUid, const std::string& pattern, const std::string& version)
+{
+	if (_searchTTL <= 0 || version.empty()) {
+		return;
+	}
+
+	try {
+		auto key = SearchKey(selfUid, pattern, version);
+		RedisConPool::ForKey(key).setex(key, _searchTTL, ChatServiceConstant::USER_TOMBSTONE);
+	}
+	catch (const sw::redis::Error& e) {
+		LOG_WARN("Failed to cache search tombstone for pattern {}: {}", pattern, e.what());
+	}
+}
+
+int NegativeCache::GetUserTTL() const
+{
+	return _userTTL;
+}
+
+NegativeCache::Stats NegativeCache::GetStats() const
+{
+	Stats stats;
+	stats.userHits = _userHits.load();
+	stats.searchHits = _searchHits.load();
+	stats.sampled = _sampled.load();
+	stats.falsePositives = _falsePositives.load();
+	stats.falsePositiveRate = stats.sampled == 0 ? 0.0 : static_cast<double>(stats.falsePositives) / stats.sampled;
+	return stats;
+}
+
+NegativeCache::NegativeCache() :
+	_userHits(0), _searchHits(0), _sampled(0), _falsePositives(0)
+{
+	auto& cfg = ConfigManager::GetInstance();
+	_userTTL = cfg.getIntValue("NegativeCache", "UserTTL", 60);
+	_searchTTL = cfg.getIntValue("NegativeCache", "SearchTTL", 30);
+	_sampleRate = cfg.getIntValue("NegativeCache", "SampleRate", 100);
+
+	LOG_INFO("Negative cache initialized - user ttl: {}s, search ttl: {}s, sample rate: 1/{}", _userTTL, _searchTTL, _sampleRate);
+}
+
+std::string NegativeCache::SearchKey(const std::string& selfUid, const std::string& pattern, const std::string& version) const
+{
+	return RedisConPool::UserKey(ChatServiceConstant::SEARCH_EMPTY_PREFIX, selfUid) + "_" + version + "_" + pattern;
+}
+
+void NegativeCache::ReportStats()
+{
+	auto stats = GetStats();
+	LOG_INFO("Negative cache stats - user hits: {}, search hits: {}, sampled: {}, false positives: {}, false-positive rate: {:.4f}",
+		stats.userHits, stats.searchHits, stats.sampled, stats.falsePositives, stats.falsePositiveRate);
+}
@@ -0,0 +1,86 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include "Singleton.h"
+
+/**
+ * @class NegativeCache
+ * @brief Short-TTL tombstones for uids and search patterns that MySQL does not know.
+ *
+ * A tombstone for a uid is written into the regular user_info_<uid> key, so the
+ * Redis read that already precedes every MySQL lookup also answers "does not exist".
+ * UserServer deletes the key on registration. Search tombstones are keyed by
+ * search_empty_version as well, which UserServer increments on registration,
+ * so a new user is never hidden by a search that found nothing before. A
+ * sample of tombstone hits is re-checked against MySQL to measure the
+ * false-positive rate.
+ */
+class NegativeCache : public Singleton<NegativeCache>
+{
+	friend class Singleton<NegativeCache>;
+
+public:
+	struct Stats {
+		uint64_t userHits;
+		uint64_t searchHits;
+		uint64_t sampled;
+		uint64_t falsePositives;
+		double falsePositiveRate;
+	};
+
+	~NegativeCache() = default;
+
+	/**
+	 * @brief Check a value read from user_info_<uid>
+	 *
+	 * @param uid
+	 * @param cachedValue value of user_info_<uid>, may be empty
+	 * @return true if cachedValue is a tombstone and the uid should be rejected
+	 */
+	bool IsUserAbsent(const std::string& uid, const std::string& cachedValue);
+
+	/**
+	 * @brief Record that uid is not present in MySQL
+	 *
+	 * @param uid
+	 */
+	void MarkUserAbsent(const std::string& uid);
+	int GetUserTTL() const;
+
+	/**
+	 * @brief Check for a tombstone left by an earlier empty search
+	 *
+	 * @param selfUid
+	 * @param pattern
+	 * @param version set to the current search version, empty if it can't be read
+	 * @return true if the search is known to find nobody
+	 */
+	bool IsSearchEmpty(const std::string& selfUid, const std::string& pattern, std::string& version);
+
+	/**
+	 * @brief Record that a search found nobody
+	 *
+	 * @param selfUid
+	 * @param pattern
+	 * @param version as read by IsSearchEmpty before searching, so a registration in between voids it
+	 */
+	void MarkSearchEmpty(const std::string& selfUid, const std::string& pattern, const std::string& version);
+
+	Stats GetStats() const;
+
+private:
+	NegativeCache();
+
+	std::string SearchKey(const std::string& selfUid, const std::string& pattern, const std::string& version) const;
+	void ReportStats();
+
+	int _userTTL;
+	int _searchTTL;
+	int _sampleRate;
+
+	std::atomic<uint64_t> _userHits;
+	std::atomic<uint64_t> _searchHits;
+	std::atomic<uint64_t> _sampled;
+	std::atomic<uint64_t> _falsePositives;
+};
@@ -0,0 +1,155 @@
+#include "OfflineInbox.h"
+#include "ConfigManager.h"
+#include "RedisConPool.h"
+#include "CSession.h"
+#include "Logger.h"
+#include "const.h"
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace {
+	using Attrs = std::vector<std::pair<std::string, std::string>>;
+	using Item = std::pair<std::string, sw::redis::Optional<Attrs>>;
+
+	std::string InboxKey(const std::string& uid)
+	{
+		return RedisConPool::UserKey(ChatServiceConstant::OFFLINE_INBOX_PREFIX, uid);
+	}
+
+	std::string ValidKey(const std::string& uid)
+	{
+		return RedisConPool::UserKey(ChatServiceConstant::OFFLINE_INBOX_VALID_PREFIX, uid);
+	}
+}
+
+OfflineInbox::OfflineInbox()
+{
+	auto& cfg = ConfigManager::GetInstance();
+	_ttl = cfg.getIntValue("OfflineInbox", "TTL", 7 * 24 * 3600);
+	_maxLen = std::max(1, cfg.getIntValue("OfflineInbox", "MaxLen", 500));
+	_batchSize = std::max(1, cfg.getIntValue("OfflineInbox", "BatchSize", 100));
+
+	LOG_INFO("Offline inbox initialized - ttl: {}s, max length: {}, batch size: {}", _ttl, _maxLen, _batchSize);
+}
+
+void OfflineInbox::Append(const std::string& uid, int messageId, const std::string& body)
+{
+	auto key = InboxKey(uid);
+	try {
+		// both keys carry the uid tag, so the pipeline goes to a single node
+		auto replies = RedisConPool::ForKey(key).pipeline(false)
+			.xadd(key, "*", { std::make_pair(std::string("type"), std::to_string(messageId)), std::make_pair(std::string("body"), body) })
+			.expire(key, _ttl)
+			.expire(ValidKey(uid), _ttl)
+			.xlen(key)
+			.exec();
+
+		auto length = replies.get<long long>(3);
+		if (length > _maxLen) {
+			// Too far behind for deltas; the next login reloads the full lists instead
+			LOG_WARN("Offline inbox of {} exceeded {} entries, falling back to a full reload", uid, _maxLen);
+			Discard(uid);
+			return;
+		}
+		LOG_DEBUG("Stored notification {} for offline user {}, inbox length {}", messageId, uid, length);
+	}
+	catch (const sw::redis::Error& e) {
+		LOG_ERROR("Failed to store notification {} for offline user {}: {}", messageId, uid, e.what());
+		// a lost entry makes the inbox incomplete
+		try {
+			RedisConPool::ForKey(key).del(ValidKey(uid));
+		}
+		catch (const sw::redis::Error&) {
+		}
+	}
+}
+
+void OfflineInbox::MarkOffline(const std::string& uid)
+{
+	try {
+		RedisConPool::ForKey(ValidKey(uid)).setex(ValidKey(uid), _ttl, "1");
+	}
+	catch (const sw::redis::Error& e) {
+		LOG_WARN("Failed to mark offline inbox of {}: {}", uid, e.what());
+	}
+}
+
+bool OfflineInbox::IsComplete(const std::string& uid)
+{
+	try {
+		return RedisConPool::ForKey(ValidKey(uid)).get(ValidKey(uid)).has_value();
+	}
+	catch (const sw::redis::Error& e) {
+		LOG_WARN("Failed to check offline inbox of {}: {}", uid, e.what());
+		return false;
+	}
+}
+
+std::size_t OfflineInbox::Drain(const std::string& uid, std::shared_ptr<CSession> session)
+{
+	auto key = InboxKey(uid);
+	std::size_t delivered = 0;
+
+	try {
+		auto& redis = RedisConPool::ForKey(key);
+		// the user is online again, so the marker only matters for the next offline period
+		redis.del(ValidKey(uid));
+
+		while (delivered < static_cast<std::size_t>(_maxLen)) {
+			std::vector<Item> items;
+			redis.xrange(key, "-", "+", _batchSize, std::back_inserter(items));
+			if (items.empty()) {
+				break;
+			}
+
+			std::vector<std::string> ids;
+			ids.reserve(items.size());
+			for (const auto& [id, attrs] : items) {
+				ids.push_back(id);
+				if (!attrs) {
+					continue;
+				}
+
+				std::string type, body;
+				for (const auto& [field, value] : *attrs) {
+					if (field == "type") {
+						type = value;
+					}
+					else if (field == "body") {
+						body = value;
+					}
+				}
+				if (type.empty()) {
+					continue;
+				}
+				session->Send(body, static_cast<size_t>(std::stoi(type)));
+				++delivered;
+			}
+
+			redis.xdel(key, ids.begin(), ids.end());
+		}
+	}
+	catch (const sw::redis::Error& e) {
+		// entries not yet deleted stay for the next login
+		LOG_ERROR("Failed to drain offline inbox of {} after {} notifications: {}", uid, delivered, e.what());
+	}
+
+	if (delivered > 0) {
+		LOG_INFO("Delivered {} offline notifications to {}", delivered, uid);
+	}
+	return delivered;
+}
+
+void OfflineInbox::Discard(const std::string& uid)
+{
+	try {
+		auto keys = { InboxKey(uid), ValidKey(uid) };
+		RedisConPool::ForKey(InboxKey(uid)).del(keys.begin(), keys.end());
+	}
+	catch (const sw::redis::Error& e) {
+		LOG_WARN("Failed to discard offline inbox of {}: {}", uid, e.what());
+	}
+}
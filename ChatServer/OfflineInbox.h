@@ -0,0 +1,72 @@
+#pragma once
+#include <memory>
+#include <string>
+#include "Singleton.h"
+
+class CSession;
+
+/**
+ * @class OfflineInbox
+ * @brief Per-user Redis Stream (inbox_<uid>) of notifications that found the user offline.
+ *
+ * Each entry keeps the message id and the exact JSON that would have been
+ * pushed, so draining at login replays them in order. A validity marker
+ * (inbox_valid_<uid>) is set when the user goes offline; while it exists the
+ * inbox holds every notification since then and a client that asks for an
+ * incremental login can skip the full apply/contact lists. Overflowing
+ * MaxLen or outliving TTL drops the marker, forcing a full reload.
+ */
+class OfflineInbox : public Singleton<OfflineInbox>
+{
+	friend class Singleton<OfflineInbox>;
+
+public:
+	~OfflineInbox() = default;
+
+	/**
+	 * @brief Store a notification for an offline user
+	 *
+	 * @param uid recipient
+	 * @param messageId MessageID the client would have received
+	 * @param body notification JSON
+	 */
+	void Append(const std::string& uid, int messageId, const std::string& body);
+
+	/**
+	 * @brief Start collecting for a user who just went offline
+	 *
+	 * @param uid
+	 */
+	void MarkOffline(const std::string& uid);
+
+	/**
+	 * @brief Whether the inbox covers everything since the user's last session
+	 *
+	 * @param uid
+	 * @return true if an incremental login is safe
+	 */
+	bool IsComplete(const std::string& uid);
+
+	/**
+	 * @brief Push the stored notifications to the session in order, removing them as they go
+	 *
+	 * @param uid
+	 * @param session
+	 * @return std::size_t number of notifications delivered
+	 */
+	std::size_t Drain(const std::string& uid, std::shared_ptr<CSession> session);
+
+	/**
+	 * @brief Drop the inbox, e.g. after the client received full lists
+	 *
+	 * @param uid
+	 */
+	void Discard(const std::string& uid);
+
+private:
+	OfflineInbox();
+
+	long long _ttl;
+	long long _maxLen;
+	long long _batchSize;
+};
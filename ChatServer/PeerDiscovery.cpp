@@ -0,0 +1,176 @@
+#include "PeerDiscovery.h"
+#include "ConfigManager.h"
+#include "FriendGrpcClient.h"
+#include "StatusGrpcClient.h"
+#include "LogicSystem.h"
+#include "UserManager.h"
+#include "Logger.h"
+#include "const.h"
+
+#include <algorithm>
+#include <vector>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <sys/resource.h>
+#endif
+
+namespace {
+	// user + system CPU time used by this process so far
+	double ProcessCpuSeconds()
+	{
+#ifdef _WIN32
+		FILETIME created, exited, kernel, user;
+		if (!GetProcessTimes(GetCurrentProcess(), &created, &exited, &kernel, &user)) {
+			return 0.0;
+		}
+		auto ticks = [](const FILETIME& time) {
+			return (static_cast<unsigned long long>(time.dwHighDateTime) << 32) | time.dwLowDateTime;
+		};
+		return (ticks(kernel) + ticks(user)) / 1e7; // 100ns units
+#else
+		rusage usage{};
+		if (getrusage(RUSAGE_SELF, &usage) != 0) {
+			return 0.0;
+		}
+		return usage.ru_utime.tv_sec + usage.ru_stime.tv_sec + (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1e6;
+#endif
+	}
+}
+
+PeerDiscovery::PeerDiscovery() : _registered(false), _refresh(false), _b_stop(true), _lastCpuSec(ProcessCpuSeconds()), _lastMeasure(std::chrono::steady_clock::now())
+{
+	auto& cfg = ConfigManager::GetInstance();
+	_name = cfg["SelfServer"]["name"];
+	_host = cfg["SelfServer"]["host"];
+	_port = atoi(cfg["SelfServer"]["port"].c_str());
+	_rpcPort = atoi(cfg["SelfServer"]["RPCPort"].c_str());
+
+	_pollInterval = std::chrono::seconds(std::max(1, cfg.getIntValue("PeerDiscovery", "PollSec", 5)));
+	_staleAfter = std::chrono::seconds(cfg.getIntValue("PeerDiscovery", "StaleSec", 30));
+	_idleClose = std::chrono::seconds(cfg.getIntValue("PeerDiscovery", "IdleSec", 300));
+}
+
+PeerDiscovery::~PeerDiscovery()
+{
+	Stop();
+}
+
+void PeerDiscovery::Start()
+{
+	if (!_b_stop.exchange(false)) {
+		return;
+	}
+
+	Register();
+	_thread = std::thread(&PeerDiscovery::Run, this);
+}
+
+void PeerDiscovery::Register()
+{
+	auto resp = StatusGrpcClient::GetInstance()->RegisterNode(_name, _host, _port, _rpcPort);
+	_registered = resp.error() == static_cast<int>(ErrorCodes::SUCCESS);
+	if (!_registered) {
+		// Not fatal: the poll loop tries again, and static peers still work
+		LOG_WARN("Failed to register {} with StatusServer, error: {}", _name, resp.error());
+	}
+	else {
+		LOG_INFO("Registered {} with StatusServer - rpc port: {}", _name, _rpcPort);
+	}
+}
+
+void PeerDiscovery::Stop()
+{
+	if (_b_stop.exchange(true)) {
+		return;
+	}
+
+	_cond.notify_all();
+	if (_thread.joinable()) {
+		_thread.join();
+	}
+
+	StatusGrpcClient::GetInstance()->DeregisterNode(_name);
+	LOG_INFO("Deregistered {} from StatusServer", _name);
+}
+
+void PeerDiscovery::RequestRefresh()
+{
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_refresh = true;
+	}
+	_cond.notify_all();
+}
+
+void PeerDiscovery::Run()
+{
+	while (!_b_stop) {
+		Poll();
+
+		std::unique_lock<std::mutex> lock(_mutex);
+		_cond.wait_for(lock, _pollInterval, [this]() {
+			return _b_stop || _refresh;
+		});
+		_refresh = false;
+	}
+}
+
+void PeerDiscovery::Poll()
+{
+	if (!_registered) {
+		Register();
+	}
+	auto beat = StatusGrpcClient::GetInstance()->Heartbeat(_name, _host, _port, Measure());
+	if (beat.error() == static_cast<int>(ErrorCodes::NODE_NOT_FOUND)) {
+		LOG_WARN("StatusServer does not know {}, registering again", _name);
+		Register();
+	}
+
+	auto resp = StatusGrpcClient::GetInstance()->GetNodes();
+	if (resp.error() != static_cast<int>(ErrorCodes::SUCCESS)) {
+		// Keep the current peers rather than dropping them on a StatusServer hiccup
+		LOG_WARN("Failed to fetch nodes from StatusServer, error: {}", resp.error());
+		return;
+	}
+
+	auto now = std::chrono::duration_cast<std::chrono::seconds>(
+		std::chrono::system_clock::now().time_since_epoch()).count();
+
+	std::vector<FriendGrpcClient::PeerAddress> peers;
+	for (const auto& node : resp.nodes()) {
+		if (node.name() == _name || node.rpc_port() == 0) {
+			continue;
+		}
+		if (_staleAfter.count() > 0 && now - node.last_heartbeat() > _staleAfter.count()) {
+			continue;
+		}
+		peers.push_back({ node.name(), node.server_host(), std::to_string(node.rpc_port()) });
+	}
+
+	FriendGrpcClient::GetInstance()->UpdatePeers(peers);
+	FriendGrpcClient::GetInstance()->CloseIdlePeers(_idleClose);
+}
+
+NodeMetrics PeerDiscovery::Measure()
+{
+	auto now = std::chrono::steady_clock::now();
+	auto cpuSec = ProcessCpuSeconds();
+	double wallSec = std::chrono::duration<double>(now - _lastMeasure).count();
+	unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+
+	NodeMetrics metrics;
+	metrics.sessions = static_cast<int>(UserManager::GetInstance()->Count());
+	metrics.queue_depth = static_cast<int>(LogicSystem::GetInstance()->QueueDepth());
+	if (wallSec > 0.0) {
+		metrics.cpu = static_cast<int>(std::min(100.0, (cpuSec - _lastCpuSec) * 100.0 / (wallSec * cores)) + 0.5);
+	}
+
+	_lastCpuSec = cpuSec;
+	_lastMeasure = now;
+	return metrics;
+}
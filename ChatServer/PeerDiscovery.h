@@ -0,0 +1,67 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "Singleton.h"
+#include "StatusGrpcClient.h"
+
+/**
+ * @class PeerDiscovery
+ * @brief Keeps FriendGrpcClient's peer table in sync with StatusServer.
+ *
+ * Registers this server (including its gRPC port) at startup, then every
+ * PollSec sends a heartbeat and pulls the node list, so ChatServers that join
+ * or leave are picked up without editing [PeerServer]. Nodes whose heartbeat
+ * is older than StaleSec are ignored. A failed registration is retried on the
+ * next poll, and so is one the StatusServer lost (it restarted or evicted this
+ * node), which it reports by answering the heartbeat with NODE_NOT_FOUND. Each heartbeat carries this server's
+ * logged-in users, LogicSystem queue depth and process CPU since the last one,
+ * which StatusServer weighs when allocating users.
+ */
+class PeerDiscovery : public Singleton<PeerDiscovery>
+{
+	friend class Singleton<PeerDiscovery>;
+
+public:
+	~PeerDiscovery();
+
+	void Start();
+	void Stop();
+
+	/**
+	 * @brief Poll StatusServer now instead of waiting for the next period
+	 */
+	void RequestRefresh();
+
+private:
+	PeerDiscovery();
+
+	void Run();
+	void Poll();
+	void Register();
+	NodeMetrics Measure();
+
+	std::string _name;
+	std::string _host;
+	int _port;
+	int _rpcPort;
+	// only touched by Start and then the poll thread
+	bool _registered;
+
+	std::chrono::seconds _pollInterval;
+	std::chrono::seconds _staleAfter;
+	std::chrono::seconds _idleClose;
+
+	// process CPU time and wall clock at the previous Measure()
+	double _lastCpuSec;
+	std::chrono::steady_clock::time_point _lastMeasure;
+
+	std::mutex _mutex;
+	std::condition_variable _cond;
+	bool _refresh;
+	std::atomic<bool> _b_stop;
+	std::thread _thread;
+};
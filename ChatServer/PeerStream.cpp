@@ -0,0 +1,302 @@
+#include "PeerStream.h"
+#include "ConfigManager.h"
+#include "Logger.h"
+
+#include <algorithm>
+
+PeerStream::PeerStream(const std::string& peerName, const std::string& host, const std::string& port) :
+	_peerName(peerName), _nextSeq(1), _sentSeq(0), _ackedSeq(0), _window(1),
+	_connected(false), _unary(false), _context(nullptr), _b_stop(false)
+{
+	auto& cfg = ConfigManager::GetInstance();
+	_source = cfg["SelfServer"]["name"];
+	_epoch = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+		std::chrono::system_clock::now().time_since_epoch()).count());
+
+	_maxBatch = static_cast<std::size_t>(std::max(1, cfg.getIntValue("PeerStream", "MaxBatch", 64)));
+	_maxPending = static_cast<std::size_t>(std::max(1, cfg.getIntValue("PeerStream", "MaxPending", 10000)));
+	_linger = std::chrono::milliseconds(cfg.getIntValue("PeerStream", "LingerMs", 2));
+	_reconnectDelay = std::chrono::milliseconds(cfg.getIntValue("PeerStream", "ReconnectMs", 1000));
+	_callTimeout = std::chrono::milliseconds(cfg.getIntValue("PeerStream", "CallTimeoutMs", 3000));
+
+	auto channel = grpc::CreateChannel(host + ":" + port, grpc::InsecureChannelCredentials());
+	_stub = message::FriendService::NewStub(channel);
+
+	LOG_INFO("Peer stream to {} ({}:{}) - max batch: {}, linger: {}ms, max pending: {}",
+		_peerName, host, port, _maxBatch, _linger.count(), _maxPending);
+	_thread = std::thread(&PeerStream::Run, this);
+}
+
+PeerStream::~PeerStream()
+{
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_b_stop = true;
+		if (_context) {
+			_context->TryCancel();
+		}
+	}
+	_cond.notify_all();
+	if (_thread.joinable()) {
+		_thread.join();
+	}
+
+	if (!_unacked.empty()) {
+		LOG_WARN("Peer stream to {} closed with {} undelivered frames", _peerName, _unacked.size());
+	}
+
+	std::vector<Delivered> finished;
+	for (auto& entry : _unacked) {
+		finished.push_back(std::move(entry.delivered));
+	}
+	_unacked.clear();
+	Complete(finished, false);
+}
+
+void PeerStream::Post(message::NotifyFrame frame, Delivered delivered)
+{
+	std::vector<Delivered> dropped;
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		frame.set_seq(_nextSeq++);
+
+		if (_unacked.size() >= _maxPending) {
+			// Never block the caller: give up on the oldest frame and skip past its sequence
+			auto seq = _unacked.front().frame.seq();
+			dropped.push_back(std::move(_unacked.front().delivered));
+			_unacked.pop_front();
+			_ackedSeq = std::max(_ackedSeq, seq);
+			_sentSeq = std::max(_sentSeq, _ackedSeq);
+			LOG_WARN("Peer stream to {} is backed up, dropped frame {}", _peerName, seq);
+		}
+
+		_unacked.push_back(Entry{ std::move(frame), std::move(delivered) });
+		_cond.notify_all();
+	}
+	Complete(dropped, false);
+}
+
+std::size_t PeerStream::Pending()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _unacked.size();
+}
+
+void PeerStream::Run()
+{
+	while (!_b_stop) {
+		auto status = _unary ? RunUnary() : RunStream();
+		if (_b_stop) {
+			break;
+		}
+
+		if (!_unary && status.error_code() == grpc::StatusCode::UNIMPLEMENTED) {
+			LOG_WARN("Peer {} does not serve NotifyStream, falling back to unary calls", _peerName);
+			_unary = true;
+			continue;
+		}
+
+		LOG_WARN("Peer stream to {} closed: {}, reconnecting in {}ms", _peerName, status.error_message(), _reconnectDelay.count());
+		std::unique_lock<std::mutex> lock(_mutex);
+		_cond.wait_for(lock, _reconnectDelay, [this]() { return _b_stop.load(); });
+	}
+}
+
+grpc::Status PeerStream::RunStream()
+{
+	grpc::ClientContext context;
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		if (_b_stop) {
+			return grpc::Status::CANCELLED;
+		}
+		_context = &context;
+	}
+
+	auto stream = _stub->NotifyStream(&context);
+
+	// The receiver opens with an ack carrying its window
+	message::NotifyAck ack;
+	if (stream->Read(&ack)) {
+		uint64_t pending = 0;
+		std::vector<Delivered> finished;
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			HandleAck(ack, finished);
+			// Everything not yet acknowledged goes out again on the new stream
+			_sentSeq = _ackedSeq;
+			_connected = true;
+			pending = Unsent();
+		}
+		Complete(finished, true);
+		LOG_INFO("Peer stream to {} connected, {} frames pending", _peerName, pending);
+
+		std::thread reader([this, &stream]() {
+			message::NotifyAck ack;
+			while (stream->Read(&ack)) {
+				std::vector<Delivered> finished;
+				{
+					std::lock_guard<std::mutex> lock(_mutex);
+					HandleAck(ack, finished);
+					_cond.notify_all();
+				}
+				Complete(finished, true);
+			}
+			std::lock_guard<std::mutex> lock(_mutex);
+			_connected = false;
+			_cond.notify_all();
+		});
+
+		WriteLoop(stream.get());
+
+		stream->WritesDone();
+		context.TryCancel();
+		reader.join();
+	}
+
+	auto status = stream->Finish();
+	std::lock_guard<std::mutex> lock(_mutex);
+	_context = nullptr;
+	_connected = false;
+	return status;
+}
+
+grpc::Status PeerStream::RunUnary()
+{
+	while (true) {
+		message::NotifyFrame frame;
+		grpc::ClientContext context;
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+			_cond.wait(lock, [this]() { return _b_stop || !_unacked.empty(); });
+			if (_b_stop) {
+				return grpc::Status::CANCELLED;
+			}
+			frame = _unacked.front().frame;
+			context.set_deadline(std::chrono::system_clock::now() + _callTimeout);
+			_context = &context;
+		}
+
+		grpc::Status status;
+		switch (frame.payload_case()) {
+		case message::NotifyFrame::kFriendRequest: {
+			message::FriendResponse response;
+			status = _stub->SendFriend(&context, frame.friend_request(), &response);
+			break;
+		}
+		case message::NotifyFrame::kFriendApproval: {
+			message::FriendApprovalResponse response;
+			status = _stub->HandleFriend(&context, frame.friend_approval(), &response);
+			break;
+		}
+		default:
+			break;
+		}
+
+		std::vector<Delivered> finished;
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			_context = nullptr;
+			if (!status.ok()) {
+				return status;
+			}
+			// Post() may have dropped the frame for backlog while the call was out
+			if (!_unacked.empty() && _unacked.front().frame.seq() == frame.seq()) {
+				finished.push_back(std::move(_unacked.front().delivered));
+				_unacked.pop_front();
+			}
+			_ackedSeq = std::max(_ackedSeq, frame.seq());
+			_sentSeq = std::max(_sentSeq, _ackedSeq);
+		}
+		Complete(finished, true);
+	}
+}
+
+void PeerStream::WriteLoop(Stream* stream)
+{
+	std::unique_lock<std::mutex> lock(_mutex);
+	while (!_b_stop && _connected) {
+		_cond.wait(lock, [this]() {
+			return _b_stop || !_connected || (Unsent() > 0 && InFlight() < _window);
+		});
+		if (_b_stop || !_connected) {
+			break;
+		}
+
+		// Linger briefly so a burst of notifications shares one batch
+		if (Unsent() < _maxBatch && _linger.count() > 0) {
+			_cond.wait_for(lock, _linger, [this]() {
+				return _b_stop || !_connected || Unsent() >= _maxBatch;
+			});
+			if (_b_stop || !_connected) {
+				break;
+			}
+		}
+
+		if (InFlight() >= _window) {
+			continue;
+		}
+
+		auto credit = std::min<uint64_t>(_maxBatch, _window - InFlight());
+		message::NotifyBatch batch;
+		batch.set_source(_source);
+		batch.set_epoch(_epoch);
+		for (const auto& entry : _unacked) {
+			if (static_cast<uint64_t>(batch.frames_size()) >= credit) {
+				break;
+			}
+			if (entry.frame.seq() > _sentSeq) {
+				*batch.add_frames() = entry.frame;
+			}
+		}
+		if (batch.frames_size() == 0) {
+			continue;
+		}
+
+		auto lastSeq = batch.frames(batch.frames_size() - 1).seq();
+		lock.unlock();
+		bool ok = stream->Write(batch);
+		lock.lock();
+
+		if (!ok) {
+			_connected = false;
+			break;
+		}
+		_sentSeq = std::max(_sentSeq, lastSeq);
+	}
+}
+
+void PeerStream::HandleAck(const message::NotifyAck& ack, std::vector<Delivered>& finished)
+{
+	_window = std::max<uint32_t>(1, ack.window());
+	if (ack.acked_seq() <= _ackedSeq) {
+		return;
+	}
+
+	_ackedSeq = ack.acked_seq();
+	_sentSeq = std::max(_sentSeq, _ackedSeq);
+	while (!_unacked.empty() && _unacked.front().frame.seq() <= _ackedSeq) {
+		finished.push_back(std::move(_unacked.front().delivered));
+		_unacked.pop_front();
+	}
+}
+
+void PeerStream::Complete(std::vector<Delivered>& finished, bool success)
+{
+	for (auto& delivered : finished) {
+		if (delivered) {
+			delivered(success);
+		}
+	}
+	finished.clear();
+}
+
+uint64_t PeerStream::Unsent() const
+{
+	return (_nextSeq - 1) - _sentSeq;
+}
+
+uint64_t PeerStream::InFlight() const
+{
+	return _sentSeq - _ackedSeq;
+}
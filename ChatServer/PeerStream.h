@@ -0,0 +1,100 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <grpcpp/grpcpp.h>
+#include "message.grpc.pb.h"
+
+/**
+ * @class PeerStream
+ * @brief One long-lived NotifyStream to another ChatServer.
+ *
+ * Post() only queues the frame, so callers never wait on the network. A writer
+ * thread packs queued frames into batches (up to MaxBatch, lingering LingerMs
+ * for a burst to fill up) and keeps at most `window` unacknowledged frames in
+ * flight, as granted by the receiver. Frames stay queued until acknowledged and
+ * are resent after a reconnect; the receiver drops duplicates by sequence.
+ *
+ * A peer that does not serve NotifyStream answers UNIMPLEMENTED; the stream
+ * then falls back to one unary SendFriend/HandleFriend call per frame for the
+ * rest of its life, so an idle close and reopen probes the stream again.
+ */
+class PeerStream
+{
+public:
+	/**
+	 * @brief Called once per frame: true when the peer acknowledged it, false when it was dropped
+	 */
+	using Delivered = std::function<void(bool)>;
+
+	PeerStream(const std::string& peerName, const std::string& host, const std::string& port);
+	~PeerStream();
+
+	PeerStream(const PeerStream&) = delete;
+	PeerStream& operator=(const PeerStream&) = delete;
+
+	/**
+	 * @brief Queue a frame for delivery, dropping the oldest one when MaxPending is reached
+	 *
+	 * @param frame seq is assigned here
+	 * @param delivered runs on the stream's threads, never under the caller's locks
+	 */
+	void Post(message::NotifyFrame frame, Delivered delivered = nullptr);
+
+	/**
+	 * @brief Frames queued or in flight, i.e. not yet acknowledged
+	 */
+	std::size_t Pending();
+
+private:
+	using Stream = grpc::ClientReaderWriter<message::NotifyBatch, message::NotifyAck>;
+
+	struct Entry {
+		message::NotifyFrame frame;
+		Delivered delivered;
+	};
+
+	void Run();
+	grpc::Status RunStream();
+	grpc::Status RunUnary();
+	void WriteLoop(Stream* stream);
+	void HandleAck(const message::NotifyAck& ack, std::vector<Delivered>& finished);
+
+	static void Complete(std::vector<Delivered>& finished, bool success);
+
+	uint64_t Unsent() const;
+	uint64_t InFlight() const;
+
+	std::string _peerName;
+	std::string _source;
+	uint64_t _epoch;
+	std::unique_ptr<message::FriendService::Stub> _stub;
+
+	std::size_t _maxBatch;
+	std::size_t _maxPending;
+	std::chrono::milliseconds _linger;
+	std::chrono::milliseconds _reconnectDelay;
+	std::chrono::milliseconds _callTimeout;
+
+	std::mutex _mutex;
+	std::condition_variable _cond;
+	std::deque<Entry> _unacked;
+	uint64_t _nextSeq;
+	uint64_t _sentSeq;
+	uint64_t _ackedSeq;
+	uint32_t _window;
+	bool _connected;
+	bool _unary;
+	grpc::ClientContext* _context;
+
+	std::atomic<bool> _b_stop;
+	std::thread _thread;
+};
@@ -0,0 +1,141 @@
+#include "RedisBatcher.h"
+#include "RedisConPool.h"
+#include "ConfigManager.h"
+#include "Logger.h"
+
+#include <algorithm>
+#include <map>
+
+thread_local std::vector<RedisBatcher::Command> RedisBatcher::_queue;
+thread_local int RedisBatcher::_depth = 0;
+
+RedisBatcher::Tick::Tick()
+{
+	++_depth;
+}
+
+RedisBatcher::Tick::~Tick()
+{
+	if (--_depth == 0) {
+		RedisBatcher::GetInstance()->Flush();
+	}
+}
+
+RedisBatcher::RedisBatcher() : _flushes(0), _commands(0)
+{
+	auto& cfg = ConfigManager::GetInstance();
+	_maxBatch = static_cast<std::size_t>(std::max(1, cfg.getIntValue("RedisBatcher", "MaxBatch", 64)));
+	LOG_INFO("Redis batcher initialized - max batch: {}", _maxBatch);
+}
+
+RedisFuture<sw::redis::OptionalString> RedisBatcher::Get(const std::string& key)
+{
+	return Enqueue<sw::redis::OptionalString>(key, [key](sw::redis::Pipeline& pipe) {
+		pipe.get(key);
+	});
+}
+
+RedisFuture<long long> RedisBatcher::Ttl(const std::string& key)
+{
+	return Enqueue<long long>(key, [key](sw::redis::Pipeline& pipe) {
+		pipe.ttl(key);
+	});
+}
+
+RedisFuture<sw::redis::OptionalString> RedisBatcher::Hget(const std::string& key, const std::string& field)
+{
+	return Enqueue<sw::redis::OptionalString>(key, [key, field](sw::redis::Pipeline& pipe) {
+		pipe.hget(key, field);
+	});
+}
+
+RedisFuture<long long> RedisBatcher::Hincrby(const std::string& key, const std::string& field, long long increment)
+{
+	return Enqueue<long long>(key, [key, field, increment](sw::redis::Pipeline& pipe) {
+		pipe.hincrby(key, field, increment);
+	});
+}
+
+RedisFuture<bool> RedisBatcher::Set(const std::string& key, const std::string& value)
+{
+	return Enqueue<bool>(key, [key, value](sw::redis::Pipeline& pipe) {
+		pipe.set(key, value);
+	});
+}
+
+RedisFuture<bool> RedisBatcher::Setex(const std::string& key, long long ttl, const std::string& value)
+{
+	return Enqueue<bool>(key, [key, ttl, value](sw::redis::Pipeline& pipe) {
+		pipe.setex(key, ttl, value);
+	});
+}
+
+RedisFuture<long long> RedisBatcher::Del(const std::string& key)
+{
+	return Enqueue<long long>(key, [key](sw::redis::Pipeline& pipe) {
+		pipe.del(key);
+	});
+}
+
+void RedisBatcher::Push(Command command)
+{
+	_queue.push_back(std::move(command));
+	if (_depth == 0 || _queue.size() >= _maxBatch) {
+		Flush();
+	}
+}
+
+void RedisBatcher::Flush()
+{
+	if (_queue.empty()) {
+		return;
+	}
+
+	// swap first: a failing command must not leave the queue half sent
+	std::vector<Command> batch;
+	batch.swap(_queue);
+	_flushes.fetch_add(1, std::memory_order_relaxed);
+	_commands.fetch_add(batch.size(), std::memory_order_relaxed);
+
+	std::map<std::size_t, std::vector<Command>> byNode;
+	for (auto& command : batch) {
+		byNode[RedisConPool::NodeOf(command.key)].push_back(std::move(command));
+	}
+	for (auto& [node, commands] : byNode) {
+		Send(node, commands);
+	}
+}
+
+void RedisBatcher::Send(std::size_t node, std::vector<Command>& commands)
+{
+	try {
+		auto pipe = RedisConPool::TrialNode(node).pipeline(false);
+		for (auto& command : commands) {
+			command.append(pipe);
+		}
+		auto replies = pipe.exec();
+		RedisConPool::RecordSuccess(node);
+
+		for (std::size_t i = 0; i < commands.size(); ++i) {
+			try {
+				commands[i].resolve(replies, i);
+			}
+			catch (const sw::redis::Error&) {
+				commands[i].fail(std::current_exception());
+			}
+		}
+		LOG_DEBUG("Redis batch sent to node {} - commands: {}", node, commands.size());
+	}
+	catch (const sw::redis::Error& e) {
+		LOG_WARN("Redis batch of {} commands to node {} failed: {}", commands.size(), node, e.what());
+		RedisConPool::RecordError(node, e);
+		for (auto& command : commands) {
+			command.fail(std::current_exception());
+		}
+	}
+}
+
+RedisBatcher::Stats RedisBatcher::GetStats() const
+{
+	return Stats{ _flushes.load(std::memory_order_relaxed), _commands.load(std::memory_order_relaxed) };
+}
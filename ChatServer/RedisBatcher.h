@@ -0,0 +1,167 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include <sw/redis++/redis++.h>
+#include "Singleton.h"
+
+template <typename T>
+class RedisFuture;
+
+/**
+ * @class RedisBatcher
+ * @brief Sends the Redis commands a thread issues within one tick as a single pipeline.
+ *
+ * While a Tick is alive on a thread, commands issued through the batcher are
+ * only queued. The queue is sent as one pipelined round trip when a caller
+ * first needs a result (RedisFuture::get), when it reaches MaxBatch commands,
+ * or when the outermost Tick ends. Without a Tick every command is sent at
+ * once, exactly like calling RedisConPool directly.
+ *
+ * Each Redis node gets its own pipeline, so commands on keys sharing a hash
+ * tag (RedisConPool::UserKey) still cost one round trip together.
+ *
+ * Queues and futures belong to the thread that issued the command: a future
+ * must be read on that thread. Commands sent directly through RedisConPool
+ * are not ordered against queued ones, so a handler should not mix the two
+ * on the same keys.
+ */
+class RedisBatcher : public Singleton<RedisBatcher>
+{
+	friend class Singleton<RedisBatcher>;
+
+public:
+	/**
+	 * @brief Batch the calling thread's commands until destroyed
+	 */
+	class Tick {
+	public:
+		Tick();
+		~Tick();
+		Tick(const Tick&) = delete;
+		Tick& operator=(const Tick&) = delete;
+	};
+
+	struct Stats {
+		uint64_t flushes;
+		uint64_t commands;
+	};
+
+	~RedisBatcher() = default;
+
+	RedisFuture<sw::redis::OptionalString> Get(const std::string& key);
+	RedisFuture<long long> Ttl(const std::string& key);
+	RedisFuture<sw::redis::OptionalString> Hget(const std::string& key, const std::string& field);
+	RedisFuture<long long> Hincrby(const std::string& key, const std::string& field, long long increment);
+	RedisFuture<bool> Set(const std::string& key, const std::string& value);
+	RedisFuture<bool> Setex(const std::string& key, long long ttl, const std::string& value);
+	RedisFuture<long long> Del(const std::string& key);
+
+	/**
+	 * @brief Send everything the calling thread has queued
+	 */
+	void Flush();
+
+	Stats GetStats() const;
+
+private:
+	struct Command {
+		std::string key;
+		std::function<void(sw::redis::Pipeline&)> append;
+		std::function<void(sw::redis::QueuedReplies&, std::size_t)> resolve;
+		std::function<void(std::exception_ptr)> fail;
+	};
+
+	RedisBatcher();
+
+	template <typename T, typename Append>
+	RedisFuture<T> Enqueue(const std::string& key, Append append);
+
+	void Send(std::size_t node, std::vector<Command>& commands);
+
+	void Push(Command command);
+
+	static thread_local std::vector<Command> _queue;
+	static thread_local int _depth;
+
+	std::size_t _maxBatch;
+	std::atomic<uint64_t> _flushes;
+	std::atomic<uint64_t> _commands;
+};
+
+/**
+ * @class RedisFuture
+ * @brief Result of a command queued in RedisBatcher.
+ *
+ * get() sends the calling thread's queued commands if this one has not been
+ * sent yet, then returns its reply or rethrows its sw::redis::Error.
+ */
+template <typename T>
+class RedisFuture
+{
+public:
+	T get() {
+		if (!_state->ready) {
+			RedisBatcher::GetInstance()->Flush();
+		}
+		if (!_state->ready) {
+			throw sw::redis::Error("Redis reply read on a thread that did not issue the command");
+		}
+		if (_state->error) {
+			std::rethrow_exception(_state->error);
+		}
+		return *_state->value;
+	}
+
+	bool ready() const {
+		return _state->ready;
+	}
+
+private:
+	friend class RedisBatcher;
+
+	struct State {
+		bool ready = false;
+		std::optional<T> value;
+		std::exception_ptr error;
+	};
+
+	RedisFuture() : _state(std::make_shared<State>()) {}
+
+	std::shared_ptr<State> _state;
+};
+
+template <typename T, typename Append>
+RedisFuture<T> RedisBatcher::Enqueue(const std::string& key, Append append)
+{
+	RedisFuture<T> future;
+	auto state = future._state;
+
+	Command command;
+	command.key = key;
+	command.append = std::move(append);
+	command.resolve = [state](sw::redis::QueuedReplies& replies, std::size_t index) {
+		if constexpr (std::is_same_v<T, bool>) {
+			// SET and SETEX answer with a status reply
+			replies.get<void>(index);
+			state->value = true;
+		}
+		else {
+			state->value = replies.get<T>(index);
+		}
+		state->ready = true;
+	};
+	command.fail = [state](std::exception_ptr error) {
+		state->error = error;
+		state->ready = true;
+	};
+
+	Push(std::move(command));
+	return future;
+}
@@ -0,0 +1,102 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include <sw/redis++/redis++.h>
+
+/**
+ * @class RedisClientCache
+ * @brief Process-local copies of Redis string keys under opted-in prefixes.
+ *
+ * Redis tells us when a tracked key changes: every node publishes keyspace
+ * events for the tracked prefixes (broadcast, like CLIENT TRACKING BCAST
+ * PREFIX) and a subscriber per node drops the local copy. Reads of a node
+ * are only cached while its subscription is up; losing it clears the cache.
+ *
+ * A read that races with a write cannot store the stale value: the fill is
+ * registered before the GET is sent and any invalidation in between cancels
+ * it. Writers in this process should still call Invalidate right away, since
+ * their own event arrives asynchronously. Owned by RedisConPool; keys go to
+ * the node RedisConPool places them on.
+ */
+class RedisClientCache
+{
+public:
+	struct PrefixStats {
+		std::string prefix;
+		uint64_t hits;
+		uint64_t misses;
+		uint64_t invalidations;
+	};
+
+	/**
+	 * @param prefixes nothing is cached when empty
+	 * @param nodes shared clients of the Redis nodes, indexed like RedisConPool::Node
+	 * @param maxEntries the table is cleared when it fills up
+	 * @param ttl upper bound on the age of a copy, in case an invalidation is lost
+	 */
+	RedisClientCache(const std::vector<std::string>& prefixes, const std::vector<sw::redis::Redis*>& nodes,
+		std::size_t maxEntries, std::chrono::seconds ttl);
+	~RedisClientCache();
+
+	RedisClientCache(const RedisClientCache&) = delete;
+	RedisClientCache& operator=(const RedisClientCache&) = delete;
+
+	bool Tracks(const std::string& key) const;
+
+	sw::redis::OptionalString Get(const std::string& key);
+
+	/**
+	 * @brief Values of keys, in order; only the ones not cached are fetched, one MGET per node
+	 */
+	std::vector<sw::redis::OptionalString> MGet(const std::vector<std::string>& keys);
+
+	void Invalidate(const std::string& key);
+
+	std::vector<PrefixStats> GetStats() const;
+
+private:
+	using Clock = std::chrono::steady_clock;
+
+	struct Entry {
+		sw::redis::OptionalString value;
+		Clock::time_point expiresAt;
+	};
+
+	struct Counters {
+		std::atomic<uint64_t> hits{ 0 };
+		std::atomic<uint64_t> misses{ 0 };
+		std::atomic<uint64_t> invalidations{ 0 };
+	};
+
+	int PrefixOf(const std::string& key) const;
+	bool Lookup(const std::string& key, int prefix, sw::redis::OptionalString& value, uint64_t& fill);
+	void Store(const std::string& key, uint64_t fill, const sw::redis::OptionalString& value);
+	void Cancel(const std::string& key, uint64_t fill);
+	void Clear();
+
+	void EnableNotifications(std::size_t node);
+	void SubscribeLoop(std::size_t node);
+
+	std::vector<std::string> _prefixes;
+	std::unique_ptr<Counters[]> _counters;
+	std::size_t _maxEntries;
+	std::chrono::seconds _ttl;
+
+	mutable std::mutex _mutex;
+	std::unordered_map<std::string, Entry> _entries;
+	// key -> id of the read currently filling it
+	std::unordered_map<std::string, uint64_t> _fills;
+	uint64_t _nextFill;
+
+	std::vector<sw::redis::Redis*> _nodes;
+	std::unique_ptr<std::atomic<bool>[]> _subscribed;
+	std::atomic<bool> _b_stop;
+	std::vector<std::thread> _threads;
+};
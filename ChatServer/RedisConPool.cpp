@@ -2,42 +2,257 @@
 #include "ConfigManager.h"
 #include "Logger.h"
 
+#include <algorithm>
+#include <sstream>
+
+namespace {
+    // one entry per node once BindThread ran on this thread
+    thread_local std::vector<sw::redis::Redis*> t_nodes;
+}
+
 sw::redis::Redis& RedisConPool::GetInstance()
+{
+    return Node(0);
+}
+
+sw::redis::Redis& RedisConPool::ForKey(const std::string& key)
+{
+    return Node(NodeOf(key));
+}
+
+bool RedisConPool::Available(const std::string& key)
+{
+    return Self()._nodes[NodeOf(key)]->breaker->GetState() == CircuitBreaker::State::CLOSED;
+}
+
+void RedisConPool::RecordSuccess(std::size_t node)
+{
+    Self()._nodes[node]->breaker->OnSuccess();
+}
+
+void RedisConPool::RecordError(std::size_t node, const sw::redis::Error& error)
+{
+    if (dynamic_cast<const RedisUnavailable*>(&error)) {
+        return;
+    }
+    if (dynamic_cast<const sw::redis::ReplyError*>(&error)) {
+        Self()._nodes[node]->breaker->OnSuccess();
+        return;
+    }
+    // I/O errors, timeouts, and running out of pooled connections
+    Self()._nodes[node]->breaker->OnFailure();
+}
+
+std::size_t RedisConPool::NodeOf(const std::string& key)
+{
+    auto& self = Self();
+    if (self._nodes.size() == 1) {
+        return 0;
+    }
+
+    // hash only the tag, if the key has a non-empty one
+    const char* data = key.data();
+    std::size_t size = key.size();
+    auto open = key.find('{');
+    if (open != std::string::npos) {
+        auto close = key.find('}', open + 1);
+        if (close != std::string::npos && close > open + 1) {
+            data += open + 1;
+            size = close - open - 1;
+        }
+    }
+
+    auto point = std::make_pair(Hash(data, size), std::size_t(0));
+    auto iter = std::lower_bound(self._ring.begin(), self._ring.end(), point);
+    if (iter == self._ring.end()) {
+        iter = self._ring.begin();
+    }
+    return iter->second;
+}
+
+std::size_t RedisConPool::NodeCount()
+{
+    return Self()._nodes.size();
+}
+
+sw::redis::Redis& RedisConPool::Node(std::size_t index)
+{
+    // these callers never report back, so they wait for the trials to close the circuit
+    auto& node = *Self()._nodes[index];
+    if (node.breaker->GetState() != CircuitBreaker::State::CLOSED) {
+        throw RedisUnavailable("Redis node [" + node.section + "] unavailable, circuit "
+            + CircuitBreaker::StateName(node.breaker->GetState()));
+    }
+    return Client(index);
+}
+
+sw::redis::Redis& RedisConPool::TrialNode(std::size_t index)
+{
+    auto& node = *Self()._nodes[index];
+    if (!node.breaker->Allow()) {
+        throw RedisUnavailable("Redis node [" + node.section + "] unavailable, circuit open");
+    }
+    return Client(index);
+}
+
+sw::redis::Redis& RedisConPool::Client(std::size_t index)
+{
+    if (index < t_nodes.size()) {
+        return *t_nodes[index];
+    }
+    return *Self()._nodes[index]->redis;
+}
+
+std::string RedisConPool::UserKey(const std::string& prefix, const std::string& uid)
+{
+    return prefix + "{" + uid + "}";
+}
+
+RedisConPool& RedisConPool::Self()
 {
     static RedisConPool con;
-    return *con._redis;
+    return con;
+}
+
+void RedisConPool::BindThread()
+{
+    auto& self = Self();
+    if (!self._perThread || !t_nodes.empty()) {
+        return;
+    }
+
+    try {
+        std::vector<std::unique_ptr<sw::redis::Redis>> connections;
+        for (const auto& node : self._nodes) {
+            sw::redis::ConnectionPoolOptions single;
+            single.size = 1;
+            single.connection_lifetime = node->poolOptions.connection_lifetime;
+            connections.push_back(std::make_unique<sw::redis::Redis>(node->options, single));
+        }
+
+        std::lock_guard<std::mutex> lock(self._dedicatedMutex);
+        for (auto& redis : connections) {
+            t_nodes.push_back(redis.get());
+            self._dedicated.push_back(std::move(redis));
+        }
+        LOG_DEBUG("Dedicated Redis connections bound to thread, total: {}", self._dedicated.size());
+    }
+    catch (const sw::redis::Error& e) {
+        LOG_ERROR("Failed to bind dedicated Redis connections, using the shared pools: {}", e.what());
+    }
+}
+
+sw::redis::OptionalString RedisConPool::CachedGet(const std::string& key)
+{
+    return Self()._cache->Get(key);
+}
+
+std::vector<sw::redis::OptionalString> RedisConPool::CachedMGet(const std::vector<std::string>& keys)
+{
+    return Self()._cache->MGet(keys);
+}
+
+void RedisConPool::InvalidateCached(const std::string& key)
+{
+    Self()._cache->Invalidate(key);
+}
+
+std::vector<RedisClientCache::PrefixStats> RedisConPool::GetCacheStats()
+{
+    return Self()._cache->GetStats();
+}
+
+RedisConPool::Stats RedisConPool::GetStats()
+{
+    auto& self = Self();
+    Stats stats;
+    {
+        std::lock_guard<std::mutex> lock(self._statsMutex);
+        stats = self._stats;
+    }
+    std::lock_guard<std::mutex> lock(self._dedicatedMutex);
+    stats.dedicated = self._dedicated.size();
+    return stats;
 }
 
 RedisConPool::~RedisConPool()
 {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _b_stop = true;
+    }
+    _cond.notify_all();
+    if (_sampler.joinable()) {
+        _sampler.join();
+    }
     LOG_INFO("Destroying Redis connection pool");
 }
 
-RedisConPool::RedisConPool()
+RedisConPool::RedisConPool() : _stats{}, _b_stop(false)
 {
     LOG_INFO("Initializing Redis connection pool");
     
     try {
-        sw::redis::ConnectionOptions _options;
         auto& configManager = ConfigManager::GetInstance();
-        
-        _options.host = configManager["Redis"]["host"];
-        _options.port = std::stoi(configManager["Redis"]["port"]);
-        _options.socket_timeout = std::chrono::milliseconds(200);
-        
-        LOG_DEBUG("Configuring connection - Host: {}, Port: {}, Timeout: {}ms", _options.host, _options.port, 200);
-
-        _redis = std::make_unique<sw::redis::Redis>(_options);
-        
-        // 验证连接是否成功
-        try {
-            _redis->ping();
-            LOG_INFO("Successfully connected to Redis server");
+        _perThread = configManager.getIntValue("Redis", "PerThread", 0) != 0;
+        _sampleInterval = std::chrono::milliseconds(configManager.getIntValue("Redis", "SampleMs", 1000));
+        _logInterval = std::chrono::seconds(std::max(1, configManager.getIntValue("Redis", "MetricsSec", 60)));
+        _memoryInterval = std::chrono::seconds(configManager.getIntValue("Redis", "MemoryReportSec", 0));
+        _memoryKeys = static_cast<std::size_t>(std::max(1, configManager.getIntValue("Redis", "MemoryReportKeys", 2000)));
+
+        std::vector<std::string> sections;
+        std::stringstream ss(configManager["Redis"]["Nodes"]);
+        std::string section;
+        while (std::getline(ss, section, ',')) {
+            section.erase(0, section.find_first_not_of(' '));
+            section.erase(section.find_last_not_of(' ') + 1);
+            if (!section.empty()) {
+                sections.push_back(section);
+            }
         }
-        catch (const sw::redis::Error& e) {
-            LOG_CRITICAL("Failed to connect to Redis server: {}", e.what());
-            throw;
+        if (sections.empty()) {
+            sections.push_back("Redis");
+        }
+
+        // Every node is required: skipping one would move its keys to the others
+        for (const auto& name : sections) {
+            _nodes.push_back(MakeNode(name));
+        }
+
+        auto virtualNodes = std::max(1, configManager.getIntValue("Redis", "VirtualNodes", 160));
+        for (std::size_t i = 0; i < _nodes.size(); ++i) {
+            for (int v = 0; v < virtualNodes; ++v) {
+                auto point = _nodes[i]->section + "#" + std::to_string(v);
+                _ring.emplace_back(Hash(point.data(), point.size()), i);
+            }
         }
+        std::sort(_ring.begin(), _ring.end());
+
+        std::vector<std::string> prefixes;
+        std::stringstream prefixList(configManager["Redis"]["CachePrefixes"]);
+        std::string prefix;
+        while (std::getline(prefixList, prefix, ',')) {
+            prefix.erase(0, prefix.find_first_not_of(' '));
+            prefix.erase(prefix.find_last_not_of(' ') + 1);
+            if (!prefix.empty()) {
+                prefixes.push_back(prefix);
+            }
+        }
+        std::vector<sw::redis::Redis*> clients;
+        for (const auto& node : _nodes) {
+            clients.push_back(node->redis.get());
+        }
+        _cache = std::make_unique<RedisClientCache>(prefixes, clients,
+            static_cast<std::size_t>(std::max(1, configManager.getIntValue("Redis", "CacheMaxEntries", 100000))),
+            std::chrono::seconds(std::max(1, configManager.getIntValue("Redis", "CacheTTLSec", 300))));
+        _stats.nodes = _nodes.size();
+        _stats.poolSize = _nodes.front()->poolOptions.size;
+
+        if (_sampleInterval.count() > 0) {
+            _sampler = std::thread(&RedisConPool::SampleLoop, this);
+        }
+        LOG_INFO("Redis connection pool ready - nodes: {}, virtual nodes: {}, cached prefixes: {}",
+            _nodes.size(), virtualNodes, prefixes.size());
     }
     catch (const std::exception& e) {
         LOG_CRITICAL("Redis pool initialization failed: {}", e.what());
@@ -45,18 +260,288 @@ RedisConPool::RedisConPool()
     }
 }
 
-void RedisConPool::HealthCheck()
+std::unique_ptr<RedisConPool::NodeInfo> RedisConPool::MakeNode(const std::string& section)
 {
+    auto& configManager = ConfigManager::GetInstance();
+    // node sections only need host and port; everything else defaults to [Redis]
+    auto setting = [&configManager, &section](const std::string& key, int defaultValue) {
+        return configManager.getIntValue(section, key, configManager.getIntValue("Redis", key, defaultValue));
+    };
+
+    auto node = std::make_unique<NodeInfo>();
+    node->section = section;
+    node->options.host = configManager[section]["host"];
+    node->options.port = std::stoi(configManager[section]["port"]);
+    node->options.socket_timeout = std::chrono::milliseconds(setting("SocketTimeoutMs", 200));
+    node->options.connect_timeout = std::chrono::milliseconds(setting("ConnectTimeoutMs", 1000));
+
+    node->poolOptions.size = static_cast<std::size_t>(std::max(1, setting("PoolSize", 16)));
+    node->poolOptions.wait_timeout = std::chrono::milliseconds(setting("WaitTimeoutMs", 100));
+    node->poolOptions.connection_lifetime = std::chrono::seconds(setting("ConnectionLifetimeSec", 0));
+    node->poolOptions.connection_idle_time = std::chrono::seconds(setting("ConnectionIdleSec", 0));
+
+    LOG_DEBUG("Configuring connection [{}] - Host: {}, Port: {}, Timeout: {}ms, Pool size: {}, Wait timeout: {}ms, Per thread: {}",
+        section, node->options.host, node->options.port, node->options.socket_timeout.count(),
+        node->poolOptions.size, node->poolOptions.wait_timeout.count(), _perThread);
+
+    CircuitBreaker::Options breaker;
+    breaker.window = static_cast<std::size_t>(std::max(0, setting("BreakerWindow", 20)));
+    if (breaker.window > 0 && _sampleInterval.count() <= 0) {
+        // half-open trials come from the sampler; without it an open circuit would stay open
+        LOG_WARN("Circuit breaker of [{}] needs SampleMs > 0, disabled", section);
+        breaker.window = 0;
+    }
+    breaker.minCalls = static_cast<std::size_t>(std::max(1, setting("BreakerMinCalls", 10)));
+    breaker.failurePercent = setting("BreakerFailurePct", 50);
+    breaker.openTime = std::chrono::milliseconds(setting("BreakerOpenMs", 2000));
+    breaker.trials = static_cast<std::size_t>(std::max(1, setting("BreakerTrials", 3)));
+    node->breaker = std::make_unique<CircuitBreaker>("redis:" + section, breaker);
+
+    node->redis = std::make_unique<sw::redis::Redis>(node->options, node->poolOptions);
+
+    // 验证连接是否成功
     try {
-        if (_redis) {
-            _redis->ping();
-            LOG_DEBUG("Health check successful");
+        node->redis->ping();
+        LOG_INFO("Successfully connected to Redis server [{}]", section);
+    }
+    catch (const sw::redis::Error& e) {
+        LOG_CRITICAL("Failed to connect to Redis server [{}]: {}", section, e.what());
+        throw;
+    }
+
+    if (_sampleInterval.count() > 0) {
+        sw::redis::ConnectionPoolOptions single;
+        single.size = 1;
+        node->probe = std::make_unique<sw::redis::Redis>(node->options, single);
+    }
+    return node;
+}
+
+uint64_t RedisConPool::Hash(const char* data, std::size_t size)
+{
+    // FNV-1a, then a 64-bit finalizer so similar names land far apart on the ring
+    uint64_t hash = 14695981039346656037ULL;
+    for (std::size_t i = 0; i < size; ++i) {
+        hash ^= static_cast<unsigned char>(data[i]);
+        hash *= 1099511628211ULL;
+    }
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ULL;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+void RedisConPool::HealthCheck()
+{
+    for (const auto& node : _nodes) {
+        try {
+            node->redis->ping();
+            LOG_DEBUG("Health check successful [{}]", node->section);
         }
-        else {
-            LOG_ERROR("Redis connection is null");
+        catch (const sw::redis::Error& e) {
+            LOG_ERROR("Health check failed [{}]: {}", node->section, e.what());
         }
     }
-    catch (const sw::redis::Error& e) {
-        LOG_ERROR("Health check failed: {}", e.what());
+}
+
+void RedisConPool::SampleLoop()
+{
+    auto nextLog = std::chrono::steady_clock::now() + _logInterval;
+    auto nextMemory = std::chrono::steady_clock::now() + _memoryInterval;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _cond.wait_for(lock, _sampleInterval, [this]() { return _b_stop; });
+            if (_b_stop) {
+                return;
+            }
+        }
+
+        Sample();
+        if (std::chrono::steady_clock::now() >= nextLog) {
+            LogStats();
+            nextLog = std::chrono::steady_clock::now() + _logInterval;
+        }
+        if (_memoryInterval.count() > 0 && std::chrono::steady_clock::now() >= nextMemory) {
+            ReportMemory();
+            nextMemory = std::chrono::steady_clock::now() + _memoryInterval;
+        }
     }
 }
+
+void RedisConPool::Sample()
+{
+    using namespace std::chrono;
+    for (std::size_t index = 0; index < _nodes.size(); ++index) {
+        const auto& node = _nodes[index];
+        // while the circuit is open the sampler waits like everyone else; half-open, it probes
+        if (!node->breaker->Allow()) {
+            continue;
+        }
+        try {
+            auto start = steady_clock::now();
+            node->probe->ping();
+            auto latency = duration_cast<microseconds>(steady_clock::now() - start);
+            RecordSuccess(index);
+
+            start = steady_clock::now();
+            node->redis->ping();
+            auto pooled = duration_cast<microseconds>(steady_clock::now() - start);
+            auto wait = std::max(microseconds(0), pooled - latency);
+
+            std::lock_guard<std::mutex> lock(_statsMutex);
+            ++_stats.samples;
+            ++_stats.latencies[Bucket(latency)];
+            ++_stats.poolWaits[Bucket(wait)];
+            _stats.maxLatencyUs = std::max<long long>(_stats.maxLatencyUs, latency.count());
+            _stats.maxPoolWaitUs = std::max<long long>(_stats.maxPoolWaitUs, wait.count());
+        }
+        catch (const sw::redis::Error& e) {
+            // a wait timeout on the shared pool lands here as well
+            RecordError(index, e);
+            std::lock_guard<std::mutex> lock(_statsMutex);
+            ++_stats.failures;
+            LOG_DEBUG("Redis latency sample of [{}] failed: {}", node->section, e.what());
+        }
+    }
+}
+
+void RedisConPool::LogStats()
+{
+    auto stats = GetStats();
+
+    auto format = [](const auto& buckets) {
+        std::ostringstream out;
+        for (std::size_t i = 0; i < buckets.size(); ++i) {
+            if (i < LATENCY_BUCKETS_MS.size()) {
+                out << "<=" << LATENCY_BUCKETS_MS[i] << "ms:" << buckets[i] << " ";
+            }
+            else {
+                out << ">" << LATENCY_BUCKETS_MS.back() << "ms:" << buckets[i];
+            }
+        }
+        return out.str();
+    };
+
+    LOG_INFO("Redis pool - nodes: {}, size: {}, dedicated: {}, samples: {}, failures: {}, max wait: {}us, max latency: {}us, pool wait: {}, command latency: {}",
+        stats.nodes, stats.poolSize, stats.dedicated, stats.samples, stats.failures, stats.maxPoolWaitUs, stats.maxLatencyUs,
+        format(stats.poolWaits), format(stats.latencies));
+
+    for (const auto& node : _nodes) {
+        auto state = node->breaker->GetState();
+        if (state != CircuitBreaker::State::CLOSED || node->breaker->Rejected() > 0) {
+            LOG_INFO("Redis node [{}] circuit {} - rejected calls: {}",
+                node->section, CircuitBreaker::StateName(state), node->breaker->Rejected());
+        }
+    }
+
+    for (const auto& cache : GetCacheStats()) {
+        auto lookups = cache.hits + cache.misses;
+        LOG_INFO("Redis client cache [{}] - hits: {}, misses: {}, hit rate: {:.1f}%, invalidations: {}",
+            cache.prefix, cache.hits, cache.misses, lookups ? 100.0 * cache.hits / lookups : 0.0, cache.invalidations);
+    }
+}
+
+void RedisConPool::ReportMemory()
+{
+    struct Family {
+        uint64_t keys = 0;
+        uint64_t bytes = 0;
+        uint64_t withoutTTL = 0;
+    };
+
+    for (std::size_t index = 0; index < _nodes.size(); ++index) {
+        const auto& node = _nodes[index];
+        if (node->breaker->GetState() != CircuitBreaker::State::CLOSED) {
+            continue;
+        }
+
+        try {
+            auto& redis = *node->redis;
+            auto total = redis.command<long long>("DBSIZE");
+            std::map<std::string, Family> families;
+            std::size_t sampled = 0;
+            long long cursor = 0;
+            do {
+                std::vector<std::string> keys;
+                cursor = redis.scan(cursor, "*", 200, std::back_inserter(keys));
+                if (keys.size() > _memoryKeys - sampled) {
+                    keys.resize(_memoryKeys - sampled);
+                }
+                if (keys.empty()) {
+                    continue;
+                }
+
+                // one round trip per SCAN page
+                auto pipe = redis.pipeline(false);
+                for (const auto& key : keys) {
+                    pipe.command("MEMORY", "USAGE", key, "SAMPLES", "0");
+                    pipe.ttl(key);
+                }
+                auto replies = pipe.exec();
+                for (std::size_t i = 0; i < keys.size(); ++i) {
+                    auto usage = replies.get<sw::redis::Optional<long long>>(2 * i);
+                    auto ttl = replies.get<long long>(2 * i + 1);
+                    if (!usage) {
+                        continue; // expired since SCAN returned it
+                    }
+                    auto& family = families[KeyFamily(keys[i])];
+                    ++family.keys;
+                    family.bytes += static_cast<uint64_t>(*usage);
+                    family.withoutTTL += ttl == -1 ? 1 : 0;
+                }
+                sampled += keys.size();
+            } while (cursor != 0 && sampled < _memoryKeys);
+
+            if (sampled == 0) {
+                continue;
+            }
+            double scale = static_cast<double>(total) / sampled;
+            LOG_INFO("Redis memory [{}] - keys: {}, sampled: {}, families: {}", node->section, total, sampled, families.size());
+            for (const auto& [name, family] : families) {
+                LOG_INFO("Redis memory [{}] {} - keys: ~{}, size: ~{} KB, avg: {} B/key, without ttl: {}%",
+                    node->section, name,
+                    static_cast<uint64_t>(family.keys * scale),
+                    static_cast<uint64_t>(family.bytes * scale / 1024),
+                    family.bytes / family.keys,
+                    family.withoutTTL * 100 / family.keys);
+            }
+        }
+        catch (const sw::redis::Error& e) {
+            LOG_WARN("Redis memory report of [{}] failed: {}", node->section, e.what());
+        }
+    }
+}
+
+std::string RedisConPool::KeyFamily(const std::string& key)
+{
+    // user_info_{42} -> user_info_*, friend_request_{42}_apply -> friend_request_*_apply
+    auto open = key.find('{');
+    if (open != std::string::npos) {
+        auto close = key.find('}', open + 1);
+        if (close != std::string::npos) {
+            return key.substr(0, open) + "*" + key.substr(close + 1);
+        }
+    }
+
+    // status_node:ChatServer1 -> status_node:*, search_empty_42 -> search_empty_*
+    auto colon = key.rfind(':');
+    if (colon != std::string::npos) {
+        return key.substr(0, colon + 1) + "*";
+    }
+    auto digit = key.find_first_of("0123456789");
+    if (digit != std::string::npos) {
+        return key.substr(0, digit) + "*";
+    }
+    return key;
+}
+
+std::size_t RedisConPool::Bucket(std::chrono::microseconds elapsed)
+{
+    // buckets are inclusive upper bounds in whole milliseconds
+    auto ms = (elapsed.count() + 999) / 1000;
+    auto iter = std::lower_bound(LATENCY_BUCKETS_MS.begin(), LATENCY_BUCKETS_MS.end(), ms);
+    return static_cast<std::size_t>(iter - LATENCY_BUCKETS_MS.begin());
+}
@@ -0,0 +1,170 @@
+﻿#include "ReplicaRouter.h"
+#include "ConfigManager.h"
+#include "Logger.h"
+
+#include <algorithm>
+#include <iterator>
+#include <sstream>
+
+ReplicaRouter::ReplicaRouter(const std::string& section, MySQLConPool& primary) :
+	_primary(primary), _next(0), _b_stop(false)
+{
+	auto& cfg = ConfigManager::GetInstance();
+	_maxLag = cfg.getIntValue("MySQL", "MaxLagSec", 5);
+	_sticky = std::chrono::seconds(cfg.getIntValue("MySQL", "StickySec", 10));
+	_checkInterval = std::chrono::seconds(std::max(1, cfg.getIntValue("MySQL", "HealthCheckSec", 5)));
+
+	std::stringstream ss(cfg[section]["Replicas"]);
+	std::string name;
+	while (std::getline(ss, name, ',')) {
+		name.erase(0, name.find_first_not_of(' '));
+		name.erase(name.find_last_not_of(' ') + 1);
+		if (name.empty()) {
+			continue;
+		}
+
+		try {
+			auto replica = std::make_unique<Replica>();
+			replica->section = name;
+			replica->pool = std::make_unique<MySQLConPool>(name);
+			Check(*replica);
+			_replicas.push_back(std::move(replica));
+		}
+		catch (const std::exception& e) {
+			LOG_ERROR("Skipping read replica [{}]: {}", name, e.what());
+		}
+	}
+
+	LOG_INFO("Replica router for [{}] initialized - replicas: {}, max lag: {}s, sticky: {}s",
+		section, _replicas.size(), _maxLag, _sticky.count());
+	if (!_replicas.empty()) {
+		_thread = std::thread(&ReplicaRouter::HealthLoop, this);
+	}
+}
+
+ReplicaRouter::~ReplicaRouter()
+{
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_b_stop = true;
+	}
+	_cond.notify_all();
+	if (_thread.joinable()) {
+		_thread.join();
+	}
+}
+
+MySQLConPool& ReplicaRouter::ForRead(const std::string& uid)
+{
+	if (_replicas.empty() || (!uid.empty() && IsSticky(uid))) {
+		return _primary;
+	}
+
+	auto start = _next.fetch_add(1, std::memory_order_relaxed);
+	for (std::size_t i = 0; i < _replicas.size(); ++i) {
+		auto& replica = *_replicas[(start + i) % _replicas.size()];
+		if (replica.healthy.load(std::memory_order_relaxed)) {
+			return *replica.pool;
+		}
+	}
+	return _primary;
+}
+
+MySQLConPool& ReplicaRouter::ForRead(const std::vector<std::string>& uids)
+{
+	if (_replicas.empty()) {
+		return _primary;
+	}
+	for (const auto& uid : uids) {
+		if (IsSticky(uid)) {
+			return _primary;
+		}
+	}
+	return ForRead();
+}
+
+void ReplicaRouter::NoteWrite(const std::string& uid)
+{
+	if (_replicas.empty() || uid.empty() || _sticky.count() <= 0) {
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(_writeMutex);
+	_recentWrites[uid] = Clock::now() + _sticky;
+}
+
+bool ReplicaRouter::IsSticky(const std::string& uid)
+{
+	std::lock_guard<std::mutex> lock(_writeMutex);
+	auto iter = _recentWrites.find(uid);
+	if (iter == _recentWrites.end()) {
+		return false;
+	}
+	if (iter->second <= Clock::now()) {
+		_recentWrites.erase(iter);
+		return false;
+	}
+	return true;
+}
+
+void ReplicaRouter::HealthLoop()
+{
+	while (true) {
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+			_cond.wait_for(lock, _checkInterval, [this]() { return _b_stop; });
+			if (_b_stop) {
+				return;
+			}
+		}
+
+		for (auto& replica : _replicas) {
+			Check(*replica);
+		}
+
+		std::lock_guard<std::mutex> lock(_writeMutex);
+		auto now = Clock::now();
+		for (auto iter = _recentWrites.begin(); iter != _recentWrites.end();) {
+			iter = iter->second <= now ? _recentWrites.erase(iter) : std::next(iter);
+		}
+	}
+}
+
+void ReplicaRouter::Check(Replica& replica)
+{
+	long long lag = -1;
+	auto conn = replica.pool->GetConnection();
+	if (conn) {
+		try {
+			// Seconds_Behind_Source is NULL while replication is stopped, and there is
+			// no row at all on a server that isn't a replica: reads sent there could miss
+			// the primary's writes, so it stays out of rotation like a broken one
+			auto result = conn->sql("SHOW REPLICA STATUS").execute();
+			auto row = result.fetchOne();
+			for (std::size_t i = 0; row && i < result.getColumnCount(); ++i) {
+				std::string label = result.getColumn(i).getColumnLabel();
+				if (label == "Seconds_Behind_Source" || label == "Seconds_Behind_Master") {
+					lag = row[i].isNull() ? -1 : row[i].get<long long>();
+					break;
+				}
+			}
+		}
+		catch (const mysqlx::Error& error) {
+			replica.pool->MarkSuspect(conn.get());
+			LOG_WARN("Health check of read replica [{}] failed: {}", replica.section, error.what());
+		}
+		replica.pool->ReleaseConnection(std::move(conn));
+	}
+
+	bool healthy = lag >= 0 && lag <= _maxLag;
+	bool was = replica.healthy.exchange(healthy);
+	replica.lagSec = lag;
+	if (was != healthy) {
+		if (healthy) {
+			LOG_INFO("Read replica [{}] is back in rotation, lag: {}s", replica.section, lag);
+		}
+		else {
+			LOG_WARN("Read replica [{}] taken out of rotation, lag: {}s", replica.section, lag);
+		}
+	}
+}
@@ -0,0 +1,88 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "MySQLConPool.h"
+
+/**
+ * @class ReplicaRouter
+ * @brief Picks the pool a read should use: a healthy replica or the primary.
+ *
+ * Replicas of a primary are listed in its config section's Replicas key as
+ * further section names, each with its own pool. A background check measures every replica's lag every
+ * HealthCheckSec; replicas that are unreachable, not replicating, or more
+ * than MaxLagSec behind are skipped. A uid that wrote within StickySec reads
+ * from the primary so it always sees its own change.
+ */
+class ReplicaRouter
+{
+public:
+	/**
+	 * @param section config section of the primary, whose Replicas key lists the replicas
+	 * @param primary pool reads fall back to
+	 */
+	ReplicaRouter(const std::string& section, MySQLConPool& primary);
+	~ReplicaRouter();
+
+	ReplicaRouter(const ReplicaRouter&) = delete;
+	ReplicaRouter& operator=(const ReplicaRouter&) = delete;
+
+	/**
+	 * @brief Pool for a read on behalf of uid
+	 *
+	 * @param uid empty for reads not tied to one user
+	 * @return MySQLConPool& the primary if uid wrote recently or no replica is usable
+	 */
+	MySQLConPool& ForRead(const std::string& uid = "");
+
+	/**
+	 * @brief Pool for a read covering several users; the primary if any of them wrote recently
+	 *
+	 * @param uids
+	 * @return MySQLConPool&
+	 */
+	MySQLConPool& ForRead(const std::vector<std::string>& uids);
+
+	/**
+	 * @brief Pin uid's reads to the primary for StickySec
+	 *
+	 * @param uid
+	 */
+	void NoteWrite(const std::string& uid);
+
+private:
+	using Clock = std::chrono::steady_clock;
+
+	struct Replica {
+		std::string section;
+		std::unique_ptr<MySQLConPool> pool;
+		std::atomic<bool> healthy{ false };
+		std::atomic<long long> lagSec{ -1 };
+	};
+
+	void HealthLoop();
+	void Check(Replica& replica);
+	bool IsSticky(const std::string& uid);
+
+	MySQLConPool& _primary;
+	std::vector<std::unique_ptr<Replica>> _replicas;
+	std::atomic<std::size_t> _next;
+
+	long long _maxLag;
+	std::chrono::seconds _sticky;
+	std::chrono::seconds _checkInterval;
+
+	std::mutex _writeMutex;
+	std::unordered_map<std::string, Clock::time_point> _recentWrites;
+
+	std::mutex _mutex;
+	std::condition_variable _cond;
+	bool _b_stop;
+	std::thread _thread;
+};
@@ -0,0 +1,270 @@
+#include "RouteCache.h"
+#include "ConfigManager.h"
+#include "RedisConPool.h"
+#include "RedisBatcher.h"
+#include "ValueCodec.h"
+#include "Logger.h"
+#include "const.h"
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+#include <nlohmann/json.hpp>
+using json = nlohmann::json;
+
+namespace {
+	// StatusServer's route key, see StatusServer/const.h; both keys end in the {uid} tag
+	constexpr auto STATUS_ROUTE_PREFIX = "status_user:";
+	constexpr auto KEYSPACE_PREFIX = "__keyspace@0__:";
+}
+
+RouteCache::RouteCache() : _version(0), _clearedAt(0), _b_stop(true)
+{
+	auto& cfg = ConfigManager::GetInstance();
+	_ttl = std::chrono::seconds(cfg.getIntValue("RouteCache", "TTL", 5));
+	_maxEntries = static_cast<std::size_t>(cfg.getIntValue("RouteCache", "MaxEntries", 100000));
+	_notifications = cfg.getIntValue("RouteCache", "Notifications", 1) != 0;
+
+	LOG_INFO("Route cache initialized - ttl: {}s, max entries: {}, notifications: {}", _ttl.count(), _maxEntries, _notifications);
+}
+
+RouteCache::~RouteCache()
+{
+	Stop();
+}
+
+std::string RouteCache::GetServer(const std::string& uid)
+{
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		auto iter = _entries.find(uid);
+		if (iter != _entries.end()) {
+			if (iter->second.expiresAt <= Clock::now()) {
+				_entries.erase(iter);
+			}
+			else if (iter->second.valid) {
+				return iter->second.server;
+			}
+		}
+	}
+
+	return Load(uid);
+}
+
+void RouteCache::Set(const std::string& uid, const std::string& serverName)
+{
+	if (_ttl.count() <= 0) {
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(_mutex);
+	Store(uid, serverName, true);
+}
+
+void RouteCache::Invalidate(const std::string& uid)
+{
+	if (_ttl.count() <= 0) {
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(_mutex);
+	Store(uid, "", false);
+}
+
+void RouteCache::Logout(const std::string& uid, const std::string& serverName)
+{
+	auto batcher = RedisBatcher::GetInstance();
+	auto codec = ValueCodec::GetInstance();
+	auto sessionKey = RedisConPool::UserKey(ChatServiceConstant::USER_SESSION_PREFIX, uid);
+	try {
+		auto sessionReply = batcher->Get(sessionKey);
+		auto ttlReply = batcher->Ttl(sessionKey);
+		auto value = sessionReply.get();
+		auto ttl = ttlReply.get();
+
+		json session;
+		if (!value || !codec->Decode(*value, session)) {
+			return;
+		}
+		// a newer login elsewhere has taken the session over
+		if (!session.contains("server_name") || session["server_name"].get<std::string>() != serverName) {
+			return;
+		}
+
+		session["server_name"] = "";
+		batcher->Setex(sessionKey, ttl > 0 ? ttl : codec->TTL(ChatServiceConstant::USER_SESSION_PREFIX), codec->Encode(session)).get();
+		RedisConPool::InvalidateCached(sessionKey);
+	}
+	catch (const sw::redis::Error& e) {
+		LOG_WARN("Failed to clear route of uid {} at logout, other servers rely on the {}s TTL: {}", uid, _ttl.count(), e.what());
+	}
+	catch (const json::exception& e) {
+		LOG_WARN("Malformed session for uid {}: {}", uid, e.what());
+	}
+}
+
+void RouteCache::Start()
+{
+	if (!_notifications || !_b_stop.exchange(false)) {
+		return;
+	}
+
+	// every node publishes events only for the keys it holds
+	for (std::size_t node = 0; node < RedisConPool::NodeCount(); ++node) {
+		EnableNotifications(node);
+		_threads.emplace_back(&RouteCache::SubscribeLoop, this, node);
+	}
+}
+
+void RouteCache::Stop()
+{
+	if (_b_stop.exchange(true)) {
+		return;
+	}
+
+	for (auto& thread : _threads) {
+		if (thread.joinable()) {
+			thread.join();
+		}
+	}
+	_threads.clear();
+}
+
+std::string RouteCache::Load(const std::string& uid)
+{
+	std::uint64_t started;
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		started = _version;
+	}
+
+	std::string server;
+	try {
+		auto key = RedisConPool::UserKey(ChatServiceConstant::USER_SESSION_PREFIX, uid);
+		auto value = RedisConPool::CachedGet(key);
+		json session;
+		if (value && ValueCodec::GetInstance()->Decode(*value, session)) {
+			if (session.contains("server_name")) {
+				server = session["server_name"].get<std::string>();
+			}
+		}
+	}
+	catch (const sw::redis::Error& e) {
+		// Don't cache a failed lookup as "offline"
+		LOG_WARN("Failed to load route for uid {}: {}", uid, e.what());
+		return server;
+	}
+	catch (const json::exception& e) {
+		LOG_WARN("Malformed session for uid {}: {}", uid, e.what());
+		return server;
+	}
+
+	if (_ttl.count() <= 0) {
+		return server;
+	}
+
+	// a Set, Invalidate or clear since the read started knows better
+	std::lock_guard<std::mutex> lock(_mutex);
+	auto iter = _entries.find(uid);
+	if (_clearedAt > started || (iter != _entries.end() && iter->second.version > started)) {
+		return server;
+	}
+	Store(uid, server, true);
+	return server;
+}
+
+void RouteCache::Store(const std::string& uid, const std::string& server, bool valid)
+{
+	if (_entries.size() >= _maxEntries && _entries.find(uid) == _entries.end()) {
+		LOG_DEBUG("Route cache full ({} entries), clearing", _entries.size());
+		Clear();
+	}
+	_entries[uid] = Entry{ server, Clock::now() + _ttl, ++_version, valid };
+}
+
+void RouteCache::Clear()
+{
+	_clearedAt = ++_version;
+	_entries.clear();
+}
+
+void RouteCache::EnableNotifications(std::size_t node)
+{
+	// Keyspace events (K) for generic (g), string ($) and expiry (x) commands,
+	// merged into whatever the server already publishes (A covers g, $ and x)
+	try {
+		auto& redis = RedisConPool::Node(node);
+		std::vector<std::string> current;
+		redis.command("CONFIG", "GET", "notify-keyspace-events", std::back_inserter(current));
+
+		std::string flags = current.size() >= 2 ? current[1] : "";
+		bool changed = false;
+		for (char flag : std::string("Kg$x")) {
+			if (flags.find(flag) == std::string::npos && !(flag != 'K' && flags.find('A') != std::string::npos)) {
+				flags.push_back(flag);
+				changed = true;
+			}
+		}
+		if (changed) {
+			redis.command("CONFIG", "SET", "notify-keyspace-events", flags);
+			LOG_INFO("Enabled keyspace notifications on Redis node {}: {}", node, flags);
+		}
+	}
+	catch (const sw::redis::Error& e) {
+		LOG_WARN("Could not enable keyspace notifications on Redis node {}, routes rely on the {}s TTL: {}", node, _ttl.count(), e.what());
+	}
+}
+
+void RouteCache::SubscribeLoop(std::size_t node)
+{
+	while (!_b_stop) {
+		try {
+			auto subscriber = RedisConPool::Node(node).subscriber();
+			subscriber.on_pmessage([this](std::string, std::string channel, std::string) {
+				OnKeyEvent(channel);
+			});
+			subscriber.psubscribe(std::string(KEYSPACE_PREFIX) + ChatServiceConstant::USER_SESSION_PREFIX + "*");
+			subscriber.psubscribe(std::string(KEYSPACE_PREFIX) + STATUS_ROUTE_PREFIX + "*");
+			LOG_INFO("Route cache subscribed to keyspace notifications of Redis node {}", node);
+
+			while (!_b_stop) {
+				try {
+					subscriber.consume();
+				}
+				catch (const sw::redis::TimeoutError&) {
+					// socket timeout doubles as the stop check interval
+				}
+			}
+		}
+		catch (const sw::redis::Error& e) {
+			// Notifications may have been missed while disconnected
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+				Clear();
+			}
+			LOG_WARN("Route cache subscription to Redis node {} lost: {}, retrying", node, e.what());
+			std::this_thread::sleep_for(std::chrono::seconds(1));
+		}
+	}
+}
+
+void RouteCache::OnKeyEvent(const std::string& channel)
+{
+	auto key = channel.substr(std::min(channel.size(), std::char_traits<char>::length(KEYSPACE_PREFIX)));
+
+	std::string uid;
+	for (std::string prefix : { std::string(ChatServiceConstant::USER_SESSION_PREFIX), std::string(STATUS_ROUTE_PREFIX) }) {
+		if (key.compare(0, prefix.size(), prefix) == 0) {
+			uid = key.substr(prefix.size());
+			// strip the hash tag braces
+			if (uid.size() >= 2 && uid.front() == '{' && uid.back() == '}') {
+				uid = uid.substr(1, uid.size() - 2);
+			}
+			break;
+		}
+	}
+
+	if (!uid.empty()) {
+		Invalidate(uid);
+	}
+}
@@ -0,0 +1,95 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "Singleton.h"
+
+/**
+ * @class RouteCache
+ * @brief Short-TTL map of uid -> name of the ChatServer holding the user's session.
+ *
+ * Misses are filled from the user_session_{<uid>} key in Redis; an empty name
+ * means the user is offline and is cached too. Entries are dropped early when
+ * Redis reports a change to the user's session or StatusServer route key
+ * (keyspace notifications, subscribed on every Redis node), so the TTL only
+ * bounds staleness when notifications are unavailable.
+ *
+ * Every Set and Invalidate stamps the uid with a new version, and a miss only
+ * installs what it read if nothing was stamped while it was reading, so a slow
+ * lookup can't bring back a route that a login or logout already replaced.
+ */
+class RouteCache : public Singleton<RouteCache>
+{
+	friend class Singleton<RouteCache>;
+
+public:
+	~RouteCache();
+
+	/**
+	 * @brief Server the user is logged in on
+	 *
+	 * @param uid
+	 * @return std::string empty if the user is offline or the lookup failed
+	 */
+	std::string GetServer(const std::string& uid);
+
+	void Set(const std::string& uid, const std::string& serverName);
+	void Invalidate(const std::string& uid);
+
+	/**
+	 * @brief Clear server_name in the user's session if it still names serverName
+	 *
+	 * The write reaches the other ChatServers as a keyspace notification, so they
+	 * drop the route at logout instead of at the end of their TTL. Blocks on
+	 * Redis; called on the logic thread.
+	 *
+	 * @param uid
+	 * @param serverName this server
+	 */
+	void Logout(const std::string& uid, const std::string& serverName);
+
+	/**
+	 * @brief Subscribe to keyspace notifications for session and route keys
+	 */
+	void Start();
+	void Stop();
+
+private:
+	using Clock = std::chrono::steady_clock;
+
+	// an invalidated uid keeps its entry until the TTL so its version outlives
+	// lookups still in flight
+	struct Entry {
+		std::string server;
+		Clock::time_point expiresAt;
+		std::uint64_t version;
+		bool valid;
+	};
+
+	RouteCache();
+
+	std::string Load(const std::string& uid);
+	// caller holds _mutex
+	void Store(const std::string& uid, const std::string& server, bool valid);
+	void Clear();
+	void EnableNotifications(std::size_t node);
+	void SubscribeLoop(std::size_t node);
+	void OnKeyEvent(const std::string& channel);
+
+	std::mutex _mutex;
+	std::unordered_map<std::string, Entry> _entries;
+	std::uint64_t _version;
+	// _version when _entries was last cleared; older lookups are dropped
+	std::uint64_t _clearedAt;
+	std::chrono::seconds _ttl;
+	std::size_t _maxEntries;
+	bool _notifications;
+
+	std::atomic<bool> _b_stop;
+	std::vector<std::thread> _threads;
+};
@@ -0,0 +1,100 @@
+#include "SearchCache.h"
+#include "ConfigManager.h"
+#include "Logger.h"
+
+#include <algorithm>
+#include <cctype>
+
+bool SearchCache::Get(const std::string& selfUid, const std::string& pattern, std::vector<std::shared_ptr<SearchInfo>>& out)
+{
+	if (_ttl.count() <= 0) {
+		return false;
+	}
+
+	std::lock_guard<std::mutex> lock(_mutex);
+	auto iter = _entries.find(Key(selfUid, pattern));
+	if (iter == _entries.end()) {
+		return false;
+	}
+	if (iter->second.expiresAt <= Clock::now()) {
+		_entries.erase(iter);
+		return false;
+	}
+
+	out = iter->second.results;
+	return true;
+}
+
+void SearchCache::Put(const std::string& selfUid, const std::string& pattern, const std::vector<std::shared_ptr<SearchInfo>>& results)
+{
+	if (_ttl.count() <= 0 || _maxEntries == 0) {
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(_mutex);
+	if (_entries.size() >= _maxEntries) {
+		// Entries live for seconds; dropping everything is cheaper than tracking LRU order
+		LOG_DEBUG("Search cache full ({} entries), clearing", _entries.size());
+		_entries.clear();
+	}
+	_entries[Key(selfUid, pattern)] = Entry{ results, Clock::now() + _ttl };
+}
+
+SearchCache::Page SearchCache::Slice(const std::vector<std::shared_ptr<SearchInfo>>& results, int page) const
+{
+	Page out;
+	auto total = std::min(results.size(), _maxResults);
+	auto first = static_cast<std::size_t>(page) * _pageSize;
+	if (page < 0 || first >= total) {
+		return out;
+	}
+
+	auto last = std::min(first + _pageSize, total);
+	out.users.assign(results.begin() + first, results.begin() + last);
+	out.hasMore = last < total;
+	return out;
+}
+
+std::size_t SearchCache::GetPageSize() const
+{
+	return _pageSize;
+}
+
+std::size_t SearchCache::GetMaxResults() const
+{
+	return _maxResults;
+}
+
+std::string SearchCache::Normalize(const std::string& pattern)
+{
+	auto begin = pattern.find_first_not_of(" \t");
+	if (begin == std::string::npos) {
+		return std::string();
+	}
+	auto end = pattern.find_last_not_of(" \t");
+
+	std::string normalized = pattern.substr(begin, end - begin + 1);
+	std::transform(normalized.begin(), normalized.end(), normalized.begin(),
+		[](unsigned char ch) {
+			return static_cast<char>(std::tolower(ch));
+		}
+	);
+	return normalized;
+}
+
+SearchCache::SearchCache()
+{
+	auto& cfg = ConfigManager::GetInstance();
+	_ttl = std::chrono::seconds(cfg.getIntValue("SearchCache", "TTL", 10));
+	_maxEntries = static_cast<std::size_t>(cfg.getIntValue("SearchCache", "MaxEntries", 5000));
+	_pageSize = static_cast<std::size_t>(std::max(1, cfg.getIntValue("SearchCache", "PageSize", 10)));
+	_maxResults = static_cast<std::size_t>(std::max(1, cfg.getIntValue("SearchCache", "MaxResults", 50)));
+
+	LOG_INFO("Search cache initialized - ttl: {}s, max entries: {}, page size: {}, max results: {}",
+		_ttl.count(), _maxEntries, _pageSize, _maxResults);
+}
+
+std::string SearchCache::Key(const std::string& selfUid, const std::string& pattern)
+{
+	return selfUid + '\n' + pattern;
+}
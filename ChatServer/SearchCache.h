@@ -0,0 +1,73 @@
+#pragma once
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "Singleton.h"
+#include "UserInfo.h"
+
+/**
+ * @class SearchCache
+ * @brief Short-TTL cache of search results keyed by (self uid, normalized pattern).
+ *
+ * The whole result list (up to MaxResults) is cached once per query and every
+ * page is sliced from it, so paging through a query searches only once.
+ * Only uid, username and avatar are cached. Friend status depends on the
+ * searching user's current relations and is annotated when the page is served.
+ */
+class SearchCache : public Singleton<SearchCache>
+{
+	friend class Singleton<SearchCache>;
+
+public:
+	struct Page {
+		std::vector<std::shared_ptr<SearchInfo>> users;
+		bool hasMore = false;
+	};
+
+	~SearchCache() = default;
+
+	bool Get(const std::string& selfUid, const std::string& pattern, std::vector<std::shared_ptr<SearchInfo>>& out);
+	void Put(const std::string& selfUid, const std::string& pattern, const std::vector<std::shared_ptr<SearchInfo>>& results);
+
+	/**
+	 * @brief Cut a full result list down to one page
+	 *
+	 * @param results at most GetMaxResults() entries are considered
+	 * @param page zero-based
+	 * @return Page
+	 */
+	Page Slice(const std::vector<std::shared_ptr<SearchInfo>>& results, int page) const;
+
+	std::size_t GetPageSize() const;
+	std::size_t GetMaxResults() const;
+
+	/**
+	 * @brief Trim surrounding whitespace and lower-case ASCII letters
+	 *
+	 * @param pattern
+	 * @return std::string
+	 */
+	static std::string Normalize(const std::string& pattern);
+
+private:
+	using Clock = std::chrono::steady_clock;
+
+	struct Entry {
+		std::vector<std::shared_ptr<SearchInfo>> results;
+		Clock::time_point expiresAt;
+	};
+
+	SearchCache();
+
+	static std::string Key(const std::string& selfUid, const std::string& pattern);
+
+	std::mutex _mutex;
+	std::unordered_map<std::string, Entry> _entries;
+	std::chrono::seconds _ttl;
+	std::size_t _maxEntries;
+	std::size_t _pageSize;
+	std::size_t _maxResults;
+};
@@ -0,0 +1,67 @@
+#pragma once
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "Singleton.h"
+#include "MySQLConPool.h"
+#include "ReplicaRouter.h"
+
+/**
+ * @class ShardMap
+ * @brief Which MySQL shard owns a uid, and the pools to reach it.
+ *
+ * Shards are listed in [MySQL] Shards as config section names, in a fixed
+ * order; each gets its own pool and ReplicaRouter. With no shards listed the
+ * [MySQL] primary is the only shard. A uid is placed by jump consistent hash
+ * of its FNV-1a hash, so the mapping is the same in every process and
+ * appending a shard moves only the uids that now belong to it. Reordering or
+ * removing shards remaps everyone and needs a data migration.
+ */
+class ShardMap : public Singleton<ShardMap>
+{
+	friend class Singleton<ShardMap>;
+
+public:
+	~ShardMap() = default;
+
+	std::size_t Count() const;
+
+	std::size_t ShardOf(const std::string& uid) const;
+
+	/**
+	 * @brief Pool of a shard's primary, for writes and logins
+	 */
+	MySQLConPool& Primary(std::size_t shard);
+	MySQLConPool& Primary(const std::string& uid);
+
+	/**
+	 * @brief Replica router of a shard, for reads
+	 */
+	ReplicaRouter& Router(std::size_t shard);
+	ReplicaRouter& Router(const std::string& uid);
+
+	/**
+	 * @brief Group uids by owning shard
+	 *
+	 * @param uids
+	 * @return std::map<std::size_t, std::vector<std::string>> shard -> its uids, in input order
+	 */
+	std::map<std::size_t, std::vector<std::string>> Partition(const std::vector<std::string>& uids) const;
+
+private:
+	struct Shard {
+		std::string section;
+		std::unique_ptr<MySQLConPool> pool;
+		MySQLConPool* primary;
+		std::unique_ptr<ReplicaRouter> router;
+	};
+
+	ShardMap();
+
+	static uint64_t Hash(const std::string& uid);
+	static int32_t JumpHash(uint64_t key, int32_t buckets);
+
+	std::vector<std::unique_ptr<Shard>> _shards;
+};
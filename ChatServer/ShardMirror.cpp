@@ -0,0 +1,101 @@
+#include "ShardMirror.h"
+#include "ConfigManager.h"
+#include "Logger.h"
+
+#include <algorithm>
+
+ShardMirror::ShardMirror() : _b_stop(false)
+{
+	auto& cfg = ConfigManager::GetInstance();
+	_retryDelay = std::chrono::milliseconds(std::max(1, cfg.getIntValue("ShardMirror", "RetryMs", 500)));
+	_maxRetryDelay = std::chrono::milliseconds(std::max(1, cfg.getIntValue("ShardMirror", "MaxRetryMs", 30000)));
+	_maxAttempts = std::max(1, cfg.getIntValue("ShardMirror", "MaxAttempts", 20));
+	_maxQueue = static_cast<std::size_t>(std::max(1, cfg.getIntValue("ShardMirror", "MaxQueue", 10000)));
+
+	_thread = std::thread(&ShardMirror::Run, this);
+}
+
+ShardMirror::~ShardMirror()
+{
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_b_stop = true;
+	}
+	_cond.notify_all();
+	if (_thread.joinable()) {
+		_thread.join();
+	}
+
+	for (const auto& task : _tasks) {
+		LOG_ERROR("Shard mirror abandoned at shutdown: {}", task.what);
+	}
+}
+
+void ShardMirror::Retry(const std::string& what, Step step)
+{
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		if (_tasks.size() >= _maxQueue) {
+			LOG_ERROR("Shard mirror queue is full, dropping: {}", what);
+			return;
+		}
+		_tasks.push_back(Task{ what, std::move(step), 0, _retryDelay, Clock::now() + _retryDelay });
+	}
+	LOG_WARN("Shard mirror queued for retry: {}", what);
+	_cond.notify_one();
+}
+
+std::size_t ShardMirror::Pending()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _tasks.size();
+}
+
+void ShardMirror::Run()
+{
+	std::unique_lock<std::mutex> lock(_mutex);
+	while (!_b_stop) {
+		if (_tasks.empty()) {
+			_cond.wait(lock, [this]() { return _b_stop || !_tasks.empty(); });
+			continue;
+		}
+
+		auto next = std::min_element(_tasks.begin(), _tasks.end(),
+			[](const Task& a, const Task& b) {
+				return a.due < b.due;
+			}
+		);
+		if (next->due > Clock::now()) {
+			// Retry appends, so a task queued meanwhile that is due earlier is the last one
+			auto due = next->due;
+			_cond.wait_until(lock, due, [this, due]() { return _b_stop || _tasks.back().due < due; });
+			continue;
+		}
+
+		Task task = std::move(*next);
+		_tasks.erase(next);
+
+		lock.unlock();
+		bool done = false;
+		try {
+			done = task.step();
+		}
+		catch (const std::exception& e) {
+			LOG_WARN("Shard mirror attempt threw: {} ({})", e.what(), task.what);
+		}
+		lock.lock();
+
+		++task.attempts;
+		if (done) {
+			LOG_INFO("Shard mirror applied after {} retries: {}", task.attempts, task.what);
+		}
+		else if (task.attempts >= _maxAttempts) {
+			LOG_ERROR("Shard mirror gave up after {} retries: {}", task.attempts, task.what);
+		}
+		else {
+			task.delay = std::min(task.delay * 2, _maxRetryDelay);
+			task.due = Clock::now() + task.delay;
+			_tasks.push_back(std::move(task));
+		}
+	}
+}
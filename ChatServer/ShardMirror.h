@@ -0,0 +1,68 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "Singleton.h"
+
+/**
+ * @class ShardMirror
+ * @brief Retries the second step of cross-shard friend writes.
+ *
+ * A friend relation is written to the shard of the user who acted first and
+ * then mirrored to the other user's shard (see MySQLManager). When the mirror
+ * fails it is queued here and retried with exponential backoff, from RetryMs
+ * up to MaxRetryMs, until it succeeds or MaxAttempts is reached. Mirror steps
+ * set absolute state, so running one twice is harmless. The queue lives in
+ * memory only: a mirror still pending when the process exits is lost and is
+ * logged at shutdown for manual repair.
+ */
+class ShardMirror : public Singleton<ShardMirror>
+{
+	friend class Singleton<ShardMirror>;
+
+public:
+	using Step = std::function<bool()>;
+
+	~ShardMirror();
+
+	/**
+	 * @brief Queue a failed mirror step for retry
+	 *
+	 * @param what description for the logs
+	 * @param step returns true once applied
+	 */
+	void Retry(const std::string& what, Step step);
+
+	std::size_t Pending();
+
+private:
+	using Clock = std::chrono::steady_clock;
+
+	struct Task {
+		std::string what;
+		Step step;
+		int attempts;
+		std::chrono::milliseconds delay;
+		Clock::time_point due;
+	};
+
+	ShardMirror();
+
+	void Run();
+
+	std::chrono::milliseconds _retryDelay;
+	std::chrono::milliseconds _maxRetryDelay;
+	int _maxAttempts;
+	std::size_t _maxQueue;
+
+	std::mutex _mutex;
+	std::condition_variable _cond;
+	std::deque<Task> _tasks;
+	std::atomic<bool> _b_stop;
+	std::thread _thread;
+};
@@ -1,131 +1,216 @@
 #include "StatusGrpcClient.h"
 #include "ConfigManager.h"
-#include "Logger.h"
 
-StatusGrpcClient::StatusGrpcClient()
+#include <algorithm>
+
+StatusGrpcClient::StatusGrpcClient() :
+	_next(0)
 {
 	auto& cfg = ConfigManager::GetInstance();
 	std::string host = cfg["StatusServer"]["host"];
 	std::string port = cfg["StatusServer"]["port"];
-	LOG_INFO("StatusGrpcClient init {}:{}", host, port);
-	_pool.reset(new StatusPool(std::thread::hardware_concurrency(), host, port));
+	auto channels = std::max(1, cfg.getIntValue("StatusServer", "Channels", 2));
+	_deadline = std::chrono::milliseconds(std::max(1, cfg.getIntValue("StatusServer", "DeadlineMs", 1000)));
+	LOG_INFO("StatusGrpcClient init {}:{} - channels: {}, deadline: {}ms", host, port, channels, _deadline.count());
+
+	for (int i = 0; i < channels; ++i) {
+		// a local subchannel pool per channel keeps gRPC from folding them onto one connection
+		grpc::ChannelArguments args;
+		args.SetInt(GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL, 1);
+		auto channel = grpc::CreateCustomChannel(host + ":" + port, grpc::InsecureChannelCredentials(), args);
+		_stubs.emplace_back(status::StatusService::NewStub(channel));
+	}
 }
 
-status::OnlineReportResp StatusGrpcClient::ReportOnline(const std::string& uid, const std::string& serverName, const std::string& host, int port, const std::string& token)
+StatusGrpcClient::Stub* StatusGrpcClient::NextStub()
 {
-	grpc::ClientContext ctx;
-	status::OnlineReportReq req;
-	status::OnlineReportResp resp;
+	return _stubs[_next++ % _stubs.size()].get();
+}
+
+status::OnlineReportResp StatusGrpcClient::ReportOnline(const std::string& uid, const std::string& serverName, const std::string& host, int port, const std::string& token,
+	long long generation)
+{
+	return Wait<status::OnlineReportResp>([&](Callback<status::OnlineReportResp> done) {
+		ReportOnlineAsync(uid, serverName, host, port, token, generation, std::move(done));
+	});
+}
+
+status::OfflineReportResp StatusGrpcClient::ReportOffline(const std::string& uid, const std::string& serverName)
+{
+	return Wait<status::OfflineReportResp>([&](Callback<status::OfflineReportResp> done) {
+		ReportOfflineAsync(uid, serverName, std::move(done));
+	});
+}
+
+status::RouteResp StatusGrpcClient::QueryUserRoute(const std::string& uid)
+{
+	return Wait<status::RouteResp>([&](Callback<status::RouteResp> done) {
+		QueryUserRouteAsync(uid, std::move(done));
+	});
+}
+
+status::VerifyTokenResp StatusGrpcClient::VerifyToken(const std::string& uid, const std::string& token, const std::string& serverName)
+{
+	return Wait<status::VerifyTokenResp>([&](Callback<status::VerifyTokenResp> done) {
+		VerifyTokenAsync(uid, token, serverName, std::move(done));
+	});
+}
+
+status::RegisterNodeResp StatusGrpcClient::RegisterNode(const std::string& name, const std::string& host, int port, int rpcPort, int capacity)
+{
+	status::RegisterNodeReq req;
+	req.set_name(name);
+	req.set_server_host(host);
+	req.set_server_port(port);
+	req.set_rpc_port(rpcPort);
+	req.set_capacity(capacity);
+
+	return Wait<status::RegisterNodeResp>([&](Callback<status::RegisterNodeResp> done) {
+		Call<status::RegisterNodeReq, status::RegisterNodeResp>("RegisterNode", std::move(req),
+			[](Stub* stub, grpc::ClientContext* ctx, const status::RegisterNodeReq* req, status::RegisterNodeResp* resp, std::function<void(grpc::Status)> cb) {
+				stub->async()->RegisterNode(ctx, req, resp, std::move(cb));
+			},
+			std::move(done), Executor());
+	});
+}
+
+status::DeregisterNodeResp StatusGrpcClient::DeregisterNode(const std::string& name)
+{
+	status::DeregisterNodeReq req;
+	req.set_name(name);
+
+	return Wait<status::DeregisterNodeResp>([&](Callback<status::DeregisterNodeResp> done) {
+		Call<status::DeregisterNodeReq, status::DeregisterNodeResp>("DeregisterNode", std::move(req),
+			[](Stub* stub, grpc::ClientContext* ctx, const status::DeregisterNodeReq* req, status::DeregisterNodeResp* resp, std::function<void(grpc::Status)> cb) {
+				stub->async()->DeregisterNode(ctx, req, resp, std::move(cb));
+			},
+			std::move(done), Executor());
+	});
+}
+
+status::GetNodesResp StatusGrpcClient::GetNodes()
+{
+	return Wait<status::GetNodesResp>([&](Callback<status::GetNodesResp> done) {
+		Call<status::GetNodesReq, status::GetNodesResp>("GetNodes", status::GetNodesReq(),
+			[](Stub* stub, grpc::ClientContext* ctx, const status::GetNodesReq* req, status::GetNodesResp* resp, std::function<void(grpc::Status)> cb) {
+				stub->async()->GetNodes(ctx, req, resp, std::move(cb));
+			},
+			std::move(done), Executor());
+	});
+}
 
+status::HeartbeatResp StatusGrpcClient::Heartbeat(const std::string& name, const std::string& host, int port, const NodeMetrics& metrics)
+{
+	return Wait<status::HeartbeatResp>([&](Callback<status::HeartbeatResp> done) {
+		HeartbeatAsync(name, host, port, metrics, std::move(done));
+	});
+}
+
+status::KickUserResp StatusGrpcClient::KickUser(const std::string& uid, int reason)
+{
+	return Wait<status::KickUserResp>([&](Callback<status::KickUserResp> done) {
+		KickUserAsync(uid, reason, std::move(done));
+	});
+}
+
+void StatusGrpcClient::ReportOnlineAsync(const std::string& uid, const std::string& serverName, const std::string& host, int port, const std::string& token,
+	long long generation, Callback<status::OnlineReportResp> callback, Executor executor)
+{
+	status::OnlineReportReq req;
 	req.set_uid(uid);
 	req.set_server_name(serverName);
 	req.set_server_host(host);
 	req.set_server_port(port);
 	req.set_token(token);
+	req.set_generation(generation);
 
-	auto stub = _pool->GetConnection();
-	auto status = stub->ReportOnline(&ctx, req, &resp);
-	_pool->ReturnConnection(std::move(stub));
-	if (!status.ok()) {
-		LOG_ERROR("ReportOnline RPC failed: {}", status.error_message());
-		resp.set_error(1);
-	}
-	return resp;
+	Call<status::OnlineReportReq, status::OnlineReportResp>("ReportOnline", std::move(req),
+		[](Stub* stub, grpc::ClientContext* ctx, const status::OnlineReportReq* req, status::OnlineReportResp* resp, std::function<void(grpc::Status)> cb) {
+			stub->async()->ReportOnline(ctx, req, resp, std::move(cb));
+		},
+		std::move(callback), std::move(executor));
 }
 
-status::OfflineReportResp StatusGrpcClient::ReportOffline(const std::string& uid)
+void StatusGrpcClient::ReportOfflineAsync(const std::string& uid, const std::string& serverName, Callback<status::OfflineReportResp> callback, Executor executor)
 {
-	grpc::ClientContext ctx;
 	status::OfflineReportReq req;
-	status::OfflineReportResp resp;
-
 	req.set_uid(uid);
+	req.set_server_name(serverName);
 
-	auto stub = _pool->GetConnection();
-	auto status = stub->ReportOffline(&ctx, req, &resp);
-	_pool->ReturnConnection(std::move(stub));
-	if (!status.ok()) {
-		LOG_ERROR("ReportOffline RPC failed: {}", status.error_message());
-		resp.set_error(1);
-	}
-	return resp;
+	Call<status::OfflineReportReq, status::OfflineReportResp>("ReportOffline", std::move(req),
+		[](Stub* stub, grpc::ClientContext* ctx, const status::OfflineReportReq* req, status::OfflineReportResp* resp, std::function<void(grpc::Status)> cb) {
+			stub->async()->ReportOffline(ctx, req, resp, std::move(cb));
+		},
+		std::move(callback), std::move(executor));
 }
 
-status::RouteResp StatusGrpcClient::QueryUserRoute(const std::string& uid)
+void StatusGrpcClient::QueryUserRouteAsync(const std::string& uid, Callback<status::RouteResp> callback, Executor executor)
 {
-	grpc::ClientContext ctx;
 	status::RouteReq req;
-	status::RouteResp resp;
-
 	req.set_uid(uid);
 
-	auto stub = _pool->GetConnection();
-	auto status = stub->QueryUserRoute(&ctx, req, &resp);
-	_pool->ReturnConnection(std::move(stub));
-	if (!status.ok()) {
-		LOG_ERROR("QueryUserRoute RPC failed: {}", status.error_message());
-		resp.set_error(1);
-		resp.set_online(false);
-	}
-	return resp;
+	Call<status::RouteReq, status::RouteResp>("QueryUserRoute", std::move(req),
+		[](Stub* stub, grpc::ClientContext* ctx, const status::RouteReq* req, status::RouteResp* resp, std::function<void(grpc::Status)> cb) {
+			stub->async()->QueryUserRoute(ctx, req, resp, std::move(cb));
+		},
+		[callback = std::move(callback)](const status::RouteResp& resp) {
+			if (!callback) {
+				return;
+			}
+			if (resp.error() == 0) {
+				callback(resp);
+				return;
+			}
+			auto offline = resp;
+			offline.set_online(false);
+			callback(offline);
+		},
+		std::move(executor));
 }
 
-status::RegisterNodeResp StatusGrpcClient::RegisterNode(const std::string& name, const std::string& host, int port, int capacity)
+void StatusGrpcClient::VerifyTokenAsync(const std::string& uid, const std::string& token, const std::string& serverName,
+	Callback<status::VerifyTokenResp> callback, Executor executor)
 {
-	grpc::ClientContext ctx;
-	status::RegisterNodeReq req;
-	status::RegisterNodeResp resp;
-
-	req.set_name(name);
-	req.set_server_host(host);
-	req.set_server_port(port);
-	req.set_capacity(capacity);
+	status::VerifyTokenReq req;
+	req.set_uid(uid);
+	req.set_token(token);
+	req.set_server_name(serverName);
 
-	auto stub = _pool->GetConnection();
-	auto status = stub->RegisterNode(&ctx, req, &resp);
-	_pool->ReturnConnection(std::move(stub));
-	if (!status.ok()) {
-		LOG_ERROR("RegisterNode RPC failed: {}", status.error_message());
-		resp.set_error(1);
-	}
-	return resp;
+	Call<status::VerifyTokenReq, status::VerifyTokenResp>("VerifyToken", std::move(req),
+		[](Stub* stub, grpc::ClientContext* ctx, const status::VerifyTokenReq* req, status::VerifyTokenResp* resp, std::function<void(grpc::Status)> cb) {
+			stub->async()->VerifyToken(ctx, req, resp, std::move(cb));
+		},
+		std::move(callback), std::move(executor));
 }
 
-status::HeartbeatResp StatusGrpcClient::Heartbeat(const std::string& name, const std::string& host, int port)
+void StatusGrpcClient::HeartbeatAsync(const std::string& name, const std::string& host, int port, const NodeMetrics& metrics,
+	Callback<status::HeartbeatResp> callback, Executor executor)
 {
-	grpc::ClientContext ctx;
 	status::HeartbeatReq req;
-	status::HeartbeatResp resp;
-
 	req.set_name(name);
 	req.set_server_host(host);
 	req.set_server_port(port);
-
-	auto stub = _pool->GetConnection();
-	auto status = stub->Heartbeat(&ctx, req, &resp);
-	_pool->ReturnConnection(std::move(stub));
-	if (!status.ok()) {
-		LOG_ERROR("Heartbeat RPC failed: {}", status.error_message());
-		resp.set_error(1);
-	}
-	return resp;
+	req.set_measured(true);
+	req.set_sessions(metrics.sessions);
+	req.set_queue_depth(metrics.queue_depth);
+	req.set_cpu(metrics.cpu);
+
+	Call<status::HeartbeatReq, status::HeartbeatResp>("Heartbeat", std::move(req),
+		[](Stub* stub, grpc::ClientContext* ctx, const status::HeartbeatReq* req, status::HeartbeatResp* resp, std::function<void(grpc::Status)> cb) {
+			stub->async()->Heartbeat(ctx, req, resp, std::move(cb));
+		},
+		std::move(callback), std::move(executor));
 }
 
-status::KickUserResp StatusGrpcClient::KickUser(const std::string& uid, int reason)
+void StatusGrpcClient::KickUserAsync(const std::string& uid, int reason, Callback<status::KickUserResp> callback, Executor executor)
 {
-	grpc::ClientContext ctx;
 	status::KickUserReq req;
-	status::KickUserResp resp;
-
 	req.set_uid(uid);
 	req.set_reason(reason);
 
-	auto stub = _pool->GetConnection();
-	auto status = stub->KickUser(&ctx, req, &resp);
-	_pool->ReturnConnection(std::move(stub));
-	if (!status.ok()) {
-		LOG_ERROR("KickUser RPC failed: {}", status.error_message());
-		resp.set_error(1);
-	}
-	return resp;
-}
\ No newline at end of file
+	Call<status::KickUserReq, status::KickUserResp>("KickUser", std::move(req),
+		[](Stub* stub, grpc::ClientContext* ctx, const status::KickUserReq* req, status::KickUserResp* resp, std::function<void(grpc::Status)> cb) {
+			stub->async()->KickUser(ctx, req, resp, std::move(cb));
+		},
+		std::move(callback), std::move(executor));
+}
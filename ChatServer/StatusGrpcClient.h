@@ -1,23 +1,48 @@
 #pragma once
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <future>
 #include <memory>
+#include <vector>
+#include <boost/asio.hpp>
 #include <grpcpp/grpcpp.h>
 #include "status.grpc.pb.h"
 #include "Singleton.h"
-#include "GrpcPool.h"
+#include "Logger.h"
 
 #include "const.h"
 
+/**
+ * @brief Load measured on this ChatServer, sent with each heartbeat
+ */
+struct NodeMetrics {
+	int sessions = 0;    // logged-in users
+	int queue_depth = 0; // LogicSystem messages waiting
+	int cpu = 0;         // process CPU, percent of all cores
+};
+
 /**
  * @class StatusGrpcClient
  * @brief gRPC client for communicating with the Status Service.
  * It follows the Singleton pattern.
+ *
+ * Calls go through gRPC's callback API on a fixed set of channels, each
+ * carrying any number of concurrent calls, and every call has a deadline.
+ * The *Async variants never block: the callback runs on the given executor
+ * (usually the session's socket executor) or, without one, on a gRPC thread.
+ * The blocking variants wait for the same call and are meant for startup and
+ * background threads, not the logic thread.
  */
 class StatusGrpcClient : public Singleton<StatusGrpcClient>
 {
-	using StatusPool = GrpcPool<status::StatusService, status::StatusService::Stub>;
 	friend class Singleton<StatusGrpcClient>;
 
 public:
+	template <typename Resp>
+	using Callback = std::function<void(const Resp&)>;
+	using Executor = boost::asio::any_io_executor;
+
 	/**
 	 * @brief Report a user coming online
 	 *
@@ -26,17 +51,20 @@ public:
 	 * @param host
 	 * @param port
 	 * @param token
+	 * @param generation of the user's session, see CSession::GetGeneration
 	 * @return status::OnlineReportResp
 	 */
-	status::OnlineReportResp ReportOnline(const std::string& uid, const std::string& serverName, const std::string& server_host, int server_port, const std::string& token);
+	status::OnlineReportResp ReportOnline(const std::string& uid, const std::string& serverName, const std::string& server_host, int server_port, const std::string& token,
+		long long generation);
 
 	/**
 	 * @brief Report a user going offline
 	 *
 	 * @param uid
+	 * @param serverName this server; the report is dropped if the user's route has moved on
 	 * @return status::OfflineReportResp
 	 */
-	status::OfflineReportResp ReportOffline(const std::string& uid);
+	status::OfflineReportResp ReportOffline(const std::string& uid, const std::string& serverName);
 
 	/**
 	 * @brief Query the route information for a user
@@ -46,16 +74,42 @@ public:
 	 */
 	status::RouteResp QueryUserRoute(const std::string& uid);
 
+	/**
+	 * @brief Have the status server check a login token, without going through Redis
+	 *
+	 * @param uid
+	 * @param token
+	 * @param serverName the node the token was issued for
+	 * @return status::VerifyTokenResp error is set if the RPC failed
+	 */
+	status::VerifyTokenResp VerifyToken(const std::string& uid, const std::string& token, const std::string& serverName);
+
 	/**
 	 * @brief Register a new node with the status server
 	 *
 	 * @param name
 	 * @param host
 	 * @param port
+	 * @param rpc_port port of this node's FriendService
 	 * @param capacity
 	 * @return status::RegisterNodeResp
 	 */
-	status::RegisterNodeResp RegisterNode(const std::string& name, const std::string& server_host, int server_port, int capacity = 10000);
+	status::RegisterNodeResp RegisterNode(const std::string& name, const std::string& server_host, int server_port, int rpc_port, int capacity = 10000);
+
+	/**
+	 * @brief Remove this node from the status server's registry
+	 *
+	 * @param name
+	 * @return status::DeregisterNodeResp
+	 */
+	status::DeregisterNodeResp DeregisterNode(const std::string& name);
+
+	/**
+	 * @brief List the registered ChatServer nodes
+	 *
+	 * @return status::GetNodesResp
+	 */
+	status::GetNodesResp GetNodes();
 
 	/**
 	 * @brief Send a heartbeat signal to the status server
@@ -63,9 +117,10 @@ public:
 	 * @param name
 	 * @param host
 	 * @param port
+	 * @param metrics this node's current load
 	 * @return status::HeartbeatResp
 	 */
-	status::HeartbeatResp Heartbeat(const std::string& name, const std::string& server_host, int server_port);
+	status::HeartbeatResp Heartbeat(const std::string& name, const std::string& server_host, int server_port, const NodeMetrics& metrics);
 
 	/**
 	 * @brief Kick a user from the server
@@ -76,11 +131,82 @@ public:
 	 */
 	status::KickUserResp KickUser(const std::string& uid, int reason);
 
+	void ReportOnlineAsync(const std::string& uid, const std::string& serverName, const std::string& server_host, int server_port, const std::string& token,
+		long long generation, Callback<status::OnlineReportResp> callback, Executor executor = {});
+	void ReportOfflineAsync(const std::string& uid, const std::string& serverName, Callback<status::OfflineReportResp> callback, Executor executor = {});
+	void QueryUserRouteAsync(const std::string& uid, Callback<status::RouteResp> callback, Executor executor = {});
+	void VerifyTokenAsync(const std::string& uid, const std::string& token, const std::string& serverName,
+		Callback<status::VerifyTokenResp> callback, Executor executor = {});
+	void HeartbeatAsync(const std::string& name, const std::string& server_host, int server_port, const NodeMetrics& metrics,
+		Callback<status::HeartbeatResp> callback, Executor executor = {});
+	void KickUserAsync(const std::string& uid, int reason, Callback<status::KickUserResp> callback, Executor executor = {});
+
 private:
+	using Stub = status::StatusService::Stub;
+
+	template <typename Req, typename Resp>
+	struct CallState {
+		grpc::ClientContext context;
+		Req request;
+		Resp response;
+	};
+
 	/**
 	 * @brief Construct a new Status Grpc Client:: Status Grpc Client object
 	 *
 	 */
 	StatusGrpcClient();
-	std::unique_ptr<StatusPool> _pool;
+
+	Stub* NextStub();
+
+	/**
+	 * @brief Start one unary call; on failure the response carries error = 1
+	 *
+	 * @param name rpc name for logging
+	 * @param request
+	 * @param start issues the call on the given stub, e.g. stub->async()->Heartbeat(...)
+	 * @param callback may be empty
+	 * @param executor where callback runs; a gRPC thread when empty
+	 */
+	template <typename Req, typename Resp, typename Start>
+	void Call(const char* name, Req request, Start start, Callback<Resp> callback, Executor executor)
+	{
+		auto call = std::make_shared<CallState<Req, Resp>>();
+		call->request = std::move(request);
+		call->context.set_deadline(std::chrono::system_clock::now() + _deadline);
+
+		start(NextStub(), &call->context, &call->request, &call->response,
+			[call, name, callback = std::move(callback), executor](grpc::Status status) {
+				if (!status.ok()) {
+					LOG_ERROR("{} RPC failed: {}", name, status.error_message());
+					call->response.set_error(1);
+				}
+				if (!callback) {
+					return;
+				}
+				if (executor) {
+					boost::asio::post(executor, [call, callback]() { callback(call->response); });
+				}
+				else {
+					callback(call->response);
+				}
+			}
+		);
+	}
+
+	/**
+	 * @brief Run Call and wait for it; the deadline bounds the wait
+	 */
+	template <typename Resp, typename AsyncCall>
+	static Resp Wait(AsyncCall asyncCall)
+	{
+		auto promise = std::make_shared<std::promise<Resp>>();
+		auto future = promise->get_future();
+		asyncCall([promise](const Resp& resp) { promise->set_value(resp); });
+		return future.get();
+	}
+
+	std::vector<std::unique_ptr<Stub>> _stubs;
+	std::atomic<std::size_t> _next;
+	std::chrono::milliseconds _deadline;
 };
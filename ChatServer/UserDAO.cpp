@@ -3,6 +3,9 @@
 #include "Logger.h"
 #include "Defer.h"
 
+#include <nlohmann/json.hpp>
+using json = nlohmann::json;
+
 bool UserDAO::Insert(const UserInfo& user)
 {
     auto conn = GetConnection();
@@ -11,8 +14,12 @@ bool UserDAO::Insert(const UserInfo& user)
     };
 
     try {
+        if (!conn) {
+            return {};
+        }
+
         LOG_INFO("Inserting user: uid={}, email={}", user._uid, user._email);
-        auto result = conn->sql("CALL sp_insert_user(?, ?, ?, ?, ?, ?, ?, ?, @success)")
+        auto result = conn->sql("CALL sp_insert_user(?, ?, ?, ?, ?, ?, ?, ?)")
             .bind(user._uid)
             .bind(user._email)
             .bind(user._username)
@@ -23,9 +30,7 @@ bool UserDAO::Insert(const UserInfo& user)
             .bind(user._avatar.empty() ? ("./avatars/" + user._uid + ".png") : user._avatar)
             .execute();
 
-        auto statusResult = conn->sql("SELECT @success").execute();
-        auto row = statusResult.fetchOne();
-        bool success = row[0].get<bool>();
+        bool success = IsSuccess(ReadCall(result));
 
         
         if (success) {
@@ -36,6 +41,7 @@ bool UserDAO::Insert(const UserInfo& user)
         return success;
     }
     catch (const mysqlx::Error& error) {
+        MarkSuspect(conn);
         LOG_ERROR("MySQL Error on insert: {} (uid={}, email={})", error.what(), user._uid, user._email);
         return false;
     }
@@ -49,8 +55,12 @@ bool UserDAO::Update(const UserInfo& user)
 	};
 
     try {
+        if (!conn) {
+            return {};
+        }
+
         LOG_INFO("Updating user: uid={}, email={}", user._uid, user._email);
-        auto result = conn->sql("CALL sp_update_user(?, ?, ?, ?, ?, ?, ?, @success)")
+        auto result = conn->sql("CALL sp_update_user(?, ?, ?, ?, ?, ?, ?)")
             .bind(user._uid)
             .bind(user._email)
             .bind(user._password)
@@ -60,9 +70,7 @@ bool UserDAO::Update(const UserInfo& user)
             .bind(user._avatar.empty() ? ("./avatars/" + user._uid + ".png") : user._avatar)
             .execute();
 
-        auto statusResult = conn->sql("SELECT @success").execute();
-        auto row = statusResult.fetchOne();
-        bool success = row[0].get<bool>();
+        bool success = IsSuccess(ReadCall(result));
 
         if (success) {
             LOG_INFO("Update user success: uid={}", user._uid);
@@ -72,6 +80,7 @@ bool UserDAO::Update(const UserInfo& user)
         return success;
     }
     catch (const mysqlx::Error& error) {
+        MarkSuspect(conn);
         LOG_ERROR("MySQL Error on update: {} (uid={}, email={})", error.what(), user._uid, user._email);
         return false;
     }
@@ -85,14 +94,16 @@ bool UserDAO::Delete(const std::string& uid)
 	};
 
     try {
+        if (!conn) {
+            return {};
+        }
+
         LOG_INFO("Deleting user: uid={}", uid);
-        auto result = conn->sql("CALL sp_delete_user(?, @success)")
+        auto result = conn->sql("CALL sp_delete_user(?)")
             .bind(uid)
             .execute();
 
-        auto statusResult = conn->sql("SELECT @success").execute();
-        auto row = statusResult.fetchOne();
-        bool success = row && row[0].get<bool>();
+        bool success = IsSuccess(ReadCall(result));
 
         if (success) {
             LOG_INFO("Delete user success: uid={}", uid);
@@ -102,6 +113,7 @@ bool UserDAO::Delete(const std::string& uid)
         return success;
     }
     catch (const mysqlx::Error& error) {
+        MarkSuspect(conn);
         LOG_ERROR("MySQL Error on delete: {} (uid={})", error.what(), uid);
         return false;
     }
@@ -115,23 +127,26 @@ std::unique_ptr<UserInfo> UserDAO::Search(const std::string& uid)
 	};
 
     try {
+        if (!conn) {
+            return {};
+        }
+
         LOG_INFO("Searching user: uid={}", uid);
-        auto result = conn->sql("CALL sp_search_user(?, ?, @success)")
+        auto result = conn->sql("CALL sp_search_user(?, ?)")
             .bind(uid)
             .bind(ENCRYPTION_KEY)
             .execute();
 
-        auto statusResult = conn->sql("SELECT @success").execute();    
-        auto statusRow = statusResult.fetchOne();
-        bool found = statusRow && statusRow[0].get<bool>();
+        std::vector<mysqlx::Row> rows;
+        bool found = IsSuccess(ReadCall(result, &rows));
 
         if (!found) {
             LOG_WARN("User not found: uid={}", uid);
             return nullptr; // 用户未找到
         }
 
-        auto row = result.fetchOne();
-        if (row) {
+        if (!rows.empty()) {
+            const auto& row = rows.front();
             auto userInfo = std::make_unique<UserInfo>(
                 row[0].get<std::string>(),  // uid
                 row[1].get<std::string>(),  // email
@@ -149,6 +164,7 @@ std::unique_ptr<UserInfo> UserDAO::Search(const std::string& uid)
         return nullptr;
     }
     catch (const mysqlx::Error& error) {
+        MarkSuspect(conn);
         LOG_ERROR("MySQL Error on search: {} (uid={})", error.what(), uid);
         return nullptr;
     }
@@ -162,15 +178,18 @@ bool UserDAO::VerifyUser(const std::string& email, const std::string& password,
 	};
 
     try {
+        if (!conn) {
+            return {};
+        }
+
         LOG_INFO("Verifying user: email={}", email);
-        auto result = conn->sql("CALL sp_verify_user(?,?,?,@out_uid,@success)")
+        auto result = conn->sql("CALL sp_verify_user(?,?,?)")
             .bind(email)
             .bind(password)
             .bind(ENCRYPTION_KEY)
             .execute();
 
-        auto statusResult = conn->sql("SELECT @success, @out_uid").execute();
-        auto row = statusResult.fetchOne();
+        auto row = ReadCall(result);
 
         if (row && row[0].get<bool>()) {
             uid = row[1].get<std::string>();
@@ -182,7 +201,92 @@ bool UserDAO::VerifyUser(const std::string& email, const std::string& password,
         return false;
     }
     catch (const mysqlx::Error& error) {
+        MarkSuspect(conn);
         LOG_ERROR("MySQL Error on verify: {} (email={})", error.what(), email);
         return false;
     }
 }
+
+bool UserDAO::FindUid(const std::string& email, std::string& uid)
+{
+    auto conn = GetConnection();
+	defer{
+	    ReleaseConnection(std::move(conn));
+	};
+
+    try {
+        if (!conn) {
+            return {};
+        }
+
+        auto result = conn->sql("CALL sp_find_uid_by_email(?)")
+            .bind(email)
+            .execute();
+
+        auto row = ReadCall(result);
+
+        if (row && row[0].get<bool>()) {
+            uid = row[1].get<std::string>();
+            return true;
+        }
+        return false;
+    }
+    catch (const mysqlx::Error& error) {
+        MarkSuspect(conn);
+        LOG_ERROR("MySQL Error on find uid: {} (email={})", error.what(), email);
+        return false;
+    }
+}
+
+std::vector<std::unique_ptr<UserInfo>> UserDAO::SearchBatch(const std::vector<std::string>& uids)
+{
+    std::vector<std::unique_ptr<UserInfo>> users;
+    if (uids.empty()) {
+        return users;
+    }
+
+    json uidList = uids;
+
+    auto conn = GetConnection();
+	defer{
+	    ReleaseConnection(std::move(conn));
+	};
+
+    try {
+        if (!conn) {
+            return {};
+        }
+
+        LOG_INFO("Searching users in batch: count={}", uids.size());
+        // sp_search_users joins the JSON array of uids against the user table's
+        // primary key and selects the same columns as sp_search_user, no status row
+        auto result = conn->sql("CALL sp_search_users(?, ?)")
+            .bind(uidList.dump())
+            .bind(ENCRYPTION_KEY)
+            .execute();
+
+        do {
+            if (!result.hasData()) {
+                continue;
+            }
+            for (auto row = result.fetchOne(); row; row = result.fetchOne()) {
+                users.emplace_back(std::make_unique<UserInfo>(
+                    row[0].get<std::string>(),  // uid
+                    row[1].get<std::string>(),  // email
+                    row[2].get<std::string>(),  // name
+                    row[3].get<std::string>(),  // password
+                    row[4].isNull() ? "" : row[4].get<std::string>(), // birth
+                    row[6].isNull() ? "" : row[6].get<std::string>(), // avatar
+                    row[5].isNull() ? "" : row[5].get<std::string>()  // sex
+                ));
+            }
+        } while (result.nextResult());
+
+        LOG_INFO("Batch search finished: requested={}, found={}", uids.size(), users.size());
+    }
+    catch (const mysqlx::Error& error) {
+        MarkSuspect(conn);
+        LOG_ERROR("MySQL Error on batch search: {} (count={})", error.what(), uids.size());
+    }
+    return users;
+}
@@ -6,6 +6,8 @@
 class UserDAO :public BaseDAO<UserInfo>
 {
 public:
+	using BaseDAO<UserInfo>::BaseDAO;
+
 	bool Insert(const UserInfo& user) override;
 	bool Update(const UserInfo& user) override;
 	bool Delete(const std::string& uid) override;
@@ -13,6 +15,12 @@ public:
 
 
 	bool VerifyUser(const std::string& email, const std::string& password, std::string& uid);
+
+	// uid of the user registered with email, without checking a password
+	bool FindUid(const std::string& email, std::string& uid);
+
+	// One round trip for many uids; missing uids are simply absent from the result
+	std::vector<std::unique_ptr<UserInfo>> SearchBatch(const std::vector<std::string>& uids);
 private:
 	const std::string ENCRYPTION_KEY = "printf-secret-key";
 };
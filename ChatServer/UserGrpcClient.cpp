@@ -0,0 +1,35 @@
+#include "UserGrpcClient.h"
+#include "ConfigManager.h"
+#include "Logger.h"
+
+#include <algorithm>
+
+UserGrpcClient::UserGrpcClient()
+{
+	auto& cfg = ConfigManager::GetInstance();
+	std::string host = cfg["UserServer"]["host"];
+	std::string port = cfg["UserServer"]["port"];
+	_deadline = std::chrono::milliseconds(std::max(1, cfg.getIntValue("UserServer", "DeadlineMs", 500)));
+	LOG_INFO("UserGrpcClient init {}:{} - deadline: {}ms", host, port, _deadline.count());
+	_pool.reset(new UserPool(std::thread::hardware_concurrency(), host, port));
+}
+
+user::FuzzySearchUserResp UserGrpcClient::FuzzySearchUser(const std::string& uid, const std::string& pattern)
+{
+	grpc::ClientContext ctx;
+	ctx.set_deadline(std::chrono::system_clock::now() + _deadline);
+	user::FuzzySearchUserReq req;
+	user::FuzzySearchUserResp resp;
+
+	req.set_uid(uid);
+	req.set_pattern(pattern);
+
+	auto stub = _pool->GetConnection();
+	auto status = stub->FuzzySearchUser(&ctx, req, &resp);
+	_pool->ReturnConnection(std::move(stub));
+	if (!status.ok()) {
+		LOG_ERROR("FuzzySearchUser RPC failed: {}", status.error_message());
+		resp.set_error(static_cast<int>(ErrorCodes::RPC_FAILED));
+	}
+	return resp;
+}
@@ -0,0 +1,35 @@
+#pragma once
+#include <chrono>
+#include <memory>
+#include <grpcpp/grpcpp.h>
+#include "user.grpc.pb.h"
+#include "Singleton.h"
+#include "GrpcPool.h"
+
+#include "const.h"
+
+/**
+ * @class UserGrpcClient
+ * @brief gRPC client for the User Service, used for user search.
+ * It follows the Singleton pattern. Calls give up after [UserServer] DeadlineMs.
+ */
+class UserGrpcClient : public Singleton<UserGrpcClient>
+{
+	using UserPool = GrpcPool<user::UserService, user::UserService::Stub>;
+	friend class Singleton<UserGrpcClient>;
+
+public:
+	/**
+	 * @brief Search users by uid, username or email through the UserServer index
+	 *
+	 * @param uid the searching user, excluded from the results
+	 * @param pattern
+	 * @return user::FuzzySearchUserResp error is RPC_FAILED when the call fails
+	 */
+	user::FuzzySearchUserResp FuzzySearchUser(const std::string& uid, const std::string& pattern);
+
+private:
+	UserGrpcClient();
+	std::unique_ptr<UserPool> _pool;
+	std::chrono::milliseconds _deadline;
+};
@@ -0,0 +1,244 @@
+#include "UserInfoCache.h"
+#include "ConfigManager.h"
+#include "RedisConPool.h"
+#include "ValueCodec.h"
+#include "MySQLManager.h"
+#include "NegativeCache.h"
+#include "Logger.h"
+#include "const.h"
+
+#include <iterator>
+#include <map>
+#include <unordered_set>
+#include <nlohmann/json.hpp>
+using json = nlohmann::json;
+
+UserInfoCache::UserInfoMap UserInfoCache::GetUserInfos(const std::vector<std::string>& uids)
+{
+	UserInfoMap found;
+
+	std::vector<std::string> unique;
+	unique.reserve(uids.size());
+	std::unordered_set<std::string> seen;
+	for (const auto& uid : uids) {
+		if (!uid.empty() && seen.insert(uid).second) {
+			unique.push_back(uid);
+		}
+	}
+
+	std::vector<std::string> localMisses;
+	LookupLocal(unique, found, localMisses);
+	if (localMisses.empty()) {
+		return found;
+	}
+
+	std::vector<std::string> redisMisses;
+	LookupRedis(localMisses, found, redisMisses);
+
+	if (!redisMisses.empty()) {
+		LookupMySQL(redisMisses, found);
+	}
+
+	LOG_DEBUG("Hydrated {} users - local hits: {}, redis hits: {}, mysql lookups: {}",
+		unique.size(), unique.size() - localMisses.size(), localMisses.size() - redisMisses.size(), redisMisses.size());
+	return found;
+}
+
+bool UserInfoCache::GetUserInfo(const std::string& uid, std::shared_ptr<UserInfo>& userInfo)
+{
+	auto users = GetUserInfos({ uid });
+	auto iter = users.find(uid);
+	if (iter == users.end()) {
+		return false;
+	}
+
+	userInfo = iter->second;
+	return true;
+}
+
+void UserInfoCache::Invalidate(const std::string& uid)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_entries.erase(uid);
+}
+
+UserInfoCache::UserInfoCache()
+{
+	auto& cfg = ConfigManager::GetInstance();
+	_localTTL = std::chrono::seconds(cfg.getIntValue("UserInfoCache", "LocalTTL", 30));
+	_staleGrace = std::chrono::seconds(cfg.getIntValue("UserInfoCache", "StaleSec", 600));
+	_maxEntries = static_cast<std::size_t>(cfg.getIntValue("UserInfoCache", "MaxEntries", 10000));
+
+	LOG_INFO("User info cache initialized - local ttl: {}s, stale grace: {}s, max entries: {}",
+		_localTTL.count(), _staleGrace.count(), _maxEntries);
+}
+
+void UserInfoCache::LookupLocal(const std::vector<std::string>& uids, UserInfoMap& found, std::vector<std::string>& misses)
+{
+	auto now = Clock::now();
+	std::lock_guard<std::mutex> lock(_mutex);
+	for (const auto& uid : uids) {
+		auto iter = _entries.find(uid);
+		if (iter == _entries.end()) {
+			misses.push_back(uid);
+			continue;
+		}
+		if (iter->second.expiresAt <= now) {
+			// degraded: an outdated profile beats piling onto MySQL
+			if (iter->second.expiresAt + _staleGrace > now
+				&& !RedisConPool::Available(RedisConPool::UserKey(ChatServiceConstant::USER_INFO_PREFIX, uid))) {
+				found[uid] = iter->second.user;
+				continue;
+			}
+			_entries.erase(iter);
+			misses.push_back(uid);
+			continue;
+		}
+		found[uid] = iter->second.user;
+	}
+}
+
+void UserInfoCache::LookupRedis(const std::vector<std::string>& uids, UserInfoMap& found, std::vector<std::string>& misses)
+{
+	std::vector<std::string> keys;
+	keys.reserve(uids.size());
+	for (const auto& uid : uids) {
+		keys.push_back(RedisConPool::UserKey(ChatServiceConstant::USER_INFO_PREFIX, uid));
+	}
+
+	// one MGET per Redis node, for the keys the client-side cache doesn't hold
+	std::vector<sw::redis::OptionalString> values;
+	try {
+		values = RedisConPool::CachedMGet(keys);
+	}
+	catch (const sw::redis::Error& e) {
+		LOG_WARN("MGET of {} user info keys failed: {}", uids.size(), e.what());
+		misses = uids;
+		return;
+	}
+
+	UserInfoMap fromRedis;
+	for (std::size_t i = 0; i < uids.size(); ++i) {
+		const auto& uid = uids[i];
+		std::string value = (i < values.size() && values[i]) ? *values[i] : "";
+
+		if (NegativeCache::GetInstance()->IsUserAbsent(uid, value)) {
+			continue;
+		}
+
+		auto user = value.empty() || value == ChatServiceConstant::USER_TOMBSTONE ? nullptr : Deserialize(value);
+		if (user == nullptr) {
+			misses.push_back(uid);
+			continue;
+		}
+		fromRedis[uid] = user;
+	}
+
+	StoreLocal(fromRedis);
+	found.insert(fromRedis.begin(), fromRedis.end());
+}
+
+void UserInfoCache::LookupMySQL(const std::vector<std::string>& uids, UserInfoMap& found)
+{
+	auto users = MySQLManager::GetInstance()->GetUsers(uids);
+
+	UserInfoMap fromMySQL;
+	for (auto& user : users) {
+		auto uid = user->_uid;
+		fromMySQL[uid] = std::shared_ptr<UserInfo>(std::move(user));
+	}
+
+	try {
+		// one pipeline per Redis node
+		std::map<std::size_t, sw::redis::Pipeline> pipes;
+		auto tombstoneTTL = NegativeCache::GetInstance()->GetUserTTL();
+		auto ttl = ValueCodec::GetInstance()->TTL(ChatServiceConstant::USER_INFO_PREFIX);
+		for (const auto& uid : uids) {
+			auto key = RedisConPool::UserKey(ChatServiceConstant::USER_INFO_PREFIX, uid);
+			if (!RedisConPool::Available(key)) {
+				continue;
+			}
+			auto node = RedisConPool::NodeOf(key);
+			auto pipe = pipes.find(node);
+			if (pipe == pipes.end()) {
+				pipe = pipes.emplace(node, RedisConPool::Node(node).pipeline(false)).first;
+			}
+
+			auto iter = fromMySQL.find(uid);
+			if (iter != fromMySQL.end()) {
+				pipe->second.setex(key, ttl, Serialize(*iter->second));
+			}
+			else if (tombstoneTTL > 0) {
+				LOG_ERROR("No user found in MySQL for uid: {}", uid);
+				pipe->second.setex(key, tombstoneTTL, ChatServiceConstant::USER_TOMBSTONE);
+			}
+		}
+		for (auto& [node, pipe] : pipes) {
+			pipe.exec();
+		}
+		for (const auto& uid : uids) {
+			RedisConPool::InvalidateCached(RedisConPool::UserKey(ChatServiceConstant::USER_INFO_PREFIX, uid));
+		}
+		LOG_INFO("Cached {} user infos and {} tombstones", fromMySQL.size(), uids.size() - fromMySQL.size());
+	}
+	catch (const sw::redis::Error& e) {
+		LOG_WARN("Failed to write back {} user infos: {}", uids.size(), e.what());
+	}
+
+	StoreLocal(fromMySQL);
+	found.insert(fromMySQL.begin(), fromMySQL.end());
+}
+
+void UserInfoCache::StoreLocal(const UserInfoMap& users)
+{
+	if (users.empty() || _maxEntries == 0) {
+		return;
+	}
+
+	auto expiresAt = Clock::now() + _localTTL;
+	std::lock_guard<std::mutex> lock(_mutex);
+	if (_entries.size() + users.size() > _maxEntries) {
+		// Entries are short-lived; dropping everything is cheaper than tracking LRU order
+		LOG_DEBUG("User info cache full ({} entries), clearing", _entries.size());
+		_entries.clear();
+	}
+	for (const auto& [uid, user] : users) {
+		_entries[uid] = Entry{ user, expiresAt };
+	}
+}
+
+std::string UserInfoCache::Serialize(const UserInfo& user)
+{
+	json root;
+	root["uid"] = user._uid;
+	root["username"] = user._username;
+	root["email"] = user._email;
+	root["password"] = user._password;
+	root["birth"] = user._birth;
+	root["avatar"] = user._avatar;
+	root["sex"] = user._sex;
+	return ValueCodec::GetInstance()->Encode(root);
+}
+
+std::shared_ptr<UserInfo> UserInfoCache::Deserialize(const std::string& value)
+{
+	try {
+		json src;
+		if (!ValueCodec::GetInstance()->Decode(value, src)) {
+			return nullptr;
+		}
+		auto user = std::make_shared<UserInfo>();
+		user->_uid = src["uid"].get<std::string>();
+		user->_username = src["username"].get<std::string>();
+		user->_password = src["password"].get<std::string>();
+		user->_avatar = src["avatar"].get<std::string>();
+		user->_birth = src["birth"].get<std::string>();
+		user->_sex = src["sex"].get<std::string>();
+		user->_email = src["email"].get<std::string>();
+		return user;
+	}
+	catch (const json::exception& e) {
+		LOG_WARN("Failed to parse cached user info: {}", e.what());
+		return nullptr;
+	}
+}
@@ -0,0 +1,71 @@
+#pragma once
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "Singleton.h"
+#include "UserInfo.h"
+
+/**
+ * @class UserInfoCache
+ * @brief Resolves user profiles in batches: local cache, then one Redis MGET,
+ * then one MySQL query for whatever is still missing.
+ *
+ * While a uid's Redis node is unavailable (circuit open), expired local
+ * entries are still served for up to StaleSec, so a Redis outage doesn't move
+ * every profile read onto MySQL.
+ */
+class UserInfoCache : public Singleton<UserInfoCache>
+{
+	friend class Singleton<UserInfoCache>;
+
+public:
+	using UserInfoMap = std::unordered_map<std::string, std::shared_ptr<UserInfo>>;
+
+	~UserInfoCache() = default;
+
+	/**
+	 * @brief Resolve profiles for a batch of uids
+	 *
+	 * @param uids duplicates are allowed
+	 * @return uid -> profile for every uid that exists
+	 */
+	UserInfoMap GetUserInfos(const std::vector<std::string>& uids);
+
+	/**
+	 * @brief Single-uid convenience wrapper around GetUserInfos
+	 *
+	 * @param uid
+	 * @param userInfo filled on success
+	 * @return true if the user exists
+	 */
+	bool GetUserInfo(const std::string& uid, std::shared_ptr<UserInfo>& userInfo);
+
+	void Invalidate(const std::string& uid);
+
+private:
+	using Clock = std::chrono::steady_clock;
+
+	struct Entry {
+		std::shared_ptr<UserInfo> user;
+		Clock::time_point expiresAt;
+	};
+
+	UserInfoCache();
+
+	void LookupLocal(const std::vector<std::string>& uids, UserInfoMap& found, std::vector<std::string>& misses);
+	void LookupRedis(const std::vector<std::string>& uids, UserInfoMap& found, std::vector<std::string>& misses);
+	void LookupMySQL(const std::vector<std::string>& uids, UserInfoMap& found);
+	void StoreLocal(const UserInfoMap& users);
+
+	static std::string Serialize(const UserInfo& user);
+	static std::shared_ptr<UserInfo> Deserialize(const std::string& value);
+
+	std::mutex _mutex;
+	std::unordered_map<std::string, Entry> _entries;
+	std::chrono::seconds _localTTL;
+	std::chrono::seconds _staleGrace;
+	std::size_t _maxEntries;
+};
@@ -23,12 +23,21 @@ void UserManager::setUserSession(std::string uid, std::shared_ptr<CSession> sess
 	_uidToSession[uid] = session;
 }
 
-void UserManager::removeUserSession(std::string sessionId)
+bool UserManager::removeUserSession(std::string uid, std::shared_ptr<CSession> session)
 {
-	{
-		std::lock_guard<std::mutex> lock(_mutex);
-		_uidToSession.erase(sessionId);
+	std::lock_guard<std::mutex> lock(_mutex);
+	auto iter = _uidToSession.find(uid);
+	if (iter == _uidToSession.end() || iter->second != session) {
+		return false;
 	}
+	_uidToSession.erase(iter);
+	return true;
+}
+
+std::size_t UserManager::Count()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _uidToSession.size();
 }
 
 UserManager::UserManager()
@@ -12,7 +12,14 @@ public:
 	~UserManager();
 	std::shared_ptr<CSession> GetSession(std::string uid);
 	void setUserSession(std::string uid, std::shared_ptr<CSession> session);
-	void removeUserSession(std::string sessionId);
+	/**
+	 * @brief Drop uid's entry if it still belongs to session
+	 *
+	 * @return false when a newer login of uid (or none) holds the entry
+	 */
+	bool removeUserSession(std::string uid, std::shared_ptr<CSession> session);
+	// logged-in users on this server
+	std::size_t Count();
 
 private:
 	UserManager();
@@ -0,0 +1,128 @@
+// Generated by the gRPC C++ plugin.
+// If you make any local change, they will be lost.
+// source: chat.proto
+
+#include "chat.pb.h"
+#include "chat.grpc.pb.h"
+
+#include <functional>
+#include <grpcpp/support/async_stream.h>
+#include <grpcpp/support/async_unary_call.h>
+#include <grpcpp/impl/channel_interface.h>
+#include <grpcpp/impl/client_unary_call.h>
+#include <grpcpp/support/client_callback.h>
+#include <grpcpp/support/message_allocator.h>
+#include <grpcpp/support/method_handler.h>
+#include <grpcpp/impl/rpc_service_method.h>
+#include <grpcpp/support/server_callback.h>
+#include <grpcpp/impl/server_callback_handlers.h>
+#include <grpcpp/server_context.h>
+#include <grpcpp/impl/service_type.h>
+#include <grpcpp/support/sync_stream.h>
+namespace chat {
+
+static const char* ChatService_method_names[] = {
+  "/chat.ChatService/KickUser",
+  "/chat.ChatService/KickUsers",
+};
+
+std::unique_ptr< ChatService::Stub> ChatService::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
+  (void)options;
+  std::unique_ptr< ChatService::Stub> stub(new ChatService::Stub(channel, options));
+  return stub;
+}
+
+ChatService::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options)
+  : channel_(channel), rpcmethod_KickUser_(ChatService_method_names[0], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_KickUsers_(ChatService_method_names[1], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  {}
+
+::grpc::Status ChatService::Stub::KickUser(::grpc::ClientContext* context, const ::chat::KickUserReq& request, ::chat::KickUserResp* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::chat::KickUserReq, ::chat::KickUserResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_KickUser_, context, request, response);
+}
+
+void ChatService::Stub::async::KickUser(::grpc::ClientContext* context, const ::chat::KickUserReq* request, ::chat::KickUserResp* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::chat::KickUserReq, ::chat::KickUserResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_KickUser_, context, request, response, std::move(f));
+}
+
+void ChatService::Stub::async::KickUser(::grpc::ClientContext* context, const ::chat::KickUserReq* request, ::chat::KickUserResp* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_KickUser_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::chat::KickUserResp>* ChatService::Stub::PrepareAsyncKickUserRaw(::grpc::ClientContext* context, const ::chat::KickUserReq& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::chat::KickUserResp, ::chat::KickUserReq, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_KickUser_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::chat::KickUserResp>* ChatService::Stub::AsyncKickUserRaw(::grpc::ClientContext* context, const ::chat::KickUserReq& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncKickUserRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status ChatService::Stub::KickUsers(::grpc::ClientContext* context, const ::chat::KickUsersReq& request, ::chat::KickUsersResp* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::chat::KickUsersReq, ::chat::KickUsersResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_KickUsers_, context, request, response);
+}
+
+void ChatService::Stub::async::KickUsers(::grpc::ClientContext* context, const ::chat::KickUsersReq* request, ::chat::KickUsersResp* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::chat::KickUsersReq, ::chat::KickUsersResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_KickUsers_, context, request, response, std::move(f));
+}
+
+void ChatService::Stub::async::KickUsers(::grpc::ClientContext* context, const ::chat::KickUsersReq* request, ::chat::KickUsersResp* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_KickUsers_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::chat::KickUsersResp>* ChatService::Stub::PrepareAsyncKickUsersRaw(::grpc::ClientContext* context, const ::chat::KickUsersReq& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::chat::KickUsersResp, ::chat::KickUsersReq, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_KickUsers_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::chat::KickUsersResp>* ChatService::Stub::AsyncKickUsersRaw(::grpc::ClientContext* context, const ::chat::KickUsersReq& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncKickUsersRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+ChatService::Service::Service() {
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      ChatService_method_names[0],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< ChatService::Service, ::chat::KickUserReq, ::chat::KickUserResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](ChatService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::chat::KickUserReq* req,
+             ::chat::KickUserResp* resp) {
+               return service->KickUser(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      ChatService_method_names[1],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< ChatService::Service, ::chat::KickUsersReq, ::chat::KickUsersResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](ChatService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::chat::KickUsersReq* req,
+             ::chat::KickUsersResp* resp) {
+               return service->KickUsers(ctx, req, resp);
+             }, this)));
+}
+
+ChatService::Service::~Service() {
+}
+
+::grpc::Status ChatService::Service::KickUser(::grpc::ServerContext* context, const ::chat::KickUserReq* request, ::chat::KickUserResp* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status ChatService::Service::KickUsers(::grpc::ServerContext* context, const ::chat::KickUsersReq* request, ::chat::KickUsersResp* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+
+}  // namespace chat
+
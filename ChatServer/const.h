@@ -17,8 +17,13 @@ namespace ChatServiceConstant {
 	constexpr auto LOGIN_COUNT = "login_count";
 	constexpr auto USER_SESSION_PREFIX = "user_session_";
 	constexpr auto USER_INFO_PREFIX = "user_info_";
-	constexpr auto USER_FRIEND_STATUS = "user_friend_status_";
 	constexpr auto FRIEND_REQUEST_PREFIX = "friend_request_";
+	constexpr auto SEARCH_EMPTY_PREFIX = "search_empty_";
+	// bumped by UserServer on every registration; part of each search tombstone's key
+	constexpr auto SEARCH_EMPTY_VERSION = "search_empty_version";
+	constexpr auto USER_TOMBSTONE = "__absent__";
+	constexpr auto OFFLINE_INBOX_PREFIX = "inbox_";
+	constexpr auto OFFLINE_INBOX_VALID_PREFIX = "inbox_valid_";
 }
 
 enum class ErrorCodes
@@ -28,6 +33,7 @@ enum class ErrorCodes
 	RPC_FAILED = 1002,
 	UID_INVALID = 1003,
 	TOKEN_INVALID = 1004,
+	NODE_NOT_FOUND = 1006, // StatusServer has no registration for this server
 };
 
 
@@ -47,6 +53,8 @@ enum class MessageID {
 	MESSAGE_APPROVAL_FRIEND_RESPONSE = 1014,
 
 	MESSAGE_NOTIFY_APPROVAL_FRIEND = 1015,
+
+	MESSAGE_NOTIFY_KICK_USER = 1016,
 };
 
 enum class AddStatusCodes {
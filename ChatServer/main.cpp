@@ -3,6 +3,9 @@
 #include "IOContextPool.h"
 #include "CServer.h"
 #include "FriendServerImpl.h"
+#include "ChatServiceImpl.h"
+#include "PeerDiscovery.h"
+#include "RouteCache.h"
 #include "RedisConPool.h"
 #include "const.h"
 #include "Logger.h"
@@ -16,7 +19,7 @@ int main() {
 		LOG_INFO("Starting {} server...", serverName);
 
 		LOG_DEBUG("Initializing Redis connection pool");
-		RedisConPool::GetInstance().hset(ChatServiceConstant::LOGIN_COUNT,serverName,"0");
+		RedisConPool::ForKey(ChatServiceConstant::LOGIN_COUNT).hset(ChatServiceConstant::LOGIN_COUNT,serverName,"0");
 		LOG_DEBUG("Redis login count initialized for server: {}", serverName);
 
 		LOG_DEBUG("Initializing IO Context Pool");
@@ -27,9 +30,11 @@ int main() {
 
 
 		FriendServerImpl service;
+		ChatServiceImpl chatService;
 		grpc::ServerBuilder builder;
 		builder.AddListeningPort(addr, grpc::InsecureServerCredentials());
 		builder.RegisterService(&service);
+		builder.RegisterService(&chatService);
 
 		std::unique_ptr<grpc::Server> grpcServer(builder.BuildAndStart());
 		LOG_INFO("gRPC Chat Server listening on {}", addr);
@@ -40,12 +45,18 @@ int main() {
 			grpcServer->Wait();
 		});
 
+		LOG_DEBUG("Registering with StatusServer and starting peer discovery");
+		PeerDiscovery::GetInstance()->Start();
+		RouteCache::GetInstance()->Start();
+
 
 		boost::asio::io_context ioc;
 		boost::asio::signal_set signals(ioc, SIGINT, SIGTERM);
 		signals.async_wait([&ioc, pool,&grpcServer](auto, auto) {
 			LOG_INFO("Shutdown signal received, initiating graceful shutdown");
 			ioc.stop();
+			PeerDiscovery::GetInstance()->Stop();
+			RouteCache::GetInstance()->Stop();
 			pool->Stop();
 			grpcServer->Shutdown();
 			LOG_INFO("Server shutdown completed");
@@ -59,7 +70,7 @@ int main() {
 		ioc.run();
 
 		LOG_INFO("Cleaning up server resources");
-		RedisConPool::GetInstance().hdel(ChatServiceConstant::LOGIN_COUNT, serverName);
+		RedisConPool::ForKey(ChatServiceConstant::LOGIN_COUNT).hdel(ChatServiceConstant::LOGIN_COUNT, serverName);
 		if (grpcServerThread.joinable()) {
 			grpcServerThread.join();
 		}
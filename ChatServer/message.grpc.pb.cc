@@ -0,0 +1,326 @@
+// Generated by the gRPC C++ plugin.
+// If you make any local change, they will be lost.
+// source: message.proto
+
+#include "message.pb.h"
+#include "message.grpc.pb.h"
+
+#include <functional>
+#include <grpcpp/support/async_stream.h>
+#include <grpcpp/support/async_unary_call.h>
+#include <grpcpp/impl/channel_interface.h>
+#include <grpcpp/impl/client_unary_call.h>
+#include <grpcpp/support/client_callback.h>
+#include <grpcpp/support/message_allocator.h>
+#include <grpcpp/support/method_handler.h>
+#include <grpcpp/impl/rpc_service_method.h>
+#include <grpcpp/support/server_callback.h>
+#include <grpcpp/impl/server_callback_handlers.h>
+#include <grpcpp/server_context.h>
+#include <grpcpp/impl/service_type.h>
+#include <grpcpp/support/sync_stream.h>
+namespace message {
+
+static const char* VerifyService_method_names[] = {
+  "/message.VerifyService/GetVerifyCode",
+};
+
+std::unique_ptr< VerifyService::Stub> VerifyService::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
+  (void)options;
+  std::unique_ptr< VerifyService::Stub> stub(new VerifyService::Stub(channel, options));
+  return stub;
+}
+
+VerifyService::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options)
+  : channel_(channel), rpcmethod_GetVerifyCode_(VerifyService_method_names[0], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  {}
+
+::grpc::Status VerifyService::Stub::GetVerifyCode(::grpc::ClientContext* context, const ::message::GetVerifyRequest& request, ::message::GetVerifyResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::message::GetVerifyRequest, ::message::GetVerifyResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_GetVerifyCode_, context, request, response);
+}
+
+void VerifyService::Stub::async::GetVerifyCode(::grpc::ClientContext* context, const ::message::GetVerifyRequest* request, ::message::GetVerifyResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::message::GetVerifyRequest, ::message::GetVerifyResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetVerifyCode_, context, request, response, std::move(f));
+}
+
+void VerifyService::Stub::async::GetVerifyCode(::grpc::ClientContext* context, const ::message::GetVerifyRequest* request, ::message::GetVerifyResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetVerifyCode_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::message::GetVerifyResponse>* VerifyService::Stub::PrepareAsyncGetVerifyCodeRaw(::grpc::ClientContext* context, const ::message::GetVerifyRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::message::GetVerifyResponse, ::message::GetVerifyRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_GetVerifyCode_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::message::GetVerifyResponse>* VerifyService::Stub::AsyncGetVerifyCodeRaw(::grpc::ClientContext* context, const ::message::GetVerifyRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncGetVerifyCodeRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+VerifyService::Service::Service() {
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      VerifyService_method_names[0],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< VerifyService::Service, ::message::GetVerifyRequest, ::message::GetVerifyResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](VerifyService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::message::GetVerifyRequest* req,
+             ::message::GetVerifyResponse* resp) {
+               return service->GetVerifyCode(ctx, req, resp);
+             }, this)));
+}
+
+VerifyService::Service::~Service() {
+}
+
+::grpc::Status VerifyService::Service::GetVerifyCode(::grpc::ServerContext* context, const ::message::GetVerifyRequest* request, ::message::GetVerifyResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+
+static const char* StatusService_method_names[] = {
+  "/message.StatusService/GetChatServer",
+  "/message.StatusService/Login",
+};
+
+std::unique_ptr< StatusService::Stub> StatusService::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
+  (void)options;
+  std::unique_ptr< StatusService::Stub> stub(new StatusService::Stub(channel, options));
+  return stub;
+}
+
+StatusService::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options)
+  : channel_(channel), rpcmethod_GetChatServer_(StatusService_method_names[0], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_Login_(StatusService_method_names[1], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  {}
+
+::grpc::Status StatusService::Stub::GetChatServer(::grpc::ClientContext* context, const ::message::GetChatServerRequest& request, ::message::GetChatServerResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::message::GetChatServerRequest, ::message::GetChatServerResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_GetChatServer_, context, request, response);
+}
+
+void StatusService::Stub::async::GetChatServer(::grpc::ClientContext* context, const ::message::GetChatServerRequest* request, ::message::GetChatServerResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::message::GetChatServerRequest, ::message::GetChatServerResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetChatServer_, context, request, response, std::move(f));
+}
+
+void StatusService::Stub::async::GetChatServer(::grpc::ClientContext* context, const ::message::GetChatServerRequest* request, ::message::GetChatServerResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetChatServer_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::message::GetChatServerResponse>* StatusService::Stub::PrepareAsyncGetChatServerRaw(::grpc::ClientContext* context, const ::message::GetChatServerRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::message::GetChatServerResponse, ::message::GetChatServerRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_GetChatServer_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::message::GetChatServerResponse>* StatusService::Stub::AsyncGetChatServerRaw(::grpc::ClientContext* context, const ::message::GetChatServerRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncGetChatServerRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status StatusService::Stub::Login(::grpc::ClientContext* context, const ::message::LoginRequest& request, ::message::LoginResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::message::LoginRequest, ::message::LoginResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_Login_, context, request, response);
+}
+
+void StatusService::Stub::async::Login(::grpc::ClientContext* context, const ::message::LoginRequest* request, ::message::LoginResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::message::LoginRequest, ::message::LoginResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_Login_, context, request, response, std::move(f));
+}
+
+void StatusService::Stub::async::Login(::grpc::ClientContext* context, const ::message::LoginRequest* request, ::message::LoginResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_Login_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::message::LoginResponse>* StatusService::Stub::PrepareAsyncLoginRaw(::grpc::ClientContext* context, const ::message::LoginRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::message::LoginResponse, ::message::LoginRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_Login_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::message::LoginResponse>* StatusService::Stub::AsyncLoginRaw(::grpc::ClientContext* context, const ::message::LoginRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncLoginRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+StatusService::Service::Service() {
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      StatusService_method_names[0],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< StatusService::Service, ::message::GetChatServerRequest, ::message::GetChatServerResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](StatusService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::message::GetChatServerRequest* req,
+             ::message::GetChatServerResponse* resp) {
+               return service->GetChatServer(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      StatusService_method_names[1],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< StatusService::Service, ::message::LoginRequest, ::message::LoginResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](StatusService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::message::LoginRequest* req,
+             ::message::LoginResponse* resp) {
+               return service->Login(ctx, req, resp);
+             }, this)));
+}
+
+StatusService::Service::~Service() {
+}
+
+::grpc::Status StatusService::Service::GetChatServer(::grpc::ServerContext* context, const ::message::GetChatServerRequest* request, ::message::GetChatServerResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status StatusService::Service::Login(::grpc::ServerContext* context, const ::message::LoginRequest* request, ::message::LoginResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+
+static const char* FriendService_method_names[] = {
+  "/message.FriendService/SendFriend",
+  "/message.FriendService/HandleFriend",
+  "/message.FriendService/NotifyStream",
+};
+
+std::unique_ptr< FriendService::Stub> FriendService::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
+  (void)options;
+  std::unique_ptr< FriendService::Stub> stub(new FriendService::Stub(channel, options));
+  return stub;
+}
+
+FriendService::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options)
+  : channel_(channel), rpcmethod_SendFriend_(FriendService_method_names[0], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_HandleFriend_(FriendService_method_names[1], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_NotifyStream_(FriendService_method_names[2], options.suffix_for_stats(),::grpc::internal::RpcMethod::BIDI_STREAMING, channel)
+  {}
+
+::grpc::Status FriendService::Stub::SendFriend(::grpc::ClientContext* context, const ::message::FriendRequest& request, ::message::FriendResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::message::FriendRequest, ::message::FriendResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_SendFriend_, context, request, response);
+}
+
+void FriendService::Stub::async::SendFriend(::grpc::ClientContext* context, const ::message::FriendRequest* request, ::message::FriendResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::message::FriendRequest, ::message::FriendResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SendFriend_, context, request, response, std::move(f));
+}
+
+void FriendService::Stub::async::SendFriend(::grpc::ClientContext* context, const ::message::FriendRequest* request, ::message::FriendResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SendFriend_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::message::FriendResponse>* FriendService::Stub::PrepareAsyncSendFriendRaw(::grpc::ClientContext* context, const ::message::FriendRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::message::FriendResponse, ::message::FriendRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_SendFriend_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::message::FriendResponse>* FriendService::Stub::AsyncSendFriendRaw(::grpc::ClientContext* context, const ::message::FriendRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncSendFriendRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status FriendService::Stub::HandleFriend(::grpc::ClientContext* context, const ::message::FriendApprovalRequest& request, ::message::FriendApprovalResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::message::FriendApprovalRequest, ::message::FriendApprovalResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_HandleFriend_, context, request, response);
+}
+
+void FriendService::Stub::async::HandleFriend(::grpc::ClientContext* context, const ::message::FriendApprovalRequest* request, ::message::FriendApprovalResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::message::FriendApprovalRequest, ::message::FriendApprovalResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_HandleFriend_, context, request, response, std::move(f));
+}
+
+void FriendService::Stub::async::HandleFriend(::grpc::ClientContext* context, const ::message::FriendApprovalRequest* request, ::message::FriendApprovalResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_HandleFriend_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::message::FriendApprovalResponse>* FriendService::Stub::PrepareAsyncHandleFriendRaw(::grpc::ClientContext* context, const ::message::FriendApprovalRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::message::FriendApprovalResponse, ::message::FriendApprovalRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_HandleFriend_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::message::FriendApprovalResponse>* FriendService::Stub::AsyncHandleFriendRaw(::grpc::ClientContext* context, const ::message::FriendApprovalRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncHandleFriendRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::ClientReaderWriter< ::message::NotifyBatch, ::message::NotifyAck>* FriendService::Stub::NotifyStreamRaw(::grpc::ClientContext* context) {
+  return ::grpc::internal::ClientReaderWriterFactory< ::message::NotifyBatch, ::message::NotifyAck>::Create(channel_.get(), rpcmethod_NotifyStream_, context);
+}
+
+void FriendService::Stub::async::NotifyStream(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::message::NotifyBatch,::message::NotifyAck>* reactor) {
+  ::grpc::internal::ClientCallbackReaderWriterFactory< ::message::NotifyBatch,::message::NotifyAck>::Create(stub_->channel_.get(), stub_->rpcmethod_NotifyStream_, context, reactor);
+}
+
+::grpc::ClientAsyncReaderWriter< ::message::NotifyBatch, ::message::NotifyAck>* FriendService::Stub::AsyncNotifyStreamRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderWriterFactory< ::message::NotifyBatch, ::message::NotifyAck>::Create(channel_.get(), cq, rpcmethod_NotifyStream_, context, true, tag);
+}
+
+::grpc::ClientAsyncReaderWriter< ::message::NotifyBatch, ::message::NotifyAck>* FriendService::Stub::PrepareAsyncNotifyStreamRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderWriterFactory< ::message::NotifyBatch, ::message::NotifyAck>::Create(channel_.get(), cq, rpcmethod_NotifyStream_, context, false, nullptr);
+}
+
+FriendService::Service::Service() {
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      FriendService_method_names[0],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< FriendService::Service, ::message::FriendRequest, ::message::FriendResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](FriendService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::message::FriendRequest* req,
+             ::message::FriendResponse* resp) {
+               return service->SendFriend(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      FriendService_method_names[1],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< FriendService::Service, ::message::FriendApprovalRequest, ::message::FriendApprovalResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](FriendService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::message::FriendApprovalRequest* req,
+             ::message::FriendApprovalResponse* resp) {
+               return service->HandleFriend(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      FriendService_method_names[2],
+      ::grpc::internal::RpcMethod::BIDI_STREAMING,
+      new ::grpc::internal::BidiStreamingHandler< FriendService::Service, ::message::NotifyBatch, ::message::NotifyAck>(
+          [](FriendService::Service* service,
+             ::grpc::ServerContext* ctx,
+             ::grpc::ServerReaderWriter<::message::NotifyAck,
+             ::message::NotifyBatch>* stream) {
+               return service->NotifyStream(ctx, stream);
+             }, this)));
+}
+
+FriendService::Service::~Service() {
+}
+
+::grpc::Status FriendService::Service::SendFriend(::grpc::ServerContext* context, const ::message::FriendRequest* request, ::message::FriendResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status FriendService::Service::HandleFriend(::grpc::ServerContext* context, const ::message::FriendApprovalRequest* request, ::message::FriendApprovalResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status FriendService::Service::NotifyStream(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::message::NotifyAck, ::message::NotifyBatch>* stream) {
+  (void) context;
+  (void) stream;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+
+}  // namespace message
+
@@ -0,0 +1,4779 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// NO CHECKED-IN PROTOBUF GENCODE
+// source: message.proto
+// Protobuf C++ Version: 5.29.3
+
+#ifndef message_2eproto_2epb_2eh
+#define message_2eproto_2epb_2eh
+
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "google/protobuf/runtime_version.h"
+#if PROTOBUF_VERSION != 5029003
+#error "Protobuf C++ gencode is built with an incompatible version of"
+#error "Protobuf C++ headers/runtime. See"
+#error "https://protobuf.dev/support/cross-version-runtime-guarantee/#cpp"
+#endif
+#include "google/protobuf/io/coded_stream.h"
+#include "google/protobuf/arena.h"
+#include "google/protobuf/arenastring.h"
+#include "google/protobuf/generated_message_tctable_decl.h"
+#include "google/protobuf/generated_message_util.h"
+#include "google/protobuf/metadata_lite.h"
+#include "google/protobuf/generated_message_reflection.h"
+#include "google/protobuf/message.h"
+#include "google/protobuf/message_lite.h"
+#include "google/protobuf/repeated_field.h"  // IWYU pragma: export
+#include "google/protobuf/extension_set.h"  // IWYU pragma: export
+#include "google/protobuf/unknown_field_set.h"
+// @@protoc_insertion_point(includes)
+
+// Must be included last.
+#include "google/protobuf/port_def.inc"
+
+#define PROTOBUF_INTERNAL_EXPORT_message_2eproto
+
+namespace google {
+namespace protobuf {
+namespace internal {
+template <typename T>
+::absl::string_view GetAnyMessageName();
+}  // namespace internal
+}  // namespace protobuf
+}  // namespace google
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_message_2eproto {
+  static const ::uint32_t offsets[];
+};
+extern const ::google::protobuf::internal::DescriptorTable
+    descriptor_table_message_2eproto;
+namespace message {
+class FriendApprovalRequest;
+struct FriendApprovalRequestDefaultTypeInternal;
+extern FriendApprovalRequestDefaultTypeInternal _FriendApprovalRequest_default_instance_;
+class FriendApprovalResponse;
+struct FriendApprovalResponseDefaultTypeInternal;
+extern FriendApprovalResponseDefaultTypeInternal _FriendApprovalResponse_default_instance_;
+class FriendRequest;
+struct FriendRequestDefaultTypeInternal;
+extern FriendRequestDefaultTypeInternal _FriendRequest_default_instance_;
+class FriendResponse;
+struct FriendResponseDefaultTypeInternal;
+extern FriendResponseDefaultTypeInternal _FriendResponse_default_instance_;
+class GetChatServerRequest;
+struct GetChatServerRequestDefaultTypeInternal;
+extern GetChatServerRequestDefaultTypeInternal _GetChatServerRequest_default_instance_;
+class GetChatServerResponse;
+struct GetChatServerResponseDefaultTypeInternal;
+extern GetChatServerResponseDefaultTypeInternal _GetChatServerResponse_default_instance_;
+class GetVerifyRequest;
+struct GetVerifyRequestDefaultTypeInternal;
+extern GetVerifyRequestDefaultTypeInternal _GetVerifyRequest_default_instance_;
+class GetVerifyResponse;
+struct GetVerifyResponseDefaultTypeInternal;
+extern GetVerifyResponseDefaultTypeInternal _GetVerifyResponse_default_instance_;
+class LoginRequest;
+struct LoginRequestDefaultTypeInternal;
+extern LoginRequestDefaultTypeInternal _LoginRequest_default_instance_;
+class LoginResponse;
+struct LoginResponseDefaultTypeInternal;
+extern LoginResponseDefaultTypeInternal _LoginResponse_default_instance_;
+class NotifyAck;
+struct NotifyAckDefaultTypeInternal;
+extern NotifyAckDefaultTypeInternal _NotifyAck_default_instance_;
+class NotifyBatch;
+struct NotifyBatchDefaultTypeInternal;
+extern NotifyBatchDefaultTypeInternal _NotifyBatch_default_instance_;
+class NotifyFrame;
+struct NotifyFrameDefaultTypeInternal;
+extern NotifyFrameDefaultTypeInternal _NotifyFrame_default_instance_;
+}  // namespace message
+namespace google {
+namespace protobuf {
+}  // namespace protobuf
+}  // namespace google
+
+namespace message {
+
+// ===================================================================
+
+
+// -------------------------------------------------------------------
+
+class NotifyAck final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:message.NotifyAck) */ {
+ public:
+  inline NotifyAck() : NotifyAck(nullptr) {}
+  ~NotifyAck() PROTOBUF_FINAL;
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+  void operator delete(NotifyAck* msg, std::destroying_delete_t) {
+    SharedDtor(*msg);
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(NotifyAck));
+  }
+#endif
+
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR NotifyAck(
+      ::google::protobuf::internal::ConstantInitialized);
+
+  inline NotifyAck(const NotifyAck& from) : NotifyAck(nullptr, from) {}
+  inline NotifyAck(NotifyAck&& from) noexcept
+      : NotifyAck(nullptr, std::move(from)) {}
+  inline NotifyAck& operator=(const NotifyAck& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline NotifyAck& operator=(NotifyAck&& from) noexcept {
+    if (this == &from) return *this;
+    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const NotifyAck& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const NotifyAck* internal_default_instance() {
+    return reinterpret_cast<const NotifyAck*>(
+        &_NotifyAck_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages = 12;
+  friend void swap(NotifyAck& a, NotifyAck& b) { a.Swap(&b); }
+  inline void Swap(NotifyAck* other) {
+    if (other == this) return;
+    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(NotifyAck* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  NotifyAck* New(::google::protobuf::Arena* arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<NotifyAck>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const NotifyAck& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom(const NotifyAck& from) { NotifyAck::MergeImpl(*this, from); }
+
+  private:
+  static void MergeImpl(
+      ::google::protobuf::MessageLite& to_msg,
+      const ::google::protobuf::MessageLite& from_msg);
+
+  public:
+  bool IsInitialized() const {
+    return true;
+  }
+  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
+  #if defined(PROTOBUF_CUSTOM_VTABLE)
+  private:
+  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
+  static ::uint8_t* _InternalSerialize(
+      const MessageLite& msg, ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream);
+
+  public:
+  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+    return _InternalSerialize(*this, target, stream);
+  }
+  #else   // PROTOBUF_CUSTOM_VTABLE
+  ::size_t ByteSizeLong() const final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  #endif  // PROTOBUF_CUSTOM_VTABLE
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::google::protobuf::Arena* arena);
+  static void SharedDtor(MessageLite& self);
+  void InternalSwap(NotifyAck* other);
+ private:
+  template <typename T>
+  friend ::absl::string_view(
+      ::google::protobuf::internal::GetAnyMessageName)();
+  static ::absl::string_view FullMessageName() { return "message.NotifyAck"; }
+
+ protected:
+  explicit NotifyAck(::google::protobuf::Arena* arena);
+  NotifyAck(::google::protobuf::Arena* arena, const NotifyAck& from);
+  NotifyAck(::google::protobuf::Arena* arena, NotifyAck&& from) noexcept
+      : NotifyAck(arena) {
+    *this = ::std::move(from);
+  }
+  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
+  static void* PlacementNew_(const void*, void* mem,
+                             ::google::protobuf::Arena* arena);
+  static constexpr auto InternalNewImpl_();
+  static const ::google::protobuf::internal::ClassDataFull _class_data_;
+
+ public:
+  ::google::protobuf::Metadata GetMetadata() const;
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+  enum : int {
+    kAckedSeqFieldNumber = 1,
+    kWindowFieldNumber = 2,
+  };
+  // uint64 acked_seq = 1;
+  void clear_acked_seq() ;
+  ::uint64_t acked_seq() const;
+  void set_acked_seq(::uint64_t value);
+
+  private:
+  ::uint64_t _internal_acked_seq() const;
+  void _internal_set_acked_seq(::uint64_t value);
+
+  public:
+  // uint32 window = 2;
+  void clear_window() ;
+  ::uint32_t window() const;
+  void set_window(::uint32_t value);
+
+  private:
+  ::uint32_t _internal_window() const;
+  void _internal_set_window(::uint32_t value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:message.NotifyAck)
+ private:
+  class _Internal;
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      1, 2, 0,
+      0, 2>
+      _table_;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+    inline explicit constexpr Impl_(
+        ::google::protobuf::internal::ConstantInitialized) noexcept;
+    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                          ::google::protobuf::Arena* arena);
+    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                          ::google::protobuf::Arena* arena, const Impl_& from,
+                          const NotifyAck& from_msg);
+    ::uint64_t acked_seq_;
+    ::uint32_t window_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_message_2eproto;
+};
+// -------------------------------------------------------------------
+
+class LoginResponse final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:message.LoginResponse) */ {
+ public:
+  inline LoginResponse() : LoginResponse(nullptr) {}
+  ~LoginResponse() PROTOBUF_FINAL;
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+  void operator delete(LoginResponse* msg, std::destroying_delete_t) {
+    SharedDtor(*msg);
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(LoginResponse));
+  }
+#endif
+
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR LoginResponse(
+      ::google::protobuf::internal::ConstantInitialized);
+
+  inline LoginResponse(const LoginResponse& from) : LoginResponse(nullptr, from) {}
+  inline LoginResponse(LoginResponse&& from) noexcept
+      : LoginResponse(nullptr, std::move(from)) {}
+  inline LoginResponse& operator=(const LoginResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LoginResponse& operator=(LoginResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LoginResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LoginResponse* internal_default_instance() {
+    return reinterpret_cast<const LoginResponse*>(
+        &_LoginResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages = 5;
+  friend void swap(LoginResponse& a, LoginResponse& b) { a.Swap(&b); }
+  inline void Swap(LoginResponse* other) {
+    if (other == this) return;
+    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LoginResponse* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LoginResponse* New(::google::protobuf::Arena* arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<LoginResponse>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const LoginResponse& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom(const LoginResponse& from) { LoginResponse::MergeImpl(*this, from); }
+
+  private:
+  static void MergeImpl(
+      ::google::protobuf::MessageLite& to_msg,
+      const ::google::protobuf::MessageLite& from_msg);
+
+  public:
+  bool IsInitialized() const {
+    return true;
+  }
+  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
+  #if defined(PROTOBUF_CUSTOM_VTABLE)
+  private:
+  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
+  static ::uint8_t* _InternalSerialize(
+      const MessageLite& msg, ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream);
+
+  public:
+  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+    return _InternalSerialize(*this, target, stream);
+  }
+  #else   // PROTOBUF_CUSTOM_VTABLE
+  ::size_t ByteSizeLong() const final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  #endif  // PROTOBUF_CUSTOM_VTABLE
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::google::protobuf::Arena* arena);
+  static void SharedDtor(MessageLite& self);
+  void InternalSwap(LoginResponse* other);
+ private:
+  template <typename T>
+  friend ::absl::string_view(
+      ::google::protobuf::internal::GetAnyMessageName)();
+  static ::absl::string_view FullMessageName() { return "message.LoginResponse"; }
+
+ protected:
+  explicit LoginResponse(::google::protobuf::Arena* arena);
+  LoginResponse(::google::protobuf::Arena* arena, const LoginResponse& from);
+  LoginResponse(::google::protobuf::Arena* arena, LoginResponse&& from) noexcept
+      : LoginResponse(arena) {
+    *this = ::std::move(from);
+  }
+  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
+  static void* PlacementNew_(const void*, void* mem,
+                             ::google::protobuf::Arena* arena);
+  static constexpr auto InternalNewImpl_();
+  static const ::google::protobuf::internal::ClassDataFull _class_data_;
+
+ public:
+  ::google::protobuf::Metadata GetMetadata() const;
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+  enum : int {
+    kUidFieldNumber = 2,
+    kTokenFieldNumber = 3,
+    kErrorFieldNumber = 1,
+  };
+  // string uid = 2;
+  void clear_uid() ;
+  const std::string& uid() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_uid(Arg_&& arg, Args_... args);
+  std::string* mutable_uid();
+  PROTOBUF_NODISCARD std::string* release_uid();
+  void set_allocated_uid(std::string* value);
+
+  private:
+  const std::string& _internal_uid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uid(
+      const std::string& value);
+  std::string* _internal_mutable_uid();
+
+  public:
+  // string token = 3;
+  void clear_token() ;
+  const std::string& token() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_token(Arg_&& arg, Args_... args);
+  std::string* mutable_token();
+  PROTOBUF_NODISCARD std::string* release_token();
+  void set_allocated_token(std::string* value);
+
+  private:
+  const std::string& _internal_token() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_token(
+      const std::string& value);
+  std::string* _internal_mutable_token();
+
+  public:
+  // int32 error = 1;
+  void clear_error() ;
+  ::int32_t error() const;
+  void set_error(::int32_t value);
+
+  private:
+  ::int32_t _internal_error() const;
+  void _internal_set_error(::int32_t value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:message.LoginResponse)
+ private:
+  class _Internal;
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      2, 3, 0,
+      38, 2>
+      _table_;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+    inline explicit constexpr Impl_(
+        ::google::protobuf::internal::ConstantInitialized) noexcept;
+    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                          ::google::protobuf::Arena* arena);
+    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                          ::google::protobuf::Arena* arena, const Impl_& from,
+                          const LoginResponse& from_msg);
+    ::google::protobuf::internal::ArenaStringPtr uid_;
+    ::google::protobuf::internal::ArenaStringPtr token_;
+    ::int32_t error_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_message_2eproto;
+};
+// -------------------------------------------------------------------
+
+class LoginRequest final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:message.LoginRequest) */ {
+ public:
+  inline LoginRequest() : LoginRequest(nullptr) {}
+  ~LoginRequest() PROTOBUF_FINAL;
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+  void operator delete(LoginRequest* msg, std::destroying_delete_t) {
+    SharedDtor(*msg);
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(LoginRequest));
+  }
+#endif
+
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR LoginRequest(
+      ::google::protobuf::internal::ConstantInitialized);
+
+  inline LoginRequest(const LoginRequest& from) : LoginRequest(nullptr, from) {}
+  inline LoginRequest(LoginRequest&& from) noexcept
+      : LoginRequest(nullptr, std::move(from)) {}
+  inline LoginRequest& operator=(const LoginRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LoginRequest& operator=(LoginRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LoginRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LoginRequest* internal_default_instance() {
+    return reinterpret_cast<const LoginRequest*>(
+        &_LoginRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages = 4;
+  friend void swap(LoginRequest& a, LoginRequest& b) { a.Swap(&b); }
+  inline void Swap(LoginRequest* other) {
+    if (other == this) return;
+    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LoginRequest* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LoginRequest* New(::google::protobuf::Arena* arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<LoginRequest>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const LoginRequest& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom(const LoginRequest& from) { LoginRequest::MergeImpl(*this, from); }
+
+  private:
+  static void MergeImpl(
+      ::google::protobuf::MessageLite& to_msg,
+      const ::google::protobuf::MessageLite& from_msg);
+
+  public:
+  bool IsInitialized() const {
+    return true;
+  }
+  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
+  #if defined(PROTOBUF_CUSTOM_VTABLE)
+  private:
+  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
+  static ::uint8_t* _InternalSerialize(
+      const MessageLite& msg, ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream);
+
+  public:
+  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+    return _InternalSerialize(*this, target, stream);
+  }
+  #else   // PROTOBUF_CUSTOM_VTABLE
+  ::size_t ByteSizeLong() const final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  #endif  // PROTOBUF_CUSTOM_VTABLE
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::google::protobuf::Arena* arena);
+  static void SharedDtor(MessageLite& self);
+  void InternalSwap(LoginRequest* other);
+ private:
+  template <typename T>
+  friend ::absl::string_view(
+      ::google::protobuf::internal::GetAnyMessageName)();
+  static ::absl::string_view FullMessageName() { return "message.LoginRequest"; }
+
+ protected:
+  explicit LoginRequest(::google::protobuf::Arena* arena);
+  LoginRequest(::google::protobuf::Arena* arena, const LoginRequest& from);
+  LoginRequest(::google::protobuf::Arena* arena, LoginRequest&& from) noexcept
+      : LoginRequest(arena) {
+    *this = ::std::move(from);
+  }
+  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
+  static void* PlacementNew_(const void*, void* mem,
+                             ::google::protobuf::Arena* arena);
+  static constexpr auto InternalNewImpl_();
+  static const ::google::protobuf::internal::ClassDataFull _class_data_;
+
+ public:
+  ::google::protobuf::Metadata GetMetadata() const;
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+  enum : int {
+    kUidFieldNumber = 1,
+    kTokenFieldNumber = 2,
+  };
+  // string uid = 1;
+  void clear_uid() ;
+  const std::string& uid() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_uid(Arg_&& arg, Args_... args);
+  std::string* mutable_uid();
+  PROTOBUF_NODISCARD std::string* release_uid();
+  void set_allocated_uid(std::string* value);
+
+  private:
+  const std::string& _internal_uid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uid(
+      const std::string& value);
+  std::string* _internal_mutable_uid();
+
+  public:
+  // string token = 2;
+  void clear_token() ;
+  const std::string& token() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_token(Arg_&& arg, Args_... args);
+  std::string* mutable_token();
+  PROTOBUF_NODISCARD std::string* release_token();
+  void set_allocated_token(std::string* value);
+
+  private:
+  const std::string& _internal_token() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_token(
+      const std::string& value);
+  std::string* _internal_mutable_token();
+
+  public:
+  // @@protoc_insertion_point(class_scope:message.LoginRequest)
+ private:
+  class _Internal;
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      1, 2, 0,
+      37, 2>
+      _table_;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+    inline explicit constexpr Impl_(
+        ::google::protobuf::internal::ConstantInitialized) noexcept;
+    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                          ::google::protobuf::Arena* arena);
+    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                          ::google::protobuf::Arena* arena, const Impl_& from,
+                          const LoginRequest& from_msg);
+    ::google::protobuf::internal::ArenaStringPtr uid_;
+    ::google::protobuf::internal::ArenaStringPtr token_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_message_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GetVerifyResponse final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:message.GetVerifyResponse) */ {
+ public:
+  inline GetVerifyResponse() : GetVerifyResponse(nullptr) {}
+  ~GetVerifyResponse() PROTOBUF_FINAL;
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+  void operator delete(GetVerifyResponse* msg, std::destroying_delete_t) {
+    SharedDtor(*msg);
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(GetVerifyResponse));
+  }
+#endif
+
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR GetVerifyResponse(
+      ::google::protobuf::internal::ConstantInitialized);
+
+  inline GetVerifyResponse(const GetVerifyResponse& from) : GetVerifyResponse(nullptr, from) {}
+  inline GetVerifyResponse(GetVerifyResponse&& from) noexcept
+      : GetVerifyResponse(nullptr, std::move(from)) {}
+  inline GetVerifyResponse& operator=(const GetVerifyResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GetVerifyResponse& operator=(GetVerifyResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetVerifyResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GetVerifyResponse* internal_default_instance() {
+    return reinterpret_cast<const GetVerifyResponse*>(
+        &_GetVerifyResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages = 1;
+  friend void swap(GetVerifyResponse& a, GetVerifyResponse& b) { a.Swap(&b); }
+  inline void Swap(GetVerifyResponse* other) {
+    if (other == this) return;
+    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetVerifyResponse* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GetVerifyResponse* New(::google::protobuf::Arena* arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<GetVerifyResponse>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const GetVerifyResponse& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom(const GetVerifyResponse& from) { GetVerifyResponse::MergeImpl(*this, from); }
+
+  private:
+  static void MergeImpl(
+      ::google::protobuf::MessageLite& to_msg,
+      const ::google::protobuf::MessageLite& from_msg);
+
+  public:
+  bool IsInitialized() const {
+    return true;
+  }
+  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
+  #if defined(PROTOBUF_CUSTOM_VTABLE)
+  private:
+  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
+  static ::uint8_t* _InternalSerialize(
+      const MessageLite& msg, ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream);
+
+  public:
+  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+    return _InternalSerialize(*this, target, stream);
+  }
+  #else   // PROTOBUF_CUSTOM_VTABLE
+  ::size_t ByteSizeLong() const final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  #endif  // PROTOBUF_CUSTOM_VTABLE
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::google::protobuf::Arena* arena);
+  static void SharedDtor(MessageLite& self);
+  void InternalSwap(GetVerifyResponse* other);
+ private:
+  template <typename T>
+  friend ::absl::string_view(
+      ::google::protobuf::internal::GetAnyMessageName)();
+  static ::absl::string_view FullMessageName() { return "message.GetVerifyResponse"; }
+
+ protected:
+  explicit GetVerifyResponse(::google::protobuf::Arena* arena);
+  GetVerifyResponse(::google::protobuf::Arena* arena, const GetVerifyResponse& from);
+  GetVerifyResponse(::google::protobuf::Arena* arena, GetVerifyResponse&& from) noexcept
+      : GetVerifyResponse(arena) {
+    *this = ::std::move(from);
+  }
+  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
+  static void* PlacementNew_(const void*, void* mem,
+                             ::google::protobuf::Arena* arena);
+  static constexpr auto InternalNewImpl_();
+  static const ::google::protobuf::internal::ClassDataFull _class_data_;
+
+ public:
+  ::google::protobuf::Metadata GetMetadata() const;
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+  enum : int {
+    kEmailFieldNumber = 2,
+    kCodeFieldNumber = 3,
+    kErrorFieldNumber = 1,
+  };
+  // string email = 2;
+  void clear_email() ;
+  const std::string& email() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_email(Arg_&& arg, Args_... args);
+  std::string* mutable_email();
+  PROTOBUF_NODISCARD std::string* release_email();
+  void set_allocated_email(std::string* value);
+
+  private:
+  const std::string& _internal_email() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_email(
+      const std::string& value);
+  std::string* _internal_mutable_email();
+
+  public:
+  // string code = 3;
+  void clear_code() ;
+  const std::string& code() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_code(Arg_&& arg, Args_... args);
+  std::string* mutable_code();
+  PROTOBUF_NODISCARD std::string* release_code();
+  void set_allocated_code(std::string* value);
+
+  private:
+  const std::string& _internal_code() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_code(
+      const std::string& value);
+  std::string* _internal_mutable_code();
+
+  public:
+  // int32 error = 1;
+  void clear_error() ;
+  ::int32_t error() const;
+  void set_error(::int32_t value);
+
+  private:
+  ::int32_t _internal_error() const;
+  void _internal_set_error(::int32_t value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:message.GetVerifyResponse)
+ private:
+  class _Internal;
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      2, 3, 0,
+      43, 2>
+      _table_;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+    inline explicit constexpr Impl_(
+        ::google::protobuf::internal::ConstantInitialized) noexcept;
+    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                          ::google::protobuf::Arena* arena);
+    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                          ::google::protobuf::Arena* arena, const Impl_& from,
+                          const GetVerifyResponse& from_msg);
+    ::google::protobuf::internal::ArenaStringPtr email_;
+    ::google::protobuf::internal::ArenaStringPtr code_;
+    ::int32_t error_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_message_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GetVerifyRequest final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:message.GetVerifyRequest) */ {
+ public:
+  inline GetVerifyRequest() : GetVerifyRequest(nullptr) {}
+  ~GetVerifyRequest() PROTOBUF_FINAL;
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+  void operator delete(GetVerifyRequest* msg, std::destroying_delete_t) {
+    SharedDtor(*msg);
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(GetVerifyRequest));
+  }
+#endif
+
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR GetVerifyRequest(
+      ::google::protobuf::internal::ConstantInitialized);
+
+  inline GetVerifyRequest(const GetVerifyRequest& from) : GetVerifyRequest(nullptr, from) {}
+  inline GetVerifyRequest(GetVerifyRequest&& from) noexcept
+      : GetVerifyRequest(nullptr, std::move(from)) {}
+  inline GetVerifyRequest& operator=(const GetVerifyRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GetVerifyRequest& operator=(GetVerifyRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetVerifyRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GetVerifyRequest* internal_default_instance() {
+    return reinterpret_cast<const GetVerifyRequest*>(
+        &_GetVerifyRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages = 0;
+  friend void swap(GetVerifyRequest& a, GetVerifyRequest& b) { a.Swap(&b); }
+  inline void Swap(GetVerifyRequest* other) {
+    if (other == this) return;
+    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetVerifyRequest* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GetVerifyRequest* New(::google::protobuf::Arena* arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<GetVerifyRequest>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const GetVerifyRequest& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom(const GetVerifyRequest& from) { GetVerifyRequest::MergeImpl(*this, from); }
+
+  private:
+  static void MergeImpl(
+      ::google::protobuf::MessageLite& to_msg,
+      const ::google::protobuf::MessageLite& from_msg);
+
+  public:
+  bool IsInitialized() const {
+    return true;
+  }
+  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
+  #if defined(PROTOBUF_CUSTOM_VTABLE)
+  private:
+  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
+  static ::uint8_t* _InternalSerialize(
+      const MessageLite& msg, ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream);
+
+  public:
+  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+    return _InternalSerialize(*this, target, stream);
+  }
+  #else   // PROTOBUF_CUSTOM_VTABLE
+  ::size_t ByteSizeLong() const final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  #endif  // PROTOBUF_CUSTOM_VTABLE
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::google::protobuf::Arena* arena);
+  static void SharedDtor(MessageLite& self);
+  void InternalSwap(GetVerifyRequest* other);
+ private:
+  template <typename T>
+  friend ::absl::string_view(
+      ::google::protobuf::internal::GetAnyMessageName)();
+  static ::absl::string_view FullMessageName() { return "message.GetVerifyRequest"; }
+
+ protected:
+  explicit GetVerifyRequest(::google::protobuf::Arena* arena);
+  GetVerifyRequest(::google::protobuf::Arena* arena, const GetVerifyRequest& from);
+  GetVerifyRequest(::google::protobuf::Arena* arena, GetVerifyRequest&& from) noexcept
+      : GetVerifyRequest(arena) {
+    *this = ::std::move(from);
+  }
+  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
+  static void* PlacementNew_(const void*, void* mem,
+                             ::google::protobuf::Arena* arena);
+  static constexpr auto InternalNewImpl_();
+  static const ::google::protobuf::internal::ClassDataFull _class_data_;
+
+ public:
+  ::google::protobuf::Metadata GetMetadata() const;
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+  enum : int {
+    kEmailFieldNumber = 1,
+  };
+  // string email = 1;
+  void clear_email() ;
+  const std::string& email() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_email(Arg_&& arg, Args_... args);
+  std::string* mutable_email();
+  PROTOBUF_NODISCARD std::string* release_email();
+  void set_allocated_email(std::string* value);
+
+  private:
+  const std::string& _internal_email() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_email(
+      const std::string& value);
+  std::string* _internal_mutable_email();
+
+  public:
+  // @@protoc_insertion_point(class_scope:message.GetVerifyRequest)
+ private:
+  class _Internal;
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 1, 0,
+      38, 2>
+      _table_;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+    inline explicit constexpr Impl_(
+        ::google::protobuf::internal::ConstantInitialized) noexcept;
+    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                          ::google::protobuf::Arena* arena);
+    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                          ::google::protobuf::Arena* arena, const Impl_& from,
+                          const GetVerifyRequest& from_msg);
+    ::google::protobuf::internal::ArenaStringPtr email_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_message_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GetChatServerResponse final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:message.GetChatServerResponse) */ {
+ public:
+  inline GetChatServerResponse() : GetChatServerResponse(nullptr) {}
+  ~GetChatServerResponse() PROTOBUF_FINAL;
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+  void operator delete(GetChatServerResponse* msg, std::destroying_delete_t) {
+    SharedDtor(*msg);
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(GetChatServerResponse));
+  }
+#endif
+
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR GetChatServerResponse(
+      ::google::protobuf::internal::ConstantInitialized);
+
+  inline GetChatServerResponse(const GetChatServerResponse& from) : GetChatServerResponse(nullptr, from) {}
+  inline GetChatServerResponse(GetChatServerResponse&& from) noexcept
+      : GetChatServerResponse(nullptr, std::move(from)) {}
+  inline GetChatServerResponse& operator=(const GetChatServerResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GetChatServerResponse& operator=(GetChatServerResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetChatServerResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GetChatServerResponse* internal_default_instance() {
+    return reinterpret_cast<const GetChatServerResponse*>(
+        &_GetChatServerResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages = 3;
+  friend void swap(GetChatServerResponse& a, GetChatServerResponse& b) { a.Swap(&b); }
+  inline void Swap(GetChatServerResponse* other) {
+    if (other == this) return;
+    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetChatServerResponse* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GetChatServerResponse* New(::google::protobuf::Arena* arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<GetChatServerResponse>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const GetChatServerResponse& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom(const GetChatServerResponse& from) { GetChatServerResponse::MergeImpl(*this, from); }
+
+  private:
+  static void MergeImpl(
+      ::google::protobuf::MessageLite& to_msg,
+      const ::google::protobuf::MessageLite& from_msg);
+
+  public:
+  bool IsInitialized() const {
+    return true;
+  }
+  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
+  #if defined(PROTOBUF_CUSTOM_VTABLE)
+  private:
+  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
+  static ::uint8_t* _InternalSerialize(
+      const MessageLite& msg, ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream);
+
+  public:
+  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+    return _InternalSerialize(*this, target, stream);
+  }
+  #else   // PROTOBUF_CUSTOM_VTABLE
+  ::size_t ByteSizeLong() const final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  #endif  // PROTOBUF_CUSTOM_VTABLE
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::google::protobuf::Arena* arena);
+  static void SharedDtor(MessageLite& self);
+  void InternalSwap(GetChatServerResponse* other);
+ private:
+  template <typename T>
+  friend ::absl::string_view(
+      ::google::protobuf::internal::GetAnyMessageName)();
+  static ::absl::string_view FullMessageName() { return "message.GetChatServerResponse"; }
+
+ protected:
+  explicit GetChatServerResponse(::google::protobuf::Arena* arena);
+  GetChatServerResponse(::google::protobuf::Arena* arena, const GetChatServerResponse& from);
+  GetChatServerResponse(::google::protobuf::Arena* arena, GetChatServerResponse&& from) noexcept
+      : GetChatServerResponse(arena) {
+    *this = ::std::move(from);
+  }
+  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
+  static void* PlacementNew_(const void*, void* mem,
+                             ::google::protobuf::Arena* arena);
+  static constexpr auto InternalNewImpl_();
+  static const ::google::protobuf::internal::ClassDataFull _class_data_;
+
+ public:
+  ::google::protobuf::Metadata GetMetadata() const;
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+  enum : int {
+    kHostFieldNumber = 2,
+    kPortFieldNumber = 3,
+    kTokenFieldNumber = 4,
+    kErrorFieldNumber = 1,
+  };
+  // string host = 2;
+  void clear_host() ;
+  const std::string& host() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_host(Arg_&& arg, Args_... args);
+  std::string* mutable_host();
+  PROTOBUF_NODISCARD std::string* release_host();
+  void set_allocated_host(std::string* value);
+
+  private:
+  const std::string& _internal_host() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_host(
+      const std::string& value);
+  std::string* _internal_mutable_host();
+
+  public:
+  // string port = 3;
+  void clear_port() ;
+  const std::string& port() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_port(Arg_&& arg, Args_... args);
+  std::string* mutable_port();
+  PROTOBUF_NODISCARD std::string* release_port();
+  void set_allocated_port(std::string* value);
+
+  private:
+  const std::string& _internal_port() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_port(
+      const std::string& value);
+  std::string* _internal_mutable_port();
+
+  public:
+  // string token = 4;
+  void clear_token() ;
+  const std::string& token() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_token(Arg_&& arg, Args_... args);
+  std::string* mutable_token();
+  PROTOBUF_NODISCARD std::string* release_token();
+  void set_allocated_token(std::string* value);
+
+  private:
+  const std::string& _internal_token() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_token(
+      const std::string& value);
+  std::string* _internal_mutable_token();
+
+  public:
+  // int32 error = 1;
+  void clear_error() ;
+  ::int32_t error() const;
+  void set_error(::int32_t value);
+
+  private:
+  ::int32_t _internal_error() const;
+  void _internal_set_error(::int32_t value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:message.GetChatServerResponse)
+ private:
+  class _Internal;
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      2, 4, 0,
+      51, 2>
+      _table_;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+    inline explicit constexpr Impl_(
+        ::google::protobuf::internal::ConstantInitialized) noexcept;
+    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                          ::google::protobuf::Arena* arena);
+    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                          ::google::protobuf::Arena* arena, const Impl_& from,
+                          const GetChatServerResponse& from_msg);
+    ::google::protobuf::internal::ArenaStringPtr host_;
+    ::google::protobuf::internal::ArenaStringPtr port_;
+    ::google::protobuf::internal::ArenaStringPtr token_;
+    ::int32_t error_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_message_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GetChatServerRequest final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:message.GetChatServerRequest) */ {
+ public:
+  inline GetChatServerRequest() : GetChatServerRequest(nullptr) {}
+  ~GetChatServerRequest() PROTOBUF_FINAL;
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+  void operator delete(GetChatServerRequest* msg, std::destroying_delete_t) {
+    SharedDtor(*msg);
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(GetChatServerRequest));
+  }
+#endif
+
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR GetChatServerRequest(
+      ::google::protobuf::internal::ConstantInitialized);
+
+  inline GetChatServerRequest(const GetChatServerRequest& from) : GetChatServerRequest(nullptr, from) {}
+  inline GetChatServerRequest(GetChatServerRequest&& from) noexcept
+      : GetChatServerRequest(nullptr, std::move(from)) {}
+  inline GetChatServerRequest& operator=(const GetChatServerRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GetChatServerRequest& operator=(GetChatServerRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetChatServerRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GetChatServerRequest* internal_default_instance() {
+    return reinterpret_cast<const GetChatServerRequest*>(
+        &_GetChatServerRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages = 2;
+  friend void swap(GetChatServerRequest& a, GetChatServerRequest& b) { a.Swap(&b); }
+  inline void Swap(GetChatServerRequest* other) {
+    if (other == this) return;
+    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetChatServerRequest* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GetChatServerRequest* New(::google::protobuf::Arena* arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<GetChatServerRequest>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const GetChatServerRequest& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom(const GetChatServerRequest& from) { GetChatServerRequest::MergeImpl(*this, from); }
+
+  private:
+  static void MergeImpl(
+      ::google::protobuf::MessageLite& to_msg,
+      const ::google::protobuf::MessageLite& from_msg);
+
+  public:
+  bool IsInitialized() const {
+    return true;
+  }
+  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
+  #if defined(PROTOBUF_CUSTOM_VTABLE)
+  private:
+  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
+  static ::uint8_t* _InternalSerialize(
+      const MessageLite& msg, ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream);
+
+  public:
+  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+    return _InternalSerialize(*this, target, stream);
+  }
+  #else   // PROTOBUF_CUSTOM_VTABLE
+  ::size_t ByteSizeLong() const final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  #endif  // PROTOBUF_CUSTOM_VTABLE
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::google::protobuf::Arena* arena);
+  static void SharedDtor(MessageLite& self);
+  void InternalSwap(GetChatServerRequest* other);
+ private:
+  template <typename T>
+  friend ::absl::string_view(
+      ::google::protobuf::internal::GetAnyMessageName)();
+  static ::absl::string_view FullMessageName() { return "message.GetChatServerRequest"; }
+
+ protected:
+  explicit GetChatServerRequest(::google::protobuf::Arena* arena);
+  GetChatServerRequest(::google::protobuf::Arena* arena, const GetChatServerRequest& from);
+  GetChatServerRequest(::google::protobuf::Arena* arena, GetChatServerRequest&& from) noexcept
+      : GetChatServerRequest(arena) {
+    *this = ::std::move(from);
+  }
+  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
+  static void* PlacementNew_(const void*, void* mem,
+                             ::google::protobuf::Arena* arena);
+  static constexpr auto InternalNewImpl_();
+  static const ::google::protobuf::internal::ClassDataFull _class_data_;
+
+ public:
+  ::google::protobuf::Metadata GetMetadata() const;
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+  enum : int {
+    kUidFieldNumber = 1,
+  };
+  // string uid = 1;
+  void clear_uid() ;
+  const std::string& uid() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_uid(Arg_&& arg, Args_... args);
+  std::string* mutable_uid();
+  PROTOBUF_NODISCARD std::string* release_uid();
+  void set_allocated_uid(std::string* value);
+
+  private:
+  const std::string& _internal_uid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uid(
+      const std::string& value);
+  std::string* _internal_mutable_uid();
+
+  public:
+  // @@protoc_insertion_point(class_scope:message.GetChatServerRequest)
+ private:
+  class _Internal;
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 1, 0,
+      40, 2>
+      _table_;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+    inline explicit constexpr Impl_(
+        ::google::protobuf::internal::ConstantInitialized) noexcept;
+    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                          ::google::protobuf::Arena* arena);
+    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                          ::google::protobuf::Arena* arena, const Impl_& from,
+                          const GetChatServerRequest& from_msg);
+    ::google::protobuf::internal::ArenaStringPtr uid_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_message_2eproto;
+};
+// -------------------------------------------------------------------
+
+class FriendResponse final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:message.FriendResponse) */ {
+ public:
+  inline FriendResponse() : FriendResponse(nullptr) {}
+  ~FriendResponse() PROTOBUF_FINAL;
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+  void operator delete(FriendResponse* msg, std::destroying_delete_t) {
+    SharedDtor(*msg);
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(FriendResponse));
+  }
+#endif
+
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR FriendResponse(
+      ::google::protobuf::internal::ConstantInitialized);
+
+  inline FriendResponse(const FriendResponse& from) : FriendResponse(nullptr, from) {}
+  inline FriendResponse(FriendResponse&& from) noexcept
+      : FriendResponse(nullptr, std::move(from)) {}
+  inline FriendResponse& operator=(const FriendResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline FriendResponse& operator=(FriendResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const FriendResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const FriendResponse* internal_default_instance() {
+    return reinterpret_cast<const FriendResponse*>(
+        &_FriendResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages = 7;
+  friend void swap(FriendResponse& a, FriendResponse& b) { a.Swap(&b); }
+  inline void Swap(FriendResponse* other) {
+    if (other == this) return;
+    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FriendResponse* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  FriendResponse* New(::google::protobuf::Arena* arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<FriendResponse>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const FriendResponse& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom(const FriendResponse& from) { FriendResponse::MergeImpl(*this, from); }
+
+  private:
+  static void MergeImpl(
+      ::google::protobuf::MessageLite& to_msg,
+      const ::google::protobuf::MessageLite& from_msg);
+
+  public:
+  bool IsInitialized() const {
+    return true;
+  }
+  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
+  #if defined(PROTOBUF_CUSTOM_VTABLE)
+  private:
+  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
+  static ::uint8_t* _InternalSerialize(
+      const MessageLite& msg, ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream);
+
+  public:
+  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+    return _InternalSerialize(*this, target, stream);
+  }
+  #else   // PROTOBUF_CUSTOM_VTABLE
+  ::size_t ByteSizeLong() const final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  #endif  // PROTOBUF_CUSTOM_VTABLE
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::google::protobuf::Arena* arena);
+  static void SharedDtor(MessageLite& self);
+  void InternalSwap(FriendResponse* other);
+ private:
+  template <typename T>
+  friend ::absl::string_view(
+      ::google::protobuf::internal::GetAnyMessageName)();
+  static ::absl::string_view FullMessageName() { return "message.FriendResponse"; }
+
+ protected:
+  explicit FriendResponse(::google::protobuf::Arena* arena);
+  FriendResponse(::google::protobuf::Arena* arena, const FriendResponse& from);
+  FriendResponse(::google::protobuf::Arena* arena, FriendResponse&& from) noexcept
+      : FriendResponse(arena) {
+    *this = ::std::move(from);
+  }
+  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
+  static void* PlacementNew_(const void*, void* mem,
+                             ::google::protobuf::Arena* arena);
+  static constexpr auto InternalNewImpl_();
+  static const ::google::protobuf::internal::ClassDataFull _class_data_;
+
+ public:
+  ::google::protobuf::Metadata GetMetadata() const;
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+  enum : int {
+    kApplicantFieldNumber = 2,
+    kRecipientFieldNumber = 3,
+    kErrorFieldNumber = 1,
+  };
+  // string applicant = 2;
+  void clear_applicant() ;
+  const std::string& applicant() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_applicant(Arg_&& arg, Args_... args);
+  std::string* mutable_applicant();
+  PROTOBUF_NODISCARD std::string* release_applicant();
+  void set_allocated_applicant(std::string* value);
+
+  private:
+  const std::string& _internal_applicant() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_applicant(
+      const std::string& value);
+  std::string* _internal_mutable_applicant();
+
+  public:
+  // string recipient = 3;
+  void clear_recipient() ;
+  const std::string& recipient() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_recipient(Arg_&& arg, Args_... args);
+  std::string* mutable_recipient();
+  PROTOBUF_NODISCARD std::string* release_recipient();
+  void set_allocated_recipient(std::string* value);
+
+  private:
+  const std::string& _internal_recipient() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_recipient(
+      const std::string& value);
+  std::string* _internal_mutable_recipient();
+
+  public:
+  // int32 error = 1;
+  void clear_error() ;
+  ::int32_t error() const;
+  void set_error(::int32_t value);
+
+  private:
+  ::int32_t _internal_error() const;
+  void _internal_set_error(::int32_t value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:message.FriendResponse)
+ private:
+  class _Internal;
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      2, 3, 0,
+      49, 2>
+      _table_;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+    inline explicit constexpr Impl_(
+        ::google::protobuf::internal::ConstantInitialized) noexcept;
+    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                          ::google::protobuf::Arena* arena);
+    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                          ::google::protobuf::Arena* arena, const Impl_& from,
+                          const FriendResponse& from_msg);
+    ::google::protobuf::internal::ArenaStringPtr applicant_;
+    ::google::protobuf::internal::ArenaStringPtr recipient_;
+    ::int32_t error_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_message_2eproto;
+};
+// -------------------------------------------------------------------
+
+class FriendRequest final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:message.FriendRequest) */ {
+ public:
+  inline FriendRequest() : FriendRequest(nullptr) {}
+  ~FriendRequest() PROTOBUF_FINAL;
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+  void operator delete(FriendRequest* msg, std::destroying_delete_t) {
+    SharedDtor(*msg);
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(FriendRequest));
+  }
+#endif
+
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR FriendRequest(
+      ::google::protobuf::internal::ConstantInitialized);
+
+  inline FriendRequest(const FriendRequest& from) : FriendRequest(nullptr, from) {}
+  inline FriendRequest(FriendRequest&& from) noexcept
+      : FriendRequest(nullptr, std::move(from)) {}
+  inline FriendRequest& operator=(const FriendRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline FriendRequest& operator=(FriendRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const FriendRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const FriendRequest* internal_default_instance() {
+    return reinterpret_cast<const FriendRequest*>(
+        &_FriendRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages = 6;
+  friend void swap(FriendRequest& a, FriendRequest& b) { a.Swap(&b); }
+  inline void Swap(FriendRequest* other) {
+    if (other == this) return;
+    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FriendRequest* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  FriendRequest* New(::google::protobuf::Arena* arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<FriendRequest>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const FriendRequest& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom(const FriendRequest& from) { FriendRequest::MergeImpl(*this, from); }
+
+  private:
+  static void MergeImpl(
+      ::google::protobuf::MessageLite& to_msg,
+      const ::google::protobuf::MessageLite& from_msg);
+
+  public:
+  bool IsInitialized() const {
+    return true;
+  }
+  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
+  #if defined(PROTOBUF_CUSTOM_VTABLE)
+  private:
+  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
+  static ::uint8_t* _InternalSerialize(
+      const MessageLite& msg, ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream);
+
+  public:
+  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+    return _InternalSerialize(*this, target, stream);
+  }
+  #else   // PROTOBUF_CUSTOM_VTABLE
+  ::size_t ByteSizeLong() const final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  #endif  // PROTOBUF_CUSTOM_VTABLE
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::google::protobuf::Arena* arena);
+  static void SharedDtor(MessageLite& self);
+  void InternalSwap(FriendRequest* other);
+ private:
+  template <typename T>
+  friend ::absl::string_view(
+      ::google::protobuf::internal::GetAnyMessageName)();
+  static ::absl::string_view FullMessageName() { return "message.FriendRequest"; }
+
+ protected:
+  explicit FriendRequest(::google::protobuf::Arena* arena);
+  FriendRequest(::google::protobuf::Arena* arena, const FriendRequest& from);
+  FriendRequest(::google::protobuf::Arena* arena, FriendRequest&& from) noexcept
+      : FriendRequest(arena) {
+    *this = ::std::move(from);
+  }
+  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
+  static void* PlacementNew_(const void*, void* mem,
+                             ::google::protobuf::Arena* arena);
+  static constexpr auto InternalNewImpl_();
+  static const ::google::protobuf::internal::ClassDataFull _class_data_;
+
+ public:
+  ::google::protobuf::Metadata GetMetadata() const;
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+  enum : int {
+    kApplicantFieldNumber = 1,
+    kRecipientFieldNumber = 2,
+    kUsernameFieldNumber = 3,
+    kAvatarFieldNumber = 4,
+    kMessageFieldNumber = 5,
+    kTimeFieldNumber = 6,
+  };
+  // string applicant = 1;
+  void clear_applicant() ;
+  const std::string& applicant() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_applicant(Arg_&& arg, Args_... args);
+  std::string* mutable_applicant();
+  PROTOBUF_NODISCARD std::string* release_applicant();
+  void set_allocated_applicant(std::string* value);
+
+  private:
+  const std::string& _internal_applicant() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_applicant(
+      const std::string& value);
+  std::string* _internal_mutable_applicant();
+
+  public:
+  // string recipient = 2;
+  void clear_recipient() ;
+  const std::string& recipient() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_recipient(Arg_&& arg, Args_... args);
+  std::string* mutable_recipient();
+  PROTOBUF_NODISCARD std::string* release_recipient();
+  void set_allocated_recipient(std::string* value);
+
+  private:
+  const std::string& _internal_recipient() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_recipient(
+      const std::string& value);
+  std::string* _internal_mutable_recipient();
+
+  public:
+  // string username = 3;
+  void clear_username() ;
+  const std::string& username() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_username(Arg_&& arg, Args_... args);
+  std::string* mutable_username();
+  PROTOBUF_NODISCARD std::string* release_username();
+  void set_allocated_username(std::string* value);
+
+  private:
+  const std::string& _internal_username() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(
+      const std::string& value);
+  std::string* _internal_mutable_username();
+
+  public:
+  // string avatar = 4;
+  void clear_avatar() ;
+  const std::string& avatar() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_avatar(Arg_&& arg, Args_... args);
+  std::string* mutable_avatar();
+  PROTOBUF_NODISCARD std::string* release_avatar();
+  void set_allocated_avatar(std::string* value);
+
+  private:
+  const std::string& _internal_avatar() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_avatar(
+      const std::string& value);
+  std::string* _internal_mutable_avatar();
+
+  public:
+  // string message = 5;
+  void clear_message() ;
+  const std::string& message() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_message(Arg_&& arg, Args_... args);
+  std::string* mutable_message();
+  PROTOBUF_NODISCARD std::string* release_message();
+  void set_allocated_message(std::string* value);
+
+  private:
+  const std::string& _internal_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_message(
+      const std::string& value);
+  std::string* _internal_mutable_message();
+
+  public:
+  // int64 time = 6;
+  void clear_time() ;
+  ::int64_t time() const;
+  void set_time(::int64_t value);
+
+  private:
+  ::int64_t _internal_time() const;
+  void _internal_set_time(::int64_t value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:message.FriendRequest)
+ private:
+  class _Internal;
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      3, 6, 0,
+      69, 2>
+      _table_;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+    inline explicit constexpr Impl_(
+        ::google::protobuf::internal::ConstantInitialized) noexcept;
+    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                          ::google::protobuf::Arena* arena);
+    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                          ::google::protobuf::Arena* arena, const Impl_& from,
+                          const FriendRequest& from_msg);
+    ::google::protobuf::internal::ArenaStringPtr applicant_;
+    ::google::protobuf::internal::ArenaStringPtr recipient_;
+    ::google::protobuf::internal::ArenaStringPtr username_;
+    ::google::protobuf::internal::ArenaStringPtr avatar_;
+    ::google::protobuf::internal::ArenaStringPtr message_;
+    ::int64_t time_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_message_2eproto;
+};
+// -------------------------------------------------------------------
+
+class FriendApprovalResponse final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:message.FriendApprovalResponse) */ {
+ public:
+  inline FriendApprovalResponse() : FriendApprovalResponse(nullptr) {}
+  ~FriendApprovalResponse() PROTOBUF_FINAL;
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+  void operator delete(FriendApprovalResponse* msg, std::destroying_delete_t) {
+    SharedDtor(*msg);
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(FriendApprovalResponse));
+  }
+#endif
+
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR FriendApprovalResponse(
+      ::google::protobuf::internal::ConstantInitialized);
+
+  inline FriendApprovalResponse(const FriendApprovalResponse& from) : FriendApprovalResponse(nullptr, from) {}
+  inline FriendApprovalResponse(FriendApprovalResponse&& from) noexcept
+      : FriendApprovalResponse(nullptr, std::move(from)) {}
+  inline FriendApprovalResponse& operator=(const FriendApprovalResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline FriendApprovalResponse& operator=(FriendApprovalResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const FriendApprovalResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const FriendApprovalResponse* internal_default_instance() {
+    return reinterpret_cast<const FriendApprovalResponse*>(
+        &_FriendApprovalResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages = 9;
+  friend void swap(FriendApprovalResponse& a, FriendApprovalResponse& b) { a.Swap(&b); }
+  inline void Swap(FriendApprovalResponse* other) {
+    if (other == this) return;
+    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FriendApprovalResponse* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  FriendApprovalResponse* New(::google::protobuf::Arena* arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<FriendApprovalResponse>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const FriendApprovalResponse& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom(const FriendApprovalResponse& from) { FriendApprovalResponse::MergeImpl(*this, from); }
+
+  private:
+  static void MergeImpl(
+      ::google::protobuf::MessageLite& to_msg,
+      const ::google::protobuf::MessageLite& from_msg);
+
+  public:
+  bool IsInitialized() const {
+    return true;
+  }
+  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
+  #if defined(PROTOBUF_CUSTOM_VTABLE)
+  private:
+  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
+  static ::uint8_t* _InternalSerialize(
+      const MessageLite& msg, ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream);
+
+  public:
+  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+    return _InternalSerialize(*this, target, stream);
+  }
+  #else   // PROTOBUF_CUSTOM_VTABLE
+  ::size_t ByteSizeLong() const final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  #endif  // PROTOBUF_CUSTOM_VTABLE
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::google::protobuf::Arena* arena);
+  static void SharedDtor(MessageLite& self);
+  void InternalSwap(FriendApprovalResponse* other);
+ private:
+  template <typename T>
+  friend ::absl::string_view(
+      ::google::protobuf::internal::GetAnyMessageName)();
+  static ::absl::string_view FullMessageName() { return "message.FriendApprovalResponse"; }
+
+ protected:
+  explicit FriendApprovalResponse(::google::protobuf::Arena* arena);
+  FriendApprovalResponse(::google::protobuf::Arena* arena, const FriendApprovalResponse& from);
+  FriendApprovalResponse(::google::protobuf::Arena* arena, FriendApprovalResponse&& from) noexcept
+      : FriendApprovalResponse(arena) {
+    *this = ::std::move(from);
+  }
+  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
+  static void* PlacementNew_(const void*, void* mem,
+                             ::google::protobuf::Arena* arena);
+  static constexpr auto InternalNewImpl_();
+  static const ::google::protobuf::internal::ClassDataFull _class_data_;
+
+ public:
+  ::google::protobuf::Metadata GetMetadata() const;
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+  enum : int {
+    kApplicantFieldNumber = 2,
+    kRecipientFieldNumber = 3,
+    kErrorFieldNumber = 1,
+  };
+  // string applicant = 2;
+  void clear_applicant() ;
+  const std::string& applicant() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_applicant(Arg_&& arg, Args_... args);
+  std::string* mutable_applicant();
+  PROTOBUF_NODISCARD std::string* release_applicant();
+  void set_allocated_applicant(std::string* value);
+
+  private:
+  const std::string& _internal_applicant() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_applicant(
+      const std::string& value);
+  std::string* _internal_mutable_applicant();
+
+  public:
+  // string recipient = 3;
+  void clear_recipient() ;
+  const std::string& recipient() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_recipient(Arg_&& arg, Args_... args);
+  std::string* mutable_recipient();
+  PROTOBUF_NODISCARD std::string* release_recipient();
+  void set_allocated_recipient(std::string* value);
+
+  private:
+  const std::string& _internal_recipient() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_recipient(
+      const std::string& value);
+  std::string* _internal_mutable_recipient();
+
+  public:
+  // int32 error = 1;
+  void clear_error() ;
+  ::int32_t error() const;
+  void set_error(::int32_t value);
+
+  private:
+  ::int32_t _internal_error() const;
+  void _internal_set_error(::int32_t value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:message.FriendApprovalResponse)
+ private:
+  class _Internal;
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      2, 3, 0,
+      57, 2>
+      _table_;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+    inline explicit constexpr Impl_(
+        ::google::protobuf::internal::ConstantInitialized) noexcept;
+    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                          ::google::protobuf::Arena* arena);
+    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                          ::google::protobuf::Arena* arena, const Impl_& from,
+                          const FriendApprovalResponse& from_msg);
+    ::google::protobuf::internal::ArenaStringPtr applicant_;
+    ::google::protobuf::internal::ArenaStringPtr recipient_;
+    ::int32_t error_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_message_2eproto;
+};
+// -------------------------------------------------------------------
+
+class FriendApprovalRequest final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:message.FriendApprovalRequest) */ {
+ public:
+  inline FriendApprovalRequest() : FriendApprovalRequest(nullptr) {}
+  ~FriendApprovalRequest() PROTOBUF_FINAL;
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+  void operator delete(FriendApprovalRequest* msg, std::destroying_delete_t) {
+    SharedDtor(*msg);
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(FriendApprovalRequest));
+  }
+#endif
+
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR FriendApprovalRequest(
+      ::google::protobuf::internal::ConstantInitialized);
+
+  inline FriendApprovalRequest(const FriendApprovalRequest& from) : FriendApprovalRequest(nullptr, from) {}
+  inline FriendApprovalRequest(FriendApprovalRequest&& from) noexcept
+      : FriendApprovalRequest(nullptr, std::move(from)) {}
+  inline FriendApprovalRequest& operator=(const FriendApprovalRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline FriendApprovalRequest& operator=(FriendApprovalRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const FriendApprovalRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const FriendApprovalRequest* internal_default_instance() {
+    return reinterpret_cast<const FriendApprovalRequest*>(
+        &_FriendApprovalRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages = 8;
+  friend void swap(FriendApprovalRequest& a, FriendApprovalRequest& b) { a.Swap(&b); }
+  inline void Swap(FriendApprovalRequest* other) {
+    if (other == this) return;
+    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FriendApprovalRequest* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  FriendApprovalRequest* New(::google::protobuf::Arena* arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<FriendApprovalRequest>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const FriendApprovalRequest& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom(const FriendApprovalRequest& from) { FriendApprovalRequest::MergeImpl(*this, from); }
+
+  private:
+  static void MergeImpl(
+      ::google::protobuf::MessageLite& to_msg,
+      const ::google::protobuf::MessageLite& from_msg);
+
+  public:
+  bool IsInitialized() const {
+    return true;
+  }
+  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
+  #if defined(PROTOBUF_CUSTOM_VTABLE)
+  private:
+  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
+  static ::uint8_t* _InternalSerialize(
+      const MessageLite& msg, ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream);
+
+  public:
+  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+    return _InternalSerialize(*this, target, stream);
+  }
+  #else   // PROTOBUF_CUSTOM_VTABLE
+  ::size_t ByteSizeLong() const final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  #endif  // PROTOBUF_CUSTOM_VTABLE
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::google::protobuf::Arena* arena);
+  static void SharedDtor(MessageLite& self);
+  void InternalSwap(FriendApprovalRequest* other);
+ private:
+  template <typename T>
+  friend ::absl::string_view(
+      ::google::protobuf::internal::GetAnyMessageName)();
+  static ::absl::string_view FullMessageName() { return "message.FriendApprovalRequest"; }
+
+ protected:
+  explicit FriendApprovalRequest(::google::protobuf::Arena* arena);
+  FriendApprovalRequest(::google::protobuf::Arena* arena, const FriendApprovalRequest& from);
+  FriendApprovalRequest(::google::protobuf::Arena* arena, FriendApprovalRequest&& from) noexcept
+      : FriendApprovalRequest(arena) {
+    *this = ::std::move(from);
+  }
+  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
+  static void* PlacementNew_(const void*, void* mem,
+                             ::google::protobuf::Arena* arena);
+  static constexpr auto InternalNewImpl_();
+  static const ::google::protobuf::internal::ClassDataFull _class_data_;
+
+ public:
+  ::google::protobuf::Metadata GetMetadata() const;
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+  enum : int {
+    kApplicantFieldNumber = 1,
+    kRecipientFieldNumber = 2,
+    kGroupingFieldNumber = 3,
+    kRemarkFieldNumber = 4,
+  };
+  // string applicant = 1;
+  void clear_applicant() ;
+  const std::string& applicant() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_applicant(Arg_&& arg, Args_... args);
+  std::string* mutable_applicant();
+  PROTOBUF_NODISCARD std::string* release_applicant();
+  void set_allocated_applicant(std::string* value);
+
+  private:
+  const std::string& _internal_applicant() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_applicant(
+      const std::string& value);
+  std::string* _internal_mutable_applicant();
+
+  public:
+  // string recipient = 2;
+  void clear_recipient() ;
+  const std::string& recipient() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_recipient(Arg_&& arg, Args_... args);
+  std::string* mutable_recipient();
+  PROTOBUF_NODISCARD std::string* release_recipient();
+  void set_allocated_recipient(std::string* value);
+
+  private:
+  const std::string& _internal_recipient() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_recipient(
+      const std::string& value);
+  std::string* _internal_mutable_recipient();
+
+  public:
+  // string grouping = 3;
+  void clear_grouping() ;
+  const std::string& grouping() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_grouping(Arg_&& arg, Args_... args);
+  std::string* mutable_grouping();
+  PROTOBUF_NODISCARD std::string* release_grouping();
+  void set_allocated_grouping(std::string* value);
+
+  private:
+  const std::string& _internal_grouping() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_grouping(
+      const std::string& value);
+  std::string* _internal_mutable_grouping();
+
+  public:
+  // string remark = 4;
+  void clear_remark() ;
+  const std::string& remark() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_remark(Arg_&& arg, Args_... args);
+  std::string* mutable_remark();
+  PROTOBUF_NODISCARD std::string* release_remark();
+  void set_allocated_remark(std::string* value);
+
+  private:
+  const std::string& _internal_remark() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_remark(
+      const std::string& value);
+  std::string* _internal_mutable_remark();
+
+  public:
+  // @@protoc_insertion_point(class_scope:message.FriendApprovalRequest)
+ private:
+  class _Internal;
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      2, 4, 0,
+      70, 2>
+      _table_;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+    inline explicit constexpr Impl_(
+        ::google::protobuf::internal::ConstantInitialized) noexcept;
+    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                          ::google::protobuf::Arena* arena);
+    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                          ::google::protobuf::Arena* arena, const Impl_& from,
+                          const FriendApprovalRequest& from_msg);
+    ::google::protobuf::internal::ArenaStringPtr applicant_;
+    ::google::protobuf::internal::ArenaStringPtr recipient_;
+    ::google::protobuf::internal::ArenaStringPtr grouping_;
+    ::google::protobuf::internal::ArenaStringPtr remark_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_message_2eproto;
+};
+// -------------------------------------------------------------------
+
+class NotifyFrame final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:message.NotifyFrame) */ {
+ public:
+  inline NotifyFrame() : NotifyFrame(nullptr) {}
+  ~NotifyFrame() PROTOBUF_FINAL;
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+  void operator delete(NotifyFrame* msg, std::destroying_delete_t) {
+    SharedDtor(*msg);
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(NotifyFrame));
+  }
+#endif
+
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR NotifyFrame(
+      ::google::protobuf::internal::ConstantInitialized);
+
+  inline NotifyFrame(const NotifyFrame& from) : NotifyFrame(nullptr, from) {}
+  inline NotifyFrame(NotifyFrame&& from) noexcept
+      : NotifyFrame(nullptr, std::move(from)) {}
+  inline NotifyFrame& operator=(const NotifyFrame& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline NotifyFrame& operator=(NotifyFrame&& from) noexcept {
+    if (this == &from) return *this;
+    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const NotifyFrame& default_instance() {
+    return *internal_default_instance();
+  }
+  enum PayloadCase {
+    kFriendRequest = 2,
+    kFriendApproval = 3,
+    PAYLOAD_NOT_SET = 0,
+  };
+  static inline const NotifyFrame* internal_default_instance() {
+    return reinterpret_cast<const NotifyFrame*>(
+        &_NotifyFrame_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages = 10;
+  friend void swap(NotifyFrame& a, NotifyFrame& b) { a.Swap(&b); }
+  inline void Swap(NotifyFrame* other) {
+    if (other == this) return;
+    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(NotifyFrame* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  NotifyFrame* New(::google::protobuf::Arena* arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<NotifyFrame>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const NotifyFrame& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom(const NotifyFrame& from) { NotifyFrame::MergeImpl(*this, from); }
+
+  private:
+  static void MergeImpl(
+      ::google::protobuf::MessageLite& to_msg,
+      const ::google::protobuf::MessageLite& from_msg);
+
+  public:
+  bool IsInitialized() const {
+    return true;
+  }
+  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
+  #if defined(PROTOBUF_CUSTOM_VTABLE)
+  private:
+  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
+  static ::uint8_t* _InternalSerialize(
+      const MessageLite& msg, ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream);
+
+  public:
+  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+    return _InternalSerialize(*this, target, stream);
+  }
+  #else   // PROTOBUF_CUSTOM_VTABLE
+  ::size_t ByteSizeLong() const final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  #endif  // PROTOBUF_CUSTOM_VTABLE
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::google::protobuf::Arena* arena);
+  static void SharedDtor(MessageLite& self);
+  void InternalSwap(NotifyFrame* other);
+ private:
+  template <typename T>
+  friend ::absl::string_view(
+      ::google::protobuf::internal::GetAnyMessageName)();
+  static ::absl::string_view FullMessageName() { return "message.NotifyFrame"; }
+
+ protected:
+  explicit NotifyFrame(::google::protobuf::Arena* arena);
+  NotifyFrame(::google::protobuf::Arena* arena, const NotifyFrame& from);
+  NotifyFrame(::google::protobuf::Arena* arena, NotifyFrame&& from) noexcept
+      : NotifyFrame(arena) {
+    *this = ::std::move(from);
+  }
+  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
+  static void* PlacementNew_(const void*, void* mem,
+                             ::google::protobuf::Arena* arena);
+  static constexpr auto InternalNewImpl_();
+  static const ::google::protobuf::internal::ClassDataFull _class_data_;
+
+ public:
+  ::google::protobuf::Metadata GetMetadata() const;
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+  enum : int {
+    kSeqFieldNumber = 1,
+    kFriendRequestFieldNumber = 2,
+    kFriendApprovalFieldNumber = 3,
+  };
+  // uint64 seq = 1;
+  void clear_seq() ;
+  ::uint64_t seq() const;
+  void set_seq(::uint64_t value);
+
+  private:
+  ::uint64_t _internal_seq() const;
+  void _internal_set_seq(::uint64_t value);
+
+  public:
+  // .message.FriendRequest friend_request = 2;
+  bool has_friend_request() const;
+  private:
+  bool _internal_has_friend_request() const;
+
+  public:
+  void clear_friend_request() ;
+  const ::message::FriendRequest& friend_request() const;
+  PROTOBUF_NODISCARD ::message::FriendRequest* release_friend_request();
+  ::message::FriendRequest* mutable_friend_request();
+  void set_allocated_friend_request(::message::FriendRequest* value);
+  void unsafe_arena_set_allocated_friend_request(::message::FriendRequest* value);
+  ::message::FriendRequest* unsafe_arena_release_friend_request();
+
+  private:
+  const ::message::FriendRequest& _internal_friend_request() const;
+  ::message::FriendRequest* _internal_mutable_friend_request();
+
+  public:
+  // .message.FriendApprovalRequest friend_approval = 3;
+  bool has_friend_approval() const;
+  private:
+  bool _internal_has_friend_approval() const;
+
+  public:
+  void clear_friend_approval() ;
+  const ::message::FriendApprovalRequest& friend_approval() const;
+  PROTOBUF_NODISCARD ::message::FriendApprovalRequest* release_friend_approval();
+  ::message::FriendApprovalRequest* mutable_friend_approval();
+  void set_allocated_friend_approval(::message::FriendApprovalRequest* value);
+  void unsafe_arena_set_allocated_friend_approval(::message::FriendApprovalRequest* value);
+  ::message::FriendApprovalRequest* unsafe_arena_release_friend_approval();
+
+  private:
+  const ::message::FriendApprovalRequest& _internal_friend_approval() const;
+  ::message::FriendApprovalRequest* _internal_mutable_friend_approval();
+
+  public:
+  void clear_payload();
+  PayloadCase payload_case() const;
+  // @@protoc_insertion_point(class_scope:message.NotifyFrame)
+ private:
+  class _Internal;
+  void set_has_friend_request();
+  void set_has_friend_approval();
+  inline bool has_payload() const;
+  inline void clear_has_payload();
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 3, 2,
+      0, 2>
+      _table_;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+    inline explicit constexpr Impl_(
+        ::google::protobuf::internal::ConstantInitialized) noexcept;
+    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                          ::google::protobuf::Arena* arena);
+    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                          ::google::protobuf::Arena* arena, const Impl_& from,
+                          const NotifyFrame& from_msg);
+    ::uint64_t seq_;
+    union PayloadUnion {
+      constexpr PayloadUnion() : _constinit_{} {}
+      ::google::protobuf::internal::ConstantInitialized _constinit_;
+      ::message::FriendRequest* friend_request_;
+      ::message::FriendApprovalRequest* friend_approval_;
+    } payload_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
+    ::uint32_t _oneof_case_[1];
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_message_2eproto;
+};
+// -------------------------------------------------------------------
+
+class NotifyBatch final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:message.NotifyBatch) */ {
+ public:
+  inline NotifyBatch() : NotifyBatch(nullptr) {}
+  ~NotifyBatch() PROTOBUF_FINAL;
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+  void operator delete(NotifyBatch* msg, std::destroying_delete_t) {
+    SharedDtor(*msg);
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(NotifyBatch));
+  }
+#endif
+
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR NotifyBatch(
+      ::google::protobuf::internal::ConstantInitialized);
+
+  inline NotifyBatch(const NotifyBatch& from) : NotifyBatch(nullptr, from) {}
+  inline NotifyBatch(NotifyBatch&& from) noexcept
+      : NotifyBatch(nullptr, std::move(from)) {}
+  inline NotifyBatch& operator=(const NotifyBatch& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline NotifyBatch& operator=(NotifyBatch&& from) noexcept {
+    if (this == &from) return *this;
+    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const NotifyBatch& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const NotifyBatch* internal_default_instance() {
+    return reinterpret_cast<const NotifyBatch*>(
+        &_NotifyBatch_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages = 11;
+  friend void swap(NotifyBatch& a, NotifyBatch& b) { a.Swap(&b); }
+  inline void Swap(NotifyBatch* other) {
+    if (other == this) return;
+    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(NotifyBatch* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  NotifyBatch* New(::google::protobuf::Arena* arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<NotifyBatch>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const NotifyBatch& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom(const NotifyBatch& from) { NotifyBatch::MergeImpl(*this, from); }
+
+  private:
+  static void MergeImpl(
+      ::google::protobuf::MessageLite& to_msg,
+      const ::google::protobuf::MessageLite& from_msg);
+
+  public:
+  bool IsInitialized() const {
+    return true;
+  }
+  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
+  #if defined(PROTOBUF_CUSTOM_VTABLE)
+  private:
+  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
+  static ::uint8_t* _InternalSerialize(
+      const MessageLite& msg, ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream);
+
+  public:
+  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+    return _InternalSerialize(*this, target, stream);
+  }
+  #else   // PROTOBUF_CUSTOM_VTABLE
+  ::size_t ByteSizeLong() const final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  #endif  // PROTOBUF_CUSTOM_VTABLE
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::google::protobuf::Arena* arena);
+  static void SharedDtor(MessageLite& self);
+  void InternalSwap(NotifyBatch* other);
+ private:
+  template <typename T>
+  friend ::absl::string_view(
+      ::google::protobuf::internal::GetAnyMessageName)();
+  static ::absl::string_view FullMessageName() { return "message.NotifyBatch"; }
+
+ protected:
+  explicit NotifyBatch(::google::protobuf::Arena* arena);
+  NotifyBatch(::google::protobuf::Arena* arena, const NotifyBatch& from);
+  NotifyBatch(::google::protobuf::Arena* arena, NotifyBatch&& from) noexcept
+      : NotifyBatch(arena) {
+    *this = ::std::move(from);
+  }
+  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
+  static void* PlacementNew_(const void*, void* mem,
+                             ::google::protobuf::Arena* arena);
+  static constexpr auto InternalNewImpl_();
+  static const ::google::protobuf::internal::ClassDataFull _class_data_;
+
+ public:
+  ::google::protobuf::Metadata GetMetadata() const;
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+  enum : int {
+    kFramesFieldNumber = 3,
+    kSourceFieldNumber = 1,
+    kEpochFieldNumber = 2,
+  };
+  // repeated .message.NotifyFrame frames = 3;
+  int frames_size() const;
+  private:
+  int _internal_frames_size() const;
+
+  public:
+  void clear_frames() ;
+  ::message::NotifyFrame* mutable_frames(int index);
+  ::google::protobuf::RepeatedPtrField<::message::NotifyFrame>* mutable_frames();
+
+  private:
+  const ::google::protobuf::RepeatedPtrField<::message::NotifyFrame>& _internal_frames() const;
+  ::google::protobuf::RepeatedPtrField<::message::NotifyFrame>* _internal_mutable_frames();
+  public:
+  const ::message::NotifyFrame& frames(int index) const;
+  ::message::NotifyFrame* add_frames();
+  const ::google::protobuf::RepeatedPtrField<::message::NotifyFrame>& frames() const;
+  // string source = 1;
+  void clear_source() ;
+  const std::string& source() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_source(Arg_&& arg, Args_... args);
+  std::string* mutable_source();
+  PROTOBUF_NODISCARD std::string* release_source();
+  void set_allocated_source(std::string* value);
+
+  private:
+  const std::string& _internal_source() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_source(
+      const std::string& value);
+  std::string* _internal_mutable_source();
+
+  public:
+  // uint64 epoch = 2;
+  void clear_epoch() ;
+  ::uint64_t epoch() const;
+  void set_epoch(::uint64_t value);
+
+  private:
+  ::uint64_t _internal_epoch() const;
+  void _internal_set_epoch(::uint64_t value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:message.NotifyBatch)
+ private:
+  class _Internal;
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      2, 3, 1,
+      34, 2>
+      _table_;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+    inline explicit constexpr Impl_(
+        ::google::protobuf::internal::ConstantInitialized) noexcept;
+    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                          ::google::protobuf::Arena* arena);
+    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                          ::google::protobuf::Arena* arena, const Impl_& from,
+                          const NotifyBatch& from_msg);
+    ::google::protobuf::RepeatedPtrField< ::message::NotifyFrame > frames_;
+    ::google::protobuf::internal::ArenaStringPtr source_;
+    ::uint64_t epoch_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_message_2eproto;
+};
+
+// ===================================================================
+
+
+
+
+// ===================================================================
+
+
+#ifdef __GNUC__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// GetVerifyRequest
+
+// string email = 1;
+inline void GetVerifyRequest::clear_email() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.email_.ClearToEmpty();
+}
+inline const std::string& GetVerifyRequest::email() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:message.GetVerifyRequest.email)
+  return _internal_email();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void GetVerifyRequest::set_email(Arg_&& arg,
+                                                     Args_... args) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.email_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:message.GetVerifyRequest.email)
+}
+inline std::string* GetVerifyRequest::mutable_email() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_email();
+  // @@protoc_insertion_point(field_mutable:message.GetVerifyRequest.email)
+  return _s;
+}
+inline const std::string& GetVerifyRequest::_internal_email() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.email_.Get();
+}
+inline void GetVerifyRequest::_internal_set_email(const std::string& value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.email_.Set(value, GetArena());
+}
+inline std::string* GetVerifyRequest::_internal_mutable_email() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _impl_.email_.Mutable( GetArena());
+}
+inline std::string* GetVerifyRequest::release_email() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:message.GetVerifyRequest.email)
+  return _impl_.email_.Release();
+}
+inline void GetVerifyRequest::set_allocated_email(std::string* value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.email_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.email_.IsDefault()) {
+    _impl_.email_.Set("", GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:message.GetVerifyRequest.email)
+}
+
+// -------------------------------------------------------------------
+
+// GetVerifyResponse
+
+// int32 error = 1;
+inline void GetVerifyResponse::clear_error() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.error_ = 0;
+}
+inline ::int32_t GetVerifyResponse::error() const {
+  // @@protoc_insertion_point(field_get:message.GetVerifyResponse.error)
+  return _internal_error();
+}
+inline void GetVerifyResponse::set_error(::int32_t value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:message.GetVerifyResponse.error)
+}
+inline ::int32_t GetVerifyResponse::_internal_error() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.error_;
+}
+inline void GetVerifyResponse::_internal_set_error(::int32_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.error_ = value;
+}
+
+// string email = 2;
+inline void GetVerifyResponse::clear_email() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.email_.ClearToEmpty();
+}
+inline const std::string& GetVerifyResponse::email() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:message.GetVerifyResponse.email)
+  return _internal_email();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void GetVerifyResponse::set_email(Arg_&& arg,
+                                                     Args_... args) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.email_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:message.GetVerifyResponse.email)
+}
+inline std::string* GetVerifyResponse::mutable_email() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_email();
+  // @@protoc_insertion_point(field_mutable:message.GetVerifyResponse.email)
+  return _s;
+}
+inline const std::string& GetVerifyResponse::_internal_email() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.email_.Get();
+}
+inline void GetVerifyResponse::_internal_set_email(const std::string& value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.email_.Set(value, GetArena());
+}
+inline std::string* GetVerifyResponse::_internal_mutable_email() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _impl_.email_.Mutable( GetArena());
+}
+inline std::string* GetVerifyResponse::release_email() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:message.GetVerifyResponse.email)
+  return _impl_.email_.Release();
+}
+inline void GetVerifyResponse::set_allocated_email(std::string* value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.email_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.email_.IsDefault()) {
+    _impl_.email_.Set("", GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:message.GetVerifyResponse.email)
+}
+
+// string code = 3;
+inline void GetVerifyResponse::clear_code() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.code_.ClearToEmpty();
+}
+inline const std::string& GetVerifyResponse::code() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:message.GetVerifyResponse.code)
+  return _internal_code();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void GetVerifyResponse::set_code(Arg_&& arg,
+                                                     Args_... args) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.code_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:message.GetVerifyResponse.code)
+}
+inline std::string* GetVerifyResponse::mutable_code() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_code();
+  // @@protoc_insertion_point(field_mutable:message.GetVerifyResponse.code)
+  return _s;
+}
+inline const std::string& GetVerifyResponse::_internal_code() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.code_.Get();
+}
+inline void GetVerifyResponse::_internal_set_code(const std::string& value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.code_.Set(value, GetArena());
+}
+inline std::string* GetVerifyResponse::_internal_mutable_code() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _impl_.code_.Mutable( GetArena());
+}
+inline std::string* GetVerifyResponse::release_code() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:message.GetVerifyResponse.code)
+  return _impl_.code_.Release();
+}
+inline void GetVerifyResponse::set_allocated_code(std::string* value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.code_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.code_.IsDefault()) {
+    _impl_.code_.Set("", GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:message.GetVerifyResponse.code)
+}
+
+// -------------------------------------------------------------------
+
+// GetChatServerRequest
+
+// string uid = 1;
+inline void GetChatServerRequest::clear_uid() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.uid_.ClearToEmpty();
+}
+inline const std::string& GetChatServerRequest::uid() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:message.GetChatServerRequest.uid)
+  return _internal_uid();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void GetChatServerRequest::set_uid(Arg_&& arg,
+                                                     Args_... args) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.uid_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:message.GetChatServerRequest.uid)
+}
+inline std::string* GetChatServerRequest::mutable_uid() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_uid();
+  // @@protoc_insertion_point(field_mutable:message.GetChatServerRequest.uid)
+  return _s;
+}
+inline const std::string& GetChatServerRequest::_internal_uid() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.uid_.Get();
+}
+inline void GetChatServerRequest::_internal_set_uid(const std::string& value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.uid_.Set(value, GetArena());
+}
+inline std::string* GetChatServerRequest::_internal_mutable_uid() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _impl_.uid_.Mutable( GetArena());
+}
+inline std::string* GetChatServerRequest::release_uid() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:message.GetChatServerRequest.uid)
+  return _impl_.uid_.Release();
+}
+inline void GetChatServerRequest::set_allocated_uid(std::string* value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.uid_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.uid_.IsDefault()) {
+    _impl_.uid_.Set("", GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:message.GetChatServerRequest.uid)
+}
+
+// -------------------------------------------------------------------
+
+// GetChatServerResponse
+
+// int32 error = 1;
+inline void GetChatServerResponse::clear_error() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.error_ = 0;
+}
+inline ::int32_t GetChatServerResponse::error() const {
+  // @@protoc_insertion_point(field_get:message.GetChatServerResponse.error)
+  return _internal_error();
+}
+inline void GetChatServerResponse::set_error(::int32_t value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:message.GetChatServerResponse.error)
+}
+inline ::int32_t GetChatServerResponse::_internal_error() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.error_;
+}
+inline void GetChatServerResponse::_internal_set_error(::int32_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.error_ = value;
+}
+
+// string host = 2;
+inline void GetChatServerResponse::clear_host() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.host_.ClearToEmpty();
+}
+inline const std::string& GetChatServerResponse::host() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:message.GetChatServerResponse.host)
+  return _internal_host();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void GetChatServerResponse::set_host(Arg_&& arg,
+                                                     Args_... args) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.host_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:message.GetChatServerResponse.host)
+}
+inline std::string* GetChatServerResponse::mutable_host() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_host();
+  // @@protoc_insertion_point(field_mutable:message.GetChatServerResponse.host)
+  return _s;
+}
+inline const std::string& GetChatServerResponse::_internal_host() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.host_.Get();
+}
+inline void GetChatServerResponse::_internal_set_host(const std::string& value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.host_.Set(value, GetArena());
+}
+inline std::string* GetChatServerResponse::_internal_mutable_host() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _impl_.host_.Mutable( GetArena());
+}
+inline std::string* GetChatServerResponse::release_host() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:message.GetChatServerResponse.host)
+  return _impl_.host_.Release();
+}
+inline void GetChatServerResponse::set_allocated_host(std::string* value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.host_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.host_.IsDefault()) {
+    _impl_.host_.Set("", GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:message.GetChatServerResponse.host)
+}
+
+// string port = 3;
+inline void GetChatServerResponse::clear_port() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.port_.ClearToEmpty();
+}
+inline const std::string& GetChatServerResponse::port() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:message.GetChatServerResponse.port)
+  return _internal_port();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void GetChatServerResponse::set_port(Arg_&& arg,
+                                                     Args_... args) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.port_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:message.GetChatServerResponse.port)
+}
+inline std::string* GetChatServerResponse::mutable_port() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_port();
+  // @@protoc_insertion_point(field_mutable:message.GetChatServerResponse.port)
+  return _s;
+}
+inline const std::string& GetChatServerResponse::_internal_port() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.port_.Get();
+}
+inline void GetChatServerResponse::_internal_set_port(const std::string& value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.port_.Set(value, GetArena());
+}
+inline std::string* GetChatServerResponse::_internal_mutable_port() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _impl_.port_.Mutable( GetArena());
+}
+inline std::string* GetChatServerResponse::release_port() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:message.GetChatServerResponse.port)
+  return _impl_.port_.Release();
+}
+inline void GetChatServerResponse::set_allocated_port(std::string* value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.port_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.port_.IsDefault()) {
+    _impl_.port_.Set("", GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:message.GetChatServerResponse.port)
+}
+
+// string token = 4;
+inline void GetChatServerResponse::clear_token() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.token_.ClearToEmpty();
+}
+inline const std::string& GetChatServerResponse::token() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:message.GetChatServerResponse.token)
+  return _internal_token();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void GetChatServerResponse::set_token(Arg_&& arg,
+                                                     Args_... args) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.token_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:message.GetChatServerResponse.token)
+}
+inline std::string* GetChatServerResponse::mutable_token() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_token();
+  // @@protoc_insertion_point(field_mutable:message.GetChatServerResponse.token)
+  return _s;
+}
+inline const std::string& GetChatServerResponse::_internal_token() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.token_.Get();
+}
+inline void GetChatServerResponse::_internal_set_token(const std::string& value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.token_.Set(value, GetArena());
+}
+inline std::string* GetChatServerResponse::_internal_mutable_token() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _impl_.token_.Mutable( GetArena());
+}
+inline std::string* GetChatServerResponse::release_token() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:message.GetChatServerResponse.token)
+  return _impl_.token_.Release();
+}
+inline void GetChatServerResponse::set_allocated_token(std::string* value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.token_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.token_.IsDefault()) {
+    _impl_.token_.Set("", GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:message.GetChatServerResponse.token)
+}
+
+// -------------------------------------------------------------------
+
+// LoginRequest
+
+// string uid = 1;
+inline void LoginRequest::clear_uid() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.uid_.ClearToEmpty();
+}
+inline const std::string& LoginRequest::uid() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:message.LoginRequest.uid)
+  return _internal_uid();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void LoginRequest::set_uid(Arg_&& arg,
+                                                     Args_... args) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.uid_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:message.LoginRequest.uid)
+}
+inline std::string* LoginRequest::mutable_uid() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_uid();
+  // @@protoc_insertion_point(field_mutable:message.LoginRequest.uid)
+  return _s;
+}
+inline const std::string& LoginRequest::_internal_uid() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.uid_.Get();
+}
+inline void LoginRequest::_internal_set_uid(const std::string& value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.uid_.Set(value, GetArena());
+}
+inline std::string* LoginRequest::_internal_mutable_uid() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _impl_.uid_.Mutable( GetArena());
+}
+inline std::string* LoginRequest::release_uid() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:message.LoginRequest.uid)
+  return _impl_.uid_.Release();
+}
+inline void LoginRequest::set_allocated_uid(std::string* value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.uid_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.uid_.IsDefault()) {
+    _impl_.uid_.Set("", GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:message.LoginRequest.uid)
+}
+
+// string token = 2;
+inline void LoginRequest::clear_token() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.token_.ClearToEmpty();
+}
+inline const std::string& LoginRequest::token() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:message.LoginRequest.token)
+  return _internal_token();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void LoginRequest::set_token(Arg_&& arg,
+                                                     Args_... args) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.token_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:message.LoginRequest.token)
+}
+inline std::string* LoginRequest::mutable_token() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_token();
+  // @@protoc_insertion_point(field_mutable:message.LoginRequest.token)
+  return _s;
+}
+inline const std::string& LoginRequest::_internal_token() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.token_.Get();
+}
+inline void LoginRequest::_internal_set_token(const std::string& value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.token_.Set(value, GetArena());
+}
+inline std::string* LoginRequest::_internal_mutable_token() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _impl_.token_.Mutable( GetArena());
+}
+inline std::string* LoginRequest::release_token() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:message.LoginRequest.token)
+  return _impl_.token_.Release();
+}
+inline void LoginRequest::set_allocated_token(std::string* value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.token_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.token_.IsDefault()) {
+    _impl_.token_.Set("", GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:message.LoginRequest.token)
+}
+
+// -------------------------------------------------------------------
+
+// LoginResponse
+
+// int32 error = 1;
+inline void LoginResponse::clear_error() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.error_ = 0;
+}
+inline ::int32_t LoginResponse::error() const {
+  // @@protoc_insertion_point(field_get:message.LoginResponse.error)
+  return _internal_error();
+}
+inline void LoginResponse::set_error(::int32_t value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:message.LoginResponse.error)
+}
+inline ::int32_t LoginResponse::_internal_error() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.error_;
+}
+inline void LoginResponse::_internal_set_error(::int32_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.error_ = value;
+}
+
+// string uid = 2;
+inline void LoginResponse::clear_uid() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.uid_.ClearToEmpty();
+}
+inline const std::string& LoginResponse::uid() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:message.LoginResponse.uid)
+  return _internal_uid();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void LoginResponse::set_uid(Arg_&& arg,
+                                                     Args_... args) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.uid_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:message.LoginResponse.uid)
+}
+inline std::string* LoginResponse::mutable_uid() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_uid();
+  // @@protoc_insertion_point(field_mutable:message.LoginResponse.uid)
+  return _s;
+}
+inline const std::string& LoginResponse::_internal_uid() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.uid_.Get();
+}
+inline void LoginResponse::_internal_set_uid(const std::string& value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.uid_.Set(value, GetArena());
+}
+inline std::string* LoginResponse::_internal_mutable_uid() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _impl_.uid_.Mutable( GetArena());
+}
+inline std::string* LoginResponse::release_uid() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:message.LoginResponse.uid)
+  return _impl_.uid_.Release();
+}
+inline void LoginResponse::set_allocated_uid(std::string* value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.uid_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.uid_.IsDefault()) {
+    _impl_.uid_.Set("", GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:message.LoginResponse.uid)
+}
+
+// string token = 3;
+inline void LoginResponse::clear_token() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.token_.ClearToEmpty();
+}
+inline const std::string& LoginResponse::token() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:message.LoginResponse.token)
+  return _internal_token();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void LoginResponse::set_token(Arg_&& arg,
+                                                     Args_... args) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.token_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:message.LoginResponse.token)
+}
+inline std::string* LoginResponse::mutable_token() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_token();
+  // @@protoc_insertion_point(field_mutable:message.LoginResponse.token)
+  return _s;
+}
+inline const std::string& LoginResponse::_internal_token() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.token_.Get();
+}
+inline void LoginResponse::_internal_set_token(const std::string& value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.token_.Set(value, GetArena());
+}
+inline std::string* LoginResponse::_internal_mutable_token() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _impl_.token_.Mutable( GetArena());
+}
+inline std::string* LoginResponse::release_token() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:message.LoginResponse.token)
+  return _impl_.token_.Release();
+}
+inline void LoginResponse::set_allocated_token(std::string* value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.token_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.token_.IsDefault()) {
+    _impl_.token_.Set("", GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:message.LoginResponse.token)
+}
+
+// -------------------------------------------------------------------
+
+// FriendRequest
+
+// string applicant = 1;
+inline void FriendRequest::clear_applicant() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.applicant_.ClearToEmpty();
+}
+inline const std::string& FriendRequest::applicant() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:message.FriendRequest.applicant)
+  return _internal_applicant();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void FriendRequest::set_applicant(Arg_&& arg,
+                                                     Args_... args) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.applicant_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:message.FriendRequest.applicant)
+}
+inline std::string* FriendRequest::mutable_applicant() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_applicant();
+  // @@protoc_insertion_point(field_mutable:message.FriendRequest.applicant)
+  return _s;
+}
+inline const std::string& FriendRequest::_internal_applicant() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.applicant_.Get();
+}
+inline void FriendRequest::_internal_set_applicant(const std::string& value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.applicant_.Set(value, GetArena());
+}
+inline std::string* FriendRequest::_internal_mutable_applicant() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _impl_.applicant_.Mutable( GetArena());
+}
+inline std::string* FriendRequest::release_applicant() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:message.FriendRequest.applicant)
+  return _impl_.applicant_.Release();
+}
+inline void FriendRequest::set_allocated_applicant(std::string* value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.applicant_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.applicant_.IsDefault()) {
+    _impl_.applicant_.Set("", GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:message.FriendRequest.applicant)
+}
+
+// string recipient = 2;
+inline void FriendRequest::clear_recipient() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.recipient_.ClearToEmpty();
+}
+inline const std::string& FriendRequest::recipient() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:message.FriendRequest.recipient)
+  return _internal_recipient();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void FriendRequest::set_recipient(Arg_&& arg,
+                                                     Args_... args) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.recipient_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:message.FriendRequest.recipient)
+}
+inline std::string* FriendRequest::mutable_recipient() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_recipient();
+  // @@protoc_insertion_point(field_mutable:message.FriendRequest.recipient)
+  return _s;
+}
+inline const std::string& FriendRequest::_internal_recipient() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.recipient_.Get();
+}
+inline void FriendRequest::_internal_set_recipient(const std::string& value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.recipient_.Set(value, GetArena());
+}
+inline std::string* FriendRequest::_internal_mutable_recipient() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _impl_.recipient_.Mutable( GetArena());
+}
+inline std::string* FriendRequest::release_recipient() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:message.FriendRequest.recipient)
+  return _impl_.recipient_.Release();
+}
+inline void FriendRequest::set_allocated_recipient(std::string* value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.recipient_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.recipient_.IsDefault()) {
+    _impl_.recipient_.Set("", GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:message.FriendRequest.recipient)
+}
+
+// string username = 3;
+inline void FriendRequest::clear_username() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.username_.ClearToEmpty();
+}
+inline const std::string& FriendRequest::username() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:message.FriendRequest.username)
+  return _internal_username();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void FriendRequest::set_username(Arg_&& arg,
+                                                     Args_... args) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.username_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:message.FriendRequest.username)
+}
+inline std::string* FriendRequest::mutable_username() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:message.FriendRequest.username)
+  return _s;
+}
+inline const std::string& FriendRequest::_internal_username() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.username_.Get();
+}
+inline void FriendRequest::_internal_set_username(const std::string& value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.username_.Set(value, GetArena());
+}
+inline std::string* FriendRequest::_internal_mutable_username() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _impl_.username_.Mutable( GetArena());
+}
+inline std::string* FriendRequest::release_username() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:message.FriendRequest.username)
+  return _impl_.username_.Release();
+}
+inline void FriendRequest::set_allocated_username(std::string* value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.username_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:message.FriendRequest.username)
+}
+
+// string avatar = 4;
+inline void FriendRequest::clear_avatar() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.avatar_.ClearToEmpty();
+}
+inline const std::string& FriendRequest::avatar() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:message.FriendRequest.avatar)
+  return _internal_avatar();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void FriendRequest::set_avatar(Arg_&& arg,
+                                                     Args_... args) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.avatar_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:message.FriendRequest.avatar)
+}
+inline std::string* FriendRequest::mutable_avatar() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_avatar();
+  // @@protoc_insertion_point(field_mutable:message.FriendRequest.avatar)
+  return _s;
+}
+inline const std::string& FriendRequest::_internal_avatar() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.avatar_.Get();
+}
+inline void FriendRequest::_internal_set_avatar(const std::string& value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.avatar_.Set(value, GetArena());
+}
+inline std::string* FriendRequest::_internal_mutable_avatar() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _impl_.avatar_.Mutable( GetArena());
+}
+inline std::string* FriendRequest::release_avatar() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:message.FriendRequest.avatar)
+  return _impl_.avatar_.Release();
+}
+inline void FriendRequest::set_allocated_avatar(std::string* value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.avatar_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.avatar_.IsDefault()) {
+    _impl_.avatar_.Set("", GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:message.FriendRequest.avatar)
+}
+
+// string message = 5;
+inline void FriendRequest::clear_message() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.message_.ClearToEmpty();
+}
+inline const std::string& FriendRequest::message() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:message.FriendRequest.message)
+  return _internal_message();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void FriendRequest::set_message(Arg_&& arg,
+                                                     Args_... args) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.message_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:message.FriendRequest.message)
+}
+inline std::string* FriendRequest::mutable_message() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_message();
+  // @@protoc_insertion_point(field_mutable:message.FriendRequest.message)
+  return _s;
+}
+inline const std::string& FriendRequest::_internal_message() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.message_.Get();
+}
+inline void FriendRequest::_internal_set_message(const std::string& value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.message_.Set(value, GetArena());
+}
+inline std::string* FriendRequest::_internal_mutable_message() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _impl_.message_.Mutable( GetArena());
+}
+inline std::string* FriendRequest::release_message() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:message.FriendRequest.message)
+  return _impl_.message_.Release();
+}
+inline void FriendRequest::set_allocated_message(std::string* value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.message_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.message_.IsDefault()) {
+    _impl_.message_.Set("", GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:message.FriendRequest.message)
+}
+
+// int64 time = 6;
+inline void FriendRequest::clear_time() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.time_ = ::int64_t{0};
+}
+inline ::int64_t FriendRequest::time() const {
+  // @@protoc_insertion_point(field_get:message.FriendRequest.time)
+  return _internal_time();
+}
+inline void FriendRequest::set_time(::int64_t value) {
+  _internal_set_time(value);
+  // @@protoc_insertion_point(field_set:message.FriendRequest.time)
+}
+inline ::int64_t FriendRequest::_internal_time() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.time_;
+}
+inline void FriendRequest::_internal_set_time(::int64_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.time_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// FriendResponse
+
+// int32 error = 1;
+inline void FriendResponse::clear_error() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.error_ = 0;
+}
+inline ::int32_t FriendResponse::error() const {
+  // @@protoc_insertion_point(field_get:message.FriendResponse.error)
+  return _internal_error();
+}
+inline void FriendResponse::set_error(::int32_t value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:message.FriendResponse.error)
+}
+inline ::int32_t FriendResponse::_internal_error() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.error_;
+}
+inline void FriendResponse::_internal_set_error(::int32_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.error_ = value;
+}
+
+// string applicant = 2;
+inline void FriendResponse::clear_applicant() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.applicant_.ClearToEmpty();
+}
+inline const std::string& FriendResponse::applicant() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:message.FriendResponse.applicant)
+  return _internal_applicant();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void FriendResponse::set_applicant(Arg_&& arg,
+                                                     Args_... args) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.applicant_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:message.FriendResponse.applicant)
+}
+inline std::string* FriendResponse::mutable_applicant() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_applicant();
+  // @@protoc_insertion_point(field_mutable:message.FriendResponse.applicant)
+  return _s;
+}
+inline const std::string& FriendResponse::_internal_applicant() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.applicant_.Get();
+}
+inline void FriendResponse::_internal_set_applicant(const std::string& value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.applicant_.Set(value, GetArena());
+}
+inline std::string* FriendResponse::_internal_mutable_applicant() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _impl_.applicant_.Mutable( GetArena());
+}
+inline std::string* FriendResponse::release_applicant() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:message.FriendResponse.applicant)
+  return _impl_.applicant_.Release();
+}
+inline void FriendResponse::set_allocated_applicant(std::string* value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.applicant_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.applicant_.IsDefault()) {
+    _impl_.applicant_.Set("", GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:message.FriendResponse.applicant)
+}
+
+// string recipient = 3;
+inline void FriendResponse::clear_recipient() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.recipient_.ClearToEmpty();
+}
+inline const std::string& FriendResponse::recipient() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:message.FriendResponse.recipient)
+  return _internal_recipient();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void FriendResponse::set_recipient(Arg_&& arg,
+                                                     Args_... args) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.recipient_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:message.FriendResponse.recipient)
+}
+inline std::string* FriendResponse::mutable_recipient() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_recipient();
+  // @@protoc_insertion_point(field_mutable:message.FriendResponse.recipient)
+  return _s;
+}
+inline const std::string& FriendResponse::_internal_recipient() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.recipient_.Get();
+}
+inline void FriendResponse::_internal_set_recipient(const std::string& value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.recipient_.Set(value, GetArena());
+}
+inline std::string* FriendResponse::_internal_mutable_recipient() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _impl_.recipient_.Mutable( GetArena());
+}
+inline std::string* FriendResponse::release_recipient() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:message.FriendResponse.recipient)
+  return _impl_.recipient_.Release();
+}
+inline void FriendResponse::set_allocated_recipient(std::string* value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.recipient_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.recipient_.IsDefault()) {
+    _impl_.recipient_.Set("", GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:message.FriendResponse.recipient)
+}
+
+// -------------------------------------------------------------------
+
+// FriendApprovalRequest
+
+// string applicant = 1;
+inline void FriendApprovalRequest::clear_applicant() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.applicant_.ClearToEmpty();
+}
+inline const std::string& FriendApprovalRequest::applicant() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:message.FriendApprovalRequest.applicant)
+  return _internal_applicant();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void FriendApprovalRequest::set_applicant(Arg_&& arg,
+                                                     Args_... args) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.applicant_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:message.FriendApprovalRequest.applicant)
+}
+inline std::string* FriendApprovalRequest::mutable_applicant() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_applicant();
+  // @@protoc_insertion_point(field_mutable:message.FriendApprovalRequest.applicant)
+  return _s;
+}
+inline const std::string& FriendApprovalRequest::_internal_applicant() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.applicant_.Get();
+}
+inline void FriendApprovalRequest::_internal_set_applicant(const std::string& value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.applicant_.Set(value, GetArena());
+}
+inline std::string* FriendApprovalRequest::_internal_mutable_applicant() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _impl_.applicant_.Mutable( GetArena());
+}
+inline std::string* FriendApprovalRequest::release_applicant() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:message.FriendApprovalRequest.applicant)
+  return _impl_.applicant_.Release();
+}
+inline void FriendApprovalRequest::set_allocated_applicant(std::string* value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.applicant_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.applicant_.IsDefault()) {
+    _impl_.applicant_.Set("", GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:message.FriendApprovalRequest.applicant)
+}
+
+// string recipient = 2;
+inline void FriendApprovalRequest::clear_recipient() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.recipient_.ClearToEmpty();
+}
+inline const std::string& FriendApprovalRequest::recipient() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:message.FriendApprovalRequest.recipient)
+  return _internal_recipient();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void FriendApprovalRequest::set_recipient(Arg_&& arg,
+                                                     Args_... args) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.recipient_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:message.FriendApprovalRequest.recipient)
+}
+inline std::string* FriendApprovalRequest::mutable_recipient() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_recipient();
+  // @@protoc_insertion_point(field_mutable:message.FriendApprovalRequest.recipient)
+  return _s;
+}
+inline const std::string& FriendApprovalRequest::_internal_recipient() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.recipient_.Get();
+}
+inline void FriendApprovalRequest::_internal_set_recipient(const std::string& value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.recipient_.Set(value, GetArena());
+}
+inline std::string* FriendApprovalRequest::_internal_mutable_recipient() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _impl_.recipient_.Mutable( GetArena());
+}
+inline std::string* FriendApprovalRequest::release_recipient() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:message.FriendApprovalRequest.recipient)
+  return _impl_.recipient_.Release();
+}
+inline void FriendApprovalRequest::set_allocated_recipient(std::string* value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.recipient_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.recipient_.IsDefault()) {
+    _impl_.recipient_.Set("", GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:message.FriendApprovalRequest.recipient)
+}
+
+// string grouping = 3;
+inline void FriendApprovalRequest::clear_grouping() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.grouping_.ClearToEmpty();
+}
+inline const std::string& FriendApprovalRequest::grouping() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:message.FriendApprovalRequest.grouping)
+  return _internal_grouping();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void FriendApprovalRequest::set_grouping(Arg_&& arg,
+                                                     Args_... args) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.grouping_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:message.FriendApprovalRequest.grouping)
+}
+inline std::string* FriendApprovalRequest::mutable_grouping() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_grouping();
+  // @@protoc_insertion_point(field_mutable:message.FriendApprovalRequest.grouping)
+  return _s;
+}
+inline const std::string& FriendApprovalRequest::_internal_grouping() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.grouping_.Get();
+}
+inline void FriendApprovalRequest::_internal_set_grouping(const std::string& value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.grouping_.Set(value, GetArena());
+}
+inline std::string* FriendApprovalRequest::_internal_mutable_grouping() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _impl_.grouping_.Mutable( GetArena());
+}
+inline std::string* FriendApprovalRequest::release_grouping() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:message.FriendApprovalRequest.grouping)
+  return _impl_.grouping_.Release();
+}
+inline void FriendApprovalRequest::set_allocated_grouping(std::string* value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.grouping_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.grouping_.IsDefault()) {
+    _impl_.grouping_.Set("", GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:message.FriendApprovalRequest.grouping)
+}
+
+// string remark = 4;
+inline void FriendApprovalRequest::clear_remark() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.remark_.ClearToEmpty();
+}
+inline const std::string& FriendApprovalRequest::remark() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:message.FriendApprovalRequest.remark)
+  return _internal_remark();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void FriendApprovalRequest::set_remark(Arg_&& arg,
+                                                     Args_... args) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.remark_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:message.FriendApprovalRequest.remark)
+}
+inline std::string* FriendApprovalRequest::mutable_remark() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_remark();
+  // @@protoc_insertion_point(field_mutable:message.FriendApprovalRequest.remark)
+  return _s;
+}
+inline const std::string& FriendApprovalRequest::_internal_remark() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.remark_.Get();
+}
+inline void FriendApprovalRequest::_internal_set_remark(const std::string& value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.remark_.Set(value, GetArena());
+}
+inline std::string* FriendApprovalRequest::_internal_mutable_remark() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _impl_.remark_.Mutable( GetArena());
+}
+inline std::string* FriendApprovalRequest::release_remark() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:message.FriendApprovalRequest.remark)
+  return _impl_.remark_.Release();
+}
+inline void FriendApprovalRequest::set_allocated_remark(std::string* value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.remark_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.remark_.IsDefault()) {
+    _impl_.remark_.Set("", GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:message.FriendApprovalRequest.remark)
+}
+
+// -------------------------------------------------------------------
+
+// FriendApprovalResponse
+
+// int32 error = 1;
+inline void FriendApprovalResponse::clear_error() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.error_ = 0;
+}
+inline ::int32_t FriendApprovalResponse::error() const {
+  // @@protoc_insertion_point(field_get:message.FriendApprovalResponse.error)
+  return _internal_error();
+}
+inline void FriendApprovalResponse::set_error(::int32_t value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:message.FriendApprovalResponse.error)
+}
+inline ::int32_t FriendApprovalResponse::_internal_error() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.error_;
+}
+inline void FriendApprovalResponse::_internal_set_error(::int32_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.error_ = value;
+}
+
+// string applicant = 2;
+inline void FriendApprovalResponse::clear_applicant() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.applicant_.ClearToEmpty();
+}
+inline const std::string& FriendApprovalResponse::applicant() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:message.FriendApprovalResponse.applicant)
+  return _internal_applicant();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void FriendApprovalResponse::set_applicant(Arg_&& arg,
+                                                     Args_... args) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.applicant_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:message.FriendApprovalResponse.applicant)
+}
+inline std::string* FriendApprovalResponse::mutable_applicant() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_applicant();
+  // @@protoc_insertion_point(field_mutable:message.FriendApprovalResponse.applicant)
+  return _s;
+}
+inline const std::string& FriendApprovalResponse::_internal_applicant() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.applicant_.Get();
+}
+inline void FriendApprovalResponse::_internal_set_applicant(const std::string& value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.applicant_.Set(value, GetArena());
+}
+inline std::string* FriendApprovalResponse::_internal_mutable_applicant() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _impl_.applicant_.Mutable( GetArena());
+}
+inline std::string* FriendApprovalResponse::release_applicant() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:message.FriendApprovalResponse.applicant)
+  return _impl_.applicant_.Release();
+}
+inline void FriendApprovalResponse::set_allocated_applicant(std::string* value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.applicant_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.applicant_.IsDefault()) {
+    _impl_.applicant_.Set("", GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:message.FriendApprovalResponse.applicant)
+}
+
+// string recipient = 3;
+inline void FriendApprovalResponse::clear_recipient() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.recipient_.ClearToEmpty();
+}
+inline const std::string& FriendApprovalResponse::recipient() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:message.FriendApprovalResponse.recipient)
+  return _internal_recipient();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void FriendApprovalResponse::set_recipient(Arg_&& arg,
+                                                     Args_... args) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.recipient_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:message.FriendApprovalResponse.recipient)
+}
+inline std::string* FriendApprovalResponse::mutable_recipient() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_recipient();
+  // @@protoc_insertion_point(field_mutable:message.FriendApprovalResponse.recipient)
+  return _s;
+}
+inline const std::string& FriendApprovalResponse::_internal_recipient() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.recipient_.Get();
+}
+inline void FriendApprovalResponse::_internal_set_recipient(const std::string& value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.recipient_.Set(value, GetArena());
+}
+inline std::string* FriendApprovalResponse::_internal_mutable_recipient() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _impl_.recipient_.Mutable( GetArena());
+}
+inline std::string* FriendApprovalResponse::release_recipient() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:message.FriendApprovalResponse.recipient)
+  return _impl_.recipient_.Release();
+}
+inline void FriendApprovalResponse::set_allocated_recipient(std::string* value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.recipient_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.recipient_.IsDefault()) {
+    _impl_.recipient_.Set("", GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:message.FriendApprovalResponse.recipient)
+}
+
+// -------------------------------------------------------------------
+
+// NotifyFrame
+
+// uint64 seq = 1;
+inline void NotifyFrame::clear_seq() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.seq_ = ::uint64_t{0u};
+}
+inline ::uint64_t NotifyFrame::seq() const {
+  // @@protoc_insertion_point(field_get:message.NotifyFrame.seq)
+  return _internal_seq();
+}
+inline void NotifyFrame::set_seq(::uint64_t value) {
+  _internal_set_seq(value);
+  // @@protoc_insertion_point(field_set:message.NotifyFrame.seq)
+}
+inline ::uint64_t NotifyFrame::_internal_seq() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.seq_;
+}
+inline void NotifyFrame::_internal_set_seq(::uint64_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.seq_ = value;
+}
+
+// .message.FriendRequest friend_request = 2;
+inline bool NotifyFrame::has_friend_request() const {
+  return payload_case() == kFriendRequest;
+}
+inline bool NotifyFrame::_internal_has_friend_request() const {
+  return payload_case() == kFriendRequest;
+}
+inline void NotifyFrame::set_has_friend_request() {
+  _impl_._oneof_case_[0] = kFriendRequest;
+}
+inline void NotifyFrame::clear_friend_request() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (payload_case() == kFriendRequest) {
+    if (GetArena() == nullptr) {
+      delete _impl_.payload_.friend_request_;
+    } else if (::google::protobuf::internal::DebugHardenClearOneofMessageOnArena()) {
+      ::google::protobuf::internal::MaybePoisonAfterClear(_impl_.payload_.friend_request_);
+    }
+    clear_has_payload();
+  }
+}
+inline ::message::FriendRequest* NotifyFrame::release_friend_request() {
+  // @@protoc_insertion_point(field_release:message.NotifyFrame.friend_request)
+  if (payload_case() == kFriendRequest) {
+    clear_has_payload();
+    auto* temp = _impl_.payload_.friend_request_;
+    if (GetArena() != nullptr) {
+      temp = ::google::protobuf::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.payload_.friend_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::message::FriendRequest& NotifyFrame::_internal_friend_request() const {
+  return payload_case() == kFriendRequest ? *_impl_.payload_.friend_request_ : reinterpret_cast<::message::FriendRequest&>(::message::_FriendRequest_default_instance_);
+}
+inline const ::message::FriendRequest& NotifyFrame::friend_request() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:message.NotifyFrame.friend_request)
+  return _internal_friend_request();
+}
+inline ::message::FriendRequest* NotifyFrame::unsafe_arena_release_friend_request() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:message.NotifyFrame.friend_request)
+  if (payload_case() == kFriendRequest) {
+    clear_has_payload();
+    auto* temp = _impl_.payload_.friend_request_;
+    _impl_.payload_.friend_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void NotifyFrame::unsafe_arena_set_allocated_friend_request(::message::FriendRequest* value) {
+  // We rely on the oneof clear method to free the earlier contents
+  // of this oneof. We can directly use the pointer we're given to
+  // set the new value.
+  clear_payload();
+  if (value) {
+    set_has_friend_request();
+    _impl_.payload_.friend_request_ = value;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:message.NotifyFrame.friend_request)
+}
+inline ::message::FriendRequest* NotifyFrame::_internal_mutable_friend_request() {
+  if (payload_case() != kFriendRequest) {
+    clear_payload();
+    set_has_friend_request();
+    _impl_.payload_.friend_request_ =
+        ::google::protobuf::Message::DefaultConstruct<::message::FriendRequest>(GetArena());
+  }
+  return _impl_.payload_.friend_request_;
+}
+inline ::message::FriendRequest* NotifyFrame::mutable_friend_request() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::message::FriendRequest* _msg = _internal_mutable_friend_request();
+  // @@protoc_insertion_point(field_mutable:message.NotifyFrame.friend_request)
+  return _msg;
+}
+
+// .message.FriendApprovalRequest friend_approval = 3;
+inline bool NotifyFrame::has_friend_approval() const {
+  return payload_case() == kFriendApproval;
+}
+inline bool NotifyFrame::_internal_has_friend_approval() const {
+  return payload_case() == kFriendApproval;
+}
+inline void NotifyFrame::set_has_friend_approval() {
+  _impl_._oneof_case_[0] = kFriendApproval;
+}
+inline void NotifyFrame::clear_friend_approval() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (payload_case() == kFriendApproval) {
+    if (GetArena() == nullptr) {
+      delete _impl_.payload_.friend_approval_;
+    } else if (::google::protobuf::internal::DebugHardenClearOneofMessageOnArena()) {
+      ::google::protobuf::internal::MaybePoisonAfterClear(_impl_.payload_.friend_approval_);
+    }
+    clear_has_payload();
+  }
+}
+inline ::message::FriendApprovalRequest* NotifyFrame::release_friend_approval() {
+  // @@protoc_insertion_point(field_release:message.NotifyFrame.friend_approval)
+  if (payload_case() == kFriendApproval) {
+    clear_has_payload();
+    auto* temp = _impl_.payload_.friend_approval_;
+    if (GetArena() != nullptr) {
+      temp = ::google::protobuf::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.payload_.friend_approval_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::message::FriendApprovalRequest& NotifyFrame::_internal_friend_approval() const {
+  return payload_case() == kFriendApproval ? *_impl_.payload_.friend_approval_ : reinterpret_cast<::message::FriendApprovalRequest&>(::message::_FriendApprovalRequest_default_instance_);
+}
+inline const ::message::FriendApprovalRequest& NotifyFrame::friend_approval() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:message.NotifyFrame.friend_approval)
+  return _internal_friend_approval();
+}
+inline ::message::FriendApprovalRequest* NotifyFrame::unsafe_arena_release_friend_approval() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:message.NotifyFrame.friend_approval)
+  if (payload_case() == kFriendApproval) {
+    clear_has_payload();
+    auto* temp = _impl_.payload_.friend_approval_;
+    _impl_.payload_.friend_approval_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void NotifyFrame::unsafe_arena_set_allocated_friend_approval(::message::FriendApprovalRequest* value) {
+  // We rely on the oneof clear method to free the earlier contents
+  // of this oneof. We can directly use the pointer we're given to
+  // set the new value.
+  clear_payload();
+  if (value) {
+    set_has_friend_approval();
+    _impl_.payload_.friend_approval_ = value;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:message.NotifyFrame.friend_approval)
+}
+inline ::message::FriendApprovalRequest* NotifyFrame::_internal_mutable_friend_approval() {
+  if (payload_case() != kFriendApproval) {
+    clear_payload();
+    set_has_friend_approval();
+    _impl_.payload_.friend_approval_ =
+        ::google::protobuf::Message::DefaultConstruct<::message::FriendApprovalRequest>(GetArena());
+  }
+  return _impl_.payload_.friend_approval_;
+}
+inline ::message::FriendApprovalRequest* NotifyFrame::mutable_friend_approval() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::message::FriendApprovalRequest* _msg = _internal_mutable_friend_approval();
+  // @@protoc_insertion_point(field_mutable:message.NotifyFrame.friend_approval)
+  return _msg;
+}
+
+inline bool NotifyFrame::has_payload() const {
+  return payload_case() != PAYLOAD_NOT_SET;
+}
+inline void NotifyFrame::clear_has_payload() {
+  _impl_._oneof_case_[0] = PAYLOAD_NOT_SET;
+}
+inline NotifyFrame::PayloadCase NotifyFrame::payload_case() const {
+  return NotifyFrame::PayloadCase(_impl_._oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// NotifyBatch
+
+// string source = 1;
+inline void NotifyBatch::clear_source() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.source_.ClearToEmpty();
+}
+inline const std::string& NotifyBatch::source() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:message.NotifyBatch.source)
+  return _internal_source();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void NotifyBatch::set_source(Arg_&& arg,
+                                                     Args_... args) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.source_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:message.NotifyBatch.source)
+}
+inline std::string* NotifyBatch::mutable_source() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_source();
+  // @@protoc_insertion_point(field_mutable:message.NotifyBatch.source)
+  return _s;
+}
+inline const std::string& NotifyBatch::_internal_source() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.source_.Get();
+}
+inline void NotifyBatch::_internal_set_source(const std::string& value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.source_.Set(value, GetArena());
+}
+inline std::string* NotifyBatch::_internal_mutable_source() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _impl_.source_.Mutable( GetArena());
+}
+inline std::string* NotifyBatch::release_source() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:message.NotifyBatch.source)
+  return _impl_.source_.Release();
+}
+inline void NotifyBatch::set_allocated_source(std::string* value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.source_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.source_.IsDefault()) {
+    _impl_.source_.Set("", GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:message.NotifyBatch.source)
+}
+
+// uint64 epoch = 2;
+inline void NotifyBatch::clear_epoch() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.epoch_ = ::uint64_t{0u};
+}
+inline ::uint64_t NotifyBatch::epoch() const {
+  // @@protoc_insertion_point(field_get:message.NotifyBatch.epoch)
+  return _internal_epoch();
+}
+inline void NotifyBatch::set_epoch(::uint64_t value) {
+  _internal_set_epoch(value);
+  // @@protoc_insertion_point(field_set:message.NotifyBatch.epoch)
+}
+inline ::uint64_t NotifyBatch::_internal_epoch() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.epoch_;
+}
+inline void NotifyBatch::_internal_set_epoch(::uint64_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.epoch_ = value;
+}
+
+// repeated .message.NotifyFrame frames = 3;
+inline int NotifyBatch::_internal_frames_size() const {
+  return _internal_frames().size();
+}
+inline int NotifyBatch::frames_size() const {
+  return _internal_frames_size();
+}
+inline void NotifyBatch::clear_frames() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.frames_.Clear();
+}
+inline ::message::NotifyFrame* NotifyBatch::mutable_frames(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:message.NotifyBatch.frames)
+  return _internal_mutable_frames()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::message::NotifyFrame>* NotifyBatch::mutable_frames()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:message.NotifyBatch.frames)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _internal_mutable_frames();
+}
+inline const ::message::NotifyFrame& NotifyBatch::frames(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:message.NotifyBatch.frames)
+  return _internal_frames().Get(index);
+}
+inline ::message::NotifyFrame* NotifyBatch::add_frames() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::message::NotifyFrame* _add = _internal_mutable_frames()->Add();
+  // @@protoc_insertion_point(field_add:message.NotifyBatch.frames)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::message::NotifyFrame>& NotifyBatch::frames() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:message.NotifyBatch.frames)
+  return _internal_frames();
+}
+inline const ::google::protobuf::RepeatedPtrField<::message::NotifyFrame>&
+NotifyBatch::_internal_frames() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.frames_;
+}
+inline ::google::protobuf::RepeatedPtrField<::message::NotifyFrame>*
+NotifyBatch::_internal_mutable_frames() {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return &_impl_.frames_;
+}
+
+// -------------------------------------------------------------------
+
+// NotifyAck
+
+// uint64 acked_seq = 1;
+inline void NotifyAck::clear_acked_seq() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.acked_seq_ = ::uint64_t{0u};
+}
+inline ::uint64_t NotifyAck::acked_seq() const {
+  // @@protoc_insertion_point(field_get:message.NotifyAck.acked_seq)
+  return _internal_acked_seq();
+}
+inline void NotifyAck::set_acked_seq(::uint64_t value) {
+  _internal_set_acked_seq(value);
+  // @@protoc_insertion_point(field_set:message.NotifyAck.acked_seq)
+}
+inline ::uint64_t NotifyAck::_internal_acked_seq() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.acked_seq_;
+}
+inline void NotifyAck::_internal_set_acked_seq(::uint64_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.acked_seq_ = value;
+}
+
+// uint32 window = 2;
+inline void NotifyAck::clear_window() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.window_ = 0u;
+}
+inline ::uint32_t NotifyAck::window() const {
+  // @@protoc_insertion_point(field_get:message.NotifyAck.window)
+  return _internal_window();
+}
+inline void NotifyAck::set_window(::uint32_t value) {
+  _internal_set_window(value);
+  // @@protoc_insertion_point(field_set:message.NotifyAck.window)
+}
+inline ::uint32_t NotifyAck::_internal_window() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.window_;
+}
+inline void NotifyAck::_internal_set_window(::uint32_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.window_ = value;
+}
+
+#ifdef __GNUC__
+#pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace message
+
+
+// @@protoc_insertion_point(global_scope)
+
+#include "google/protobuf/port_undef.inc"
+
+#endif  // message_2eproto_2epb_2eh
@@ -0,0 +1,4866 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// NO CHECKED-IN PROTOBUF GENCODE
+// source: user.proto
+// Protobuf C++ Version: 5.29.3
+
+#include "user.pb.h"
+
+#include <algorithm>
+#include <type_traits>
+#include "google/protobuf/io/coded_stream.h"
+#include "google/protobuf/generated_message_tctable_impl.h"
+#include "google/protobuf/extension_set.h"
+#include "google/protobuf/generated_message_util.h"
+#include "google/protobuf/wire_format_lite.h"
+#include "google/protobuf/descriptor.h"
+#include "google/protobuf/generated_message_reflection.h"
+#include "google/protobuf/reflection_ops.h"
+#include "google/protobuf/wire_format.h"
+// @@protoc_insertion_point(includes)
+
+// Must be included last.
+#include "google/protobuf/port_def.inc"
+PROTOBUF_PRAGMA_INIT_SEG
+namespace _pb = ::google::protobuf;
+namespace _pbi = ::google::protobuf::internal;
+namespace _fl = ::google::protobuf::internal::field_layout;
+namespace user {
+
+inline constexpr VerifyLoginResp::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : uid_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        email_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        ok_{false},
+        error_{0},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR VerifyLoginResp::VerifyLoginResp(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct VerifyLoginRespDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR VerifyLoginRespDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~VerifyLoginRespDefaultTypeInternal() {}
+  union {
+    VerifyLoginResp _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 VerifyLoginRespDefaultTypeInternal _VerifyLoginResp_default_instance_;
+
+inline constexpr VerifyLoginReq::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : uid_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        email_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        password_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR VerifyLoginReq::VerifyLoginReq(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct VerifyLoginReqDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR VerifyLoginReqDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~VerifyLoginReqDefaultTypeInternal() {}
+  union {
+    VerifyLoginReq _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 VerifyLoginReqDefaultTypeInternal _VerifyLoginReq_default_instance_;
+
+inline constexpr VerifyEmailCodeResp::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : ok_{false},
+        error_{0},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR VerifyEmailCodeResp::VerifyEmailCodeResp(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct VerifyEmailCodeRespDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR VerifyEmailCodeRespDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~VerifyEmailCodeRespDefaultTypeInternal() {}
+  union {
+    VerifyEmailCodeResp _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 VerifyEmailCodeRespDefaultTypeInternal _VerifyEmailCodeResp_default_instance_;
+
+inline constexpr VerifyEmailCodeReq::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : email_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        code_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR VerifyEmailCodeReq::VerifyEmailCodeReq(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct VerifyEmailCodeReqDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR VerifyEmailCodeReqDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~VerifyEmailCodeReqDefaultTypeInternal() {}
+  union {
+    VerifyEmailCodeReq _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 VerifyEmailCodeReqDefaultTypeInternal _VerifyEmailCodeReq_default_instance_;
+
+inline constexpr UpdateUserProfileResp::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : ok_{false},
+        error_{0},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR UpdateUserProfileResp::UpdateUserProfileResp(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct UpdateUserProfileRespDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR UpdateUserProfileRespDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~UpdateUserProfileRespDefaultTypeInternal() {}
+  union {
+    UpdateUserProfileResp _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UpdateUserProfileRespDefaultTypeInternal _UpdateUserProfileResp_default_instance_;
+
+inline constexpr UpdateUserProfileReq::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : uid_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        username_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        birth_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        sex_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        avatar_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR UpdateUserProfileReq::UpdateUserProfileReq(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct UpdateUserProfileReqDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR UpdateUserProfileReqDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~UpdateUserProfileReqDefaultTypeInternal() {}
+  union {
+    UpdateUserProfileReq _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UpdateUserProfileReqDefaultTypeInternal _UpdateUserProfileReq_default_instance_;
+
+inline constexpr ResetPasswordResp::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : ok_{false},
+        error_{0},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR ResetPasswordResp::ResetPasswordResp(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct ResetPasswordRespDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ResetPasswordRespDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ResetPasswordRespDefaultTypeInternal() {}
+  union {
+    ResetPasswordResp _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ResetPasswordRespDefaultTypeInternal _ResetPasswordResp_default_instance_;
+
+inline constexpr ResetPasswordReq::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : uid_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        email_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        new_password_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        verify_code_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR ResetPasswordReq::ResetPasswordReq(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct ResetPasswordReqDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ResetPasswordReqDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ResetPasswordReqDefaultTypeInternal() {}
+  union {
+    ResetPasswordReq _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ResetPasswordReqDefaultTypeInternal _ResetPasswordReq_default_instance_;
+
+inline constexpr RegisterUserResp::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : uid_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        email_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        username_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        ok_{false},
+        error_{0},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR RegisterUserResp::RegisterUserResp(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct RegisterUserRespDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RegisterUserRespDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RegisterUserRespDefaultTypeInternal() {}
+  union {
+    RegisterUserResp _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RegisterUserRespDefaultTypeInternal _RegisterUserResp_default_instance_;
+
+inline constexpr RegisterUserReq::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : email_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        username_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        password_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        verify_code_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        request_id_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR RegisterUserReq::RegisterUserReq(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct RegisterUserReqDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RegisterUserReqDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RegisterUserReqDefaultTypeInternal() {}
+  union {
+    RegisterUserReq _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RegisterUserReqDefaultTypeInternal _RegisterUserReq_default_instance_;
+
+inline constexpr GetUserProfileResp::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : uid_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        email_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        username_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        birth_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        sex_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        avatar_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        ok_{false},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR GetUserProfileResp::GetUserProfileResp(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct GetUserProfileRespDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GetUserProfileRespDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GetUserProfileRespDefaultTypeInternal() {}
+  union {
+    GetUserProfileResp _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetUserProfileRespDefaultTypeInternal _GetUserProfileResp_default_instance_;
+
+inline constexpr GetUserProfileReq::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : uid_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR GetUserProfileReq::GetUserProfileReq(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct GetUserProfileReqDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GetUserProfileReqDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GetUserProfileReqDefaultTypeInternal() {}
+  union {
+    GetUserProfileReq _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetUserProfileReqDefaultTypeInternal _GetUserProfileReq_default_instance_;
+
+inline constexpr FuzzySearchUserReq::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : uid_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        pattern_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR FuzzySearchUserReq::FuzzySearchUserReq(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct FuzzySearchUserReqDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR FuzzySearchUserReqDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~FuzzySearchUserReqDefaultTypeInternal() {}
+  union {
+    FuzzySearchUserReq _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FuzzySearchUserReqDefaultTypeInternal _FuzzySearchUserReq_default_instance_;
+
+inline constexpr FuzzySearchUserResp::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : results_{},
+        error_{0},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR FuzzySearchUserResp::FuzzySearchUserResp(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct FuzzySearchUserRespDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR FuzzySearchUserRespDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~FuzzySearchUserRespDefaultTypeInternal() {}
+  union {
+    FuzzySearchUserResp _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FuzzySearchUserRespDefaultTypeInternal _FuzzySearchUserResp_default_instance_;
+}  // namespace user
+static constexpr const ::_pb::EnumDescriptor**
+    file_level_enum_descriptors_user_2eproto = nullptr;
+static constexpr const ::_pb::ServiceDescriptor**
+    file_level_service_descriptors_user_2eproto = nullptr;
+const ::uint32_t
+    TableStruct_user_2eproto::offsets[] ABSL_ATTRIBUTE_SECTION_VARIABLE(
+        protodesc_cold) = {
+        ~0u,  // no _has_bits_
+        PROTOBUF_FIELD_OFFSET(::user::VerifyEmailCodeReq, _internal_metadata_),
+        ~0u,  // no _extensions_
+        ~0u,  // no _oneof_case_
+        ~0u,  // no _weak_field_map_
+        ~0u,  // no _inlined_string_donated_
+        ~0u,  // no _split_
+        ~0u,  // no sizeof(Split)
+        PROTOBUF_FIELD_OFFSET(::user::VerifyEmailCodeReq, _impl_.email_),
+        PROTOBUF_FIELD_OFFSET(::user::VerifyEmailCodeReq, _impl_.code_),
+        ~0u,  // no _has_bits_
+        PROTOBUF_FIELD_OFFSET(::user::VerifyEmailCodeResp, _internal_metadata_),
+        ~0u,  // no _extensions_
+        ~0u,  // no _oneof_case_
+        ~0u,  // no _weak_field_map_
+        ~0u,  // no _inlined_string_donated_
+        ~0u,  // no _split_
+        ~0u,  // no sizeof(Split)
+        PROTOBUF_FIELD_OFFSET(::user::VerifyEmailCodeResp, _impl_.ok_),
+        PROTOBUF_FIELD_OFFSET(::user::VerifyEmailCodeResp, _impl_.error_),
+        ~0u,  // no _has_bits_
+        PROTOBUF_FIELD_OFFSET(::user::RegisterUserReq, _internal_metadata_),
+        ~0u,  // no _extensions_
+        ~0u,  // no _oneof_case_
+        ~0u,  // no _weak_field_map_
+        ~0u,  // no _inlined_string_donated_
+        ~0u,  // no _split_
+        ~0u,  // no sizeof(Split)
+        PROTOBUF_FIELD_OFFSET(::user::RegisterUserReq, _impl_.email_),
+        PROTOBUF_FIELD_OFFSET(::user::RegisterUserReq, _impl_.username_),
+        PROTOBUF_FIELD_OFFSET(::user::RegisterUserReq, _impl_.password_),
+        PROTOBUF_FIELD_OFFSET(::user::RegisterUserReq, _impl_.verify_code_),
+        PROTOBUF_FIELD_OFFSET(::user::RegisterUserReq, _impl_.request_id_),
+        ~0u,  // no _has_bits_
+        PROTOBUF_FIELD_OFFSET(::user::RegisterUserResp, _internal_metadata_),
+        ~0u,  // no _extensions_
+        ~0u,  // no _oneof_case_
+        ~0u,  // no _weak_field_map_
+        ~0u,  // no _inlined_string_donated_
+        ~0u,  // no _split_
+        ~0u,  // no sizeof(Split)
+        PROTOBUF_FIELD_OFFSET(::user::RegisterUserResp, _impl_.ok_),
+        PROTOBUF_FIELD_OFFSET(::user::RegisterUserResp, _impl_.error_),
+        PROTOBUF_FIELD_OFFSET(::user::RegisterUserResp, _impl_.uid_),
+        PROTOBUF_FIELD_OFFSET(::user::RegisterUserResp, _impl_.email_),
+        PROTOBUF_FIELD_OFFSET(::user::RegisterUserResp, _impl_.username_),
+        ~0u,  // no _has_bits_
+        PROTOBUF_FIELD_OFFSET(::user::VerifyLoginReq, _internal_metadata_),
+        ~0u,  // no _extensions_
+        ~0u,  // no _oneof_case_
+        ~0u,  // no _weak_field_map_
+        ~0u,  // no _inlined_string_donated_
+        ~0u,  // no _split_
+        ~0u,  // no sizeof(Split)
+        PROTOBUF_FIELD_OFFSET(::user::VerifyLoginReq, _impl_.uid_),
+        PROTOBUF_FIELD_OFFSET(::user::VerifyLoginReq, _impl_.email_),
+        PROTOBUF_FIELD_OFFSET(::user::VerifyLoginReq, _impl_.password_),
+        ~0u,  // no _has_bits_
+        PROTOBUF_FIELD_OFFSET(::user::VerifyLoginResp, _internal_metadata_),
+        ~0u,  // no _extensions_
+        ~0u,  // no _oneof_case_
+        ~0u,  // no _weak_field_map_
+        ~0u,  // no _inlined_string_donated_
+        ~0u,  // no _split_
+        ~0u,  // no sizeof(Split)
+        PROTOBUF_FIELD_OFFSET(::user::VerifyLoginResp, _impl_.ok_),
+        PROTOBUF_FIELD_OFFSET(::user::VerifyLoginResp, _impl_.error_),
+        PROTOBUF_FIELD_OFFSET(::user::VerifyLoginResp, _impl_.uid_),
+        PROTOBUF_FIELD_OFFSET(::user::VerifyLoginResp, _impl_.email_),
+        ~0u,  // no _has_bits_
+        PROTOBUF_FIELD_OFFSET(::user::ResetPasswordReq, _internal_metadata_),
+        ~0u,  // no _extensions_
+        ~0u,  // no _oneof_case_
+        ~0u,  // no _weak_field_map_
+        ~0u,  // no _inlined_string_donated_
+        ~0u,  // no _split_
+        ~0u,  // no sizeof(Split)
+        PROTOBUF_FIELD_OFFSET(::user::ResetPasswordReq, _impl_.uid_),
+        PROTOBUF_FIELD_OFFSET(::user::ResetPasswordReq, _impl_.email_),
+        PROTOBUF_FIELD_OFFSET(::user::ResetPasswordReq, _impl_.new_password_),
+        PROTOBUF_FIELD_OFFSET(::user::ResetPasswordReq, _impl_.verify_code_),
+        ~0u,  // no _has_bits_
+        PROTOBUF_FIELD_OFFSET(::user::ResetPasswordResp, _internal_metadata_),
+        ~0u,  // no _extensions_
+        ~0u,  // no _oneof_case_
+        ~0u,  // no _weak_field_map_
+        ~0u,  // no _inlined_string_donated_
+        ~0u,  // no _split_
+        ~0u,  // no sizeof(Split)
+        PROTOBUF_FIELD_OFFSET(::user::ResetPasswordResp, _impl_.ok_),
+        PROTOBUF_FIELD_OFFSET(::user::ResetPasswordResp, _impl_.error_),
+        ~0u,  // no _has_bits_
+        PROTOBUF_FIELD_OFFSET(::user::GetUserProfileReq, _internal_metadata_),
+        ~0u,  // no _extensions_
+        ~0u,  // no _oneof_case_
+        ~0u,  // no _weak_field_map_
+        ~0u,  // no _inlined_string_donated_
+        ~0u,  // no _split_
+        ~0u,  // no sizeof(Split)
+        PROTOBUF_FIELD_OFFSET(::user::GetUserProfileReq, _impl_.uid_),
+        ~0u,  // no _has_bits_
+        PROTOBUF_FIELD_OFFSET(::user::GetUserProfileResp, _internal_metadata_),
+        ~0u,  // no _extensions_
+        ~0u,  // no _oneof_case_
+        ~0u,  // no _weak_field_map_
+        ~0u,  // no _inlined_string_donated_
+        ~0u,  // no _split_
+        ~0u,  // no sizeof(Split)
+        PROTOBUF_FIELD_OFFSET(::user::GetUserProfileResp, _impl_.ok_),
+        PROTOBUF_FIELD_OFFSET(::user::GetUserProfileResp, _impl_.uid_),
+        PROTOBUF_FIELD_OFFSET(::user::GetUserProfileResp, _impl_.email_),
+        PROTOBUF_FIELD_OFFSET(::user::GetUserProfileResp, _impl_.username_),
+        PROTOBUF_FIELD_OFFSET(::user::GetUserProfileResp, _impl_.birth_),
+        PROTOBUF_FIELD_OFFSET(::user::GetUserProfileResp, _impl_.sex_),
+        PROTOBUF_FIELD_OFFSET(::user::GetUserProfileResp, _impl_.avatar_),
+        ~0u,  // no _has_bits_
+        PROTOBUF_FIELD_OFFSET(::user::UpdateUserProfileReq, _internal_metadata_),
+        ~0u,  // no _extensions_
+        ~0u,  // no _oneof_case_
+        ~0u,  // no _weak_field_map_
+        ~0u,  // no _inlined_string_donated_
+        ~0u,  // no _split_
+        ~0u,  // no sizeof(Split)
+        PROTOBUF_FIELD_OFFSET(::user::UpdateUserProfileReq, _impl_.uid_),
+        PROTOBUF_FIELD_OFFSET(::user::UpdateUserProfileReq, _impl_.username_),
+        PROTOBUF_FIELD_OFFSET(::user::UpdateUserProfileReq, _impl_.birth_),
+        PROTOBUF_FIELD_OFFSET(::user::UpdateUserProfileReq, _impl_.sex_),
+        PROTOBUF_FIELD_OFFSET(::user::UpdateUserProfileReq, _impl_.avatar_),
+        ~0u,  // no _has_bits_
+        PROTOBUF_FIELD_OFFSET(::user::UpdateUserProfileResp, _internal_metadata_),
+        ~0u,  // no _extensions_
+        ~0u,  // no _oneof_case_
+        ~0u,  // no _weak_field_map_
+        ~0u,  // no _inlined_string_donated_
+        ~0u,  // no _split_
+        ~0u,  // no sizeof(Split)
+        PROTOBUF_FIELD_OFFSET(::user::UpdateUserProfileResp, _impl_.ok_),
+        PROTOBUF_FIELD_OFFSET(::user::UpdateUserProfileResp, _impl_.error_),
+        ~0u,  // no _has_bits_
+        PROTOBUF_FIELD_OFFSET(::user::FuzzySearchUserReq, _internal_metadata_),
+        ~0u,  // no _extensions_
+        ~0u,  // no _oneof_case_
+        ~0u,  // no _weak_field_map_
+        ~0u,  // no _inlined_string_donated_
+        ~0u,  // no _split_
+        ~0u,  // no sizeof(Split)
+        PROTOBUF_FIELD_OFFSET(::user::FuzzySearchUserReq, _impl_.uid_),
+        PROTOBUF_FIELD_OFFSET(::user::FuzzySearchUserReq, _impl_.pattern_),
+        ~0u,  // no _has_bits_
+        PROTOBUF_FIELD_OFFSET(::user::FuzzySearchUserResp, _internal_metadata_),
+        ~0u,  // no _extensions_
+        ~0u,  // no _oneof_case_
+        ~0u,  // no _weak_field_map_
+        ~0u,  // no _inlined_string_donated_
+        ~0u,  // no _split_
+        ~0u,  // no sizeof(Split)
+        PROTOBUF_FIELD_OFFSET(::user::FuzzySearchUserResp, _impl_.error_),
+        PROTOBUF_FIELD_OFFSET(::user::FuzzySearchUserResp, _impl_.results_),
+};
+
+static const ::_pbi::MigrationSchema
+    schemas[] ABSL_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
+        {0, -1, -1, sizeof(::user::VerifyEmailCodeReq)},
+        {10, -1, -1, sizeof(::user::VerifyEmailCodeResp)},
+        {20, -1, -1, sizeof(::user::RegisterUserReq)},
+        {33, -1, -1, sizeof(::user::RegisterUserResp)},
+        {46, -1, -1, sizeof(::user::VerifyLoginReq)},
+        {57, -1, -1, sizeof(::user::VerifyLoginResp)},
+        {69, -1, -1, sizeof(::user::ResetPasswordReq)},
+        {81, -1, -1, sizeof(::user::ResetPasswordResp)},
+        {91, -1, -1, sizeof(::user::GetUserProfileReq)},
+        {100, -1, -1, sizeof(::user::GetUserProfileResp)},
+        {115, -1, -1, sizeof(::user::UpdateUserProfileReq)},
+        {128, -1, -1, sizeof(::user::UpdateUserProfileResp)},
+        {138, -1, -1, sizeof(::user::FuzzySearchUserReq)},
+        {148, -1, -1, sizeof(::user::FuzzySearchUserResp)},
+};
+static const ::_pb::Message* const file_default_instances[] = {
+    &::user::_VerifyEmailCodeReq_default_instance_._instance,
+    &::user::_VerifyEmailCodeResp_default_instance_._instance,
+    &::user::_RegisterUserReq_default_instance_._instance,
+    &::user::_RegisterUserResp_default_instance_._instance,
+    &::user::_VerifyLoginReq_default_instance_._instance,
+    &::user::_VerifyLoginResp_default_instance_._instance,
+    &::user::_ResetPasswordReq_default_instance_._instance,
+    &::user::_ResetPasswordResp_default_instance_._instance,
+    &::user::_GetUserProfileReq_default_instance_._instance,
+    &::user::_GetUserProfileResp_default_instance_._instance,
+    &::user::_UpdateUserProfileReq_default_instance_._instance,
+    &::user::_UpdateUserProfileResp_default_instance_._instance,
+    &::user::_FuzzySearchUserReq_default_instance_._instance,
+    &::user::_FuzzySearchUserResp_default_instance_._instance,
+};
+const char descriptor_table_protodef_user_2eproto[] ABSL_ATTRIBUTE_SECTION_VARIABLE(
+    protodesc_cold) = {
+    "\n\nuser.proto\022\004user\032\037google/protobuf/time"
+    "stamp.proto\"1\n\022VerifyEmailCodeReq\022\r\n\005ema"
+    "il\030\001 \001(\t\022\014\n\004code\030\002 \001(\t\"0\n\023VerifyEmailCod"
+    "eResp\022\n\n\002ok\030\001 \001(\010\022\r\n\005error\030\002 \001(\005\"m\n\017Regi"
+    "sterUserReq\022\r\n\005email\030\001 \001(\t\022\020\n\010username\030\002"
+    " \001(\t\022\020\n\010password\030\003 \001(\t\022\023\n\013verify_code\030\004 "
+    "\001(\t\022\022\n\nrequest_id\030\005 \001(\t\"[\n\020RegisterUserR"
+    "esp\022\n\n\002ok\030\001 \001(\010\022\r\n\005error\030\002 \001(\005\022\013\n\003uid\030\003 "
+    "\001(\t\022\r\n\005email\030\004 \001(\t\022\020\n\010username\030\005 \001(\t\">\n\016"
+    "VerifyLoginReq\022\013\n\003uid\030\001 \001(\t\022\r\n\005email\030\002 \001"
+    "(\t\022\020\n\010password\030\003 \001(\t\"H\n\017VerifyLoginResp\022"
+    "\n\n\002ok\030\001 \001(\010\022\r\n\005error\030\002 \001(\005\022\013\n\003uid\030\003 \001(\t\022"
+    "\r\n\005email\030\004 \001(\t\"Y\n\020ResetPasswordReq\022\013\n\003ui"
+    "d\030\001 \001(\t\022\r\n\005email\030\002 \001(\t\022\024\n\014new_password\030\003"
+    " \001(\t\022\023\n\013verify_code\030\004 \001(\t\".\n\021ResetPasswo"
+    "rdResp\022\n\n\002ok\030\001 \001(\010\022\r\n\005error\030\002 \001(\005\" \n\021Get"
+    "UserProfileReq\022\013\n\003uid\030\001 \001(\t\"z\n\022GetUserPr"
+    "ofileResp\022\n\n\002ok\030\001 \001(\010\022\013\n\003uid\030\002 \001(\t\022\r\n\005em"
+    "ail\030\003 \001(\t\022\020\n\010username\030\004 \001(\t\022\r\n\005birth\030\005 \001"
+    "(\t\022\013\n\003sex\030\006 \001(\t\022\016\n\006avatar\030\007 \001(\t\"a\n\024Updat"
+    "eUserProfileReq\022\013\n\003uid\030\001 \001(\t\022\020\n\010username"
+    "\030\002 \001(\t\022\r\n\005birth\030\003 \001(\t\022\013\n\003sex\030\004 \001(\t\022\016\n\006av"
+    "atar\030\005 \001(\t\"2\n\025UpdateUserProfileResp\022\n\n\002o"
+    "k\030\001 \001(\010\022\r\n\005error\030\002 \001(\005\"2\n\022FuzzySearchUse"
+    "rReq\022\013\n\003uid\030\001 \001(\t\022\017\n\007pattern\030\002 \001(\t\"O\n\023Fu"
+    "zzySearchUserResp\022\r\n\005error\030\001 \001(\005\022)\n\007resu"
+    "lts\030\002 \003(\0132\030.user.GetUserProfileResp2\355\003\n\013"
+    "UserService\022F\n\017VerifyEmailCode\022\030.user.Ve"
+    "rifyEmailCodeReq\032\031.user.VerifyEmailCodeR"
+    "esp\022=\n\014RegisterUser\022\025.user.RegisterUserR"
+    "eq\032\026.user.RegisterUserResp\022:\n\013VerifyLogi"
+    "n\022\024.user.VerifyLoginReq\032\025.user.VerifyLog"
+    "inResp\022@\n\rResetPassword\022\026.user.ResetPass"
+    "wordReq\032\027.user.ResetPasswordResp\022C\n\016GetU"
+    "serProfile\022\027.user.GetUserProfileReq\032\030.us"
+    "er.GetUserProfileResp\022L\n\021UpdateUserProfi"
+    "le\022\032.user.UpdateUserProfileReq\032\033.user.Up"
+    "dateUserProfileResp\022F\n\017FuzzySearchUser\022\030"
+    ".user.FuzzySearchUserReq\032\031.user.FuzzySea"
+    "rchUserRespb\006proto3"
+};
+static const ::_pbi::DescriptorTable* const descriptor_table_user_2eproto_deps[1] =
+    {
+        &::descriptor_table_google_2fprotobuf_2ftimestamp_2eproto,
+};
+static ::absl::once_flag descriptor_table_user_2eproto_once;
+PROTOBUF_CONSTINIT const ::_pbi::DescriptorTable descriptor_table_user_2eproto = {
+    false,
+    false,
+    1579,
+    descriptor_table_protodef_user_2eproto,
+    "user.proto",
+    &descriptor_table_user_2eproto_once,
+    descriptor_table_user_2eproto_deps,
+    1,
+    14,
+    schemas,
+    file_default_instances,
+    TableStruct_user_2eproto::offsets,
+    file_level_enum_descriptors_user_2eproto,
+    file_level_service_descriptors_user_2eproto,
+};
+namespace user {
+// ===================================================================
+
+class VerifyEmailCodeReq::_Internal {
+ public:
+};
+
+VerifyEmailCodeReq::VerifyEmailCodeReq(::google::protobuf::Arena* arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:user.VerifyEmailCodeReq)
+}
+inline PROTOBUF_NDEBUG_INLINE VerifyEmailCodeReq::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from, const ::user::VerifyEmailCodeReq& from_msg)
+      : email_(arena, from.email_),
+        code_(arena, from.code_),
+        _cached_size_{0} {}
+
+VerifyEmailCodeReq::VerifyEmailCodeReq(
+    ::google::protobuf::Arena* arena,
+    const VerifyEmailCodeReq& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  VerifyEmailCodeReq* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+
+  // @@protoc_insertion_point(copy_constructor:user.VerifyEmailCodeReq)
+}
+inline PROTOBUF_NDEBUG_INLINE VerifyEmailCodeReq::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : email_(arena),
+        code_(arena),
+        _cached_size_{0} {}
+
+inline void VerifyEmailCodeReq::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+VerifyEmailCodeReq::~VerifyEmailCodeReq() {
+  // @@protoc_insertion_point(destructor:user.VerifyEmailCodeReq)
+  SharedDtor(*this);
+}
+inline void VerifyEmailCodeReq::SharedDtor(MessageLite& self) {
+  VerifyEmailCodeReq& this_ = static_cast<VerifyEmailCodeReq&>(self);
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.email_.Destroy();
+  this_._impl_.code_.Destroy();
+  this_._impl_.~Impl_();
+}
+
+inline void* VerifyEmailCodeReq::PlacementNew_(const void*, void* mem,
+                                        ::google::protobuf::Arena* arena) {
+  return ::new (mem) VerifyEmailCodeReq(arena);
+}
+constexpr auto VerifyEmailCodeReq::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(VerifyEmailCodeReq),
+                                            alignof(VerifyEmailCodeReq));
+}
+PROTOBUF_CONSTINIT
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::google::protobuf::internal::ClassDataFull VerifyEmailCodeReq::_class_data_ = {
+    ::google::protobuf::internal::ClassData{
+        &_VerifyEmailCodeReq_default_instance_._instance,
+        &_table_.header,
+        nullptr,  // OnDemandRegisterArenaDtor
+        nullptr,  // IsInitialized
+        &VerifyEmailCodeReq::MergeImpl,
+        ::google::protobuf::Message::GetNewImpl<VerifyEmailCodeReq>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        &VerifyEmailCodeReq::SharedDtor,
+        ::google::protobuf::Message::GetClearImpl<VerifyEmailCodeReq>(), &VerifyEmailCodeReq::ByteSizeLong,
+            &VerifyEmailCodeReq::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+        PROTOBUF_FIELD_OFFSET(VerifyEmailCodeReq, _impl_._cached_size_),
+        false,
+    },
+    &VerifyEmailCodeReq::kDescriptorMethods,
+    &descriptor_table_user_2eproto,
+    nullptr,  // tracker
+};
+const ::google::protobuf::internal::ClassData* VerifyEmailCodeReq::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
+  return _class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<1, 2, 0, 41, 2> VerifyEmailCodeReq::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    2, 8,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967292,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    2,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    _class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::user::VerifyEmailCodeReq>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    // string code = 2;
+    {::_pbi::TcParser::FastUS1,
+     {18, 63, 0, PROTOBUF_FIELD_OFFSET(VerifyEmailCodeReq, _impl_.code_)}},
+    // string email = 1;
+    {::_pbi::TcParser::FastUS1,
+     {10, 63, 0, PROTOBUF_FIELD_OFFSET(VerifyEmailCodeReq, _impl_.email_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // string email = 1;
+    {PROTOBUF_FIELD_OFFSET(VerifyEmailCodeReq, _impl_.email_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // string code = 2;
+    {PROTOBUF_FIELD_OFFSET(VerifyEmailCodeReq, _impl_.code_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+  }},
+  // no aux_entries
+  {{
+    "\27\5\4\0\0\0\0\0"
+    "user.VerifyEmailCodeReq"
+    "email"
+    "code"
+  }},
+};
+
+PROTOBUF_NOINLINE void VerifyEmailCodeReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:user.VerifyEmailCodeReq)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.email_.ClearToEmpty();
+  _impl_.code_.ClearToEmpty();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::uint8_t* VerifyEmailCodeReq::_InternalSerialize(
+            const MessageLite& base, ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) {
+          const VerifyEmailCodeReq& this_ = static_cast<const VerifyEmailCodeReq&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::uint8_t* VerifyEmailCodeReq::_InternalSerialize(
+            ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+          const VerifyEmailCodeReq& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(serialize_to_array_start:user.VerifyEmailCodeReq)
+          ::uint32_t cached_has_bits = 0;
+          (void)cached_has_bits;
+
+          // string email = 1;
+          if (!this_._internal_email().empty()) {
+            const std::string& _s = this_._internal_email();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "user.VerifyEmailCodeReq.email");
+            target = stream->WriteStringMaybeAliased(1, _s, target);
+          }
+
+          // string code = 2;
+          if (!this_._internal_code().empty()) {
+            const std::string& _s = this_._internal_code();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "user.VerifyEmailCodeReq.code");
+            target = stream->WriteStringMaybeAliased(2, _s, target);
+          }
+
+          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+            target =
+                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+          }
+          // @@protoc_insertion_point(serialize_to_array_end:user.VerifyEmailCodeReq)
+          return target;
+        }
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::size_t VerifyEmailCodeReq::ByteSizeLong(const MessageLite& base) {
+          const VerifyEmailCodeReq& this_ = static_cast<const VerifyEmailCodeReq&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::size_t VerifyEmailCodeReq::ByteSizeLong() const {
+          const VerifyEmailCodeReq& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(message_byte_size_start:user.VerifyEmailCodeReq)
+          ::size_t total_size = 0;
+
+          ::uint32_t cached_has_bits = 0;
+          // Prevent compiler warnings about cached_has_bits being unused
+          (void)cached_has_bits;
+
+          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+           {
+            // string email = 1;
+            if (!this_._internal_email().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_email());
+            }
+            // string code = 2;
+            if (!this_._internal_code().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_code());
+            }
+          }
+          return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                                     &this_._impl_._cached_size_);
+        }
+
+void VerifyEmailCodeReq::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+  auto* const _this = static_cast<VerifyEmailCodeReq*>(&to_msg);
+  auto& from = static_cast<const VerifyEmailCodeReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:user.VerifyEmailCodeReq)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_email().empty()) {
+    _this->_internal_set_email(from._internal_email());
+  }
+  if (!from._internal_code().empty()) {
+    _this->_internal_set_code(from._internal_code());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void VerifyEmailCodeReq::CopyFrom(const VerifyEmailCodeReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:user.VerifyEmailCodeReq)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void VerifyEmailCodeReq::InternalSwap(VerifyEmailCodeReq* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.email_, &other->_impl_.email_, arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.code_, &other->_impl_.code_, arena);
+}
+
+::google::protobuf::Metadata VerifyEmailCodeReq::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class VerifyEmailCodeResp::_Internal {
+ public:
+};
+
+VerifyEmailCodeResp::VerifyEmailCodeResp(::google::protobuf::Arena* arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:user.VerifyEmailCodeResp)
+}
+VerifyEmailCodeResp::VerifyEmailCodeResp(
+    ::google::protobuf::Arena* arena, const VerifyEmailCodeResp& from)
+    : VerifyEmailCodeResp(arena) {
+  MergeFrom(from);
+}
+inline PROTOBUF_NDEBUG_INLINE VerifyEmailCodeResp::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0} {}
+
+inline void VerifyEmailCodeResp::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, ok_),
+           0,
+           offsetof(Impl_, error_) -
+               offsetof(Impl_, ok_) +
+               sizeof(Impl_::error_));
+}
+VerifyEmailCodeResp::~VerifyEmailCodeResp() {
+  // @@protoc_insertion_point(destructor:user.VerifyEmailCodeResp)
+  SharedDtor(*this);
+}
+inline void VerifyEmailCodeResp::SharedDtor(MessageLite& self) {
+  VerifyEmailCodeResp& this_ = static_cast<VerifyEmailCodeResp&>(self);
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.~Impl_();
+}
+
+inline void* VerifyEmailCodeResp::PlacementNew_(const void*, void* mem,
+                                        ::google::protobuf::Arena* arena) {
+  return ::new (mem) VerifyEmailCodeResp(arena);
+}
+constexpr auto VerifyEmailCodeResp::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(VerifyEmailCodeResp),
+                                            alignof(VerifyEmailCodeResp));
+}
+PROTOBUF_CONSTINIT
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::google::protobuf::internal::ClassDataFull VerifyEmailCodeResp::_class_data_ = {
+    ::google::protobuf::internal::ClassData{
+        &_VerifyEmailCodeResp_default_instance_._instance,
+        &_table_.header,
+        nullptr,  // OnDemandRegisterArenaDtor
+        nullptr,  // IsInitialized
+        &VerifyEmailCodeResp::MergeImpl,
+        ::google::protobuf::Message::GetNewImpl<VerifyEmailCodeResp>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        &VerifyEmailCodeResp::SharedDtor,
+        ::google::protobuf::Message::GetClearImpl<VerifyEmailCodeResp>(), &VerifyEmailCodeResp::ByteSizeLong,
+            &VerifyEmailCodeResp::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+        PROTOBUF_FIELD_OFFSET(VerifyEmailCodeResp, _impl_._cached_size_),
+        false,
+    },
+    &VerifyEmailCodeResp::kDescriptorMethods,
+    &descriptor_table_user_2eproto,
+    nullptr,  // tracker
+};
+const ::google::protobuf::internal::ClassData* VerifyEmailCodeResp::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
+  return _class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<1, 2, 0, 0, 2> VerifyEmailCodeResp::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    2, 8,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967292,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    2,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    _class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::user::VerifyEmailCodeResp>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    // int32 error = 2;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(VerifyEmailCodeResp, _impl_.error_), 63>(),
+     {16, 63, 0, PROTOBUF_FIELD_OFFSET(VerifyEmailCodeResp, _impl_.error_)}},
+    // bool ok = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(VerifyEmailCodeResp, _impl_.ok_), 63>(),
+     {8, 63, 0, PROTOBUF_FIELD_OFFSET(VerifyEmailCodeResp, _impl_.ok_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // bool ok = 1;
+    {PROTOBUF_FIELD_OFFSET(VerifyEmailCodeResp, _impl_.ok_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kBool)},
+    // int32 error = 2;
+    {PROTOBUF_FIELD_OFFSET(VerifyEmailCodeResp, _impl_.error_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+  }},
+  // no aux_entries
+  {{
+  }},
+};
+
+PROTOBUF_NOINLINE void VerifyEmailCodeResp::Clear() {
+// @@protoc_insertion_point(message_clear_start:user.VerifyEmailCodeResp)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.ok_, 0, static_cast<::size_t>(
+      reinterpret_cast<char*>(&_impl_.error_) -
+      reinterpret_cast<char*>(&_impl_.ok_)) + sizeof(_impl_.error_));
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::uint8_t* VerifyEmailCodeResp::_InternalSerialize(
+            const MessageLite& base, ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) {
+          const VerifyEmailCodeResp& this_ = static_cast<const VerifyEmailCodeResp&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::uint8_t* VerifyEmailCodeResp::_InternalSerialize(
+            ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+          const VerifyEmailCodeResp& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(serialize_to_array_start:user.VerifyEmailCodeResp)
+          ::uint32_t cached_has_bits = 0;
+          (void)cached_has_bits;
+
+          // bool ok = 1;
+          if (this_._internal_ok() != 0) {
+            target = stream->EnsureSpace(target);
+            target = ::_pbi::WireFormatLite::WriteBoolToArray(
+                1, this_._internal_ok(), target);
+          }
+
+          // int32 error = 2;
+          if (this_._internal_error() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt32ToArrayWithField<2>(
+                    stream, this_._internal_error(), target);
+          }
+
+          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+            target =
+                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+          }
+          // @@protoc_insertion_point(serialize_to_array_end:user.VerifyEmailCodeResp)
+          return target;
+        }
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::size_t VerifyEmailCodeResp::ByteSizeLong(const MessageLite& base) {
+          const VerifyEmailCodeResp& this_ = static_cast<const VerifyEmailCodeResp&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::size_t VerifyEmailCodeResp::ByteSizeLong() const {
+          const VerifyEmailCodeResp& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(message_byte_size_start:user.VerifyEmailCodeResp)
+          ::size_t total_size = 0;
+
+          ::uint32_t cached_has_bits = 0;
+          // Prevent compiler warnings about cached_has_bits being unused
+          (void)cached_has_bits;
+
+          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+           {
+            // bool ok = 1;
+            if (this_._internal_ok() != 0) {
+              total_size += 2;
+            }
+            // int32 error = 2;
+            if (this_._internal_error() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+                  this_._internal_error());
+            }
+          }
+          return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                                     &this_._impl_._cached_size_);
+        }
+
+void VerifyEmailCodeResp::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+  auto* const _this = static_cast<VerifyEmailCodeResp*>(&to_msg);
+  auto& from = static_cast<const VerifyEmailCodeResp&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:user.VerifyEmailCodeResp)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_ok() != 0) {
+    _this->_impl_.ok_ = from._impl_.ok_;
+  }
+  if (from._internal_error() != 0) {
+    _this->_impl_.error_ = from._impl_.error_;
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void VerifyEmailCodeResp::CopyFrom(const VerifyEmailCodeResp& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:user.VerifyEmailCodeResp)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void VerifyEmailCodeResp::InternalSwap(VerifyEmailCodeResp* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(VerifyEmailCodeResp, _impl_.error_)
+      + sizeof(VerifyEmailCodeResp::_impl_.error_)
+      - PROTOBUF_FIELD_OFFSET(VerifyEmailCodeResp, _impl_.ok_)>(
+          reinterpret_cast<char*>(&_impl_.ok_),
+          reinterpret_cast<char*>(&other->_impl_.ok_));
+}
+
+::google::protobuf::Metadata VerifyEmailCodeResp::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class RegisterUserReq::_Internal {
+ public:
+};
+
+RegisterUserReq::RegisterUserReq(::google::protobuf::Arena* arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:user.RegisterUserReq)
+}
+inline PROTOBUF_NDEBUG_INLINE RegisterUserReq::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from, const ::user::RegisterUserReq& from_msg)
+      : email_(arena, from.email_),
+        username_(arena, from.username_),
+        password_(arena, from.password_),
+        verify_code_(arena, from.verify_code_),
+        request_id_(arena, from.request_id_),
+        _cached_size_{0} {}
+
+RegisterUserReq::RegisterUserReq(
+    ::google::protobuf::Arena* arena,
+    const RegisterUserReq& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  RegisterUserReq* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+
+  // @@protoc_insertion_point(copy_constructor:user.RegisterUserReq)
+}
+inline PROTOBUF_NDEBUG_INLINE RegisterUserReq::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : email_(arena),
+        username_(arena),
+        password_(arena),
+        verify_code_(arena),
+        request_id_(arena),
+        _cached_size_{0} {}
+
+inline void RegisterUserReq::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+RegisterUserReq::~RegisterUserReq() {
+  // @@protoc_insertion_point(destructor:user.RegisterUserReq)
+  SharedDtor(*this);
+}
+inline void RegisterUserReq::SharedDtor(MessageLite& self) {
+  RegisterUserReq& this_ = static_cast<RegisterUserReq&>(self);
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.email_.Destroy();
+  this_._impl_.username_.Destroy();
+  this_._impl_.password_.Destroy();
+  this_._impl_.verify_code_.Destroy();
+  this_._impl_.request_id_.Destroy();
+  this_._impl_.~Impl_();
+}
+
+inline void* RegisterUserReq::PlacementNew_(const void*, void* mem,
+                                        ::google::protobuf::Arena* arena) {
+  return ::new (mem) RegisterUserReq(arena);
+}
+constexpr auto RegisterUserReq::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(RegisterUserReq),
+                                            alignof(RegisterUserReq));
+}
+PROTOBUF_CONSTINIT
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::google::protobuf::internal::ClassDataFull RegisterUserReq::_class_data_ = {
+    ::google::protobuf::internal::ClassData{
+        &_RegisterUserReq_default_instance_._instance,
+        &_table_.header,
+        nullptr,  // OnDemandRegisterArenaDtor
+        nullptr,  // IsInitialized
+        &RegisterUserReq::MergeImpl,
+        ::google::protobuf::Message::GetNewImpl<RegisterUserReq>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        &RegisterUserReq::SharedDtor,
+        ::google::protobuf::Message::GetClearImpl<RegisterUserReq>(), &RegisterUserReq::ByteSizeLong,
+            &RegisterUserReq::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+        PROTOBUF_FIELD_OFFSET(RegisterUserReq, _impl_._cached_size_),
+        false,
+    },
+    &RegisterUserReq::kDescriptorMethods,
+    &descriptor_table_user_2eproto,
+    nullptr,  // tracker
+};
+const ::google::protobuf::internal::ClassData* RegisterUserReq::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
+  return _class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<3, 5, 0, 71, 2> RegisterUserReq::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    5, 56,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967264,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    5,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    _class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::user::RegisterUserReq>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+    // string email = 1;
+    {::_pbi::TcParser::FastUS1,
+     {10, 63, 0, PROTOBUF_FIELD_OFFSET(RegisterUserReq, _impl_.email_)}},
+    // string username = 2;
+    {::_pbi::TcParser::FastUS1,
+     {18, 63, 0, PROTOBUF_FIELD_OFFSET(RegisterUserReq, _impl_.username_)}},
+    // string password = 3;
+    {::_pbi::TcParser::FastUS1,
+     {26, 63, 0, PROTOBUF_FIELD_OFFSET(RegisterUserReq, _impl_.password_)}},
+    // string verify_code = 4;
+    {::_pbi::TcParser::FastUS1,
+     {34, 63, 0, PROTOBUF_FIELD_OFFSET(RegisterUserReq, _impl_.verify_code_)}},
+    // string request_id = 5;
+    {::_pbi::TcParser::FastUS1,
+     {42, 63, 0, PROTOBUF_FIELD_OFFSET(RegisterUserReq, _impl_.request_id_)}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // string email = 1;
+    {PROTOBUF_FIELD_OFFSET(RegisterUserReq, _impl_.email_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // string username = 2;
+    {PROTOBUF_FIELD_OFFSET(RegisterUserReq, _impl_.username_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // string password = 3;
+    {PROTOBUF_FIELD_OFFSET(RegisterUserReq, _impl_.password_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // string verify_code = 4;
+    {PROTOBUF_FIELD_OFFSET(RegisterUserReq, _impl_.verify_code_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // string request_id = 5;
+    {PROTOBUF_FIELD_OFFSET(RegisterUserReq, _impl_.request_id_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+  }},
+  // no aux_entries
+  {{
+    "\24\5\10\10\13\12\0\0"
+    "user.RegisterUserReq"
+    "email"
+    "username"
+    "password"
+    "verify_code"
+    "request_id"
+  }},
+};
+
+PROTOBUF_NOINLINE void RegisterUserReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:user.RegisterUserReq)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.email_.ClearToEmpty();
+  _impl_.username_.ClearToEmpty();
+  _impl_.password_.ClearToEmpty();
+  _impl_.verify_code_.ClearToEmpty();
+  _impl_.request_id_.ClearToEmpty();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::uint8_t* RegisterUserReq::_InternalSerialize(
+            const MessageLite& base, ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) {
+          const RegisterUserReq& this_ = static_cast<const RegisterUserReq&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::uint8_t* RegisterUserReq::_InternalSerialize(
+            ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+          const RegisterUserReq& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(serialize_to_array_start:user.RegisterUserReq)
+          ::uint32_t cached_has_bits = 0;
+          (void)cached_has_bits;
+
+          // string email = 1;
+          if (!this_._internal_email().empty()) {
+            const std::string& _s = this_._internal_email();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "user.RegisterUserReq.email");
+            target = stream->WriteStringMaybeAliased(1, _s, target);
+          }
+
+          // string username = 2;
+          if (!this_._internal_username().empty()) {
+            const std::string& _s = this_._internal_username();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "user.RegisterUserReq.username");
+            target = stream->WriteStringMaybeAliased(2, _s, target);
+          }
+
+          // string password = 3;
+          if (!this_._internal_password().empty()) {
+            const std::string& _s = this_._internal_password();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "user.RegisterUserReq.password");
+            target = stream->WriteStringMaybeAliased(3, _s, target);
+          }
+
+          // string verify_code = 4;
+          if (!this_._internal_verify_code().empty()) {
+            const std::string& _s = this_._internal_verify_code();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "user.RegisterUserReq.verify_code");
+            target = stream->WriteStringMaybeAliased(4, _s, target);
+          }
+
+          // string request_id = 5;
+          if (!this_._internal_request_id().empty()) {
+            const std::string& _s = this_._internal_request_id();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "user.RegisterUserReq.request_id");
+            target = stream->WriteStringMaybeAliased(5, _s, target);
+          }
+
+          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+            target =
+                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+          }
+          // @@protoc_insertion_point(serialize_to_array_end:user.RegisterUserReq)
+          return target;
+        }
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::size_t RegisterUserReq::ByteSizeLong(const MessageLite& base) {
+          const RegisterUserReq& this_ = static_cast<const RegisterUserReq&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::size_t RegisterUserReq::ByteSizeLong() const {
+          const RegisterUserReq& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(message_byte_size_start:user.RegisterUserReq)
+          ::size_t total_size = 0;
+
+          ::uint32_t cached_has_bits = 0;
+          // Prevent compiler warnings about cached_has_bits being unused
+          (void)cached_has_bits;
+
+          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+           {
+            // string email = 1;
+            if (!this_._internal_email().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_email());
+            }
+            // string username = 2;
+            if (!this_._internal_username().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_username());
+            }
+            // string password = 3;
+            if (!this_._internal_password().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_password());
+            }
+            // string verify_code = 4;
+            if (!this_._internal_verify_code().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_verify_code());
+            }
+            // string request_id = 5;
+            if (!this_._internal_request_id().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_request_id());
+            }
+          }
+          return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                                     &this_._impl_._cached_size_);
+        }
+
+void RegisterUserReq::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+  auto* const _this = static_cast<RegisterUserReq*>(&to_msg);
+  auto& from = static_cast<const RegisterUserReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:user.RegisterUserReq)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_email().empty()) {
+    _this->_internal_set_email(from._internal_email());
+  }
+  if (!from._internal_username().empty()) {
+    _this->_internal_set_username(from._internal_username());
+  }
+  if (!from._internal_password().empty()) {
+    _this->_internal_set_password(from._internal_password());
+  }
+  if (!from._internal_verify_code().empty()) {
+    _this->_internal_set_verify_code(from._internal_verify_code());
+  }
+  if (!from._internal_request_id().empty()) {
+    _this->_internal_set_request_id(from._internal_request_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RegisterUserReq::CopyFrom(const RegisterUserReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:user.RegisterUserReq)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void RegisterUserReq::InternalSwap(RegisterUserReq* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.email_, &other->_impl_.email_, arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.username_, &other->_impl_.username_, arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.password_, &other->_impl_.password_, arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.verify_code_, &other->_impl_.verify_code_, arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.request_id_, &other->_impl_.request_id_, arena);
+}
+
+::google::protobuf::Metadata RegisterUserReq::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class RegisterUserResp::_Internal {
+ public:
+};
+
+RegisterUserResp::RegisterUserResp(::google::protobuf::Arena* arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:user.RegisterUserResp)
+}
+inline PROTOBUF_NDEBUG_INLINE RegisterUserResp::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from, const ::user::RegisterUserResp& from_msg)
+      : uid_(arena, from.uid_),
+        email_(arena, from.email_),
+        username_(arena, from.username_),
+        _cached_size_{0} {}
+
+RegisterUserResp::RegisterUserResp(
+    ::google::protobuf::Arena* arena,
+    const RegisterUserResp& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  RegisterUserResp* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+  ::memcpy(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, ok_),
+           reinterpret_cast<const char *>(&from._impl_) +
+               offsetof(Impl_, ok_),
+           offsetof(Impl_, error_) -
+               offsetof(Impl_, ok_) +
+               sizeof(Impl_::error_));
+
+  // @@protoc_insertion_point(copy_constructor:user.RegisterUserResp)
+}
+inline PROTOBUF_NDEBUG_INLINE RegisterUserResp::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : uid_(arena),
+        email_(arena),
+        username_(arena),
+        _cached_size_{0} {}
+
+inline void RegisterUserResp::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, ok_),
+           0,
+           offsetof(Impl_, error_) -
+               offsetof(Impl_, ok_) +
+               sizeof(Impl_::error_));
+}
+RegisterUserResp::~RegisterUserResp() {
+  // @@protoc_insertion_point(destructor:user.RegisterUserResp)
+  SharedDtor(*this);
+}
+inline void RegisterUserResp::SharedDtor(MessageLite& self) {
+  RegisterUserResp& this_ = static_cast<RegisterUserResp&>(self);
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.uid_.Destroy();
+  this_._impl_.email_.Destroy();
+  this_._impl_.username_.Destroy();
+  this_._impl_.~Impl_();
+}
+
+inline void* RegisterUserResp::PlacementNew_(const void*, void* mem,
+                                        ::google::protobuf::Arena* arena) {
+  return ::new (mem) RegisterUserResp(arena);
+}
+constexpr auto RegisterUserResp::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(RegisterUserResp),
+                                            alignof(RegisterUserResp));
+}
+PROTOBUF_CONSTINIT
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::google::protobuf::internal::ClassDataFull RegisterUserResp::_class_data_ = {
+    ::google::protobuf::internal::ClassData{
+        &_RegisterUserResp_default_instance_._instance,
+        &_table_.header,
+        nullptr,  // OnDemandRegisterArenaDtor
+        nullptr,  // IsInitialized
+        &RegisterUserResp::MergeImpl,
+        ::google::protobuf::Message::GetNewImpl<RegisterUserResp>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        &RegisterUserResp::SharedDtor,
+        ::google::protobuf::Message::GetClearImpl<RegisterUserResp>(), &RegisterUserResp::ByteSizeLong,
+            &RegisterUserResp::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+        PROTOBUF_FIELD_OFFSET(RegisterUserResp, _impl_._cached_size_),
+        false,
+    },
+    &RegisterUserResp::kDescriptorMethods,
+    &descriptor_table_user_2eproto,
+    nullptr,  // tracker
+};
+const ::google::protobuf::internal::ClassData* RegisterUserResp::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
+  return _class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<3, 5, 0, 46, 2> RegisterUserResp::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    5, 56,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967264,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    5,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    _class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::user::RegisterUserResp>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+    // bool ok = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(RegisterUserResp, _impl_.ok_), 63>(),
+     {8, 63, 0, PROTOBUF_FIELD_OFFSET(RegisterUserResp, _impl_.ok_)}},
+    // int32 error = 2;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(RegisterUserResp, _impl_.error_), 63>(),
+     {16, 63, 0, PROTOBUF_FIELD_OFFSET(RegisterUserResp, _impl_.error_)}},
+    // string uid = 3;
+    {::_pbi::TcParser::FastUS1,
+     {26, 63, 0, PROTOBUF_FIELD_OFFSET(RegisterUserResp, _impl_.uid_)}},
+    // string email = 4;
+    {::_pbi::TcParser::FastUS1,
+     {34, 63, 0, PROTOBUF_FIELD_OFFSET(RegisterUserResp, _impl_.email_)}},
+    // string username = 5;
+    {::_pbi::TcParser::FastUS1,
+     {42, 63, 0, PROTOBUF_FIELD_OFFSET(RegisterUserResp, _impl_.username_)}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // bool ok = 1;
+    {PROTOBUF_FIELD_OFFSET(RegisterUserResp, _impl_.ok_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kBool)},
+    // int32 error = 2;
+    {PROTOBUF_FIELD_OFFSET(RegisterUserResp, _impl_.error_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+    // string uid = 3;
+    {PROTOBUF_FIELD_OFFSET(RegisterUserResp, _impl_.uid_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // string email = 4;
+    {PROTOBUF_FIELD_OFFSET(RegisterUserResp, _impl_.email_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // string username = 5;
+    {PROTOBUF_FIELD_OFFSET(RegisterUserResp, _impl_.username_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+  }},
+  // no aux_entries
+  {{
+    "\25\0\0\3\5\10\0\0"
+    "user.RegisterUserResp"
+    "uid"
+    "email"
+    "username"
+  }},
+};
+
+PROTOBUF_NOINLINE void RegisterUserResp::Clear() {
+// @@protoc_insertion_point(message_clear_start:user.RegisterUserResp)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.uid_.ClearToEmpty();
+  _impl_.email_.ClearToEmpty();
+  _impl_.username_.ClearToEmpty();
+  ::memset(&_impl_.ok_, 0, static_cast<::size_t>(
+      reinterpret_cast<char*>(&_impl_.error_) -
+      reinterpret_cast<char*>(&_impl_.ok_)) + sizeof(_impl_.error_));
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::uint8_t* RegisterUserResp::_InternalSerialize(
+            const MessageLite& base, ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) {
+          const RegisterUserResp& this_ = static_cast<const RegisterUserResp&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::uint8_t* RegisterUserResp::_InternalSerialize(
+            ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+          const RegisterUserResp& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(serialize_to_array_start:user.RegisterUserResp)
+          ::uint32_t cached_has_bits = 0;
+          (void)cached_has_bits;
+
+          // bool ok = 1;
+          if (this_._internal_ok() != 0) {
+            target = stream->EnsureSpace(target);
+            target = ::_pbi::WireFormatLite::WriteBoolToArray(
+                1, this_._internal_ok(), target);
+          }
+
+          // int32 error = 2;
+          if (this_._internal_error() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt32ToArrayWithField<2>(
+                    stream, this_._internal_error(), target);
+          }
+
+          // string uid = 3;
+          if (!this_._internal_uid().empty()) {
+            const std::string& _s = this_._internal_uid();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "user.RegisterUserResp.uid");
+            target = stream->WriteStringMaybeAliased(3, _s, target);
+          }
+
+          // string email = 4;
+          if (!this_._internal_email().empty()) {
+            const std::string& _s = this_._internal_email();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "user.RegisterUserResp.email");
+            target = stream->WriteStringMaybeAliased(4, _s, target);
+          }
+
+          // string username = 5;
+          if (!this_._internal_username().empty()) {
+            const std::string& _s = this_._internal_username();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "user.RegisterUserResp.username");
+            target = stream->WriteStringMaybeAliased(5, _s, target);
+          }
+
+          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+            target =
+                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+          }
+          // @@protoc_insertion_point(serialize_to_array_end:user.RegisterUserResp)
+          return target;
+        }
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::size_t RegisterUserResp::ByteSizeLong(const MessageLite& base) {
+          const RegisterUserResp& this_ = static_cast<const RegisterUserResp&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::size_t RegisterUserResp::ByteSizeLong() const {
+          const RegisterUserResp& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(message_byte_size_start:user.RegisterUserResp)
+          ::size_t total_size = 0;
+
+          ::uint32_t cached_has_bits = 0;
+          // Prevent compiler warnings about cached_has_bits being unused
+          (void)cached_has_bits;
+
+          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+           {
+            // string uid = 3;
+            if (!this_._internal_uid().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_uid());
+            }
+            // string email = 4;
+            if (!this_._internal_email().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_email());
+            }
+            // string username = 5;
+            if (!this_._internal_username().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_username());
+            }
+            // bool ok = 1;
+            if (this_._internal_ok() != 0) {
+              total_size += 2;
+            }
+            // int32 error = 2;
+            if (this_._internal_error() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+                  this_._internal_error());
+            }
+          }
+          return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                                     &this_._impl_._cached_size_);
+        }
+
+void RegisterUserResp::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+  auto* const _this = static_cast<RegisterUserResp*>(&to_msg);
+  auto& from = static_cast<const RegisterUserResp&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:user.RegisterUserResp)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_uid().empty()) {
+    _this->_internal_set_uid(from._internal_uid());
+  }
+  if (!from._internal_email().empty()) {
+    _this->_internal_set_email(from._internal_email());
+  }
+  if (!from._internal_username().empty()) {
+    _this->_internal_set_username(from._internal_username());
+  }
+  if (from._internal_ok() != 0) {
+    _this->_impl_.ok_ = from._impl_.ok_;
+  }
+  if (from._internal_error() != 0) {
+    _this->_impl_.error_ = from._impl_.error_;
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RegisterUserResp::CopyFrom(const RegisterUserResp& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:user.RegisterUserResp)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void RegisterUserResp::InternalSwap(RegisterUserResp* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.uid_, &other->_impl_.uid_, arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.email_, &other->_impl_.email_, arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.username_, &other->_impl_.username_, arena);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RegisterUserResp, _impl_.error_)
+      + sizeof(RegisterUserResp::_impl_.error_)
+      - PROTOBUF_FIELD_OFFSET(RegisterUserResp, _impl_.ok_)>(
+          reinterpret_cast<char*>(&_impl_.ok_),
+          reinterpret_cast<char*>(&other->_impl_.ok_));
+}
+
+::google::protobuf::Metadata RegisterUserResp::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class VerifyLoginReq::_Internal {
+ public:
+};
+
+VerifyLoginReq::VerifyLoginReq(::google::protobuf::Arena* arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:user.VerifyLoginReq)
+}
+inline PROTOBUF_NDEBUG_INLINE VerifyLoginReq::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from, const ::user::VerifyLoginReq& from_msg)
+      : uid_(arena, from.uid_),
+        email_(arena, from.email_),
+        password_(arena, from.password_),
+        _cached_size_{0} {}
+
+VerifyLoginReq::VerifyLoginReq(
+    ::google::protobuf::Arena* arena,
+    const VerifyLoginReq& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  VerifyLoginReq* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+
+  // @@protoc_insertion_point(copy_constructor:user.VerifyLoginReq)
+}
+inline PROTOBUF_NDEBUG_INLINE VerifyLoginReq::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : uid_(arena),
+        email_(arena),
+        password_(arena),
+        _cached_size_{0} {}
+
+inline void VerifyLoginReq::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+VerifyLoginReq::~VerifyLoginReq() {
+  // @@protoc_insertion_point(destructor:user.VerifyLoginReq)
+  SharedDtor(*this);
+}
+inline void VerifyLoginReq::SharedDtor(MessageLite& self) {
+  VerifyLoginReq& this_ = static_cast<VerifyLoginReq&>(self);
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.uid_.Destroy();
+  this_._impl_.email_.Destroy();
+  this_._impl_.password_.Destroy();
+  this_._impl_.~Impl_();
+}
+
+inline void* VerifyLoginReq::PlacementNew_(const void*, void* mem,
+                                        ::google::protobuf::Arena* arena) {
+  return ::new (mem) VerifyLoginReq(arena);
+}
+constexpr auto VerifyLoginReq::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(VerifyLoginReq),
+                                            alignof(VerifyLoginReq));
+}
+PROTOBUF_CONSTINIT
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::google::protobuf::internal::ClassDataFull VerifyLoginReq::_class_data_ = {
+    ::google::protobuf::internal::ClassData{
+        &_VerifyLoginReq_default_instance_._instance,
+        &_table_.header,
+        nullptr,  // OnDemandRegisterArenaDtor
+        nullptr,  // IsInitialized
+        &VerifyLoginReq::MergeImpl,
+        ::google::protobuf::Message::GetNewImpl<VerifyLoginReq>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        &VerifyLoginReq::SharedDtor,
+        ::google::protobuf::Message::GetClearImpl<VerifyLoginReq>(), &VerifyLoginReq::ByteSizeLong,
+            &VerifyLoginReq::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+        PROTOBUF_FIELD_OFFSET(VerifyLoginReq, _impl_._cached_size_),
+        false,
+    },
+    &VerifyLoginReq::kDescriptorMethods,
+    &descriptor_table_user_2eproto,
+    nullptr,  // tracker
+};
+const ::google::protobuf::internal::ClassData* VerifyLoginReq::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
+  return _class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<2, 3, 0, 44, 2> VerifyLoginReq::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    3, 24,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967288,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    3,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    _class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::user::VerifyLoginReq>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+    // string uid = 1;
+    {::_pbi::TcParser::FastUS1,
+     {10, 63, 0, PROTOBUF_FIELD_OFFSET(VerifyLoginReq, _impl_.uid_)}},
+    // string email = 2;
+    {::_pbi::TcParser::FastUS1,
+     {18, 63, 0, PROTOBUF_FIELD_OFFSET(VerifyLoginReq, _impl_.email_)}},
+    // string password = 3;
+    {::_pbi::TcParser::FastUS1,
+     {26, 63, 0, PROTOBUF_FIELD_OFFSET(VerifyLoginReq, _impl_.password_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // string uid = 1;
+    {PROTOBUF_FIELD_OFFSET(VerifyLoginReq, _impl_.uid_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // string email = 2;
+    {PROTOBUF_FIELD_OFFSET(VerifyLoginReq, _impl_.email_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // string password = 3;
+    {PROTOBUF_FIELD_OFFSET(VerifyLoginReq, _impl_.password_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+  }},
+  // no aux_entries
+  {{
+    "\23\3\5\10\0\0\0\0"
+    "user.VerifyLoginReq"
+    "uid"
+    "email"
+    "password"
+  }},
+};
+
+PROTOBUF_NOINLINE void VerifyLoginReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:user.VerifyLoginReq)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.uid_.ClearToEmpty();
+  _impl_.email_.ClearToEmpty();
+  _impl_.password_.ClearToEmpty();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::uint8_t* VerifyLoginReq::_InternalSerialize(
+            const MessageLite& base, ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) {
+          const VerifyLoginReq& this_ = static_cast<const VerifyLoginReq&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::uint8_t* VerifyLoginReq::_InternalSerialize(
+            ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+          const VerifyLoginReq& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(serialize_to_array_start:user.VerifyLoginReq)
+          ::uint32_t cached_has_bits = 0;
+          (void)cached_has_bits;
+
+          // string uid = 1;
+          if (!this_._internal_uid().empty()) {
+            const std::string& _s = this_._internal_uid();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "user.VerifyLoginReq.uid");
+            target = stream->WriteStringMaybeAliased(1, _s, target);
+          }
+
+          // string email = 2;
+          if (!this_._internal_email().empty()) {
+            const std::string& _s = this_._internal_email();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "user.VerifyLoginReq.email");
+            target = stream->WriteStringMaybeAliased(2, _s, target);
+          }
+
+          // string password = 3;
+          if (!this_._internal_password().empty()) {
+            const std::string& _s = this_._internal_password();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "user.VerifyLoginReq.password");
+            target = stream->WriteStringMaybeAliased(3, _s, target);
+          }
+
+          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+            target =
+                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+          }
+          // @@protoc_insertion_point(serialize_to_array_end:user.VerifyLoginReq)
+          return target;
+        }
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::size_t VerifyLoginReq::ByteSizeLong(const MessageLite& base) {
+          const VerifyLoginReq& this_ = static_cast<const VerifyLoginReq&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::size_t VerifyLoginReq::ByteSizeLong() const {
+          const VerifyLoginReq& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(message_byte_size_start:user.VerifyLoginReq)
+          ::size_t total_size = 0;
+
+          ::uint32_t cached_has_bits = 0;
+          // Prevent compiler warnings about cached_has_bits being unused
+          (void)cached_has_bits;
+
+          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+           {
+            // string uid = 1;
+            if (!this_._internal_uid().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_uid());
+            }
+            // string email = 2;
+            if (!this_._internal_email().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_email());
+            }
+            // string password = 3;
+            if (!this_._internal_password().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_password());
+            }
+          }
+          return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                                     &this_._impl_._cached_size_);
+        }
+
+void VerifyLoginReq::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+  auto* const _this = static_cast<VerifyLoginReq*>(&to_msg);
+  auto& from = static_cast<const VerifyLoginReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:user.VerifyLoginReq)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_uid().empty()) {
+    _this->_internal_set_uid(from._internal_uid());
+  }
+  if (!from._internal_email().empty()) {
+    _this->_internal_set_email(from._internal_email());
+  }
+  if (!from._internal_password().empty()) {
+    _this->_internal_set_password(from._internal_password());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void VerifyLoginReq::CopyFrom(const VerifyLoginReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:user.VerifyLoginReq)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void VerifyLoginReq::InternalSwap(VerifyLoginReq* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.uid_, &other->_impl_.uid_, arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.email_, &other->_impl_.email_, arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.password_, &other->_impl_.password_, arena);
+}
+
+::google::protobuf::Metadata VerifyLoginReq::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class VerifyLoginResp::_Internal {
+ public:
+};
+
+VerifyLoginResp::VerifyLoginResp(::google::protobuf::Arena* arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:user.VerifyLoginResp)
+}
+inline PROTOBUF_NDEBUG_INLINE VerifyLoginResp::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from, const ::user::VerifyLoginResp& from_msg)
+      : uid_(arena, from.uid_),
+        email_(arena, from.email_),
+        _cached_size_{0} {}
+
+VerifyLoginResp::VerifyLoginResp(
+    ::google::protobuf::Arena* arena,
+    const VerifyLoginResp& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  VerifyLoginResp* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+  ::memcpy(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, ok_),
+           reinterpret_cast<const char *>(&from._impl_) +
+               offsetof(Impl_, ok_),
+           offsetof(Impl_, error_) -
+               offsetof(Impl_, ok_) +
+               sizeof(Impl_::error_));
+
+  // @@protoc_insertion_point(copy_constructor:user.VerifyLoginResp)
+}
+inline PROTOBUF_NDEBUG_INLINE VerifyLoginResp::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : uid_(arena),
+        email_(arena),
+        _cached_size_{0} {}
+
+inline void VerifyLoginResp::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, ok_),
+           0,
+           offsetof(Impl_, error_) -
+               offsetof(Impl_, ok_) +
+               sizeof(Impl_::error_));
+}
+VerifyLoginResp::~VerifyLoginResp() {
+  // @@protoc_insertion_point(destructor:user.VerifyLoginResp)
+  SharedDtor(*this);
+}
+inline void VerifyLoginResp::SharedDtor(MessageLite& self) {
+  VerifyLoginResp& this_ = static_cast<VerifyLoginResp&>(self);
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.uid_.Destroy();
+  this_._impl_.email_.Destroy();
+  this_._impl_.~Impl_();
+}
+
+inline void* VerifyLoginResp::PlacementNew_(const void*, void* mem,
+                                        ::google::protobuf::Arena* arena) {
+  return ::new (mem) VerifyLoginResp(arena);
+}
+constexpr auto VerifyLoginResp::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(VerifyLoginResp),
+                                            alignof(VerifyLoginResp));
+}
+PROTOBUF_CONSTINIT
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::google::protobuf::internal::ClassDataFull VerifyLoginResp::_class_data_ = {
+    ::google::protobuf::internal::ClassData{
+        &_VerifyLoginResp_default_instance_._instance,
+        &_table_.header,
+        nullptr,  // OnDemandRegisterArenaDtor
+        nullptr,  // IsInitialized
+        &VerifyLoginResp::MergeImpl,
+        ::google::protobuf::Message::GetNewImpl<VerifyLoginResp>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        &VerifyLoginResp::SharedDtor,
+        ::google::protobuf::Message::GetClearImpl<VerifyLoginResp>(), &VerifyLoginResp::ByteSizeLong,
+            &VerifyLoginResp::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+        PROTOBUF_FIELD_OFFSET(VerifyLoginResp, _impl_._cached_size_),
+        false,
+    },
+    &VerifyLoginResp::kDescriptorMethods,
+    &descriptor_table_user_2eproto,
+    nullptr,  // tracker
+};
+const ::google::protobuf::internal::ClassData* VerifyLoginResp::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
+  return _class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<2, 4, 0, 37, 2> VerifyLoginResp::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    4, 24,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967280,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    4,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    _class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::user::VerifyLoginResp>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    // string email = 4;
+    {::_pbi::TcParser::FastUS1,
+     {34, 63, 0, PROTOBUF_FIELD_OFFSET(VerifyLoginResp, _impl_.email_)}},
+    // bool ok = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(VerifyLoginResp, _impl_.ok_), 63>(),
+     {8, 63, 0, PROTOBUF_FIELD_OFFSET(VerifyLoginResp, _impl_.ok_)}},
+    // int32 error = 2;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(VerifyLoginResp, _impl_.error_), 63>(),
+     {16, 63, 0, PROTOBUF_FIELD_OFFSET(VerifyLoginResp, _impl_.error_)}},
+    // string uid = 3;
+    {::_pbi::TcParser::FastUS1,
+     {26, 63, 0, PROTOBUF_FIELD_OFFSET(VerifyLoginResp, _impl_.uid_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // bool ok = 1;
+    {PROTOBUF_FIELD_OFFSET(VerifyLoginResp, _impl_.ok_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kBool)},
+    // int32 error = 2;
+    {PROTOBUF_FIELD_OFFSET(VerifyLoginResp, _impl_.error_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+    // string uid = 3;
+    {PROTOBUF_FIELD_OFFSET(VerifyLoginResp, _impl_.uid_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // string email = 4;
+    {PROTOBUF_FIELD_OFFSET(VerifyLoginResp, _impl_.email_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+  }},
+  // no aux_entries
+  {{
+    "\24\0\0\3\5\0\0\0"
+    "user.VerifyLoginResp"
+    "uid"
+    "email"
+  }},
+};
+
+PROTOBUF_NOINLINE void VerifyLoginResp::Clear() {
+// @@protoc_insertion_point(message_clear_start:user.VerifyLoginResp)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.uid_.ClearToEmpty();
+  _impl_.email_.ClearToEmpty();
+  ::memset(&_impl_.ok_, 0, static_cast<::size_t>(
+      reinterpret_cast<char*>(&_impl_.error_) -
+      reinterpret_cast<char*>(&_impl_.ok_)) + sizeof(_impl_.error_));
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::uint8_t* VerifyLoginResp::_InternalSerialize(
+            const MessageLite& base, ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) {
+          const VerifyLoginResp& this_ = static_cast<const VerifyLoginResp&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::uint8_t* VerifyLoginResp::_InternalSerialize(
+            ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+          const VerifyLoginResp& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(serialize_to_array_start:user.VerifyLoginResp)
+          ::uint32_t cached_has_bits = 0;
+          (void)cached_has_bits;
+
+          // bool ok = 1;
+          if (this_._internal_ok() != 0) {
+            target = stream->EnsureSpace(target);
+            target = ::_pbi::WireFormatLite::WriteBoolToArray(
+                1, this_._internal_ok(), target);
+          }
+
+          // int32 error = 2;
+          if (this_._internal_error() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt32ToArrayWithField<2>(
+                    stream, this_._internal_error(), target);
+          }
+
+          // string uid = 3;
+          if (!this_._internal_uid().empty()) {
+            const std::string& _s = this_._internal_uid();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "user.VerifyLoginResp.uid");
+            target = stream->WriteStringMaybeAliased(3, _s, target);
+          }
+
+          // string email = 4;
+          if (!this_._internal_email().empty()) {
+            const std::string& _s = this_._internal_email();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "user.VerifyLoginResp.email");
+            target = stream->WriteStringMaybeAliased(4, _s, target);
+          }
+
+          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+            target =
+                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+          }
+          // @@protoc_insertion_point(serialize_to_array_end:user.VerifyLoginResp)
+          return target;
+        }
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::size_t VerifyLoginResp::ByteSizeLong(const MessageLite& base) {
+          const VerifyLoginResp& this_ = static_cast<const VerifyLoginResp&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::size_t VerifyLoginResp::ByteSizeLong() const {
+          const VerifyLoginResp& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(message_byte_size_start:user.VerifyLoginResp)
+          ::size_t total_size = 0;
+
+          ::uint32_t cached_has_bits = 0;
+          // Prevent compiler warnings about cached_has_bits being unused
+          (void)cached_has_bits;
+
+          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+           {
+            // string uid = 3;
+            if (!this_._internal_uid().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_uid());
+            }
+            // string email = 4;
+            if (!this_._internal_email().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_email());
+            }
+            // bool ok = 1;
+            if (this_._internal_ok() != 0) {
+              total_size += 2;
+            }
+            // int32 error = 2;
+            if (this_._internal_error() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+                  this_._internal_error());
+            }
+          }
+          return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                                     &this_._impl_._cached_size_);
+        }
+
+void VerifyLoginResp::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+  auto* const _this = static_cast<VerifyLoginResp*>(&to_msg);
+  auto& from = static_cast<const VerifyLoginResp&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:user.VerifyLoginResp)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_uid().empty()) {
+    _this->_internal_set_uid(from._internal_uid());
+  }
+  if (!from._internal_email().empty()) {
+    _this->_internal_set_email(from._internal_email());
+  }
+  if (from._internal_ok() != 0) {
+    _this->_impl_.ok_ = from._impl_.ok_;
+  }
+  if (from._internal_error() != 0) {
+    _this->_impl_.error_ = from._impl_.error_;
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void VerifyLoginResp::CopyFrom(const VerifyLoginResp& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:user.VerifyLoginResp)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void VerifyLoginResp::InternalSwap(VerifyLoginResp* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.uid_, &other->_impl_.uid_, arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.email_, &other->_impl_.email_, arena);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(VerifyLoginResp, _impl_.error_)
+      + sizeof(VerifyLoginResp::_impl_.error_)
+      - PROTOBUF_FIELD_OFFSET(VerifyLoginResp, _impl_.ok_)>(
+          reinterpret_cast<char*>(&_impl_.ok_),
+          reinterpret_cast<char*>(&other->_impl_.ok_));
+}
+
+::google::protobuf::Metadata VerifyLoginResp::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class ResetPasswordReq::_Internal {
+ public:
+};
+
+ResetPasswordReq::ResetPasswordReq(::google::protobuf::Arena* arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:user.ResetPasswordReq)
+}
+inline PROTOBUF_NDEBUG_INLINE ResetPasswordReq::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from, const ::user::ResetPasswordReq& from_msg)
+      : uid_(arena, from.uid_),
+        email_(arena, from.email_),
+        new_password_(arena, from.new_password_),
+        verify_code_(arena, from.verify_code_),
+        _cached_size_{0} {}
+
+ResetPasswordReq::ResetPasswordReq(
+    ::google::protobuf::Arena* arena,
+    const ResetPasswordReq& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  ResetPasswordReq* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+
+  // @@protoc_insertion_point(copy_constructor:user.ResetPasswordReq)
+}
+inline PROTOBUF_NDEBUG_INLINE ResetPasswordReq::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : uid_(arena),
+        email_(arena),
+        new_password_(arena),
+        verify_code_(arena),
+        _cached_size_{0} {}
+
+inline void ResetPasswordReq::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+ResetPasswordReq::~ResetPasswordReq() {
+  // @@protoc_insertion_point(destructor:user.ResetPasswordReq)
+  SharedDtor(*this);
+}
+inline void ResetPasswordReq::SharedDtor(MessageLite& self) {
+  ResetPasswordReq& this_ = static_cast<ResetPasswordReq&>(self);
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.uid_.Destroy();
+  this_._impl_.email_.Destroy();
+  this_._impl_.new_password_.Destroy();
+  this_._impl_.verify_code_.Destroy();
+  this_._impl_.~Impl_();
+}
+
+inline void* ResetPasswordReq::PlacementNew_(const void*, void* mem,
+                                        ::google::protobuf::Arena* arena) {
+  return ::new (mem) ResetPasswordReq(arena);
+}
+constexpr auto ResetPasswordReq::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(ResetPasswordReq),
+                                            alignof(ResetPasswordReq));
+}
+PROTOBUF_CONSTINIT
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::google::protobuf::internal::ClassDataFull ResetPasswordReq::_class_data_ = {
+    ::google::protobuf::internal::ClassData{
+        &_ResetPasswordReq_default_instance_._instance,
+        &_table_.header,
+        nullptr,  // OnDemandRegisterArenaDtor
+        nullptr,  // IsInitialized
+        &ResetPasswordReq::MergeImpl,
+        ::google::protobuf::Message::GetNewImpl<ResetPasswordReq>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        &ResetPasswordReq::SharedDtor,
+        ::google::protobuf::Message::GetClearImpl<ResetPasswordReq>(), &ResetPasswordReq::ByteSizeLong,
+            &ResetPasswordReq::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+        PROTOBUF_FIELD_OFFSET(ResetPasswordReq, _impl_._cached_size_),
+        false,
+    },
+    &ResetPasswordReq::kDescriptorMethods,
+    &descriptor_table_user_2eproto,
+    nullptr,  // tracker
+};
+const ::google::protobuf::internal::ClassData* ResetPasswordReq::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
+  return _class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<2, 4, 0, 61, 2> ResetPasswordReq::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    4, 24,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967280,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    4,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    _class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::user::ResetPasswordReq>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    // string verify_code = 4;
+    {::_pbi::TcParser::FastUS1,
+     {34, 63, 0, PROTOBUF_FIELD_OFFSET(ResetPasswordReq, _impl_.verify_code_)}},
+    // string uid = 1;
+    {::_pbi::TcParser::FastUS1,
+     {10, 63, 0, PROTOBUF_FIELD_OFFSET(ResetPasswordReq, _impl_.uid_)}},
+    // string email = 2;
+    {::_pbi::TcParser::FastUS1,
+     {18, 63, 0, PROTOBUF_FIELD_OFFSET(ResetPasswordReq, _impl_.email_)}},
+    // string new_password = 3;
+    {::_pbi::TcParser::FastUS1,
+     {26, 63, 0, PROTOBUF_FIELD_OFFSET(ResetPasswordReq, _impl_.new_password_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // string uid = 1;
+    {PROTOBUF_FIELD_OFFSET(ResetPasswordReq, _impl_.uid_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // string email = 2;
+    {PROTOBUF_FIELD_OFFSET(ResetPasswordReq, _impl_.email_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // string new_password = 3;
+    {PROTOBUF_FIELD_OFFSET(ResetPasswordReq, _impl_.new_password_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // string verify_code = 4;
+    {PROTOBUF_FIELD_OFFSET(ResetPasswordReq, _impl_.verify_code_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+  }},
+  // no aux_entries
+  {{
+    "\25\3\5\14\13\0\0\0"
+    "user.ResetPasswordReq"
+    "uid"
+    "email"
+    "new_password"
+    "verify_code"
+  }},
+};
+
+PROTOBUF_NOINLINE void ResetPasswordReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:user.ResetPasswordReq)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.uid_.ClearToEmpty();
+  _impl_.email_.ClearToEmpty();
+  _impl_.new_password_.ClearToEmpty();
+  _impl_.verify_code_.ClearToEmpty();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::uint8_t* ResetPasswordReq::_InternalSerialize(
+            const MessageLite& base, ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) {
+          const ResetPasswordReq& this_ = static_cast<const ResetPasswordReq&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::uint8_t* ResetPasswordReq::_InternalSerialize(
+            ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+          const ResetPasswordReq& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(serialize_to_array_start:user.ResetPasswordReq)
+          ::uint32_t cached_has_bits = 0;
+          (void)cached_has_bits;
+
+          // string uid = 1;
+          if (!this_._internal_uid().empty()) {
+            const std::string& _s = this_._internal_uid();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "user.ResetPasswordReq.uid");
+            target = stream->WriteStringMaybeAliased(1, _s, target);
+          }
+
+          // string email = 2;
+          if (!this_._internal_email().empty()) {
+            const std::string& _s = this_._internal_email();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "user.ResetPasswordReq.email");
+            target = stream->WriteStringMaybeAliased(2, _s, target);
+          }
+
+          // string new_password = 3;
+          if (!this_._internal_new_password().empty()) {
+            const std::string& _s = this_._internal_new_password();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "user.ResetPasswordReq.new_password");
+            target = stream->WriteStringMaybeAliased(3, _s, target);
+          }
+
+          // string verify_code = 4;
+          if (!this_._internal_verify_code().empty()) {
+            const std::string& _s = this_._internal_verify_code();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "user.ResetPasswordReq.verify_code");
+            target = stream->WriteStringMaybeAliased(4, _s, target);
+          }
+
+          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+            target =
+                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+          }
+          // @@protoc_insertion_point(serialize_to_array_end:user.ResetPasswordReq)
+          return target;
+        }
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::size_t ResetPasswordReq::ByteSizeLong(const MessageLite& base) {
+          const ResetPasswordReq& this_ = static_cast<const ResetPasswordReq&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::size_t ResetPasswordReq::ByteSizeLong() const {
+          const ResetPasswordReq& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(message_byte_size_start:user.ResetPasswordReq)
+          ::size_t total_size = 0;
+
+          ::uint32_t cached_has_bits = 0;
+          // Prevent compiler warnings about cached_has_bits being unused
+          (void)cached_has_bits;
+
+          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+           {
+            // string uid = 1;
+            if (!this_._internal_uid().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_uid());
+            }
+            // string email = 2;
+            if (!this_._internal_email().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_email());
+            }
+            // string new_password = 3;
+            if (!this_._internal_new_password().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_new_password());
+            }
+            // string verify_code = 4;
+            if (!this_._internal_verify_code().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_verify_code());
+            }
+          }
+          return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                                     &this_._impl_._cached_size_);
+        }
+
+void ResetPasswordReq::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+  auto* const _this = static_cast<ResetPasswordReq*>(&to_msg);
+  auto& from = static_cast<const ResetPasswordReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:user.ResetPasswordReq)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_uid().empty()) {
+    _this->_internal_set_uid(from._internal_uid());
+  }
+  if (!from._internal_email().empty()) {
+    _this->_internal_set_email(from._internal_email());
+  }
+  if (!from._internal_new_password().empty()) {
+    _this->_internal_set_new_password(from._internal_new_password());
+  }
+  if (!from._internal_verify_code().empty()) {
+    _this->_internal_set_verify_code(from._internal_verify_code());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ResetPasswordReq::CopyFrom(const ResetPasswordReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:user.ResetPasswordReq)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void ResetPasswordReq::InternalSwap(ResetPasswordReq* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.uid_, &other->_impl_.uid_, arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.email_, &other->_impl_.email_, arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.new_password_, &other->_impl_.new_password_, arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.verify_code_, &other->_impl_.verify_code_, arena);
+}
+
+::google::protobuf::Metadata ResetPasswordReq::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class ResetPasswordResp::_Internal {
+ public:
+};
+
+ResetPasswordResp::ResetPasswordResp(::google::protobuf::Arena* arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:user.ResetPasswordResp)
+}
+ResetPasswordResp::ResetPasswordResp(
+    ::google::protobuf::Arena* arena, const ResetPasswordResp& from)
+    : ResetPasswordResp(arena) {
+  MergeFrom(from);
+}
+inline PROTOBUF_NDEBUG_INLINE ResetPasswordResp::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0} {}
+
+inline void ResetPasswordResp::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, ok_),
+           0,
+           offsetof(Impl_, error_) -
+               offsetof(Impl_, ok_) +
+               sizeof(Impl_::error_));
+}
+ResetPasswordResp::~ResetPasswordResp() {
+  // @@protoc_insertion_point(destructor:user.ResetPasswordResp)
+  SharedDtor(*this);
+}
+inline void ResetPasswordResp::SharedDtor(MessageLite& self) {
+  ResetPasswordResp& this_ = static_cast<ResetPasswordResp&>(self);
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.~Impl_();
+}
+
+inline void* ResetPasswordResp::PlacementNew_(const void*, void* mem,
+                                        ::google::protobuf::Arena* arena) {
+  return ::new (mem) ResetPasswordResp(arena);
+}
+constexpr auto ResetPasswordResp::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(ResetPasswordResp),
+                                            alignof(ResetPasswordResp));
+}
+PROTOBUF_CONSTINIT
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::google::protobuf::internal::ClassDataFull ResetPasswordResp::_class_data_ = {
+    ::google::protobuf::internal::ClassData{
+        &_ResetPasswordResp_default_instance_._instance,
+        &_table_.header,
+        nullptr,  // OnDemandRegisterArenaDtor
+        nullptr,  // IsInitialized
+        &ResetPasswordResp::MergeImpl,
+        ::google::protobuf::Message::GetNewImpl<ResetPasswordResp>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        &ResetPasswordResp::SharedDtor,
+        ::google::protobuf::Message::GetClearImpl<ResetPasswordResp>(), &ResetPasswordResp::ByteSizeLong,
+            &ResetPasswordResp::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+        PROTOBUF_FIELD_OFFSET(ResetPasswordResp, _impl_._cached_size_),
+        false,
+    },
+    &ResetPasswordResp::kDescriptorMethods,
+    &descriptor_table_user_2eproto,
+    nullptr,  // tracker
+};
+const ::google::protobuf::internal::ClassData* ResetPasswordResp::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
+  return _class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<1, 2, 0, 0, 2> ResetPasswordResp::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    2, 8,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967292,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    2,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    _class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::user::ResetPasswordResp>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    // int32 error = 2;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(ResetPasswordResp, _impl_.error_), 63>(),
+     {16, 63, 0, PROTOBUF_FIELD_OFFSET(ResetPasswordResp, _impl_.error_)}},
+    // bool ok = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(ResetPasswordResp, _impl_.ok_), 63>(),
+     {8, 63, 0, PROTOBUF_FIELD_OFFSET(ResetPasswordResp, _impl_.ok_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // bool ok = 1;
+    {PROTOBUF_FIELD_OFFSET(ResetPasswordResp, _impl_.ok_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kBool)},
+    // int32 error = 2;
+    {PROTOBUF_FIELD_OFFSET(ResetPasswordResp, _impl_.error_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+  }},
+  // no aux_entries
+  {{
+  }},
+};
+
+PROTOBUF_NOINLINE void ResetPasswordResp::Clear() {
+// @@protoc_insertion_point(message_clear_start:user.ResetPasswordResp)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.ok_, 0, static_cast<::size_t>(
+      reinterpret_cast<char*>(&_impl_.error_) -
+      reinterpret_cast<char*>(&_impl_.ok_)) + sizeof(_impl_.error_));
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::uint8_t* ResetPasswordResp::_InternalSerialize(
+            const MessageLite& base, ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) {
+          const ResetPasswordResp& this_ = static_cast<const ResetPasswordResp&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::uint8_t* ResetPasswordResp::_InternalSerialize(
+            ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+          const ResetPasswordResp& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(serialize_to_array_start:user.ResetPasswordResp)
+          ::uint32_t cached_has_bits = 0;
+          (void)cached_has_bits;
+
+          // bool ok = 1;
+          if (this_._internal_ok() != 0) {
+            target = stream->EnsureSpace(target);
+            target = ::_pbi::WireFormatLite::WriteBoolToArray(
+                1, this_._internal_ok(), target);
+          }
+
+          // int32 error = 2;
+          if (this_._internal_error() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt32ToArrayWithField<2>(
+                    stream, this_._internal_error(), target);
+          }
+
+          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+            target =
+                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+          }
+          // @@protoc_insertion_point(serialize_to_array_end:user.ResetPasswordResp)
+          return target;
+        }
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::size_t ResetPasswordResp::ByteSizeLong(const MessageLite& base) {
+          const ResetPasswordResp& this_ = static_cast<const ResetPasswordResp&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::size_t ResetPasswordResp::ByteSizeLong() const {
+          const ResetPasswordResp& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(message_byte_size_start:user.ResetPasswordResp)
+          ::size_t total_size = 0;
+
+          ::uint32_t cached_has_bits = 0;
+          // Prevent compiler warnings about cached_has_bits being unused
+          (void)cached_has_bits;
+
+          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+           {
+            // bool ok = 1;
+            if (this_._internal_ok() != 0) {
+              total_size += 2;
+            }
+            // int32 error = 2;
+            if (this_._internal_error() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+                  this_._internal_error());
+            }
+          }
+          return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                                     &this_._impl_._cached_size_);
+        }
+
+void ResetPasswordResp::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+  auto* const _this = static_cast<ResetPasswordResp*>(&to_msg);
+  auto& from = static_cast<const ResetPasswordResp&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:user.ResetPasswordResp)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_ok() != 0) {
+    _this->_impl_.ok_ = from._impl_.ok_;
+  }
+  if (from._internal_error() != 0) {
+    _this->_impl_.error_ = from._impl_.error_;
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ResetPasswordResp::CopyFrom(const ResetPasswordResp& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:user.ResetPasswordResp)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void ResetPasswordResp::InternalSwap(ResetPasswordResp* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ResetPasswordResp, _impl_.error_)
+      + sizeof(ResetPasswordResp::_impl_.error_)
+      - PROTOBUF_FIELD_OFFSET(ResetPasswordResp, _impl_.ok_)>(
+          reinterpret_cast<char*>(&_impl_.ok_),
+          reinterpret_cast<char*>(&other->_impl_.ok_));
+}
+
+::google::protobuf::Metadata ResetPasswordResp::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class GetUserProfileReq::_Internal {
+ public:
+};
+
+GetUserProfileReq::GetUserProfileReq(::google::protobuf::Arena* arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:user.GetUserProfileReq)
+}
+inline PROTOBUF_NDEBUG_INLINE GetUserProfileReq::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from, const ::user::GetUserProfileReq& from_msg)
+      : uid_(arena, from.uid_),
+        _cached_size_{0} {}
+
+GetUserProfileReq::GetUserProfileReq(
+    ::google::protobuf::Arena* arena,
+    const GetUserProfileReq& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  GetUserProfileReq* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+
+  // @@protoc_insertion_point(copy_constructor:user.GetUserProfileReq)
+}
+inline PROTOBUF_NDEBUG_INLINE GetUserProfileReq::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : uid_(arena),
+        _cached_size_{0} {}
+
+inline void GetUserProfileReq::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+GetUserProfileReq::~GetUserProfileReq() {
+  // @@protoc_insertion_point(destructor:user.GetUserProfileReq)
+  SharedDtor(*this);
+}
+inline void GetUserProfileReq::SharedDtor(MessageLite& self) {
+  GetUserProfileReq& this_ = static_cast<GetUserProfileReq&>(self);
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.uid_.Destroy();
+  this_._impl_.~Impl_();
+}
+
+inline void* GetUserProfileReq::PlacementNew_(const void*, void* mem,
+                                        ::google::protobuf::Arena* arena) {
+  return ::new (mem) GetUserProfileReq(arena);
+}
+constexpr auto GetUserProfileReq::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(GetUserProfileReq),
+                                            alignof(GetUserProfileReq));
+}
+PROTOBUF_CONSTINIT
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::google::protobuf::internal::ClassDataFull GetUserProfileReq::_class_data_ = {
+    ::google::protobuf::internal::ClassData{
+        &_GetUserProfileReq_default_instance_._instance,
+        &_table_.header,
+        nullptr,  // OnDemandRegisterArenaDtor
+        nullptr,  // IsInitialized
+        &GetUserProfileReq::MergeImpl,
+        ::google::protobuf::Message::GetNewImpl<GetUserProfileReq>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        &GetUserProfileReq::SharedDtor,
+        ::google::protobuf::Message::GetClearImpl<GetUserProfileReq>(), &GetUserProfileReq::ByteSizeLong,
+            &GetUserProfileReq::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+        PROTOBUF_FIELD_OFFSET(GetUserProfileReq, _impl_._cached_size_),
+        false,
+    },
+    &GetUserProfileReq::kDescriptorMethods,
+    &descriptor_table_user_2eproto,
+    nullptr,  // tracker
+};
+const ::google::protobuf::internal::ClassData* GetUserProfileReq::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
+  return _class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 0, 34, 2> GetUserProfileReq::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    1, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967294,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    _class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::user::GetUserProfileReq>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    // string uid = 1;
+    {::_pbi::TcParser::FastUS1,
+     {10, 63, 0, PROTOBUF_FIELD_OFFSET(GetUserProfileReq, _impl_.uid_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // string uid = 1;
+    {PROTOBUF_FIELD_OFFSET(GetUserProfileReq, _impl_.uid_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+  }},
+  // no aux_entries
+  {{
+    "\26\3\0\0\0\0\0\0"
+    "user.GetUserProfileReq"
+    "uid"
+  }},
+};
+
+PROTOBUF_NOINLINE void GetUserProfileReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:user.GetUserProfileReq)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.uid_.ClearToEmpty();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::uint8_t* GetUserProfileReq::_InternalSerialize(
+            const MessageLite& base, ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) {
+          const GetUserProfileReq& this_ = static_cast<const GetUserProfileReq&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::uint8_t* GetUserProfileReq::_InternalSerialize(
+            ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+          const GetUserProfileReq& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(serialize_to_array_start:user.GetUserProfileReq)
+          ::uint32_t cached_has_bits = 0;
+          (void)cached_has_bits;
+
+          // string uid = 1;
+          if (!this_._internal_uid().empty()) {
+            const std::string& _s = this_._internal_uid();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "user.GetUserProfileReq.uid");
+            target = stream->WriteStringMaybeAliased(1, _s, target);
+          }
+
+          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+            target =
+                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+          }
+          // @@protoc_insertion_point(serialize_to_array_end:user.GetUserProfileReq)
+          return target;
+        }
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::size_t GetUserProfileReq::ByteSizeLong(const MessageLite& base) {
+          const GetUserProfileReq& this_ = static_cast<const GetUserProfileReq&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::size_t GetUserProfileReq::ByteSizeLong() const {
+          const GetUserProfileReq& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(message_byte_size_start:user.GetUserProfileReq)
+          ::size_t total_size = 0;
+
+          ::uint32_t cached_has_bits = 0;
+          // Prevent compiler warnings about cached_has_bits being unused
+          (void)cached_has_bits;
+
+           {
+            // string uid = 1;
+            if (!this_._internal_uid().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_uid());
+            }
+          }
+          return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                                     &this_._impl_._cached_size_);
+        }
+
+void GetUserProfileReq::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+  auto* const _this = static_cast<GetUserProfileReq*>(&to_msg);
+  auto& from = static_cast<const GetUserProfileReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:user.GetUserProfileReq)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_uid().empty()) {
+    _this->_internal_set_uid(from._internal_uid());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void GetUserProfileReq::CopyFrom(const GetUserProfileReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:user.GetUserProfileReq)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void GetUserProfileReq::InternalSwap(GetUserProfileReq* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.uid_, &other->_impl_.uid_, arena);
+}
+
+::google::protobuf::Metadata GetUserProfileReq::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class GetUserProfileResp::_Internal {
+ public:
+};
+
+GetUserProfileResp::GetUserProfileResp(::google::protobuf::Arena* arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:user.GetUserProfileResp)
+}
+inline PROTOBUF_NDEBUG_INLINE GetUserProfileResp::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from, const ::user::GetUserProfileResp& from_msg)
+      : uid_(arena, from.uid_),
+        email_(arena, from.email_),
+        username_(arena, from.username_),
+        birth_(arena, from.birth_),
+        sex_(arena, from.sex_),
+        avatar_(arena, from.avatar_),
+        _cached_size_{0} {}
+
+GetUserProfileResp::GetUserProfileResp(
+    ::google::protobuf::Arena* arena,
+    const GetUserProfileResp& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  GetUserProfileResp* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+  _impl_.ok_ = from._impl_.ok_;
+
+  // @@protoc_insertion_point(copy_constructor:user.GetUserProfileResp)
+}
+inline PROTOBUF_NDEBUG_INLINE GetUserProfileResp::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : uid_(arena),
+        email_(arena),
+        username_(arena),
+        birth_(arena),
+        sex_(arena),
+        avatar_(arena),
+        _cached_size_{0} {}
+
+inline void GetUserProfileResp::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.ok_ = {};
+}
+GetUserProfileResp::~GetUserProfileResp() {
+  // @@protoc_insertion_point(destructor:user.GetUserProfileResp)
+  SharedDtor(*this);
+}
+inline void GetUserProfileResp::SharedDtor(MessageLite& self) {
+  GetUserProfileResp& this_ = static_cast<GetUserProfileResp&>(self);
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.uid_.Destroy();
+  this_._impl_.email_.Destroy();
+  this_._impl_.username_.Destroy();
+  this_._impl_.birth_.Destroy();
+  this_._impl_.sex_.Destroy();
+  this_._impl_.avatar_.Destroy();
+  this_._impl_.~Impl_();
+}
+
+inline void* GetUserProfileResp::PlacementNew_(const void*, void* mem,
+                                        ::google::protobuf::Arena* arena) {
+  return ::new (mem) GetUserProfileResp(arena);
+}
+constexpr auto GetUserProfileResp::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(GetUserProfileResp),
+                                            alignof(GetUserProfileResp));
+}
+PROTOBUF_CONSTINIT
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::google::protobuf::internal::ClassDataFull GetUserProfileResp::_class_data_ = {
+    ::google::protobuf::internal::ClassData{
+        &_GetUserProfileResp_default_instance_._instance,
+        &_table_.header,
+        nullptr,  // OnDemandRegisterArenaDtor
+        nullptr,  // IsInitialized
+        &GetUserProfileResp::MergeImpl,
+        ::google::protobuf::Message::GetNewImpl<GetUserProfileResp>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        &GetUserProfileResp::SharedDtor,
+        ::google::protobuf::Message::GetClearImpl<GetUserProfileResp>(), &GetUserProfileResp::ByteSizeLong,
+            &GetUserProfileResp::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+        PROTOBUF_FIELD_OFFSET(GetUserProfileResp, _impl_._cached_size_),
+        false,
+    },
+    &GetUserProfileResp::kDescriptorMethods,
+    &descriptor_table_user_2eproto,
+    nullptr,  // tracker
+};
+const ::google::protobuf::internal::ClassData* GetUserProfileResp::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
+  return _class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<3, 7, 0, 62, 2> GetUserProfileResp::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    7, 56,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967168,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    7,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    _class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::user::GetUserProfileResp>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+    // bool ok = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(GetUserProfileResp, _impl_.ok_), 63>(),
+     {8, 63, 0, PROTOBUF_FIELD_OFFSET(GetUserProfileResp, _impl_.ok_)}},
+    // string uid = 2;
+    {::_pbi::TcParser::FastUS1,
+     {18, 63, 0, PROTOBUF_FIELD_OFFSET(GetUserProfileResp, _impl_.uid_)}},
+    // string email = 3;
+    {::_pbi::TcParser::FastUS1,
+     {26, 63, 0, PROTOBUF_FIELD_OFFSET(GetUserProfileResp, _impl_.email_)}},
+    // string username = 4;
+    {::_pbi::TcParser::FastUS1,
+     {34, 63, 0, PROTOBUF_FIELD_OFFSET(GetUserProfileResp, _impl_.username_)}},
+    // string birth = 5;
+    {::_pbi::TcParser::FastUS1,
+     {42, 63, 0, PROTOBUF_FIELD_OFFSET(GetUserProfileResp, _impl_.birth_)}},
+    // string sex = 6;
+    {::_pbi::TcParser::FastUS1,
+     {50, 63, 0, PROTOBUF_FIELD_OFFSET(GetUserProfileResp, _impl_.sex_)}},
+    // string avatar = 7;
+    {::_pbi::TcParser::FastUS1,
+     {58, 63, 0, PROTOBUF_FIELD_OFFSET(GetUserProfileResp, _impl_.avatar_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // bool ok = 1;
+    {PROTOBUF_FIELD_OFFSET(GetUserProfileResp, _impl_.ok_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kBool)},
+    // string uid = 2;
+    {PROTOBUF_FIELD_OFFSET(GetUserProfileResp, _impl_.uid_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // string email = 3;
+    {PROTOBUF_FIELD_OFFSET(GetUserProfileResp, _impl_.email_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // string username = 4;
+    {PROTOBUF_FIELD_OFFSET(GetUserProfileResp, _impl_.username_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // string birth = 5;
+    {PROTOBUF_FIELD_OFFSET(GetUserProfileResp, _impl_.birth_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // string sex = 6;
+    {PROTOBUF_FIELD_OFFSET(GetUserProfileResp, _impl_.sex_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // string avatar = 7;
+    {PROTOBUF_FIELD_OFFSET(GetUserProfileResp, _impl_.avatar_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+  }},
+  // no aux_entries
+  {{
+    "\27\0\3\5\10\5\3\6"
+    "user.GetUserProfileResp"
+    "uid"
+    "email"
+    "username"
+    "birth"
+    "sex"
+    "avatar"
+  }},
+};
+
+PROTOBUF_NOINLINE void GetUserProfileResp::Clear() {
+// @@protoc_insertion_point(message_clear_start:user.GetUserProfileResp)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.uid_.ClearToEmpty();
+  _impl_.email_.ClearToEmpty();
+  _impl_.username_.ClearToEmpty();
+  _impl_.birth_.ClearToEmpty();
+  _impl_.sex_.ClearToEmpty();
+  _impl_.avatar_.ClearToEmpty();
+  _impl_.ok_ = false;
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::uint8_t* GetUserProfileResp::_InternalSerialize(
+            const MessageLite& base, ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) {
+          const GetUserProfileResp& this_ = static_cast<const GetUserProfileResp&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::uint8_t* GetUserProfileResp::_InternalSerialize(
+            ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+          const GetUserProfileResp& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(serialize_to_array_start:user.GetUserProfileResp)
+          ::uint32_t cached_has_bits = 0;
+          (void)cached_has_bits;
+
+          // bool ok = 1;
+          if (this_._internal_ok() != 0) {
+            target = stream->EnsureSpace(target);
+            target = ::_pbi::WireFormatLite::WriteBoolToArray(
+                1, this_._internal_ok(), target);
+          }
+
+          // string uid = 2;
+          if (!this_._internal_uid().empty()) {
+            const std::string& _s = this_._internal_uid();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "user.GetUserProfileResp.uid");
+            target = stream->WriteStringMaybeAliased(2, _s, target);
+          }
+
+          // string email = 3;
+          if (!this_._internal_email().empty()) {
+            const std::string& _s = this_._internal_email();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "user.GetUserProfileResp.email");
+            target = stream->WriteStringMaybeAliased(3, _s, target);
+          }
+
+          // string username = 4;
+          if (!this_._internal_username().empty()) {
+            const std::string& _s = this_._internal_username();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "user.GetUserProfileResp.username");
+            target = stream->WriteStringMaybeAliased(4, _s, target);
+          }
+
+          // string birth = 5;
+          if (!this_._internal_birth().empty()) {
+            const std::string& _s = this_._internal_birth();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "user.GetUserProfileResp.birth");
+            target = stream->WriteStringMaybeAliased(5, _s, target);
+          }
+
+          // string sex = 6;
+          if (!this_._internal_sex().empty()) {
+            const std::string& _s = this_._internal_sex();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "user.GetUserProfileResp.sex");
+            target = stream->WriteStringMaybeAliased(6, _s, target);
+          }
+
+          // string avatar = 7;
+          if (!this_._internal_avatar().empty()) {
+            const std::string& _s = this_._internal_avatar();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "user.GetUserProfileResp.avatar");
+            target = stream->WriteStringMaybeAliased(7, _s, target);
+          }
+
+          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+            target =
+                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+          }
+          // @@protoc_insertion_point(serialize_to_array_end:user.GetUserProfileResp)
+          return target;
+        }
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::size_t GetUserProfileResp::ByteSizeLong(const MessageLite& base) {
+          const GetUserProfileResp& this_ = static_cast<const GetUserProfileResp&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::size_t GetUserProfileResp::ByteSizeLong() const {
+          const GetUserProfileResp& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(message_byte_size_start:user.GetUserProfileResp)
+          ::size_t total_size = 0;
+
+          ::uint32_t cached_has_bits = 0;
+          // Prevent compiler warnings about cached_has_bits being unused
+          (void)cached_has_bits;
+
+          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+           {
+            // string uid = 2;
+            if (!this_._internal_uid().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_uid());
+            }
+            // string email = 3;
+            if (!this_._internal_email().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_email());
+            }
+            // string username = 4;
+            if (!this_._internal_username().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_username());
+            }
+            // string birth = 5;
+            if (!this_._internal_birth().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_birth());
+            }
+            // string sex = 6;
+            if (!this_._internal_sex().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_sex());
+            }
+            // string avatar = 7;
+            if (!this_._internal_avatar().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_avatar());
+            }
+            // bool ok = 1;
+            if (this_._internal_ok() != 0) {
+              total_size += 2;
+            }
+          }
+          return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                                     &this_._impl_._cached_size_);
+        }
+
+void GetUserProfileResp::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+  auto* const _this = static_cast<GetUserProfileResp*>(&to_msg);
+  auto& from = static_cast<const GetUserProfileResp&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:user.GetUserProfileResp)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_uid().empty()) {
+    _this->_internal_set_uid(from._internal_uid());
+  }
+  if (!from._internal_email().empty()) {
+    _this->_internal_set_email(from._internal_email());
+  }
+  if (!from._internal_username().empty()) {
+    _this->_internal_set_username(from._internal_username());
+  }
+  if (!from._internal_birth().empty()) {
+    _this->_internal_set_birth(from._internal_birth());
+  }
+  if (!from._internal_sex().empty()) {
+    _this->_internal_set_sex(from._internal_sex());
+  }
+  if (!from._internal_avatar().empty()) {
+    _this->_internal_set_avatar(from._internal_avatar());
+  }
+  if (from._internal_ok() != 0) {
+    _this->_impl_.ok_ = from._impl_.ok_;
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void GetUserProfileResp::CopyFrom(const GetUserProfileResp& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:user.GetUserProfileResp)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void GetUserProfileResp::InternalSwap(GetUserProfileResp* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.uid_, &other->_impl_.uid_, arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.email_, &other->_impl_.email_, arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.username_, &other->_impl_.username_, arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.birth_, &other->_impl_.birth_, arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.sex_, &other->_impl_.sex_, arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.avatar_, &other->_impl_.avatar_, arena);
+        swap(_impl_.ok_, other->_impl_.ok_);
+}
+
+::google::protobuf::Metadata GetUserProfileResp::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class UpdateUserProfileReq::_Internal {
+ public:
+};
+
+UpdateUserProfileReq::UpdateUserProfileReq(::google::protobuf::Arena* arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:user.UpdateUserProfileReq)
+}
+inline PROTOBUF_NDEBUG_INLINE UpdateUserProfileReq::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from, const ::user::UpdateUserProfileReq& from_msg)
+      : uid_(arena, from.uid_),
+        username_(arena, from.username_),
+        birth_(arena, from.birth_),
+        sex_(arena, from.sex_),
+        avatar_(arena, from.avatar_),
+        _cached_size_{0} {}
+
+UpdateUserProfileReq::UpdateUserProfileReq(
+    ::google::protobuf::Arena* arena,
+    const UpdateUserProfileReq& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  UpdateUserProfileReq* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+
+  // @@protoc_insertion_point(copy_constructor:user.UpdateUserProfileReq)
+}
+inline PROTOBUF_NDEBUG_INLINE UpdateUserProfileReq::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : uid_(arena),
+        username_(arena),
+        birth_(arena),
+        sex_(arena),
+        avatar_(arena),
+        _cached_size_{0} {}
+
+inline void UpdateUserProfileReq::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+UpdateUserProfileReq::~UpdateUserProfileReq() {
+  // @@protoc_insertion_point(destructor:user.UpdateUserProfileReq)
+  SharedDtor(*this);
+}
+inline void UpdateUserProfileReq::SharedDtor(MessageLite& self) {
+  UpdateUserProfileReq& this_ = static_cast<UpdateUserProfileReq&>(self);
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.uid_.Destroy();
+  this_._impl_.username_.Destroy();
+  this_._impl_.birth_.Destroy();
+  this_._impl_.sex_.Destroy();
+  this_._impl_.avatar_.Destroy();
+  this_._impl_.~Impl_();
+}
+
+inline void* UpdateUserProfileReq::PlacementNew_(const void*, void* mem,
+                                        ::google::protobuf::Arena* arena) {
+  return ::new (mem) UpdateUserProfileReq(arena);
+}
+constexpr auto UpdateUserProfileReq::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(UpdateUserProfileReq),
+                                            alignof(UpdateUserProfileReq));
+}
+PROTOBUF_CONSTINIT
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::google::protobuf::internal::ClassDataFull UpdateUserProfileReq::_class_data_ = {
+    ::google::protobuf::internal::ClassData{
+        &_UpdateUserProfileReq_default_instance_._instance,
+        &_table_.header,
+        nullptr,  // OnDemandRegisterArenaDtor
+        nullptr,  // IsInitialized
+        &UpdateUserProfileReq::MergeImpl,
+        ::google::protobuf::Message::GetNewImpl<UpdateUserProfileReq>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        &UpdateUserProfileReq::SharedDtor,
+        ::google::protobuf::Message::GetClearImpl<UpdateUserProfileReq>(), &UpdateUserProfileReq::ByteSizeLong,
+            &UpdateUserProfileReq::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+        PROTOBUF_FIELD_OFFSET(UpdateUserProfileReq, _impl_._cached_size_),
+        false,
+    },
+    &UpdateUserProfileReq::kDescriptorMethods,
+    &descriptor_table_user_2eproto,
+    nullptr,  // tracker
+};
+const ::google::protobuf::internal::ClassData* UpdateUserProfileReq::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
+  return _class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<3, 5, 0, 59, 2> UpdateUserProfileReq::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    5, 56,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967264,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    5,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    _class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::user::UpdateUserProfileReq>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+    // string uid = 1;
+    {::_pbi::TcParser::FastUS1,
+     {10, 63, 0, PROTOBUF_FIELD_OFFSET(UpdateUserProfileReq, _impl_.uid_)}},
+    // string username = 2;
+    {::_pbi::TcParser::FastUS1,
+     {18, 63, 0, PROTOBUF_FIELD_OFFSET(UpdateUserProfileReq, _impl_.username_)}},
+    // string birth = 3;
+    {::_pbi::TcParser::FastUS1,
+     {26, 63, 0, PROTOBUF_FIELD_OFFSET(UpdateUserProfileReq, _impl_.birth_)}},
+    // string sex = 4;
+    {::_pbi::TcParser::FastUS1,
+     {34, 63, 0, PROTOBUF_FIELD_OFFSET(UpdateUserProfileReq, _impl_.sex_)}},
+    // string avatar = 5;
+    {::_pbi::TcParser::FastUS1,
+     {42, 63, 0, PROTOBUF_FIELD_OFFSET(UpdateUserProfileReq, _impl_.avatar_)}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // string uid = 1;
+    {PROTOBUF_FIELD_OFFSET(UpdateUserProfileReq, _impl_.uid_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // string username = 2;
+    {PROTOBUF_FIELD_OFFSET(UpdateUserProfileReq, _impl_.username_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // string birth = 3;
+    {PROTOBUF_FIELD_OFFSET(UpdateUserProfileReq, _impl_.birth_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // string sex = 4;
+    {PROTOBUF_FIELD_OFFSET(UpdateUserProfileReq, _impl_.sex_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // string avatar = 5;
+    {PROTOBUF_FIELD_OFFSET(UpdateUserProfileReq, _impl_.avatar_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+  }},
+  // no aux_entries
+  {{
+    "\31\3\10\5\3\6\0\0"
+    "user.UpdateUserProfileReq"
+    "uid"
+    "username"
+    "birth"
+    "sex"
+    "avatar"
+  }},
+};
+
+PROTOBUF_NOINLINE void UpdateUserProfileReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:user.UpdateUserProfileReq)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.uid_.ClearToEmpty();
+  _impl_.username_.ClearToEmpty();
+  _impl_.birth_.ClearToEmpty();
+  _impl_.sex_.ClearToEmpty();
+  _impl_.avatar_.ClearToEmpty();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::uint8_t* UpdateUserProfileReq::_InternalSerialize(
+            const MessageLite& base, ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) {
+          const UpdateUserProfileReq& this_ = static_cast<const UpdateUserProfileReq&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::uint8_t* UpdateUserProfileReq::_InternalSerialize(
+            ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+          const UpdateUserProfileReq& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(serialize_to_array_start:user.UpdateUserProfileReq)
+          ::uint32_t cached_has_bits = 0;
+          (void)cached_has_bits;
+
+          // string uid = 1;
+          if (!this_._internal_uid().empty()) {
+            const std::string& _s = this_._internal_uid();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "user.UpdateUserProfileReq.uid");
+            target = stream->WriteStringMaybeAliased(1, _s, target);
+          }
+
+          // string username = 2;
+          if (!this_._internal_username().empty()) {
+            const std::string& _s = this_._internal_username();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "user.UpdateUserProfileReq.username");
+            target = stream->WriteStringMaybeAliased(2, _s, target);
+          }
+
+          // string birth = 3;
+          if (!this_._internal_birth().empty()) {
+            const std::string& _s = this_._internal_birth();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "user.UpdateUserProfileReq.birth");
+            target = stream->WriteStringMaybeAliased(3, _s, target);
+          }
+
+          // string sex = 4;
+          if (!this_._internal_sex().empty()) {
+            const std::string& _s = this_._internal_sex();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "user.UpdateUserProfileReq.sex");
+            target = stream->WriteStringMaybeAliased(4, _s, target);
+          }
+
+          // string avatar = 5;
+          if (!this_._internal_avatar().empty()) {
+            const std::string& _s = this_._internal_avatar();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "user.UpdateUserProfileReq.avatar");
+            target = stream->WriteStringMaybeAliased(5, _s, target);
+          }
+
+          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+            target =
+                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+          }
+          // @@protoc_insertion_point(serialize_to_array_end:user.UpdateUserProfileReq)
+          return target;
+        }
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::size_t UpdateUserProfileReq::ByteSizeLong(const MessageLite& base) {
+          const UpdateUserProfileReq& this_ = static_cast<const UpdateUserProfileReq&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::size_t UpdateUserProfileReq::ByteSizeLong() const {
+          const UpdateUserProfileReq& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(message_byte_size_start:user.UpdateUserProfileReq)
+          ::size_t total_size = 0;
+
+          ::uint32_t cached_has_bits = 0;
+          // Prevent compiler warnings about cached_has_bits being unused
+          (void)cached_has_bits;
+
+          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+           {
+            // string uid = 1;
+            if (!this_._internal_uid().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_uid());
+            }
+            // string username = 2;
+            if (!this_._internal_username().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_username());
+            }
+            // string birth = 3;
+            if (!this_._internal_birth().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_birth());
+            }
+            // string sex = 4;
+            if (!this_._internal_sex().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_sex());
+            }
+            // string avatar = 5;
+            if (!this_._internal_avatar().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_avatar());
+            }
+          }
+          return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                                     &this_._impl_._cached_size_);
+        }
+
+void UpdateUserProfileReq::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+  auto* const _this = static_cast<UpdateUserProfileReq*>(&to_msg);
+  auto& from = static_cast<const UpdateUserProfileReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:user.UpdateUserProfileReq)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_uid().empty()) {
+    _this->_internal_set_uid(from._internal_uid());
+  }
+  if (!from._internal_username().empty()) {
+    _this->_internal_set_username(from._internal_username());
+  }
+  if (!from._internal_birth().empty()) {
+    _this->_internal_set_birth(from._internal_birth());
+  }
+  if (!from._internal_sex().empty()) {
+    _this->_internal_set_sex(from._internal_sex());
+  }
+  if (!from._internal_avatar().empty()) {
+    _this->_internal_set_avatar(from._internal_avatar());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void UpdateUserProfileReq::CopyFrom(const UpdateUserProfileReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:user.UpdateUserProfileReq)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void UpdateUserProfileReq::InternalSwap(UpdateUserProfileReq* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.uid_, &other->_impl_.uid_, arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.username_, &other->_impl_.username_, arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.birth_, &other->_impl_.birth_, arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.sex_, &other->_impl_.sex_, arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.avatar_, &other->_impl_.avatar_, arena);
+}
+
+::google::protobuf::Metadata UpdateUserProfileReq::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class UpdateUserProfileResp::_Internal {
+ public:
+};
+
+UpdateUserProfileResp::UpdateUserProfileResp(::google::protobuf::Arena* arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:user.UpdateUserProfileResp)
+}
+UpdateUserProfileResp::UpdateUserProfileResp(
+    ::google::protobuf::Arena* arena, const UpdateUserProfileResp& from)
+    : UpdateUserProfileResp(arena) {
+  MergeFrom(from);
+}
+inline PROTOBUF_NDEBUG_INLINE UpdateUserProfileResp::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0} {}
+
+inline void UpdateUserProfileResp::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, ok_),
+           0,
+           offsetof(Impl_, error_) -
+               offsetof(Impl_, ok_) +
+               sizeof(Impl_::error_));
+}
+UpdateUserProfileResp::~UpdateUserProfileResp() {
+  // @@protoc_insertion_point(destructor:user.UpdateUserProfileResp)
+  SharedDtor(*this);
+}
+inline void UpdateUserProfileResp::SharedDtor(MessageLite& self) {
+  UpdateUserProfileResp& this_ = static_cast<UpdateUserProfileResp&>(self);
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.~Impl_();
+}
+
+inline void* UpdateUserProfileResp::PlacementNew_(const void*, void* mem,
+                                        ::google::protobuf::Arena* arena) {
+  return ::new (mem) UpdateUserProfileResp(arena);
+}
+constexpr auto UpdateUserProfileResp::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(UpdateUserProfileResp),
+                                            alignof(UpdateUserProfileResp));
+}
+PROTOBUF_CONSTINIT
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::google::protobuf::internal::ClassDataFull UpdateUserProfileResp::_class_data_ = {
+    ::google::protobuf::internal::ClassData{
+        &_UpdateUserProfileResp_default_instance_._instance,
+        &_table_.header,
+        nullptr,  // OnDemandRegisterArenaDtor
+        nullptr,  // IsInitialized
+        &UpdateUserProfileResp::MergeImpl,
+        ::google::protobuf::Message::GetNewImpl<UpdateUserProfileResp>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        &UpdateUserProfileResp::SharedDtor,
+        ::google::protobuf::Message::GetClearImpl<UpdateUserProfileResp>(), &UpdateUserProfileResp::ByteSizeLong,
+            &UpdateUserProfileResp::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+        PROTOBUF_FIELD_OFFSET(UpdateUserProfileResp, _impl_._cached_size_),
+        false,
+    },
+    &UpdateUserProfileResp::kDescriptorMethods,
+    &descriptor_table_user_2eproto,
+    nullptr,  // tracker
+};
+const ::google::protobuf::internal::ClassData* UpdateUserProfileResp::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
+  return _class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<1, 2, 0, 0, 2> UpdateUserProfileResp::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    2, 8,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967292,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    2,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    _class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::user::UpdateUserProfileResp>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    // int32 error = 2;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(UpdateUserProfileResp, _impl_.error_), 63>(),
+     {16, 63, 0, PROTOBUF_FIELD_OFFSET(UpdateUserProfileResp, _impl_.error_)}},
+    // bool ok = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(UpdateUserProfileResp, _impl_.ok_), 63>(),
+     {8, 63, 0, PROTOBUF_FIELD_OFFSET(UpdateUserProfileResp, _impl_.ok_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // bool ok = 1;
+    {PROTOBUF_FIELD_OFFSET(UpdateUserProfileResp, _impl_.ok_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kBool)},
+    // int32 error = 2;
+    {PROTOBUF_FIELD_OFFSET(UpdateUserProfileResp, _impl_.error_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+  }},
+  // no aux_entries
+  {{
+  }},
+};
+
+PROTOBUF_NOINLINE void UpdateUserProfileResp::Clear() {
+// @@protoc_insertion_point(message_clear_start:user.UpdateUserProfileResp)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.ok_, 0, static_cast<::size_t>(
+      reinterpret_cast<char*>(&_impl_.error_) -
+      reinterpret_cast<char*>(&_impl_.ok_)) + sizeof(_impl_.error_));
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::uint8_t* UpdateUserProfileResp::_InternalSerialize(
+            const MessageLite& base, ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) {
+          const UpdateUserProfileResp& this_ = static_cast<const UpdateUserProfileResp&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::uint8_t* UpdateUserProfileResp::_InternalSerialize(
+            ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+          const UpdateUserProfileResp& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(serialize_to_array_start:user.UpdateUserProfileResp)
+          ::uint32_t cached_has_bits = 0;
+          (void)cached_has_bits;
+
+          // bool ok = 1;
+          if (this_._internal_ok() != 0) {
+            target = stream->EnsureSpace(target);
+            target = ::_pbi::WireFormatLite::WriteBoolToArray(
+                1, this_._internal_ok(), target);
+          }
+
+          // int32 error = 2;
+          if (this_._internal_error() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt32ToArrayWithField<2>(
+                    stream, this_._internal_error(), target);
+          }
+
+          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+            target =
+                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+          }
+          // @@protoc_insertion_point(serialize_to_array_end:user.UpdateUserProfileResp)
+          return target;
+        }
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::size_t UpdateUserProfileResp::ByteSizeLong(const MessageLite& base) {
+          const UpdateUserProfileResp& this_ = static_cast<const UpdateUserProfileResp&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::size_t UpdateUserProfileResp::ByteSizeLong() const {
+          const UpdateUserProfileResp& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(message_byte_size_start:user.UpdateUserProfileResp)
+          ::size_t total_size = 0;
+
+          ::uint32_t cached_has_bits = 0;
+          // Prevent compiler warnings about cached_has_bits being unused
+          (void)cached_has_bits;
+
+          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+           {
+            // bool ok = 1;
+            if (this_._internal_ok() != 0) {
+              total_size += 2;
+            }
+            // int32 error = 2;
+            if (this_._internal_error() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+                  this_._internal_error());
+            }
+          }
+          return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                                     &this_._impl_._cached_size_);
+        }
+
+void UpdateUserProfileResp::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+  auto* const _this = static_cast<UpdateUserProfileResp*>(&to_msg);
+  auto& from = static_cast<const UpdateUserProfileResp&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:user.UpdateUserProfileResp)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_ok() != 0) {
+    _this->_impl_.ok_ = from._impl_.ok_;
+  }
+  if (from._internal_error() != 0) {
+    _this->_impl_.error_ = from._impl_.error_;
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void UpdateUserProfileResp::CopyFrom(const UpdateUserProfileResp& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:user.UpdateUserProfileResp)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void UpdateUserProfileResp::InternalSwap(UpdateUserProfileResp* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(UpdateUserProfileResp, _impl_.error_)
+      + sizeof(UpdateUserProfileResp::_impl_.error_)
+      - PROTOBUF_FIELD_OFFSET(UpdateUserProfileResp, _impl_.ok_)>(
+          reinterpret_cast<char*>(&_impl_.ok_),
+          reinterpret_cast<char*>(&other->_impl_.ok_));
+}
+
+::google::protobuf::Metadata UpdateUserProfileResp::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class FuzzySearchUserReq::_Internal {
+ public:
+};
+
+FuzzySearchUserReq::FuzzySearchUserReq(::google::protobuf::Arena* arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:user.FuzzySearchUserReq)
+}
+inline PROTOBUF_NDEBUG_INLINE FuzzySearchUserReq::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from, const ::user::FuzzySearchUserReq& from_msg)
+      : uid_(arena, from.uid_),
+        pattern_(arena, from.pattern_),
+        _cached_size_{0} {}
+
+FuzzySearchUserReq::FuzzySearchUserReq(
+    ::google::protobuf::Arena* arena,
+    const FuzzySearchUserReq& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  FuzzySearchUserReq* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+
+  // @@protoc_insertion_point(copy_constructor:user.FuzzySearchUserReq)
+}
+inline PROTOBUF_NDEBUG_INLINE FuzzySearchUserReq::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : uid_(arena),
+        pattern_(arena),
+        _cached_size_{0} {}
+
+inline void FuzzySearchUserReq::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+FuzzySearchUserReq::~FuzzySearchUserReq() {
+  // @@protoc_insertion_point(destructor:user.FuzzySearchUserReq)
+  SharedDtor(*this);
+}
+inline void FuzzySearchUserReq::SharedDtor(MessageLite& self) {
+  FuzzySearchUserReq& this_ = static_cast<FuzzySearchUserReq&>(self);
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.uid_.Destroy();
+  this_._impl_.pattern_.Destroy();
+  this_._impl_.~Impl_();
+}
+
+inline void* FuzzySearchUserReq::PlacementNew_(const void*, void* mem,
+                                        ::google::protobuf::Arena* arena) {
+  return ::new (mem) FuzzySearchUserReq(arena);
+}
+constexpr auto FuzzySearchUserReq::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(FuzzySearchUserReq),
+                                            alignof(FuzzySearchUserReq));
+}
+PROTOBUF_CONSTINIT
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::google::protobuf::internal::ClassDataFull FuzzySearchUserReq::_class_data_ = {
+    ::google::protobuf::internal::ClassData{
+        &_FuzzySearchUserReq_default_instance_._instance,
+        &_table_.header,
+        nullptr,  // OnDemandRegisterArenaDtor
+        nullptr,  // IsInitialized
+        &FuzzySearchUserReq::MergeImpl,
+        ::google::protobuf::Message::GetNewImpl<FuzzySearchUserReq>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        &FuzzySearchUserReq::SharedDtor,
+        ::google::protobuf::Message::GetClearImpl<FuzzySearchUserReq>(), &FuzzySearchUserReq::ByteSizeLong,
+            &FuzzySearchUserReq::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+        PROTOBUF_FIELD_OFFSET(FuzzySearchUserReq, _impl_._cached_size_),
+        false,
+    },
+    &FuzzySearchUserReq::kDescriptorMethods,
+    &descriptor_table_user_2eproto,
+    nullptr,  // tracker
+};
+const ::google::protobuf::internal::ClassData* FuzzySearchUserReq::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
+  return _class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<1, 2, 0, 42, 2> FuzzySearchUserReq::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    2, 8,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967292,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    2,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    _class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::user::FuzzySearchUserReq>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    // string pattern = 2;
+    {::_pbi::TcParser::FastUS1,
+     {18, 63, 0, PROTOBUF_FIELD_OFFSET(FuzzySearchUserReq, _impl_.pattern_)}},
+    // string uid = 1;
+    {::_pbi::TcParser::FastUS1,
+     {10, 63, 0, PROTOBUF_FIELD_OFFSET(FuzzySearchUserReq, _impl_.uid_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // string uid = 1;
+    {PROTOBUF_FIELD_OFFSET(FuzzySearchUserReq, _impl_.uid_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // string pattern = 2;
+    {PROTOBUF_FIELD_OFFSET(FuzzySearchUserReq, _impl_.pattern_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+  }},
+  // no aux_entries
+  {{
+    "\27\3\7\0\0\0\0\0"
+    "user.FuzzySearchUserReq"
+    "uid"
+    "pattern"
+  }},
+};
+
+PROTOBUF_NOINLINE void FuzzySearchUserReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:user.FuzzySearchUserReq)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.uid_.ClearToEmpty();
+  _impl_.pattern_.ClearToEmpty();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::uint8_t* FuzzySearchUserReq::_InternalSerialize(
+            const MessageLite& base, ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) {
+          const FuzzySearchUserReq& this_ = static_cast<const FuzzySearchUserReq&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::uint8_t* FuzzySearchUserReq::_InternalSerialize(
+            ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+          const FuzzySearchUserReq& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(serialize_to_array_start:user.FuzzySearchUserReq)
+          ::uint32_t cached_has_bits = 0;
+          (void)cached_has_bits;
+
+          // string uid = 1;
+          if (!this_._internal_uid().empty()) {
+            const std::string& _s = this_._internal_uid();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "user.FuzzySearchUserReq.uid");
+            target = stream->WriteStringMaybeAliased(1, _s, target);
+          }
+
+          // string pattern = 2;
+          if (!this_._internal_pattern().empty()) {
+            const std::string& _s = this_._internal_pattern();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "user.FuzzySearchUserReq.pattern");
+            target = stream->WriteStringMaybeAliased(2, _s, target);
+          }
+
+          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+            target =
+                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+          }
+          // @@protoc_insertion_point(serialize_to_array_end:user.FuzzySearchUserReq)
+          return target;
+        }
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::size_t FuzzySearchUserReq::ByteSizeLong(const MessageLite& base) {
+          const FuzzySearchUserReq& this_ = static_cast<const FuzzySearchUserReq&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::size_t FuzzySearchUserReq::ByteSizeLong() const {
+          const FuzzySearchUserReq& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(message_byte_size_start:user.FuzzySearchUserReq)
+          ::size_t total_size = 0;
+
+          ::uint32_t cached_has_bits = 0;
+          // Prevent compiler warnings about cached_has_bits being unused
+          (void)cached_has_bits;
+
+          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+           {
+            // string uid = 1;
+            if (!this_._internal_uid().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_uid());
+            }
+            // string pattern = 2;
+            if (!this_._internal_pattern().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_pattern());
+            }
+          }
+          return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                                     &this_._impl_._cached_size_);
+        }
+
+void FuzzySearchUserReq::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+  auto* const _this = static_cast<FuzzySearchUserReq*>(&to_msg);
+  auto& from = static_cast<const FuzzySearchUserReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:user.FuzzySearchUserReq)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_uid().empty()) {
+    _this->_internal_set_uid(from._internal_uid());
+  }
+  if (!from._internal_pattern().empty()) {
+    _this->_internal_set_pattern(from._internal_pattern());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void FuzzySearchUserReq::CopyFrom(const FuzzySearchUserReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:user.FuzzySearchUserReq)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void FuzzySearchUserReq::InternalSwap(FuzzySearchUserReq* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.uid_, &other->_impl_.uid_, arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.pattern_, &other->_impl_.pattern_, arena);
+}
+
+::google::protobuf::Metadata FuzzySearchUserReq::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class FuzzySearchUserResp::_Internal {
+ public:
+};
+
+FuzzySearchUserResp::FuzzySearchUserResp(::google::protobuf::Arena* arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:user.FuzzySearchUserResp)
+}
+inline PROTOBUF_NDEBUG_INLINE FuzzySearchUserResp::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from, const ::user::FuzzySearchUserResp& from_msg)
+      : results_{visibility, arena, from.results_},
+        _cached_size_{0} {}
+
+FuzzySearchUserResp::FuzzySearchUserResp(
+    ::google::protobuf::Arena* arena,
+    const FuzzySearchUserResp& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  FuzzySearchUserResp* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+  _impl_.error_ = from._impl_.error_;
+
+  // @@protoc_insertion_point(copy_constructor:user.FuzzySearchUserResp)
+}
+inline PROTOBUF_NDEBUG_INLINE FuzzySearchUserResp::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : results_{visibility, arena},
+        _cached_size_{0} {}
+
+inline void FuzzySearchUserResp::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.error_ = {};
+}
+FuzzySearchUserResp::~FuzzySearchUserResp() {
+  // @@protoc_insertion_point(destructor:user.FuzzySearchUserResp)
+  SharedDtor(*this);
+}
+inline void FuzzySearchUserResp::SharedDtor(MessageLite& self) {
+  FuzzySearchUserResp& this_ = static_cast<FuzzySearchUserResp&>(self);
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.~Impl_();
+}
+
+inline void* FuzzySearchUserResp::PlacementNew_(const void*, void* mem,
+                                        ::google::protobuf::Arena* arena) {
+  return ::new (mem) FuzzySearchUserResp(arena);
+}
+constexpr auto FuzzySearchUserResp::InternalNewImpl_() {
+  constexpr auto arena_bits = ::google::protobuf::internal::EncodePlacementArenaOffsets({
+      PROTOBUF_FIELD_OFFSET(FuzzySearchUserResp, _impl_.results_) +
+          decltype(FuzzySearchUserResp::_impl_.results_)::
+              InternalGetArenaOffset(
+                  ::google::protobuf::Message::internal_visibility()),
+  });
+  if (arena_bits.has_value()) {
+    return ::google::protobuf::internal::MessageCreator::ZeroInit(
+        sizeof(FuzzySearchUserResp), alignof(FuzzySearchUserResp), *arena_bits);
+  } else {
+    return ::google::protobuf::internal::MessageCreator(&FuzzySearchUserResp::PlacementNew_,
+                                 sizeof(FuzzySearchUserResp),
+                                 alignof(FuzzySearchUserResp));
+  }
+}
+PROTOBUF_CONSTINIT
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::google::protobuf::internal::ClassDataFull FuzzySearchUserResp::_class_data_ = {
+    ::google::protobuf::internal::ClassData{
+        &_FuzzySearchUserResp_default_instance_._instance,
+        &_table_.header,
+        nullptr,  // OnDemandRegisterArenaDtor
+        nullptr,  // IsInitialized
+        &FuzzySearchUserResp::MergeImpl,
+        ::google::protobuf::Message::GetNewImpl<FuzzySearchUserResp>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        &FuzzySearchUserResp::SharedDtor,
+        ::google::protobuf::Message::GetClearImpl<FuzzySearchUserResp>(), &FuzzySearchUserResp::ByteSizeLong,
+            &FuzzySearchUserResp::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+        PROTOBUF_FIELD_OFFSET(FuzzySearchUserResp, _impl_._cached_size_),
+        false,
+    },
+    &FuzzySearchUserResp::kDescriptorMethods,
+    &descriptor_table_user_2eproto,
+    nullptr,  // tracker
+};
+const ::google::protobuf::internal::ClassData* FuzzySearchUserResp::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
+  return _class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<1, 2, 1, 0, 2> FuzzySearchUserResp::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    2, 8,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967292,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    2,  // num_field_entries
+    1,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    _class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::user::FuzzySearchUserResp>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    // repeated .user.GetUserProfileResp results = 2;
+    {::_pbi::TcParser::FastMtR1,
+     {18, 63, 0, PROTOBUF_FIELD_OFFSET(FuzzySearchUserResp, _impl_.results_)}},
+    // int32 error = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(FuzzySearchUserResp, _impl_.error_), 63>(),
+     {8, 63, 0, PROTOBUF_FIELD_OFFSET(FuzzySearchUserResp, _impl_.error_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // int32 error = 1;
+    {PROTOBUF_FIELD_OFFSET(FuzzySearchUserResp, _impl_.error_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+    // repeated .user.GetUserProfileResp results = 2;
+    {PROTOBUF_FIELD_OFFSET(FuzzySearchUserResp, _impl_.results_), 0, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+  }}, {{
+    {::_pbi::TcParser::GetTable<::user::GetUserProfileResp>()},
+  }}, {{
+  }},
+};
+
+PROTOBUF_NOINLINE void FuzzySearchUserResp::Clear() {
+// @@protoc_insertion_point(message_clear_start:user.FuzzySearchUserResp)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.results_.Clear();
+  _impl_.error_ = 0;
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::uint8_t* FuzzySearchUserResp::_InternalSerialize(
+            const MessageLite& base, ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) {
+          const FuzzySearchUserResp& this_ = static_cast<const FuzzySearchUserResp&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::uint8_t* FuzzySearchUserResp::_InternalSerialize(
+            ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+          const FuzzySearchUserResp& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(serialize_to_array_start:user.FuzzySearchUserResp)
+          ::uint32_t cached_has_bits = 0;
+          (void)cached_has_bits;
+
+          // int32 error = 1;
+          if (this_._internal_error() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt32ToArrayWithField<1>(
+                    stream, this_._internal_error(), target);
+          }
+
+          // repeated .user.GetUserProfileResp results = 2;
+          for (unsigned i = 0, n = static_cast<unsigned>(
+                                   this_._internal_results_size());
+               i < n; i++) {
+            const auto& repfield = this_._internal_results().Get(i);
+            target =
+                ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+                    2, repfield, repfield.GetCachedSize(),
+                    target, stream);
+          }
+
+          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+            target =
+                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+          }
+          // @@protoc_insertion_point(serialize_to_array_end:user.FuzzySearchUserResp)
+          return target;
+        }
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::size_t FuzzySearchUserResp::ByteSizeLong(const MessageLite& base) {
+          const FuzzySearchUserResp& this_ = static_cast<const FuzzySearchUserResp&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::size_t FuzzySearchUserResp::ByteSizeLong() const {
+          const FuzzySearchUserResp& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(message_byte_size_start:user.FuzzySearchUserResp)
+          ::size_t total_size = 0;
+
+          ::uint32_t cached_has_bits = 0;
+          // Prevent compiler warnings about cached_has_bits being unused
+          (void)cached_has_bits;
+
+          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+           {
+            // repeated .user.GetUserProfileResp results = 2;
+            {
+              total_size += 1UL * this_._internal_results_size();
+              for (const auto& msg : this_._internal_results()) {
+                total_size += ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+              }
+            }
+          }
+           {
+            // int32 error = 1;
+            if (this_._internal_error() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+                  this_._internal_error());
+            }
+          }
+          return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                                     &this_._impl_._cached_size_);
+        }
+
+void FuzzySearchUserResp::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+  auto* const _this = static_cast<FuzzySearchUserResp*>(&to_msg);
+  auto& from = static_cast<const FuzzySearchUserResp&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:user.FuzzySearchUserResp)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_internal_mutable_results()->MergeFrom(
+      from._internal_results());
+  if (from._internal_error() != 0) {
+    _this->_impl_.error_ = from._impl_.error_;
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void FuzzySearchUserResp::CopyFrom(const FuzzySearchUserResp& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:user.FuzzySearchUserResp)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void FuzzySearchUserResp::InternalSwap(FuzzySearchUserResp* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.results_.InternalSwap(&other->_impl_.results_);
+        swap(_impl_.error_, other->_impl_.error_);
+}
+
+::google::protobuf::Metadata FuzzySearchUserResp::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace user
+namespace google {
+namespace protobuf {
+}  // namespace protobuf
+}  // namespace google
+// @@protoc_insertion_point(global_scope)
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::std::false_type
+    _static_init2_ PROTOBUF_UNUSED =
+        (::_pbi::AddDescriptors(&descriptor_table_user_2eproto),
+         ::std::false_type{});
+#include "google/protobuf/port_undef.inc"
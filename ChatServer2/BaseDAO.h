@@ -1,4 +1,6 @@
 #pragma once
+#include <algorithm>
+#include <iterator>
 #include <string>
 #include <vector>
 #include <memory>
@@ -22,5 +24,37 @@ protected:
 	void ReleaseConnection(std::unique_ptr<mysqlx::Session> conn) {
 		MySQLConPool::GetInstance().ReleaseConnection(std::move(conn));
 	}
+
+	/**
+	 * @brief Read a procedure call without a second round trip
+	 *
+	 * Procedures report their status as their last result set (`SELECT success, ...`);
+	 * any result sets before it carry the procedure's data rows.
+	 *
+	 * @param result of conn->sql("CALL ...").execute()
+	 * @param rows receives the data rows, may be null
+	 * @return mysqlx::Row the status row, null if the procedure selected nothing
+	 */
+	static mysqlx::Row ReadCall(mysqlx::SqlResult& result, std::vector<mysqlx::Row>* rows = nullptr) {
+		std::vector<mysqlx::Row> current;
+		do {
+			if (!result.hasData()) {
+				continue;
+			}
+			if (rows != nullptr) {
+				std::move(current.begin(), current.end(), std::back_inserter(*rows));
+			}
+			current.clear();
+			for (auto row = result.fetchOne(); row; row = result.fetchOne()) {
+				current.push_back(std::move(row));
+			}
+		} while (result.nextResult());
+
+		return current.empty() ? mysqlx::Row() : current.front();
+	}
+
+	static bool IsSuccess(const mysqlx::Row& status) {
+		return status && status[0].get<bool>();
+	}
 };
 
@@ -6,10 +6,20 @@
 #include "LogicSystem.h"
 #include "Logger.h"
 
+#include <chrono>
+
+namespace {
+	// starts at the boot time in microseconds, so generations keep growing across restarts
+	std::atomic<long long> nextGeneration{ std::chrono::duration_cast<std::chrono::microseconds>(
+		std::chrono::system_clock::now().time_since_epoch()).count() };
+}
+
 CSession::CSession(boost::asio::io_context& ioc, CServer* server) :
 	_socket(ioc),
+	_generation(++nextGeneration),
 	_server(server),
 	_b_close(false),
+	_b_close_after_send(false),
 	_b_head_parse(true)
 {
 	auto a_uuid = boost::uuids::random_generator()();
@@ -36,6 +46,11 @@ std::string& CSession::GetSessionUid()
 	return _sessionUid;
 }
 
+long long CSession::GetGeneration() const
+{
+	return _generation;
+}
+
 void CSession::SetUserUid(const std::string& uid)
 {
 	_userUid = uid;
@@ -89,6 +104,12 @@ void CSession::Send(std::string message, size_t messageId)
 	Send((char*)message.c_str(), message.length(), messageId);
 }
 
+void CSession::SendAndClose(std::string message, size_t messageId)
+{
+	_b_close_after_send = true;
+	Send(std::move(message), messageId);
+}
+
 std::shared_ptr<CSession> CSession::Shared()
 {
 	return shared_from_this();
@@ -183,6 +204,9 @@ void CSession::handleWrite(const boost::system::error_code& error, std::shared_p
 	{
 		std::lock_guard<std::mutex> lock(_sendMutex);
 		if (_sendQueue.empty()) {
+			if (_b_close_after_send) {
+				Close();
+			}
 			return;
 		}
 
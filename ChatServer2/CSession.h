@@ -18,6 +18,8 @@ public:
 
 	boost::asio::ip::tcp::socket& GetSocket();
 	std::string& GetSessionUid();
+	// unique to this session and larger than that of any session created before it
+	long long GetGeneration() const;
 
 	void SetUserUid(const std::string& uid);
 	std::string GetUserUid() const;
@@ -27,16 +29,20 @@ public:
 	
 	void Send(char* message, size_t maxLength, size_t messageId);
 	void Send(std::string message, size_t messageId);
+	// queue a last message; the session closes once everything queued is written
+	void SendAndClose(std::string message, size_t messageId);
 
 private:
 	char _buffer[BUFFER_SIZE];
 
 	boost::asio::ip::tcp::socket _socket;
 	std::string _sessionUid;
+	long long _generation;
 	std::string _userUid;
 
 	CServer* _server;
 	std::atomic<bool> _b_close;
+	std::atomic<bool> _b_close_after_send;
 
 	std::queue<std::shared_ptr<SendNode>> _sendQueue;
 	std::mutex _sendMutex;
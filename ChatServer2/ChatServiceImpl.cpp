@@ -0,0 +1,51 @@
+#include "ChatServiceImpl.h"
+#include "UserManager.h"
+#include "CSession.h"
+#include "const.h"
+#include "Logger.h"
+
+#include <nlohmann/json.hpp>
+using json = nlohmann::json;
+
+grpc::Status ChatServiceImpl::KickUser(grpc::ServerContext* context, const chat::KickUserReq* request, chat::KickUserResp* response)
+{
+	Kick(request->uid(), request->reason(), request->generation());
+	response->set_error(static_cast<int>(ErrorCodes::SUCCESS));
+	return grpc::Status::OK;
+}
+
+grpc::Status ChatServiceImpl::KickUsers(grpc::ServerContext* context, const chat::KickUsersReq* request, chat::KickUsersResp* response)
+{
+	int kicked = 0;
+	for (const auto& kick : request->kicks()) {
+		if (Kick(kick.uid(), kick.reason(), kick.generation())) {
+			++kicked;
+		}
+	}
+	LOG_INFO("Kicked {} of {} users requested by {}", kicked, request->kicks_size(), context->peer());
+
+	response->set_error(static_cast<int>(ErrorCodes::SUCCESS));
+	response->set_kicked(kicked);
+	return grpc::Status::OK;
+}
+
+bool ChatServiceImpl::Kick(const std::string& uid, int reason, long long generation)
+{
+	auto session = UserManager::GetInstance()->GetSession(uid);
+	if (session == nullptr) {
+		LOG_DEBUG("Kick for uid={} ignored, not logged in here", uid);
+		return false;
+	}
+	if (generation != 0 && session->GetGeneration() != generation) {
+		LOG_INFO("Kick for uid={} ignored, it was meant for generation {}, session {} is generation {}",
+			uid, generation, session->GetSessionUid(), session->GetGeneration());
+		return false;
+	}
+
+	json notify;
+	notify["error"] = reason;
+	notify["uid"] = uid;
+	session->SendAndClose(notify.dump(), static_cast<int>(MessageID::MESSAGE_NOTIFY_KICK_USER));
+	LOG_INFO("Kicked uid={} session={} reason={}", uid, session->GetSessionUid(), reason);
+	return true;
+}
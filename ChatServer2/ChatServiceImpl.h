@@ -0,0 +1,31 @@
+﻿#pragma once
+
+#include <string>
+#include <grpcpp/grpcpp.h>
+#include "chat.grpc.pb.h"
+
+/**
+ * @class ChatServiceImpl
+ * @brief Requests StatusServer makes of this ChatServer about its sessions.
+ *
+ * A kicked user gets MESSAGE_NOTIFY_KICK_USER with the reason as error, and
+ * the session is closed once that is written. Kicking a user who is not
+ * logged in here is not an error: they may have left already. A kick that
+ * names a generation only closes the session of that generation; one that
+ * logged in since is left alone.
+ */
+class ChatServiceImpl final :public chat::ChatService::Service
+{
+public:
+	grpc::Status KickUser(grpc::ServerContext* context, const chat::KickUserReq* request, chat::KickUserResp* response) override;
+	grpc::Status KickUsers(grpc::ServerContext* context, const chat::KickUsersReq* request, chat::KickUsersResp* response) override;
+
+private:
+	/**
+	 * @brief Close uid's session on this server
+	 *
+	 * @param generation the session's, or 0 for whichever session uid has
+	 * @return false if uid has no such session here
+	 */
+	bool Kick(const std::string& uid, int reason, long long generation);
+};
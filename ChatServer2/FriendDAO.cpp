@@ -18,7 +18,7 @@ bool FriendDAO::Update(const FriendRelation& relation)
 
 	try {
 		LOG_INFO("Updating relationship: uid_a={}, uid_b={}", relation._a_uid, relation._b_uid);
-		auto result = conn->sql("CALL sp_update_friend(?, ?, ?, ?, ?, @success)")
+		auto result = conn->sql("CALL sp_update_friend(?, ?, ?, ?, ?)")
 			.bind(relation._a_uid)
 			.bind(relation._b_uid)
 			.bind(relation._status)
@@ -26,9 +26,7 @@ bool FriendDAO::Update(const FriendRelation& relation)
 			.bind(relation._remark.empty() ? relation._b_uid : relation._remark)
 			.execute();
 
-		auto statusResult = conn->sql("SELECT @success").execute();
-		auto row = statusResult.fetchOne();
-		bool success = row[0].get<bool>();
+		bool success = IsSuccess(ReadCall(result));
 
 		if (success) {
 			LOG_INFO("Update relationship success: uid_a={}, uid_b={}", relation._a_uid, relation._b_uid);
@@ -64,7 +62,7 @@ bool FriendDAO::InsertApply(const FriendRelation& relation, const std::string& c
 
 	try {
 		LOG_INFO("Inserting relationship: uid_a={}, uid_b={}", relation._a_uid, relation._b_uid);
-		auto result = conn->sql("CALL sp_insert_friend(?, ?, ?, ?, ?, ?, @success)")
+		auto result = conn->sql("CALL sp_insert_friend(?, ?, ?, ?, ?, ?)")
 			.bind(relation._a_uid)
 			.bind(relation._b_uid)
 			.bind(relation._status)
@@ -73,9 +71,7 @@ bool FriendDAO::InsertApply(const FriendRelation& relation, const std::string& c
 			.bind(relation._remark.empty() ? relation._b_uid : relation._remark)
 			.execute();
 
-		auto statusResult = conn->sql("SELECT @success").execute();
-		auto row = statusResult.fetchOne();
-		bool success = row[0].get<bool>();
+		bool success = IsSuccess(ReadCall(result));
 
 		if (success) {
 			LOG_INFO("Insert relationship success: uid_a={}, uid_b={}", relation._a_uid, relation._b_uid);
@@ -100,14 +96,12 @@ bool FriendDAO::DeleteFriendShip(const std::string& a_uid, const std::string& b_
 
 	try {
 		LOG_INFO("Delete relationship: uid_a={}, uid_b={}", a_uid, b_uid);
-		auto result = conn->sql("CALL sp_delete_friend(?, ?, @success)")
+		auto result = conn->sql("CALL sp_delete_friend(?, ?)")
 			.bind(a_uid)
 			.bind(b_uid)
 			.execute();
 
-		auto statusResult = conn->sql("SELECT @success").execute();
-		auto row = statusResult.fetchOne();
-		bool success = row && row[0].get<bool>();
+		bool success = IsSuccess(ReadCall(result));
 
 		if (success) {
 			LOG_INFO("Delete relationship success: uid_a={}, uid_b={}", a_uid, b_uid);
@@ -133,21 +127,11 @@ std::vector<std::shared_ptr<FriendInfo>> FriendDAO::GetUserFriends(const std::st
 
 	try {
 		LOG_INFO("Finding relationship: uid={}", uid);
-		auto result = conn->sql("CALL sp_search_friend(?, @success)")
+		auto result = conn->sql("CALL sp_search_friend(?)")
 			.bind(uid)
 			.execute();
 		std::vector<mysqlx::Row> rows;
-		do{
-			if (result.hasData()) {
-				auto part = result.fetchAll();
-				rows.insert(rows.end(), part.begin(), part.end());
-			}
-		} while (result.nextResult());
-		
-
-		auto statusResult = conn->sql("SELECT @success").execute();
-		auto statusRow = statusResult.fetchOne();
-		bool found = statusRow && statusRow[0].get<bool>();
+		bool found = IsSuccess(ReadCall(result, &rows));
 
 		if (!found) {
 			LOG_WARN("Get User Friends failed: uid={}", uid);
@@ -190,21 +174,12 @@ std::vector<std::shared_ptr<FriendListInfo>> FriendDAO::GetApplyList(const std::
 
 	try {
 		LOG_INFO("Finding Apply List: uid={}", uid);
-		auto result = conn->sql("CALL sp_apply_list_friend(?, @success)")
+		auto result = conn->sql("CALL sp_apply_list_friend(?)")
 			.bind(uid)
 			.execute();
 
 		std::vector<mysqlx::Row> rows;
-		do {
-			if (result.hasData()) {
-				auto part = result.fetchAll();
-				rows.insert(rows.end(), part.begin(), part.end());
-			}
-		} while (result.nextResult());
-
-		auto statusResult = conn->sql("SELECT @success").execute();
-		auto statusRow = statusResult.fetchOne();
-		bool found = statusRow && statusRow[0].get<bool>();
+		bool found = IsSuccess(ReadCall(result, &rows));
 
 		if (!found) {
 			LOG_WARN("Get Apply List failed: uid={}", uid);
@@ -247,22 +222,13 @@ std::vector<std::shared_ptr<SearchInfo>> FriendDAO::Search(const std::string& ui
 
 	try {
 		LOG_INFO("Finding User by Fuzzy Search: uid={}, pattern={}", uid, pattern);
-		auto result = conn->sql("CALL sp_fuzzy_search_uid_email(?, ?, @success)")
+		auto result = conn->sql("CALL sp_fuzzy_search_uid_email(?, ?)")
 			.bind(uid)
 			.bind(pattern)
 			.execute();
 
 		std::vector<mysqlx::Row> rows;
-		do {
-			if (result.hasData()) {
-				auto part = result.fetchAll();
-				rows.insert(rows.end(), part.begin(), part.end());
-			}
-		} while (result.nextResult());
-
-		auto statusResult = conn->sql("SELECT @success").execute();
-		auto statusRow = statusResult.fetchOne();
-		bool found = statusRow && statusRow[0].get<bool>();
+		bool found = IsSuccess(ReadCall(result, &rows));
 
 		if (!found) {
 			LOG_WARN("Fuzzy Search failed: uid={}, pattern={}", uid, pattern);
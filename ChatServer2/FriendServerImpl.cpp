@@ -67,7 +67,7 @@ grpc::Status FriendServerImpl::HandleFriend(grpc::ServerContext* context, const
 	}
 
 	auto userInfo = std::make_shared<UserInfo>();
-	std::string baseKey = ChatServiceConstant::USER_INFO_PREFIX + request->applicant();
+	std::string baseKey = RedisConPool::UserKey(ChatServiceConstant::USER_INFO_PREFIX, request->applicant());
 
 
 	json notify;
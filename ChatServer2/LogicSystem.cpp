@@ -34,6 +34,12 @@ void LogicSystem::PostMessageToQueue(std::shared_ptr<LogicNode> message)
     }
 }
 
+std::size_t LogicSystem::QueueDepth()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _messageQueue.size();
+}
+
 LogicSystem::LogicSystem():
     _b_stop(false)
 {
@@ -147,8 +153,8 @@ void LogicSystem::LoginHandler(std::shared_ptr<CSession> session, const size_t&
         std::string token = src["token"].get<std::string>();
         LOG_INFO("Login attempt - UID: {}, Token length: {}", uid, token.length());
 
-        std::string sessionOpt = RedisConPool::GetInstance().get(ChatServiceConstant::USER_SESSION_PREFIX + uid).value();
-        auto ttlTime = RedisConPool::GetInstance().ttl(ChatServiceConstant::USER_SESSION_PREFIX + uid);
+        std::string sessionOpt = RedisConPool::GetInstance().get(RedisConPool::UserKey(ChatServiceConstant::USER_SESSION_PREFIX, uid)).value();
+        auto ttlTime = RedisConPool::GetInstance().ttl(RedisConPool::UserKey(ChatServiceConstant::USER_SESSION_PREFIX, uid));
         auto sessionJson = json::parse(sessionOpt);
 
         std::string tokenValue = sessionJson["token"].get<std::string>();
@@ -167,7 +173,7 @@ void LogicSystem::LoginHandler(std::shared_ptr<CSession> session, const size_t&
 
 
 		root["error"] = static_cast<size_t>(ErrorCodes::SUCCESS);
-		std::string baseKey = ChatServiceConstant::USER_INFO_PREFIX + uid;
+		std::string baseKey = RedisConPool::UserKey(ChatServiceConstant::USER_INFO_PREFIX, uid);
         auto userInfo = std::make_shared<UserInfo>();
         
         auto baseInfoExists = GetUserInfo(baseKey, uid, userInfo);
@@ -249,12 +255,12 @@ void LogicSystem::LoginHandler(std::shared_ptr<CSession> session, const size_t&
             sessionJson["times"] = std::to_string(std::stoi(loginTimes) + 1);
 
         }
-        RedisConPool::GetInstance().setex(ChatServiceConstant::USER_SESSION_PREFIX + uid, ttlTime, sessionJson.dump());
+        RedisConPool::GetInstance().setex(RedisConPool::UserKey(ChatServiceConstant::USER_SESSION_PREFIX, uid), ttlTime, sessionJson.dump());
 
 		session->SetUserUid(uid);
 
-        std::string apply_list = ChatServiceConstant::FRIEND_REQUEST_PREFIX + uid + "_apply";
-		std::string contact_list = ChatServiceConstant::FRIEND_REQUEST_PREFIX + uid + "_contact";
+        std::string apply_list = RedisConPool::UserKey(ChatServiceConstant::FRIEND_REQUEST_PREFIX, uid) + "_apply";
+		std::string contact_list = RedisConPool::UserKey(ChatServiceConstant::FRIEND_REQUEST_PREFIX, uid) + "_contact";
 
         RedisConPool::GetInstance().set(apply_list, root["apply_list"].dump(4));
 		RedisConPool::GetInstance().set(contact_list, root["contact_friend_list"].dump(4));
@@ -353,7 +359,7 @@ void LogicSystem::ApplyFriendHandler(std::shared_ptr<CSession> session, const si
             return;
         }
 
-        std::string sessionOpt = RedisConPool::GetInstance().get(ChatServiceConstant::USER_SESSION_PREFIX + to_uid).value();
+        std::string sessionOpt = RedisConPool::GetInstance().get(RedisConPool::UserKey(ChatServiceConstant::USER_SESSION_PREFIX, to_uid)).value();
         auto sessionJson = json::parse(sessionOpt);
 
         auto to_ip_value = sessionJson["server_name"].get<std::string>();
@@ -366,7 +372,7 @@ void LogicSystem::ApplyFriendHandler(std::shared_ptr<CSession> session, const si
         auto& cfg = ConfigManager::GetInstance();
         auto selfServer = cfg["SelfServer"]["name"];
 
-        std::string baseKey = ChatServiceConstant::USER_INFO_PREFIX + from_uid;
+        std::string baseKey = RedisConPool::UserKey(ChatServiceConstant::USER_INFO_PREFIX, from_uid);
         auto userInfo = std::make_shared<UserInfo>();
         bool userFind = GetUserInfo(baseKey, from_uid, userInfo);
 
@@ -439,7 +445,7 @@ void LogicSystem::ApprovalFriendHandler(std::shared_ptr<CSession> session, const
 
 
         root["error"] = static_cast<int>(ErrorCodes::SUCCESS);
-        std::string baseKey = ChatServiceConstant::USER_INFO_PREFIX + to_uid;
+        std::string baseKey = RedisConPool::UserKey(ChatServiceConstant::USER_INFO_PREFIX, to_uid);
         auto userInfo = std::make_shared<UserInfo>();
         
 		auto baseInfoExists = GetUserInfo(baseKey, to_uid, userInfo);
@@ -460,7 +466,7 @@ void LogicSystem::ApprovalFriendHandler(std::shared_ptr<CSession> session, const
 		root["remark"] = remark_other;
 
 
-		auto sessionOpt = RedisConPool::GetInstance().get(ChatServiceConstant::USER_SESSION_PREFIX + to_uid).value();
+		auto sessionOpt = RedisConPool::GetInstance().get(RedisConPool::UserKey(ChatServiceConstant::USER_SESSION_PREFIX, to_uid)).value();
 		auto sessionJson = json::parse(sessionOpt);
 
 		auto to_ip_value = sessionJson["server_name"].get<std::string>();
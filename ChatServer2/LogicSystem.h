@@ -24,6 +24,8 @@ class LogicSystem:public Singleton<LogicSystem>
 public:
 	~LogicSystem();
 	void PostMessageToQueue(std::shared_ptr<LogicNode> message);
+	// messages waiting for the logic thread
+	std::size_t QueueDepth();
 
 private:
 	LogicSystem();
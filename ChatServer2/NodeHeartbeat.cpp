@@ -0,0 +1,138 @@
+#include "NodeHeartbeat.h"
+#include "ConfigManager.h"
+#include "LogicSystem.h"
+#include "UserManager.h"
+#include "Logger.h"
+#include "const.h"
+
+#include <algorithm>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <sys/resource.h>
+#endif
+
+namespace {
+	// user + system CPU time used by this process so far
+	double ProcessCpuSeconds()
+	{
+#ifdef _WIN32
+		FILETIME created, exited, kernel, user;
+		if (!GetProcessTimes(GetCurrentProcess(), &created, &exited, &kernel, &user)) {
+			return 0.0;
+		}
+		auto ticks = [](const FILETIME& time) {
+			return (static_cast<unsigned long long>(time.dwHighDateTime) << 32) | time.dwLowDateTime;
+		};
+		return (ticks(kernel) + ticks(user)) / 1e7; // 100ns units
+#else
+		rusage usage{};
+		if (getrusage(RUSAGE_SELF, &usage) != 0) {
+			return 0.0;
+		}
+		return usage.ru_utime.tv_sec + usage.ru_stime.tv_sec + (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1e6;
+#endif
+	}
+}
+
+NodeHeartbeat::NodeHeartbeat() : _registered(false), _lastCpuSec(ProcessCpuSeconds()), _lastMeasure(std::chrono::steady_clock::now()), _b_stop(true)
+{
+	auto& cfg = ConfigManager::GetInstance();
+	_name = cfg["SelfServer"]["name"];
+	_host = cfg["SelfServer"]["host"];
+	_port = atoi(cfg["SelfServer"]["port"].c_str());
+	_rpcPort = atoi(cfg["SelfServer"]["RPCPort"].c_str());
+
+	auto pollSec = cfg["NodeHeartbeat"]["PollSec"];
+	_pollInterval = std::chrono::seconds(pollSec.empty() ? 5 : std::max(1, atoi(pollSec.c_str())));
+}
+
+NodeHeartbeat::~NodeHeartbeat()
+{
+	Stop();
+}
+
+void NodeHeartbeat::Start()
+{
+	if (!_b_stop.exchange(false)) {
+		return;
+	}
+
+	Register();
+	_thread = std::thread(&NodeHeartbeat::Run, this);
+}
+
+void NodeHeartbeat::Stop()
+{
+	if (_b_stop.exchange(true)) {
+		return;
+	}
+
+	_cond.notify_all();
+	if (_thread.joinable()) {
+		_thread.join();
+	}
+
+	StatusGrpcClient::GetInstance()->DeregisterNode(_name);
+	LOG_INFO("Deregistered {} from StatusServer", _name);
+}
+
+void NodeHeartbeat::Register()
+{
+	auto resp = StatusGrpcClient::GetInstance()->RegisterNode(_name, _host, _port, _rpcPort);
+	_registered = resp.error() == static_cast<int>(ErrorCodes::SUCCESS);
+	if (!_registered) {
+		// Not fatal: the next beat tries again
+		LOG_WARN("Failed to register {} with StatusServer, error: {}", _name, resp.error());
+	}
+	else {
+		LOG_INFO("Registered {} with StatusServer - rpc port: {}", _name, _rpcPort);
+	}
+}
+
+void NodeHeartbeat::Run()
+{
+	while (!_b_stop) {
+		Beat();
+
+		std::unique_lock<std::mutex> lock(_mutex);
+		_cond.wait_for(lock, _pollInterval, [this]() {
+			return _b_stop.load();
+		});
+	}
+}
+
+void NodeHeartbeat::Beat()
+{
+	if (!_registered) {
+		Register();
+	}
+	auto beat = StatusGrpcClient::GetInstance()->Heartbeat(_name, _host, _port, Measure());
+	if (beat.error() == static_cast<int>(ErrorCodes::NODE_NOT_FOUND)) {
+		LOG_WARN("StatusServer does not know {}, registering again", _name);
+		Register();
+	}
+}
+
+NodeMetrics NodeHeartbeat::Measure()
+{
+	auto now = std::chrono::steady_clock::now();
+	auto cpuSec = ProcessCpuSeconds();
+	double wallSec = std::chrono::duration<double>(now - _lastMeasure).count();
+	unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+
+	NodeMetrics metrics;
+	metrics.sessions = static_cast<int>(UserManager::GetInstance()->Count());
+	metrics.queue_depth = static_cast<int>(LogicSystem::GetInstance()->QueueDepth());
+	if (wallSec > 0.0) {
+		metrics.cpu = static_cast<int>(std::min(100.0, (cpuSec - _lastCpuSec) * 100.0 / (wallSec * cores)) + 0.5);
+	}
+
+	_lastCpuSec = cpuSec;
+	_lastMeasure = now;
+	return metrics;
+}
@@ -0,0 +1,58 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "Singleton.h"
+#include "StatusGrpcClient.h"
+
+/**
+ * @class NodeHeartbeat
+ * @brief Keeps this server in StatusServer's node registry.
+ *
+ * Registers this server (including its gRPC port, where ChatService takes
+ * kicks) at startup, then sends a heartbeat every [NodeHeartbeat] PollSec
+ * with its logged-in users, LogicSystem queue depth and process CPU since the
+ * last one. A failed registration is retried on the next beat, and so is one
+ * the StatusServer lost (it restarted or evicted this node), which it reports
+ * by answering the heartbeat with NODE_NOT_FOUND. Peers still come from the
+ * static [PeerServer] list.
+ */
+class NodeHeartbeat : public Singleton<NodeHeartbeat>
+{
+	friend class Singleton<NodeHeartbeat>;
+
+public:
+	~NodeHeartbeat();
+
+	void Start();
+	void Stop();
+
+private:
+	NodeHeartbeat();
+
+	void Run();
+	void Beat();
+	void Register();
+	NodeMetrics Measure();
+
+	std::string _name;
+	std::string _host;
+	int _port;
+	int _rpcPort;
+	// only touched by Start and then the heartbeat thread
+	bool _registered;
+
+	std::chrono::seconds _pollInterval;
+
+	// process CPU time and wall clock at the previous Measure()
+	double _lastCpuSec;
+	std::chrono::steady_clock::time_point _lastMeasure;
+
+	std::mutex _mutex;
+	std::condition_variable _cond;
+	std::atomic<bool> _b_stop;
+	std::thread _thread;
+};
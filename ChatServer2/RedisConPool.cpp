@@ -8,6 +8,11 @@ sw::redis::Redis& RedisConPool::GetInstance()
     return *con._redis;
 }
 
+std::string RedisConPool::UserKey(const std::string& prefix, const std::string& uid)
+{
+    return prefix + "{" + uid + "}";
+}
+
 RedisConPool::~RedisConPool()
 {
     LOG_INFO("Destroying Redis connection pool");
@@ -1,11 +1,17 @@
 #pragma once
 #include <memory>
+#include <string>
 #include <sw/redis++/redis++.h>
 
 class RedisConPool
 {
 public:
 	static sw::redis::Redis& GetInstance();
+
+	/**
+	 * @brief prefix + "{uid}", the per-user key layout shared with ChatServer
+	 */
+	static std::string UserKey(const std::string& prefix, const std::string& uid);
 	~RedisConPool();
 	RedisConPool(const RedisConPool&) = delete;
 	RedisConPool& operator=(const RedisConPool&) = delete;
@@ -2,6 +2,8 @@
 #include "ConfigManager.h"
 #include "Logger.h"
 
+#include <algorithm>
+
 message::GetChatServerResponse StatusGrpcClient::GetChatServer(std::string uid)
 {
     grpc::ClientContext context;
@@ -45,13 +47,83 @@ message::LoginResponse StatusGrpcClient::Login(std::string uid, std::string toke
     return response;
 }
 
+status::RegisterNodeResp StatusGrpcClient::RegisterNode(const std::string& name, const std::string& host, int port, int rpcPort, int capacity)
+{
+    grpc::ClientContext context;
+    context.set_deadline(std::chrono::system_clock::now() + _deadline);
+    status::RegisterNodeResp response;
+    status::RegisterNodeReq request;
+
+    request.set_name(name);
+    request.set_server_host(host);
+    request.set_server_port(port);
+    request.set_rpc_port(rpcPort);
+    request.set_capacity(capacity);
+
+    auto stub = _nodePool->GetConnection();
+    auto status = stub->RegisterNode(&context, request, &response);
+    if (!status.ok()) {
+        LOG_ERROR("gRPC RegisterNode failed: {} ", status.error_message());
+        response.set_error(static_cast<int>(ErrorCodes::RPC_FAILED));
+    }
+    _nodePool->ReturnConnection(std::move(stub));
+    return response;
+}
+
+status::DeregisterNodeResp StatusGrpcClient::DeregisterNode(const std::string& name)
+{
+    grpc::ClientContext context;
+    context.set_deadline(std::chrono::system_clock::now() + _deadline);
+    status::DeregisterNodeResp response;
+    status::DeregisterNodeReq request;
+
+    request.set_name(name);
+
+    auto stub = _nodePool->GetConnection();
+    auto status = stub->DeregisterNode(&context, request, &response);
+    if (!status.ok()) {
+        LOG_ERROR("gRPC DeregisterNode failed: {} ", status.error_message());
+        response.set_error(static_cast<int>(ErrorCodes::RPC_FAILED));
+    }
+    _nodePool->ReturnConnection(std::move(stub));
+    return response;
+}
+
+status::HeartbeatResp StatusGrpcClient::Heartbeat(const std::string& name, const std::string& host, int port, const NodeMetrics& metrics)
+{
+    grpc::ClientContext context;
+    context.set_deadline(std::chrono::system_clock::now() + _deadline);
+    status::HeartbeatResp response;
+    status::HeartbeatReq request;
+
+    request.set_name(name);
+    request.set_server_host(host);
+    request.set_server_port(port);
+    request.set_measured(true);
+    request.set_sessions(metrics.sessions);
+    request.set_queue_depth(metrics.queue_depth);
+    request.set_cpu(metrics.cpu);
+
+    auto stub = _nodePool->GetConnection();
+    auto status = stub->Heartbeat(&context, request, &response);
+    if (!status.ok()) {
+        LOG_WARN("gRPC Heartbeat failed: {} ", status.error_message());
+        response.set_error(static_cast<int>(ErrorCodes::RPC_FAILED));
+    }
+    _nodePool->ReturnConnection(std::move(stub));
+    return response;
+}
+
 StatusGrpcClient::StatusGrpcClient()
 {
     auto& configManager = ConfigManager::GetInstance();
     std::string host = configManager["StatusServer"]["host"];
     std::string port = configManager["StatusServer"]["port"];
+    auto deadlineMs = configManager["StatusServer"]["DeadlineMs"];
+    _deadline = std::chrono::milliseconds(deadlineMs.empty() ? 1000 : std::max(1, atoi(deadlineMs.c_str())));
 
-    LOG_INFO("Initializing with host: {}, port: {}", host, port);
+    LOG_INFO("Initializing with host: {}, port: {}, deadline: {}ms", host, port, _deadline.count());
 
     _pool.reset(new StatusConPool((size_t)(std::thread::hardware_concurrency()), host, port));
+    _nodePool.reset(new NodeConPool(1, host, port));
 }
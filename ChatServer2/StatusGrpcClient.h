@@ -1,20 +1,65 @@
 #pragma once
+#include <chrono>
 #include <grpcpp/grpcpp.h>
 #include "message.grpc.pb.h"
+#include "status.grpc.pb.h"
 #include "Singleton.h"
 #include "GrpcPool.h"
 #include "const.h"
 
+/**
+ * @brief Load measured on this ChatServer, sent with each heartbeat
+ */
+struct NodeMetrics {
+	int sessions = 0;    // logged-in users
+	int queue_depth = 0; // LogicSystem messages waiting
+	int cpu = 0;         // process CPU, percent of all cores
+};
 
 class StatusGrpcClient:public Singleton<StatusGrpcClient>
 {
 	using StatusConPool = GrpcPool<message::StatusService, message::StatusService::Stub>;
+	using NodeConPool = GrpcPool<status::StatusService, status::StatusService::Stub>;
 	friend class Singleton<StatusGrpcClient>;
 public:
 	message::GetChatServerResponse GetChatServer(std::string uid);
 	message::LoginResponse Login(std::string uid,std::string token);
+
+	/**
+	 * @brief Register a new node with the status server
+	 *
+	 * @param name
+	 * @param host
+	 * @param port
+	 * @param rpc_port port of this node's FriendService and ChatService
+	 * @param capacity
+	 * @return status::RegisterNodeResp
+	 */
+	status::RegisterNodeResp RegisterNode(const std::string& name, const std::string& server_host, int server_port, int rpc_port, int capacity = 10000);
+
+	/**
+	 * @brief Remove this node from the status server's registry
+	 *
+	 * @param name
+	 * @return status::DeregisterNodeResp
+	 */
+	status::DeregisterNodeResp DeregisterNode(const std::string& name);
+
+	/**
+	 * @brief Send a heartbeat signal to the status server
+	 *
+	 * @param name
+	 * @param host
+	 * @param port
+	 * @param metrics this node's current load
+	 * @return status::HeartbeatResp
+	 */
+	status::HeartbeatResp Heartbeat(const std::string& name, const std::string& server_host, int server_port, const NodeMetrics& metrics);
 private:
 	StatusGrpcClient();
 	std::unique_ptr<StatusConPool> _pool;
+	// node registry calls, bounded by [StatusServer] DeadlineMs
+	std::unique_ptr<NodeConPool> _nodePool;
+	std::chrono::milliseconds _deadline;
 };
 
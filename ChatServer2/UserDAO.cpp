@@ -12,7 +12,7 @@ bool UserDAO::Insert(const UserInfo& user)
 
     try {
         LOG_INFO("Inserting user: uid={}, email={}", user._uid, user._email);
-        auto result = conn->sql("CALL sp_insert_user(?, ?, ?, ?, ?, ?, ?, ?, @success)")
+        auto result = conn->sql("CALL sp_insert_user(?, ?, ?, ?, ?, ?, ?, ?)")
             .bind(user._uid)
             .bind(user._email)
             .bind(user._username)
@@ -23,9 +23,7 @@ bool UserDAO::Insert(const UserInfo& user)
             .bind(user._avatar.empty() ? ("./avatars/" + user._uid + ".png") : user._avatar)
             .execute();
 
-        auto statusResult = conn->sql("SELECT @success").execute();
-        auto row = statusResult.fetchOne();
-        bool success = row[0].get<bool>();
+        bool success = IsSuccess(ReadCall(result));
 
         
         if (success) {
@@ -50,7 +48,7 @@ bool UserDAO::Update(const UserInfo& user)
 
     try {
         LOG_INFO("Updating user: uid={}, email={}", user._uid, user._email);
-        auto result = conn->sql("CALL sp_update_user(?, ?, ?, ?, ?, ?, ?, @success)")
+        auto result = conn->sql("CALL sp_update_user(?, ?, ?, ?, ?, ?, ?)")
             .bind(user._uid)
             .bind(user._email)
             .bind(user._password)
@@ -60,9 +58,7 @@ bool UserDAO::Update(const UserInfo& user)
             .bind(user._avatar.empty() ? ("./avatars/" + user._uid + ".png") : user._avatar)
             .execute();
 
-        auto statusResult = conn->sql("SELECT @success").execute();
-        auto row = statusResult.fetchOne();
-        bool success = row[0].get<bool>();
+        bool success = IsSuccess(ReadCall(result));
 
         if (success) {
             LOG_INFO("Update user success: uid={}", user._uid);
@@ -86,13 +82,11 @@ bool UserDAO::Delete(const std::string& uid)
 
     try {
         LOG_INFO("Deleting user: uid={}", uid);
-        auto result = conn->sql("CALL sp_delete_user(?, @success)")
+        auto result = conn->sql("CALL sp_delete_user(?)")
             .bind(uid)
             .execute();
 
-        auto statusResult = conn->sql("SELECT @success").execute();
-        auto row = statusResult.fetchOne();
-        bool success = row && row[0].get<bool>();
+        bool success = IsSuccess(ReadCall(result));
 
         if (success) {
             LOG_INFO("Delete user success: uid={}", uid);
@@ -116,22 +110,21 @@ std::unique_ptr<UserInfo> UserDAO::Search(const std::string& uid)
 
     try {
         LOG_INFO("Searching user: uid={}", uid);
-        auto result = conn->sql("CALL sp_search_user(?, ?, @success)")
+        auto result = conn->sql("CALL sp_search_user(?, ?)")
             .bind(uid)
             .bind(ENCRYPTION_KEY)
             .execute();
 
-        auto statusResult = conn->sql("SELECT @success").execute();    
-        auto statusRow = statusResult.fetchOne();
-        bool found = statusRow && statusRow[0].get<bool>();
+        std::vector<mysqlx::Row> rows;
+        bool found = IsSuccess(ReadCall(result, &rows));
 
         if (!found) {
             LOG_WARN("User not found: uid={}", uid);
             return nullptr; // 用户未找到
         }
 
-        auto row = result.fetchOne();
-        if (row) {
+        if (!rows.empty()) {
+            const auto& row = rows.front();
             auto userInfo = std::make_unique<UserInfo>(
                 row[0].get<std::string>(),  // uid
                 row[1].get<std::string>(),  // email
@@ -163,14 +156,13 @@ bool UserDAO::VerifyUser(const std::string& email, const std::string& password,
 
     try {
         LOG_INFO("Verifying user: email={}", email);
-        auto result = conn->sql("CALL sp_verify_user(?,?,?,@out_uid,@success)")
+        auto result = conn->sql("CALL sp_verify_user(?,?,?)")
             .bind(email)
             .bind(password)
             .bind(ENCRYPTION_KEY)
             .execute();
 
-        auto statusResult = conn->sql("SELECT @success, @out_uid").execute();
-        auto row = statusResult.fetchOne();
+        auto row = ReadCall(result);
 
         if (row && row[0].get<bool>()) {
             uid = row[1].get<std::string>();
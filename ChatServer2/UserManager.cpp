@@ -31,6 +31,12 @@ void UserManager::removeUserSession(std::string sessionId)
 	}
 }
 
+std::size_t UserManager::Count()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _uidToSession.size();
+}
+
 UserManager::UserManager()
 {
 
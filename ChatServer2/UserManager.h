@@ -13,6 +13,8 @@ public:
 	std::shared_ptr<CSession> GetSession(std::string uid);
 	void setUserSession(std::string uid, std::shared_ptr<CSession> session);
 	void removeUserSession(std::string sessionId);
+	// logged-in users on this server
+	std::size_t Count();
 
 private:
 	UserManager();
@@ -28,6 +28,7 @@ enum class ErrorCodes
 	RPC_FAILED = 1002,
 	UID_INVALID = 1003,
 	TOKEN_INVALID = 1004,
+	NODE_NOT_FOUND = 1006, // StatusServer has no registration for this server
 };
 
 
@@ -47,6 +48,8 @@ enum class MessageID {
 	MESSAGE_APPROVAL_FRIEND_RESPONSE = 1014,
 
 	MESSAGE_NOTIFY_APPROVAL_FRIEND = 1015,
+
+	MESSAGE_NOTIFY_KICK_USER = 1016,
 };
 
 enum class AddStatusCodes {
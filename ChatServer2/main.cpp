@@ -3,6 +3,8 @@
 #include "IOContextPool.h"
 #include "CServer.h"
 #include "FriendServerImpl.h"
+#include "ChatServiceImpl.h"
+#include "NodeHeartbeat.h"
 #include "RedisConPool.h"
 #include "const.h"
 #include "Logger.h"
@@ -27,9 +29,11 @@ int main() {
 
 
 		FriendServerImpl service;
+		ChatServiceImpl chatService;
 		grpc::ServerBuilder builder;
 		builder.AddListeningPort(addr, grpc::InsecureServerCredentials());
 		builder.RegisterService(&service);
+		builder.RegisterService(&chatService);
 
 		std::unique_ptr<grpc::Server> grpcServer(builder.BuildAndStart());
 		LOG_INFO("gRPC Chat Server listening on {}", addr);
@@ -40,12 +44,15 @@ int main() {
 			grpcServer->Wait();
 		});
 
+		LOG_DEBUG("Registering with StatusServer");
+		NodeHeartbeat::GetInstance()->Start();
 
 		boost::asio::io_context ioc;
 		boost::asio::signal_set signals(ioc, SIGINT, SIGTERM);
 		signals.async_wait([&ioc, pool,&grpcServer](auto, auto) {
 			LOG_INFO("Shutdown signal received, initiating graceful shutdown");
 			ioc.stop();
+			NodeHeartbeat::GetInstance()->Stop();
 			pool->Stop();
 			grpcServer->Shutdown();
 			LOG_INFO("Server shutdown completed");
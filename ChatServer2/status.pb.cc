@@ -0,0 +1,6776 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// NO CHECKED-IN PROTOBUF GENCODE
+// source: status.proto
+// Protobuf C++ Version: 5.29.3
+
+#include "status.pb.h"
+
+#include <algorithm>
+#include <type_traits>
+#include "google/protobuf/io/coded_stream.h"
+#include "google/protobuf/generated_message_tctable_impl.h"
+#include "google/protobuf/extension_set.h"
+#include "google/protobuf/generated_message_util.h"
+#include "google/protobuf/wire_format_lite.h"
+#include "google/protobuf/descriptor.h"
+#include "google/protobuf/generated_message_reflection.h"
+#include "google/protobuf/reflection_ops.h"
+#include "google/protobuf/wire_format.h"
+// @@protoc_insertion_point(includes)
+
+// Must be included last.
+#include "google/protobuf/port_def.inc"
+PROTOBUF_PRAGMA_INIT_SEG
+namespace _pb = ::google::protobuf;
+namespace _pbi = ::google::protobuf::internal;
+namespace _fl = ::google::protobuf::internal::field_layout;
+namespace status {
+
+inline constexpr VerifyTokenResp::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : error_{0},
+        valid_{false},
+        expires_at_{::int64_t{0}},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR VerifyTokenResp::VerifyTokenResp(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct VerifyTokenRespDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR VerifyTokenRespDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~VerifyTokenRespDefaultTypeInternal() {}
+  union {
+    VerifyTokenResp _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 VerifyTokenRespDefaultTypeInternal _VerifyTokenResp_default_instance_;
+
+inline constexpr VerifyTokenReq::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : uid_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        token_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        server_name_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR VerifyTokenReq::VerifyTokenReq(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct VerifyTokenReqDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR VerifyTokenReqDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~VerifyTokenReqDefaultTypeInternal() {}
+  union {
+    VerifyTokenReq _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 VerifyTokenReqDefaultTypeInternal _VerifyTokenReq_default_instance_;
+
+inline constexpr RouteResp::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : server_name_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        server_host_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        token_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        error_{0},
+        online_{false},
+        last_logout_{::int64_t{0}},
+        server_port_{0},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR RouteResp::RouteResp(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct RouteRespDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RouteRespDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RouteRespDefaultTypeInternal() {}
+  union {
+    RouteResp _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RouteRespDefaultTypeInternal _RouteResp_default_instance_;
+
+inline constexpr RouteReq::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : uid_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR RouteReq::RouteReq(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct RouteReqDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RouteReqDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RouteReqDefaultTypeInternal() {}
+  union {
+    RouteReq _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RouteReqDefaultTypeInternal _RouteReq_default_instance_;
+
+inline constexpr RegisterNodeResp::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : error_{0},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR RegisterNodeResp::RegisterNodeResp(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct RegisterNodeRespDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RegisterNodeRespDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RegisterNodeRespDefaultTypeInternal() {}
+  union {
+    RegisterNodeResp _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RegisterNodeRespDefaultTypeInternal _RegisterNodeResp_default_instance_;
+
+inline constexpr RegisterNodeReq::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : name_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        server_host_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        server_port_{0},
+        capacity_{0},
+        rpc_port_{0},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR RegisterNodeReq::RegisterNodeReq(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct RegisterNodeReqDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RegisterNodeReqDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RegisterNodeReqDefaultTypeInternal() {}
+  union {
+    RegisterNodeReq _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RegisterNodeReqDefaultTypeInternal _RegisterNodeReq_default_instance_;
+
+inline constexpr OnlineReportResp::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : error_{0},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR OnlineReportResp::OnlineReportResp(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct OnlineReportRespDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR OnlineReportRespDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~OnlineReportRespDefaultTypeInternal() {}
+  union {
+    OnlineReportResp _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 OnlineReportRespDefaultTypeInternal _OnlineReportResp_default_instance_;
+
+inline constexpr OnlineReportReq::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : uid_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        server_name_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        server_host_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        token_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        generation_{::int64_t{0}},
+        server_port_{0},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR OnlineReportReq::OnlineReportReq(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct OnlineReportReqDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR OnlineReportReqDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~OnlineReportReqDefaultTypeInternal() {}
+  union {
+    OnlineReportReq _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 OnlineReportReqDefaultTypeInternal _OnlineReportReq_default_instance_;
+
+inline constexpr OfflineReportResp::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : error_{0},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR OfflineReportResp::OfflineReportResp(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct OfflineReportRespDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR OfflineReportRespDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~OfflineReportRespDefaultTypeInternal() {}
+  union {
+    OfflineReportResp _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 OfflineReportRespDefaultTypeInternal _OfflineReportResp_default_instance_;
+
+inline constexpr OfflineReportReq::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : uid_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        server_name_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR OfflineReportReq::OfflineReportReq(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct OfflineReportReqDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR OfflineReportReqDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~OfflineReportReqDefaultTypeInternal() {}
+  union {
+    OfflineReportReq _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 OfflineReportReqDefaultTypeInternal _OfflineReportReq_default_instance_;
+
+inline constexpr NodeInfo::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : name_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        server_host_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        server_port_{0},
+        current_load_{0},
+        last_heartbeat_{::int64_t{0}},
+        capacity_{0},
+        rpc_port_{0},
+        measured_{false},
+        sessions_{0},
+        queue_depth_{0},
+        cpu_{0},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR NodeInfo::NodeInfo(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct NodeInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR NodeInfoDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~NodeInfoDefaultTypeInternal() {}
+  union {
+    NodeInfo _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 NodeInfoDefaultTypeInternal _NodeInfo_default_instance_;
+
+inline constexpr KickUserResp::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : error_{0},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR KickUserResp::KickUserResp(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct KickUserRespDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR KickUserRespDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~KickUserRespDefaultTypeInternal() {}
+  union {
+    KickUserResp _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 KickUserRespDefaultTypeInternal _KickUserResp_default_instance_;
+
+inline constexpr KickUserReq::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : uid_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        reason_{0},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR KickUserReq::KickUserReq(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct KickUserReqDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR KickUserReqDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~KickUserReqDefaultTypeInternal() {}
+  union {
+    KickUserReq _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 KickUserReqDefaultTypeInternal _KickUserReq_default_instance_;
+
+inline constexpr HeartbeatResp::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : error_{0},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR HeartbeatResp::HeartbeatResp(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct HeartbeatRespDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR HeartbeatRespDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~HeartbeatRespDefaultTypeInternal() {}
+  union {
+    HeartbeatResp _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 HeartbeatRespDefaultTypeInternal _HeartbeatResp_default_instance_;
+
+inline constexpr HeartbeatReq::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : name_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        server_host_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        server_port_{0},
+        measured_{false},
+        sessions_{0},
+        queue_depth_{0},
+        cpu_{0},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR HeartbeatReq::HeartbeatReq(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct HeartbeatReqDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR HeartbeatReqDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~HeartbeatReqDefaultTypeInternal() {}
+  union {
+    HeartbeatReq _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 HeartbeatReqDefaultTypeInternal _HeartbeatReq_default_instance_;
+              template <typename>
+PROTOBUF_CONSTEXPR GetNodesReq::GetNodesReq(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::internal::ZeroFieldsBase(_class_data_.base()){}
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::internal::ZeroFieldsBase() {
+}
+#endif  // PROTOBUF_CUSTOM_VTABLE
+struct GetNodesReqDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GetNodesReqDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GetNodesReqDefaultTypeInternal() {}
+  union {
+    GetNodesReq _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetNodesReqDefaultTypeInternal _GetNodesReq_default_instance_;
+
+inline constexpr DeregisterNodeResp::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : error_{0},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR DeregisterNodeResp::DeregisterNodeResp(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct DeregisterNodeRespDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DeregisterNodeRespDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DeregisterNodeRespDefaultTypeInternal() {}
+  union {
+    DeregisterNodeResp _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DeregisterNodeRespDefaultTypeInternal _DeregisterNodeResp_default_instance_;
+
+inline constexpr DeregisterNodeReq::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : name_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR DeregisterNodeReq::DeregisterNodeReq(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct DeregisterNodeReqDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DeregisterNodeReqDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DeregisterNodeReqDefaultTypeInternal() {}
+  union {
+    DeregisterNodeReq _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DeregisterNodeReqDefaultTypeInternal _DeregisterNodeReq_default_instance_;
+
+inline constexpr AllocateServerResp::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : server_name_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        server_host_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        token_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        error_{0},
+        assigned_{false},
+        expires_at_{::int64_t{0}},
+        server_port_{0},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR AllocateServerResp::AllocateServerResp(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct AllocateServerRespDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR AllocateServerRespDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~AllocateServerRespDefaultTypeInternal() {}
+  union {
+    AllocateServerResp _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 AllocateServerRespDefaultTypeInternal _AllocateServerResp_default_instance_;
+
+inline constexpr AllocateServerReq::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : uid_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR AllocateServerReq::AllocateServerReq(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct AllocateServerReqDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR AllocateServerReqDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~AllocateServerReqDefaultTypeInternal() {}
+  union {
+    AllocateServerReq _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 AllocateServerReqDefaultTypeInternal _AllocateServerReq_default_instance_;
+
+inline constexpr GetNodesResp::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : nodes_{},
+        error_{0},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR GetNodesResp::GetNodesResp(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct GetNodesRespDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GetNodesRespDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GetNodesRespDefaultTypeInternal() {}
+  union {
+    GetNodesResp _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetNodesRespDefaultTypeInternal _GetNodesResp_default_instance_;
+}  // namespace status
+static constexpr const ::_pb::EnumDescriptor**
+    file_level_enum_descriptors_status_2eproto = nullptr;
+static constexpr const ::_pb::ServiceDescriptor**
+    file_level_service_descriptors_status_2eproto = nullptr;
+const ::uint32_t
+    TableStruct_status_2eproto::offsets[] ABSL_ATTRIBUTE_SECTION_VARIABLE(
+        protodesc_cold) = {
+        ~0u,  // no _has_bits_
+        PROTOBUF_FIELD_OFFSET(::status::RegisterNodeReq, _internal_metadata_),
+        ~0u,  // no _extensions_
+        ~0u,  // no _oneof_case_
+        ~0u,  // no _weak_field_map_
+        ~0u,  // no _inlined_string_donated_
+        ~0u,  // no _split_
+        ~0u,  // no sizeof(Split)
+        PROTOBUF_FIELD_OFFSET(::status::RegisterNodeReq, _impl_.name_),
+        PROTOBUF_FIELD_OFFSET(::status::RegisterNodeReq, _impl_.server_host_),
+        PROTOBUF_FIELD_OFFSET(::status::RegisterNodeReq, _impl_.server_port_),
+        PROTOBUF_FIELD_OFFSET(::status::RegisterNodeReq, _impl_.capacity_),
+        PROTOBUF_FIELD_OFFSET(::status::RegisterNodeReq, _impl_.rpc_port_),
+        ~0u,  // no _has_bits_
+        PROTOBUF_FIELD_OFFSET(::status::RegisterNodeResp, _internal_metadata_),
+        ~0u,  // no _extensions_
+        ~0u,  // no _oneof_case_
+        ~0u,  // no _weak_field_map_
+        ~0u,  // no _inlined_string_donated_
+        ~0u,  // no _split_
+        ~0u,  // no sizeof(Split)
+        PROTOBUF_FIELD_OFFSET(::status::RegisterNodeResp, _impl_.error_),
+        ~0u,  // no _has_bits_
+        PROTOBUF_FIELD_OFFSET(::status::DeregisterNodeReq, _internal_metadata_),
+        ~0u,  // no _extensions_
+        ~0u,  // no _oneof_case_
+        ~0u,  // no _weak_field_map_
+        ~0u,  // no _inlined_string_donated_
+        ~0u,  // no _split_
+        ~0u,  // no sizeof(Split)
+        PROTOBUF_FIELD_OFFSET(::status::DeregisterNodeReq, _impl_.name_),
+        ~0u,  // no _has_bits_
+        PROTOBUF_FIELD_OFFSET(::status::DeregisterNodeResp, _internal_metadata_),
+        ~0u,  // no _extensions_
+        ~0u,  // no _oneof_case_
+        ~0u,  // no _weak_field_map_
+        ~0u,  // no _inlined_string_donated_
+        ~0u,  // no _split_
+        ~0u,  // no sizeof(Split)
+        PROTOBUF_FIELD_OFFSET(::status::DeregisterNodeResp, _impl_.error_),
+        ~0u,  // no _has_bits_
+        PROTOBUF_FIELD_OFFSET(::status::HeartbeatReq, _internal_metadata_),
+        ~0u,  // no _extensions_
+        ~0u,  // no _oneof_case_
+        ~0u,  // no _weak_field_map_
+        ~0u,  // no _inlined_string_donated_
+        ~0u,  // no _split_
+        ~0u,  // no sizeof(Split)
+        PROTOBUF_FIELD_OFFSET(::status::HeartbeatReq, _impl_.name_),
+        PROTOBUF_FIELD_OFFSET(::status::HeartbeatReq, _impl_.server_host_),
+        PROTOBUF_FIELD_OFFSET(::status::HeartbeatReq, _impl_.server_port_),
+        PROTOBUF_FIELD_OFFSET(::status::HeartbeatReq, _impl_.measured_),
+        PROTOBUF_FIELD_OFFSET(::status::HeartbeatReq, _impl_.sessions_),
+        PROTOBUF_FIELD_OFFSET(::status::HeartbeatReq, _impl_.queue_depth_),
+        PROTOBUF_FIELD_OFFSET(::status::HeartbeatReq, _impl_.cpu_),
+        ~0u,  // no _has_bits_
+        PROTOBUF_FIELD_OFFSET(::status::HeartbeatResp, _internal_metadata_),
+        ~0u,  // no _extensions_
+        ~0u,  // no _oneof_case_
+        ~0u,  // no _weak_field_map_
+        ~0u,  // no _inlined_string_donated_
+        ~0u,  // no _split_
+        ~0u,  // no sizeof(Split)
+        PROTOBUF_FIELD_OFFSET(::status::HeartbeatResp, _impl_.error_),
+        ~0u,  // no _has_bits_
+        PROTOBUF_FIELD_OFFSET(::status::AllocateServerReq, _internal_metadata_),
+        ~0u,  // no _extensions_
+        ~0u,  // no _oneof_case_
+        ~0u,  // no _weak_field_map_
+        ~0u,  // no _inlined_string_donated_
+        ~0u,  // no _split_
+        ~0u,  // no sizeof(Split)
+        PROTOBUF_FIELD_OFFSET(::status::AllocateServerReq, _impl_.uid_),
+        ~0u,  // no _has_bits_
+        PROTOBUF_FIELD_OFFSET(::status::AllocateServerResp, _internal_metadata_),
+        ~0u,  // no _extensions_
+        ~0u,  // no _oneof_case_
+        ~0u,  // no _weak_field_map_
+        ~0u,  // no _inlined_string_donated_
+        ~0u,  // no _split_
+        ~0u,  // no sizeof(Split)
+        PROTOBUF_FIELD_OFFSET(::status::AllocateServerResp, _impl_.error_),
+        PROTOBUF_FIELD_OFFSET(::status::AllocateServerResp, _impl_.assigned_),
+        PROTOBUF_FIELD_OFFSET(::status::AllocateServerResp, _impl_.server_name_),
+        PROTOBUF_FIELD_OFFSET(::status::AllocateServerResp, _impl_.server_host_),
+        PROTOBUF_FIELD_OFFSET(::status::AllocateServerResp, _impl_.server_port_),
+        PROTOBUF_FIELD_OFFSET(::status::AllocateServerResp, _impl_.token_),
+        PROTOBUF_FIELD_OFFSET(::status::AllocateServerResp, _impl_.expires_at_),
+        ~0u,  // no _has_bits_
+        PROTOBUF_FIELD_OFFSET(::status::OnlineReportReq, _internal_metadata_),
+        ~0u,  // no _extensions_
+        ~0u,  // no _oneof_case_
+        ~0u,  // no _weak_field_map_
+        ~0u,  // no _inlined_string_donated_
+        ~0u,  // no _split_
+        ~0u,  // no sizeof(Split)
+        PROTOBUF_FIELD_OFFSET(::status::OnlineReportReq, _impl_.uid_),
+        PROTOBUF_FIELD_OFFSET(::status::OnlineReportReq, _impl_.server_name_),
+        PROTOBUF_FIELD_OFFSET(::status::OnlineReportReq, _impl_.server_host_),
+        PROTOBUF_FIELD_OFFSET(::status::OnlineReportReq, _impl_.server_port_),
+        PROTOBUF_FIELD_OFFSET(::status::OnlineReportReq, _impl_.token_),
+        PROTOBUF_FIELD_OFFSET(::status::OnlineReportReq, _impl_.generation_),
+        ~0u,  // no _has_bits_
+        PROTOBUF_FIELD_OFFSET(::status::OnlineReportResp, _internal_metadata_),
+        ~0u,  // no _extensions_
+        ~0u,  // no _oneof_case_
+        ~0u,  // no _weak_field_map_
+        ~0u,  // no _inlined_string_donated_
+        ~0u,  // no _split_
+        ~0u,  // no sizeof(Split)
+        PROTOBUF_FIELD_OFFSET(::status::OnlineReportResp, _impl_.error_),
+        ~0u,  // no _has_bits_
+        PROTOBUF_FIELD_OFFSET(::status::OfflineReportReq, _internal_metadata_),
+        ~0u,  // no _extensions_
+        ~0u,  // no _oneof_case_
+        ~0u,  // no _weak_field_map_
+        ~0u,  // no _inlined_string_donated_
+        ~0u,  // no _split_
+        ~0u,  // no sizeof(Split)
+        PROTOBUF_FIELD_OFFSET(::status::OfflineReportReq, _impl_.uid_),
+        PROTOBUF_FIELD_OFFSET(::status::OfflineReportReq, _impl_.server_name_),
+        ~0u,  // no _has_bits_
+        PROTOBUF_FIELD_OFFSET(::status::OfflineReportResp, _internal_metadata_),
+        ~0u,  // no _extensions_
+        ~0u,  // no _oneof_case_
+        ~0u,  // no _weak_field_map_
+        ~0u,  // no _inlined_string_donated_
+        ~0u,  // no _split_
+        ~0u,  // no sizeof(Split)
+        PROTOBUF_FIELD_OFFSET(::status::OfflineReportResp, _impl_.error_),
+        ~0u,  // no _has_bits_
+        PROTOBUF_FIELD_OFFSET(::status::RouteReq, _internal_metadata_),
+        ~0u,  // no _extensions_
+        ~0u,  // no _oneof_case_
+        ~0u,  // no _weak_field_map_
+        ~0u,  // no _inlined_string_donated_
+        ~0u,  // no _split_
+        ~0u,  // no sizeof(Split)
+        PROTOBUF_FIELD_OFFSET(::status::RouteReq, _impl_.uid_),
+        ~0u,  // no _has_bits_
+        PROTOBUF_FIELD_OFFSET(::status::RouteResp, _internal_metadata_),
+        ~0u,  // no _extensions_
+        ~0u,  // no _oneof_case_
+        ~0u,  // no _weak_field_map_
+        ~0u,  // no _inlined_string_donated_
+        ~0u,  // no _split_
+        ~0u,  // no sizeof(Split)
+        PROTOBUF_FIELD_OFFSET(::status::RouteResp, _impl_.error_),
+        PROTOBUF_FIELD_OFFSET(::status::RouteResp, _impl_.online_),
+        PROTOBUF_FIELD_OFFSET(::status::RouteResp, _impl_.server_name_),
+        PROTOBUF_FIELD_OFFSET(::status::RouteResp, _impl_.server_host_),
+        PROTOBUF_FIELD_OFFSET(::status::RouteResp, _impl_.server_port_),
+        PROTOBUF_FIELD_OFFSET(::status::RouteResp, _impl_.token_),
+        PROTOBUF_FIELD_OFFSET(::status::RouteResp, _impl_.last_logout_),
+        ~0u,  // no _has_bits_
+        PROTOBUF_FIELD_OFFSET(::status::VerifyTokenReq, _internal_metadata_),
+        ~0u,  // no _extensions_
+        ~0u,  // no _oneof_case_
+        ~0u,  // no _weak_field_map_
+        ~0u,  // no _inlined_string_donated_
+        ~0u,  // no _split_
+        ~0u,  // no sizeof(Split)
+        PROTOBUF_FIELD_OFFSET(::status::VerifyTokenReq, _impl_.uid_),
+        PROTOBUF_FIELD_OFFSET(::status::VerifyTokenReq, _impl_.token_),
+        PROTOBUF_FIELD_OFFSET(::status::VerifyTokenReq, _impl_.server_name_),
+        ~0u,  // no _has_bits_
+        PROTOBUF_FIELD_OFFSET(::status::VerifyTokenResp, _internal_metadata_),
+        ~0u,  // no _extensions_
+        ~0u,  // no _oneof_case_
+        ~0u,  // no _weak_field_map_
+        ~0u,  // no _inlined_string_donated_
+        ~0u,  // no _split_
+        ~0u,  // no sizeof(Split)
+        PROTOBUF_FIELD_OFFSET(::status::VerifyTokenResp, _impl_.error_),
+        PROTOBUF_FIELD_OFFSET(::status::VerifyTokenResp, _impl_.valid_),
+        PROTOBUF_FIELD_OFFSET(::status::VerifyTokenResp, _impl_.expires_at_),
+        ~0u,  // no _has_bits_
+        PROTOBUF_FIELD_OFFSET(::status::KickUserReq, _internal_metadata_),
+        ~0u,  // no _extensions_
+        ~0u,  // no _oneof_case_
+        ~0u,  // no _weak_field_map_
+        ~0u,  // no _inlined_string_donated_
+        ~0u,  // no _split_
+        ~0u,  // no sizeof(Split)
+        PROTOBUF_FIELD_OFFSET(::status::KickUserReq, _impl_.uid_),
+        PROTOBUF_FIELD_OFFSET(::status::KickUserReq, _impl_.reason_),
+        ~0u,  // no _has_bits_
+        PROTOBUF_FIELD_OFFSET(::status::KickUserResp, _internal_metadata_),
+        ~0u,  // no _extensions_
+        ~0u,  // no _oneof_case_
+        ~0u,  // no _weak_field_map_
+        ~0u,  // no _inlined_string_donated_
+        ~0u,  // no _split_
+        ~0u,  // no sizeof(Split)
+        PROTOBUF_FIELD_OFFSET(::status::KickUserResp, _impl_.error_),
+        ~0u,  // no _has_bits_
+        PROTOBUF_FIELD_OFFSET(::status::GetNodesReq, _internal_metadata_),
+        ~0u,  // no _extensions_
+        ~0u,  // no _oneof_case_
+        ~0u,  // no _weak_field_map_
+        ~0u,  // no _inlined_string_donated_
+        ~0u,  // no _split_
+        ~0u,  // no sizeof(Split)
+        ~0u,  // no _has_bits_
+        PROTOBUF_FIELD_OFFSET(::status::NodeInfo, _internal_metadata_),
+        ~0u,  // no _extensions_
+        ~0u,  // no _oneof_case_
+        ~0u,  // no _weak_field_map_
+        ~0u,  // no _inlined_string_donated_
+        ~0u,  // no _split_
+        ~0u,  // no sizeof(Split)
+        PROTOBUF_FIELD_OFFSET(::status::NodeInfo, _impl_.name_),
+        PROTOBUF_FIELD_OFFSET(::status::NodeInfo, _impl_.server_host_),
+        PROTOBUF_FIELD_OFFSET(::status::NodeInfo, _impl_.server_port_),
+        PROTOBUF_FIELD_OFFSET(::status::NodeInfo, _impl_.current_load_),
+        PROTOBUF_FIELD_OFFSET(::status::NodeInfo, _impl_.capacity_),
+        PROTOBUF_FIELD_OFFSET(::status::NodeInfo, _impl_.last_heartbeat_),
+        PROTOBUF_FIELD_OFFSET(::status::NodeInfo, _impl_.rpc_port_),
+        PROTOBUF_FIELD_OFFSET(::status::NodeInfo, _impl_.measured_),
+        PROTOBUF_FIELD_OFFSET(::status::NodeInfo, _impl_.sessions_),
+        PROTOBUF_FIELD_OFFSET(::status::NodeInfo, _impl_.queue_depth_),
+        PROTOBUF_FIELD_OFFSET(::status::NodeInfo, _impl_.cpu_),
+        ~0u,  // no _has_bits_
+        PROTOBUF_FIELD_OFFSET(::status::GetNodesResp, _internal_metadata_),
+        ~0u,  // no _extensions_
+        ~0u,  // no _oneof_case_
+        ~0u,  // no _weak_field_map_
+        ~0u,  // no _inlined_string_donated_
+        ~0u,  // no _split_
+        ~0u,  // no sizeof(Split)
+        PROTOBUF_FIELD_OFFSET(::status::GetNodesResp, _impl_.error_),
+        PROTOBUF_FIELD_OFFSET(::status::GetNodesResp, _impl_.nodes_),
+};
+
+static const ::_pbi::MigrationSchema
+    schemas[] ABSL_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
+        {0, -1, -1, sizeof(::status::RegisterNodeReq)},
+        {13, -1, -1, sizeof(::status::RegisterNodeResp)},
+        {22, -1, -1, sizeof(::status::DeregisterNodeReq)},
+        {31, -1, -1, sizeof(::status::DeregisterNodeResp)},
+        {40, -1, -1, sizeof(::status::HeartbeatReq)},
+        {55, -1, -1, sizeof(::status::HeartbeatResp)},
+        {64, -1, -1, sizeof(::status::AllocateServerReq)},
+        {73, -1, -1, sizeof(::status::AllocateServerResp)},
+        {88, -1, -1, sizeof(::status::OnlineReportReq)},
+        {102, -1, -1, sizeof(::status::OnlineReportResp)},
+        {111, -1, -1, sizeof(::status::OfflineReportReq)},
+        {121, -1, -1, sizeof(::status::OfflineReportResp)},
+        {130, -1, -1, sizeof(::status::RouteReq)},
+        {139, -1, -1, sizeof(::status::RouteResp)},
+        {154, -1, -1, sizeof(::status::VerifyTokenReq)},
+        {165, -1, -1, sizeof(::status::VerifyTokenResp)},
+        {176, -1, -1, sizeof(::status::KickUserReq)},
+        {186, -1, -1, sizeof(::status::KickUserResp)},
+        {195, -1, -1, sizeof(::status::GetNodesReq)},
+        {203, -1, -1, sizeof(::status::NodeInfo)},
+        {222, -1, -1, sizeof(::status::GetNodesResp)},
+};
+static const ::_pb::Message* const file_default_instances[] = {
+    &::status::_RegisterNodeReq_default_instance_._instance,
+    &::status::_RegisterNodeResp_default_instance_._instance,
+    &::status::_DeregisterNodeReq_default_instance_._instance,
+    &::status::_DeregisterNodeResp_default_instance_._instance,
+    &::status::_HeartbeatReq_default_instance_._instance,
+    &::status::_HeartbeatResp_default_instance_._instance,
+    &::status::_AllocateServerReq_default_instance_._instance,
+    &::status::_AllocateServerResp_default_instance_._instance,
+    &::status::_OnlineReportReq_default_instance_._instance,
+    &::status::_OnlineReportResp_default_instance_._instance,
+    &::status::_OfflineReportReq_default_instance_._instance,
+    &::status::_OfflineReportResp_default_instance_._instance,
+    &::status::_RouteReq_default_instance_._instance,
+    &::status::_RouteResp_default_instance_._instance,
+    &::status::_VerifyTokenReq_default_instance_._instance,
+    &::status::_VerifyTokenResp_default_instance_._instance,
+    &::status::_KickUserReq_default_instance_._instance,
+    &::status::_KickUserResp_default_instance_._instance,
+    &::status::_GetNodesReq_default_instance_._instance,
+    &::status::_NodeInfo_default_instance_._instance,
+    &::status::_GetNodesResp_default_instance_._instance,
+};
+const char descriptor_table_protodef_status_2eproto[] ABSL_ATTRIBUTE_SECTION_VARIABLE(
+    protodesc_cold) = {
+    "\n\014status.proto\022\006status\032\037google/protobuf/"
+    "timestamp.proto\"m\n\017RegisterNodeReq\022\014\n\004na"
+    "me\030\001 \001(\t\022\023\n\013server_host\030\002 \001(\t\022\023\n\013server_"
+    "port\030\003 \001(\005\022\020\n\010capacity\030\004 \001(\005\022\020\n\010rpc_port"
+    "\030\005 \001(\005\"!\n\020RegisterNodeResp\022\r\n\005error\030\001 \001("
+    "\005\"!\n\021DeregisterNodeReq\022\014\n\004name\030\001 \001(\t\"#\n\022"
+    "DeregisterNodeResp\022\r\n\005error\030\001 \001(\005\"\214\001\n\014He"
+    "artbeatReq\022\014\n\004name\030\001 \001(\t\022\023\n\013server_host\030"
+    "\002 \001(\t\022\023\n\013server_port\030\003 \001(\005\022\020\n\010measured\030\004"
+    " \001(\010\022\020\n\010sessions\030\005 \001(\005\022\023\n\013queue_depth\030\006 "
+    "\001(\005\022\013\n\003cpu\030\007 \001(\005\"\036\n\rHeartbeatResp\022\r\n\005err"
+    "or\030\001 \001(\005\" \n\021AllocateServerReq\022\013\n\003uid\030\001 \001"
+    "(\t\"\227\001\n\022AllocateServerResp\022\r\n\005error\030\001 \001(\005"
+    "\022\020\n\010assigned\030\002 \001(\010\022\023\n\013server_name\030\003 \001(\t\022"
+    "\023\n\013server_host\030\004 \001(\t\022\023\n\013server_port\030\005 \001("
+    "\005\022\r\n\005token\030\006 \001(\t\022\022\n\nexpires_at\030\007 \001(\003\"\200\001\n"
+    "\017OnlineReportReq\022\013\n\003uid\030\001 \001(\t\022\023\n\013server_"
+    "name\030\002 \001(\t\022\023\n\013server_host\030\003 \001(\t\022\023\n\013serve"
+    "r_port\030\004 \001(\005\022\r\n\005token\030\005 \001(\t\022\022\n\ngeneratio"
+    "n\030\006 \001(\003\"!\n\020OnlineReportResp\022\r\n\005error\030\001 \001"
+    "(\005\"4\n\020OfflineReportReq\022\013\n\003uid\030\001 \001(\t\022\023\n\013s"
+    "erver_name\030\002 \001(\t\"\"\n\021OfflineReportResp\022\r\n"
+    "\005error\030\001 \001(\005\"\027\n\010RouteReq\022\013\n\003uid\030\001 \001(\t\"\215\001"
+    "\n\tRouteResp\022\r\n\005error\030\001 \001(\005\022\016\n\006online\030\002 \001"
+    "(\010\022\023\n\013server_name\030\003 \001(\t\022\023\n\013server_host\030\004"
+    " \001(\t\022\023\n\013server_port\030\005 \001(\005\022\r\n\005token\030\006 \001(\t"
+    "\022\023\n\013last_logout\030\007 \001(\003\"A\n\016VerifyTokenReq\022"
+    "\013\n\003uid\030\001 \001(\t\022\r\n\005token\030\002 \001(\t\022\023\n\013server_na"
+    "me\030\003 \001(\t\"C\n\017VerifyTokenResp\022\r\n\005error\030\001 \001"
+    "(\005\022\r\n\005valid\030\002 \001(\010\022\022\n\nexpires_at\030\003 \001(\003\"*\n"
+    "\013KickUserReq\022\013\n\003uid\030\001 \001(\t\022\016\n\006reason\030\002 \001("
+    "\005\"\035\n\014KickUserResp\022\r\n\005error\030\001 \001(\005\"\r\n\013GetN"
+    "odesReq\"\332\001\n\010NodeInfo\022\014\n\004name\030\001 \001(\t\022\023\n\013se"
+    "rver_host\030\002 \001(\t\022\023\n\013server_port\030\003 \001(\005\022\024\n\014"
+    "current_load\030\004 \001(\005\022\020\n\010capacity\030\005 \001(\005\022\026\n\016"
+    "last_heartbeat\030\006 \001(\003\022\020\n\010rpc_port\030\007 \001(\005\022\020"
+    "\n\010measured\030\010 \001(\010\022\020\n\010sessions\030\t \001(\005\022\023\n\013qu"
+    "eue_depth\030\n \001(\005\022\013\n\003cpu\030\013 \001(\005\">\n\014GetNodes"
+    "Resp\022\r\n\005error\030\001 \001(\005\022\037\n\005nodes\030\002 \003(\0132\020.sta"
+    "tus.NodeInfo2\214\005\n\rStatusService\022A\n\014Regist"
+    "erNode\022\027.status.RegisterNodeReq\032\030.status"
+    ".RegisterNodeResp\022G\n\016DeregisterNode\022\031.st"
+    "atus.DeregisterNodeReq\032\032.status.Deregist"
+    "erNodeResp\0228\n\tHeartbeat\022\024.status.Heartbe"
+    "atReq\032\025.status.HeartbeatResp\022G\n\016Allocate"
+    "Server\022\031.status.AllocateServerReq\032\032.stat"
+    "us.AllocateServerResp\022A\n\014ReportOnline\022\027."
+    "status.OnlineReportReq\032\030.status.OnlineRe"
+    "portResp\022D\n\rReportOffline\022\030.status.Offli"
+    "neReportReq\032\031.status.OfflineReportResp\0225"
+    "\n\016QueryUserRoute\022\020.status.RouteReq\032\021.sta"
+    "tus.RouteResp\022>\n\013VerifyToken\022\026.status.Ve"
+    "rifyTokenReq\032\027.status.VerifyTokenResp\0225\n"
+    "\010KickUser\022\023.status.KickUserReq\032\024.status."
+    "KickUserResp\0225\n\010GetNodes\022\023.status.GetNod"
+    "esReq\032\024.status.GetNodesRespb\006proto3"
+};
+static const ::_pbi::DescriptorTable* const descriptor_table_status_2eproto_deps[1] =
+    {
+        &::descriptor_table_google_2fprotobuf_2ftimestamp_2eproto,
+};
+static ::absl::once_flag descriptor_table_status_2eproto_once;
+PROTOBUF_CONSTINIT const ::_pbi::DescriptorTable descriptor_table_status_2eproto = {
+    false,
+    false,
+    2235,
+    descriptor_table_protodef_status_2eproto,
+    "status.proto",
+    &descriptor_table_status_2eproto_once,
+    descriptor_table_status_2eproto_deps,
+    1,
+    21,
+    schemas,
+    file_default_instances,
+    TableStruct_status_2eproto::offsets,
+    file_level_enum_descriptors_status_2eproto,
+    file_level_service_descriptors_status_2eproto,
+};
+namespace status {
+// ===================================================================
+
+class RegisterNodeReq::_Internal {
+ public:
+};
+
+RegisterNodeReq::RegisterNodeReq(::google::protobuf::Arena* arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:status.RegisterNodeReq)
+}
+inline PROTOBUF_NDEBUG_INLINE RegisterNodeReq::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from, const ::status::RegisterNodeReq& from_msg)
+      : name_(arena, from.name_),
+        server_host_(arena, from.server_host_),
+        _cached_size_{0} {}
+
+RegisterNodeReq::RegisterNodeReq(
+    ::google::protobuf::Arena* arena,
+    const RegisterNodeReq& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  RegisterNodeReq* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+  ::memcpy(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, server_port_),
+           reinterpret_cast<const char *>(&from._impl_) +
+               offsetof(Impl_, server_port_),
+           offsetof(Impl_, rpc_port_) -
+               offsetof(Impl_, server_port_) +
+               sizeof(Impl_::rpc_port_));
+
+  // @@protoc_insertion_point(copy_constructor:status.RegisterNodeReq)
+}
+inline PROTOBUF_NDEBUG_INLINE RegisterNodeReq::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : name_(arena),
+        server_host_(arena),
+        _cached_size_{0} {}
+
+inline void RegisterNodeReq::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, server_port_),
+           0,
+           offsetof(Impl_, rpc_port_) -
+               offsetof(Impl_, server_port_) +
+               sizeof(Impl_::rpc_port_));
+}
+RegisterNodeReq::~RegisterNodeReq() {
+  // @@protoc_insertion_point(destructor:status.RegisterNodeReq)
+  SharedDtor(*this);
+}
+inline void RegisterNodeReq::SharedDtor(MessageLite& self) {
+  RegisterNodeReq& this_ = static_cast<RegisterNodeReq&>(self);
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.name_.Destroy();
+  this_._impl_.server_host_.Destroy();
+  this_._impl_.~Impl_();
+}
+
+inline void* RegisterNodeReq::PlacementNew_(const void*, void* mem,
+                                        ::google::protobuf::Arena* arena) {
+  return ::new (mem) RegisterNodeReq(arena);
+}
+constexpr auto RegisterNodeReq::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(RegisterNodeReq),
+                                            alignof(RegisterNodeReq));
+}
+PROTOBUF_CONSTINIT
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::google::protobuf::internal::ClassDataFull RegisterNodeReq::_class_data_ = {
+    ::google::protobuf::internal::ClassData{
+        &_RegisterNodeReq_default_instance_._instance,
+        &_table_.header,
+        nullptr,  // OnDemandRegisterArenaDtor
+        nullptr,  // IsInitialized
+        &RegisterNodeReq::MergeImpl,
+        ::google::protobuf::Message::GetNewImpl<RegisterNodeReq>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        &RegisterNodeReq::SharedDtor,
+        ::google::protobuf::Message::GetClearImpl<RegisterNodeReq>(), &RegisterNodeReq::ByteSizeLong,
+            &RegisterNodeReq::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+        PROTOBUF_FIELD_OFFSET(RegisterNodeReq, _impl_._cached_size_),
+        false,
+    },
+    &RegisterNodeReq::kDescriptorMethods,
+    &descriptor_table_status_2eproto,
+    nullptr,  // tracker
+};
+const ::google::protobuf::internal::ClassData* RegisterNodeReq::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
+  return _class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<3, 5, 0, 46, 2> RegisterNodeReq::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    5, 56,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967264,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    5,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    _class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::status::RegisterNodeReq>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+    // string name = 1;
+    {::_pbi::TcParser::FastUS1,
+     {10, 63, 0, PROTOBUF_FIELD_OFFSET(RegisterNodeReq, _impl_.name_)}},
+    // string server_host = 2;
+    {::_pbi::TcParser::FastUS1,
+     {18, 63, 0, PROTOBUF_FIELD_OFFSET(RegisterNodeReq, _impl_.server_host_)}},
+    // int32 server_port = 3;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(RegisterNodeReq, _impl_.server_port_), 63>(),
+     {24, 63, 0, PROTOBUF_FIELD_OFFSET(RegisterNodeReq, _impl_.server_port_)}},
+    // int32 capacity = 4;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(RegisterNodeReq, _impl_.capacity_), 63>(),
+     {32, 63, 0, PROTOBUF_FIELD_OFFSET(RegisterNodeReq, _impl_.capacity_)}},
+    // int32 rpc_port = 5;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(RegisterNodeReq, _impl_.rpc_port_), 63>(),
+     {40, 63, 0, PROTOBUF_FIELD_OFFSET(RegisterNodeReq, _impl_.rpc_port_)}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // string name = 1;
+    {PROTOBUF_FIELD_OFFSET(RegisterNodeReq, _impl_.name_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // string server_host = 2;
+    {PROTOBUF_FIELD_OFFSET(RegisterNodeReq, _impl_.server_host_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // int32 server_port = 3;
+    {PROTOBUF_FIELD_OFFSET(RegisterNodeReq, _impl_.server_port_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+    // int32 capacity = 4;
+    {PROTOBUF_FIELD_OFFSET(RegisterNodeReq, _impl_.capacity_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+    // int32 rpc_port = 5;
+    {PROTOBUF_FIELD_OFFSET(RegisterNodeReq, _impl_.rpc_port_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+  }},
+  // no aux_entries
+  {{
+    "\26\4\13\0\0\0\0\0"
+    "status.RegisterNodeReq"
+    "name"
+    "server_host"
+  }},
+};
+
+PROTOBUF_NOINLINE void RegisterNodeReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:status.RegisterNodeReq)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.name_.ClearToEmpty();
+  _impl_.server_host_.ClearToEmpty();
+  ::memset(&_impl_.server_port_, 0, static_cast<::size_t>(
+      reinterpret_cast<char*>(&_impl_.rpc_port_) -
+      reinterpret_cast<char*>(&_impl_.server_port_)) + sizeof(_impl_.rpc_port_));
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::uint8_t* RegisterNodeReq::_InternalSerialize(
+            const MessageLite& base, ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) {
+          const RegisterNodeReq& this_ = static_cast<const RegisterNodeReq&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::uint8_t* RegisterNodeReq::_InternalSerialize(
+            ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+          const RegisterNodeReq& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(serialize_to_array_start:status.RegisterNodeReq)
+          ::uint32_t cached_has_bits = 0;
+          (void)cached_has_bits;
+
+          // string name = 1;
+          if (!this_._internal_name().empty()) {
+            const std::string& _s = this_._internal_name();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "status.RegisterNodeReq.name");
+            target = stream->WriteStringMaybeAliased(1, _s, target);
+          }
+
+          // string server_host = 2;
+          if (!this_._internal_server_host().empty()) {
+            const std::string& _s = this_._internal_server_host();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "status.RegisterNodeReq.server_host");
+            target = stream->WriteStringMaybeAliased(2, _s, target);
+          }
+
+          // int32 server_port = 3;
+          if (this_._internal_server_port() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt32ToArrayWithField<3>(
+                    stream, this_._internal_server_port(), target);
+          }
+
+          // int32 capacity = 4;
+          if (this_._internal_capacity() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt32ToArrayWithField<4>(
+                    stream, this_._internal_capacity(), target);
+          }
+
+          // int32 rpc_port = 5;
+          if (this_._internal_rpc_port() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt32ToArrayWithField<5>(
+                    stream, this_._internal_rpc_port(), target);
+          }
+
+          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+            target =
+                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+          }
+          // @@protoc_insertion_point(serialize_to_array_end:status.RegisterNodeReq)
+          return target;
+        }
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::size_t RegisterNodeReq::ByteSizeLong(const MessageLite& base) {
+          const RegisterNodeReq& this_ = static_cast<const RegisterNodeReq&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::size_t RegisterNodeReq::ByteSizeLong() const {
+          const RegisterNodeReq& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(message_byte_size_start:status.RegisterNodeReq)
+          ::size_t total_size = 0;
+
+          ::uint32_t cached_has_bits = 0;
+          // Prevent compiler warnings about cached_has_bits being unused
+          (void)cached_has_bits;
+
+          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+           {
+            // string name = 1;
+            if (!this_._internal_name().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_name());
+            }
+            // string server_host = 2;
+            if (!this_._internal_server_host().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_server_host());
+            }
+            // int32 server_port = 3;
+            if (this_._internal_server_port() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+                  this_._internal_server_port());
+            }
+            // int32 capacity = 4;
+            if (this_._internal_capacity() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+                  this_._internal_capacity());
+            }
+            // int32 rpc_port = 5;
+            if (this_._internal_rpc_port() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+                  this_._internal_rpc_port());
+            }
+          }
+          return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                                     &this_._impl_._cached_size_);
+        }
+
+void RegisterNodeReq::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+  auto* const _this = static_cast<RegisterNodeReq*>(&to_msg);
+  auto& from = static_cast<const RegisterNodeReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:status.RegisterNodeReq)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  if (!from._internal_server_host().empty()) {
+    _this->_internal_set_server_host(from._internal_server_host());
+  }
+  if (from._internal_server_port() != 0) {
+    _this->_impl_.server_port_ = from._impl_.server_port_;
+  }
+  if (from._internal_capacity() != 0) {
+    _this->_impl_.capacity_ = from._impl_.capacity_;
+  }
+  if (from._internal_rpc_port() != 0) {
+    _this->_impl_.rpc_port_ = from._impl_.rpc_port_;
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RegisterNodeReq::CopyFrom(const RegisterNodeReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:status.RegisterNodeReq)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void RegisterNodeReq::InternalSwap(RegisterNodeReq* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.name_, &other->_impl_.name_, arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.server_host_, &other->_impl_.server_host_, arena);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RegisterNodeReq, _impl_.rpc_port_)
+      + sizeof(RegisterNodeReq::_impl_.rpc_port_)
+      - PROTOBUF_FIELD_OFFSET(RegisterNodeReq, _impl_.server_port_)>(
+          reinterpret_cast<char*>(&_impl_.server_port_),
+          reinterpret_cast<char*>(&other->_impl_.server_port_));
+}
+
+::google::protobuf::Metadata RegisterNodeReq::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class RegisterNodeResp::_Internal {
+ public:
+};
+
+RegisterNodeResp::RegisterNodeResp(::google::protobuf::Arena* arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:status.RegisterNodeResp)
+}
+RegisterNodeResp::RegisterNodeResp(
+    ::google::protobuf::Arena* arena, const RegisterNodeResp& from)
+    : RegisterNodeResp(arena) {
+  MergeFrom(from);
+}
+inline PROTOBUF_NDEBUG_INLINE RegisterNodeResp::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0} {}
+
+inline void RegisterNodeResp::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.error_ = {};
+}
+RegisterNodeResp::~RegisterNodeResp() {
+  // @@protoc_insertion_point(destructor:status.RegisterNodeResp)
+  SharedDtor(*this);
+}
+inline void RegisterNodeResp::SharedDtor(MessageLite& self) {
+  RegisterNodeResp& this_ = static_cast<RegisterNodeResp&>(self);
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.~Impl_();
+}
+
+inline void* RegisterNodeResp::PlacementNew_(const void*, void* mem,
+                                        ::google::protobuf::Arena* arena) {
+  return ::new (mem) RegisterNodeResp(arena);
+}
+constexpr auto RegisterNodeResp::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(RegisterNodeResp),
+                                            alignof(RegisterNodeResp));
+}
+PROTOBUF_CONSTINIT
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::google::protobuf::internal::ClassDataFull RegisterNodeResp::_class_data_ = {
+    ::google::protobuf::internal::ClassData{
+        &_RegisterNodeResp_default_instance_._instance,
+        &_table_.header,
+        nullptr,  // OnDemandRegisterArenaDtor
+        nullptr,  // IsInitialized
+        &RegisterNodeResp::MergeImpl,
+        ::google::protobuf::Message::GetNewImpl<RegisterNodeResp>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        &RegisterNodeResp::SharedDtor,
+        ::google::protobuf::Message::GetClearImpl<RegisterNodeResp>(), &RegisterNodeResp::ByteSizeLong,
+            &RegisterNodeResp::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+        PROTOBUF_FIELD_OFFSET(RegisterNodeResp, _impl_._cached_size_),
+        false,
+    },
+    &RegisterNodeResp::kDescriptorMethods,
+    &descriptor_table_status_2eproto,
+    nullptr,  // tracker
+};
+const ::google::protobuf::internal::ClassData* RegisterNodeResp::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
+  return _class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 0, 0, 2> RegisterNodeResp::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    1, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967294,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    _class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::status::RegisterNodeResp>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    // int32 error = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(RegisterNodeResp, _impl_.error_), 63>(),
+     {8, 63, 0, PROTOBUF_FIELD_OFFSET(RegisterNodeResp, _impl_.error_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // int32 error = 1;
+    {PROTOBUF_FIELD_OFFSET(RegisterNodeResp, _impl_.error_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+  }},
+  // no aux_entries
+  {{
+  }},
+};
+
+PROTOBUF_NOINLINE void RegisterNodeResp::Clear() {
+// @@protoc_insertion_point(message_clear_start:status.RegisterNodeResp)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.error_ = 0;
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::uint8_t* RegisterNodeResp::_InternalSerialize(
+            const MessageLite& base, ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) {
+          const RegisterNodeResp& this_ = static_cast<const RegisterNodeResp&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::uint8_t* RegisterNodeResp::_InternalSerialize(
+            ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+          const RegisterNodeResp& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(serialize_to_array_start:status.RegisterNodeResp)
+          ::uint32_t cached_has_bits = 0;
+          (void)cached_has_bits;
+
+          // int32 error = 1;
+          if (this_._internal_error() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt32ToArrayWithField<1>(
+                    stream, this_._internal_error(), target);
+          }
+
+          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+            target =
+                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+          }
+          // @@protoc_insertion_point(serialize_to_array_end:status.RegisterNodeResp)
+          return target;
+        }
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::size_t RegisterNodeResp::ByteSizeLong(const MessageLite& base) {
+          const RegisterNodeResp& this_ = static_cast<const RegisterNodeResp&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::size_t RegisterNodeResp::ByteSizeLong() const {
+          const RegisterNodeResp& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(message_byte_size_start:status.RegisterNodeResp)
+          ::size_t total_size = 0;
+
+          ::uint32_t cached_has_bits = 0;
+          // Prevent compiler warnings about cached_has_bits being unused
+          (void)cached_has_bits;
+
+           {
+            // int32 error = 1;
+            if (this_._internal_error() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+                  this_._internal_error());
+            }
+          }
+          return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                                     &this_._impl_._cached_size_);
+        }
+
+void RegisterNodeResp::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+  auto* const _this = static_cast<RegisterNodeResp*>(&to_msg);
+  auto& from = static_cast<const RegisterNodeResp&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:status.RegisterNodeResp)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_error() != 0) {
+    _this->_impl_.error_ = from._impl_.error_;
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RegisterNodeResp::CopyFrom(const RegisterNodeResp& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:status.RegisterNodeResp)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void RegisterNodeResp::InternalSwap(RegisterNodeResp* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+        swap(_impl_.error_, other->_impl_.error_);
+}
+
+::google::protobuf::Metadata RegisterNodeResp::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class DeregisterNodeReq::_Internal {
+ public:
+};
+
+DeregisterNodeReq::DeregisterNodeReq(::google::protobuf::Arena* arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:status.DeregisterNodeReq)
+}
+inline PROTOBUF_NDEBUG_INLINE DeregisterNodeReq::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from, const ::status::DeregisterNodeReq& from_msg)
+      : name_(arena, from.name_),
+        _cached_size_{0} {}
+
+DeregisterNodeReq::DeregisterNodeReq(
+    ::google::protobuf::Arena* arena,
+    const DeregisterNodeReq& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  DeregisterNodeReq* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+
+  // @@protoc_insertion_point(copy_constructor:status.DeregisterNodeReq)
+}
+inline PROTOBUF_NDEBUG_INLINE DeregisterNodeReq::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : name_(arena),
+        _cached_size_{0} {}
+
+inline void DeregisterNodeReq::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+DeregisterNodeReq::~DeregisterNodeReq() {
+  // @@protoc_insertion_point(destructor:status.DeregisterNodeReq)
+  SharedDtor(*this);
+}
+inline void DeregisterNodeReq::SharedDtor(MessageLite& self) {
+  DeregisterNodeReq& this_ = static_cast<DeregisterNodeReq&>(self);
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.name_.Destroy();
+  this_._impl_.~Impl_();
+}
+
+inline void* DeregisterNodeReq::PlacementNew_(const void*, void* mem,
+                                        ::google::protobuf::Arena* arena) {
+  return ::new (mem) DeregisterNodeReq(arena);
+}
+constexpr auto DeregisterNodeReq::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(DeregisterNodeReq),
+                                            alignof(DeregisterNodeReq));
+}
+PROTOBUF_CONSTINIT
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::google::protobuf::internal::ClassDataFull DeregisterNodeReq::_class_data_ = {
+    ::google::protobuf::internal::ClassData{
+        &_DeregisterNodeReq_default_instance_._instance,
+        &_table_.header,
+        nullptr,  // OnDemandRegisterArenaDtor
+        nullptr,  // IsInitialized
+        &DeregisterNodeReq::MergeImpl,
+        ::google::protobuf::Message::GetNewImpl<DeregisterNodeReq>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        &DeregisterNodeReq::SharedDtor,
+        ::google::protobuf::Message::GetClearImpl<DeregisterNodeReq>(), &DeregisterNodeReq::ByteSizeLong,
+            &DeregisterNodeReq::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+        PROTOBUF_FIELD_OFFSET(DeregisterNodeReq, _impl_._cached_size_),
+        false,
+    },
+    &DeregisterNodeReq::kDescriptorMethods,
+    &descriptor_table_status_2eproto,
+    nullptr,  // tracker
+};
+const ::google::protobuf::internal::ClassData* DeregisterNodeReq::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
+  return _class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 0, 37, 2> DeregisterNodeReq::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    1, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967294,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    _class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::status::DeregisterNodeReq>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    // string name = 1;
+    {::_pbi::TcParser::FastUS1,
+     {10, 63, 0, PROTOBUF_FIELD_OFFSET(DeregisterNodeReq, _impl_.name_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // string name = 1;
+    {PROTOBUF_FIELD_OFFSET(DeregisterNodeReq, _impl_.name_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+  }},
+  // no aux_entries
+  {{
+    "\30\4\0\0\0\0\0\0"
+    "status.DeregisterNodeReq"
+    "name"
+  }},
+};
+
+PROTOBUF_NOINLINE void DeregisterNodeReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:status.DeregisterNodeReq)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.name_.ClearToEmpty();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::uint8_t* DeregisterNodeReq::_InternalSerialize(
+            const MessageLite& base, ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) {
+          const DeregisterNodeReq& this_ = static_cast<const DeregisterNodeReq&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::uint8_t* DeregisterNodeReq::_InternalSerialize(
+            ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+          const DeregisterNodeReq& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(serialize_to_array_start:status.DeregisterNodeReq)
+          ::uint32_t cached_has_bits = 0;
+          (void)cached_has_bits;
+
+          // string name = 1;
+          if (!this_._internal_name().empty()) {
+            const std::string& _s = this_._internal_name();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "status.DeregisterNodeReq.name");
+            target = stream->WriteStringMaybeAliased(1, _s, target);
+          }
+
+          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+            target =
+                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+          }
+          // @@protoc_insertion_point(serialize_to_array_end:status.DeregisterNodeReq)
+          return target;
+        }
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::size_t DeregisterNodeReq::ByteSizeLong(const MessageLite& base) {
+          const DeregisterNodeReq& this_ = static_cast<const DeregisterNodeReq&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::size_t DeregisterNodeReq::ByteSizeLong() const {
+          const DeregisterNodeReq& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(message_byte_size_start:status.DeregisterNodeReq)
+          ::size_t total_size = 0;
+
+          ::uint32_t cached_has_bits = 0;
+          // Prevent compiler warnings about cached_has_bits being unused
+          (void)cached_has_bits;
+
+           {
+            // string name = 1;
+            if (!this_._internal_name().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_name());
+            }
+          }
+          return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                                     &this_._impl_._cached_size_);
+        }
+
+void DeregisterNodeReq::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+  auto* const _this = static_cast<DeregisterNodeReq*>(&to_msg);
+  auto& from = static_cast<const DeregisterNodeReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:status.DeregisterNodeReq)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void DeregisterNodeReq::CopyFrom(const DeregisterNodeReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:status.DeregisterNodeReq)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void DeregisterNodeReq::InternalSwap(DeregisterNodeReq* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.name_, &other->_impl_.name_, arena);
+}
+
+::google::protobuf::Metadata DeregisterNodeReq::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class DeregisterNodeResp::_Internal {
+ public:
+};
+
+DeregisterNodeResp::DeregisterNodeResp(::google::protobuf::Arena* arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:status.DeregisterNodeResp)
+}
+DeregisterNodeResp::DeregisterNodeResp(
+    ::google::protobuf::Arena* arena, const DeregisterNodeResp& from)
+    : DeregisterNodeResp(arena) {
+  MergeFrom(from);
+}
+inline PROTOBUF_NDEBUG_INLINE DeregisterNodeResp::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0} {}
+
+inline void DeregisterNodeResp::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.error_ = {};
+}
+DeregisterNodeResp::~DeregisterNodeResp() {
+  // @@protoc_insertion_point(destructor:status.DeregisterNodeResp)
+  SharedDtor(*this);
+}
+inline void DeregisterNodeResp::SharedDtor(MessageLite& self) {
+  DeregisterNodeResp& this_ = static_cast<DeregisterNodeResp&>(self);
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.~Impl_();
+}
+
+inline void* DeregisterNodeResp::PlacementNew_(const void*, void* mem,
+                                        ::google::protobuf::Arena* arena) {
+  return ::new (mem) DeregisterNodeResp(arena);
+}
+constexpr auto DeregisterNodeResp::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(DeregisterNodeResp),
+                                            alignof(DeregisterNodeResp));
+}
+PROTOBUF_CONSTINIT
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::google::protobuf::internal::ClassDataFull DeregisterNodeResp::_class_data_ = {
+    ::google::protobuf::internal::ClassData{
+        &_DeregisterNodeResp_default_instance_._instance,
+        &_table_.header,
+        nullptr,  // OnDemandRegisterArenaDtor
+        nullptr,  // IsInitialized
+        &DeregisterNodeResp::MergeImpl,
+        ::google::protobuf::Message::GetNewImpl<DeregisterNodeResp>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        &DeregisterNodeResp::SharedDtor,
+        ::google::protobuf::Message::GetClearImpl<DeregisterNodeResp>(), &DeregisterNodeResp::ByteSizeLong,
+            &DeregisterNodeResp::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+        PROTOBUF_FIELD_OFFSET(DeregisterNodeResp, _impl_._cached_size_),
+        false,
+    },
+    &DeregisterNodeResp::kDescriptorMethods,
+    &descriptor_table_status_2eproto,
+    nullptr,  // tracker
+};
+const ::google::protobuf::internal::ClassData* DeregisterNodeResp::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
+  return _class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 0, 0, 2> DeregisterNodeResp::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    1, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967294,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    _class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::status::DeregisterNodeResp>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    // int32 error = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(DeregisterNodeResp, _impl_.error_), 63>(),
+     {8, 63, 0, PROTOBUF_FIELD_OFFSET(DeregisterNodeResp, _impl_.error_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // int32 error = 1;
+    {PROTOBUF_FIELD_OFFSET(DeregisterNodeResp, _impl_.error_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+  }},
+  // no aux_entries
+  {{
+  }},
+};
+
+PROTOBUF_NOINLINE void DeregisterNodeResp::Clear() {
+// @@protoc_insertion_point(message_clear_start:status.DeregisterNodeResp)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.error_ = 0;
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::uint8_t* DeregisterNodeResp::_InternalSerialize(
+            const MessageLite& base, ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) {
+          const DeregisterNodeResp& this_ = static_cast<const DeregisterNodeResp&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::uint8_t* DeregisterNodeResp::_InternalSerialize(
+            ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+          const DeregisterNodeResp& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(serialize_to_array_start:status.DeregisterNodeResp)
+          ::uint32_t cached_has_bits = 0;
+          (void)cached_has_bits;
+
+          // int32 error = 1;
+          if (this_._internal_error() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt32ToArrayWithField<1>(
+                    stream, this_._internal_error(), target);
+          }
+
+          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+            target =
+                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+          }
+          // @@protoc_insertion_point(serialize_to_array_end:status.DeregisterNodeResp)
+          return target;
+        }
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::size_t DeregisterNodeResp::ByteSizeLong(const MessageLite& base) {
+          const DeregisterNodeResp& this_ = static_cast<const DeregisterNodeResp&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::size_t DeregisterNodeResp::ByteSizeLong() const {
+          const DeregisterNodeResp& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(message_byte_size_start:status.DeregisterNodeResp)
+          ::size_t total_size = 0;
+
+          ::uint32_t cached_has_bits = 0;
+          // Prevent compiler warnings about cached_has_bits being unused
+          (void)cached_has_bits;
+
+           {
+            // int32 error = 1;
+            if (this_._internal_error() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+                  this_._internal_error());
+            }
+          }
+          return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                                     &this_._impl_._cached_size_);
+        }
+
+void DeregisterNodeResp::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+  auto* const _this = static_cast<DeregisterNodeResp*>(&to_msg);
+  auto& from = static_cast<const DeregisterNodeResp&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:status.DeregisterNodeResp)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_error() != 0) {
+    _this->_impl_.error_ = from._impl_.error_;
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void DeregisterNodeResp::CopyFrom(const DeregisterNodeResp& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:status.DeregisterNodeResp)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void DeregisterNodeResp::InternalSwap(DeregisterNodeResp* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+        swap(_impl_.error_, other->_impl_.error_);
+}
+
+::google::protobuf::Metadata DeregisterNodeResp::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class HeartbeatReq::_Internal {
+ public:
+};
+
+HeartbeatReq::HeartbeatReq(::google::protobuf::Arena* arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:status.HeartbeatReq)
+}
+inline PROTOBUF_NDEBUG_INLINE HeartbeatReq::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from, const ::status::HeartbeatReq& from_msg)
+      : name_(arena, from.name_),
+        server_host_(arena, from.server_host_),
+        _cached_size_{0} {}
+
+HeartbeatReq::HeartbeatReq(
+    ::google::protobuf::Arena* arena,
+    const HeartbeatReq& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  HeartbeatReq* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+  ::memcpy(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, server_port_),
+           reinterpret_cast<const char *>(&from._impl_) +
+               offsetof(Impl_, server_port_),
+           offsetof(Impl_, cpu_) -
+               offsetof(Impl_, server_port_) +
+               sizeof(Impl_::cpu_));
+
+  // @@protoc_insertion_point(copy_constructor:status.HeartbeatReq)
+}
+inline PROTOBUF_NDEBUG_INLINE HeartbeatReq::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : name_(arena),
+        server_host_(arena),
+        _cached_size_{0} {}
+
+inline void HeartbeatReq::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, server_port_),
+           0,
+           offsetof(Impl_, cpu_) -
+               offsetof(Impl_, server_port_) +
+               sizeof(Impl_::cpu_));
+}
+HeartbeatReq::~HeartbeatReq() {
+  // @@protoc_insertion_point(destructor:status.HeartbeatReq)
+  SharedDtor(*this);
+}
+inline void HeartbeatReq::SharedDtor(MessageLite& self) {
+  HeartbeatReq& this_ = static_cast<HeartbeatReq&>(self);
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.name_.Destroy();
+  this_._impl_.server_host_.Destroy();
+  this_._impl_.~Impl_();
+}
+
+inline void* HeartbeatReq::PlacementNew_(const void*, void* mem,
+                                        ::google::protobuf::Arena* arena) {
+  return ::new (mem) HeartbeatReq(arena);
+}
+constexpr auto HeartbeatReq::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(HeartbeatReq),
+                                            alignof(HeartbeatReq));
+}
+PROTOBUF_CONSTINIT
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::google::protobuf::internal::ClassDataFull HeartbeatReq::_class_data_ = {
+    ::google::protobuf::internal::ClassData{
+        &_HeartbeatReq_default_instance_._instance,
+        &_table_.header,
+        nullptr,  // OnDemandRegisterArenaDtor
+        nullptr,  // IsInitialized
+        &HeartbeatReq::MergeImpl,
+        ::google::protobuf::Message::GetNewImpl<HeartbeatReq>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        &HeartbeatReq::SharedDtor,
+        ::google::protobuf::Message::GetClearImpl<HeartbeatReq>(), &HeartbeatReq::ByteSizeLong,
+            &HeartbeatReq::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+        PROTOBUF_FIELD_OFFSET(HeartbeatReq, _impl_._cached_size_),
+        false,
+    },
+    &HeartbeatReq::kDescriptorMethods,
+    &descriptor_table_status_2eproto,
+    nullptr,  // tracker
+};
+const ::google::protobuf::internal::ClassData* HeartbeatReq::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
+  return _class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<3, 7, 0, 43, 2> HeartbeatReq::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    7, 56,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967168,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    7,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    _class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::status::HeartbeatReq>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+    // string name = 1;
+    {::_pbi::TcParser::FastUS1,
+     {10, 63, 0, PROTOBUF_FIELD_OFFSET(HeartbeatReq, _impl_.name_)}},
+    // string server_host = 2;
+    {::_pbi::TcParser::FastUS1,
+     {18, 63, 0, PROTOBUF_FIELD_OFFSET(HeartbeatReq, _impl_.server_host_)}},
+    // int32 server_port = 3;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(HeartbeatReq, _impl_.server_port_), 63>(),
+     {24, 63, 0, PROTOBUF_FIELD_OFFSET(HeartbeatReq, _impl_.server_port_)}},
+    // bool measured = 4;
+    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(HeartbeatReq, _impl_.measured_), 63>(),
+     {32, 63, 0, PROTOBUF_FIELD_OFFSET(HeartbeatReq, _impl_.measured_)}},
+    // int32 sessions = 5;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(HeartbeatReq, _impl_.sessions_), 63>(),
+     {40, 63, 0, PROTOBUF_FIELD_OFFSET(HeartbeatReq, _impl_.sessions_)}},
+    // int32 queue_depth = 6;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(HeartbeatReq, _impl_.queue_depth_), 63>(),
+     {48, 63, 0, PROTOBUF_FIELD_OFFSET(HeartbeatReq, _impl_.queue_depth_)}},
+    // int32 cpu = 7;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(HeartbeatReq, _impl_.cpu_), 63>(),
+     {56, 63, 0, PROTOBUF_FIELD_OFFSET(HeartbeatReq, _impl_.cpu_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // string name = 1;
+    {PROTOBUF_FIELD_OFFSET(HeartbeatReq, _impl_.name_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // string server_host = 2;
+    {PROTOBUF_FIELD_OFFSET(HeartbeatReq, _impl_.server_host_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // int32 server_port = 3;
+    {PROTOBUF_FIELD_OFFSET(HeartbeatReq, _impl_.server_port_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+    // bool measured = 4;
+    {PROTOBUF_FIELD_OFFSET(HeartbeatReq, _impl_.measured_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kBool)},
+    // int32 sessions = 5;
+    {PROTOBUF_FIELD_OFFSET(HeartbeatReq, _impl_.sessions_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+    // int32 queue_depth = 6;
+    {PROTOBUF_FIELD_OFFSET(HeartbeatReq, _impl_.queue_depth_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+    // int32 cpu = 7;
+    {PROTOBUF_FIELD_OFFSET(HeartbeatReq, _impl_.cpu_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+  }},
+  // no aux_entries
+  {{
+    "\23\4\13\0\0\0\0\0"
+    "status.HeartbeatReq"
+    "name"
+    "server_host"
+  }},
+};
+
+PROTOBUF_NOINLINE void HeartbeatReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:status.HeartbeatReq)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.name_.ClearToEmpty();
+  _impl_.server_host_.ClearToEmpty();
+  ::memset(&_impl_.server_port_, 0, static_cast<::size_t>(
+      reinterpret_cast<char*>(&_impl_.cpu_) -
+      reinterpret_cast<char*>(&_impl_.server_port_)) + sizeof(_impl_.cpu_));
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::uint8_t* HeartbeatReq::_InternalSerialize(
+            const MessageLite& base, ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) {
+          const HeartbeatReq& this_ = static_cast<const HeartbeatReq&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::uint8_t* HeartbeatReq::_InternalSerialize(
+            ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+          const HeartbeatReq& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(serialize_to_array_start:status.HeartbeatReq)
+          ::uint32_t cached_has_bits = 0;
+          (void)cached_has_bits;
+
+          // string name = 1;
+          if (!this_._internal_name().empty()) {
+            const std::string& _s = this_._internal_name();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "status.HeartbeatReq.name");
+            target = stream->WriteStringMaybeAliased(1, _s, target);
+          }
+
+          // string server_host = 2;
+          if (!this_._internal_server_host().empty()) {
+            const std::string& _s = this_._internal_server_host();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "status.HeartbeatReq.server_host");
+            target = stream->WriteStringMaybeAliased(2, _s, target);
+          }
+
+          // int32 server_port = 3;
+          if (this_._internal_server_port() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt32ToArrayWithField<3>(
+                    stream, this_._internal_server_port(), target);
+          }
+
+          // bool measured = 4;
+          if (this_._internal_measured() != 0) {
+            target = stream->EnsureSpace(target);
+            target = ::_pbi::WireFormatLite::WriteBoolToArray(
+                4, this_._internal_measured(), target);
+          }
+
+          // int32 sessions = 5;
+          if (this_._internal_sessions() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt32ToArrayWithField<5>(
+                    stream, this_._internal_sessions(), target);
+          }
+
+          // int32 queue_depth = 6;
+          if (this_._internal_queue_depth() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt32ToArrayWithField<6>(
+                    stream, this_._internal_queue_depth(), target);
+          }
+
+          // int32 cpu = 7;
+          if (this_._internal_cpu() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt32ToArrayWithField<7>(
+                    stream, this_._internal_cpu(), target);
+          }
+
+          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+            target =
+                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+          }
+          // @@protoc_insertion_point(serialize_to_array_end:status.HeartbeatReq)
+          return target;
+        }
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::size_t HeartbeatReq::ByteSizeLong(const MessageLite& base) {
+          const HeartbeatReq& this_ = static_cast<const HeartbeatReq&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::size_t HeartbeatReq::ByteSizeLong() const {
+          const HeartbeatReq& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(message_byte_size_start:status.HeartbeatReq)
+          ::size_t total_size = 0;
+
+          ::uint32_t cached_has_bits = 0;
+          // Prevent compiler warnings about cached_has_bits being unused
+          (void)cached_has_bits;
+
+          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+           {
+            // string name = 1;
+            if (!this_._internal_name().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_name());
+            }
+            // string server_host = 2;
+            if (!this_._internal_server_host().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_server_host());
+            }
+            // int32 server_port = 3;
+            if (this_._internal_server_port() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+                  this_._internal_server_port());
+            }
+            // bool measured = 4;
+            if (this_._internal_measured() != 0) {
+              total_size += 2;
+            }
+            // int32 sessions = 5;
+            if (this_._internal_sessions() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+                  this_._internal_sessions());
+            }
+            // int32 queue_depth = 6;
+            if (this_._internal_queue_depth() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+                  this_._internal_queue_depth());
+            }
+            // int32 cpu = 7;
+            if (this_._internal_cpu() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+                  this_._internal_cpu());
+            }
+          }
+          return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                                     &this_._impl_._cached_size_);
+        }
+
+void HeartbeatReq::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+  auto* const _this = static_cast<HeartbeatReq*>(&to_msg);
+  auto& from = static_cast<const HeartbeatReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:status.HeartbeatReq)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  if (!from._internal_server_host().empty()) {
+    _this->_internal_set_server_host(from._internal_server_host());
+  }
+  if (from._internal_server_port() != 0) {
+    _this->_impl_.server_port_ = from._impl_.server_port_;
+  }
+  if (from._internal_measured() != 0) {
+    _this->_impl_.measured_ = from._impl_.measured_;
+  }
+  if (from._internal_sessions() != 0) {
+    _this->_impl_.sessions_ = from._impl_.sessions_;
+  }
+  if (from._internal_queue_depth() != 0) {
+    _this->_impl_.queue_depth_ = from._impl_.queue_depth_;
+  }
+  if (from._internal_cpu() != 0) {
+    _this->_impl_.cpu_ = from._impl_.cpu_;
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void HeartbeatReq::CopyFrom(const HeartbeatReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:status.HeartbeatReq)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void HeartbeatReq::InternalSwap(HeartbeatReq* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.name_, &other->_impl_.name_, arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.server_host_, &other->_impl_.server_host_, arena);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(HeartbeatReq, _impl_.cpu_)
+      + sizeof(HeartbeatReq::_impl_.cpu_)
+      - PROTOBUF_FIELD_OFFSET(HeartbeatReq, _impl_.server_port_)>(
+          reinterpret_cast<char*>(&_impl_.server_port_),
+          reinterpret_cast<char*>(&other->_impl_.server_port_));
+}
+
+::google::protobuf::Metadata HeartbeatReq::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class HeartbeatResp::_Internal {
+ public:
+};
+
+HeartbeatResp::HeartbeatResp(::google::protobuf::Arena* arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:status.HeartbeatResp)
+}
+HeartbeatResp::HeartbeatResp(
+    ::google::protobuf::Arena* arena, const HeartbeatResp& from)
+    : HeartbeatResp(arena) {
+  MergeFrom(from);
+}
+inline PROTOBUF_NDEBUG_INLINE HeartbeatResp::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0} {}
+
+inline void HeartbeatResp::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.error_ = {};
+}
+HeartbeatResp::~HeartbeatResp() {
+  // @@protoc_insertion_point(destructor:status.HeartbeatResp)
+  SharedDtor(*this);
+}
+inline void HeartbeatResp::SharedDtor(MessageLite& self) {
+  HeartbeatResp& this_ = static_cast<HeartbeatResp&>(self);
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.~Impl_();
+}
+
+inline void* HeartbeatResp::PlacementNew_(const void*, void* mem,
+                                        ::google::protobuf::Arena* arena) {
+  return ::new (mem) HeartbeatResp(arena);
+}
+constexpr auto HeartbeatResp::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(HeartbeatResp),
+                                            alignof(HeartbeatResp));
+}
+PROTOBUF_CONSTINIT
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::google::protobuf::internal::ClassDataFull HeartbeatResp::_class_data_ = {
+    ::google::protobuf::internal::ClassData{
+        &_HeartbeatResp_default_instance_._instance,
+        &_table_.header,
+        nullptr,  // OnDemandRegisterArenaDtor
+        nullptr,  // IsInitialized
+        &HeartbeatResp::MergeImpl,
+        ::google::protobuf::Message::GetNewImpl<HeartbeatResp>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        &HeartbeatResp::SharedDtor,
+        ::google::protobuf::Message::GetClearImpl<HeartbeatResp>(), &HeartbeatResp::ByteSizeLong,
+            &HeartbeatResp::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+        PROTOBUF_FIELD_OFFSET(HeartbeatResp, _impl_._cached_size_),
+        false,
+    },
+    &HeartbeatResp::kDescriptorMethods,
+    &descriptor_table_status_2eproto,
+    nullptr,  // tracker
+};
+const ::google::protobuf::internal::ClassData* HeartbeatResp::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
+  return _class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 0, 0, 2> HeartbeatResp::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    1, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967294,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    _class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::status::HeartbeatResp>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    // int32 error = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(HeartbeatResp, _impl_.error_), 63>(),
+     {8, 63, 0, PROTOBUF_FIELD_OFFSET(HeartbeatResp, _impl_.error_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // int32 error = 1;
+    {PROTOBUF_FIELD_OFFSET(HeartbeatResp, _impl_.error_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+  }},
+  // no aux_entries
+  {{
+  }},
+};
+
+PROTOBUF_NOINLINE void HeartbeatResp::Clear() {
+// @@protoc_insertion_point(message_clear_start:status.HeartbeatResp)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.error_ = 0;
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::uint8_t* HeartbeatResp::_InternalSerialize(
+            const MessageLite& base, ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) {
+          const HeartbeatResp& this_ = static_cast<const HeartbeatResp&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::uint8_t* HeartbeatResp::_InternalSerialize(
+            ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+          const HeartbeatResp& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(serialize_to_array_start:status.HeartbeatResp)
+          ::uint32_t cached_has_bits = 0;
+          (void)cached_has_bits;
+
+          // int32 error = 1;
+          if (this_._internal_error() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt32ToArrayWithField<1>(
+                    stream, this_._internal_error(), target);
+          }
+
+          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+            target =
+                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+          }
+          // @@protoc_insertion_point(serialize_to_array_end:status.HeartbeatResp)
+          return target;
+        }
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::size_t HeartbeatResp::ByteSizeLong(const MessageLite& base) {
+          const HeartbeatResp& this_ = static_cast<const HeartbeatResp&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::size_t HeartbeatResp::ByteSizeLong() const {
+          const HeartbeatResp& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(message_byte_size_start:status.HeartbeatResp)
+          ::size_t total_size = 0;
+
+          ::uint32_t cached_has_bits = 0;
+          // Prevent compiler warnings about cached_has_bits being unused
+          (void)cached_has_bits;
+
+           {
+            // int32 error = 1;
+            if (this_._internal_error() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+                  this_._internal_error());
+            }
+          }
+          return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                                     &this_._impl_._cached_size_);
+        }
+
+void HeartbeatResp::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+  auto* const _this = static_cast<HeartbeatResp*>(&to_msg);
+  auto& from = static_cast<const HeartbeatResp&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:status.HeartbeatResp)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_error() != 0) {
+    _this->_impl_.error_ = from._impl_.error_;
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void HeartbeatResp::CopyFrom(const HeartbeatResp& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:status.HeartbeatResp)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void HeartbeatResp::InternalSwap(HeartbeatResp* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+        swap(_impl_.error_, other->_impl_.error_);
+}
+
+::google::protobuf::Metadata HeartbeatResp::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class AllocateServerReq::_Internal {
+ public:
+};
+
+AllocateServerReq::AllocateServerReq(::google::protobuf::Arena* arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:status.AllocateServerReq)
+}
+inline PROTOBUF_NDEBUG_INLINE AllocateServerReq::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from, const ::status::AllocateServerReq& from_msg)
+      : uid_(arena, from.uid_),
+        _cached_size_{0} {}
+
+AllocateServerReq::AllocateServerReq(
+    ::google::protobuf::Arena* arena,
+    const AllocateServerReq& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  AllocateServerReq* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+
+  // @@protoc_insertion_point(copy_constructor:status.AllocateServerReq)
+}
+inline PROTOBUF_NDEBUG_INLINE AllocateServerReq::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : uid_(arena),
+        _cached_size_{0} {}
+
+inline void AllocateServerReq::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+AllocateServerReq::~AllocateServerReq() {
+  // @@protoc_insertion_point(destructor:status.AllocateServerReq)
+  SharedDtor(*this);
+}
+inline void AllocateServerReq::SharedDtor(MessageLite& self) {
+  AllocateServerReq& this_ = static_cast<AllocateServerReq&>(self);
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.uid_.Destroy();
+  this_._impl_.~Impl_();
+}
+
+inline void* AllocateServerReq::PlacementNew_(const void*, void* mem,
+                                        ::google::protobuf::Arena* arena) {
+  return ::new (mem) AllocateServerReq(arena);
+}
+constexpr auto AllocateServerReq::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(AllocateServerReq),
+                                            alignof(AllocateServerReq));
+}
+PROTOBUF_CONSTINIT
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::google::protobuf::internal::ClassDataFull AllocateServerReq::_class_data_ = {
+    ::google::protobuf::internal::ClassData{
+        &_AllocateServerReq_default_instance_._instance,
+        &_table_.header,
+        nullptr,  // OnDemandRegisterArenaDtor
+        nullptr,  // IsInitialized
+        &AllocateServerReq::MergeImpl,
+        ::google::protobuf::Message::GetNewImpl<AllocateServerReq>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        &AllocateServerReq::SharedDtor,
+        ::google::protobuf::Message::GetClearImpl<AllocateServerReq>(), &AllocateServerReq::ByteSizeLong,
+            &AllocateServerReq::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+        PROTOBUF_FIELD_OFFSET(AllocateServerReq, _impl_._cached_size_),
+        false,
+    },
+    &AllocateServerReq::kDescriptorMethods,
+    &descriptor_table_status_2eproto,
+    nullptr,  // tracker
+};
+const ::google::protobuf::internal::ClassData* AllocateServerReq::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
+  return _class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 0, 36, 2> AllocateServerReq::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    1, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967294,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    _class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::status::AllocateServerReq>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    // string uid = 1;
+    {::_pbi::TcParser::FastUS1,
+     {10, 63, 0, PROTOBUF_FIELD_OFFSET(AllocateServerReq, _impl_.uid_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // string uid = 1;
+    {PROTOBUF_FIELD_OFFSET(AllocateServerReq, _impl_.uid_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+  }},
+  // no aux_entries
+  {{
+    "\30\3\0\0\0\0\0\0"
+    "status.AllocateServerReq"
+    "uid"
+  }},
+};
+
+PROTOBUF_NOINLINE void AllocateServerReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:status.AllocateServerReq)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.uid_.ClearToEmpty();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::uint8_t* AllocateServerReq::_InternalSerialize(
+            const MessageLite& base, ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) {
+          const AllocateServerReq& this_ = static_cast<const AllocateServerReq&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::uint8_t* AllocateServerReq::_InternalSerialize(
+            ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+          const AllocateServerReq& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(serialize_to_array_start:status.AllocateServerReq)
+          ::uint32_t cached_has_bits = 0;
+          (void)cached_has_bits;
+
+          // string uid = 1;
+          if (!this_._internal_uid().empty()) {
+            const std::string& _s = this_._internal_uid();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "status.AllocateServerReq.uid");
+            target = stream->WriteStringMaybeAliased(1, _s, target);
+          }
+
+          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+            target =
+                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+          }
+          // @@protoc_insertion_point(serialize_to_array_end:status.AllocateServerReq)
+          return target;
+        }
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::size_t AllocateServerReq::ByteSizeLong(const MessageLite& base) {
+          const AllocateServerReq& this_ = static_cast<const AllocateServerReq&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::size_t AllocateServerReq::ByteSizeLong() const {
+          const AllocateServerReq& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(message_byte_size_start:status.AllocateServerReq)
+          ::size_t total_size = 0;
+
+          ::uint32_t cached_has_bits = 0;
+          // Prevent compiler warnings about cached_has_bits being unused
+          (void)cached_has_bits;
+
+           {
+            // string uid = 1;
+            if (!this_._internal_uid().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_uid());
+            }
+          }
+          return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                                     &this_._impl_._cached_size_);
+        }
+
+void AllocateServerReq::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+  auto* const _this = static_cast<AllocateServerReq*>(&to_msg);
+  auto& from = static_cast<const AllocateServerReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:status.AllocateServerReq)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_uid().empty()) {
+    _this->_internal_set_uid(from._internal_uid());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void AllocateServerReq::CopyFrom(const AllocateServerReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:status.AllocateServerReq)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void AllocateServerReq::InternalSwap(AllocateServerReq* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.uid_, &other->_impl_.uid_, arena);
+}
+
+::google::protobuf::Metadata AllocateServerReq::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class AllocateServerResp::_Internal {
+ public:
+};
+
+AllocateServerResp::AllocateServerResp(::google::protobuf::Arena* arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:status.AllocateServerResp)
+}
+inline PROTOBUF_NDEBUG_INLINE AllocateServerResp::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from, const ::status::AllocateServerResp& from_msg)
+      : server_name_(arena, from.server_name_),
+        server_host_(arena, from.server_host_),
+        token_(arena, from.token_),
+        _cached_size_{0} {}
+
+AllocateServerResp::AllocateServerResp(
+    ::google::protobuf::Arena* arena,
+    const AllocateServerResp& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  AllocateServerResp* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+  ::memcpy(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, error_),
+           reinterpret_cast<const char *>(&from._impl_) +
+               offsetof(Impl_, error_),
+           offsetof(Impl_, server_port_) -
+               offsetof(Impl_, error_) +
+               sizeof(Impl_::server_port_));
+
+  // @@protoc_insertion_point(copy_constructor:status.AllocateServerResp)
+}
+inline PROTOBUF_NDEBUG_INLINE AllocateServerResp::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : server_name_(arena),
+        server_host_(arena),
+        token_(arena),
+        _cached_size_{0} {}
+
+inline void AllocateServerResp::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, error_),
+           0,
+           offsetof(Impl_, server_port_) -
+               offsetof(Impl_, error_) +
+               sizeof(Impl_::server_port_));
+}
+AllocateServerResp::~AllocateServerResp() {
+  // @@protoc_insertion_point(destructor:status.AllocateServerResp)
+  SharedDtor(*this);
+}
+inline void AllocateServerResp::SharedDtor(MessageLite& self) {
+  AllocateServerResp& this_ = static_cast<AllocateServerResp&>(self);
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.server_name_.Destroy();
+  this_._impl_.server_host_.Destroy();
+  this_._impl_.token_.Destroy();
+  this_._impl_.~Impl_();
+}
+
+inline void* AllocateServerResp::PlacementNew_(const void*, void* mem,
+                                        ::google::protobuf::Arena* arena) {
+  return ::new (mem) AllocateServerResp(arena);
+}
+constexpr auto AllocateServerResp::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(AllocateServerResp),
+                                            alignof(AllocateServerResp));
+}
+PROTOBUF_CONSTINIT
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::google::protobuf::internal::ClassDataFull AllocateServerResp::_class_data_ = {
+    ::google::protobuf::internal::ClassData{
+        &_AllocateServerResp_default_instance_._instance,
+        &_table_.header,
+        nullptr,  // OnDemandRegisterArenaDtor
+        nullptr,  // IsInitialized
+        &AllocateServerResp::MergeImpl,
+        ::google::protobuf::Message::GetNewImpl<AllocateServerResp>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        &AllocateServerResp::SharedDtor,
+        ::google::protobuf::Message::GetClearImpl<AllocateServerResp>(), &AllocateServerResp::ByteSizeLong,
+            &AllocateServerResp::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+        PROTOBUF_FIELD_OFFSET(AllocateServerResp, _impl_._cached_size_),
+        false,
+    },
+    &AllocateServerResp::kDescriptorMethods,
+    &descriptor_table_status_2eproto,
+    nullptr,  // tracker
+};
+const ::google::protobuf::internal::ClassData* AllocateServerResp::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
+  return _class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<3, 7, 0, 61, 2> AllocateServerResp::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    7, 56,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967168,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    7,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    _class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::status::AllocateServerResp>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+    // int32 error = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(AllocateServerResp, _impl_.error_), 63>(),
+     {8, 63, 0, PROTOBUF_FIELD_OFFSET(AllocateServerResp, _impl_.error_)}},
+    // bool assigned = 2;
+    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(AllocateServerResp, _impl_.assigned_), 63>(),
+     {16, 63, 0, PROTOBUF_FIELD_OFFSET(AllocateServerResp, _impl_.assigned_)}},
+    // string server_name = 3;
+    {::_pbi::TcParser::FastUS1,
+     {26, 63, 0, PROTOBUF_FIELD_OFFSET(AllocateServerResp, _impl_.server_name_)}},
+    // string server_host = 4;
+    {::_pbi::TcParser::FastUS1,
+     {34, 63, 0, PROTOBUF_FIELD_OFFSET(AllocateServerResp, _impl_.server_host_)}},
+    // int32 server_port = 5;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(AllocateServerResp, _impl_.server_port_), 63>(),
+     {40, 63, 0, PROTOBUF_FIELD_OFFSET(AllocateServerResp, _impl_.server_port_)}},
+    // string token = 6;
+    {::_pbi::TcParser::FastUS1,
+     {50, 63, 0, PROTOBUF_FIELD_OFFSET(AllocateServerResp, _impl_.token_)}},
+    // int64 expires_at = 7;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(AllocateServerResp, _impl_.expires_at_), 63>(),
+     {56, 63, 0, PROTOBUF_FIELD_OFFSET(AllocateServerResp, _impl_.expires_at_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // int32 error = 1;
+    {PROTOBUF_FIELD_OFFSET(AllocateServerResp, _impl_.error_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+    // bool assigned = 2;
+    {PROTOBUF_FIELD_OFFSET(AllocateServerResp, _impl_.assigned_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kBool)},
+    // string server_name = 3;
+    {PROTOBUF_FIELD_OFFSET(AllocateServerResp, _impl_.server_name_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // string server_host = 4;
+    {PROTOBUF_FIELD_OFFSET(AllocateServerResp, _impl_.server_host_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // int32 server_port = 5;
+    {PROTOBUF_FIELD_OFFSET(AllocateServerResp, _impl_.server_port_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+    // string token = 6;
+    {PROTOBUF_FIELD_OFFSET(AllocateServerResp, _impl_.token_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // int64 expires_at = 7;
+    {PROTOBUF_FIELD_OFFSET(AllocateServerResp, _impl_.expires_at_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt64)},
+  }},
+  // no aux_entries
+  {{
+    "\31\0\0\13\13\0\5\0"
+    "status.AllocateServerResp"
+    "server_name"
+    "server_host"
+    "token"
+  }},
+};
+
+PROTOBUF_NOINLINE void AllocateServerResp::Clear() {
+// @@protoc_insertion_point(message_clear_start:status.AllocateServerResp)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.server_name_.ClearToEmpty();
+  _impl_.server_host_.ClearToEmpty();
+  _impl_.token_.ClearToEmpty();
+  ::memset(&_impl_.error_, 0, static_cast<::size_t>(
+      reinterpret_cast<char*>(&_impl_.server_port_) -
+      reinterpret_cast<char*>(&_impl_.error_)) + sizeof(_impl_.server_port_));
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::uint8_t* AllocateServerResp::_InternalSerialize(
+            const MessageLite& base, ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) {
+          const AllocateServerResp& this_ = static_cast<const AllocateServerResp&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::uint8_t* AllocateServerResp::_InternalSerialize(
+            ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+          const AllocateServerResp& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(serialize_to_array_start:status.AllocateServerResp)
+          ::uint32_t cached_has_bits = 0;
+          (void)cached_has_bits;
+
+          // int32 error = 1;
+          if (this_._internal_error() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt32ToArrayWithField<1>(
+                    stream, this_._internal_error(), target);
+          }
+
+          // bool assigned = 2;
+          if (this_._internal_assigned() != 0) {
+            target = stream->EnsureSpace(target);
+            target = ::_pbi::WireFormatLite::WriteBoolToArray(
+                2, this_._internal_assigned(), target);
+          }
+
+          // string server_name = 3;
+          if (!this_._internal_server_name().empty()) {
+            const std::string& _s = this_._internal_server_name();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "status.AllocateServerResp.server_name");
+            target = stream->WriteStringMaybeAliased(3, _s, target);
+          }
+
+          // string server_host = 4;
+          if (!this_._internal_server_host().empty()) {
+            const std::string& _s = this_._internal_server_host();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "status.AllocateServerResp.server_host");
+            target = stream->WriteStringMaybeAliased(4, _s, target);
+          }
+
+          // int32 server_port = 5;
+          if (this_._internal_server_port() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt32ToArrayWithField<5>(
+                    stream, this_._internal_server_port(), target);
+          }
+
+          // string token = 6;
+          if (!this_._internal_token().empty()) {
+            const std::string& _s = this_._internal_token();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "status.AllocateServerResp.token");
+            target = stream->WriteStringMaybeAliased(6, _s, target);
+          }
+
+          // int64 expires_at = 7;
+          if (this_._internal_expires_at() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt64ToArrayWithField<7>(
+                    stream, this_._internal_expires_at(), target);
+          }
+
+          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+            target =
+                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+          }
+          // @@protoc_insertion_point(serialize_to_array_end:status.AllocateServerResp)
+          return target;
+        }
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::size_t AllocateServerResp::ByteSizeLong(const MessageLite& base) {
+          const AllocateServerResp& this_ = static_cast<const AllocateServerResp&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::size_t AllocateServerResp::ByteSizeLong() const {
+          const AllocateServerResp& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(message_byte_size_start:status.AllocateServerResp)
+          ::size_t total_size = 0;
+
+          ::uint32_t cached_has_bits = 0;
+          // Prevent compiler warnings about cached_has_bits being unused
+          (void)cached_has_bits;
+
+          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+           {
+            // string server_name = 3;
+            if (!this_._internal_server_name().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_server_name());
+            }
+            // string server_host = 4;
+            if (!this_._internal_server_host().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_server_host());
+            }
+            // string token = 6;
+            if (!this_._internal_token().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_token());
+            }
+            // int32 error = 1;
+            if (this_._internal_error() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+                  this_._internal_error());
+            }
+            // bool assigned = 2;
+            if (this_._internal_assigned() != 0) {
+              total_size += 2;
+            }
+            // int64 expires_at = 7;
+            if (this_._internal_expires_at() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(
+                  this_._internal_expires_at());
+            }
+            // int32 server_port = 5;
+            if (this_._internal_server_port() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+                  this_._internal_server_port());
+            }
+          }
+          return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                                     &this_._impl_._cached_size_);
+        }
+
+void AllocateServerResp::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+  auto* const _this = static_cast<AllocateServerResp*>(&to_msg);
+  auto& from = static_cast<const AllocateServerResp&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:status.AllocateServerResp)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_server_name().empty()) {
+    _this->_internal_set_server_name(from._internal_server_name());
+  }
+  if (!from._internal_server_host().empty()) {
+    _this->_internal_set_server_host(from._internal_server_host());
+  }
+  if (!from._internal_token().empty()) {
+    _this->_internal_set_token(from._internal_token());
+  }
+  if (from._internal_error() != 0) {
+    _this->_impl_.error_ = from._impl_.error_;
+  }
+  if (from._internal_assigned() != 0) {
+    _this->_impl_.assigned_ = from._impl_.assigned_;
+  }
+  if (from._internal_expires_at() != 0) {
+    _this->_impl_.expires_at_ = from._impl_.expires_at_;
+  }
+  if (from._internal_server_port() != 0) {
+    _this->_impl_.server_port_ = from._impl_.server_port_;
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void AllocateServerResp::CopyFrom(const AllocateServerResp& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:status.AllocateServerResp)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void AllocateServerResp::InternalSwap(AllocateServerResp* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.server_name_, &other->_impl_.server_name_, arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.server_host_, &other->_impl_.server_host_, arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.token_, &other->_impl_.token_, arena);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(AllocateServerResp, _impl_.server_port_)
+      + sizeof(AllocateServerResp::_impl_.server_port_)
+      - PROTOBUF_FIELD_OFFSET(AllocateServerResp, _impl_.error_)>(
+          reinterpret_cast<char*>(&_impl_.error_),
+          reinterpret_cast<char*>(&other->_impl_.error_));
+}
+
+::google::protobuf::Metadata AllocateServerResp::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class OnlineReportReq::_Internal {
+ public:
+};
+
+OnlineReportReq::OnlineReportReq(::google::protobuf::Arena* arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:status.OnlineReportReq)
+}
+inline PROTOBUF_NDEBUG_INLINE OnlineReportReq::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from, const ::status::OnlineReportReq& from_msg)
+      : uid_(arena, from.uid_),
+        server_name_(arena, from.server_name_),
+        server_host_(arena, from.server_host_),
+        token_(arena, from.token_),
+        _cached_size_{0} {}
+
+OnlineReportReq::OnlineReportReq(
+    ::google::protobuf::Arena* arena,
+    const OnlineReportReq& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  OnlineReportReq* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+  ::memcpy(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, generation_),
+           reinterpret_cast<const char *>(&from._impl_) +
+               offsetof(Impl_, generation_),
+           offsetof(Impl_, server_port_) -
+               offsetof(Impl_, generation_) +
+               sizeof(Impl_::server_port_));
+
+  // @@protoc_insertion_point(copy_constructor:status.OnlineReportReq)
+}
+inline PROTOBUF_NDEBUG_INLINE OnlineReportReq::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : uid_(arena),
+        server_name_(arena),
+        server_host_(arena),
+        token_(arena),
+        _cached_size_{0} {}
+
+inline void OnlineReportReq::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, generation_),
+           0,
+           offsetof(Impl_, server_port_) -
+               offsetof(Impl_, generation_) +
+               sizeof(Impl_::server_port_));
+}
+OnlineReportReq::~OnlineReportReq() {
+  // @@protoc_insertion_point(destructor:status.OnlineReportReq)
+  SharedDtor(*this);
+}
+inline void OnlineReportReq::SharedDtor(MessageLite& self) {
+  OnlineReportReq& this_ = static_cast<OnlineReportReq&>(self);
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.uid_.Destroy();
+  this_._impl_.server_name_.Destroy();
+  this_._impl_.server_host_.Destroy();
+  this_._impl_.token_.Destroy();
+  this_._impl_.~Impl_();
+}
+
+inline void* OnlineReportReq::PlacementNew_(const void*, void* mem,
+                                        ::google::protobuf::Arena* arena) {
+  return ::new (mem) OnlineReportReq(arena);
+}
+constexpr auto OnlineReportReq::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(OnlineReportReq),
+                                            alignof(OnlineReportReq));
+}
+PROTOBUF_CONSTINIT
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::google::protobuf::internal::ClassDataFull OnlineReportReq::_class_data_ = {
+    ::google::protobuf::internal::ClassData{
+        &_OnlineReportReq_default_instance_._instance,
+        &_table_.header,
+        nullptr,  // OnDemandRegisterArenaDtor
+        nullptr,  // IsInitialized
+        &OnlineReportReq::MergeImpl,
+        ::google::protobuf::Message::GetNewImpl<OnlineReportReq>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        &OnlineReportReq::SharedDtor,
+        ::google::protobuf::Message::GetClearImpl<OnlineReportReq>(), &OnlineReportReq::ByteSizeLong,
+            &OnlineReportReq::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+        PROTOBUF_FIELD_OFFSET(OnlineReportReq, _impl_._cached_size_),
+        false,
+    },
+    &OnlineReportReq::kDescriptorMethods,
+    &descriptor_table_status_2eproto,
+    nullptr,  // tracker
+};
+const ::google::protobuf::internal::ClassData* OnlineReportReq::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
+  return _class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<3, 6, 0, 61, 2> OnlineReportReq::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    6, 56,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967232,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    6,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    _class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::status::OnlineReportReq>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+    // string uid = 1;
+    {::_pbi::TcParser::FastUS1,
+     {10, 63, 0, PROTOBUF_FIELD_OFFSET(OnlineReportReq, _impl_.uid_)}},
+    // string server_name = 2;
+    {::_pbi::TcParser::FastUS1,
+     {18, 63, 0, PROTOBUF_FIELD_OFFSET(OnlineReportReq, _impl_.server_name_)}},
+    // string server_host = 3;
+    {::_pbi::TcParser::FastUS1,
+     {26, 63, 0, PROTOBUF_FIELD_OFFSET(OnlineReportReq, _impl_.server_host_)}},
+    // int32 server_port = 4;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(OnlineReportReq, _impl_.server_port_), 63>(),
+     {32, 63, 0, PROTOBUF_FIELD_OFFSET(OnlineReportReq, _impl_.server_port_)}},
+    // string token = 5;
+    {::_pbi::TcParser::FastUS1,
+     {42, 63, 0, PROTOBUF_FIELD_OFFSET(OnlineReportReq, _impl_.token_)}},
+    // int64 generation = 6;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(OnlineReportReq, _impl_.generation_), 63>(),
+     {48, 63, 0, PROTOBUF_FIELD_OFFSET(OnlineReportReq, _impl_.generation_)}},
+    {::_pbi::TcParser::MiniParse, {}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // string uid = 1;
+    {PROTOBUF_FIELD_OFFSET(OnlineReportReq, _impl_.uid_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // string server_name = 2;
+    {PROTOBUF_FIELD_OFFSET(OnlineReportReq, _impl_.server_name_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // string server_host = 3;
+    {PROTOBUF_FIELD_OFFSET(OnlineReportReq, _impl_.server_host_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // int32 server_port = 4;
+    {PROTOBUF_FIELD_OFFSET(OnlineReportReq, _impl_.server_port_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+    // string token = 5;
+    {PROTOBUF_FIELD_OFFSET(OnlineReportReq, _impl_.token_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // int64 generation = 6;
+    {PROTOBUF_FIELD_OFFSET(OnlineReportReq, _impl_.generation_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt64)},
+  }},
+  // no aux_entries
+  {{
+    "\26\3\13\13\0\5\0\0"
+    "status.OnlineReportReq"
+    "uid"
+    "server_name"
+    "server_host"
+    "token"
+  }},
+};
+
+PROTOBUF_NOINLINE void OnlineReportReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:status.OnlineReportReq)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.uid_.ClearToEmpty();
+  _impl_.server_name_.ClearToEmpty();
+  _impl_.server_host_.ClearToEmpty();
+  _impl_.token_.ClearToEmpty();
+  ::memset(&_impl_.generation_, 0, static_cast<::size_t>(
+      reinterpret_cast<char*>(&_impl_.server_port_) -
+      reinterpret_cast<char*>(&_impl_.generation_)) + sizeof(_impl_.server_port_));
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::uint8_t* OnlineReportReq::_InternalSerialize(
+            const MessageLite& base, ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) {
+          const OnlineReportReq& this_ = static_cast<const OnlineReportReq&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::uint8_t* OnlineReportReq::_InternalSerialize(
+            ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+          const OnlineReportReq& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(serialize_to_array_start:status.OnlineReportReq)
+          ::uint32_t cached_has_bits = 0;
+          (void)cached_has_bits;
+
+          // string uid = 1;
+          if (!this_._internal_uid().empty()) {
+            const std::string& _s = this_._internal_uid();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "status.OnlineReportReq.uid");
+            target = stream->WriteStringMaybeAliased(1, _s, target);
+          }
+
+          // string server_name = 2;
+          if (!this_._internal_server_name().empty()) {
+            const std::string& _s = this_._internal_server_name();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "status.OnlineReportReq.server_name");
+            target = stream->WriteStringMaybeAliased(2, _s, target);
+          }
+
+          // string server_host = 3;
+          if (!this_._internal_server_host().empty()) {
+            const std::string& _s = this_._internal_server_host();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "status.OnlineReportReq.server_host");
+            target = stream->WriteStringMaybeAliased(3, _s, target);
+          }
+
+          // int32 server_port = 4;
+          if (this_._internal_server_port() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt32ToArrayWithField<4>(
+                    stream, this_._internal_server_port(), target);
+          }
+
+          // string token = 5;
+          if (!this_._internal_token().empty()) {
+            const std::string& _s = this_._internal_token();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "status.OnlineReportReq.token");
+            target = stream->WriteStringMaybeAliased(5, _s, target);
+          }
+
+          // int64 generation = 6;
+          if (this_._internal_generation() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt64ToArrayWithField<6>(
+                    stream, this_._internal_generation(), target);
+          }
+
+          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+            target =
+                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+          }
+          // @@protoc_insertion_point(serialize_to_array_end:status.OnlineReportReq)
+          return target;
+        }
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::size_t OnlineReportReq::ByteSizeLong(const MessageLite& base) {
+          const OnlineReportReq& this_ = static_cast<const OnlineReportReq&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::size_t OnlineReportReq::ByteSizeLong() const {
+          const OnlineReportReq& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(message_byte_size_start:status.OnlineReportReq)
+          ::size_t total_size = 0;
+
+          ::uint32_t cached_has_bits = 0;
+          // Prevent compiler warnings about cached_has_bits being unused
+          (void)cached_has_bits;
+
+          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+           {
+            // string uid = 1;
+            if (!this_._internal_uid().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_uid());
+            }
+            // string server_name = 2;
+            if (!this_._internal_server_name().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_server_name());
+            }
+            // string server_host = 3;
+            if (!this_._internal_server_host().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_server_host());
+            }
+            // string token = 5;
+            if (!this_._internal_token().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_token());
+            }
+            // int64 generation = 6;
+            if (this_._internal_generation() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(
+                  this_._internal_generation());
+            }
+            // int32 server_port = 4;
+            if (this_._internal_server_port() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+                  this_._internal_server_port());
+            }
+          }
+          return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                                     &this_._impl_._cached_size_);
+        }
+
+void OnlineReportReq::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+  auto* const _this = static_cast<OnlineReportReq*>(&to_msg);
+  auto& from = static_cast<const OnlineReportReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:status.OnlineReportReq)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_uid().empty()) {
+    _this->_internal_set_uid(from._internal_uid());
+  }
+  if (!from._internal_server_name().empty()) {
+    _this->_internal_set_server_name(from._internal_server_name());
+  }
+  if (!from._internal_server_host().empty()) {
+    _this->_internal_set_server_host(from._internal_server_host());
+  }
+  if (!from._internal_token().empty()) {
+    _this->_internal_set_token(from._internal_token());
+  }
+  if (from._internal_generation() != 0) {
+    _this->_impl_.generation_ = from._impl_.generation_;
+  }
+  if (from._internal_server_port() != 0) {
+    _this->_impl_.server_port_ = from._impl_.server_port_;
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void OnlineReportReq::CopyFrom(const OnlineReportReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:status.OnlineReportReq)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void OnlineReportReq::InternalSwap(OnlineReportReq* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.uid_, &other->_impl_.uid_, arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.server_name_, &other->_impl_.server_name_, arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.server_host_, &other->_impl_.server_host_, arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.token_, &other->_impl_.token_, arena);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(OnlineReportReq, _impl_.server_port_)
+      + sizeof(OnlineReportReq::_impl_.server_port_)
+      - PROTOBUF_FIELD_OFFSET(OnlineReportReq, _impl_.generation_)>(
+          reinterpret_cast<char*>(&_impl_.generation_),
+          reinterpret_cast<char*>(&other->_impl_.generation_));
+}
+
+::google::protobuf::Metadata OnlineReportReq::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class OnlineReportResp::_Internal {
+ public:
+};
+
+OnlineReportResp::OnlineReportResp(::google::protobuf::Arena* arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:status.OnlineReportResp)
+}
+OnlineReportResp::OnlineReportResp(
+    ::google::protobuf::Arena* arena, const OnlineReportResp& from)
+    : OnlineReportResp(arena) {
+  MergeFrom(from);
+}
+inline PROTOBUF_NDEBUG_INLINE OnlineReportResp::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0} {}
+
+inline void OnlineReportResp::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.error_ = {};
+}
+OnlineReportResp::~OnlineReportResp() {
+  // @@protoc_insertion_point(destructor:status.OnlineReportResp)
+  SharedDtor(*this);
+}
+inline void OnlineReportResp::SharedDtor(MessageLite& self) {
+  OnlineReportResp& this_ = static_cast<OnlineReportResp&>(self);
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.~Impl_();
+}
+
+inline void* OnlineReportResp::PlacementNew_(const void*, void* mem,
+                                        ::google::protobuf::Arena* arena) {
+  return ::new (mem) OnlineReportResp(arena);
+}
+constexpr auto OnlineReportResp::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(OnlineReportResp),
+                                            alignof(OnlineReportResp));
+}
+PROTOBUF_CONSTINIT
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::google::protobuf::internal::ClassDataFull OnlineReportResp::_class_data_ = {
+    ::google::protobuf::internal::ClassData{
+        &_OnlineReportResp_default_instance_._instance,
+        &_table_.header,
+        nullptr,  // OnDemandRegisterArenaDtor
+        nullptr,  // IsInitialized
+        &OnlineReportResp::MergeImpl,
+        ::google::protobuf::Message::GetNewImpl<OnlineReportResp>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        &OnlineReportResp::SharedDtor,
+        ::google::protobuf::Message::GetClearImpl<OnlineReportResp>(), &OnlineReportResp::ByteSizeLong,
+            &OnlineReportResp::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+        PROTOBUF_FIELD_OFFSET(OnlineReportResp, _impl_._cached_size_),
+        false,
+    },
+    &OnlineReportResp::kDescriptorMethods,
+    &descriptor_table_status_2eproto,
+    nullptr,  // tracker
+};
+const ::google::protobuf::internal::ClassData* OnlineReportResp::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
+  return _class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 0, 0, 2> OnlineReportResp::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    1, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967294,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    _class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::status::OnlineReportResp>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    // int32 error = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(OnlineReportResp, _impl_.error_), 63>(),
+     {8, 63, 0, PROTOBUF_FIELD_OFFSET(OnlineReportResp, _impl_.error_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // int32 error = 1;
+    {PROTOBUF_FIELD_OFFSET(OnlineReportResp, _impl_.error_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+  }},
+  // no aux_entries
+  {{
+  }},
+};
+
+PROTOBUF_NOINLINE void OnlineReportResp::Clear() {
+// @@protoc_insertion_point(message_clear_start:status.OnlineReportResp)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.error_ = 0;
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::uint8_t* OnlineReportResp::_InternalSerialize(
+            const MessageLite& base, ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) {
+          const OnlineReportResp& this_ = static_cast<const OnlineReportResp&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::uint8_t* OnlineReportResp::_InternalSerialize(
+            ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+          const OnlineReportResp& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(serialize_to_array_start:status.OnlineReportResp)
+          ::uint32_t cached_has_bits = 0;
+          (void)cached_has_bits;
+
+          // int32 error = 1;
+          if (this_._internal_error() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt32ToArrayWithField<1>(
+                    stream, this_._internal_error(), target);
+          }
+
+          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+            target =
+                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+          }
+          // @@protoc_insertion_point(serialize_to_array_end:status.OnlineReportResp)
+          return target;
+        }
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::size_t OnlineReportResp::ByteSizeLong(const MessageLite& base) {
+          const OnlineReportResp& this_ = static_cast<const OnlineReportResp&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::size_t OnlineReportResp::ByteSizeLong() const {
+          const OnlineReportResp& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(message_byte_size_start:status.OnlineReportResp)
+          ::size_t total_size = 0;
+
+          ::uint32_t cached_has_bits = 0;
+          // Prevent compiler warnings about cached_has_bits being unused
+          (void)cached_has_bits;
+
+           {
+            // int32 error = 1;
+            if (this_._internal_error() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+                  this_._internal_error());
+            }
+          }
+          return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                                     &this_._impl_._cached_size_);
+        }
+
+void OnlineReportResp::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+  auto* const _this = static_cast<OnlineReportResp*>(&to_msg);
+  auto& from = static_cast<const OnlineReportResp&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:status.OnlineReportResp)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_error() != 0) {
+    _this->_impl_.error_ = from._impl_.error_;
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void OnlineReportResp::CopyFrom(const OnlineReportResp& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:status.OnlineReportResp)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void OnlineReportResp::InternalSwap(OnlineReportResp* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+        swap(_impl_.error_, other->_impl_.error_);
+}
+
+::google::protobuf::Metadata OnlineReportResp::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class OfflineReportReq::_Internal {
+ public:
+};
+
+OfflineReportReq::OfflineReportReq(::google::protobuf::Arena* arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:status.OfflineReportReq)
+}
+inline PROTOBUF_NDEBUG_INLINE OfflineReportReq::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from, const ::status::OfflineReportReq& from_msg)
+      : uid_(arena, from.uid_),
+        server_name_(arena, from.server_name_),
+        _cached_size_{0} {}
+
+OfflineReportReq::OfflineReportReq(
+    ::google::protobuf::Arena* arena,
+    const OfflineReportReq& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  OfflineReportReq* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+
+  // @@protoc_insertion_point(copy_constructor:status.OfflineReportReq)
+}
+inline PROTOBUF_NDEBUG_INLINE OfflineReportReq::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : uid_(arena),
+        server_name_(arena),
+        _cached_size_{0} {}
+
+inline void OfflineReportReq::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+OfflineReportReq::~OfflineReportReq() {
+  // @@protoc_insertion_point(destructor:status.OfflineReportReq)
+  SharedDtor(*this);
+}
+inline void OfflineReportReq::SharedDtor(MessageLite& self) {
+  OfflineReportReq& this_ = static_cast<OfflineReportReq&>(self);
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.uid_.Destroy();
+  this_._impl_.server_name_.Destroy();
+  this_._impl_.~Impl_();
+}
+
+inline void* OfflineReportReq::PlacementNew_(const void*, void* mem,
+                                        ::google::protobuf::Arena* arena) {
+  return ::new (mem) OfflineReportReq(arena);
+}
+constexpr auto OfflineReportReq::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(OfflineReportReq),
+                                            alignof(OfflineReportReq));
+}
+PROTOBUF_CONSTINIT
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::google::protobuf::internal::ClassDataFull OfflineReportReq::_class_data_ = {
+    ::google::protobuf::internal::ClassData{
+        &_OfflineReportReq_default_instance_._instance,
+        &_table_.header,
+        nullptr,  // OnDemandRegisterArenaDtor
+        nullptr,  // IsInitialized
+        &OfflineReportReq::MergeImpl,
+        ::google::protobuf::Message::GetNewImpl<OfflineReportReq>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        &OfflineReportReq::SharedDtor,
+        ::google::protobuf::Message::GetClearImpl<OfflineReportReq>(), &OfflineReportReq::ByteSizeLong,
+            &OfflineReportReq::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+        PROTOBUF_FIELD_OFFSET(OfflineReportReq, _impl_._cached_size_),
+        false,
+    },
+    &OfflineReportReq::kDescriptorMethods,
+    &descriptor_table_status_2eproto,
+    nullptr,  // tracker
+};
+const ::google::protobuf::internal::ClassData* OfflineReportReq::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
+  return _class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<1, 2, 0, 46, 2> OfflineReportReq::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    2, 8,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967292,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    2,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    _class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::status::OfflineReportReq>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    // string server_name = 2;
+    {::_pbi::TcParser::FastUS1,
+     {18, 63, 0, PROTOBUF_FIELD_OFFSET(OfflineReportReq, _impl_.server_name_)}},
+    // string uid = 1;
+    {::_pbi::TcParser::FastUS1,
+     {10, 63, 0, PROTOBUF_FIELD_OFFSET(OfflineReportReq, _impl_.uid_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // string uid = 1;
+    {PROTOBUF_FIELD_OFFSET(OfflineReportReq, _impl_.uid_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // string server_name = 2;
+    {PROTOBUF_FIELD_OFFSET(OfflineReportReq, _impl_.server_name_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+  }},
+  // no aux_entries
+  {{
+    "\27\3\13\0\0\0\0\0"
+    "status.OfflineReportReq"
+    "uid"
+    "server_name"
+  }},
+};
+
+PROTOBUF_NOINLINE void OfflineReportReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:status.OfflineReportReq)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.uid_.ClearToEmpty();
+  _impl_.server_name_.ClearToEmpty();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::uint8_t* OfflineReportReq::_InternalSerialize(
+            const MessageLite& base, ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) {
+          const OfflineReportReq& this_ = static_cast<const OfflineReportReq&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::uint8_t* OfflineReportReq::_InternalSerialize(
+            ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+          const OfflineReportReq& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(serialize_to_array_start:status.OfflineReportReq)
+          ::uint32_t cached_has_bits = 0;
+          (void)cached_has_bits;
+
+          // string uid = 1;
+          if (!this_._internal_uid().empty()) {
+            const std::string& _s = this_._internal_uid();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "status.OfflineReportReq.uid");
+            target = stream->WriteStringMaybeAliased(1, _s, target);
+          }
+
+          // string server_name = 2;
+          if (!this_._internal_server_name().empty()) {
+            const std::string& _s = this_._internal_server_name();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "status.OfflineReportReq.server_name");
+            target = stream->WriteStringMaybeAliased(2, _s, target);
+          }
+
+          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+            target =
+                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+          }
+          // @@protoc_insertion_point(serialize_to_array_end:status.OfflineReportReq)
+          return target;
+        }
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::size_t OfflineReportReq::ByteSizeLong(const MessageLite& base) {
+          const OfflineReportReq& this_ = static_cast<const OfflineReportReq&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::size_t OfflineReportReq::ByteSizeLong() const {
+          const OfflineReportReq& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(message_byte_size_start:status.OfflineReportReq)
+          ::size_t total_size = 0;
+
+          ::uint32_t cached_has_bits = 0;
+          // Prevent compiler warnings about cached_has_bits being unused
+          (void)cached_has_bits;
+
+          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+           {
+            // string uid = 1;
+            if (!this_._internal_uid().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_uid());
+            }
+            // string server_name = 2;
+            if (!this_._internal_server_name().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_server_name());
+            }
+          }
+          return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                                     &this_._impl_._cached_size_);
+        }
+
+void OfflineReportReq::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+  auto* const _this = static_cast<OfflineReportReq*>(&to_msg);
+  auto& from = static_cast<const OfflineReportReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:status.OfflineReportReq)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_uid().empty()) {
+    _this->_internal_set_uid(from._internal_uid());
+  }
+  if (!from._internal_server_name().empty()) {
+    _this->_internal_set_server_name(from._internal_server_name());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void OfflineReportReq::CopyFrom(const OfflineReportReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:status.OfflineReportReq)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void OfflineReportReq::InternalSwap(OfflineReportReq* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.uid_, &other->_impl_.uid_, arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.server_name_, &other->_impl_.server_name_, arena);
+}
+
+::google::protobuf::Metadata OfflineReportReq::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class OfflineReportResp::_Internal {
+ public:
+};
+
+OfflineReportResp::OfflineReportResp(::google::protobuf::Arena* arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:status.OfflineReportResp)
+}
+OfflineReportResp::OfflineReportResp(
+    ::google::protobuf::Arena* arena, const OfflineReportResp& from)
+    : OfflineReportResp(arena) {
+  MergeFrom(from);
+}
+inline PROTOBUF_NDEBUG_INLINE OfflineReportResp::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0} {}
+
+inline void OfflineReportResp::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.error_ = {};
+}
+OfflineReportResp::~OfflineReportResp() {
+  // @@protoc_insertion_point(destructor:status.OfflineReportResp)
+  SharedDtor(*this);
+}
+inline void OfflineReportResp::SharedDtor(MessageLite& self) {
+  OfflineReportResp& this_ = static_cast<OfflineReportResp&>(self);
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.~Impl_();
+}
+
+inline void* OfflineReportResp::PlacementNew_(const void*, void* mem,
+                                        ::google::protobuf::Arena* arena) {
+  return ::new (mem) OfflineReportResp(arena);
+}
+constexpr auto OfflineReportResp::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(OfflineReportResp),
+                                            alignof(OfflineReportResp));
+}
+PROTOBUF_CONSTINIT
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::google::protobuf::internal::ClassDataFull OfflineReportResp::_class_data_ = {
+    ::google::protobuf::internal::ClassData{
+        &_OfflineReportResp_default_instance_._instance,
+        &_table_.header,
+        nullptr,  // OnDemandRegisterArenaDtor
+        nullptr,  // IsInitialized
+        &OfflineReportResp::MergeImpl,
+        ::google::protobuf::Message::GetNewImpl<OfflineReportResp>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        &OfflineReportResp::SharedDtor,
+        ::google::protobuf::Message::GetClearImpl<OfflineReportResp>(), &OfflineReportResp::ByteSizeLong,
+            &OfflineReportResp::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+        PROTOBUF_FIELD_OFFSET(OfflineReportResp, _impl_._cached_size_),
+        false,
+    },
+    &OfflineReportResp::kDescriptorMethods,
+    &descriptor_table_status_2eproto,
+    nullptr,  // tracker
+};
+const ::google::protobuf::internal::ClassData* OfflineReportResp::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
+  return _class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 0, 0, 2> OfflineReportResp::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    1, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967294,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    _class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::status::OfflineReportResp>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    // int32 error = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(OfflineReportResp, _impl_.error_), 63>(),
+     {8, 63, 0, PROTOBUF_FIELD_OFFSET(OfflineReportResp, _impl_.error_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // int32 error = 1;
+    {PROTOBUF_FIELD_OFFSET(OfflineReportResp, _impl_.error_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+  }},
+  // no aux_entries
+  {{
+  }},
+};
+
+PROTOBUF_NOINLINE void OfflineReportResp::Clear() {
+// @@protoc_insertion_point(message_clear_start:status.OfflineReportResp)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.error_ = 0;
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::uint8_t* OfflineReportResp::_InternalSerialize(
+            const MessageLite& base, ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) {
+          const OfflineReportResp& this_ = static_cast<const OfflineReportResp&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::uint8_t* OfflineReportResp::_InternalSerialize(
+            ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+          const OfflineReportResp& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(serialize_to_array_start:status.OfflineReportResp)
+          ::uint32_t cached_has_bits = 0;
+          (void)cached_has_bits;
+
+          // int32 error = 1;
+          if (this_._internal_error() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt32ToArrayWithField<1>(
+                    stream, this_._internal_error(), target);
+          }
+
+          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+            target =
+                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+          }
+          // @@protoc_insertion_point(serialize_to_array_end:status.OfflineReportResp)
+          return target;
+        }
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::size_t OfflineReportResp::ByteSizeLong(const MessageLite& base) {
+          const OfflineReportResp& this_ = static_cast<const OfflineReportResp&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::size_t OfflineReportResp::ByteSizeLong() const {
+          const OfflineReportResp& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(message_byte_size_start:status.OfflineReportResp)
+          ::size_t total_size = 0;
+
+          ::uint32_t cached_has_bits = 0;
+          // Prevent compiler warnings about cached_has_bits being unused
+          (void)cached_has_bits;
+
+           {
+            // int32 error = 1;
+            if (this_._internal_error() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+                  this_._internal_error());
+            }
+          }
+          return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                                     &this_._impl_._cached_size_);
+        }
+
+void OfflineReportResp::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+  auto* const _this = static_cast<OfflineReportResp*>(&to_msg);
+  auto& from = static_cast<const OfflineReportResp&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:status.OfflineReportResp)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_error() != 0) {
+    _this->_impl_.error_ = from._impl_.error_;
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void OfflineReportResp::CopyFrom(const OfflineReportResp& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:status.OfflineReportResp)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void OfflineReportResp::InternalSwap(OfflineReportResp* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+        swap(_impl_.error_, other->_impl_.error_);
+}
+
+::google::protobuf::Metadata OfflineReportResp::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class RouteReq::_Internal {
+ public:
+};
+
+RouteReq::RouteReq(::google::protobuf::Arena* arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:status.RouteReq)
+}
+inline PROTOBUF_NDEBUG_INLINE RouteReq::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from, const ::status::RouteReq& from_msg)
+      : uid_(arena, from.uid_),
+        _cached_size_{0} {}
+
+RouteReq::RouteReq(
+    ::google::protobuf::Arena* arena,
+    const RouteReq& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  RouteReq* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+
+  // @@protoc_insertion_point(copy_constructor:status.RouteReq)
+}
+inline PROTOBUF_NDEBUG_INLINE RouteReq::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : uid_(arena),
+        _cached_size_{0} {}
+
+inline void RouteReq::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+RouteReq::~RouteReq() {
+  // @@protoc_insertion_point(destructor:status.RouteReq)
+  SharedDtor(*this);
+}
+inline void RouteReq::SharedDtor(MessageLite& self) {
+  RouteReq& this_ = static_cast<RouteReq&>(self);
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.uid_.Destroy();
+  this_._impl_.~Impl_();
+}
+
+inline void* RouteReq::PlacementNew_(const void*, void* mem,
+                                        ::google::protobuf::Arena* arena) {
+  return ::new (mem) RouteReq(arena);
+}
+constexpr auto RouteReq::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(RouteReq),
+                                            alignof(RouteReq));
+}
+PROTOBUF_CONSTINIT
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::google::protobuf::internal::ClassDataFull RouteReq::_class_data_ = {
+    ::google::protobuf::internal::ClassData{
+        &_RouteReq_default_instance_._instance,
+        &_table_.header,
+        nullptr,  // OnDemandRegisterArenaDtor
+        nullptr,  // IsInitialized
+        &RouteReq::MergeImpl,
+        ::google::protobuf::Message::GetNewImpl<RouteReq>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        &RouteReq::SharedDtor,
+        ::google::protobuf::Message::GetClearImpl<RouteReq>(), &RouteReq::ByteSizeLong,
+            &RouteReq::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+        PROTOBUF_FIELD_OFFSET(RouteReq, _impl_._cached_size_),
+        false,
+    },
+    &RouteReq::kDescriptorMethods,
+    &descriptor_table_status_2eproto,
+    nullptr,  // tracker
+};
+const ::google::protobuf::internal::ClassData* RouteReq::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
+  return _class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 0, 27, 2> RouteReq::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    1, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967294,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    _class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::status::RouteReq>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    // string uid = 1;
+    {::_pbi::TcParser::FastUS1,
+     {10, 63, 0, PROTOBUF_FIELD_OFFSET(RouteReq, _impl_.uid_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // string uid = 1;
+    {PROTOBUF_FIELD_OFFSET(RouteReq, _impl_.uid_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+  }},
+  // no aux_entries
+  {{
+    "\17\3\0\0\0\0\0\0"
+    "status.RouteReq"
+    "uid"
+  }},
+};
+
+PROTOBUF_NOINLINE void RouteReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:status.RouteReq)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.uid_.ClearToEmpty();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::uint8_t* RouteReq::_InternalSerialize(
+            const MessageLite& base, ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) {
+          const RouteReq& this_ = static_cast<const RouteReq&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::uint8_t* RouteReq::_InternalSerialize(
+            ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+          const RouteReq& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(serialize_to_array_start:status.RouteReq)
+          ::uint32_t cached_has_bits = 0;
+          (void)cached_has_bits;
+
+          // string uid = 1;
+          if (!this_._internal_uid().empty()) {
+            const std::string& _s = this_._internal_uid();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "status.RouteReq.uid");
+            target = stream->WriteStringMaybeAliased(1, _s, target);
+          }
+
+          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+            target =
+                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+          }
+          // @@protoc_insertion_point(serialize_to_array_end:status.RouteReq)
+          return target;
+        }
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::size_t RouteReq::ByteSizeLong(const MessageLite& base) {
+          const RouteReq& this_ = static_cast<const RouteReq&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::size_t RouteReq::ByteSizeLong() const {
+          const RouteReq& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(message_byte_size_start:status.RouteReq)
+          ::size_t total_size = 0;
+
+          ::uint32_t cached_has_bits = 0;
+          // Prevent compiler warnings about cached_has_bits being unused
+          (void)cached_has_bits;
+
+           {
+            // string uid = 1;
+            if (!this_._internal_uid().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_uid());
+            }
+          }
+          return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                                     &this_._impl_._cached_size_);
+        }
+
+void RouteReq::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+  auto* const _this = static_cast<RouteReq*>(&to_msg);
+  auto& from = static_cast<const RouteReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:status.RouteReq)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_uid().empty()) {
+    _this->_internal_set_uid(from._internal_uid());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RouteReq::CopyFrom(const RouteReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:status.RouteReq)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void RouteReq::InternalSwap(RouteReq* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.uid_, &other->_impl_.uid_, arena);
+}
+
+::google::protobuf::Metadata RouteReq::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class RouteResp::_Internal {
+ public:
+};
+
+RouteResp::RouteResp(::google::protobuf::Arena* arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:status.RouteResp)
+}
+inline PROTOBUF_NDEBUG_INLINE RouteResp::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from, const ::status::RouteResp& from_msg)
+      : server_name_(arena, from.server_name_),
+        server_host_(arena, from.server_host_),
+        token_(arena, from.token_),
+        _cached_size_{0} {}
+
+RouteResp::RouteResp(
+    ::google::protobuf::Arena* arena,
+    const RouteResp& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  RouteResp* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+  ::memcpy(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, error_),
+           reinterpret_cast<const char *>(&from._impl_) +
+               offsetof(Impl_, error_),
+           offsetof(Impl_, server_port_) -
+               offsetof(Impl_, error_) +
+               sizeof(Impl_::server_port_));
+
+  // @@protoc_insertion_point(copy_constructor:status.RouteResp)
+}
+inline PROTOBUF_NDEBUG_INLINE RouteResp::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : server_name_(arena),
+        server_host_(arena),
+        token_(arena),
+        _cached_size_{0} {}
+
+inline void RouteResp::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, error_),
+           0,
+           offsetof(Impl_, server_port_) -
+               offsetof(Impl_, error_) +
+               sizeof(Impl_::server_port_));
+}
+RouteResp::~RouteResp() {
+  // @@protoc_insertion_point(destructor:status.RouteResp)
+  SharedDtor(*this);
+}
+inline void RouteResp::SharedDtor(MessageLite& self) {
+  RouteResp& this_ = static_cast<RouteResp&>(self);
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.server_name_.Destroy();
+  this_._impl_.server_host_.Destroy();
+  this_._impl_.token_.Destroy();
+  this_._impl_.~Impl_();
+}
+
+inline void* RouteResp::PlacementNew_(const void*, void* mem,
+                                        ::google::protobuf::Arena* arena) {
+  return ::new (mem) RouteResp(arena);
+}
+constexpr auto RouteResp::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(RouteResp),
+                                            alignof(RouteResp));
+}
+PROTOBUF_CONSTINIT
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::google::protobuf::internal::ClassDataFull RouteResp::_class_data_ = {
+    ::google::protobuf::internal::ClassData{
+        &_RouteResp_default_instance_._instance,
+        &_table_.header,
+        nullptr,  // OnDemandRegisterArenaDtor
+        nullptr,  // IsInitialized
+        &RouteResp::MergeImpl,
+        ::google::protobuf::Message::GetNewImpl<RouteResp>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        &RouteResp::SharedDtor,
+        ::google::protobuf::Message::GetClearImpl<RouteResp>(), &RouteResp::ByteSizeLong,
+            &RouteResp::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+        PROTOBUF_FIELD_OFFSET(RouteResp, _impl_._cached_size_),
+        false,
+    },
+    &RouteResp::kDescriptorMethods,
+    &descriptor_table_status_2eproto,
+    nullptr,  // tracker
+};
+const ::google::protobuf::internal::ClassData* RouteResp::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
+  return _class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<3, 7, 0, 52, 2> RouteResp::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    7, 56,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967168,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    7,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    _class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::status::RouteResp>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+    // int32 error = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(RouteResp, _impl_.error_), 63>(),
+     {8, 63, 0, PROTOBUF_FIELD_OFFSET(RouteResp, _impl_.error_)}},
+    // bool online = 2;
+    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(RouteResp, _impl_.online_), 63>(),
+     {16, 63, 0, PROTOBUF_FIELD_OFFSET(RouteResp, _impl_.online_)}},
+    // string server_name = 3;
+    {::_pbi::TcParser::FastUS1,
+     {26, 63, 0, PROTOBUF_FIELD_OFFSET(RouteResp, _impl_.server_name_)}},
+    // string server_host = 4;
+    {::_pbi::TcParser::FastUS1,
+     {34, 63, 0, PROTOBUF_FIELD_OFFSET(RouteResp, _impl_.server_host_)}},
+    // int32 server_port = 5;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(RouteResp, _impl_.server_port_), 63>(),
+     {40, 63, 0, PROTOBUF_FIELD_OFFSET(RouteResp, _impl_.server_port_)}},
+    // string token = 6;
+    {::_pbi::TcParser::FastUS1,
+     {50, 63, 0, PROTOBUF_FIELD_OFFSET(RouteResp, _impl_.token_)}},
+    // int64 last_logout = 7;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(RouteResp, _impl_.last_logout_), 63>(),
+     {56, 63, 0, PROTOBUF_FIELD_OFFSET(RouteResp, _impl_.last_logout_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // int32 error = 1;
+    {PROTOBUF_FIELD_OFFSET(RouteResp, _impl_.error_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+    // bool online = 2;
+    {PROTOBUF_FIELD_OFFSET(RouteResp, _impl_.online_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kBool)},
+    // string server_name = 3;
+    {PROTOBUF_FIELD_OFFSET(RouteResp, _impl_.server_name_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // string server_host = 4;
+    {PROTOBUF_FIELD_OFFSET(RouteResp, _impl_.server_host_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // int32 server_port = 5;
+    {PROTOBUF_FIELD_OFFSET(RouteResp, _impl_.server_port_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+    // string token = 6;
+    {PROTOBUF_FIELD_OFFSET(RouteResp, _impl_.token_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // int64 last_logout = 7;
+    {PROTOBUF_FIELD_OFFSET(RouteResp, _impl_.last_logout_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt64)},
+  }},
+  // no aux_entries
+  {{
+    "\20\0\0\13\13\0\5\0"
+    "status.RouteResp"
+    "server_name"
+    "server_host"
+    "token"
+  }},
+};
+
+PROTOBUF_NOINLINE void RouteResp::Clear() {
+// @@protoc_insertion_point(message_clear_start:status.RouteResp)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.server_name_.ClearToEmpty();
+  _impl_.server_host_.ClearToEmpty();
+  _impl_.token_.ClearToEmpty();
+  ::memset(&_impl_.error_, 0, static_cast<::size_t>(
+      reinterpret_cast<char*>(&_impl_.server_port_) -
+      reinterpret_cast<char*>(&_impl_.error_)) + sizeof(_impl_.server_port_));
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::uint8_t* RouteResp::_InternalSerialize(
+            const MessageLite& base, ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) {
+          const RouteResp& this_ = static_cast<const RouteResp&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::uint8_t* RouteResp::_InternalSerialize(
+            ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+          const RouteResp& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(serialize_to_array_start:status.RouteResp)
+          ::uint32_t cached_has_bits = 0;
+          (void)cached_has_bits;
+
+          // int32 error = 1;
+          if (this_._internal_error() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt32ToArrayWithField<1>(
+                    stream, this_._internal_error(), target);
+          }
+
+          // bool online = 2;
+          if (this_._internal_online() != 0) {
+            target = stream->EnsureSpace(target);
+            target = ::_pbi::WireFormatLite::WriteBoolToArray(
+                2, this_._internal_online(), target);
+          }
+
+          // string server_name = 3;
+          if (!this_._internal_server_name().empty()) {
+            const std::string& _s = this_._internal_server_name();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "status.RouteResp.server_name");
+            target = stream->WriteStringMaybeAliased(3, _s, target);
+          }
+
+          // string server_host = 4;
+          if (!this_._internal_server_host().empty()) {
+            const std::string& _s = this_._internal_server_host();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "status.RouteResp.server_host");
+            target = stream->WriteStringMaybeAliased(4, _s, target);
+          }
+
+          // int32 server_port = 5;
+          if (this_._internal_server_port() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt32ToArrayWithField<5>(
+                    stream, this_._internal_server_port(), target);
+          }
+
+          // string token = 6;
+          if (!this_._internal_token().empty()) {
+            const std::string& _s = this_._internal_token();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "status.RouteResp.token");
+            target = stream->WriteStringMaybeAliased(6, _s, target);
+          }
+
+          // int64 last_logout = 7;
+          if (this_._internal_last_logout() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt64ToArrayWithField<7>(
+                    stream, this_._internal_last_logout(), target);
+          }
+
+          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+            target =
+                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+          }
+          // @@protoc_insertion_point(serialize_to_array_end:status.RouteResp)
+          return target;
+        }
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::size_t RouteResp::ByteSizeLong(const MessageLite& base) {
+          const RouteResp& this_ = static_cast<const RouteResp&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::size_t RouteResp::ByteSizeLong() const {
+          const RouteResp& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(message_byte_size_start:status.RouteResp)
+          ::size_t total_size = 0;
+
+          ::uint32_t cached_has_bits = 0;
+          // Prevent compiler warnings about cached_has_bits being unused
+          (void)cached_has_bits;
+
+          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+           {
+            // string server_name = 3;
+            if (!this_._internal_server_name().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_server_name());
+            }
+            // string server_host = 4;
+            if (!this_._internal_server_host().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_server_host());
+            }
+            // string token = 6;
+            if (!this_._internal_token().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_token());
+            }
+            // int32 error = 1;
+            if (this_._internal_error() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+                  this_._internal_error());
+            }
+            // bool online = 2;
+            if (this_._internal_online() != 0) {
+              total_size += 2;
+            }
+            // int64 last_logout = 7;
+            if (this_._internal_last_logout() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(
+                  this_._internal_last_logout());
+            }
+            // int32 server_port = 5;
+            if (this_._internal_server_port() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+                  this_._internal_server_port());
+            }
+          }
+          return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                                     &this_._impl_._cached_size_);
+        }
+
+void RouteResp::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+  auto* const _this = static_cast<RouteResp*>(&to_msg);
+  auto& from = static_cast<const RouteResp&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:status.RouteResp)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_server_name().empty()) {
+    _this->_internal_set_server_name(from._internal_server_name());
+  }
+  if (!from._internal_server_host().empty()) {
+    _this->_internal_set_server_host(from._internal_server_host());
+  }
+  if (!from._internal_token().empty()) {
+    _this->_internal_set_token(from._internal_token());
+  }
+  if (from._internal_error() != 0) {
+    _this->_impl_.error_ = from._impl_.error_;
+  }
+  if (from._internal_online() != 0) {
+    _this->_impl_.online_ = from._impl_.online_;
+  }
+  if (from._internal_last_logout() != 0) {
+    _this->_impl_.last_logout_ = from._impl_.last_logout_;
+  }
+  if (from._internal_server_port() != 0) {
+    _this->_impl_.server_port_ = from._impl_.server_port_;
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RouteResp::CopyFrom(const RouteResp& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:status.RouteResp)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void RouteResp::InternalSwap(RouteResp* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.server_name_, &other->_impl_.server_name_, arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.server_host_, &other->_impl_.server_host_, arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.token_, &other->_impl_.token_, arena);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RouteResp, _impl_.server_port_)
+      + sizeof(RouteResp::_impl_.server_port_)
+      - PROTOBUF_FIELD_OFFSET(RouteResp, _impl_.error_)>(
+          reinterpret_cast<char*>(&_impl_.error_),
+          reinterpret_cast<char*>(&other->_impl_.error_));
+}
+
+::google::protobuf::Metadata RouteResp::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class VerifyTokenReq::_Internal {
+ public:
+};
+
+VerifyTokenReq::VerifyTokenReq(::google::protobuf::Arena* arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:status.VerifyTokenReq)
+}
+inline PROTOBUF_NDEBUG_INLINE VerifyTokenReq::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from, const ::status::VerifyTokenReq& from_msg)
+      : uid_(arena, from.uid_),
+        token_(arena, from.token_),
+        server_name_(arena, from.server_name_),
+        _cached_size_{0} {}
+
+VerifyTokenReq::VerifyTokenReq(
+    ::google::protobuf::Arena* arena,
+    const VerifyTokenReq& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  VerifyTokenReq* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+
+  // @@protoc_insertion_point(copy_constructor:status.VerifyTokenReq)
+}
+inline PROTOBUF_NDEBUG_INLINE VerifyTokenReq::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : uid_(arena),
+        token_(arena),
+        server_name_(arena),
+        _cached_size_{0} {}
+
+inline void VerifyTokenReq::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+VerifyTokenReq::~VerifyTokenReq() {
+  // @@protoc_insertion_point(destructor:status.VerifyTokenReq)
+  SharedDtor(*this);
+}
+inline void VerifyTokenReq::SharedDtor(MessageLite& self) {
+  VerifyTokenReq& this_ = static_cast<VerifyTokenReq&>(self);
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.uid_.Destroy();
+  this_._impl_.token_.Destroy();
+  this_._impl_.server_name_.Destroy();
+  this_._impl_.~Impl_();
+}
+
+inline void* VerifyTokenReq::PlacementNew_(const void*, void* mem,
+                                        ::google::protobuf::Arena* arena) {
+  return ::new (mem) VerifyTokenReq(arena);
+}
+constexpr auto VerifyTokenReq::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(VerifyTokenReq),
+                                            alignof(VerifyTokenReq));
+}
+PROTOBUF_CONSTINIT
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::google::protobuf::internal::ClassDataFull VerifyTokenReq::_class_data_ = {
+    ::google::protobuf::internal::ClassData{
+        &_VerifyTokenReq_default_instance_._instance,
+        &_table_.header,
+        nullptr,  // OnDemandRegisterArenaDtor
+        nullptr,  // IsInitialized
+        &VerifyTokenReq::MergeImpl,
+        ::google::protobuf::Message::GetNewImpl<VerifyTokenReq>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        &VerifyTokenReq::SharedDtor,
+        ::google::protobuf::Message::GetClearImpl<VerifyTokenReq>(), &VerifyTokenReq::ByteSizeLong,
+            &VerifyTokenReq::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+        PROTOBUF_FIELD_OFFSET(VerifyTokenReq, _impl_._cached_size_),
+        false,
+    },
+    &VerifyTokenReq::kDescriptorMethods,
+    &descriptor_table_status_2eproto,
+    nullptr,  // tracker
+};
+const ::google::protobuf::internal::ClassData* VerifyTokenReq::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
+  return _class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<2, 3, 0, 49, 2> VerifyTokenReq::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    3, 24,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967288,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    3,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    _class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::status::VerifyTokenReq>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+    // string uid = 1;
+    {::_pbi::TcParser::FastUS1,
+     {10, 63, 0, PROTOBUF_FIELD_OFFSET(VerifyTokenReq, _impl_.uid_)}},
+    // string token = 2;
+    {::_pbi::TcParser::FastUS1,
+     {18, 63, 0, PROTOBUF_FIELD_OFFSET(VerifyTokenReq, _impl_.token_)}},
+    // string server_name = 3;
+    {::_pbi::TcParser::FastUS1,
+     {26, 63, 0, PROTOBUF_FIELD_OFFSET(VerifyTokenReq, _impl_.server_name_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // string uid = 1;
+    {PROTOBUF_FIELD_OFFSET(VerifyTokenReq, _impl_.uid_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // string token = 2;
+    {PROTOBUF_FIELD_OFFSET(VerifyTokenReq, _impl_.token_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // string server_name = 3;
+    {PROTOBUF_FIELD_OFFSET(VerifyTokenReq, _impl_.server_name_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+  }},
+  // no aux_entries
+  {{
+    "\25\3\5\13\0\0\0\0"
+    "status.VerifyTokenReq"
+    "uid"
+    "token"
+    "server_name"
+  }},
+};
+
+PROTOBUF_NOINLINE void VerifyTokenReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:status.VerifyTokenReq)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.uid_.ClearToEmpty();
+  _impl_.token_.ClearToEmpty();
+  _impl_.server_name_.ClearToEmpty();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::uint8_t* VerifyTokenReq::_InternalSerialize(
+            const MessageLite& base, ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) {
+          const VerifyTokenReq& this_ = static_cast<const VerifyTokenReq&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::uint8_t* VerifyTokenReq::_InternalSerialize(
+            ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+          const VerifyTokenReq& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(serialize_to_array_start:status.VerifyTokenReq)
+          ::uint32_t cached_has_bits = 0;
+          (void)cached_has_bits;
+
+          // string uid = 1;
+          if (!this_._internal_uid().empty()) {
+            const std::string& _s = this_._internal_uid();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "status.VerifyTokenReq.uid");
+            target = stream->WriteStringMaybeAliased(1, _s, target);
+          }
+
+          // string token = 2;
+          if (!this_._internal_token().empty()) {
+            const std::string& _s = this_._internal_token();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "status.VerifyTokenReq.token");
+            target = stream->WriteStringMaybeAliased(2, _s, target);
+          }
+
+          // string server_name = 3;
+          if (!this_._internal_server_name().empty()) {
+            const std::string& _s = this_._internal_server_name();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "status.VerifyTokenReq.server_name");
+            target = stream->WriteStringMaybeAliased(3, _s, target);
+          }
+
+          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+            target =
+                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+          }
+          // @@protoc_insertion_point(serialize_to_array_end:status.VerifyTokenReq)
+          return target;
+        }
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::size_t VerifyTokenReq::ByteSizeLong(const MessageLite& base) {
+          const VerifyTokenReq& this_ = static_cast<const VerifyTokenReq&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::size_t VerifyTokenReq::ByteSizeLong() const {
+          const VerifyTokenReq& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(message_byte_size_start:status.VerifyTokenReq)
+          ::size_t total_size = 0;
+
+          ::uint32_t cached_has_bits = 0;
+          // Prevent compiler warnings about cached_has_bits being unused
+          (void)cached_has_bits;
+
+          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+           {
+            // string uid = 1;
+            if (!this_._internal_uid().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_uid());
+            }
+            // string token = 2;
+            if (!this_._internal_token().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_token());
+            }
+            // string server_name = 3;
+            if (!this_._internal_server_name().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_server_name());
+            }
+          }
+          return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                                     &this_._impl_._cached_size_);
+        }
+
+void VerifyTokenReq::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+  auto* const _this = static_cast<VerifyTokenReq*>(&to_msg);
+  auto& from = static_cast<const VerifyTokenReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:status.VerifyTokenReq)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_uid().empty()) {
+    _this->_internal_set_uid(from._internal_uid());
+  }
+  if (!from._internal_token().empty()) {
+    _this->_internal_set_token(from._internal_token());
+  }
+  if (!from._internal_server_name().empty()) {
+    _this->_internal_set_server_name(from._internal_server_name());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void VerifyTokenReq::CopyFrom(const VerifyTokenReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:status.VerifyTokenReq)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void VerifyTokenReq::InternalSwap(VerifyTokenReq* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.uid_, &other->_impl_.uid_, arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.token_, &other->_impl_.token_, arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.server_name_, &other->_impl_.server_name_, arena);
+}
+
+::google::protobuf::Metadata VerifyTokenReq::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class VerifyTokenResp::_Internal {
+ public:
+};
+
+VerifyTokenResp::VerifyTokenResp(::google::protobuf::Arena* arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:status.VerifyTokenResp)
+}
+VerifyTokenResp::VerifyTokenResp(
+    ::google::protobuf::Arena* arena, const VerifyTokenResp& from)
+    : VerifyTokenResp(arena) {
+  MergeFrom(from);
+}
+inline PROTOBUF_NDEBUG_INLINE VerifyTokenResp::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0} {}
+
+inline void VerifyTokenResp::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, error_),
+           0,
+           offsetof(Impl_, expires_at_) -
+               offsetof(Impl_, error_) +
+               sizeof(Impl_::expires_at_));
+}
+VerifyTokenResp::~VerifyTokenResp() {
+  // @@protoc_insertion_point(destructor:status.VerifyTokenResp)
+  SharedDtor(*this);
+}
+inline void VerifyTokenResp::SharedDtor(MessageLite& self) {
+  VerifyTokenResp& this_ = static_cast<VerifyTokenResp&>(self);
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.~Impl_();
+}
+
+inline void* VerifyTokenResp::PlacementNew_(const void*, void* mem,
+                                        ::google::protobuf::Arena* arena) {
+  return ::new (mem) VerifyTokenResp(arena);
+}
+constexpr auto VerifyTokenResp::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(VerifyTokenResp),
+                                            alignof(VerifyTokenResp));
+}
+PROTOBUF_CONSTINIT
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::google::protobuf::internal::ClassDataFull VerifyTokenResp::_class_data_ = {
+    ::google::protobuf::internal::ClassData{
+        &_VerifyTokenResp_default_instance_._instance,
+        &_table_.header,
+        nullptr,  // OnDemandRegisterArenaDtor
+        nullptr,  // IsInitialized
+        &VerifyTokenResp::MergeImpl,
+        ::google::protobuf::Message::GetNewImpl<VerifyTokenResp>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        &VerifyTokenResp::SharedDtor,
+        ::google::protobuf::Message::GetClearImpl<VerifyTokenResp>(), &VerifyTokenResp::ByteSizeLong,
+            &VerifyTokenResp::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+        PROTOBUF_FIELD_OFFSET(VerifyTokenResp, _impl_._cached_size_),
+        false,
+    },
+    &VerifyTokenResp::kDescriptorMethods,
+    &descriptor_table_status_2eproto,
+    nullptr,  // tracker
+};
+const ::google::protobuf::internal::ClassData* VerifyTokenResp::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
+  return _class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<2, 3, 0, 0, 2> VerifyTokenResp::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    3, 24,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967288,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    3,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    _class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::status::VerifyTokenResp>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+    // int32 error = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(VerifyTokenResp, _impl_.error_), 63>(),
+     {8, 63, 0, PROTOBUF_FIELD_OFFSET(VerifyTokenResp, _impl_.error_)}},
+    // bool valid = 2;
+    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(VerifyTokenResp, _impl_.valid_), 63>(),
+     {16, 63, 0, PROTOBUF_FIELD_OFFSET(VerifyTokenResp, _impl_.valid_)}},
+    // int64 expires_at = 3;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(VerifyTokenResp, _impl_.expires_at_), 63>(),
+     {24, 63, 0, PROTOBUF_FIELD_OFFSET(VerifyTokenResp, _impl_.expires_at_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // int32 error = 1;
+    {PROTOBUF_FIELD_OFFSET(VerifyTokenResp, _impl_.error_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+    // bool valid = 2;
+    {PROTOBUF_FIELD_OFFSET(VerifyTokenResp, _impl_.valid_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kBool)},
+    // int64 expires_at = 3;
+    {PROTOBUF_FIELD_OFFSET(VerifyTokenResp, _impl_.expires_at_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt64)},
+  }},
+  // no aux_entries
+  {{
+  }},
+};
+
+PROTOBUF_NOINLINE void VerifyTokenResp::Clear() {
+// @@protoc_insertion_point(message_clear_start:status.VerifyTokenResp)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.error_, 0, static_cast<::size_t>(
+      reinterpret_cast<char*>(&_impl_.expires_at_) -
+      reinterpret_cast<char*>(&_impl_.error_)) + sizeof(_impl_.expires_at_));
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::uint8_t* VerifyTokenResp::_InternalSerialize(
+            const MessageLite& base, ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) {
+          const VerifyTokenResp& this_ = static_cast<const VerifyTokenResp&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::uint8_t* VerifyTokenResp::_InternalSerialize(
+            ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+          const VerifyTokenResp& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(serialize_to_array_start:status.VerifyTokenResp)
+          ::uint32_t cached_has_bits = 0;
+          (void)cached_has_bits;
+
+          // int32 error = 1;
+          if (this_._internal_error() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt32ToArrayWithField<1>(
+                    stream, this_._internal_error(), target);
+          }
+
+          // bool valid = 2;
+          if (this_._internal_valid() != 0) {
+            target = stream->EnsureSpace(target);
+            target = ::_pbi::WireFormatLite::WriteBoolToArray(
+                2, this_._internal_valid(), target);
+          }
+
+          // int64 expires_at = 3;
+          if (this_._internal_expires_at() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt64ToArrayWithField<3>(
+                    stream, this_._internal_expires_at(), target);
+          }
+
+          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+            target =
+                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+          }
+          // @@protoc_insertion_point(serialize_to_array_end:status.VerifyTokenResp)
+          return target;
+        }
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::size_t VerifyTokenResp::ByteSizeLong(const MessageLite& base) {
+          const VerifyTokenResp& this_ = static_cast<const VerifyTokenResp&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::size_t VerifyTokenResp::ByteSizeLong() const {
+          const VerifyTokenResp& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(message_byte_size_start:status.VerifyTokenResp)
+          ::size_t total_size = 0;
+
+          ::uint32_t cached_has_bits = 0;
+          // Prevent compiler warnings about cached_has_bits being unused
+          (void)cached_has_bits;
+
+          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+           {
+            // int32 error = 1;
+            if (this_._internal_error() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+                  this_._internal_error());
+            }
+            // bool valid = 2;
+            if (this_._internal_valid() != 0) {
+              total_size += 2;
+            }
+            // int64 expires_at = 3;
+            if (this_._internal_expires_at() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(
+                  this_._internal_expires_at());
+            }
+          }
+          return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                                     &this_._impl_._cached_size_);
+        }
+
+void VerifyTokenResp::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+  auto* const _this = static_cast<VerifyTokenResp*>(&to_msg);
+  auto& from = static_cast<const VerifyTokenResp&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:status.VerifyTokenResp)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_error() != 0) {
+    _this->_impl_.error_ = from._impl_.error_;
+  }
+  if (from._internal_valid() != 0) {
+    _this->_impl_.valid_ = from._impl_.valid_;
+  }
+  if (from._internal_expires_at() != 0) {
+    _this->_impl_.expires_at_ = from._impl_.expires_at_;
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void VerifyTokenResp::CopyFrom(const VerifyTokenResp& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:status.VerifyTokenResp)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void VerifyTokenResp::InternalSwap(VerifyTokenResp* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(VerifyTokenResp, _impl_.expires_at_)
+      + sizeof(VerifyTokenResp::_impl_.expires_at_)
+      - PROTOBUF_FIELD_OFFSET(VerifyTokenResp, _impl_.error_)>(
+          reinterpret_cast<char*>(&_impl_.error_),
+          reinterpret_cast<char*>(&other->_impl_.error_));
+}
+
+::google::protobuf::Metadata VerifyTokenResp::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class KickUserReq::_Internal {
+ public:
+};
+
+KickUserReq::KickUserReq(::google::protobuf::Arena* arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:status.KickUserReq)
+}
+inline PROTOBUF_NDEBUG_INLINE KickUserReq::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from, const ::status::KickUserReq& from_msg)
+      : uid_(arena, from.uid_),
+        _cached_size_{0} {}
+
+KickUserReq::KickUserReq(
+    ::google::protobuf::Arena* arena,
+    const KickUserReq& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  KickUserReq* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+  _impl_.reason_ = from._impl_.reason_;
+
+  // @@protoc_insertion_point(copy_constructor:status.KickUserReq)
+}
+inline PROTOBUF_NDEBUG_INLINE KickUserReq::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : uid_(arena),
+        _cached_size_{0} {}
+
+inline void KickUserReq::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.reason_ = {};
+}
+KickUserReq::~KickUserReq() {
+  // @@protoc_insertion_point(destructor:status.KickUserReq)
+  SharedDtor(*this);
+}
+inline void KickUserReq::SharedDtor(MessageLite& self) {
+  KickUserReq& this_ = static_cast<KickUserReq&>(self);
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.uid_.Destroy();
+  this_._impl_.~Impl_();
+}
+
+inline void* KickUserReq::PlacementNew_(const void*, void* mem,
+                                        ::google::protobuf::Arena* arena) {
+  return ::new (mem) KickUserReq(arena);
+}
+constexpr auto KickUserReq::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(KickUserReq),
+                                            alignof(KickUserReq));
+}
+PROTOBUF_CONSTINIT
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::google::protobuf::internal::ClassDataFull KickUserReq::_class_data_ = {
+    ::google::protobuf::internal::ClassData{
+        &_KickUserReq_default_instance_._instance,
+        &_table_.header,
+        nullptr,  // OnDemandRegisterArenaDtor
+        nullptr,  // IsInitialized
+        &KickUserReq::MergeImpl,
+        ::google::protobuf::Message::GetNewImpl<KickUserReq>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        &KickUserReq::SharedDtor,
+        ::google::protobuf::Message::GetClearImpl<KickUserReq>(), &KickUserReq::ByteSizeLong,
+            &KickUserReq::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+        PROTOBUF_FIELD_OFFSET(KickUserReq, _impl_._cached_size_),
+        false,
+    },
+    &KickUserReq::kDescriptorMethods,
+    &descriptor_table_status_2eproto,
+    nullptr,  // tracker
+};
+const ::google::protobuf::internal::ClassData* KickUserReq::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
+  return _class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<1, 2, 0, 30, 2> KickUserReq::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    2, 8,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967292,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    2,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    _class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::status::KickUserReq>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    // int32 reason = 2;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(KickUserReq, _impl_.reason_), 63>(),
+     {16, 63, 0, PROTOBUF_FIELD_OFFSET(KickUserReq, _impl_.reason_)}},
+    // string uid = 1;
+    {::_pbi::TcParser::FastUS1,
+     {10, 63, 0, PROTOBUF_FIELD_OFFSET(KickUserReq, _impl_.uid_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // string uid = 1;
+    {PROTOBUF_FIELD_OFFSET(KickUserReq, _impl_.uid_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // int32 reason = 2;
+    {PROTOBUF_FIELD_OFFSET(KickUserReq, _impl_.reason_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+  }},
+  // no aux_entries
+  {{
+    "\22\3\0\0\0\0\0\0"
+    "status.KickUserReq"
+    "uid"
+  }},
+};
+
+PROTOBUF_NOINLINE void KickUserReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:status.KickUserReq)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.uid_.ClearToEmpty();
+  _impl_.reason_ = 0;
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::uint8_t* KickUserReq::_InternalSerialize(
+            const MessageLite& base, ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) {
+          const KickUserReq& this_ = static_cast<const KickUserReq&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::uint8_t* KickUserReq::_InternalSerialize(
+            ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+          const KickUserReq& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(serialize_to_array_start:status.KickUserReq)
+          ::uint32_t cached_has_bits = 0;
+          (void)cached_has_bits;
+
+          // string uid = 1;
+          if (!this_._internal_uid().empty()) {
+            const std::string& _s = this_._internal_uid();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "status.KickUserReq.uid");
+            target = stream->WriteStringMaybeAliased(1, _s, target);
+          }
+
+          // int32 reason = 2;
+          if (this_._internal_reason() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt32ToArrayWithField<2>(
+                    stream, this_._internal_reason(), target);
+          }
+
+          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+            target =
+                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+          }
+          // @@protoc_insertion_point(serialize_to_array_end:status.KickUserReq)
+          return target;
+        }
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::size_t KickUserReq::ByteSizeLong(const MessageLite& base) {
+          const KickUserReq& this_ = static_cast<const KickUserReq&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::size_t KickUserReq::ByteSizeLong() const {
+          const KickUserReq& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(message_byte_size_start:status.KickUserReq)
+          ::size_t total_size = 0;
+
+          ::uint32_t cached_has_bits = 0;
+          // Prevent compiler warnings about cached_has_bits being unused
+          (void)cached_has_bits;
+
+          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+           {
+            // string uid = 1;
+            if (!this_._internal_uid().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_uid());
+            }
+            // int32 reason = 2;
+            if (this_._internal_reason() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+                  this_._internal_reason());
+            }
+          }
+          return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                                     &this_._impl_._cached_size_);
+        }
+
+void KickUserReq::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+  auto* const _this = static_cast<KickUserReq*>(&to_msg);
+  auto& from = static_cast<const KickUserReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:status.KickUserReq)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_uid().empty()) {
+    _this->_internal_set_uid(from._internal_uid());
+  }
+  if (from._internal_reason() != 0) {
+    _this->_impl_.reason_ = from._impl_.reason_;
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void KickUserReq::CopyFrom(const KickUserReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:status.KickUserReq)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void KickUserReq::InternalSwap(KickUserReq* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.uid_, &other->_impl_.uid_, arena);
+        swap(_impl_.reason_, other->_impl_.reason_);
+}
+
+::google::protobuf::Metadata KickUserReq::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class KickUserResp::_Internal {
+ public:
+};
+
+KickUserResp::KickUserResp(::google::protobuf::Arena* arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:status.KickUserResp)
+}
+KickUserResp::KickUserResp(
+    ::google::protobuf::Arena* arena, const KickUserResp& from)
+    : KickUserResp(arena) {
+  MergeFrom(from);
+}
+inline PROTOBUF_NDEBUG_INLINE KickUserResp::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0} {}
+
+inline void KickUserResp::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.error_ = {};
+}
+KickUserResp::~KickUserResp() {
+  // @@protoc_insertion_point(destructor:status.KickUserResp)
+  SharedDtor(*this);
+}
+inline void KickUserResp::SharedDtor(MessageLite& self) {
+  KickUserResp& this_ = static_cast<KickUserResp&>(self);
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.~Impl_();
+}
+
+inline void* KickUserResp::PlacementNew_(const void*, void* mem,
+                                        ::google::protobuf::Arena* arena) {
+  return ::new (mem) KickUserResp(arena);
+}
+constexpr auto KickUserResp::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(KickUserResp),
+                                            alignof(KickUserResp));
+}
+PROTOBUF_CONSTINIT
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::google::protobuf::internal::ClassDataFull KickUserResp::_class_data_ = {
+    ::google::protobuf::internal::ClassData{
+        &_KickUserResp_default_instance_._instance,
+        &_table_.header,
+        nullptr,  // OnDemandRegisterArenaDtor
+        nullptr,  // IsInitialized
+        &KickUserResp::MergeImpl,
+        ::google::protobuf::Message::GetNewImpl<KickUserResp>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        &KickUserResp::SharedDtor,
+        ::google::protobuf::Message::GetClearImpl<KickUserResp>(), &KickUserResp::ByteSizeLong,
+            &KickUserResp::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+        PROTOBUF_FIELD_OFFSET(KickUserResp, _impl_._cached_size_),
+        false,
+    },
+    &KickUserResp::kDescriptorMethods,
+    &descriptor_table_status_2eproto,
+    nullptr,  // tracker
+};
+const ::google::protobuf::internal::ClassData* KickUserResp::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
+  return _class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 0, 0, 2> KickUserResp::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    1, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967294,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    _class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::status::KickUserResp>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    // int32 error = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(KickUserResp, _impl_.error_), 63>(),
+     {8, 63, 0, PROTOBUF_FIELD_OFFSET(KickUserResp, _impl_.error_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // int32 error = 1;
+    {PROTOBUF_FIELD_OFFSET(KickUserResp, _impl_.error_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+  }},
+  // no aux_entries
+  {{
+  }},
+};
+
+PROTOBUF_NOINLINE void KickUserResp::Clear() {
+// @@protoc_insertion_point(message_clear_start:status.KickUserResp)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.error_ = 0;
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::uint8_t* KickUserResp::_InternalSerialize(
+            const MessageLite& base, ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) {
+          const KickUserResp& this_ = static_cast<const KickUserResp&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::uint8_t* KickUserResp::_InternalSerialize(
+            ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+          const KickUserResp& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(serialize_to_array_start:status.KickUserResp)
+          ::uint32_t cached_has_bits = 0;
+          (void)cached_has_bits;
+
+          // int32 error = 1;
+          if (this_._internal_error() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt32ToArrayWithField<1>(
+                    stream, this_._internal_error(), target);
+          }
+
+          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+            target =
+                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+          }
+          // @@protoc_insertion_point(serialize_to_array_end:status.KickUserResp)
+          return target;
+        }
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::size_t KickUserResp::ByteSizeLong(const MessageLite& base) {
+          const KickUserResp& this_ = static_cast<const KickUserResp&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::size_t KickUserResp::ByteSizeLong() const {
+          const KickUserResp& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(message_byte_size_start:status.KickUserResp)
+          ::size_t total_size = 0;
+
+          ::uint32_t cached_has_bits = 0;
+          // Prevent compiler warnings about cached_has_bits being unused
+          (void)cached_has_bits;
+
+           {
+            // int32 error = 1;
+            if (this_._internal_error() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+                  this_._internal_error());
+            }
+          }
+          return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                                     &this_._impl_._cached_size_);
+        }
+
+void KickUserResp::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+  auto* const _this = static_cast<KickUserResp*>(&to_msg);
+  auto& from = static_cast<const KickUserResp&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:status.KickUserResp)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_error() != 0) {
+    _this->_impl_.error_ = from._impl_.error_;
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void KickUserResp::CopyFrom(const KickUserResp& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:status.KickUserResp)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void KickUserResp::InternalSwap(KickUserResp* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+        swap(_impl_.error_, other->_impl_.error_);
+}
+
+::google::protobuf::Metadata KickUserResp::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class GetNodesReq::_Internal {
+ public:
+};
+
+GetNodesReq::GetNodesReq(::google::protobuf::Arena* arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::internal::ZeroFieldsBase(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  // @@protoc_insertion_point(arena_constructor:status.GetNodesReq)
+}
+GetNodesReq::GetNodesReq(
+    ::google::protobuf::Arena* arena,
+    const GetNodesReq& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::internal::ZeroFieldsBase(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::internal::ZeroFieldsBase(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  GetNodesReq* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+
+  // @@protoc_insertion_point(copy_constructor:status.GetNodesReq)
+}
+
+inline void* GetNodesReq::PlacementNew_(const void*, void* mem,
+                                        ::google::protobuf::Arena* arena) {
+  return ::new (mem) GetNodesReq(arena);
+}
+constexpr auto GetNodesReq::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(GetNodesReq),
+                                            alignof(GetNodesReq));
+}
+PROTOBUF_CONSTINIT
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::google::protobuf::internal::ClassDataFull GetNodesReq::_class_data_ = {
+    ::google::protobuf::internal::ClassData{
+        &_GetNodesReq_default_instance_._instance,
+        &_table_.header,
+        nullptr,  // OnDemandRegisterArenaDtor
+        nullptr,  // IsInitialized
+        &GetNodesReq::MergeImpl,
+        ::google::protobuf::internal::ZeroFieldsBase::GetNewImpl<GetNodesReq>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        &GetNodesReq::SharedDtor,
+        ::google::protobuf::internal::ZeroFieldsBase::GetClearImpl<GetNodesReq>(), &GetNodesReq::ByteSizeLong,
+            &GetNodesReq::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+        PROTOBUF_FIELD_OFFSET(GetNodesReq, _impl_._cached_size_),
+        false,
+    },
+    &GetNodesReq::kDescriptorMethods,
+    &descriptor_table_status_2eproto,
+    nullptr,  // tracker
+};
+const ::google::protobuf::internal::ClassData* GetNodesReq::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
+  return _class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 0, 0, 0, 2> GetNodesReq::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    0, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967295,  // skipmap
+    offsetof(decltype(_table_), field_names),  // no field_entries
+    0,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    _class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::status::GetNodesReq>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+  }}, {{
+    65535, 65535
+  }},
+  // no field_entries, or aux_entries
+  {{
+  }},
+};
+
+
+
+
+
+
+
+
+::google::protobuf::Metadata GetNodesReq::GetMetadata() const {
+  return ::google::protobuf::internal::ZeroFieldsBase::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class NodeInfo::_Internal {
+ public:
+};
+
+NodeInfo::NodeInfo(::google::protobuf::Arena* arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:status.NodeInfo)
+}
+inline PROTOBUF_NDEBUG_INLINE NodeInfo::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from, const ::status::NodeInfo& from_msg)
+      : name_(arena, from.name_),
+        server_host_(arena, from.server_host_),
+        _cached_size_{0} {}
+
+NodeInfo::NodeInfo(
+    ::google::protobuf::Arena* arena,
+    const NodeInfo& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  NodeInfo* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+  ::memcpy(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, server_port_),
+           reinterpret_cast<const char *>(&from._impl_) +
+               offsetof(Impl_, server_port_),
+           offsetof(Impl_, cpu_) -
+               offsetof(Impl_, server_port_) +
+               sizeof(Impl_::cpu_));
+
+  // @@protoc_insertion_point(copy_constructor:status.NodeInfo)
+}
+inline PROTOBUF_NDEBUG_INLINE NodeInfo::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : name_(arena),
+        server_host_(arena),
+        _cached_size_{0} {}
+
+inline void NodeInfo::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, server_port_),
+           0,
+           offsetof(Impl_, cpu_) -
+               offsetof(Impl_, server_port_) +
+               sizeof(Impl_::cpu_));
+}
+NodeInfo::~NodeInfo() {
+  // @@protoc_insertion_point(destructor:status.NodeInfo)
+  SharedDtor(*this);
+}
+inline void NodeInfo::SharedDtor(MessageLite& self) {
+  NodeInfo& this_ = static_cast<NodeInfo&>(self);
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.name_.Destroy();
+  this_._impl_.server_host_.Destroy();
+  this_._impl_.~Impl_();
+}
+
+inline void* NodeInfo::PlacementNew_(const void*, void* mem,
+                                        ::google::protobuf::Arena* arena) {
+  return ::new (mem) NodeInfo(arena);
+}
+constexpr auto NodeInfo::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(NodeInfo),
+                                            alignof(NodeInfo));
+}
+PROTOBUF_CONSTINIT
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::google::protobuf::internal::ClassDataFull NodeInfo::_class_data_ = {
+    ::google::protobuf::internal::ClassData{
+        &_NodeInfo_default_instance_._instance,
+        &_table_.header,
+        nullptr,  // OnDemandRegisterArenaDtor
+        nullptr,  // IsInitialized
+        &NodeInfo::MergeImpl,
+        ::google::protobuf::Message::GetNewImpl<NodeInfo>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        &NodeInfo::SharedDtor,
+        ::google::protobuf::Message::GetClearImpl<NodeInfo>(), &NodeInfo::ByteSizeLong,
+            &NodeInfo::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+        PROTOBUF_FIELD_OFFSET(NodeInfo, _impl_._cached_size_),
+        false,
+    },
+    &NodeInfo::kDescriptorMethods,
+    &descriptor_table_status_2eproto,
+    nullptr,  // tracker
+};
+const ::google::protobuf::internal::ClassData* NodeInfo::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
+  return _class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<4, 11, 0, 47, 2> NodeInfo::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    11, 120,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294965248,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    11,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    _class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::status::NodeInfo>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+    // string name = 1;
+    {::_pbi::TcParser::FastUS1,
+     {10, 63, 0, PROTOBUF_FIELD_OFFSET(NodeInfo, _impl_.name_)}},
+    // string server_host = 2;
+    {::_pbi::TcParser::FastUS1,
+     {18, 63, 0, PROTOBUF_FIELD_OFFSET(NodeInfo, _impl_.server_host_)}},
+    // int32 server_port = 3;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(NodeInfo, _impl_.server_port_), 63>(),
+     {24, 63, 0, PROTOBUF_FIELD_OFFSET(NodeInfo, _impl_.server_port_)}},
+    // int32 current_load = 4;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(NodeInfo, _impl_.current_load_), 63>(),
+     {32, 63, 0, PROTOBUF_FIELD_OFFSET(NodeInfo, _impl_.current_load_)}},
+    // int32 capacity = 5;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(NodeInfo, _impl_.capacity_), 63>(),
+     {40, 63, 0, PROTOBUF_FIELD_OFFSET(NodeInfo, _impl_.capacity_)}},
+    // int64 last_heartbeat = 6;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(NodeInfo, _impl_.last_heartbeat_), 63>(),
+     {48, 63, 0, PROTOBUF_FIELD_OFFSET(NodeInfo, _impl_.last_heartbeat_)}},
+    // int32 rpc_port = 7;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(NodeInfo, _impl_.rpc_port_), 63>(),
+     {56, 63, 0, PROTOBUF_FIELD_OFFSET(NodeInfo, _impl_.rpc_port_)}},
+    // bool measured = 8;
+    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(NodeInfo, _impl_.measured_), 63>(),
+     {64, 63, 0, PROTOBUF_FIELD_OFFSET(NodeInfo, _impl_.measured_)}},
+    // int32 sessions = 9;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(NodeInfo, _impl_.sessions_), 63>(),
+     {72, 63, 0, PROTOBUF_FIELD_OFFSET(NodeInfo, _impl_.sessions_)}},
+    // int32 queue_depth = 10;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(NodeInfo, _impl_.queue_depth_), 63>(),
+     {80, 63, 0, PROTOBUF_FIELD_OFFSET(NodeInfo, _impl_.queue_depth_)}},
+    // int32 cpu = 11;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(NodeInfo, _impl_.cpu_), 63>(),
+     {88, 63, 0, PROTOBUF_FIELD_OFFSET(NodeInfo, _impl_.cpu_)}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // string name = 1;
+    {PROTOBUF_FIELD_OFFSET(NodeInfo, _impl_.name_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // string server_host = 2;
+    {PROTOBUF_FIELD_OFFSET(NodeInfo, _impl_.server_host_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // int32 server_port = 3;
+    {PROTOBUF_FIELD_OFFSET(NodeInfo, _impl_.server_port_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+    // int32 current_load = 4;
+    {PROTOBUF_FIELD_OFFSET(NodeInfo, _impl_.current_load_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+    // int32 capacity = 5;
+    {PROTOBUF_FIELD_OFFSET(NodeInfo, _impl_.capacity_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+    // int64 last_heartbeat = 6;
+    {PROTOBUF_FIELD_OFFSET(NodeInfo, _impl_.last_heartbeat_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt64)},
+    // int32 rpc_port = 7;
+    {PROTOBUF_FIELD_OFFSET(NodeInfo, _impl_.rpc_port_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+    // bool measured = 8;
+    {PROTOBUF_FIELD_OFFSET(NodeInfo, _impl_.measured_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kBool)},
+    // int32 sessions = 9;
+    {PROTOBUF_FIELD_OFFSET(NodeInfo, _impl_.sessions_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+    // int32 queue_depth = 10;
+    {PROTOBUF_FIELD_OFFSET(NodeInfo, _impl_.queue_depth_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+    // int32 cpu = 11;
+    {PROTOBUF_FIELD_OFFSET(NodeInfo, _impl_.cpu_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+  }},
+  // no aux_entries
+  {{
+    "\17\4\13\0\0\0\0\0\0\0\0\0\0\0\0\0"
+    "status.NodeInfo"
+    "name"
+    "server_host"
+  }},
+};
+
+PROTOBUF_NOINLINE void NodeInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:status.NodeInfo)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.name_.ClearToEmpty();
+  _impl_.server_host_.ClearToEmpty();
+  ::memset(&_impl_.server_port_, 0, static_cast<::size_t>(
+      reinterpret_cast<char*>(&_impl_.cpu_) -
+      reinterpret_cast<char*>(&_impl_.server_port_)) + sizeof(_impl_.cpu_));
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::uint8_t* NodeInfo::_InternalSerialize(
+            const MessageLite& base, ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) {
+          const NodeInfo& this_ = static_cast<const NodeInfo&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::uint8_t* NodeInfo::_InternalSerialize(
+            ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+          const NodeInfo& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(serialize_to_array_start:status.NodeInfo)
+          ::uint32_t cached_has_bits = 0;
+          (void)cached_has_bits;
+
+          // string name = 1;
+          if (!this_._internal_name().empty()) {
+            const std::string& _s = this_._internal_name();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "status.NodeInfo.name");
+            target = stream->WriteStringMaybeAliased(1, _s, target);
+          }
+
+          // string server_host = 2;
+          if (!this_._internal_server_host().empty()) {
+            const std::string& _s = this_._internal_server_host();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "status.NodeInfo.server_host");
+            target = stream->WriteStringMaybeAliased(2, _s, target);
+          }
+
+          // int32 server_port = 3;
+          if (this_._internal_server_port() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt32ToArrayWithField<3>(
+                    stream, this_._internal_server_port(), target);
+          }
+
+          // int32 current_load = 4;
+          if (this_._internal_current_load() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt32ToArrayWithField<4>(
+                    stream, this_._internal_current_load(), target);
+          }
+
+          // int32 capacity = 5;
+          if (this_._internal_capacity() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt32ToArrayWithField<5>(
+                    stream, this_._internal_capacity(), target);
+          }
+
+          // int64 last_heartbeat = 6;
+          if (this_._internal_last_heartbeat() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt64ToArrayWithField<6>(
+                    stream, this_._internal_last_heartbeat(), target);
+          }
+
+          // int32 rpc_port = 7;
+          if (this_._internal_rpc_port() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt32ToArrayWithField<7>(
+                    stream, this_._internal_rpc_port(), target);
+          }
+
+          // bool measured = 8;
+          if (this_._internal_measured() != 0) {
+            target = stream->EnsureSpace(target);
+            target = ::_pbi::WireFormatLite::WriteBoolToArray(
+                8, this_._internal_measured(), target);
+          }
+
+          // int32 sessions = 9;
+          if (this_._internal_sessions() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt32ToArrayWithField<9>(
+                    stream, this_._internal_sessions(), target);
+          }
+
+          // int32 queue_depth = 10;
+          if (this_._internal_queue_depth() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt32ToArrayWithField<10>(
+                    stream, this_._internal_queue_depth(), target);
+          }
+
+          // int32 cpu = 11;
+          if (this_._internal_cpu() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt32ToArrayWithField<11>(
+                    stream, this_._internal_cpu(), target);
+          }
+
+          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+            target =
+                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+          }
+          // @@protoc_insertion_point(serialize_to_array_end:status.NodeInfo)
+          return target;
+        }
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::size_t NodeInfo::ByteSizeLong(const MessageLite& base) {
+          const NodeInfo& this_ = static_cast<const NodeInfo&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::size_t NodeInfo::ByteSizeLong() const {
+          const NodeInfo& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(message_byte_size_start:status.NodeInfo)
+          ::size_t total_size = 0;
+
+          ::uint32_t cached_has_bits = 0;
+          // Prevent compiler warnings about cached_has_bits being unused
+          (void)cached_has_bits;
+
+          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+           {
+            // string name = 1;
+            if (!this_._internal_name().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_name());
+            }
+            // string server_host = 2;
+            if (!this_._internal_server_host().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_server_host());
+            }
+            // int32 server_port = 3;
+            if (this_._internal_server_port() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+                  this_._internal_server_port());
+            }
+            // int32 current_load = 4;
+            if (this_._internal_current_load() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+                  this_._internal_current_load());
+            }
+            // int64 last_heartbeat = 6;
+            if (this_._internal_last_heartbeat() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(
+                  this_._internal_last_heartbeat());
+            }
+            // int32 capacity = 5;
+            if (this_._internal_capacity() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+                  this_._internal_capacity());
+            }
+            // int32 rpc_port = 7;
+            if (this_._internal_rpc_port() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+                  this_._internal_rpc_port());
+            }
+            // bool measured = 8;
+            if (this_._internal_measured() != 0) {
+              total_size += 2;
+            }
+            // int32 sessions = 9;
+            if (this_._internal_sessions() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+                  this_._internal_sessions());
+            }
+            // int32 queue_depth = 10;
+            if (this_._internal_queue_depth() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+                  this_._internal_queue_depth());
+            }
+            // int32 cpu = 11;
+            if (this_._internal_cpu() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+                  this_._internal_cpu());
+            }
+          }
+          return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                                     &this_._impl_._cached_size_);
+        }
+
+void NodeInfo::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+  auto* const _this = static_cast<NodeInfo*>(&to_msg);
+  auto& from = static_cast<const NodeInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:status.NodeInfo)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  if (!from._internal_server_host().empty()) {
+    _this->_internal_set_server_host(from._internal_server_host());
+  }
+  if (from._internal_server_port() != 0) {
+    _this->_impl_.server_port_ = from._impl_.server_port_;
+  }
+  if (from._internal_current_load() != 0) {
+    _this->_impl_.current_load_ = from._impl_.current_load_;
+  }
+  if (from._internal_last_heartbeat() != 0) {
+    _this->_impl_.last_heartbeat_ = from._impl_.last_heartbeat_;
+  }
+  if (from._internal_capacity() != 0) {
+    _this->_impl_.capacity_ = from._impl_.capacity_;
+  }
+  if (from._internal_rpc_port() != 0) {
+    _this->_impl_.rpc_port_ = from._impl_.rpc_port_;
+  }
+  if (from._internal_measured() != 0) {
+    _this->_impl_.measured_ = from._impl_.measured_;
+  }
+  if (from._internal_sessions() != 0) {
+    _this->_impl_.sessions_ = from._impl_.sessions_;
+  }
+  if (from._internal_queue_depth() != 0) {
+    _this->_impl_.queue_depth_ = from._impl_.queue_depth_;
+  }
+  if (from._internal_cpu() != 0) {
+    _this->_impl_.cpu_ = from._impl_.cpu_;
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void NodeInfo::CopyFrom(const NodeInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:status.NodeInfo)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void NodeInfo::InternalSwap(NodeInfo* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.name_, &other->_impl_.name_, arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.server_host_, &other->_impl_.server_host_, arena);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(NodeInfo, _impl_.cpu_)
+      + sizeof(NodeInfo::_impl_.cpu_)
+      - PROTOBUF_FIELD_OFFSET(NodeInfo, _impl_.server_port_)>(
+          reinterpret_cast<char*>(&_impl_.server_port_),
+          reinterpret_cast<char*>(&other->_impl_.server_port_));
+}
+
+::google::protobuf::Metadata NodeInfo::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class GetNodesResp::_Internal {
+ public:
+};
+
+GetNodesResp::GetNodesResp(::google::protobuf::Arena* arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:status.GetNodesResp)
+}
+inline PROTOBUF_NDEBUG_INLINE GetNodesResp::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from, const ::status::GetNodesResp& from_msg)
+      : nodes_{visibility, arena, from.nodes_},
+        _cached_size_{0} {}
+
+GetNodesResp::GetNodesResp(
+    ::google::protobuf::Arena* arena,
+    const GetNodesResp& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  GetNodesResp* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+  _impl_.error_ = from._impl_.error_;
+
+  // @@protoc_insertion_point(copy_constructor:status.GetNodesResp)
+}
+inline PROTOBUF_NDEBUG_INLINE GetNodesResp::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : nodes_{visibility, arena},
+        _cached_size_{0} {}
+
+inline void GetNodesResp::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.error_ = {};
+}
+GetNodesResp::~GetNodesResp() {
+  // @@protoc_insertion_point(destructor:status.GetNodesResp)
+  SharedDtor(*this);
+}
+inline void GetNodesResp::SharedDtor(MessageLite& self) {
+  GetNodesResp& this_ = static_cast<GetNodesResp&>(self);
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.~Impl_();
+}
+
+inline void* GetNodesResp::PlacementNew_(const void*, void* mem,
+                                        ::google::protobuf::Arena* arena) {
+  return ::new (mem) GetNodesResp(arena);
+}
+constexpr auto GetNodesResp::InternalNewImpl_() {
+  constexpr auto arena_bits = ::google::protobuf::internal::EncodePlacementArenaOffsets({
+      PROTOBUF_FIELD_OFFSET(GetNodesResp, _impl_.nodes_) +
+          decltype(GetNodesResp::_impl_.nodes_)::
+              InternalGetArenaOffset(
+                  ::google::protobuf::Message::internal_visibility()),
+  });
+  if (arena_bits.has_value()) {
+    return ::google::protobuf::internal::MessageCreator::ZeroInit(
+        sizeof(GetNodesResp), alignof(GetNodesResp), *arena_bits);
+  } else {
+    return ::google::protobuf::internal::MessageCreator(&GetNodesResp::PlacementNew_,
+                                 sizeof(GetNodesResp),
+                                 alignof(GetNodesResp));
+  }
+}
+PROTOBUF_CONSTINIT
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::google::protobuf::internal::ClassDataFull GetNodesResp::_class_data_ = {
+    ::google::protobuf::internal::ClassData{
+        &_GetNodesResp_default_instance_._instance,
+        &_table_.header,
+        nullptr,  // OnDemandRegisterArenaDtor
+        nullptr,  // IsInitialized
+        &GetNodesResp::MergeImpl,
+        ::google::protobuf::Message::GetNewImpl<GetNodesResp>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        &GetNodesResp::SharedDtor,
+        ::google::protobuf::Message::GetClearImpl<GetNodesResp>(), &GetNodesResp::ByteSizeLong,
+            &GetNodesResp::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+        PROTOBUF_FIELD_OFFSET(GetNodesResp, _impl_._cached_size_),
+        false,
+    },
+    &GetNodesResp::kDescriptorMethods,
+    &descriptor_table_status_2eproto,
+    nullptr,  // tracker
+};
+const ::google::protobuf::internal::ClassData* GetNodesResp::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
+  return _class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<1, 2, 1, 0, 2> GetNodesResp::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    2, 8,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967292,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    2,  // num_field_entries
+    1,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    _class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::status::GetNodesResp>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    // repeated .status.NodeInfo nodes = 2;
+    {::_pbi::TcParser::FastMtR1,
+     {18, 63, 0, PROTOBUF_FIELD_OFFSET(GetNodesResp, _impl_.nodes_)}},
+    // int32 error = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(GetNodesResp, _impl_.error_), 63>(),
+     {8, 63, 0, PROTOBUF_FIELD_OFFSET(GetNodesResp, _impl_.error_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // int32 error = 1;
+    {PROTOBUF_FIELD_OFFSET(GetNodesResp, _impl_.error_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+    // repeated .status.NodeInfo nodes = 2;
+    {PROTOBUF_FIELD_OFFSET(GetNodesResp, _impl_.nodes_), 0, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+  }}, {{
+    {::_pbi::TcParser::GetTable<::status::NodeInfo>()},
+  }}, {{
+  }},
+};
+
+PROTOBUF_NOINLINE void GetNodesResp::Clear() {
+// @@protoc_insertion_point(message_clear_start:status.GetNodesResp)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.nodes_.Clear();
+  _impl_.error_ = 0;
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::uint8_t* GetNodesResp::_InternalSerialize(
+            const MessageLite& base, ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) {
+          const GetNodesResp& this_ = static_cast<const GetNodesResp&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::uint8_t* GetNodesResp::_InternalSerialize(
+            ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+          const GetNodesResp& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(serialize_to_array_start:status.GetNodesResp)
+          ::uint32_t cached_has_bits = 0;
+          (void)cached_has_bits;
+
+          // int32 error = 1;
+          if (this_._internal_error() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt32ToArrayWithField<1>(
+                    stream, this_._internal_error(), target);
+          }
+
+          // repeated .status.NodeInfo nodes = 2;
+          for (unsigned i = 0, n = static_cast<unsigned>(
+                                   this_._internal_nodes_size());
+               i < n; i++) {
+            const auto& repfield = this_._internal_nodes().Get(i);
+            target =
+                ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+                    2, repfield, repfield.GetCachedSize(),
+                    target, stream);
+          }
+
+          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+            target =
+                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+          }
+          // @@protoc_insertion_point(serialize_to_array_end:status.GetNodesResp)
+          return target;
+        }
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::size_t GetNodesResp::ByteSizeLong(const MessageLite& base) {
+          const GetNodesResp& this_ = static_cast<const GetNodesResp&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::size_t GetNodesResp::ByteSizeLong() const {
+          const GetNodesResp& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(message_byte_size_start:status.GetNodesResp)
+          ::size_t total_size = 0;
+
+          ::uint32_t cached_has_bits = 0;
+          // Prevent compiler warnings about cached_has_bits being unused
+          (void)cached_has_bits;
+
+          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+           {
+            // repeated .status.NodeInfo nodes = 2;
+            {
+              total_size += 1UL * this_._internal_nodes_size();
+              for (const auto& msg : this_._internal_nodes()) {
+                total_size += ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+              }
+            }
+          }
+           {
+            // int32 error = 1;
+            if (this_._internal_error() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+                  this_._internal_error());
+            }
+          }
+          return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                                     &this_._impl_._cached_size_);
+        }
+
+void GetNodesResp::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+  auto* const _this = static_cast<GetNodesResp*>(&to_msg);
+  auto& from = static_cast<const GetNodesResp&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:status.GetNodesResp)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_internal_mutable_nodes()->MergeFrom(
+      from._internal_nodes());
+  if (from._internal_error() != 0) {
+    _this->_impl_.error_ = from._impl_.error_;
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void GetNodesResp::CopyFrom(const GetNodesResp& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:status.GetNodesResp)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void GetNodesResp::InternalSwap(GetNodesResp* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.nodes_.InternalSwap(&other->_impl_.nodes_);
+        swap(_impl_.error_, other->_impl_.error_);
+}
+
+::google::protobuf::Metadata GetNodesResp::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace status
+namespace google {
+namespace protobuf {
+}  // namespace protobuf
+}  // namespace google
+// @@protoc_insertion_point(global_scope)
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::std::false_type
+    _static_init2_ PROTOBUF_UNUSED =
+        (::_pbi::AddDescriptors(&descriptor_table_status_2eproto),
+         ::std::false_type{});
+#include "google/protobuf/port_undef.inc"
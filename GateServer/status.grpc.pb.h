@@ -88,6 +88,14 @@ class StatusService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::status::RouteResp>> PrepareAsyncQueryUserRoute(::grpc::ClientContext* context, const ::status::RouteReq& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::status::RouteResp>>(PrepareAsyncQueryUserRouteRaw(context, request, cq));
     }
+    // token check that doesn't need Redis (ChatServer login while Redis is down)
+    virtual ::grpc::Status VerifyToken(::grpc::ClientContext* context, const ::status::VerifyTokenReq& request, ::status::VerifyTokenResp* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::status::VerifyTokenResp>> AsyncVerifyToken(::grpc::ClientContext* context, const ::status::VerifyTokenReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::status::VerifyTokenResp>>(AsyncVerifyTokenRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::status::VerifyTokenResp>> PrepareAsyncVerifyToken(::grpc::ClientContext* context, const ::status::VerifyTokenReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::status::VerifyTokenResp>>(PrepareAsyncVerifyTokenRaw(context, request, cq));
+    }
     // kick user if already online
     virtual ::grpc::Status KickUser(::grpc::ClientContext* context, const ::status::KickUserReq& request, ::status::KickUserResp* response) = 0;
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::status::KickUserResp>> AsyncKickUser(::grpc::ClientContext* context, const ::status::KickUserReq& request, ::grpc::CompletionQueue* cq) {
@@ -124,6 +132,9 @@ class StatusService final {
       virtual void ReportOffline(::grpc::ClientContext* context, const ::status::OfflineReportReq* request, ::status::OfflineReportResp* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       virtual void QueryUserRoute(::grpc::ClientContext* context, const ::status::RouteReq* request, ::status::RouteResp* response, std::function<void(::grpc::Status)>) = 0;
       virtual void QueryUserRoute(::grpc::ClientContext* context, const ::status::RouteReq* request, ::status::RouteResp* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // token check that doesn't need Redis (ChatServer login while Redis is down)
+      virtual void VerifyToken(::grpc::ClientContext* context, const ::status::VerifyTokenReq* request, ::status::VerifyTokenResp* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void VerifyToken(::grpc::ClientContext* context, const ::status::VerifyTokenReq* request, ::status::VerifyTokenResp* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       // kick user if already online
       virtual void KickUser(::grpc::ClientContext* context, const ::status::KickUserReq* request, ::status::KickUserResp* response, std::function<void(::grpc::Status)>) = 0;
       virtual void KickUser(::grpc::ClientContext* context, const ::status::KickUserReq* request, ::status::KickUserResp* response, ::grpc::ClientUnaryReactor* reactor) = 0;
@@ -149,6 +160,8 @@ class StatusService final {
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::status::OfflineReportResp>* PrepareAsyncReportOfflineRaw(::grpc::ClientContext* context, const ::status::OfflineReportReq& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::status::RouteResp>* AsyncQueryUserRouteRaw(::grpc::ClientContext* context, const ::status::RouteReq& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::status::RouteResp>* PrepareAsyncQueryUserRouteRaw(::grpc::ClientContext* context, const ::status::RouteReq& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::status::VerifyTokenResp>* AsyncVerifyTokenRaw(::grpc::ClientContext* context, const ::status::VerifyTokenReq& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::status::VerifyTokenResp>* PrepareAsyncVerifyTokenRaw(::grpc::ClientContext* context, const ::status::VerifyTokenReq& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::status::KickUserResp>* AsyncKickUserRaw(::grpc::ClientContext* context, const ::status::KickUserReq& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::status::KickUserResp>* PrepareAsyncKickUserRaw(::grpc::ClientContext* context, const ::status::KickUserReq& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::status::GetNodesResp>* AsyncGetNodesRaw(::grpc::ClientContext* context, const ::status::GetNodesReq& request, ::grpc::CompletionQueue* cq) = 0;
@@ -206,6 +219,13 @@ class StatusService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::status::RouteResp>> PrepareAsyncQueryUserRoute(::grpc::ClientContext* context, const ::status::RouteReq& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::status::RouteResp>>(PrepareAsyncQueryUserRouteRaw(context, request, cq));
     }
+    ::grpc::Status VerifyToken(::grpc::ClientContext* context, const ::status::VerifyTokenReq& request, ::status::VerifyTokenResp* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::status::VerifyTokenResp>> AsyncVerifyToken(::grpc::ClientContext* context, const ::status::VerifyTokenReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::status::VerifyTokenResp>>(AsyncVerifyTokenRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::status::VerifyTokenResp>> PrepareAsyncVerifyToken(::grpc::ClientContext* context, const ::status::VerifyTokenReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::status::VerifyTokenResp>>(PrepareAsyncVerifyTokenRaw(context, request, cq));
+    }
     ::grpc::Status KickUser(::grpc::ClientContext* context, const ::status::KickUserReq& request, ::status::KickUserResp* response) override;
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::status::KickUserResp>> AsyncKickUser(::grpc::ClientContext* context, const ::status::KickUserReq& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::status::KickUserResp>>(AsyncKickUserRaw(context, request, cq));
@@ -237,6 +257,8 @@ class StatusService final {
       void ReportOffline(::grpc::ClientContext* context, const ::status::OfflineReportReq* request, ::status::OfflineReportResp* response, ::grpc::ClientUnaryReactor* reactor) override;
       void QueryUserRoute(::grpc::ClientContext* context, const ::status::RouteReq* request, ::status::RouteResp* response, std::function<void(::grpc::Status)>) override;
       void QueryUserRoute(::grpc::ClientContext* context, const ::status::RouteReq* request, ::status::RouteResp* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void VerifyToken(::grpc::ClientContext* context, const ::status::VerifyTokenReq* request, ::status::VerifyTokenResp* response, std::function<void(::grpc::Status)>) override;
+      void VerifyToken(::grpc::ClientContext* context, const ::status::VerifyTokenReq* request, ::status::VerifyTokenResp* response, ::grpc::ClientUnaryReactor* reactor) override;
       void KickUser(::grpc::ClientContext* context, const ::status::KickUserReq* request, ::status::KickUserResp* response, std::function<void(::grpc::Status)>) override;
       void KickUser(::grpc::ClientContext* context, const ::status::KickUserReq* request, ::status::KickUserResp* response, ::grpc::ClientUnaryReactor* reactor) override;
       void GetNodes(::grpc::ClientContext* context, const ::status::GetNodesReq* request, ::status::GetNodesResp* response, std::function<void(::grpc::Status)>) override;
@@ -266,6 +288,8 @@ class StatusService final {
     ::grpc::ClientAsyncResponseReader< ::status::OfflineReportResp>* PrepareAsyncReportOfflineRaw(::grpc::ClientContext* context, const ::status::OfflineReportReq& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::status::RouteResp>* AsyncQueryUserRouteRaw(::grpc::ClientContext* context, const ::status::RouteReq& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::status::RouteResp>* PrepareAsyncQueryUserRouteRaw(::grpc::ClientContext* context, const ::status::RouteReq& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::status::VerifyTokenResp>* AsyncVerifyTokenRaw(::grpc::ClientContext* context, const ::status::VerifyTokenReq& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::status::VerifyTokenResp>* PrepareAsyncVerifyTokenRaw(::grpc::ClientContext* context, const ::status::VerifyTokenReq& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::status::KickUserResp>* AsyncKickUserRaw(::grpc::ClientContext* context, const ::status::KickUserReq& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::status::KickUserResp>* PrepareAsyncKickUserRaw(::grpc::ClientContext* context, const ::status::KickUserReq& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::status::GetNodesResp>* AsyncGetNodesRaw(::grpc::ClientContext* context, const ::status::GetNodesReq& request, ::grpc::CompletionQueue* cq) override;
@@ -277,6 +301,7 @@ class StatusService final {
     const ::grpc::internal::RpcMethod rpcmethod_ReportOnline_;
     const ::grpc::internal::RpcMethod rpcmethod_ReportOffline_;
     const ::grpc::internal::RpcMethod rpcmethod_QueryUserRoute_;
+    const ::grpc::internal::RpcMethod rpcmethod_VerifyToken_;
     const ::grpc::internal::RpcMethod rpcmethod_KickUser_;
     const ::grpc::internal::RpcMethod rpcmethod_GetNodes_;
   };
@@ -296,6 +321,8 @@ class StatusService final {
     virtual ::grpc::Status ReportOnline(::grpc::ServerContext* context, const ::status::OnlineReportReq* request, ::status::OnlineReportResp* response);
     virtual ::grpc::Status ReportOffline(::grpc::ServerContext* context, const ::status::OfflineReportReq* request, ::status::OfflineReportResp* response);
     virtual ::grpc::Status QueryUserRoute(::grpc::ServerContext* context, const ::status::RouteReq* request, ::status::RouteResp* response);
+    // token check that doesn't need Redis (ChatServer login while Redis is down)
+    virtual ::grpc::Status VerifyToken(::grpc::ServerContext* context, const ::status::VerifyTokenReq* request, ::status::VerifyTokenResp* response);
     // kick user if already online
     virtual ::grpc::Status KickUser(::grpc::ServerContext* context, const ::status::KickUserReq* request, ::status::KickUserResp* response);
     // admin
@@ -442,12 +469,32 @@ class StatusService final {
     }
   };
   template <class BaseClass>
+  class WithAsyncMethod_VerifyToken : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_VerifyToken() {
+      ::grpc::Service::MarkMethodAsync(7);
+    }
+    ~WithAsyncMethod_VerifyToken() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status VerifyToken(::grpc::ServerContext* /*context*/, const ::status::VerifyTokenReq* /*request*/, ::status::VerifyTokenResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestVerifyToken(::grpc::ServerContext* context, ::status::VerifyTokenReq* request, ::grpc::ServerAsyncResponseWriter< ::status::VerifyTokenResp>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(7, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
   class WithAsyncMethod_KickUser : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_KickUser() {
-      ::grpc::Service::MarkMethodAsync(7);
+      ::grpc::Service::MarkMethodAsync(8);
     }
     ~WithAsyncMethod_KickUser() override {
       BaseClassMustBeDerivedFromService(this);
@@ -458,7 +505,7 @@ class StatusService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestKickUser(::grpc::ServerContext* context, ::status::KickUserReq* request, ::grpc::ServerAsyncResponseWriter< ::status::KickUserResp>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(7, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(8, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -467,7 +514,7 @@ class StatusService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_GetNodes() {
-      ::grpc::Service::MarkMethodAsync(8);
+      ::grpc::Service::MarkMethodAsync(9);
     }
     ~WithAsyncMethod_GetNodes() override {
       BaseClassMustBeDerivedFromService(this);
@@ -478,10 +525,10 @@ class StatusService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestGetNodes(::grpc::ServerContext* context, ::status::GetNodesReq* request, ::grpc::ServerAsyncResponseWriter< ::status::GetNodesResp>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(8, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(9, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
-  typedef WithAsyncMethod_RegisterNode<WithAsyncMethod_DeregisterNode<WithAsyncMethod_Heartbeat<WithAsyncMethod_AllocateServer<WithAsyncMethod_ReportOnline<WithAsyncMethod_ReportOffline<WithAsyncMethod_QueryUserRoute<WithAsyncMethod_KickUser<WithAsyncMethod_GetNodes<Service > > > > > > > > > AsyncService;
+  typedef WithAsyncMethod_RegisterNode<WithAsyncMethod_DeregisterNode<WithAsyncMethod_Heartbeat<WithAsyncMethod_AllocateServer<WithAsyncMethod_ReportOnline<WithAsyncMethod_ReportOffline<WithAsyncMethod_QueryUserRoute<WithAsyncMethod_VerifyToken<WithAsyncMethod_KickUser<WithAsyncMethod_GetNodes<Service > > > > > > > > > > AsyncService;
   template <class BaseClass>
   class WithCallbackMethod_RegisterNode : public BaseClass {
    private:
@@ -672,18 +719,45 @@ class StatusService final {
       ::grpc::CallbackServerContext* /*context*/, const ::status::RouteReq* /*request*/, ::status::RouteResp* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithCallbackMethod_VerifyToken : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_VerifyToken() {
+      ::grpc::Service::MarkMethodCallback(7,
+          new ::grpc::internal::CallbackUnaryHandler< ::status::VerifyTokenReq, ::status::VerifyTokenResp>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::status::VerifyTokenReq* request, ::status::VerifyTokenResp* response) { return this->VerifyToken(context, request, response); }));}
+    void SetMessageAllocatorFor_VerifyToken(
+        ::grpc::MessageAllocator< ::status::VerifyTokenReq, ::status::VerifyTokenResp>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(7);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::status::VerifyTokenReq, ::status::VerifyTokenResp>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_VerifyToken() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status VerifyToken(::grpc::ServerContext* /*context*/, const ::status::VerifyTokenReq* /*request*/, ::status::VerifyTokenResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* VerifyToken(
+      ::grpc::CallbackServerContext* /*context*/, const ::status::VerifyTokenReq* /*request*/, ::status::VerifyTokenResp* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
   class WithCallbackMethod_KickUser : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_KickUser() {
-      ::grpc::Service::MarkMethodCallback(7,
+      ::grpc::Service::MarkMethodCallback(8,
           new ::grpc::internal::CallbackUnaryHandler< ::status::KickUserReq, ::status::KickUserResp>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::status::KickUserReq* request, ::status::KickUserResp* response) { return this->KickUser(context, request, response); }));}
     void SetMessageAllocatorFor_KickUser(
         ::grpc::MessageAllocator< ::status::KickUserReq, ::status::KickUserResp>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(7);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(8);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::status::KickUserReq, ::status::KickUserResp>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -704,13 +778,13 @@ class StatusService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_GetNodes() {
-      ::grpc::Service::MarkMethodCallback(8,
+      ::grpc::Service::MarkMethodCallback(9,
           new ::grpc::internal::CallbackUnaryHandler< ::status::GetNodesReq, ::status::GetNodesResp>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::status::GetNodesReq* request, ::status::GetNodesResp* response) { return this->GetNodes(context, request, response); }));}
     void SetMessageAllocatorFor_GetNodes(
         ::grpc::MessageAllocator< ::status::GetNodesReq, ::status::GetNodesResp>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(8);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(9);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::status::GetNodesReq, ::status::GetNodesResp>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -725,7 +799,7 @@ class StatusService final {
     virtual ::grpc::ServerUnaryReactor* GetNodes(
       ::grpc::CallbackServerContext* /*context*/, const ::status::GetNodesReq* /*request*/, ::status::GetNodesResp* /*response*/)  { return nullptr; }
   };
-  typedef WithCallbackMethod_RegisterNode<WithCallbackMethod_DeregisterNode<WithCallbackMethod_Heartbeat<WithCallbackMethod_AllocateServer<WithCallbackMethod_ReportOnline<WithCallbackMethod_ReportOffline<WithCallbackMethod_QueryUserRoute<WithCallbackMethod_KickUser<WithCallbackMethod_GetNodes<Service > > > > > > > > > CallbackService;
+  typedef WithCallbackMethod_RegisterNode<WithCallbackMethod_DeregisterNode<WithCallbackMethod_Heartbeat<WithCallbackMethod_AllocateServer<WithCallbackMethod_ReportOnline<WithCallbackMethod_ReportOffline<WithCallbackMethod_QueryUserRoute<WithCallbackMethod_VerifyToken<WithCallbackMethod_KickUser<WithCallbackMethod_GetNodes<Service > > > > > > > > > > CallbackService;
   typedef CallbackService ExperimentalCallbackService;
   template <class BaseClass>
   class WithGenericMethod_RegisterNode : public BaseClass {
@@ -847,12 +921,29 @@ class StatusService final {
     }
   };
   template <class BaseClass>
+  class WithGenericMethod_VerifyToken : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_VerifyToken() {
+      ::grpc::Service::MarkMethodGeneric(7);
+    }
+    ~WithGenericMethod_VerifyToken() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status VerifyToken(::grpc::ServerContext* /*context*/, const ::status::VerifyTokenReq* /*request*/, ::status::VerifyTokenResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
   class WithGenericMethod_KickUser : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_KickUser() {
-      ::grpc::Service::MarkMethodGeneric(7);
+      ::grpc::Service::MarkMethodGeneric(8);
     }
     ~WithGenericMethod_KickUser() override {
       BaseClassMustBeDerivedFromService(this);
@@ -869,7 +960,7 @@ class StatusService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_GetNodes() {
-      ::grpc::Service::MarkMethodGeneric(8);
+      ::grpc::Service::MarkMethodGeneric(9);
     }
     ~WithGenericMethod_GetNodes() override {
       BaseClassMustBeDerivedFromService(this);
@@ -1021,12 +1112,32 @@ class StatusService final {
     }
   };
   template <class BaseClass>
+  class WithRawMethod_VerifyToken : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_VerifyToken() {
+      ::grpc::Service::MarkMethodRaw(7);
+    }
+    ~WithRawMethod_VerifyToken() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status VerifyToken(::grpc::ServerContext* /*context*/, const ::status::VerifyTokenReq* /*request*/, ::status::VerifyTokenResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestVerifyToken(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(7, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
   class WithRawMethod_KickUser : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_KickUser() {
-      ::grpc::Service::MarkMethodRaw(7);
+      ::grpc::Service::MarkMethodRaw(8);
     }
     ~WithRawMethod_KickUser() override {
       BaseClassMustBeDerivedFromService(this);
@@ -1037,7 +1148,7 @@ class StatusService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestKickUser(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(7, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(8, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -1046,7 +1157,7 @@ class StatusService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_GetNodes() {
-      ::grpc::Service::MarkMethodRaw(8);
+      ::grpc::Service::MarkMethodRaw(9);
     }
     ~WithRawMethod_GetNodes() override {
       BaseClassMustBeDerivedFromService(this);
@@ -1057,7 +1168,7 @@ class StatusService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestGetNodes(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(8, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(9, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -1215,12 +1326,34 @@ class StatusService final {
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithRawCallbackMethod_VerifyToken : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_VerifyToken() {
+      ::grpc::Service::MarkMethodRawCallback(7,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->VerifyToken(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_VerifyToken() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status VerifyToken(::grpc::ServerContext* /*context*/, const ::status::VerifyTokenReq* /*request*/, ::status::VerifyTokenResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* VerifyToken(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
   class WithRawCallbackMethod_KickUser : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_KickUser() {
-      ::grpc::Service::MarkMethodRawCallback(7,
+      ::grpc::Service::MarkMethodRawCallback(8,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->KickUser(context, request, response); }));
@@ -1242,7 +1375,7 @@ class StatusService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_GetNodes() {
-      ::grpc::Service::MarkMethodRawCallback(8,
+      ::grpc::Service::MarkMethodRawCallback(9,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->GetNodes(context, request, response); }));
@@ -1448,12 +1581,39 @@ class StatusService final {
     virtual ::grpc::Status StreamedQueryUserRoute(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::status::RouteReq,::status::RouteResp>* server_unary_streamer) = 0;
   };
   template <class BaseClass>
+  class WithStreamedUnaryMethod_VerifyToken : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_VerifyToken() {
+      ::grpc::Service::MarkMethodStreamed(7,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::status::VerifyTokenReq, ::status::VerifyTokenResp>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::status::VerifyTokenReq, ::status::VerifyTokenResp>* streamer) {
+                       return this->StreamedVerifyToken(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_VerifyToken() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status VerifyToken(::grpc::ServerContext* /*context*/, const ::status::VerifyTokenReq* /*request*/, ::status::VerifyTokenResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedVerifyToken(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::status::VerifyTokenReq,::status::VerifyTokenResp>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
   class WithStreamedUnaryMethod_KickUser : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_KickUser() {
-      ::grpc::Service::MarkMethodStreamed(7,
+      ::grpc::Service::MarkMethodStreamed(8,
         new ::grpc::internal::StreamedUnaryHandler<
           ::status::KickUserReq, ::status::KickUserResp>(
             [this](::grpc::ServerContext* context,
@@ -1480,7 +1640,7 @@ class StatusService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_GetNodes() {
-      ::grpc::Service::MarkMethodStreamed(8,
+      ::grpc::Service::MarkMethodStreamed(9,
         new ::grpc::internal::StreamedUnaryHandler<
           ::status::GetNodesReq, ::status::GetNodesResp>(
             [this](::grpc::ServerContext* context,
@@ -1501,9 +1661,9 @@ class StatusService final {
     // replace default version of method with streamed unary
     virtual ::grpc::Status StreamedGetNodes(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::status::GetNodesReq,::status::GetNodesResp>* server_unary_streamer) = 0;
   };
-  typedef WithStreamedUnaryMethod_RegisterNode<WithStreamedUnaryMethod_DeregisterNode<WithStreamedUnaryMethod_Heartbeat<WithStreamedUnaryMethod_AllocateServer<WithStreamedUnaryMethod_ReportOnline<WithStreamedUnaryMethod_ReportOffline<WithStreamedUnaryMethod_QueryUserRoute<WithStreamedUnaryMethod_KickUser<WithStreamedUnaryMethod_GetNodes<Service > > > > > > > > > StreamedUnaryService;
+  typedef WithStreamedUnaryMethod_RegisterNode<WithStreamedUnaryMethod_DeregisterNode<WithStreamedUnaryMethod_Heartbeat<WithStreamedUnaryMethod_AllocateServer<WithStreamedUnaryMethod_ReportOnline<WithStreamedUnaryMethod_ReportOffline<WithStreamedUnaryMethod_QueryUserRoute<WithStreamedUnaryMethod_VerifyToken<WithStreamedUnaryMethod_KickUser<WithStreamedUnaryMethod_GetNodes<Service > > > > > > > > > > StreamedUnaryService;
   typedef Service SplitStreamedService;
-  typedef WithStreamedUnaryMethod_RegisterNode<WithStreamedUnaryMethod_DeregisterNode<WithStreamedUnaryMethod_Heartbeat<WithStreamedUnaryMethod_AllocateServer<WithStreamedUnaryMethod_ReportOnline<WithStreamedUnaryMethod_ReportOffline<WithStreamedUnaryMethod_QueryUserRoute<WithStreamedUnaryMethod_KickUser<WithStreamedUnaryMethod_GetNodes<Service > > > > > > > > > StreamedService;
+  typedef WithStreamedUnaryMethod_RegisterNode<WithStreamedUnaryMethod_DeregisterNode<WithStreamedUnaryMethod_Heartbeat<WithStreamedUnaryMethod_AllocateServer<WithStreamedUnaryMethod_ReportOnline<WithStreamedUnaryMethod_ReportOffline<WithStreamedUnaryMethod_QueryUserRoute<WithStreamedUnaryMethod_VerifyToken<WithStreamedUnaryMethod_KickUser<WithStreamedUnaryMethod_GetNodes<Service > > > > > > > > > > StreamedService;
 };
 
 }  // namespace status
@@ -26,6 +26,66 @@ namespace _pbi = ::google::protobuf::internal;
 namespace _fl = ::google::protobuf::internal::field_layout;
 namespace status {
 
+inline constexpr VerifyTokenResp::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : error_{0},
+        valid_{false},
+        expires_at_{::int64_t{0}},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR VerifyTokenResp::VerifyTokenResp(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct VerifyTokenRespDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR VerifyTokenRespDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~VerifyTokenRespDefaultTypeInternal() {}
+  union {
+    VerifyTokenResp _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 VerifyTokenRespDefaultTypeInternal _VerifyTokenResp_default_instance_;
+
+inline constexpr VerifyTokenReq::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : uid_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        token_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        server_name_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR VerifyTokenReq::VerifyTokenReq(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct VerifyTokenReqDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR VerifyTokenReqDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~VerifyTokenReqDefaultTypeInternal() {}
+  union {
+    VerifyTokenReq _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 VerifyTokenReqDefaultTypeInternal _VerifyTokenReq_default_instance_;
+
 inline constexpr RouteResp::Impl_::Impl_(
     ::_pbi::ConstantInitialized) noexcept
       : server_name_(
@@ -125,6 +185,7 @@ inline constexpr RegisterNodeReq::Impl_::Impl_(
             ::_pbi::ConstantInitialized()),
         server_port_{0},
         capacity_{0},
+        rpc_port_{0},
         _cached_size_{0} {}
 
 template <typename>
@@ -186,6 +247,7 @@ inline constexpr OnlineReportReq::Impl_::Impl_(
         token_(
             &::google::protobuf::internal::fixed_address_empty_string,
             ::_pbi::ConstantInitialized()),
+        generation_{::int64_t{0}},
         server_port_{0},
         _cached_size_{0} {}
 
@@ -239,6 +301,9 @@ inline constexpr OfflineReportReq::Impl_::Impl_(
       : uid_(
             &::google::protobuf::internal::fixed_address_empty_string,
             ::_pbi::ConstantInitialized()),
+        server_name_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
         _cached_size_{0} {}
 
 template <typename>
@@ -273,6 +338,11 @@ inline constexpr NodeInfo::Impl_::Impl_(
         current_load_{0},
         last_heartbeat_{::int64_t{0}},
         capacity_{0},
+        rpc_port_{0},
+        measured_{false},
+        sessions_{0},
+        queue_depth_{0},
+        cpu_{0},
         _cached_size_{0} {}
 
 template <typename>
@@ -382,6 +452,10 @@ inline constexpr HeartbeatReq::Impl_::Impl_(
             &::google::protobuf::internal::fixed_address_empty_string,
             ::_pbi::ConstantInitialized()),
         server_port_{0},
+        measured_{false},
+        sessions_{0},
+        queue_depth_{0},
+        cpu_{0},
         _cached_size_{0} {}
 
 template <typename>
@@ -583,6 +657,7 @@ const ::uint32_t
         PROTOBUF_FIELD_OFFSET(::status::RegisterNodeReq, _impl_.server_host_),
         PROTOBUF_FIELD_OFFSET(::status::RegisterNodeReq, _impl_.server_port_),
         PROTOBUF_FIELD_OFFSET(::status::RegisterNodeReq, _impl_.capacity_),
+        PROTOBUF_FIELD_OFFSET(::status::RegisterNodeReq, _impl_.rpc_port_),
         ~0u,  // no _has_bits_
         PROTOBUF_FIELD_OFFSET(::status::RegisterNodeResp, _internal_metadata_),
         ~0u,  // no _extensions_
@@ -621,6 +696,10 @@ const ::uint32_t
         PROTOBUF_FIELD_OFFSET(::status::HeartbeatReq, _impl_.name_),
         PROTOBUF_FIELD_OFFSET(::status::HeartbeatReq, _impl_.server_host_),
         PROTOBUF_FIELD_OFFSET(::status::HeartbeatReq, _impl_.server_port_),
+        PROTOBUF_FIELD_OFFSET(::status::HeartbeatReq, _impl_.measured_),
+        PROTOBUF_FIELD_OFFSET(::status::HeartbeatReq, _impl_.sessions_),
+        PROTOBUF_FIELD_OFFSET(::status::HeartbeatReq, _impl_.queue_depth_),
+        PROTOBUF_FIELD_OFFSET(::status::HeartbeatReq, _impl_.cpu_),
         ~0u,  // no _has_bits_
         PROTOBUF_FIELD_OFFSET(::status::HeartbeatResp, _internal_metadata_),
         ~0u,  // no _extensions_
@@ -667,6 +746,7 @@ const ::uint32_t
         PROTOBUF_FIELD_OFFSET(::status::OnlineReportReq, _impl_.server_host_),
         PROTOBUF_FIELD_OFFSET(::status::OnlineReportReq, _impl_.server_port_),
         PROTOBUF_FIELD_OFFSET(::status::OnlineReportReq, _impl_.token_),
+        PROTOBUF_FIELD_OFFSET(::status::OnlineReportReq, _impl_.generation_),
         ~0u,  // no _has_bits_
         PROTOBUF_FIELD_OFFSET(::status::OnlineReportResp, _internal_metadata_),
         ~0u,  // no _extensions_
@@ -685,6 +765,7 @@ const ::uint32_t
         ~0u,  // no _split_
         ~0u,  // no sizeof(Split)
         PROTOBUF_FIELD_OFFSET(::status::OfflineReportReq, _impl_.uid_),
+        PROTOBUF_FIELD_OFFSET(::status::OfflineReportReq, _impl_.server_name_),
         ~0u,  // no _has_bits_
         PROTOBUF_FIELD_OFFSET(::status::OfflineReportResp, _internal_metadata_),
         ~0u,  // no _extensions_
@@ -719,6 +800,28 @@ const ::uint32_t
         PROTOBUF_FIELD_OFFSET(::status::RouteResp, _impl_.token_),
         PROTOBUF_FIELD_OFFSET(::status::RouteResp, _impl_.last_logout_),
         ~0u,  // no _has_bits_
+        PROTOBUF_FIELD_OFFSET(::status::VerifyTokenReq, _internal_metadata_),
+        ~0u,  // no _extensions_
+        ~0u,  // no _oneof_case_
+        ~0u,  // no _weak_field_map_
+        ~0u,  // no _inlined_string_donated_
+        ~0u,  // no _split_
+        ~0u,  // no sizeof(Split)
+        PROTOBUF_FIELD_OFFSET(::status::VerifyTokenReq, _impl_.uid_),
+        PROTOBUF_FIELD_OFFSET(::status::VerifyTokenReq, _impl_.token_),
+        PROTOBUF_FIELD_OFFSET(::status::VerifyTokenReq, _impl_.server_name_),
+        ~0u,  // no _has_bits_
+        PROTOBUF_FIELD_OFFSET(::status::VerifyTokenResp, _internal_metadata_),
+        ~0u,  // no _extensions_
+        ~0u,  // no _oneof_case_
+        ~0u,  // no _weak_field_map_
+        ~0u,  // no _inlined_string_donated_
+        ~0u,  // no _split_
+        ~0u,  // no sizeof(Split)
+        PROTOBUF_FIELD_OFFSET(::status::VerifyTokenResp, _impl_.error_),
+        PROTOBUF_FIELD_OFFSET(::status::VerifyTokenResp, _impl_.valid_),
+        PROTOBUF_FIELD_OFFSET(::status::VerifyTokenResp, _impl_.expires_at_),
+        ~0u,  // no _has_bits_
         PROTOBUF_FIELD_OFFSET(::status::KickUserReq, _internal_metadata_),
         ~0u,  // no _extensions_
         ~0u,  // no _oneof_case_
@@ -759,6 +862,11 @@ const ::uint32_t
         PROTOBUF_FIELD_OFFSET(::status::NodeInfo, _impl_.current_load_),
         PROTOBUF_FIELD_OFFSET(::status::NodeInfo, _impl_.capacity_),
         PROTOBUF_FIELD_OFFSET(::status::NodeInfo, _impl_.last_heartbeat_),
+        PROTOBUF_FIELD_OFFSET(::status::NodeInfo, _impl_.rpc_port_),
+        PROTOBUF_FIELD_OFFSET(::status::NodeInfo, _impl_.measured_),
+        PROTOBUF_FIELD_OFFSET(::status::NodeInfo, _impl_.sessions_),
+        PROTOBUF_FIELD_OFFSET(::status::NodeInfo, _impl_.queue_depth_),
+        PROTOBUF_FIELD_OFFSET(::status::NodeInfo, _impl_.cpu_),
         ~0u,  // no _has_bits_
         PROTOBUF_FIELD_OFFSET(::status::GetNodesResp, _internal_metadata_),
         ~0u,  // no _extensions_
@@ -774,24 +882,26 @@ const ::uint32_t
 static const ::_pbi::MigrationSchema
     schemas[] ABSL_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
         {0, -1, -1, sizeof(::status::RegisterNodeReq)},
-        {12, -1, -1, sizeof(::status::RegisterNodeResp)},
-        {21, -1, -1, sizeof(::status::DeregisterNodeReq)},
-        {30, -1, -1, sizeof(::status::DeregisterNodeResp)},
-        {39, -1, -1, sizeof(::status::HeartbeatReq)},
-        {50, -1, -1, sizeof(::status::HeartbeatResp)},
-        {59, -1, -1, sizeof(::status::AllocateServerReq)},
-        {68, -1, -1, sizeof(::status::AllocateServerResp)},
-        {83, -1, -1, sizeof(::status::OnlineReportReq)},
-        {96, -1, -1, sizeof(::status::OnlineReportResp)},
-        {105, -1, -1, sizeof(::status::OfflineReportReq)},
-        {114, -1, -1, sizeof(::status::OfflineReportResp)},
-        {123, -1, -1, sizeof(::status::RouteReq)},
-        {132, -1, -1, sizeof(::status::RouteResp)},
-        {147, -1, -1, sizeof(::status::KickUserReq)},
-        {157, -1, -1, sizeof(::status::KickUserResp)},
-        {166, -1, -1, sizeof(::status::GetNodesReq)},
-        {174, -1, -1, sizeof(::status::NodeInfo)},
-        {188, -1, -1, sizeof(::status::GetNodesResp)},
+        {13, -1, -1, sizeof(::status::RegisterNodeResp)},
+        {22, -1, -1, sizeof(::status::DeregisterNodeReq)},
+        {31, -1, -1, sizeof(::status::DeregisterNodeResp)},
+        {40, -1, -1, sizeof(::status::HeartbeatReq)},
+        {55, -1, -1, sizeof(::status::HeartbeatResp)},
+        {64, -1, -1, sizeof(::status::AllocateServerReq)},
+        {73, -1, -1, sizeof(::status::AllocateServerResp)},
+        {88, -1, -1, sizeof(::status::OnlineReportReq)},
+        {102, -1, -1, sizeof(::status::OnlineReportResp)},
+        {111, -1, -1, sizeof(::status::OfflineReportReq)},
+        {121, -1, -1, sizeof(::status::OfflineReportResp)},
+        {130, -1, -1, sizeof(::status::RouteReq)},
+        {139, -1, -1, sizeof(::status::RouteResp)},
+        {154, -1, -1, sizeof(::status::VerifyTokenReq)},
+        {165, -1, -1, sizeof(::status::VerifyTokenResp)},
+        {176, -1, -1, sizeof(::status::KickUserReq)},
+        {186, -1, -1, sizeof(::status::KickUserResp)},
+        {195, -1, -1, sizeof(::status::GetNodesReq)},
+        {203, -1, -1, sizeof(::status::NodeInfo)},
+        {222, -1, -1, sizeof(::status::GetNodesResp)},
 };
 static const ::_pb::Message* const file_default_instances[] = {
     &::status::_RegisterNodeReq_default_instance_._instance,
@@ -808,6 +918,8 @@ static const ::_pb::Message* const file_default_instances[] = {
     &::status::_OfflineReportResp_default_instance_._instance,
     &::status::_RouteReq_default_instance_._instance,
     &::status::_RouteResp_default_instance_._instance,
+    &::status::_VerifyTokenReq_default_instance_._instance,
+    &::status::_VerifyTokenResp_default_instance_._instance,
     &::status::_KickUserReq_default_instance_._instance,
     &::status::_KickUserResp_default_instance_._instance,
     &::status::_GetNodesReq_default_instance_._instance,
@@ -817,51 +929,61 @@ static const ::_pb::Message* const file_default_instances[] = {
 const char descriptor_table_protodef_status_2eproto[] ABSL_ATTRIBUTE_SECTION_VARIABLE(
     protodesc_cold) = {
     "\n\014status.proto\022\006status\032\037google/protobuf/"
-    "timestamp.proto\"[\n\017RegisterNodeReq\022\014\n\004na"
+    "timestamp.proto\"m\n\017RegisterNodeReq\022\014\n\004na"
     "me\030\001 \001(\t\022\023\n\013server_host\030\002 \001(\t\022\023\n\013server_"
-    "port\030\003 \001(\005\022\020\n\010capacity\030\004 \001(\005\"!\n\020Register"
-    "NodeResp\022\r\n\005error\030\001 \001(\005\"!\n\021DeregisterNod"
-    "eReq\022\014\n\004name\030\001 \001(\t\"#\n\022DeregisterNodeResp"
-    "\022\r\n\005error\030\001 \001(\005\"F\n\014HeartbeatReq\022\014\n\004name\030"
-    "\001 \001(\t\022\023\n\013server_host\030\002 \001(\t\022\023\n\013server_por"
-    "t\030\003 \001(\005\"\036\n\rHeartbeatResp\022\r\n\005error\030\001 \001(\005\""
-    " \n\021AllocateServerReq\022\013\n\003uid\030\001 \001(\t\"\227\001\n\022Al"
-    "locateServerResp\022\r\n\005error\030\001 \001(\005\022\020\n\010assig"
-    "ned\030\002 \001(\010\022\023\n\013server_name\030\003 \001(\t\022\023\n\013server"
-    "_host\030\004 \001(\t\022\023\n\013server_port\030\005 \001(\005\022\r\n\005toke"
-    "n\030\006 \001(\t\022\022\n\nexpires_at\030\007 \001(\003\"l\n\017OnlineRep"
-    "ortReq\022\013\n\003uid\030\001 \001(\t\022\023\n\013server_name\030\002 \001(\t"
-    "\022\023\n\013server_host\030\003 \001(\t\022\023\n\013server_port\030\004 \001"
-    "(\005\022\r\n\005token\030\005 \001(\t\"!\n\020OnlineReportResp\022\r\n"
-    "\005error\030\001 \001(\005\"\037\n\020OfflineReportReq\022\013\n\003uid\030"
-    "\001 \001(\t\"\"\n\021OfflineReportResp\022\r\n\005error\030\001 \001("
-    "\005\"\027\n\010RouteReq\022\013\n\003uid\030\001 \001(\t\"\215\001\n\tRouteResp"
-    "\022\r\n\005error\030\001 \001(\005\022\016\n\006online\030\002 \001(\010\022\023\n\013serve"
-    "r_name\030\003 \001(\t\022\023\n\013server_host\030\004 \001(\t\022\023\n\013ser"
-    "ver_port\030\005 \001(\005\022\r\n\005token\030\006 \001(\t\022\023\n\013last_lo"
-    "gout\030\007 \001(\003\"*\n\013KickUserReq\022\013\n\003uid\030\001 \001(\t\022\016"
-    "\n\006reason\030\002 \001(\005\"\035\n\014KickUserResp\022\r\n\005error\030"
-    "\001 \001(\005\"\r\n\013GetNodesReq\"\202\001\n\010NodeInfo\022\014\n\004nam"
-    "e\030\001 \001(\t\022\023\n\013server_host\030\002 \001(\t\022\023\n\013server_p"
-    "ort\030\003 \001(\005\022\024\n\014current_load\030\004 \001(\005\022\020\n\010capac"
-    "ity\030\005 \001(\005\022\026\n\016last_heartbeat\030\006 \001(\003\">\n\014Get"
-    "NodesResp\022\r\n\005error\030\001 \001(\005\022\037\n\005nodes\030\002 \003(\0132"
-    "\020.status.NodeInfo2\314\004\n\rStatusService\022A\n\014R"
-    "egisterNode\022\027.status.RegisterNodeReq\032\030.s"
-    "tatus.RegisterNodeResp\022G\n\016DeregisterNode"
-    "\022\031.status.DeregisterNodeReq\032\032.status.Der"
-    "egisterNodeResp\0228\n\tHeartbeat\022\024.status.He"
-    "artbeatReq\032\025.status.HeartbeatResp\022G\n\016All"
-    "ocateServer\022\031.status.AllocateServerReq\032\032"
-    ".status.AllocateServerResp\022A\n\014ReportOnli"
-    "ne\022\027.status.OnlineReportReq\032\030.status.Onl"
-    "ineReportResp\022D\n\rReportOffline\022\030.status."
-    "OfflineReportReq\032\031.status.OfflineReportR"
-    "esp\0225\n\016QueryUserRoute\022\020.status.RouteReq\032"
-    "\021.status.RouteResp\0225\n\010KickUser\022\023.status."
-    "KickUserReq\032\024.status.KickUserResp\0225\n\010Get"
-    "Nodes\022\023.status.GetNodesReq\032\024.status.GetN"
-    "odesRespb\006proto3"
+    "port\030\003 \001(\005\022\020\n\010capacity\030\004 \001(\005\022\020\n\010rpc_port"
+    "\030\005 \001(\005\"!\n\020RegisterNodeResp\022\r\n\005error\030\001 \001("
+    "\005\"!\n\021DeregisterNodeReq\022\014\n\004name\030\001 \001(\t\"#\n\022"
+    "DeregisterNodeResp\022\r\n\005error\030\001 \001(\005\"\214\001\n\014He"
+    "artbeatReq\022\014\n\004name\030\001 \001(\t\022\023\n\013server_host\030"
+    "\002 \001(\t\022\023\n\013server_port\030\003 \001(\005\022\020\n\010measured\030\004"
+    " \001(\010\022\020\n\010sessions\030\005 \001(\005\022\023\n\013queue_depth\030\006 "
+    "\001(\005\022\013\n\003cpu\030\007 \001(\005\"\036\n\rHeartbeatResp\022\r\n\005err"
+    "or\030\001 \001(\005\" \n\021AllocateServerReq\022\013\n\003uid\030\001 \001"
+    "(\t\"\227\001\n\022AllocateServerResp\022\r\n\005error\030\001 \001(\005"
+    "\022\020\n\010assigned\030\002 \001(\010\022\023\n\013server_name\030\003 \001(\t\022"
+    "\023\n\013server_host\030\004 \001(\t\022\023\n\013server_port\030\005 \001("
+    "\005\022\r\n\005token\030\006 \001(\t\022\022\n\nexpires_at\030\007 \001(\003\"\200\001\n"
+    "\017OnlineReportReq\022\013\n\003uid\030\001 \001(\t\022\023\n\013server_"
+    "name\030\002 \001(\t\022\023\n\013server_host\030\003 \001(\t\022\023\n\013serve"
+    "r_port\030\004 \001(\005\022\r\n\005token\030\005 \001(\t\022\022\n\ngeneratio"
+    "n\030\006 \001(\003\"!\n\020OnlineReportResp\022\r\n\005error\030\001 \001"
+    "(\005\"4\n\020OfflineReportReq\022\013\n\003uid\030\001 \001(\t\022\023\n\013s"
+    "erver_name\030\002 \001(\t\"\"\n\021OfflineReportResp\022\r\n"
+    "\005error\030\001 \001(\005\"\027\n\010RouteReq\022\013\n\003uid\030\001 \001(\t\"\215\001"
+    "\n\tRouteResp\022\r\n\005error\030\001 \001(\005\022\016\n\006online\030\002 \001"
+    "(\010\022\023\n\013server_name\030\003 \001(\t\022\023\n\013server_host\030\004"
+    " \001(\t\022\023\n\013server_port\030\005 \001(\005\022\r\n\005token\030\006 \001(\t"
+    "\022\023\n\013last_logout\030\007 \001(\003\"A\n\016VerifyTokenReq\022"
+    "\013\n\003uid\030\001 \001(\t\022\r\n\005token\030\002 \001(\t\022\023\n\013server_na"
+    "me\030\003 \001(\t\"C\n\017VerifyTokenResp\022\r\n\005error\030\001 \001"
+    "(\005\022\r\n\005valid\030\002 \001(\010\022\022\n\nexpires_at\030\003 \001(\003\"*\n"
+    "\013KickUserReq\022\013\n\003uid\030\001 \001(\t\022\016\n\006reason\030\002 \001("
+    "\005\"\035\n\014KickUserResp\022\r\n\005error\030\001 \001(\005\"\r\n\013GetN"
+    "odesReq\"\332\001\n\010NodeInfo\022\014\n\004name\030\001 \001(\t\022\023\n\013se"
+    "rver_host\030\002 \001(\t\022\023\n\013server_port\030\003 \001(\005\022\024\n\014"
+    "current_load\030\004 \001(\005\022\020\n\010capacity\030\005 \001(\005\022\026\n\016"
+    "last_heartbeat\030\006 \001(\003\022\020\n\010rpc_port\030\007 \001(\005\022\020"
+    "\n\010measured\030\010 \001(\010\022\020\n\010sessions\030\t \001(\005\022\023\n\013qu"
+    "eue_depth\030\n \001(\005\022\013\n\003cpu\030\013 \001(\005\">\n\014GetNodes"
+    "Resp\022\r\n\005error\030\001 \001(\005\022\037\n\005nodes\030\002 \003(\0132\020.sta"
+    "tus.NodeInfo2\214\005\n\rStatusService\022A\n\014Regist"
+    "erNode\022\027.status.RegisterNodeReq\032\030.status"
+    ".RegisterNodeResp\022G\n\016DeregisterNode\022\031.st"
+    "atus.DeregisterNodeReq\032\032.status.Deregist"
+    "erNodeResp\0228\n\tHeartbeat\022\024.status.Heartbe"
+    "atReq\032\025.status.HeartbeatResp\022G\n\016Allocate"
+    "Server\022\031.status.AllocateServerReq\032\032.stat"
+    "us.AllocateServerResp\022A\n\014ReportOnline\022\027."
+    "status.OnlineReportReq\032\030.status.OnlineRe"
+    "portResp\022D\n\rReportOffline\022\030.status.Offli"
+    "neReportReq\032\031.status.OfflineReportResp\0225"
+    "\n\016QueryUserRoute\022\020.status.RouteReq\032\021.sta"
+    "tus.RouteResp\022>\n\013VerifyToken\022\026.status.Ve"
+    "rifyTokenReq\032\027.status.VerifyTokenResp\0225\n"
+    "\010KickUser\022\023.status.KickUserReq\032\024.status."
+    "KickUserResp\0225\n\010GetNodes\022\023.status.GetNod"
+    "esReq\032\024.status.GetNodesRespb\006proto3"
 };
 static const ::_pbi::DescriptorTable* const descriptor_table_status_2eproto_deps[1] =
     {
@@ -871,13 +993,13 @@ static ::absl::once_flag descriptor_table_status_2eproto_once;
 PROTOBUF_CONSTINIT const ::_pbi::DescriptorTable descriptor_table_status_2eproto = {
     false,
     false,
-    1816,
+    2235,
     descriptor_table_protodef_status_2eproto,
     "status.proto",
     &descriptor_table_status_2eproto_once,
     descriptor_table_status_2eproto_deps,
     1,
-    19,
+    21,
     schemas,
     file_default_instances,
     TableStruct_status_2eproto::offsets,
@@ -924,9 +1046,9 @@ RegisterNodeReq::RegisterNodeReq(
                offsetof(Impl_, server_port_),
            reinterpret_cast<const char *>(&from._impl_) +
                offsetof(Impl_, server_port_),
-           offsetof(Impl_, capacity_) -
+           offsetof(Impl_, rpc_port_) -
                offsetof(Impl_, server_port_) +
-               sizeof(Impl_::capacity_));
+               sizeof(Impl_::rpc_port_));
 
   // @@protoc_insertion_point(copy_constructor:status.RegisterNodeReq)
 }
@@ -942,9 +1064,9 @@ inline void RegisterNodeReq::SharedCtor(::_pb::Arena* arena) {
   ::memset(reinterpret_cast<char *>(&_impl_) +
                offsetof(Impl_, server_port_),
            0,
-           offsetof(Impl_, capacity_) -
+           offsetof(Impl_, rpc_port_) -
                offsetof(Impl_, server_port_) +
-               sizeof(Impl_::capacity_));
+               sizeof(Impl_::rpc_port_));
 }
 RegisterNodeReq::~RegisterNodeReq() {
   // @@protoc_insertion_point(destructor:status.RegisterNodeReq)
@@ -995,15 +1117,15 @@ const ::google::protobuf::internal::ClassData* RegisterNodeReq::GetClassData() c
   return _class_data_.base();
 }
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 4, 0, 46, 2> RegisterNodeReq::_table_ = {
+const ::_pbi::TcParseTable<3, 5, 0, 46, 2> RegisterNodeReq::_table_ = {
   {
     0,  // no _has_bits_
     0, // no _extensions_
-    4, 24,  // max_field_number, fast_idx_mask
+    5, 56,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
-    4294967280,  // skipmap
+    4294967264,  // skipmap
     offsetof(decltype(_table_), field_entries),
-    4,  // num_field_entries
+    5,  // num_field_entries
     0,  // num_aux_entries
     offsetof(decltype(_table_), field_names),  // no aux_entries
     _class_data_.base(),
@@ -1013,9 +1135,7 @@ const ::_pbi::TcParseTable<2, 4, 0, 46, 2> RegisterNodeReq::_table_ = {
     ::_pbi::TcParser::GetTable<::status::RegisterNodeReq>(),  // to_prefetch
     #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
   }, {{
-    // int32 capacity = 4;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(RegisterNodeReq, _impl_.capacity_), 63>(),
-     {32, 63, 0, PROTOBUF_FIELD_OFFSET(RegisterNodeReq, _impl_.capacity_)}},
+    {::_pbi::TcParser::MiniParse, {}},
     // string name = 1;
     {::_pbi::TcParser::FastUS1,
      {10, 63, 0, PROTOBUF_FIELD_OFFSET(RegisterNodeReq, _impl_.name_)}},
@@ -1025,6 +1145,14 @@ const ::_pbi::TcParseTable<2, 4, 0, 46, 2> RegisterNodeReq::_table_ = {
     // int32 server_port = 3;
     {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(RegisterNodeReq, _impl_.server_port_), 63>(),
      {24, 63, 0, PROTOBUF_FIELD_OFFSET(RegisterNodeReq, _impl_.server_port_)}},
+    // int32 capacity = 4;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(RegisterNodeReq, _impl_.capacity_), 63>(),
+     {32, 63, 0, PROTOBUF_FIELD_OFFSET(RegisterNodeReq, _impl_.capacity_)}},
+    // int32 rpc_port = 5;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(RegisterNodeReq, _impl_.rpc_port_), 63>(),
+     {40, 63, 0, PROTOBUF_FIELD_OFFSET(RegisterNodeReq, _impl_.rpc_port_)}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
   }}, {{
     65535, 65535
   }}, {{
@@ -1040,6 +1168,9 @@ const ::_pbi::TcParseTable<2, 4, 0, 46, 2> RegisterNodeReq::_table_ = {
     // int32 capacity = 4;
     {PROTOBUF_FIELD_OFFSET(RegisterNodeReq, _impl_.capacity_), 0, 0,
     (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+    // int32 rpc_port = 5;
+    {PROTOBUF_FIELD_OFFSET(RegisterNodeReq, _impl_.rpc_port_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
   }},
   // no aux_entries
   {{
@@ -1060,8 +1191,8 @@ PROTOBUF_NOINLINE void RegisterNodeReq::Clear() {
   _impl_.name_.ClearToEmpty();
   _impl_.server_host_.ClearToEmpty();
   ::memset(&_impl_.server_port_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.capacity_) -
-      reinterpret_cast<char*>(&_impl_.server_port_)) + sizeof(_impl_.capacity_));
+      reinterpret_cast<char*>(&_impl_.rpc_port_) -
+      reinterpret_cast<char*>(&_impl_.server_port_)) + sizeof(_impl_.rpc_port_));
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
 
@@ -1110,6 +1241,13 @@ PROTOBUF_NOINLINE void RegisterNodeReq::Clear() {
                     stream, this_._internal_capacity(), target);
           }
 
+          // int32 rpc_port = 5;
+          if (this_._internal_rpc_port() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt32ToArrayWithField<5>(
+                    stream, this_._internal_rpc_port(), target);
+          }
+
           if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
             target =
                 ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
@@ -1155,6 +1293,11 @@ PROTOBUF_NOINLINE void RegisterNodeReq::Clear() {
               total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
                   this_._internal_capacity());
             }
+            // int32 rpc_port = 5;
+            if (this_._internal_rpc_port() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+                  this_._internal_rpc_port());
+            }
           }
           return this_.MaybeComputeUnknownFieldsSize(total_size,
                                                      &this_._impl_._cached_size_);
@@ -1180,6 +1323,9 @@ void RegisterNodeReq::MergeImpl(::google::protobuf::MessageLite& to_msg, const :
   if (from._internal_capacity() != 0) {
     _this->_impl_.capacity_ = from._impl_.capacity_;
   }
+  if (from._internal_rpc_port() != 0) {
+    _this->_impl_.rpc_port_ = from._impl_.rpc_port_;
+  }
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -1199,8 +1345,8 @@ void RegisterNodeReq::InternalSwap(RegisterNodeReq* PROTOBUF_RESTRICT other) {
   ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.name_, &other->_impl_.name_, arena);
   ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.server_host_, &other->_impl_.server_host_, arena);
   ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(RegisterNodeReq, _impl_.capacity_)
-      + sizeof(RegisterNodeReq::_impl_.capacity_)
+      PROTOBUF_FIELD_OFFSET(RegisterNodeReq, _impl_.rpc_port_)
+      + sizeof(RegisterNodeReq::_impl_.rpc_port_)
       - PROTOBUF_FIELD_OFFSET(RegisterNodeReq, _impl_.server_port_)>(
           reinterpret_cast<char*>(&_impl_.server_port_),
           reinterpret_cast<char*>(&other->_impl_.server_port_));
@@ -1889,7 +2035,13 @@ HeartbeatReq::HeartbeatReq(
   _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
       from._internal_metadata_);
   new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  _impl_.server_port_ = from._impl_.server_port_;
+  ::memcpy(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, server_port_),
+           reinterpret_cast<const char *>(&from._impl_) +
+               offsetof(Impl_, server_port_),
+           offsetof(Impl_, cpu_) -
+               offsetof(Impl_, server_port_) +
+               sizeof(Impl_::cpu_));
 
   // @@protoc_insertion_point(copy_constructor:status.HeartbeatReq)
 }
@@ -1902,7 +2054,12 @@ inline PROTOBUF_NDEBUG_INLINE HeartbeatReq::Impl_::Impl_(
 
 inline void HeartbeatReq::SharedCtor(::_pb::Arena* arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.server_port_ = {};
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, server_port_),
+           0,
+           offsetof(Impl_, cpu_) -
+               offsetof(Impl_, server_port_) +
+               sizeof(Impl_::cpu_));
 }
 HeartbeatReq::~HeartbeatReq() {
   // @@protoc_insertion_point(destructor:status.HeartbeatReq)
@@ -1953,15 +2110,15 @@ const ::google::protobuf::internal::ClassData* HeartbeatReq::GetClassData() cons
   return _class_data_.base();
 }
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 3, 0, 43, 2> HeartbeatReq::_table_ = {
+const ::_pbi::TcParseTable<3, 7, 0, 43, 2> HeartbeatReq::_table_ = {
   {
     0,  // no _has_bits_
     0, // no _extensions_
-    3, 24,  // max_field_number, fast_idx_mask
+    7, 56,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
-    4294967288,  // skipmap
+    4294967168,  // skipmap
     offsetof(decltype(_table_), field_entries),
-    3,  // num_field_entries
+    7,  // num_field_entries
     0,  // num_aux_entries
     offsetof(decltype(_table_), field_names),  // no aux_entries
     _class_data_.base(),
@@ -1981,6 +2138,18 @@ const ::_pbi::TcParseTable<2, 3, 0, 43, 2> HeartbeatReq::_table_ = {
     // int32 server_port = 3;
     {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(HeartbeatReq, _impl_.server_port_), 63>(),
      {24, 63, 0, PROTOBUF_FIELD_OFFSET(HeartbeatReq, _impl_.server_port_)}},
+    // bool measured = 4;
+    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(HeartbeatReq, _impl_.measured_), 63>(),
+     {32, 63, 0, PROTOBUF_FIELD_OFFSET(HeartbeatReq, _impl_.measured_)}},
+    // int32 sessions = 5;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(HeartbeatReq, _impl_.sessions_), 63>(),
+     {40, 63, 0, PROTOBUF_FIELD_OFFSET(HeartbeatReq, _impl_.sessions_)}},
+    // int32 queue_depth = 6;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(HeartbeatReq, _impl_.queue_depth_), 63>(),
+     {48, 63, 0, PROTOBUF_FIELD_OFFSET(HeartbeatReq, _impl_.queue_depth_)}},
+    // int32 cpu = 7;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(HeartbeatReq, _impl_.cpu_), 63>(),
+     {56, 63, 0, PROTOBUF_FIELD_OFFSET(HeartbeatReq, _impl_.cpu_)}},
   }}, {{
     65535, 65535
   }}, {{
@@ -1993,6 +2162,18 @@ const ::_pbi::TcParseTable<2, 3, 0, 43, 2> HeartbeatReq::_table_ = {
     // int32 server_port = 3;
     {PROTOBUF_FIELD_OFFSET(HeartbeatReq, _impl_.server_port_), 0, 0,
     (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+    // bool measured = 4;
+    {PROTOBUF_FIELD_OFFSET(HeartbeatReq, _impl_.measured_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kBool)},
+    // int32 sessions = 5;
+    {PROTOBUF_FIELD_OFFSET(HeartbeatReq, _impl_.sessions_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+    // int32 queue_depth = 6;
+    {PROTOBUF_FIELD_OFFSET(HeartbeatReq, _impl_.queue_depth_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+    // int32 cpu = 7;
+    {PROTOBUF_FIELD_OFFSET(HeartbeatReq, _impl_.cpu_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
   }},
   // no aux_entries
   {{
@@ -2012,7 +2193,9 @@ PROTOBUF_NOINLINE void HeartbeatReq::Clear() {
 
   _impl_.name_.ClearToEmpty();
   _impl_.server_host_.ClearToEmpty();
-  _impl_.server_port_ = 0;
+  ::memset(&_impl_.server_port_, 0, static_cast<::size_t>(
+      reinterpret_cast<char*>(&_impl_.cpu_) -
+      reinterpret_cast<char*>(&_impl_.server_port_)) + sizeof(_impl_.cpu_));
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
 
@@ -2054,6 +2237,34 @@ PROTOBUF_NOINLINE void HeartbeatReq::Clear() {
                     stream, this_._internal_server_port(), target);
           }
 
+          // bool measured = 4;
+          if (this_._internal_measured() != 0) {
+            target = stream->EnsureSpace(target);
+            target = ::_pbi::WireFormatLite::WriteBoolToArray(
+                4, this_._internal_measured(), target);
+          }
+
+          // int32 sessions = 5;
+          if (this_._internal_sessions() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt32ToArrayWithField<5>(
+                    stream, this_._internal_sessions(), target);
+          }
+
+          // int32 queue_depth = 6;
+          if (this_._internal_queue_depth() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt32ToArrayWithField<6>(
+                    stream, this_._internal_queue_depth(), target);
+          }
+
+          // int32 cpu = 7;
+          if (this_._internal_cpu() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt32ToArrayWithField<7>(
+                    stream, this_._internal_cpu(), target);
+          }
+
           if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
             target =
                 ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
@@ -2094,6 +2305,25 @@ PROTOBUF_NOINLINE void HeartbeatReq::Clear() {
               total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
                   this_._internal_server_port());
             }
+            // bool measured = 4;
+            if (this_._internal_measured() != 0) {
+              total_size += 2;
+            }
+            // int32 sessions = 5;
+            if (this_._internal_sessions() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+                  this_._internal_sessions());
+            }
+            // int32 queue_depth = 6;
+            if (this_._internal_queue_depth() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+                  this_._internal_queue_depth());
+            }
+            // int32 cpu = 7;
+            if (this_._internal_cpu() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+                  this_._internal_cpu());
+            }
           }
           return this_.MaybeComputeUnknownFieldsSize(total_size,
                                                      &this_._impl_._cached_size_);
@@ -2116,6 +2346,18 @@ void HeartbeatReq::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::go
   if (from._internal_server_port() != 0) {
     _this->_impl_.server_port_ = from._impl_.server_port_;
   }
+  if (from._internal_measured() != 0) {
+    _this->_impl_.measured_ = from._impl_.measured_;
+  }
+  if (from._internal_sessions() != 0) {
+    _this->_impl_.sessions_ = from._impl_.sessions_;
+  }
+  if (from._internal_queue_depth() != 0) {
+    _this->_impl_.queue_depth_ = from._impl_.queue_depth_;
+  }
+  if (from._internal_cpu() != 0) {
+    _this->_impl_.cpu_ = from._impl_.cpu_;
+  }
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -2134,7 +2376,12 @@ void HeartbeatReq::InternalSwap(HeartbeatReq* PROTOBUF_RESTRICT other) {
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.name_, &other->_impl_.name_, arena);
   ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.server_host_, &other->_impl_.server_host_, arena);
-        swap(_impl_.server_port_, other->_impl_.server_port_);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(HeartbeatReq, _impl_.cpu_)
+      + sizeof(HeartbeatReq::_impl_.cpu_)
+      - PROTOBUF_FIELD_OFFSET(HeartbeatReq, _impl_.server_port_)>(
+          reinterpret_cast<char*>(&_impl_.server_port_),
+          reinterpret_cast<char*>(&other->_impl_.server_port_));
 }
 
 ::google::protobuf::Metadata HeartbeatReq::GetMetadata() const {
@@ -3009,7 +3256,13 @@ OnlineReportReq::OnlineReportReq(
   _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
       from._internal_metadata_);
   new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  _impl_.server_port_ = from._impl_.server_port_;
+  ::memcpy(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, generation_),
+           reinterpret_cast<const char *>(&from._impl_) +
+               offsetof(Impl_, generation_),
+           offsetof(Impl_, server_port_) -
+               offsetof(Impl_, generation_) +
+               sizeof(Impl_::server_port_));
 
   // @@protoc_insertion_point(copy_constructor:status.OnlineReportReq)
 }
@@ -3024,7 +3277,12 @@ inline PROTOBUF_NDEBUG_INLINE OnlineReportReq::Impl_::Impl_(
 
 inline void OnlineReportReq::SharedCtor(::_pb::Arena* arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.server_port_ = {};
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, generation_),
+           0,
+           offsetof(Impl_, server_port_) -
+               offsetof(Impl_, generation_) +
+               sizeof(Impl_::server_port_));
 }
 OnlineReportReq::~OnlineReportReq() {
   // @@protoc_insertion_point(destructor:status.OnlineReportReq)
@@ -3077,15 +3335,15 @@ const ::google::protobuf::internal::ClassData* OnlineReportReq::GetClassData() c
   return _class_data_.base();
 }
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<3, 5, 0, 61, 2> OnlineReportReq::_table_ = {
+const ::_pbi::TcParseTable<3, 6, 0, 61, 2> OnlineReportReq::_table_ = {
   {
     0,  // no _has_bits_
     0, // no _extensions_
-    5, 56,  // max_field_number, fast_idx_mask
+    6, 56,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
-    4294967264,  // skipmap
+    4294967232,  // skipmap
     offsetof(decltype(_table_), field_entries),
-    5,  // num_field_entries
+    6,  // num_field_entries
     0,  // num_aux_entries
     offsetof(decltype(_table_), field_names),  // no aux_entries
     _class_data_.base(),
@@ -3111,7 +3369,9 @@ const ::_pbi::TcParseTable<3, 5, 0, 61, 2> OnlineReportReq::_table_ = {
     // string token = 5;
     {::_pbi::TcParser::FastUS1,
      {42, 63, 0, PROTOBUF_FIELD_OFFSET(OnlineReportReq, _impl_.token_)}},
-    {::_pbi::TcParser::MiniParse, {}},
+    // int64 generation = 6;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(OnlineReportReq, _impl_.generation_), 63>(),
+     {48, 63, 0, PROTOBUF_FIELD_OFFSET(OnlineReportReq, _impl_.generation_)}},
     {::_pbi::TcParser::MiniParse, {}},
   }}, {{
     65535, 65535
@@ -3131,6 +3391,9 @@ const ::_pbi::TcParseTable<3, 5, 0, 61, 2> OnlineReportReq::_table_ = {
     // string token = 5;
     {PROTOBUF_FIELD_OFFSET(OnlineReportReq, _impl_.token_), 0, 0,
     (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // int64 generation = 6;
+    {PROTOBUF_FIELD_OFFSET(OnlineReportReq, _impl_.generation_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt64)},
   }},
   // no aux_entries
   {{
@@ -3154,7 +3417,9 @@ PROTOBUF_NOINLINE void OnlineReportReq::Clear() {
   _impl_.server_name_.ClearToEmpty();
   _impl_.server_host_.ClearToEmpty();
   _impl_.token_.ClearToEmpty();
-  _impl_.server_port_ = 0;
+  ::memset(&_impl_.generation_, 0, static_cast<::size_t>(
+      reinterpret_cast<char*>(&_impl_.server_port_) -
+      reinterpret_cast<char*>(&_impl_.generation_)) + sizeof(_impl_.server_port_));
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
 
@@ -3212,6 +3477,13 @@ PROTOBUF_NOINLINE void OnlineReportReq::Clear() {
             target = stream->WriteStringMaybeAliased(5, _s, target);
           }
 
+          // int64 generation = 6;
+          if (this_._internal_generation() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt64ToArrayWithField<6>(
+                    stream, this_._internal_generation(), target);
+          }
+
           if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
             target =
                 ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
@@ -3257,6 +3529,11 @@ PROTOBUF_NOINLINE void OnlineReportReq::Clear() {
               total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
                                               this_._internal_token());
             }
+            // int64 generation = 6;
+            if (this_._internal_generation() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(
+                  this_._internal_generation());
+            }
             // int32 server_port = 4;
             if (this_._internal_server_port() != 0) {
               total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
@@ -3287,6 +3564,9 @@ void OnlineReportReq::MergeImpl(::google::protobuf::MessageLite& to_msg, const :
   if (!from._internal_token().empty()) {
     _this->_internal_set_token(from._internal_token());
   }
+  if (from._internal_generation() != 0) {
+    _this->_impl_.generation_ = from._impl_.generation_;
+  }
   if (from._internal_server_port() != 0) {
     _this->_impl_.server_port_ = from._impl_.server_port_;
   }
@@ -3310,7 +3590,12 @@ void OnlineReportReq::InternalSwap(OnlineReportReq* PROTOBUF_RESTRICT other) {
   ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.server_name_, &other->_impl_.server_name_, arena);
   ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.server_host_, &other->_impl_.server_host_, arena);
   ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.token_, &other->_impl_.token_, arena);
-        swap(_impl_.server_port_, other->_impl_.server_port_);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(OnlineReportReq, _impl_.server_port_)
+      + sizeof(OnlineReportReq::_impl_.server_port_)
+      - PROTOBUF_FIELD_OFFSET(OnlineReportReq, _impl_.generation_)>(
+          reinterpret_cast<char*>(&_impl_.generation_),
+          reinterpret_cast<char*>(&other->_impl_.generation_));
 }
 
 ::google::protobuf::Metadata OnlineReportReq::GetMetadata() const {
@@ -3542,6 +3827,7 @@ inline PROTOBUF_NDEBUG_INLINE OfflineReportReq::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
     const Impl_& from, const ::status::OfflineReportReq& from_msg)
       : uid_(arena, from.uid_),
+        server_name_(arena, from.server_name_),
         _cached_size_{0} {}
 
 OfflineReportReq::OfflineReportReq(
@@ -3564,6 +3850,7 @@ inline PROTOBUF_NDEBUG_INLINE OfflineReportReq::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility,
     ::google::protobuf::Arena* arena)
       : uid_(arena),
+        server_name_(arena),
         _cached_size_{0} {}
 
 inline void OfflineReportReq::SharedCtor(::_pb::Arena* arena) {
@@ -3578,6 +3865,7 @@ inline void OfflineReportReq::SharedDtor(MessageLite& self) {
   this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
   ABSL_DCHECK(this_.GetArena() == nullptr);
   this_._impl_.uid_.Destroy();
+  this_._impl_.server_name_.Destroy();
   this_._impl_.~Impl_();
 }
 
@@ -3617,15 +3905,15 @@ const ::google::protobuf::internal::ClassData* OfflineReportReq::GetClassData()
   return _class_data_.base();
 }
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 0, 35, 2> OfflineReportReq::_table_ = {
+const ::_pbi::TcParseTable<1, 2, 0, 46, 2> OfflineReportReq::_table_ = {
   {
     0,  // no _has_bits_
     0, // no _extensions_
-    1, 0,  // max_field_number, fast_idx_mask
+    2, 8,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
-    4294967294,  // skipmap
+    4294967292,  // skipmap
     offsetof(decltype(_table_), field_entries),
-    1,  // num_field_entries
+    2,  // num_field_entries
     0,  // num_aux_entries
     offsetof(decltype(_table_), field_names),  // no aux_entries
     _class_data_.base(),
@@ -3635,6 +3923,9 @@ const ::_pbi::TcParseTable<0, 1, 0, 35, 2> OfflineReportReq::_table_ = {
     ::_pbi::TcParser::GetTable<::status::OfflineReportReq>(),  // to_prefetch
     #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
   }, {{
+    // string server_name = 2;
+    {::_pbi::TcParser::FastUS1,
+     {18, 63, 0, PROTOBUF_FIELD_OFFSET(OfflineReportReq, _impl_.server_name_)}},
     // string uid = 1;
     {::_pbi::TcParser::FastUS1,
      {10, 63, 0, PROTOBUF_FIELD_OFFSET(OfflineReportReq, _impl_.uid_)}},
@@ -3644,12 +3935,16 @@ const ::_pbi::TcParseTable<0, 1, 0, 35, 2> OfflineReportReq::_table_ = {
     // string uid = 1;
     {PROTOBUF_FIELD_OFFSET(OfflineReportReq, _impl_.uid_), 0, 0,
     (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // string server_name = 2;
+    {PROTOBUF_FIELD_OFFSET(OfflineReportReq, _impl_.server_name_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
   }},
   // no aux_entries
   {{
-    "\27\3\0\0\0\0\0\0"
+    "\27\3\13\0\0\0\0\0"
     "status.OfflineReportReq"
     "uid"
+    "server_name"
   }},
 };
 
@@ -3661,6 +3956,7 @@ PROTOBUF_NOINLINE void OfflineReportReq::Clear() {
   (void) cached_has_bits;
 
   _impl_.uid_.ClearToEmpty();
+  _impl_.server_name_.ClearToEmpty();
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
 
@@ -3687,6 +3983,14 @@ PROTOBUF_NOINLINE void OfflineReportReq::Clear() {
             target = stream->WriteStringMaybeAliased(1, _s, target);
           }
 
+          // string server_name = 2;
+          if (!this_._internal_server_name().empty()) {
+            const std::string& _s = this_._internal_server_name();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "status.OfflineReportReq.server_name");
+            target = stream->WriteStringMaybeAliased(2, _s, target);
+          }
+
           if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
             target =
                 ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
@@ -3710,12 +4014,18 @@ PROTOBUF_NOINLINE void OfflineReportReq::Clear() {
           // Prevent compiler warnings about cached_has_bits being unused
           (void)cached_has_bits;
 
+          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
            {
             // string uid = 1;
             if (!this_._internal_uid().empty()) {
               total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
                                               this_._internal_uid());
             }
+            // string server_name = 2;
+            if (!this_._internal_server_name().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_server_name());
+            }
           }
           return this_.MaybeComputeUnknownFieldsSize(total_size,
                                                      &this_._impl_._cached_size_);
@@ -3732,6 +4042,9 @@ void OfflineReportReq::MergeImpl(::google::protobuf::MessageLite& to_msg, const
   if (!from._internal_uid().empty()) {
     _this->_internal_set_uid(from._internal_uid());
   }
+  if (!from._internal_server_name().empty()) {
+    _this->_internal_set_server_name(from._internal_server_name());
+  }
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -3749,6 +4062,7 @@ void OfflineReportReq::InternalSwap(OfflineReportReq* PROTOBUF_RESTRICT other) {
   ABSL_DCHECK_EQ(arena, other->GetArena());
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.uid_, &other->_impl_.uid_, arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.server_name_, &other->_impl_.server_name_, arena);
 }
 
 ::google::protobuf::Metadata OfflineReportReq::GetMetadata() const {
@@ -4588,151 +4902,702 @@ void RouteResp::InternalSwap(RouteResp* PROTOBUF_RESTRICT other) {
 }
 // ===================================================================
 
-class KickUserReq::_Internal {
+class VerifyTokenReq::_Internal {
  public:
 };
 
-KickUserReq::KickUserReq(::google::protobuf::Arena* arena)
+VerifyTokenReq::VerifyTokenReq(::google::protobuf::Arena* arena)
 #if defined(PROTOBUF_CUSTOM_VTABLE)
     : ::google::protobuf::Message(arena, _class_data_.base()) {
 #else   // PROTOBUF_CUSTOM_VTABLE
     : ::google::protobuf::Message(arena) {
 #endif  // PROTOBUF_CUSTOM_VTABLE
   SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:status.KickUserReq)
+  // @@protoc_insertion_point(arena_constructor:status.VerifyTokenReq)
 }
-inline PROTOBUF_NDEBUG_INLINE KickUserReq::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE VerifyTokenReq::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::status::KickUserReq& from_msg)
+    const Impl_& from, const ::status::VerifyTokenReq& from_msg)
       : uid_(arena, from.uid_),
+        token_(arena, from.token_),
+        server_name_(arena, from.server_name_),
         _cached_size_{0} {}
 
-KickUserReq::KickUserReq(
+VerifyTokenReq::VerifyTokenReq(
     ::google::protobuf::Arena* arena,
-    const KickUserReq& from)
+    const VerifyTokenReq& from)
 #if defined(PROTOBUF_CUSTOM_VTABLE)
     : ::google::protobuf::Message(arena, _class_data_.base()) {
 #else   // PROTOBUF_CUSTOM_VTABLE
     : ::google::protobuf::Message(arena) {
 #endif  // PROTOBUF_CUSTOM_VTABLE
-  KickUserReq* const _this = this;
+  VerifyTokenReq* const _this = this;
   (void)_this;
   _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
       from._internal_metadata_);
   new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  _impl_.reason_ = from._impl_.reason_;
 
-  // @@protoc_insertion_point(copy_constructor:status.KickUserReq)
+  // @@protoc_insertion_point(copy_constructor:status.VerifyTokenReq)
 }
-inline PROTOBUF_NDEBUG_INLINE KickUserReq::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE VerifyTokenReq::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility,
     ::google::protobuf::Arena* arena)
       : uid_(arena),
+        token_(arena),
+        server_name_(arena),
         _cached_size_{0} {}
 
-inline void KickUserReq::SharedCtor(::_pb::Arena* arena) {
+inline void VerifyTokenReq::SharedCtor(::_pb::Arena* arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.reason_ = {};
 }
-KickUserReq::~KickUserReq() {
-  // @@protoc_insertion_point(destructor:status.KickUserReq)
+VerifyTokenReq::~VerifyTokenReq() {
+  // @@protoc_insertion_point(destructor:status.VerifyTokenReq)
   SharedDtor(*this);
 }
-inline void KickUserReq::SharedDtor(MessageLite& self) {
-  KickUserReq& this_ = static_cast<KickUserReq&>(self);
+inline void VerifyTokenReq::SharedDtor(MessageLite& self) {
+  VerifyTokenReq& this_ = static_cast<VerifyTokenReq&>(self);
   this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
   ABSL_DCHECK(this_.GetArena() == nullptr);
   this_._impl_.uid_.Destroy();
+  this_._impl_.token_.Destroy();
+  this_._impl_.server_name_.Destroy();
   this_._impl_.~Impl_();
 }
 
-inline void* KickUserReq::PlacementNew_(const void*, void* mem,
+inline void* VerifyTokenReq::PlacementNew_(const void*, void* mem,
                                         ::google::protobuf::Arena* arena) {
-  return ::new (mem) KickUserReq(arena);
+  return ::new (mem) VerifyTokenReq(arena);
 }
-constexpr auto KickUserReq::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(KickUserReq),
-                                            alignof(KickUserReq));
+constexpr auto VerifyTokenReq::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(VerifyTokenReq),
+                                            alignof(VerifyTokenReq));
 }
 PROTOBUF_CONSTINIT
 PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull KickUserReq::_class_data_ = {
+const ::google::protobuf::internal::ClassDataFull VerifyTokenReq::_class_data_ = {
     ::google::protobuf::internal::ClassData{
-        &_KickUserReq_default_instance_._instance,
+        &_VerifyTokenReq_default_instance_._instance,
         &_table_.header,
         nullptr,  // OnDemandRegisterArenaDtor
         nullptr,  // IsInitialized
-        &KickUserReq::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<KickUserReq>(),
+        &VerifyTokenReq::MergeImpl,
+        ::google::protobuf::Message::GetNewImpl<VerifyTokenReq>(),
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-        &KickUserReq::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<KickUserReq>(), &KickUserReq::ByteSizeLong,
-            &KickUserReq::_InternalSerialize,
+        &VerifyTokenReq::SharedDtor,
+        ::google::protobuf::Message::GetClearImpl<VerifyTokenReq>(), &VerifyTokenReq::ByteSizeLong,
+            &VerifyTokenReq::_InternalSerialize,
 #endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(KickUserReq, _impl_._cached_size_),
+        PROTOBUF_FIELD_OFFSET(VerifyTokenReq, _impl_._cached_size_),
         false,
     },
-    &KickUserReq::kDescriptorMethods,
+    &VerifyTokenReq::kDescriptorMethods,
     &descriptor_table_status_2eproto,
     nullptr,  // tracker
 };
-const ::google::protobuf::internal::ClassData* KickUserReq::GetClassData() const {
+const ::google::protobuf::internal::ClassData* VerifyTokenReq::GetClassData() const {
   ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
   ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
   return _class_data_.base();
 }
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 0, 30, 2> KickUserReq::_table_ = {
+const ::_pbi::TcParseTable<2, 3, 0, 49, 2> VerifyTokenReq::_table_ = {
   {
     0,  // no _has_bits_
     0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
+    3, 24,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
+    4294967288,  // skipmap
     offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
+    3,  // num_field_entries
     0,  // num_aux_entries
     offsetof(decltype(_table_), field_names),  // no aux_entries
     _class_data_.base(),
     nullptr,  // post_loop_handler
     ::_pbi::TcParser::GenericFallback,  // fallback
     #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::status::KickUserReq>(),  // to_prefetch
+    ::_pbi::TcParser::GetTable<::status::VerifyTokenReq>(),  // to_prefetch
     #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
   }, {{
-    // int32 reason = 2;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(KickUserReq, _impl_.reason_), 63>(),
-     {16, 63, 0, PROTOBUF_FIELD_OFFSET(KickUserReq, _impl_.reason_)}},
+    {::_pbi::TcParser::MiniParse, {}},
     // string uid = 1;
     {::_pbi::TcParser::FastUS1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(KickUserReq, _impl_.uid_)}},
+     {10, 63, 0, PROTOBUF_FIELD_OFFSET(VerifyTokenReq, _impl_.uid_)}},
+    // string token = 2;
+    {::_pbi::TcParser::FastUS1,
+     {18, 63, 0, PROTOBUF_FIELD_OFFSET(VerifyTokenReq, _impl_.token_)}},
+    // string server_name = 3;
+    {::_pbi::TcParser::FastUS1,
+     {26, 63, 0, PROTOBUF_FIELD_OFFSET(VerifyTokenReq, _impl_.server_name_)}},
   }}, {{
     65535, 65535
   }}, {{
     // string uid = 1;
-    {PROTOBUF_FIELD_OFFSET(KickUserReq, _impl_.uid_), 0, 0,
+    {PROTOBUF_FIELD_OFFSET(VerifyTokenReq, _impl_.uid_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // string token = 2;
+    {PROTOBUF_FIELD_OFFSET(VerifyTokenReq, _impl_.token_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // string server_name = 3;
+    {PROTOBUF_FIELD_OFFSET(VerifyTokenReq, _impl_.server_name_), 0, 0,
     (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // int32 reason = 2;
-    {PROTOBUF_FIELD_OFFSET(KickUserReq, _impl_.reason_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
   }},
   // no aux_entries
   {{
-    "\22\3\0\0\0\0\0\0"
-    "status.KickUserReq"
+    "\25\3\5\13\0\0\0\0"
+    "status.VerifyTokenReq"
     "uid"
+    "token"
+    "server_name"
   }},
 };
 
-PROTOBUF_NOINLINE void KickUserReq::Clear() {
-// @@protoc_insertion_point(message_clear_start:status.KickUserReq)
+PROTOBUF_NOINLINE void VerifyTokenReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:status.VerifyTokenReq)
   ::google::protobuf::internal::TSanWrite(&_impl_);
   ::uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   _impl_.uid_.ClearToEmpty();
-  _impl_.reason_ = 0;
+  _impl_.token_.ClearToEmpty();
+  _impl_.server_name_.ClearToEmpty();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::uint8_t* VerifyTokenReq::_InternalSerialize(
+            const MessageLite& base, ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) {
+          const VerifyTokenReq& this_ = static_cast<const VerifyTokenReq&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::uint8_t* VerifyTokenReq::_InternalSerialize(
+            ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+          const VerifyTokenReq& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(serialize_to_array_start:status.VerifyTokenReq)
+          ::uint32_t cached_has_bits = 0;
+          (void)cached_has_bits;
+
+          // string uid = 1;
+          if (!this_._internal_uid().empty()) {
+            const std::string& _s = this_._internal_uid();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "status.VerifyTokenReq.uid");
+            target = stream->WriteStringMaybeAliased(1, _s, target);
+          }
+
+          // string token = 2;
+          if (!this_._internal_token().empty()) {
+            const std::string& _s = this_._internal_token();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "status.VerifyTokenReq.token");
+            target = stream->WriteStringMaybeAliased(2, _s, target);
+          }
+
+          // string server_name = 3;
+          if (!this_._internal_server_name().empty()) {
+            const std::string& _s = this_._internal_server_name();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "status.VerifyTokenReq.server_name");
+            target = stream->WriteStringMaybeAliased(3, _s, target);
+          }
+
+          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+            target =
+                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+          }
+          // @@protoc_insertion_point(serialize_to_array_end:status.VerifyTokenReq)
+          return target;
+        }
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::size_t VerifyTokenReq::ByteSizeLong(const MessageLite& base) {
+          const VerifyTokenReq& this_ = static_cast<const VerifyTokenReq&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::size_t VerifyTokenReq::ByteSizeLong() const {
+          const VerifyTokenReq& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(message_byte_size_start:status.VerifyTokenReq)
+          ::size_t total_size = 0;
+
+          ::uint32_t cached_has_bits = 0;
+          // Prevent compiler warnings about cached_has_bits being unused
+          (void)cached_has_bits;
+
+          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+           {
+            // string uid = 1;
+            if (!this_._internal_uid().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_uid());
+            }
+            // string token = 2;
+            if (!this_._internal_token().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_token());
+            }
+            // string server_name = 3;
+            if (!this_._internal_server_name().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_server_name());
+            }
+          }
+          return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                                     &this_._impl_._cached_size_);
+        }
+
+void VerifyTokenReq::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+  auto* const _this = static_cast<VerifyTokenReq*>(&to_msg);
+  auto& from = static_cast<const VerifyTokenReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:status.VerifyTokenReq)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_uid().empty()) {
+    _this->_internal_set_uid(from._internal_uid());
+  }
+  if (!from._internal_token().empty()) {
+    _this->_internal_set_token(from._internal_token());
+  }
+  if (!from._internal_server_name().empty()) {
+    _this->_internal_set_server_name(from._internal_server_name());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void VerifyTokenReq::CopyFrom(const VerifyTokenReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:status.VerifyTokenReq)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void VerifyTokenReq::InternalSwap(VerifyTokenReq* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.uid_, &other->_impl_.uid_, arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.token_, &other->_impl_.token_, arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.server_name_, &other->_impl_.server_name_, arena);
+}
+
+::google::protobuf::Metadata VerifyTokenReq::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class VerifyTokenResp::_Internal {
+ public:
+};
+
+VerifyTokenResp::VerifyTokenResp(::google::protobuf::Arena* arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:status.VerifyTokenResp)
+}
+VerifyTokenResp::VerifyTokenResp(
+    ::google::protobuf::Arena* arena, const VerifyTokenResp& from)
+    : VerifyTokenResp(arena) {
+  MergeFrom(from);
+}
+inline PROTOBUF_NDEBUG_INLINE VerifyTokenResp::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0} {}
+
+inline void VerifyTokenResp::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, error_),
+           0,
+           offsetof(Impl_, expires_at_) -
+               offsetof(Impl_, error_) +
+               sizeof(Impl_::expires_at_));
+}
+VerifyTokenResp::~VerifyTokenResp() {
+  // @@protoc_insertion_point(destructor:status.VerifyTokenResp)
+  SharedDtor(*this);
+}
+inline void VerifyTokenResp::SharedDtor(MessageLite& self) {
+  VerifyTokenResp& this_ = static_cast<VerifyTokenResp&>(self);
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.~Impl_();
+}
+
+inline void* VerifyTokenResp::PlacementNew_(const void*, void* mem,
+                                        ::google::protobuf::Arena* arena) {
+  return ::new (mem) VerifyTokenResp(arena);
+}
+constexpr auto VerifyTokenResp::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(VerifyTokenResp),
+                                            alignof(VerifyTokenResp));
+}
+PROTOBUF_CONSTINIT
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::google::protobuf::internal::ClassDataFull VerifyTokenResp::_class_data_ = {
+    ::google::protobuf::internal::ClassData{
+        &_VerifyTokenResp_default_instance_._instance,
+        &_table_.header,
+        nullptr,  // OnDemandRegisterArenaDtor
+        nullptr,  // IsInitialized
+        &VerifyTokenResp::MergeImpl,
+        ::google::protobuf::Message::GetNewImpl<VerifyTokenResp>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        &VerifyTokenResp::SharedDtor,
+        ::google::protobuf::Message::GetClearImpl<VerifyTokenResp>(), &VerifyTokenResp::ByteSizeLong,
+            &VerifyTokenResp::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+        PROTOBUF_FIELD_OFFSET(VerifyTokenResp, _impl_._cached_size_),
+        false,
+    },
+    &VerifyTokenResp::kDescriptorMethods,
+    &descriptor_table_status_2eproto,
+    nullptr,  // tracker
+};
+const ::google::protobuf::internal::ClassData* VerifyTokenResp::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
+  return _class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<2, 3, 0, 0, 2> VerifyTokenResp::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    3, 24,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967288,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    3,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    _class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::status::VerifyTokenResp>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+    // int32 error = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(VerifyTokenResp, _impl_.error_), 63>(),
+     {8, 63, 0, PROTOBUF_FIELD_OFFSET(VerifyTokenResp, _impl_.error_)}},
+    // bool valid = 2;
+    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(VerifyTokenResp, _impl_.valid_), 63>(),
+     {16, 63, 0, PROTOBUF_FIELD_OFFSET(VerifyTokenResp, _impl_.valid_)}},
+    // int64 expires_at = 3;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(VerifyTokenResp, _impl_.expires_at_), 63>(),
+     {24, 63, 0, PROTOBUF_FIELD_OFFSET(VerifyTokenResp, _impl_.expires_at_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // int32 error = 1;
+    {PROTOBUF_FIELD_OFFSET(VerifyTokenResp, _impl_.error_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+    // bool valid = 2;
+    {PROTOBUF_FIELD_OFFSET(VerifyTokenResp, _impl_.valid_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kBool)},
+    // int64 expires_at = 3;
+    {PROTOBUF_FIELD_OFFSET(VerifyTokenResp, _impl_.expires_at_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt64)},
+  }},
+  // no aux_entries
+  {{
+  }},
+};
+
+PROTOBUF_NOINLINE void VerifyTokenResp::Clear() {
+// @@protoc_insertion_point(message_clear_start:status.VerifyTokenResp)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.error_, 0, static_cast<::size_t>(
+      reinterpret_cast<char*>(&_impl_.expires_at_) -
+      reinterpret_cast<char*>(&_impl_.error_)) + sizeof(_impl_.expires_at_));
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::uint8_t* VerifyTokenResp::_InternalSerialize(
+            const MessageLite& base, ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) {
+          const VerifyTokenResp& this_ = static_cast<const VerifyTokenResp&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::uint8_t* VerifyTokenResp::_InternalSerialize(
+            ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+          const VerifyTokenResp& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(serialize_to_array_start:status.VerifyTokenResp)
+          ::uint32_t cached_has_bits = 0;
+          (void)cached_has_bits;
+
+          // int32 error = 1;
+          if (this_._internal_error() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt32ToArrayWithField<1>(
+                    stream, this_._internal_error(), target);
+          }
+
+          // bool valid = 2;
+          if (this_._internal_valid() != 0) {
+            target = stream->EnsureSpace(target);
+            target = ::_pbi::WireFormatLite::WriteBoolToArray(
+                2, this_._internal_valid(), target);
+          }
+
+          // int64 expires_at = 3;
+          if (this_._internal_expires_at() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt64ToArrayWithField<3>(
+                    stream, this_._internal_expires_at(), target);
+          }
+
+          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+            target =
+                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+          }
+          // @@protoc_insertion_point(serialize_to_array_end:status.VerifyTokenResp)
+          return target;
+        }
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::size_t VerifyTokenResp::ByteSizeLong(const MessageLite& base) {
+          const VerifyTokenResp& this_ = static_cast<const VerifyTokenResp&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::size_t VerifyTokenResp::ByteSizeLong() const {
+          const VerifyTokenResp& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(message_byte_size_start:status.VerifyTokenResp)
+          ::size_t total_size = 0;
+
+          ::uint32_t cached_has_bits = 0;
+          // Prevent compiler warnings about cached_has_bits being unused
+          (void)cached_has_bits;
+
+          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+           {
+            // int32 error = 1;
+            if (this_._internal_error() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+                  this_._internal_error());
+            }
+            // bool valid = 2;
+            if (this_._internal_valid() != 0) {
+              total_size += 2;
+            }
+            // int64 expires_at = 3;
+            if (this_._internal_expires_at() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(
+                  this_._internal_expires_at());
+            }
+          }
+          return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                                     &this_._impl_._cached_size_);
+        }
+
+void VerifyTokenResp::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+  auto* const _this = static_cast<VerifyTokenResp*>(&to_msg);
+  auto& from = static_cast<const VerifyTokenResp&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:status.VerifyTokenResp)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_error() != 0) {
+    _this->_impl_.error_ = from._impl_.error_;
+  }
+  if (from._internal_valid() != 0) {
+    _this->_impl_.valid_ = from._impl_.valid_;
+  }
+  if (from._internal_expires_at() != 0) {
+    _this->_impl_.expires_at_ = from._impl_.expires_at_;
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void VerifyTokenResp::CopyFrom(const VerifyTokenResp& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:status.VerifyTokenResp)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void VerifyTokenResp::InternalSwap(VerifyTokenResp* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(VerifyTokenResp, _impl_.expires_at_)
+      + sizeof(VerifyTokenResp::_impl_.expires_at_)
+      - PROTOBUF_FIELD_OFFSET(VerifyTokenResp, _impl_.error_)>(
+          reinterpret_cast<char*>(&_impl_.error_),
+          reinterpret_cast<char*>(&other->_impl_.error_));
+}
+
+::google::protobuf::Metadata VerifyTokenResp::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class KickUserReq::_Internal {
+ public:
+};
+
+KickUserReq::KickUserReq(::google::protobuf::Arena* arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:status.KickUserReq)
+}
+inline PROTOBUF_NDEBUG_INLINE KickUserReq::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from, const ::status::KickUserReq& from_msg)
+      : uid_(arena, from.uid_),
+        _cached_size_{0} {}
+
+KickUserReq::KickUserReq(
+    ::google::protobuf::Arena* arena,
+    const KickUserReq& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  KickUserReq* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+  _impl_.reason_ = from._impl_.reason_;
+
+  // @@protoc_insertion_point(copy_constructor:status.KickUserReq)
+}
+inline PROTOBUF_NDEBUG_INLINE KickUserReq::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : uid_(arena),
+        _cached_size_{0} {}
+
+inline void KickUserReq::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.reason_ = {};
+}
+KickUserReq::~KickUserReq() {
+  // @@protoc_insertion_point(destructor:status.KickUserReq)
+  SharedDtor(*this);
+}
+inline void KickUserReq::SharedDtor(MessageLite& self) {
+  KickUserReq& this_ = static_cast<KickUserReq&>(self);
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.uid_.Destroy();
+  this_._impl_.~Impl_();
+}
+
+inline void* KickUserReq::PlacementNew_(const void*, void* mem,
+                                        ::google::protobuf::Arena* arena) {
+  return ::new (mem) KickUserReq(arena);
+}
+constexpr auto KickUserReq::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(KickUserReq),
+                                            alignof(KickUserReq));
+}
+PROTOBUF_CONSTINIT
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::google::protobuf::internal::ClassDataFull KickUserReq::_class_data_ = {
+    ::google::protobuf::internal::ClassData{
+        &_KickUserReq_default_instance_._instance,
+        &_table_.header,
+        nullptr,  // OnDemandRegisterArenaDtor
+        nullptr,  // IsInitialized
+        &KickUserReq::MergeImpl,
+        ::google::protobuf::Message::GetNewImpl<KickUserReq>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        &KickUserReq::SharedDtor,
+        ::google::protobuf::Message::GetClearImpl<KickUserReq>(), &KickUserReq::ByteSizeLong,
+            &KickUserReq::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+        PROTOBUF_FIELD_OFFSET(KickUserReq, _impl_._cached_size_),
+        false,
+    },
+    &KickUserReq::kDescriptorMethods,
+    &descriptor_table_status_2eproto,
+    nullptr,  // tracker
+};
+const ::google::protobuf::internal::ClassData* KickUserReq::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
+  return _class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<1, 2, 0, 30, 2> KickUserReq::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    2, 8,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967292,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    2,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    _class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::status::KickUserReq>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    // int32 reason = 2;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(KickUserReq, _impl_.reason_), 63>(),
+     {16, 63, 0, PROTOBUF_FIELD_OFFSET(KickUserReq, _impl_.reason_)}},
+    // string uid = 1;
+    {::_pbi::TcParser::FastUS1,
+     {10, 63, 0, PROTOBUF_FIELD_OFFSET(KickUserReq, _impl_.uid_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // string uid = 1;
+    {PROTOBUF_FIELD_OFFSET(KickUserReq, _impl_.uid_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // int32 reason = 2;
+    {PROTOBUF_FIELD_OFFSET(KickUserReq, _impl_.reason_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+  }},
+  // no aux_entries
+  {{
+    "\22\3\0\0\0\0\0\0"
+    "status.KickUserReq"
+    "uid"
+  }},
+};
+
+PROTOBUF_NOINLINE void KickUserReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:status.KickUserReq)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.uid_.ClearToEmpty();
+  _impl_.reason_ = 0;
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
 
@@ -5192,9 +6057,9 @@ NodeInfo::NodeInfo(
                offsetof(Impl_, server_port_),
            reinterpret_cast<const char *>(&from._impl_) +
                offsetof(Impl_, server_port_),
-           offsetof(Impl_, capacity_) -
+           offsetof(Impl_, cpu_) -
                offsetof(Impl_, server_port_) +
-               sizeof(Impl_::capacity_));
+               sizeof(Impl_::cpu_));
 
   // @@protoc_insertion_point(copy_constructor:status.NodeInfo)
 }
@@ -5210,9 +6075,9 @@ inline void NodeInfo::SharedCtor(::_pb::Arena* arena) {
   ::memset(reinterpret_cast<char *>(&_impl_) +
                offsetof(Impl_, server_port_),
            0,
-           offsetof(Impl_, capacity_) -
+           offsetof(Impl_, cpu_) -
                offsetof(Impl_, server_port_) +
-               sizeof(Impl_::capacity_));
+               sizeof(Impl_::cpu_));
 }
 NodeInfo::~NodeInfo() {
   // @@protoc_insertion_point(destructor:status.NodeInfo)
@@ -5263,15 +6128,15 @@ const ::google::protobuf::internal::ClassData* NodeInfo::GetClassData() const {
   return _class_data_.base();
 }
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<3, 6, 0, 39, 2> NodeInfo::_table_ = {
+const ::_pbi::TcParseTable<4, 11, 0, 47, 2> NodeInfo::_table_ = {
   {
     0,  // no _has_bits_
     0, // no _extensions_
-    6, 56,  // max_field_number, fast_idx_mask
+    11, 120,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
-    4294967232,  // skipmap
+    4294965248,  // skipmap
     offsetof(decltype(_table_), field_entries),
-    6,  // num_field_entries
+    11,  // num_field_entries
     0,  // num_aux_entries
     offsetof(decltype(_table_), field_names),  // no aux_entries
     _class_data_.base(),
@@ -5300,6 +6165,24 @@ const ::_pbi::TcParseTable<3, 6, 0, 39, 2> NodeInfo::_table_ = {
     // int64 last_heartbeat = 6;
     {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(NodeInfo, _impl_.last_heartbeat_), 63>(),
      {48, 63, 0, PROTOBUF_FIELD_OFFSET(NodeInfo, _impl_.last_heartbeat_)}},
+    // int32 rpc_port = 7;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(NodeInfo, _impl_.rpc_port_), 63>(),
+     {56, 63, 0, PROTOBUF_FIELD_OFFSET(NodeInfo, _impl_.rpc_port_)}},
+    // bool measured = 8;
+    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(NodeInfo, _impl_.measured_), 63>(),
+     {64, 63, 0, PROTOBUF_FIELD_OFFSET(NodeInfo, _impl_.measured_)}},
+    // int32 sessions = 9;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(NodeInfo, _impl_.sessions_), 63>(),
+     {72, 63, 0, PROTOBUF_FIELD_OFFSET(NodeInfo, _impl_.sessions_)}},
+    // int32 queue_depth = 10;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(NodeInfo, _impl_.queue_depth_), 63>(),
+     {80, 63, 0, PROTOBUF_FIELD_OFFSET(NodeInfo, _impl_.queue_depth_)}},
+    // int32 cpu = 11;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(NodeInfo, _impl_.cpu_), 63>(),
+     {88, 63, 0, PROTOBUF_FIELD_OFFSET(NodeInfo, _impl_.cpu_)}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
     {::_pbi::TcParser::MiniParse, {}},
   }}, {{
     65535, 65535
@@ -5322,10 +6205,25 @@ const ::_pbi::TcParseTable<3, 6, 0, 39, 2> NodeInfo::_table_ = {
     // int64 last_heartbeat = 6;
     {PROTOBUF_FIELD_OFFSET(NodeInfo, _impl_.last_heartbeat_), 0, 0,
     (0 | ::_fl::kFcSingular | ::_fl::kInt64)},
+    // int32 rpc_port = 7;
+    {PROTOBUF_FIELD_OFFSET(NodeInfo, _impl_.rpc_port_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+    // bool measured = 8;
+    {PROTOBUF_FIELD_OFFSET(NodeInfo, _impl_.measured_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kBool)},
+    // int32 sessions = 9;
+    {PROTOBUF_FIELD_OFFSET(NodeInfo, _impl_.sessions_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+    // int32 queue_depth = 10;
+    {PROTOBUF_FIELD_OFFSET(NodeInfo, _impl_.queue_depth_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+    // int32 cpu = 11;
+    {PROTOBUF_FIELD_OFFSET(NodeInfo, _impl_.cpu_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
   }},
   // no aux_entries
   {{
-    "\17\4\13\0\0\0\0\0"
+    "\17\4\13\0\0\0\0\0\0\0\0\0\0\0\0\0"
     "status.NodeInfo"
     "name"
     "server_host"
@@ -5342,8 +6240,8 @@ PROTOBUF_NOINLINE void NodeInfo::Clear() {
   _impl_.name_.ClearToEmpty();
   _impl_.server_host_.ClearToEmpty();
   ::memset(&_impl_.server_port_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.capacity_) -
-      reinterpret_cast<char*>(&_impl_.server_port_)) + sizeof(_impl_.capacity_));
+      reinterpret_cast<char*>(&_impl_.cpu_) -
+      reinterpret_cast<char*>(&_impl_.server_port_)) + sizeof(_impl_.cpu_));
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
 
@@ -5406,6 +6304,41 @@ PROTOBUF_NOINLINE void NodeInfo::Clear() {
                     stream, this_._internal_last_heartbeat(), target);
           }
 
+          // int32 rpc_port = 7;
+          if (this_._internal_rpc_port() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt32ToArrayWithField<7>(
+                    stream, this_._internal_rpc_port(), target);
+          }
+
+          // bool measured = 8;
+          if (this_._internal_measured() != 0) {
+            target = stream->EnsureSpace(target);
+            target = ::_pbi::WireFormatLite::WriteBoolToArray(
+                8, this_._internal_measured(), target);
+          }
+
+          // int32 sessions = 9;
+          if (this_._internal_sessions() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt32ToArrayWithField<9>(
+                    stream, this_._internal_sessions(), target);
+          }
+
+          // int32 queue_depth = 10;
+          if (this_._internal_queue_depth() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt32ToArrayWithField<10>(
+                    stream, this_._internal_queue_depth(), target);
+          }
+
+          // int32 cpu = 11;
+          if (this_._internal_cpu() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt32ToArrayWithField<11>(
+                    stream, this_._internal_cpu(), target);
+          }
+
           if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
             target =
                 ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
@@ -5461,6 +6394,30 @@ PROTOBUF_NOINLINE void NodeInfo::Clear() {
               total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
                   this_._internal_capacity());
             }
+            // int32 rpc_port = 7;
+            if (this_._internal_rpc_port() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+                  this_._internal_rpc_port());
+            }
+            // bool measured = 8;
+            if (this_._internal_measured() != 0) {
+              total_size += 2;
+            }
+            // int32 sessions = 9;
+            if (this_._internal_sessions() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+                  this_._internal_sessions());
+            }
+            // int32 queue_depth = 10;
+            if (this_._internal_queue_depth() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+                  this_._internal_queue_depth());
+            }
+            // int32 cpu = 11;
+            if (this_._internal_cpu() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+                  this_._internal_cpu());
+            }
           }
           return this_.MaybeComputeUnknownFieldsSize(total_size,
                                                      &this_._impl_._cached_size_);
@@ -5492,6 +6449,21 @@ void NodeInfo::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google
   if (from._internal_capacity() != 0) {
     _this->_impl_.capacity_ = from._impl_.capacity_;
   }
+  if (from._internal_rpc_port() != 0) {
+    _this->_impl_.rpc_port_ = from._impl_.rpc_port_;
+  }
+  if (from._internal_measured() != 0) {
+    _this->_impl_.measured_ = from._impl_.measured_;
+  }
+  if (from._internal_sessions() != 0) {
+    _this->_impl_.sessions_ = from._impl_.sessions_;
+  }
+  if (from._internal_queue_depth() != 0) {
+    _this->_impl_.queue_depth_ = from._impl_.queue_depth_;
+  }
+  if (from._internal_cpu() != 0) {
+    _this->_impl_.cpu_ = from._impl_.cpu_;
+  }
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -5511,8 +6483,8 @@ void NodeInfo::InternalSwap(NodeInfo* PROTOBUF_RESTRICT other) {
   ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.name_, &other->_impl_.name_, arena);
   ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.server_host_, &other->_impl_.server_host_, arena);
   ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(NodeInfo, _impl_.capacity_)
-      + sizeof(NodeInfo::_impl_.capacity_)
+      PROTOBUF_FIELD_OFFSET(NodeInfo, _impl_.cpu_)
+      + sizeof(NodeInfo::_impl_.cpu_)
       - PROTOBUF_FIELD_OFFSET(NodeInfo, _impl_.server_port_)>(
           reinterpret_cast<char*>(&_impl_.server_port_),
           reinterpret_cast<char*>(&other->_impl_.server_port_));
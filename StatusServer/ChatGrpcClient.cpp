@@ -1,7 +1,7 @@
 #include "ChatGrpcClient.h"
 #include "Logger.h"
 
-chat::KickUserResp ChatGrpcClient::KickUser(const std::string& host, int port, const std::string& uid, int reason)
+chat::KickUserResp ChatGrpcClient::KickUser(const std::string& host, int port, const std::string& uid, int reason, long long generation)
 {
 	grpc::ClientContext ctx;
 	chat::KickUserReq req;
@@ -9,6 +9,7 @@ chat::KickUserResp ChatGrpcClient::KickUser(const std::string& host, int port, c
 
 	req.set_uid(uid);
 	req.set_reason(reason);
+	req.set_generation(generation);
 
 	auto pool = initPool(host, port);
 	auto stub = pool->GetConnection();
@@ -26,6 +27,37 @@ chat::KickUserResp ChatGrpcClient::KickUser(const std::string& host, int port, c
 	return resp;
 }
 
+chat::KickUsersResp ChatGrpcClient::KickUsers(const std::string& host, int port, const std::vector<chat::KickUserReq>& kicks, std::chrono::milliseconds deadline)
+{
+	grpc::ClientContext ctx;
+	ctx.set_deadline(std::chrono::system_clock::now() + deadline);
+	chat::KickUsersReq req;
+	chat::KickUsersResp resp;
+
+	for (const auto& kick : kicks) {
+		*req.add_kicks() = kick;
+	}
+
+	auto pool = initPool(host, port);
+	auto stub = pool->GetConnection();
+	if (!stub) {
+		resp.set_error(1);
+		return resp;
+	}
+
+	auto status = stub->KickUsers(&ctx, req, &resp);
+	pool->ReturnConnection(std::move(stub));
+
+	if (!status.ok()) {
+		LOG_ERROR("ChatGrpcClient KickUsers RPC failed to {}:{}, error msg is {}", host, port, status.error_message());
+		resp.set_error(1);
+	}
+	else {
+		LOG_INFO("ChatGrpcClient KickUsers success to {}:{} - kicked {} of {}", host, port, resp.kicked(), kicks.size());
+	}
+	return resp;
+}
+
 ChatGrpcClient::ChatGrpcClient()
 {
 
@@ -1,4 +1,7 @@
 #pragma once
+#include <chrono>
+#include <utility>
+#include <vector>
 #include <grpcpp/grpcpp.h>
 #include "chat.grpc.pb.h"
 #include "Singleton.h"
@@ -11,7 +14,9 @@ class ChatGrpcClient: public Singleton<ChatGrpcClient>
 	friend class Singleton<ChatGrpcClient>;
 
 public:
-	chat::KickUserResp KickUser(const std::string& host, int port, const std::string& uid, int reason);
+	chat::KickUserResp KickUser(const std::string& host, int port, const std::string& uid, int reason, long long generation);
+	// error is set if the call failed or missed its deadline
+	chat::KickUsersResp KickUsers(const std::string& host, int port, const std::vector<chat::KickUserReq>& kicks, std::chrono::milliseconds deadline);
 private:
 	ChatGrpcClient();
 
@@ -0,0 +1,76 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * @class CircuitBreaker
+ * @brief Fails calls to a dependency fast while it is known to be broken.
+ *
+ * Closed: everything passes and outcomes fill a window of the last
+ * `window` calls. Once it holds at least `minCalls` outcomes and
+ * `failurePercent` of them failed, the breaker opens and rejects calls for
+ * `openTime`. It then goes half-open and lets one trial call through at a time
+ * (another after `openTime` if a trial never reports back); `trials`
+ * successes close it, any failure opens it again.
+ *
+ * A window of 0 disables the breaker.
+ */
+class CircuitBreaker
+{
+public:
+	enum class State { CLOSED, OPEN, HALF_OPEN };
+
+	struct Options {
+		std::size_t window = 20;
+		std::size_t minCalls = 10;
+		int failurePercent = 50;
+		std::chrono::milliseconds openTime{ 2000 };
+		std::size_t trials = 3;
+	};
+
+	CircuitBreaker(const std::string& name, const Options& options);
+
+	CircuitBreaker(const CircuitBreaker&) = delete;
+	CircuitBreaker& operator=(const CircuitBreaker&) = delete;
+
+	/**
+	 * @brief Whether a call may go ahead; false means fail it without trying
+	 */
+	bool Allow();
+
+	void OnSuccess();
+	void OnFailure();
+
+	State GetState() const;
+	uint64_t Rejected() const;
+
+	static const char* StateName(State state);
+
+private:
+	using Clock = std::chrono::steady_clock;
+
+	void Record(bool failed);
+	void Open();
+	void Close();
+
+	std::string _name;
+	Options _options;
+
+	// read without the lock on the hot path
+	std::atomic<State> _state;
+	std::atomic<uint64_t> _rejected;
+
+	mutable std::mutex _mutex;
+	std::vector<bool> _outcomes;
+	std::size_t _next;
+	std::size_t _count;
+	std::size_t _failures;
+	Clock::time_point _openedAt;
+	Clock::time_point _trialStartedAt;
+	bool _trialInFlight;
+	std::size_t _trialSuccesses;
+};
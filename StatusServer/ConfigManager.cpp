@@ -77,3 +77,18 @@ SectionInfo ConfigManager::operator[](const std::string& section)
 	return _configMap[section];
 }
 
+int ConfigManager::getIntValue(const std::string& section, const std::string& key, int defaultValue)
+{
+	auto value = (*this)[section][key];
+	if (value.empty()) {
+		return defaultValue;
+	}
+
+	try {
+		return std::stoi(value);
+	}
+	catch (const std::exception&) {
+		LOG_WARN("Invalid integer for [{}] {}: {}, using {}", section, key, value, defaultValue);
+		return defaultValue;
+	}
+}
@@ -23,6 +23,8 @@ public:
 	ConfigManager(const ConfigManager&) = delete;
 	ConfigManager& operator=(const ConfigManager&) = delete;
 
+	int getIntValue(const std::string& section, const std::string& key, int defaultValue);
+
 	SectionInfo operator[](const std::string&);
 
 private:
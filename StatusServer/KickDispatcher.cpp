@@ -0,0 +1,224 @@
+#include "KickDispatcher.h"
+#include "ChatGrpcClient.h"
+#include "ConfigManager.h"
+#include "Logger.h"
+
+#include <algorithm>
+
+KickDispatcher::KickDispatcher() : _queued(0), _stats{}, _lastLog(Clock::now()), _b_stop(false)
+{
+	auto& cfg = ConfigManager::GetInstance();
+	int workers = std::max(1, cfg.getIntValue("KickDispatcher", "Workers", 4));
+	_maxQueued = static_cast<std::size_t>(std::max(1, cfg.getIntValue("KickDispatcher", "MaxQueued", 10000)));
+	_maxBatch = static_cast<std::size_t>(std::max(1, cfg.getIntValue("KickDispatcher", "MaxBatch", 256)));
+	_maxRetries = std::max(0, cfg.getIntValue("KickDispatcher", "MaxRetries", 3));
+	_deadline = std::chrono::milliseconds(std::max(1, cfg.getIntValue("KickDispatcher", "DeadlineMs", 2000)));
+	_retryDelay = std::chrono::milliseconds(std::max(1, cfg.getIntValue("KickDispatcher", "RetryDelayMs", 200)));
+	_statsInterval = std::chrono::seconds(std::max(1, cfg.getIntValue("KickDispatcher", "StatsSec", 60)));
+
+	LOG_INFO("Kick dispatcher - workers: {}, max queued: {}, max batch: {}, deadline: {}ms, retries: {}",
+		workers, _maxQueued, _maxBatch, _deadline.count(), _maxRetries);
+	for (int i = 0; i < workers; ++i) {
+		_workers.emplace_back(&KickDispatcher::Run, this);
+	}
+}
+
+KickDispatcher::~KickDispatcher()
+{
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_b_stop = true;
+		if (_queued > 0) {
+			LOG_WARN("Kick dispatcher stopping with {} kicks unsent", _queued);
+		}
+	}
+	_cond.notify_all();
+	for (auto& worker : _workers) {
+		if (worker.joinable()) {
+			worker.join();
+		}
+	}
+}
+
+bool KickDispatcher::Post(const std::string& host, int port, const std::string& uid, int reason, long long generation)
+{
+	auto key = host + ":" + std::to_string(port);
+	std::lock_guard<std::mutex> lock(_mutex);
+	if (_b_stop) {
+		return false;
+	}
+	++_stats.posted;
+
+	auto& destination = _destinations[key];
+	auto iter = destination.pending.find(uid);
+	if (iter != destination.pending.end()) {
+		iter->second.reason = reason;
+		iter->second.generation = generation;
+		++_stats.coalesced;
+		return true;
+	}
+	if (_queued >= _maxQueued) {
+		// one line per thousand: a storm is exactly when the log must not flood
+		if (_stats.dropped++ % 1000 == 0) {
+			LOG_WARN("Kick queue full ({} kicks), dropping kick of uid={} on {}, dropped so far: {}",
+				_queued, uid, key, _stats.dropped);
+		}
+		return false;
+	}
+
+	destination.host = host;
+	destination.port = port;
+	destination.pending.emplace(uid, Kick{ reason, generation, 0 });
+	++_queued;
+	ScheduleLocked(key, destination);
+	return true;
+}
+
+void KickDispatcher::Cancel(const std::string& host, int port, const std::string& uid)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	auto iter = _destinations.find(host + ":" + std::to_string(port));
+	if (iter == _destinations.end()) {
+		return;
+	}
+	auto& destination = iter->second;
+	if (destination.pending.erase(uid) > 0) {
+		--_queued;
+		LOG_DEBUG("Cancelled queued kick of uid={} on {}:{}", uid, host, port);
+	}
+	if (destination.inFlight) {
+		destination.cancelled.insert(uid);
+	}
+}
+
+KickDispatcher::Stats KickDispatcher::GetStats()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	auto stats = _stats;
+	stats.queued = _queued;
+	return stats;
+}
+
+void KickDispatcher::ScheduleLocked(const std::string& key, Destination& destination)
+{
+	if (destination.scheduled || destination.inFlight || destination.pending.empty()) {
+		return;
+	}
+
+	destination.scheduled = true;
+	if (Clock::now() >= destination.notBefore) {
+		_ready.push_back(key);
+	}
+	else {
+		_delayed.emplace(destination.notBefore, key);
+	}
+	// also wakes a worker sleeping until a later retry
+	_cond.notify_one();
+}
+
+void KickDispatcher::Run()
+{
+	std::unique_lock<std::mutex> lock(_mutex);
+	while (!_b_stop) {
+		auto now = Clock::now();
+		while (!_delayed.empty() && _delayed.begin()->first <= now) {
+			_ready.push_back(_delayed.begin()->second);
+			_delayed.erase(_delayed.begin());
+		}
+		if (_ready.empty()) {
+			if (_delayed.empty()) {
+				_cond.wait(lock);
+			}
+			else {
+				_cond.wait_until(lock, _delayed.begin()->first);
+			}
+			continue;
+		}
+
+		auto key = _ready.front();
+		_ready.pop_front();
+		auto& destination = _destinations[key];
+		destination.scheduled = false;
+		destination.inFlight = true;
+
+		std::unordered_map<std::string, Kick> batch;
+		for (auto iter = destination.pending.begin(); iter != destination.pending.end() && batch.size() < _maxBatch;) {
+			batch.insert(*iter);
+			iter = destination.pending.erase(iter);
+		}
+		_queued -= batch.size();
+		auto host = destination.host;
+		auto port = destination.port;
+
+		lock.unlock();
+		bool ok = Send(host, port, batch);
+		lock.lock();
+
+		destination.inFlight = false;
+		++_stats.calls;
+		if (ok) {
+			destination.failures = 0;
+			_stats.sent += batch.size();
+		}
+		else {
+			++destination.failures;
+			destination.notBefore = Clock::now() + _retryDelay * (1 << std::min(destination.failures - 1, 6));
+			for (auto& [uid, kick] : batch) {
+				if (destination.cancelled.count(uid) > 0) {
+					continue;
+				}
+				if (++kick.attempts > _maxRetries) {
+					++_stats.failed;
+					LOG_WARN("Giving up kicking uid={} on {} after {} attempts", uid, key, kick.attempts);
+					continue;
+				}
+				// a kick posted meanwhile carries the newer reason
+				if (destination.pending.count(uid) > 0) {
+					continue;
+				}
+				if (_queued >= _maxQueued) {
+					++_stats.dropped;
+					continue;
+				}
+				destination.pending.emplace(uid, kick);
+				++_queued;
+				++_stats.retried;
+			}
+		}
+		destination.cancelled.clear();
+		ScheduleLocked(key, destination);
+
+		if (Clock::now() - _lastLog >= _statsInterval) {
+			LogStatsLocked();
+		}
+	}
+}
+
+bool KickDispatcher::Send(const std::string& host, int port, const std::unordered_map<std::string, Kick>& batch)
+{
+	std::vector<chat::KickUserReq> kicks;
+	kicks.reserve(batch.size());
+	for (const auto& [uid, kick] : batch) {
+		chat::KickUserReq req;
+		req.set_uid(uid);
+		req.set_reason(kick.reason);
+		req.set_generation(kick.generation);
+		kicks.push_back(std::move(req));
+	}
+
+	try {
+		auto resp = ChatGrpcClient::GetInstance()->KickUsers(host, port, kicks, _deadline);
+		return resp.error() == 0;
+	}
+	catch (const std::exception& e) {
+		LOG_WARN("Kick call to {}:{} failed: {}", host, port, e.what());
+		return false;
+	}
+}
+
+void KickDispatcher::LogStatsLocked()
+{
+	_lastLog = Clock::now();
+	LOG_INFO("Kick dispatcher - posted: {}, coalesced: {}, dropped: {}, calls: {}, sent: {}, retried: {}, failed: {}, queued: {}",
+		_stats.posted, _stats.coalesced, _stats.dropped, _stats.calls, _stats.sent, _stats.retried, _stats.failed, _queued);
+}
@@ -0,0 +1,112 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * @class KickDispatcher
+ * @brief Sends repeated-login kicks to ChatServers from a fixed set of workers.
+ *
+ * Post() only queues the kick. Each kick names the session it is meant for
+ * by its generation, so it can't close a newer login of the same user on
+ * that server. Kicks are grouped by destination: a user kicked twice before
+ * the first one went out is kicked once (with the latest reason and
+ * generation), and each ChatServer gets at most one KickUsers call in flight,
+ * carrying up to MaxBatch users. Calls time out after DeadlineMs; the kicks
+ * of a failed call are retried up to MaxRetries times, with the destination
+ * backing off RetryDelayMs doubled per consecutive failure. At most MaxQueued
+ * kicks wait at once; beyond that Post() drops the kick.
+ */
+class KickDispatcher
+{
+public:
+	struct Stats {
+		uint64_t posted;
+		uint64_t coalesced; // merged into a kick already queued
+		uint64_t dropped;   // queue full
+		uint64_t calls;
+		uint64_t sent;      // kicks delivered
+		uint64_t retried;
+		uint64_t failed;    // given up after MaxRetries
+		std::size_t queued;
+	};
+
+	KickDispatcher();
+	~KickDispatcher();
+
+	KickDispatcher(const KickDispatcher&) = delete;
+	KickDispatcher& operator=(const KickDispatcher&) = delete;
+
+	/**
+	 * @brief Queue a kick of uid on the ChatServer whose ChatService listens on host:port
+	 *
+	 * @param generation of the session to kick, as reported online; 0 for any
+	 * @return false if the queue is full and the kick was dropped
+	 */
+	bool Post(const std::string& host, int port, const std::string& uid, int reason, long long generation);
+
+	/**
+	 * @brief Forget a kick of uid on host:port, e.g. because uid was just allocated there again
+	 *
+	 * A kick already being sent still arrives, but is not retried if that call fails.
+	 */
+	void Cancel(const std::string& host, int port, const std::string& uid);
+
+	Stats GetStats();
+
+private:
+	using Clock = std::chrono::steady_clock;
+
+	struct Kick {
+		int reason;
+		long long generation;
+		int attempts;
+	};
+
+	struct Destination {
+		std::string host;
+		int port = 0;
+		std::unordered_map<std::string, Kick> pending; // uid -> kick
+		bool scheduled = false; // in _ready or _delayed
+		bool inFlight = false;
+		// uids cancelled while inFlight, left out if the call has to be retried
+		std::unordered_set<std::string> cancelled;
+		int failures = 0; // consecutive failed calls
+		Clock::time_point notBefore;
+	};
+
+	void Run();
+	// caller holds _mutex
+	void ScheduleLocked(const std::string& key, Destination& destination);
+	bool Send(const std::string& host, int port, const std::unordered_map<std::string, Kick>& batch);
+	void LogStatsLocked();
+
+	std::size_t _maxQueued;
+	std::size_t _maxBatch;
+	int _maxRetries;
+	std::chrono::milliseconds _deadline;
+	std::chrono::milliseconds _retryDelay;
+	std::chrono::seconds _statsInterval;
+
+	std::mutex _mutex;
+	std::condition_variable _cond;
+	// "host:port"; entries are never erased, so references to them stay valid
+	std::unordered_map<std::string, Destination> _destinations;
+	std::deque<std::string> _ready;
+	std::multimap<Clock::time_point, std::string> _delayed;
+	std::size_t _queued;
+	Stats _stats;
+	Clock::time_point _lastLog;
+
+	bool _b_stop;
+	std::vector<std::thread> _workers;
+};
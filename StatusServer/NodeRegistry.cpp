@@ -0,0 +1,372 @@
+#include "NodeRegistry.h"
+#include "ConfigManager.h"
+#include "Logger.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+	long long NowSeconds()
+	{
+		return std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+	}
+}
+
+NodeRegistry::NodeRegistry() : _snapshot(std::make_shared<const Snapshot>()), _totalLoad(0), _rrIndex(0), _b_stop(false)
+{
+	auto& cfg = ConfigManager::GetInstance();
+	_staleSec = std::max(1, cfg.getIntValue("StatusServer", "NodeStaleSec", 60));
+	_evictInterval = std::chrono::seconds(std::max(1, cfg.getIntValue("StatusServer", "EvictIntervalSec", 5)));
+	_virtualNodes = std::max(1, cfg.getIntValue("StatusServer", "VirtualNodes", 160));
+	_loadBound = 1.0 + std::max(0, cfg.getIntValue("StatusServer", "LoadBoundPct", 25)) / 100.0;
+	_alpha = std::clamp(cfg.getIntValue("StatusServer", "MetricsAlphaPct", 30), 1, 100) / 100.0;
+	_queueHigh = std::max(1, cfg.getIntValue("StatusServer", "QueueHigh", 1000));
+
+	LOG_INFO("Node registry - stale after: {}s, eviction every: {}s, virtual nodes: {}, load bound: {}, metrics alpha: {}, queue high: {}",
+		_staleSec, _evictInterval.count(), _virtualNodes, _loadBound, _alpha, _queueHigh);
+	_evictor = std::thread(&NodeRegistry::EvictLoop, this);
+}
+
+NodeRegistry::~NodeRegistry()
+{
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_b_stop = true;
+	}
+	_cond.notify_all();
+	if (_evictor.joinable()) {
+		_evictor.join();
+	}
+}
+
+void NodeRegistry::Upsert(const status::RegisterNodeReq& req)
+{
+	std::lock_guard<std::mutex> writeLock(_writeMutex);
+	std::lock_guard<std::mutex> loadLock(_loadMutex);
+	auto current = Current();
+
+	auto node = std::make_shared<NodeInfo>();
+	node->name = req.name();
+	node->host = req.server_host();
+	node->port = req.server_port();
+	node->rpc_port = req.rpc_port();
+	node->capacity = req.capacity() > 0 ? req.capacity() : 100;
+	node->last_heartbeat = NowSeconds();
+
+	std::vector<NodePtr> nodes;
+	nodes.reserve(current->nodes.size() + 1);
+	for (const auto& existing : current->nodes) {
+		if (existing->name != node->name) {
+			nodes.push_back(existing);
+			continue;
+		}
+		// same node again: keep its reservations, move it to its new place in the order
+		node->capacity = req.capacity() > 0 ? req.capacity() : existing->capacity;
+		node->current_load = existing->current_load.load();
+		node->reserved_since_report = existing->reserved_since_report.load();
+		node->reported = existing->reported.load();
+		node->sessions = existing->sessions.load();
+		node->queue_depth = existing->queue_depth.load();
+		node->cpu = existing->cpu.load();
+		_byLoad.erase(KeyOf(*existing));
+	}
+	nodes.push_back(node);
+	_byLoad.insert(KeyOf(*node));
+	PublishLocked(nodes);
+}
+
+void NodeRegistry::Remove(const std::string& name)
+{
+	std::lock_guard<std::mutex> writeLock(_writeMutex);
+	std::lock_guard<std::mutex> loadLock(_loadMutex);
+	auto current = Current();
+
+	auto iter = current->byName.find(name);
+	if (iter == current->byName.end()) {
+		return;
+	}
+	_byLoad.erase(KeyOf(*iter->second));
+	_totalLoad -= iter->second->current_load.load();
+
+	std::vector<NodePtr> nodes;
+	nodes.reserve(current->nodes.size());
+	for (const auto& existing : current->nodes) {
+		if (existing->name != name) {
+			nodes.push_back(existing);
+		}
+	}
+	PublishLocked(nodes);
+}
+
+bool NodeRegistry::Touch(const std::string& host, int port)
+{
+	auto current = Current();
+	auto iter = current->byEndpoint.find(Endpoint(host, port));
+	if (iter == current->byEndpoint.end()) {
+		return false;
+	}
+	iter->second->last_heartbeat = NowSeconds();
+	return true;
+}
+
+bool NodeRegistry::Report(const std::string& host, int port, const status::HeartbeatReq& heartbeat)
+{
+	auto current = Current();
+	auto iter = current->byEndpoint.find(Endpoint(host, port));
+	if (iter == current->byEndpoint.end()) {
+		return false;
+	}
+	iter->second->last_heartbeat = NowSeconds();
+
+	std::lock_guard<std::mutex> lock(_loadMutex);
+	// removed or re-registered since the lookup: its place in _byLoad is gone
+	auto latest = Current();
+	auto live = latest->byName.find(iter->second->name);
+	if (live == latest->byName.end() || live->second != iter->second) {
+		return true;
+	}
+
+	auto& node = *iter->second;
+	_byLoad.erase(KeyOf(node));
+	double alpha = node.reported.load() ? _alpha : 1.0;
+	auto smooth = [alpha](std::atomic<double>& value, double sample) {
+		value = alpha * sample + (1.0 - alpha) * value.load();
+	};
+	smooth(node.sessions, heartbeat.sessions());
+	smooth(node.queue_depth, heartbeat.queue_depth());
+	smooth(node.cpu, heartbeat.cpu());
+	node.reported = true;
+
+	// the node's own count also sees logouts and logins we never heard about; users
+	// allocated since the last report may not be connected yet, so they are kept on top
+	int measured = std::max(0, heartbeat.sessions()) + node.reserved_since_report.exchange(0);
+	_totalLoad += measured - node.current_load.load();
+	node.current_load = measured;
+	_byLoad.insert(KeyOf(node));
+	return true;
+}
+
+NodeRegistry::NodePtr NodeRegistry::Find(const std::string& name) const
+{
+	auto current = Current();
+	auto iter = current->byName.find(name);
+	if (iter == current->byName.end() || IsStale(*iter->second, NowSeconds())) {
+		return nullptr;
+	}
+	return iter->second;
+}
+
+NodeRegistry::NodePtr NodeRegistry::AcquireLeastLoaded()
+{
+	auto now = NowSeconds();
+	std::lock_guard<std::mutex> lock(_loadMutex);
+	// the snapshot is only replaced under _loadMutex, so it matches _byLoad
+	auto current = Current();
+	return AcquireLeastLoadedLocked(*current, now);
+}
+
+NodeRegistry::NodePtr NodeRegistry::AcquireForKey(const std::string& key)
+{
+	auto now = NowSeconds();
+	std::lock_guard<std::mutex> lock(_loadMutex);
+	auto current = Current();
+	if (current->ring.empty()) {
+		return nullptr;
+	}
+
+	// the load once this key is placed, shared out by capacity
+	double share = _loadBound * static_cast<double>(_totalLoad + 1) / std::max(1LL, current->totalCapacity);
+	auto point = Hash(key);
+	auto iter = std::lower_bound(current->ring.begin(), current->ring.end(), point,
+		[](const std::pair<uint64_t, NodePtr>& entry, uint64_t value) {
+			return entry.first < value;
+		}
+	);
+	for (std::size_t step = 0; step < current->ring.size(); ++step, ++iter) {
+		if (iter == current->ring.end()) {
+			iter = current->ring.begin();
+		}
+		auto& node = iter->second;
+		if (IsStale(*node, now)) {
+			continue;
+		}
+		if (node->current_load.load() < std::ceil(share * node->capacity)) {
+			ReserveLocked(*node);
+			return node;
+		}
+	}
+
+	LOG_WARN("No node under the load bound for key {}, using the least-loaded one", key);
+	return AcquireLeastLoadedLocked(*current, now);
+}
+
+NodeRegistry::NodePtr NodeRegistry::AcquireLeastLoadedLocked(const Snapshot& current, long long nowSec)
+{
+	if (current.nodes.empty()) {
+		return nullptr;
+	}
+
+	NodePtr chosen;
+	for (const auto& key : _byLoad) {
+		auto& node = current.byName.at(key.second);
+		// stale nodes wait for the sweep; usually there are none to skip
+		if (!IsStale(*node, nowSec)) {
+			chosen = node;
+			break;
+		}
+	}
+	if (!chosen) {
+		chosen = current.nodes[_rrIndex++ % current.nodes.size()];
+	}
+
+	ReserveLocked(*chosen);
+	return chosen;
+}
+
+void NodeRegistry::ReserveLocked(NodeInfo& node)
+{
+	_byLoad.erase(KeyOf(node));
+	node.current_load.fetch_add(1);
+	node.reserved_since_report.fetch_add(1);
+	_byLoad.insert(KeyOf(node));
+	++_totalLoad;
+}
+
+void NodeRegistry::Release(const std::string& name)
+{
+	std::lock_guard<std::mutex> lock(_loadMutex);
+	auto current = Current();
+	auto iter = current->byName.find(name);
+	if (iter == current->byName.end() || iter->second->current_load.load() <= 0) {
+		return;
+	}
+
+	auto& node = *iter->second;
+	_byLoad.erase(KeyOf(node));
+	node.current_load.fetch_sub(1);
+	_byLoad.insert(KeyOf(node));
+	--_totalLoad;
+}
+
+std::vector<NodeRegistry::NodePtr> NodeRegistry::List() const
+{
+	return Current()->nodes;
+}
+
+bool NodeRegistry::IsStale(const NodeInfo& node, long long nowSec) const
+{
+	return nowSec - node.last_heartbeat.load() > _staleSec;
+}
+
+std::shared_ptr<const NodeRegistry::Snapshot> NodeRegistry::Current() const
+{
+	return std::atomic_load(&_snapshot);
+}
+
+void NodeRegistry::PublishLocked(const std::vector<NodePtr>& nodes)
+{
+	auto next = std::make_shared<Snapshot>();
+	next->nodes = nodes;
+	// keep deterministic ordering
+	std::sort(next->nodes.begin(), next->nodes.end(),
+		[](const NodePtr& a, const NodePtr& b) {
+			return a->name < b->name;
+		}
+	);
+	for (const auto& node : next->nodes) {
+		next->byName[node->name] = node;
+		next->byEndpoint[Endpoint(node->host, node->port)] = node;
+		next->totalCapacity += std::max(1, node->capacity);
+		// points depend on the name only, so other nodes keep theirs
+		for (int v = 0; v < _virtualNodes; ++v) {
+			next->ring.emplace_back(Hash(node->name + "#" + std::to_string(v)), node);
+		}
+	}
+	std::sort(next->ring.begin(), next->ring.end(),
+		[](const std::pair<uint64_t, NodePtr>& a, const std::pair<uint64_t, NodePtr>& b) {
+			return a.first < b.first || (a.first == b.first && a.second->name < b.second->name);
+		}
+	);
+	std::atomic_store(&_snapshot, std::shared_ptr<const Snapshot>(std::move(next)));
+}
+
+NodeRegistry::LoadKey NodeRegistry::KeyOf(const NodeInfo& node) const
+{
+	double load = static_cast<double>(node.current_load.load()) / std::max(1, node.capacity);
+	if (node.reported.load()) {
+		load = std::max({ load, node.cpu.load() / 100.0, node.queue_depth.load() / _queueHigh });
+	}
+	return LoadKey(load, node.name);
+}
+
+uint64_t NodeRegistry::Hash(const std::string& data)
+{
+	// FNV-1a with a murmur finalizer, as for the Redis ring: stable across runs and platforms
+	uint64_t hash = 14695981039346656037ULL;
+	for (unsigned char c : data) {
+		hash ^= c;
+		hash *= 1099511628211ULL;
+	}
+	hash ^= hash >> 33;
+	hash *= 0xff51afd7ed558ccdULL;
+	hash ^= hash >> 33;
+	hash *= 0xc4ceb9fe1a85ec53ULL;
+	hash ^= hash >> 33;
+	return hash;
+}
+
+std::string NodeRegistry::Endpoint(const std::string& host, int port)
+{
+	return host + ":" + std::to_string(port);
+}
+
+void NodeRegistry::EvictLoop()
+{
+	while (true) {
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+			_cond.wait_for(lock, _evictInterval, [this]() { return _b_stop; });
+			if (_b_stop) {
+				return;
+			}
+		}
+		EvictStale();
+	}
+}
+
+void NodeRegistry::EvictStale()
+{
+	auto now = NowSeconds();
+	std::vector<std::string> stale;
+	for (const auto& node : Current()->nodes) {
+		if (IsStale(*node, now)) {
+			stale.push_back(node->name);
+		}
+	}
+	if (stale.empty()) {
+		return;
+	}
+
+	std::lock_guard<std::mutex> writeLock(_writeMutex);
+	std::lock_guard<std::mutex> loadLock(_loadMutex);
+	auto current = Current();
+	std::vector<NodePtr> nodes;
+	nodes.reserve(current->nodes.size());
+	std::size_t evicted = 0;
+	for (const auto& node : current->nodes) {
+		// a heartbeat may have arrived since the check above
+		if (IsStale(*node, now)) {
+			_byLoad.erase(KeyOf(*node));
+			_totalLoad -= node->current_load.load();
+			LOG_WARN("Evicting stale node {} ({}:{}), last heartbeat {}s ago",
+				node->name, node->host, node->port, now - node->last_heartbeat.load());
+			++evicted;
+			continue;
+		}
+		nodes.push_back(node);
+	}
+	if (evicted > 0) {
+		PublishLocked(nodes);
+		LOG_WARN("Evicted stale nodes: {}", evicted);
+	}
+}
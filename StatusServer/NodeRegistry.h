@@ -0,0 +1,182 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "status.pb.h"
+
+/**
+ * @brief Node information structure
+ *
+ * Everything but the two counters is fixed once the node is published;
+ * re-registering with new values publishes a new NodeInfo.
+ */
+struct NodeInfo {
+	std::string name;
+	std::string host;
+	int port = 0;
+	int rpc_port = 0; // peer-facing gRPC port
+	int capacity = 100; // default weight/capacity
+	std::atomic<int> current_load{0};
+	// slots reserved since the last metrics heartbeat, which may not have logged in yet
+	std::atomic<int> reserved_since_report{0};
+	std::atomic<long long> last_heartbeat{0}; // epoch seconds
+
+	// heartbeat metrics, smoothed; reported stays false for nodes that send none
+	std::atomic<bool> reported{false};
+	std::atomic<double> sessions{0.0};
+	std::atomic<double> queue_depth{0.0};
+	std::atomic<double> cpu{0.0};
+};
+
+/**
+ * @class NodeRegistry
+ * @brief The ChatServer nodes known to the StatusServer.
+ *
+ * Readers (heartbeats, sticky lookups, GetNodes) work on an immutable
+ * snapshot that membership changes replace atomically, so they never take a
+ * lock. Allocation picks from a set ordered by load: finding the
+ * least-loaded node and reserving a slot on it is O(log n) under a mutex held
+ * only for that.
+ *
+ * A node's load is its users over its capacity. Allocation adds a user and
+ * a reported logout removes one. For nodes that report metrics with their
+ * heartbeat the heartbeat wins: their user count is reset to the measured
+ * sessions plus the slots reserved since the previous heartbeat, whose users
+ * may still be on their way (counted twice for at most one heartbeat
+ * interval if they already logged in). Such nodes also count as loaded as
+ * their busiest resource: the larger of users / capacity,
+ * CPU / 100% and LogicSystem queue depth / QueueHigh, the last two smoothed
+ * with weight MetricsAlphaPct on the newest sample. Nodes whose heartbeat is older than NodeStaleSec are skipped
+ * by allocation and dropped by a background sweep every EvictIntervalSec.
+ *
+ * AcquireForKey is the alternative to least-loaded: keys go to the next node
+ * clockwise on a hash ring (VirtualNodes points per node), passing over nodes
+ * that already hold more than (1 + LoadBoundPct / 100) times their capacity
+ * share of the total load. A key keeps landing on the same node while the
+ * cluster is balanced, and only about 1/N of keys move when a node joins or
+ * leaves.
+ */
+class NodeRegistry
+{
+public:
+	using NodePtr = std::shared_ptr<NodeInfo>;
+
+	NodeRegistry();
+	~NodeRegistry();
+
+	NodeRegistry(const NodeRegistry&) = delete;
+	NodeRegistry& operator=(const NodeRegistry&) = delete;
+
+	/**
+	 * @brief Add a node, or replace the details of one with the same name (its load is kept)
+	 */
+	void Upsert(const status::RegisterNodeReq& req);
+
+	void Remove(const std::string& name);
+
+	/**
+	 * @brief Record a heartbeat from host:port
+	 *
+	 * @return false if no registered node listens there
+	 */
+	bool Touch(const std::string& host, int port);
+
+	/**
+	 * @brief Record a heartbeat from host:port carrying its measured load
+	 *
+	 * @return false if no registered node listens there
+	 */
+	bool Report(const std::string& host, int port, const status::HeartbeatReq& heartbeat);
+
+	/**
+	 * @brief The node called name if it is registered and not stale
+	 */
+	NodePtr Find(const std::string& name) const;
+
+	/**
+	 * @brief Reserve a slot on the node with the lowest load / capacity
+	 *
+	 * When every node is stale, falls back to round-robin over all of them.
+	 *
+	 * @return nullptr if no node is registered
+	 */
+	NodePtr AcquireLeastLoaded();
+
+	/**
+	 * @brief Reserve a slot on key's node on the hash ring, or the first one after it under the load bound
+	 *
+	 * Falls back to AcquireLeastLoaded when no live node is under the bound.
+	 *
+	 * @return nullptr if no node is registered
+	 */
+	NodePtr AcquireForKey(const std::string& key);
+
+	/**
+	 * @brief Give back a slot reserved on name, if it is still registered
+	 */
+	void Release(const std::string& name);
+
+	/**
+	 * @brief All registered nodes, ordered by name
+	 */
+	std::vector<NodePtr> List() const;
+
+	bool IsStale(const NodeInfo& node, long long nowSec) const;
+
+private:
+	struct Snapshot {
+		std::vector<NodePtr> nodes; // by name
+		std::unordered_map<std::string, NodePtr> byName;
+		std::unordered_map<std::string, NodePtr> byEndpoint; // "host:port"
+		std::vector<std::pair<uint64_t, NodePtr>> ring; // sorted by point
+		long long totalCapacity = 0;
+	};
+
+	// position in _byLoad, for a given load and capacity
+	using LoadKey = std::pair<double, std::string>;
+
+	std::shared_ptr<const Snapshot> Current() const;
+	// caller holds _writeMutex and _loadMutex
+	void PublishLocked(const std::vector<NodePtr>& nodes);
+	LoadKey KeyOf(const NodeInfo& node) const;
+	static uint64_t Hash(const std::string& data);
+	// caller holds _loadMutex
+	NodePtr AcquireLeastLoadedLocked(const Snapshot& current, long long nowSec);
+	void ReserveLocked(NodeInfo& node);
+	static std::string Endpoint(const std::string& host, int port);
+
+	void EvictLoop();
+	void EvictStale();
+
+	long long _staleSec;
+	std::chrono::seconds _evictInterval;
+	int _virtualNodes;
+	double _loadBound;
+	double _alpha;
+	double _queueHigh;
+
+	// swapped with std::atomic_store, read with std::atomic_load
+	std::shared_ptr<const Snapshot> _snapshot;
+	// serializes membership changes
+	std::mutex _writeMutex;
+
+	// guards _byLoad and every change of current_load
+	std::mutex _loadMutex;
+	std::set<LoadKey> _byLoad;
+	long long _totalLoad;
+	std::size_t _rrIndex;
+
+	std::mutex _mutex;
+	std::condition_variable _cond;
+	bool _b_stop;
+	std::thread _evictor;
+};
@@ -0,0 +1,278 @@
+#include "RedisClientCache.h"
+#include "RedisConPool.h"
+#include "Logger.h"
+
+#include <map>
+
+namespace {
+	constexpr auto KEYSPACE_PREFIX = "__keyspace@0__:";
+}
+
+RedisClientCache::RedisClientCache(const std::vector<std::string>& prefixes, const std::vector<sw::redis::Redis*>& nodes,
+	std::size_t maxEntries, std::chrono::seconds ttl) :
+	_prefixes(prefixes), _counters(new Counters[prefixes.size()]), _maxEntries(maxEntries), _ttl(ttl),
+	_nextFill(0), _nodes(nodes), _subscribed(new std::atomic<bool>[nodes.size()]), _b_stop(false)
+{
+	for (std::size_t node = 0; node < _nodes.size(); ++node) {
+		_subscribed[node] = false;
+	}
+	if (_prefixes.empty()) {
+		return;
+	}
+
+	for (std::size_t node = 0; node < _nodes.size(); ++node) {
+		EnableNotifications(node);
+		_threads.emplace_back(&RedisClientCache::SubscribeLoop, this, node);
+	}
+}
+
+RedisClientCache::~RedisClientCache()
+{
+	_b_stop = true;
+	for (auto& thread : _threads) {
+		if (thread.joinable()) {
+			thread.join();
+		}
+	}
+}
+
+bool RedisClientCache::Tracks(const std::string& key) const
+{
+	return PrefixOf(key) >= 0;
+}
+
+sw::redis::OptionalString RedisClientCache::Get(const std::string& key)
+{
+	auto prefix = PrefixOf(key);
+	auto& redis = RedisConPool::ForKey(key);
+	sw::redis::OptionalString value;
+	uint64_t fill = 0;
+	if (prefix < 0) {
+		return redis.get(key);
+	}
+	if (Lookup(key, prefix, value, fill)) {
+		return value;
+	}
+
+	try {
+		value = redis.get(key);
+	}
+	catch (const sw::redis::Error&) {
+		Cancel(key, fill);
+		throw;
+	}
+	Store(key, fill, value);
+	return value;
+}
+
+std::vector<sw::redis::OptionalString> RedisClientCache::MGet(const std::vector<std::string>& keys)
+{
+	std::vector<sw::redis::OptionalString> values(keys.size());
+	std::vector<uint64_t> fills(keys.size(), 0);
+	// node -> positions of the keys it still has to answer
+	std::map<std::size_t, std::vector<std::size_t>> missing;
+	for (std::size_t i = 0; i < keys.size(); ++i) {
+		auto prefix = PrefixOf(keys[i]);
+		if (prefix >= 0 && Lookup(keys[i], prefix, values[i], fills[i])) {
+			continue;
+		}
+		missing[RedisConPool::NodeOf(keys[i])].push_back(i);
+	}
+
+	try {
+		for (const auto& [node, positions] : missing) {
+			std::vector<std::string> nodeKeys;
+			nodeKeys.reserve(positions.size());
+			for (auto i : positions) {
+				nodeKeys.push_back(keys[i]);
+			}
+
+			std::vector<sw::redis::OptionalString> nodeValues;
+			RedisConPool::Node(node).mget(nodeKeys.begin(), nodeKeys.end(), std::back_inserter(nodeValues));
+			for (std::size_t j = 0; j < positions.size() && j < nodeValues.size(); ++j) {
+				values[positions[j]] = std::move(nodeValues[j]);
+			}
+		}
+	}
+	catch (const sw::redis::Error&) {
+		for (std::size_t i = 0; i < keys.size(); ++i) {
+			if (fills[i] != 0) {
+				Cancel(keys[i], fills[i]);
+			}
+		}
+		throw;
+	}
+
+	for (std::size_t i = 0; i < keys.size(); ++i) {
+		if (fills[i] != 0) {
+			Store(keys[i], fills[i], values[i]);
+		}
+	}
+	return values;
+}
+
+void RedisClientCache::Invalidate(const std::string& key)
+{
+	auto prefix = PrefixOf(key);
+	if (prefix < 0) {
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(_mutex);
+	_entries.erase(key);
+	_fills.erase(key);
+	_counters[prefix].invalidations.fetch_add(1, std::memory_order_relaxed);
+}
+
+std::vector<RedisClientCache::PrefixStats> RedisClientCache::GetStats() const
+{
+	std::vector<PrefixStats> stats;
+	for (std::size_t i = 0; i < _prefixes.size(); ++i) {
+		stats.push_back(PrefixStats{
+			_prefixes[i],
+			_counters[i].hits.load(std::memory_order_relaxed),
+			_counters[i].misses.load(std::memory_order_relaxed),
+			_counters[i].invalidations.load(std::memory_order_relaxed)
+		});
+	}
+	return stats;
+}
+
+int RedisClientCache::PrefixOf(const std::string& key) const
+{
+	for (std::size_t i = 0; i < _prefixes.size(); ++i) {
+		if (key.compare(0, _prefixes[i].size(), _prefixes[i]) == 0) {
+			return static_cast<int>(i);
+		}
+	}
+	return -1;
+}
+
+bool RedisClientCache::Lookup(const std::string& key, int prefix, sw::redis::OptionalString& value, uint64_t& fill)
+{
+	auto& counters = _counters[prefix];
+	if (!_subscribed[RedisConPool::NodeOf(key)]) {
+		// without invalidations a copy could go stale unnoticed
+		counters.misses.fetch_add(1, std::memory_order_relaxed);
+		fill = 0;
+		return false;
+	}
+
+	std::lock_guard<std::mutex> lock(_mutex);
+	auto iter = _entries.find(key);
+	if (iter != _entries.end()) {
+		if (iter->second.expiresAt > Clock::now()) {
+			counters.hits.fetch_add(1, std::memory_order_relaxed);
+			value = iter->second.value;
+			return true;
+		}
+		_entries.erase(iter);
+	}
+
+	counters.misses.fetch_add(1, std::memory_order_relaxed);
+	fill = ++_nextFill;
+	_fills[key] = fill;
+	return false;
+}
+
+void RedisClientCache::Store(const std::string& key, uint64_t fill, const sw::redis::OptionalString& value)
+{
+	if (fill == 0) {
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(_mutex);
+	auto iter = _fills.find(key);
+	if (iter == _fills.end() || iter->second != fill) {
+		// invalidated, or refilled by a newer read, while the GET was in flight
+		return;
+	}
+	_fills.erase(iter);
+
+	if (_entries.size() >= _maxEntries && _entries.find(key) == _entries.end()) {
+		LOG_DEBUG("Redis client cache full ({} entries), clearing", _entries.size());
+		_entries.clear();
+	}
+	_entries[key] = Entry{ value, Clock::now() + _ttl };
+}
+
+void RedisClientCache::Cancel(const std::string& key, uint64_t fill)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	auto iter = _fills.find(key);
+	if (iter != _fills.end() && iter->second == fill) {
+		_fills.erase(iter);
+	}
+}
+
+void RedisClientCache::Clear()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_entries.clear();
+	_fills.clear();
+}
+
+void RedisClientCache::EnableNotifications(std::size_t node)
+{
+	// Keyspace events (K) for generic (g), string ($), expired (x) and evicted (e)
+	// keys, merged into whatever the server already publishes (A covers all but K)
+	try {
+		auto& redis = *_nodes[node];
+		std::vector<std::string> current;
+		redis.command("CONFIG", "GET", "notify-keyspace-events", std::back_inserter(current));
+
+		std::string flags = current.size() >= 2 ? current[1] : "";
+		bool changed = false;
+		for (char flag : std::string("Kg$xe")) {
+			if (flags.find(flag) == std::string::npos && !(flag != 'K' && flags.find('A') != std::string::npos)) {
+				flags.push_back(flag);
+				changed = true;
+			}
+		}
+		if (changed) {
+			redis.command("CONFIG", "SET", "notify-keyspace-events", flags);
+			LOG_INFO("Enabled keyspace notifications on Redis node {}: {}", node, flags);
+		}
+	}
+	catch (const sw::redis::Error& e) {
+		LOG_WARN("Could not enable keyspace notifications on Redis node {}, its keys are not cached: {}", node, e.what());
+	}
+}
+
+void RedisClientCache::SubscribeLoop(std::size_t node)
+{
+	while (!_b_stop) {
+		try {
+			auto subscriber = _nodes[node]->subscriber();
+			subscriber.on_pmessage([this](std::string, std::string channel, std::string) {
+				Invalidate(channel.substr(std::min(channel.size(), std::char_traits<char>::length(KEYSPACE_PREFIX))));
+			});
+			for (const auto& prefix : _prefixes) {
+				subscriber.psubscribe(std::string(KEYSPACE_PREFIX) + prefix + "*");
+			}
+			// the first consumes read the psubscribe replies; cache only after all of them
+			std::size_t replies = 0;
+			LOG_INFO("Redis client cache subscribed to node {} for {} prefixes", node, _prefixes.size());
+
+			while (!_b_stop) {
+				try {
+					subscriber.consume();
+					if (replies < _prefixes.size() && ++replies == _prefixes.size()) {
+						_subscribed[node] = true;
+					}
+				}
+				catch (const sw::redis::TimeoutError&) {
+					// socket timeout doubles as the stop check interval
+				}
+			}
+		}
+		catch (const sw::redis::Error& e) {
+			// Invalidations may have been missed while disconnected
+			_subscribed[node] = false;
+			Clear();
+			LOG_WARN("Redis client cache subscription to node {} lost: {}, retrying", node, e.what());
+			std::this_thread::sleep_for(std::chrono::seconds(1));
+		}
+	}
+	_subscribed[node] = false;
+}
@@ -1,19 +1,200 @@
 #pragma once
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 #include <sw/redis++/redis++.h>
+#include "RedisClientCache.h"
+#include "CircuitBreaker.h"
+
+/**
+ * @class RedisConPool
+ * @brief The process-wide Redis clients and their connection pools.
+ *
+ * [Redis] Nodes lists config sections of standalone Redis instances; with
+ * none listed, [Redis] itself is the only node. Keys are spread over the
+ * nodes by consistent hashing (VirtualNodes points per node, placed by the
+ * section name), so adding a node moves only the keys that now belong to it.
+ * As in Redis Cluster, only the part of a key between the first '{' and the
+ * next '}' is hashed when it is non-empty: keys built with UserKey share
+ * their uid's node, so multi-key commands, pipelines and scripts over one
+ * user's keys stay on one instance.
+ *
+ * [Redis] PoolSize, WaitTimeoutMs, ConnectionLifetimeSec and
+ * ConnectionIdleSec configure each node's shared pool; node sections may
+ * override them. With PerThread = 1 a thread that called BindThread() gets
+ * its own single connection to every node and never waits for a pool.
+ *
+ * A sampler issues a PING through each node's pool and one over a private
+ * connection every SampleMs. The private PING is the command latency; the
+ * difference between the two is the time spent waiting for a pooled
+ * connection. Both are kept as histograms and logged every MetricsSec.
+ *
+ * String keys under the prefixes in [Redis] CachePrefixes can be read through
+ * a client-side cache (see RedisClientCache) with CachedGet and CachedMGet;
+ * per-prefix hit rates are logged with the pool metrics.
+ *
+ * Each node has a circuit breaker ([Redis] BreakerWindow, BreakerMinCalls,
+ * BreakerFailurePct, BreakerOpenMs, BreakerTrials). It is fed by the sampler
+ * and by callers through RecordSuccess/RecordError. Unless it is closed, Node
+ * and ForKey throw RedisUnavailable right away instead of letting every caller
+ * wait for a socket timeout; callers can check Available to degrade up front.
+ * Half-open trial calls are only made through TrialNode, whose callers report
+ * every outcome: the sampler, and RedisBatcher in the ChatServer.
+ *
+ * Every MemoryReportSec the sampler also SCANs up to MemoryReportKeys keys per
+ * node and logs MEMORY USAGE, key count and keys without TTL per key family
+ * (the key with its {hash tag} and trailing id removed), scaled to DBSIZE.
+ */
+class RedisUnavailable : public sw::redis::Error
+{
+public:
+	using sw::redis::Error::Error;
+};
 
 class RedisConPool
 {
 public:
+	static constexpr std::array<long long, 8> LATENCY_BUCKETS_MS{ 0, 1, 2, 5, 10, 50, 100, 500 };
+
+	struct Stats {
+		std::size_t nodes;
+		std::size_t poolSize;
+		std::size_t dedicated;
+		uint64_t samples;
+		uint64_t failures;
+		// LATENCY_BUCKETS_MS.size() + 1 buckets, the last one counts everything above
+		std::array<uint64_t, LATENCY_BUCKETS_MS.size() + 1> poolWaits;
+		std::array<uint64_t, LATENCY_BUCKETS_MS.size() + 1> latencies;
+		long long maxPoolWaitUs;
+		long long maxLatencyUs;
+	};
+
+	/**
+	 * @brief The first node, for commands without a key such as PING or CONFIG
+	 *
+	 * Keyed commands must go through ForKey so every process finds a key on the same node.
+	 */
 	static sw::redis::Redis& GetInstance();
+
+	/**
+	 * @brief The node that owns key
+	 */
+	static sw::redis::Redis& ForKey(const std::string& key);
+
+	/**
+	 * @brief Whether the circuit of key's node is closed
+	 */
+	static bool Available(const std::string& key);
+
+	/**
+	 * @brief Feed the outcome of a call on node to its circuit breaker
+	 *
+	 * Reply errors show the node is up and count as successes.
+	 */
+	static void RecordSuccess(std::size_t node);
+	static void RecordError(std::size_t node, const sw::redis::Error& error);
+
+	static std::size_t NodeOf(const std::string& key);
+	static std::size_t NodeCount();
+	static sw::redis::Redis& Node(std::size_t index);
+
+	/**
+	 * @brief Node for a caller that reports the outcome with RecordSuccess/RecordError
+	 *
+	 * May take one of the breaker's half-open trial slots, which only a report frees.
+	 */
+	static sw::redis::Redis& TrialNode(std::size_t index);
+
+	/**
+	 * @brief prefix + "{uid}", a key placed on uid's node
+	 */
+	static std::string UserKey(const std::string& prefix, const std::string& uid);
+
+	/**
+	 * @brief Give the calling thread dedicated connections, if [Redis] PerThread is on
+	 *
+	 * Meant for long-lived threads such as io_context runners; the connections
+	 * live until the pool is destroyed.
+	 */
+	static void BindThread();
+
+	/**
+	 * @brief GET, answered locally when key is under a cached prefix and a valid copy exists
+	 */
+	static sw::redis::OptionalString CachedGet(const std::string& key);
+
+	/**
+	 * @brief MGET of keys on any nodes, in order; cached copies are used where possible
+	 */
+	static std::vector<sw::redis::OptionalString> CachedMGet(const std::vector<std::string>& keys);
+
+	/**
+	 * @brief Drop the local copy of key; call after writing a key under a cached prefix
+	 */
+	static void InvalidateCached(const std::string& key);
+
+	static Stats GetStats();
+	static std::vector<RedisClientCache::PrefixStats> GetCacheStats();
+
 	~RedisConPool();
 	RedisConPool(const RedisConPool&) = delete;
 	RedisConPool& operator=(const RedisConPool&) = delete;
     void HealthCheck();
 
 private:
+	struct NodeInfo {
+		std::string section;
+		sw::redis::ConnectionOptions options;
+		sw::redis::ConnectionPoolOptions poolOptions;
+		std::unique_ptr<sw::redis::Redis> redis;
+		std::unique_ptr<sw::redis::Redis> probe;
+		std::unique_ptr<CircuitBreaker> breaker;
+	};
+
 	RedisConPool();
 
-	std::unique_ptr<sw::redis::Redis> _redis;
-};
+	static RedisConPool& Self();
+	// this thread's connection to node index if it has one, else the node's pool
+	static sw::redis::Redis& Client(std::size_t index);
 
+	std::unique_ptr<NodeInfo> MakeNode(const std::string& section);
+	static uint64_t Hash(const char* data, std::size_t size);
+
+	void Sample();
+	void SampleLoop();
+	void LogStats();
+	void ReportMemory();
+	static std::string KeyFamily(const std::string& key);
+	static std::size_t Bucket(std::chrono::microseconds elapsed);
+
+	std::vector<std::unique_ptr<NodeInfo>> _nodes;
+	// sorted ring positions and the node owning each
+	std::vector<std::pair<uint64_t, std::size_t>> _ring;
+	bool _perThread;
+	std::chrono::milliseconds _sampleInterval;
+	std::chrono::seconds _logInterval;
+	std::chrono::seconds _memoryInterval;
+	std::size_t _memoryKeys;
+	// declared after _nodes: its subscribers must stop before the clients go away
+	std::unique_ptr<RedisClientCache> _cache;
+
+	std::mutex _dedicatedMutex;
+	std::vector<std::unique_ptr<sw::redis::Redis>> _dedicated;
+
+	std::mutex _statsMutex;
+	Stats _stats;
+
+	std::mutex _mutex;
+	std::condition_variable _cond;
+	bool _b_stop;
+	std::thread _sampler;
+};
@@ -1,5 +1,6 @@
 #include "StatusServerImpl.h"
 #include "RedisConPool.h"
+#include "ValueCodec.h"
 #include "ConfigManager.h"
 #include "ChatGrpcClient.h"
 #include "Logger.h"
@@ -12,6 +13,7 @@
 #include <openssl/hmac.h> // optional: if available for HMAC; otherwise replace with your own
 #include <algorithm>
 #include <fstream>
+#include <stdexcept>
 
 static long long now_seconds() 
 {
@@ -32,6 +34,14 @@ static std::string load_file(const std::string& path) {
 StatusServerImpl::StatusServerImpl() 
 {
     LOG_INFO("StatusServerImpl initializing");
+    _hashAllocation = ConfigManager::GetInstance()["StatusServer"]["Allocation"] == "consistent_hash";
+    LOG_INFO("Node allocation: {}", _hashAllocation ? "consistent_hash" : "least_loaded");
+    // every token is signed with it; an empty secret would make them forgeable
+    _tokenSecret = ConfigManager::GetInstance()["StatusServer"]["token_secret"];
+    if (_tokenSecret.empty()) {
+        LOG_ERROR("[StatusServer] token_secret is not set, refusing to start");
+        throw std::runtime_error("[StatusServer] token_secret is not set");
+    }
     // nothing else for now
     _atomicAssignScript = load_file("scripts/atomic_assign_session.lua");
     if (_atomicAssignScript.empty()) {
@@ -47,85 +57,22 @@ StatusServerImpl::~StatusServerImpl()
     LOG_INFO("StatusServerImpl shutting down");
 }
 
-// ------------ Node management helpers ------------
-void StatusServerImpl::addOrUpdateNode(const status::RegisterNodeReq& req) 
-{
-    std::lock_guard<std::mutex> g(_nodesMutex);
-    auto it = _nodes.find(req.name());
-    long long ts = now_seconds();
-    if (it == _nodes.end()) {
-        auto n = std::make_shared<NodeInfo>();
-        n->name = req.name();
-        n->host = req.server_host();
-        n->port = req.server_port();
-        n->capacity = req.capacity() > 0 ? req.capacity() : 100;
-        n->current_load = 0;
-        n->last_heartbeat = ts;
-        _nodes[n->name] = n;
-    } else {
-        auto n = it->second;
-        n->host = req.server_host();
-        n->port = req.server_port();
-        n->capacity = req.capacity() > 0 ? req.capacity() : n->capacity;
-        n->last_heartbeat = ts;
-    }
-    rebuildNodeListLocked();
-}
-
-void StatusServerImpl::removeNode(const std::string& name) 
-{
-    std::lock_guard<std::mutex> g(_nodesMutex);
-    auto it = _nodes.find(name);
-    if (it != _nodes.end()) _nodes.erase(it);
-    rebuildNodeListLocked();
-}
-
-void StatusServerImpl::rebuildNodeListLocked() 
-{
-    _nodeList.clear();
-    _nodeList.reserve(_nodes.size());
-    for (auto &p : _nodes) _nodeList.push_back(p.second);
-    // keep deterministic ordering
-    std::sort(_nodeList.begin(), _nodeList.end(),
-        [](const std::shared_ptr<NodeInfo>& a, const std::shared_ptr<NodeInfo>& b){
-            return a->name < b->name;
-        }
-    );
-}
-
-// Evict nodes not updated recently
-void StatusServerImpl::evictStaleNodes(long long nowSec) 
-{
-    std::vector<std::string> toRemove;
-    {
-        std::lock_guard<std::mutex> g(_nodesMutex);
-        for (auto &kv : _nodes) {
-            auto n = kv.second;
-            long long last = n->last_heartbeat.load();
-            if (nowSec - last > NODE_STALE_THRESHOLD_SEC) {
-                toRemove.push_back(kv.first);
-            }
-        }
-        for (auto &name : toRemove) _nodes.erase(name);
-        if (!toRemove.empty()) rebuildNodeListLocked();
-    }
-    if (!toRemove.empty()) {
-        LOG_WARN("Evicted stale nodes: {}", toRemove.size());
-    }
-}
-
 // ------------ Token generation (HMAC using secret from Config) ------------
 std::string StatusServerImpl::generateToken(const std::string& uid, const std::string& serverName, int ttlSeconds)
 {
     // Very simple token format: uid|server|expires|hmac
     // Replace with JWT or robust HMAC in production.
-    auto& cfg = ConfigManager::GetInstance();
-    std::string secret = cfg["StatusServer"]["token_secret"];
     long long expires = now_seconds() + ttlSeconds;
 
     std::ostringstream oss;
     oss << uid << "|" << serverName << "|" << expires;
     std::string payload = oss.str();
+    return payload + "|" + signToken(payload);
+}
+
+std::string StatusServerImpl::signToken(const std::string& payload)
+{
+    const std::string& secret = _tokenSecret;
 
     // compute HMAC-SHA256 if OpenSSL available else use simple salted hash
     unsigned char* digest = nullptr;
@@ -139,20 +86,41 @@ std::string StatusServerImpl::generateToken(const std::string& uid, const std::s
     for (unsigned int i = 0; i < len; ++i) {
         hex << std::hex << std::setw(2) << std::setfill('0') << (int)digest[i];
     }
-    return payload + "|" + hex.str();
+    return hex.str();
 #else
     // fallback simple: append secret reversed (NOT SECURE — replace in prod)
-    std::string fake = payload + "|" + std::string(secret.rbegin(), secret.rend());
-    return fake;
+    return std::string(secret.rbegin(), secret.rend());
 #endif
 }
 
-bool StatusServerImpl::validateToken(const std::string& token, const std::string& uid, const std::string& serverName) 
+bool StatusServerImpl::validateToken(const std::string& token, const std::string& uid, const std::string& serverName, long long* expiresAt) 
 {
-    // Minimal validation: check payload prefix uid|serverName
-    // In production parse HMAC/JWT and verify signature + expiry
-    if (token.empty()) return false;
-    if (token.find(uid + "|" + serverName + "|") != 0) return false;
+    // token = uid|server|expires|signature
+    std::string prefix = uid + "|" + serverName + "|";
+    if (token.empty() || token.compare(0, prefix.size(), prefix) != 0) return false;
+
+    auto sep = token.rfind('|');
+    if (sep == std::string::npos || sep <= prefix.size()) return false;
+
+    long long expires = 0;
+    try {
+        expires = std::stoll(token.substr(prefix.size(), sep - prefix.size()));
+    } catch (const std::exception&) {
+        return false;
+    }
+    if (expires <= now_seconds()) return false;
+
+    // compare every byte so the time taken doesn't reveal how much of the signature matched
+    std::string expected = signToken(token.substr(0, sep));
+    std::string actual = token.substr(sep + 1);
+    if (expected.size() != actual.size()) return false;
+    unsigned char diff = 0;
+    for (size_t i = 0; i < expected.size(); ++i) {
+        diff |= static_cast<unsigned char>(expected[i] ^ actual[i]);
+    }
+    if (diff != 0) return false;
+
+    if (expiresAt) *expiresAt = expires;
     return true;
 }
 
@@ -160,9 +128,10 @@ bool StatusServerImpl::validateToken(const std::string& token, const std::string
 bool StatusServerImpl::persistUserRouteToRedis(const std::string& uid, const json& j) 
 {
     try {
-        auto& redis = RedisConPool::GetInstance();
-        std::string key = StatusServerCode::UserRouteKey + uid;
-        redis.set(key, j.dump());
+        std::string key = RedisConPool::UserKey(StatusServerCode::UserRouteKey, uid);
+        auto codec = ValueCodec::GetInstance();
+        RedisConPool::ForKey(key).setex(key, codec->TTL(StatusServerCode::UserRouteKey), codec->Encode(j));
+        RedisConPool::InvalidateCached(key);
         return true;
     } catch (const std::exception& e) {
         LOG_ERROR("persistUserRouteToRedis exception: {}", e.what());
@@ -173,11 +142,10 @@ bool StatusServerImpl::persistUserRouteToRedis(const std::string& uid, const jso
 bool StatusServerImpl::readUserRouteFromRedis(const std::string& uid, json& out) 
 {
     try {
-        auto& redis = RedisConPool::GetInstance();
-        auto val = redis.get(StatusServerCode::UserRouteKey + uid);
-        if (val->empty()) return false;
-        out = json::parse(*val);
-        return true;
+        std::string key = RedisConPool::UserKey(StatusServerCode::UserRouteKey, uid);
+        auto val = RedisConPool::CachedGet(key);
+        if (!val || val->empty()) return false;
+        return ValueCodec::GetInstance()->Decode(*val, out);
     } catch (const std::exception& e) {
         LOG_ERROR("readUserRouteFromRedis exception: {}", e.what());
         return false;
@@ -187,8 +155,9 @@ bool StatusServerImpl::readUserRouteFromRedis(const std::string& uid, json& out)
 bool StatusServerImpl::removeUserRouteFromRedis(const std::string& uid) 
 {
     try {
-        auto& redis = RedisConPool::GetInstance();
-        redis.del(StatusServerCode::UserRouteKey + uid);
+        std::string key = RedisConPool::UserKey(StatusServerCode::UserRouteKey, uid);
+        RedisConPool::ForKey(key).del(key);
+        RedisConPool::InvalidateCached(key);
         return true;
     } catch (const std::exception& e) {
         LOG_ERROR("removeUserRouteFromRedis exception: {}", e.what());
@@ -205,7 +174,7 @@ grpc::Status StatusServerImpl::RegisterNode(grpc::ServerContext*, const status::
         return grpc::Status::OK;
     }
     LOG_INFO("RegisterNode: {} {}:{}", req->name(), req->server_host(), req->server_port());
-    addOrUpdateNode(*req);
+    _nodes.Upsert(*req);
 
     // optionally persist node info to Redis for cross-process visibility
     try {
@@ -214,8 +183,11 @@ grpc::Status StatusServerImpl::RegisterNode(grpc::ServerContext*, const status::
         j["host"] = req->server_host();
         j["port"] = req->server_port();
         j["capacity"] = req->capacity();
+        j["rpc_port"] = req->rpc_port();
         j["last_heartbeat"] = now_seconds();
-        RedisConPool::GetInstance().set(StatusServerCode::NodeKey + req->name(), j.dump());
+        std::string key = StatusServerCode::NodeKey + req->name();
+        auto codec = ValueCodec::GetInstance();
+        RedisConPool::ForKey(key).setex(key, codec->TTL(StatusServerCode::NodeKey), codec->Encode(j));
     } catch (...) {
         LOG_WARN("Could not persist node info to Redis");
     }
@@ -232,9 +204,10 @@ grpc::Status StatusServerImpl::DeregisterNode(grpc::ServerContext*, const status
     }
 
     LOG_INFO("DeregisterNode: {}", req->name());
-    removeNode(req->name());
+    _nodes.Remove(req->name());
     try { 
-        RedisConPool::GetInstance().del(StatusServerCode::NodeKey + req->name()); 
+        std::string key = StatusServerCode::NodeKey + req->name();
+        RedisConPool::ForKey(key).del(key);
     } catch(...) {
         
     }
@@ -249,20 +222,15 @@ grpc::Status StatusServerImpl::Heartbeat(grpc::ServerContext*, const status::Hea
         return grpc::Status::OK;
     }
     LOG_DEBUG("Heartbeat from {}:{}", req->server_host(), req->server_port());
-    // Update node by matching host+port or name (if provided)
-    std::lock_guard<std::mutex> g(_nodesMutex);
-    bool found = false;
-    for (auto &p : _nodes) {
-        auto n = p.second;
-        if (n->host == req->server_host() && n->port == req->server_port()) {
-            n->last_heartbeat = now_seconds();
-            found = true;
-            break;
-        }
-    }
-    if (!found) {
-        // optional: add a fallback node entry
+    // Update node by matching host+port, taking its measured load if it sends one
+    bool known = req->measured()
+        ? _nodes.Report(req->server_host(), req->server_port(), *req)
+        : _nodes.Touch(req->server_host(), req->server_port());
+    if (!known) {
+        // the node registers again when told, e.g. after this server restarted or evicted it
         LOG_WARN("Heartbeat from unknown node {}:{}", req->server_host(), req->server_port());
+        resp->set_error(static_cast<int>(ErrorCodes::NODE_NOT_FOUND));
+        return grpc::Status::OK;
     }
     resp->set_error(0);
     return grpc::Status::OK;
@@ -275,9 +243,6 @@ grpc::Status StatusServerImpl::AllocateServer(grpc::ServerContext*, const status
         return grpc::Status::OK;
     }
 
-    // Periodically evict stale nodes
-    evictStaleNodes(now_seconds());
-
     std::string uid = req->uid();
     // 1) check sticky assignment
     json current;
@@ -285,52 +250,28 @@ grpc::Status StatusServerImpl::AllocateServer(grpc::ServerContext*, const status
         bool assigned = current.value("assigned", false);
         if (assigned) {
             std::string assignedName = current.value("server_name", std::string());
-            {
-                std::lock_guard<std::mutex> g(_nodesMutex);
-                auto it = _nodes.find(assignedName);
-                if (it != _nodes.end()) {
-                    auto n = it->second;
-                    resp->set_error(0);
-                    resp->set_assigned(true);
-                    resp->set_server_name(n->name);
-                    resp->set_server_host(n->host);
-                    resp->set_server_port(n->port);
-                    resp->set_token(current.value("token", std::string()));
-                    resp->set_expires_at(current.value("expires_at", 0));
-                    return grpc::Status::OK;
-                }
+            if (auto n = _nodes.Find(assignedName)) {
+                resp->set_error(0);
+                resp->set_assigned(true);
+                resp->set_server_name(n->name);
+                resp->set_server_host(n->host);
+                resp->set_server_port(n->port);
+                resp->set_token(current.value("token", std::string()));
+                resp->set_expires_at(current.value("expires_at", 0));
+                return grpc::Status::OK;
             }
             // fallthrough to allocate new if node not found
         }
     }
 
-    // 2) pick least-loaded node (simple algorithm)
-    std::shared_ptr<NodeInfo> chosen = nullptr;
-    {
-        std::lock_guard<std::mutex> g(_nodesMutex);
-        double best = 1e9;
-        for (auto &kv : _nodes) {
-            auto n = kv.second;
-            long long last = n->last_heartbeat.load();
-            if (now_seconds() - last > NODE_STALE_THRESHOLD_SEC) continue;
-            double ratio = (double)n->current_load.load() / std::max(1, n->capacity);
-            if (ratio < best) {
-                best = ratio;
-                chosen = n;
-            }
-        }
-        // fallback: round-robin
-        if (!chosen && !_nodeList.empty()) {
-            chosen = _nodeList[_rrIndex % _nodeList.size()];
-            _rrIndex++;
-        }
-        if (!chosen) {
-            resp->set_error(2); // no nodes available
-            return grpc::Status::OK;
-        }
-        // reserve slot
-        chosen->current_load.fetch_add(1);
+    // 2) pick a node and reserve a slot on it
+    auto chosen = _hashAllocation ? _nodes.AcquireForKey(uid) : _nodes.AcquireLeastLoaded();
+    if (!chosen) {
+        resp->set_error(2); // no nodes available
+        return grpc::Status::OK;
     }
+    // a kick still queued from an earlier move away from this node would hit the new session
+    _kicks.Cancel(chosen->host, chosen->rpc_port, uid);
 
     // 3) generate token & persist
     int ttl = DEFAULT_TOKEN_TTL;
@@ -339,8 +280,9 @@ grpc::Status StatusServerImpl::AllocateServer(grpc::ServerContext*, const status
     long long now = now_seconds();
 
     try {
-        auto& redis = RedisConPool::GetInstance();
-        std::vector<std::string> keys;
+        // the script touches only the route key, so it runs on the node owning the user
+        std::vector<std::string> keys = { RedisConPool::UserKey(StatusServerCode::UserRouteKey, uid) };
+        auto& redis = RedisConPool::ForKey(keys.front());
         std::vector<std::string> argv = {
             uid,
             chosen->name,
@@ -348,10 +290,22 @@ grpc::Status StatusServerImpl::AllocateServer(grpc::ServerContext*, const status
             std::to_string(chosen->port),
             token,
             std::to_string(expiresAt),
-            std::to_string(now)
+            std::to_string(now),
+            ValueCodec::GetInstance()->FormatName(),
+            std::to_string(ValueCodec::GetInstance()->TTL(StatusServerCode::UserRouteKey))
         };
 
         auto prevOpt = redis.eval<sw::redis::Optional<std::string>>(_atomicAssignScript,keys.begin(),keys.end(),argv.begin(),argv.end());
+        RedisConPool::InvalidateCached(keys.front());
+
+        json prev;
+        bool hasPrev = prevOpt && ValueCodec::GetInstance()->Decode(*prevOpt, prev);
+        if (hasPrev) {
+            std::string prevName = prev.value("server_name", std::string());
+            if (!prevName.empty() && prevName != chosen->name) {
+                _nodes.Release(prevName);
+            }
+        }
 
 		resp->set_error(0);
 		resp->set_assigned(true);
@@ -362,26 +316,15 @@ grpc::Status StatusServerImpl::AllocateServer(grpc::ServerContext*, const status
 		resp->set_expires_at(expiresAt);
 
 		// If previous session existed and was online, async kick
-		if (!prevOpt.value().empty()) {
+		if (hasPrev) {
 			try {
-				json prev = json::parse(prevOpt.value());
 				bool prev_online = prev.value("online", false);
 				std::string prev_name = prev.value("server_name", std::string());
-				std::string prev_host = prev.value("server_host", std::string());
-				int prev_port = prev.value("server_port", 0);
-
-				if (prev_online && !prev_name.empty() && prev_name != chosen->name) {
-					std::thread(
-                        [uid, prev_host, prev_port]() {
-							try {
-								ChatGrpcClient::GetInstance()->KickUser(prev_host, prev_port, uid, static_cast<int>(ErrorCodes::REPEATED_LOGIN));
-								LOG_INFO("Kick request sent to {}:{} for uid={}", prev_host, prev_port, uid);
-							}
-							catch (const std::exception& ex) {
-								LOG_WARN("Kick request failed for uid={} host={}:{} : {}", uid, prev_host, prev_port, ex.what());
-							}
-						}
-                    ).detach();
+				// ChatService listens on the node's rpc port; a node that is gone has no session to kick
+				auto prevNode = _nodes.Find(prev_name);
+				if (prev_online && prevNode && prev_name != chosen->name) {
+					_kicks.Post(prevNode->host, prevNode->rpc_port, uid, static_cast<int>(ErrorCodes::REPEATED_LOGIN),
+						prev.value("generation", 0LL));
 				}
 			}
 			catch (...) {
@@ -436,6 +379,8 @@ grpc::Status StatusServerImpl::ReportOnline(grpc::ServerContext*, const status::
     route["server_host"] = req->server_host();
     route["server_port"] = req->server_port();
     route["token"] = req->token();
+    // names this session when a later login elsewhere has to kick it
+    route["generation"] = req->generation();
     route["last_update"] = now_seconds();
 
     persistUserRouteToRedis(req->uid(), route);
@@ -456,20 +401,21 @@ grpc::Status StatusServerImpl::ReportOffline(grpc::ServerContext*, const status:
         return grpc::Status::OK;
     }
 
+    // a session closing on a server the user has since moved away from says nothing
+    // about the newer login
+    std::string serverName = route.value("server_name", std::string());
+    if (!req->server_name().empty() && req->server_name() != serverName) {
+        LOG_DEBUG("Ignoring offline report of uid={} from {}, route is on {}", req->uid(), req->server_name(), serverName);
+        resp->set_error(0);
+        return grpc::Status::OK;
+    }
+
     route["online"] = false;
     route["last_logout"] = now_seconds();
 
     // decrement assigned node load if we can
-    std::string serverName = route.value("server_name", std::string());
     if (!serverName.empty()) {
-        std::lock_guard<std::mutex> g(_nodesMutex);
-		try {
-			auto& redis = RedisConPool::GetInstance();
-			redis.decr(StatusServerCode::NodeLoadKey + serverName);
-		}
-		catch (...) {
-			LOG_WARN("ReportOffline: redis decrement failed for uid={}", req->uid());
-		}
+        _nodes.Release(serverName);
     }
 
     persistUserRouteToRedis(req->uid(), route);
@@ -502,6 +448,42 @@ grpc::Status StatusServerImpl::QueryUserRoute(grpc::ServerContext*, const status
     return grpc::Status::OK;
 }
 
+grpc::Status StatusServerImpl::VerifyToken(grpc::ServerContext*, const status::VerifyTokenReq* req, status::VerifyTokenResp* resp)
+{
+    if (!req) {
+        resp->set_error(1);
+        resp->set_valid(false);
+        return grpc::Status::OK;
+    }
+
+    long long expiresAt = 0;
+    if (!validateToken(req->token(), req->uid(), req->server_name(), &expiresAt)) {
+        LOG_WARN("VerifyToken rejected token uid={} server={}", req->uid(), req->server_name());
+        resp->set_error(0);
+        resp->set_valid(false);
+        return grpc::Status::OK;
+    }
+
+    // A newer login replaces the token in the route, so a readable route must still
+    // hold it. Without the route (Redis brownout) the signed token alone decides:
+    // degraded logins have to keep working, and the token expires on its own
+    json route;
+    if (!readUserRouteFromRedis(req->uid(), route)) {
+        LOG_WARN("VerifyToken can't read the route of uid={}, trusting the signed token", req->uid());
+    }
+    else if (route.value("token", std::string()) != req->token()) {
+        LOG_WARN("VerifyToken got a superseded token uid={}", req->uid());
+        resp->set_error(0);
+        resp->set_valid(false);
+        return grpc::Status::OK;
+    }
+
+    resp->set_error(0);
+    resp->set_valid(true);
+    resp->set_expires_at(expiresAt);
+    return grpc::Status::OK;
+}
+
 grpc::Status StatusServerImpl::KickUser(grpc::ServerContext* context, const status::KickUserReq* req, status::KickUserResp* resp)
 {
     if (!req) { resp->set_error(1); return grpc::Status::OK; }
@@ -513,15 +495,17 @@ grpc::Status StatusServerImpl::KickUser(grpc::ServerContext* context, const stat
         resp->set_error(2);
         return grpc::Status::OK;
     }
-    std::string host = route.value("server_host", "");
-    int port = route.value("server_port", 0);
-    if (host.empty() || port == 0) {
+    // ChatService listens on the node's rpc port, not the client port in the route
+    auto node = _nodes.Find(route.value("server_name", std::string()));
+    if (!node || node->rpc_port == 0) {
         resp->set_error(3);
         return grpc::Status::OK;
     }
+    std::string host = node->host;
+    int port = node->rpc_port;
 
     try {
-        auto r = ChatGrpcClient::GetInstance()->KickUser(host, port, uid, reason);
+        auto r = ChatGrpcClient::GetInstance()->KickUser(host, port, uid, reason, route.value("generation", 0LL));
         resp->set_error(r.error());
     } catch (const std::exception& e) {
         LOG_WARN("KickUser forward failed: {}", e.what());
@@ -532,9 +516,7 @@ grpc::Status StatusServerImpl::KickUser(grpc::ServerContext* context, const stat
 
 grpc::Status StatusServerImpl::GetNodes(grpc::ServerContext*, const status::GetNodesReq*, status::GetNodesResp* resp)
 {
-    std::lock_guard<std::mutex> g(_nodesMutex);
-    for (auto &kv : _nodes) {
-        auto n = kv.second;
+    for (auto &n : _nodes.List()) {
         auto* item = resp->add_nodes();
         item->set_name(n->name);
         item->set_server_host(n->host);
@@ -542,6 +524,13 @@ grpc::Status StatusServerImpl::GetNodes(grpc::ServerContext*, const status::GetN
         item->set_current_load(n->current_load.load());
         item->set_capacity(n->capacity);
         item->set_last_heartbeat(n->last_heartbeat.load());
+        item->set_rpc_port(n->rpc_port);
+        if (n->reported.load()) {
+            item->set_measured(true);
+            item->set_sessions(static_cast<int>(n->sessions.load() + 0.5));
+            item->set_queue_depth(static_cast<int>(n->queue_depth.load() + 0.5));
+            item->set_cpu(static_cast<int>(n->cpu.load() + 0.5));
+        }
     }
     resp->set_error(0);
     return grpc::Status::OK;
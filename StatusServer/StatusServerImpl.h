@@ -3,25 +3,11 @@
 #include <grpcpp/grpcpp.h>
 #include "status.grpc.pb.h"   // generated from status.proto (package message)
 #include <nlohmann/json.hpp>
-#include <mutex>
-#include <unordered_map>
 #include <memory>
-#include <atomic>
+#include "NodeRegistry.h"
+#include "KickDispatcher.h"
 using json = nlohmann::json;
 
-/**
- * @brief Node information structure
- * 
- */
-struct NodeInfo {
-    std::string name;
-    std::string host;
-    int port = 0;
-    int capacity = 100; // default weight/capacity
-    std::atomic<int> current_load{0};
-    std::atomic<long long> last_heartbeat{0}; // epoch seconds
-};
-
 /**
  * @brief Implementation of the Status Service
  * 
@@ -110,6 +96,16 @@ public:
      */
     grpc::Status QueryUserRoute(grpc::ServerContext* context, const status::RouteReq* req, status::RouteResp* resp) override;
 
+    /**
+     * @brief Check a login token's signature and expiry, for ChatServers that can't reach Redis
+     * 
+     * @param context 
+     * @param req 
+     * @param resp valid is false for a forged, expired or superseded token
+     * @return grpc::Status 
+     */
+    grpc::Status VerifyToken(grpc::ServerContext* context, const status::VerifyTokenReq* req, status::VerifyTokenResp* resp) override;
+
     /**
      * @brief Kick a user if already online
      * 
@@ -132,10 +128,12 @@ public:
 
 private:
     // Node management
-    std::mutex _nodesMutex;
-    std::unordered_map<std::string, std::shared_ptr<NodeInfo>> _nodes; // name -> NodeInfo
-    std::vector<std::shared_ptr<NodeInfo>> _nodeList; // snapshot for iteration
-    size_t _rrIndex = 0;
+    NodeRegistry _nodes;
+    // [StatusServer] Allocation: consistent_hash, or least_loaded (default)
+    bool _hashAllocation = false;
+
+    // repeated-login kicks to ChatServers
+    KickDispatcher _kicks;
 
     // Redis read / write helpers for user route
     bool persistUserRouteToRedis(const std::string& uid, const json& j);
@@ -144,19 +142,13 @@ private:
 
     // utilities
     std::string generateToken(const std::string& uid, const std::string& serverName, int ttlSeconds = 3600);
-    bool validateToken(const std::string& token, const std::string& uid, const std::string& serverName);
-
-    // node helpers
-    void addOrUpdateNode(const status::RegisterNodeReq& req);
-    void removeNode(const std::string& name);
-    void rebuildNodeListLocked();
-
-    // eviction helper
-    void evictStaleNodes(long long nowSec);
+    std::string signToken(const std::string& payload);
+    bool validateToken(const std::string& token, const std::string& uid, const std::string& serverName, long long* expiresAt = nullptr);
 
     // constants
-    const int NODE_STALE_THRESHOLD_SEC = 60; // heartbeat expiry
     const int DEFAULT_TOKEN_TTL = 3600;
 
     std::string _atomicAssignScript;
+    // [StatusServer] token_secret, HMAC key of the login tokens
+    std::string _tokenSecret;
 };
\ No newline at end of file
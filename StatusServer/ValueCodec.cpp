@@ -0,0 +1,67 @@
+#include "ValueCodec.h"
+#include "ConfigManager.h"
+#include "Logger.h"
+
+#include <algorithm>
+
+ValueCodec::ValueCodec()
+{
+	auto& cfg = ConfigManager::GetInstance();
+	_json = cfg["Redis"]["ValueFormat"] == "json";
+	_defaultTTL = std::max(1, cfg.getIntValue("RedisTTL", "Default", 86400));
+	LOG_INFO("Redis value codec - format: {}, default ttl: {}s", FormatName(), _defaultTTL);
+}
+
+std::string ValueCodec::Encode(const nlohmann::json& value) const
+{
+	if (_json) {
+		return value.dump();
+	}
+	auto bytes = nlohmann::json::to_msgpack(value);
+	return std::string(bytes.begin(), bytes.end());
+}
+
+bool ValueCodec::Decode(const std::string& raw, nlohmann::json& out) const
+{
+	if (raw.empty()) {
+		return false;
+	}
+
+	try {
+		// JSON text starts with '{' or '[', which are MessagePack integers, never a map or an array
+		auto first = raw.find_first_not_of(" \t\r\n");
+		if (first != std::string::npos && (raw[first] == '{' || raw[first] == '[')) {
+			out = nlohmann::json::parse(raw);
+		}
+		else {
+			out = nlohmann::json::from_msgpack(raw);
+		}
+		return true;
+	}
+	catch (const nlohmann::json::exception& e) {
+		LOG_WARN("Failed to decode cached value ({} bytes): {}", raw.size(), e.what());
+		return false;
+	}
+}
+
+const char* ValueCodec::FormatName() const
+{
+	return _json ? "json" : "msgpack";
+}
+
+long long ValueCodec::TTL(const std::string& prefix)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	auto iter = _ttls.find(prefix);
+	if (iter != _ttls.end()) {
+		return iter->second;
+	}
+
+	auto ttl = ConfigManager::GetInstance().getIntValue("RedisTTL", prefix, 0);
+	if (ttl <= 0) {
+		LOG_WARN("No TTL configured for Redis keys {}*, using the default of {}s", prefix, _defaultTTL);
+		ttl = static_cast<int>(_defaultTTL);
+	}
+	_ttls[prefix] = ttl;
+	return ttl;
+}
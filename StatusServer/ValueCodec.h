@@ -0,0 +1,53 @@
+#pragma once
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <nlohmann/json.hpp>
+#include "Singleton.h"
+
+/**
+ * @class ValueCodec
+ * @brief How structured values are stored in Redis, and for how long.
+ *
+ * Values are written as MessagePack: no whitespace, binary lengths, and a
+ * cheaper decode than JSON text. Decode still accepts JSON text, so keys
+ * written before the switch (or by a process configured with
+ * [Redis] ValueFormat = json during a mixed-version rollout) stay readable.
+ *
+ * Every key family written here has a TTL from [RedisTTL], looked up by
+ * the family's prefix; families not listed get [RedisTTL] Default.
+ */
+class ValueCodec : public Singleton<ValueCodec>
+{
+	friend class Singleton<ValueCodec>;
+
+public:
+	~ValueCodec() = default;
+
+	std::string Encode(const nlohmann::json& value) const;
+
+	/**
+	 * @brief Parse a stored value, MessagePack or JSON text
+	 *
+	 * @return false if raw is empty or malformed
+	 */
+	bool Decode(const std::string& raw, nlohmann::json& out) const;
+
+	/**
+	 * @brief "msgpack" or "json", for scripts that encode on the server side
+	 */
+	const char* FormatName() const;
+
+	/**
+	 * @brief TTL in seconds for keys starting with prefix, always positive
+	 */
+	long long TTL(const std::string& prefix);
+
+private:
+	ValueCodec();
+
+	bool _json;
+	long long _defaultTTL;
+	std::mutex _mutex;
+	std::unordered_map<std::string, long long> _ttls;
+};
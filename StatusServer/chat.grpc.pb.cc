@@ -23,6 +23,7 @@ namespace chat {
 
 static const char* ChatService_method_names[] = {
   "/chat.ChatService/KickUser",
+  "/chat.ChatService/KickUsers",
 };
 
 std::unique_ptr< ChatService::Stub> ChatService::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
@@ -33,6 +34,7 @@ std::unique_ptr< ChatService::Stub> ChatService::NewStub(const std::shared_ptr<
 
 ChatService::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options)
   : channel_(channel), rpcmethod_KickUser_(ChatService_method_names[0], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_KickUsers_(ChatService_method_names[1], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   {}
 
 ::grpc::Status ChatService::Stub::KickUser(::grpc::ClientContext* context, const ::chat::KickUserReq& request, ::chat::KickUserResp* response) {
@@ -58,6 +60,29 @@ void ChatService::Stub::async::KickUser(::grpc::ClientContext* context, const ::
   return result;
 }
 
+::grpc::Status ChatService::Stub::KickUsers(::grpc::ClientContext* context, const ::chat::KickUsersReq& request, ::chat::KickUsersResp* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::chat::KickUsersReq, ::chat::KickUsersResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_KickUsers_, context, request, response);
+}
+
+void ChatService::Stub::async::KickUsers(::grpc::ClientContext* context, const ::chat::KickUsersReq* request, ::chat::KickUsersResp* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::chat::KickUsersReq, ::chat::KickUsersResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_KickUsers_, context, request, response, std::move(f));
+}
+
+void ChatService::Stub::async::KickUsers(::grpc::ClientContext* context, const ::chat::KickUsersReq* request, ::chat::KickUsersResp* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_KickUsers_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::chat::KickUsersResp>* ChatService::Stub::PrepareAsyncKickUsersRaw(::grpc::ClientContext* context, const ::chat::KickUsersReq& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::chat::KickUsersResp, ::chat::KickUsersReq, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_KickUsers_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::chat::KickUsersResp>* ChatService::Stub::AsyncKickUsersRaw(::grpc::ClientContext* context, const ::chat::KickUsersReq& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncKickUsersRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
 ChatService::Service::Service() {
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       ChatService_method_names[0],
@@ -69,6 +94,16 @@ ChatService::Service::Service() {
              ::chat::KickUserResp* resp) {
                return service->KickUser(ctx, req, resp);
              }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      ChatService_method_names[1],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< ChatService::Service, ::chat::KickUsersReq, ::chat::KickUsersResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](ChatService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::chat::KickUsersReq* req,
+             ::chat::KickUsersResp* resp) {
+               return service->KickUsers(ctx, req, resp);
+             }, this)));
 }
 
 ChatService::Service::~Service() {
@@ -81,6 +116,13 @@ ChatService::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status ChatService::Service::KickUsers(::grpc::ServerContext* context, const ::chat::KickUsersReq* request, ::chat::KickUsersResp* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 
 }  // namespace chat
 
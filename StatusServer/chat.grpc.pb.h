@@ -44,12 +44,23 @@ class ChatService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chat::KickUserResp>> PrepareAsyncKickUser(::grpc::ClientContext* context, const ::chat::KickUserReq& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chat::KickUserResp>>(PrepareAsyncKickUserRaw(context, request, cq));
     }
+    // kick several users of the same server in one call
+    virtual ::grpc::Status KickUsers(::grpc::ClientContext* context, const ::chat::KickUsersReq& request, ::chat::KickUsersResp* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chat::KickUsersResp>> AsyncKickUsers(::grpc::ClientContext* context, const ::chat::KickUsersReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chat::KickUsersResp>>(AsyncKickUsersRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chat::KickUsersResp>> PrepareAsyncKickUsers(::grpc::ClientContext* context, const ::chat::KickUsersReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chat::KickUsersResp>>(PrepareAsyncKickUsersRaw(context, request, cq));
+    }
     class async_interface {
      public:
       virtual ~async_interface() {}
       // kick user if already online
       virtual void KickUser(::grpc::ClientContext* context, const ::chat::KickUserReq* request, ::chat::KickUserResp* response, std::function<void(::grpc::Status)>) = 0;
       virtual void KickUser(::grpc::ClientContext* context, const ::chat::KickUserReq* request, ::chat::KickUserResp* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // kick several users of the same server in one call
+      virtual void KickUsers(::grpc::ClientContext* context, const ::chat::KickUsersReq* request, ::chat::KickUsersResp* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void KickUsers(::grpc::ClientContext* context, const ::chat::KickUsersReq* request, ::chat::KickUsersResp* response, ::grpc::ClientUnaryReactor* reactor) = 0;
     };
     typedef class async_interface experimental_async_interface;
     virtual class async_interface* async() { return nullptr; }
@@ -57,6 +68,8 @@ class ChatService final {
    private:
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::chat::KickUserResp>* AsyncKickUserRaw(::grpc::ClientContext* context, const ::chat::KickUserReq& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::chat::KickUserResp>* PrepareAsyncKickUserRaw(::grpc::ClientContext* context, const ::chat::KickUserReq& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::chat::KickUsersResp>* AsyncKickUsersRaw(::grpc::ClientContext* context, const ::chat::KickUsersReq& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::chat::KickUsersResp>* PrepareAsyncKickUsersRaw(::grpc::ClientContext* context, const ::chat::KickUsersReq& request, ::grpc::CompletionQueue* cq) = 0;
   };
   class Stub final : public StubInterface {
    public:
@@ -68,11 +81,20 @@ class ChatService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chat::KickUserResp>> PrepareAsyncKickUser(::grpc::ClientContext* context, const ::chat::KickUserReq& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chat::KickUserResp>>(PrepareAsyncKickUserRaw(context, request, cq));
     }
+    ::grpc::Status KickUsers(::grpc::ClientContext* context, const ::chat::KickUsersReq& request, ::chat::KickUsersResp* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chat::KickUsersResp>> AsyncKickUsers(::grpc::ClientContext* context, const ::chat::KickUsersReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chat::KickUsersResp>>(AsyncKickUsersRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chat::KickUsersResp>> PrepareAsyncKickUsers(::grpc::ClientContext* context, const ::chat::KickUsersReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chat::KickUsersResp>>(PrepareAsyncKickUsersRaw(context, request, cq));
+    }
     class async final :
       public StubInterface::async_interface {
      public:
       void KickUser(::grpc::ClientContext* context, const ::chat::KickUserReq* request, ::chat::KickUserResp* response, std::function<void(::grpc::Status)>) override;
       void KickUser(::grpc::ClientContext* context, const ::chat::KickUserReq* request, ::chat::KickUserResp* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void KickUsers(::grpc::ClientContext* context, const ::chat::KickUsersReq* request, ::chat::KickUsersResp* response, std::function<void(::grpc::Status)>) override;
+      void KickUsers(::grpc::ClientContext* context, const ::chat::KickUsersReq* request, ::chat::KickUsersResp* response, ::grpc::ClientUnaryReactor* reactor) override;
      private:
       friend class Stub;
       explicit async(Stub* stub): stub_(stub) { }
@@ -86,7 +108,10 @@ class ChatService final {
     class async async_stub_{this};
     ::grpc::ClientAsyncResponseReader< ::chat::KickUserResp>* AsyncKickUserRaw(::grpc::ClientContext* context, const ::chat::KickUserReq& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::chat::KickUserResp>* PrepareAsyncKickUserRaw(::grpc::ClientContext* context, const ::chat::KickUserReq& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::chat::KickUsersResp>* AsyncKickUsersRaw(::grpc::ClientContext* context, const ::chat::KickUsersReq& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::chat::KickUsersResp>* PrepareAsyncKickUsersRaw(::grpc::ClientContext* context, const ::chat::KickUsersReq& request, ::grpc::CompletionQueue* cq) override;
     const ::grpc::internal::RpcMethod rpcmethod_KickUser_;
+    const ::grpc::internal::RpcMethod rpcmethod_KickUsers_;
   };
   static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
 
@@ -96,6 +121,8 @@ class ChatService final {
     virtual ~Service();
     // kick user if already online
     virtual ::grpc::Status KickUser(::grpc::ServerContext* context, const ::chat::KickUserReq* request, ::chat::KickUserResp* response);
+    // kick several users of the same server in one call
+    virtual ::grpc::Status KickUsers(::grpc::ServerContext* context, const ::chat::KickUsersReq* request, ::chat::KickUsersResp* response);
   };
   template <class BaseClass>
   class WithAsyncMethod_KickUser : public BaseClass {
@@ -117,7 +144,27 @@ class ChatService final {
       ::grpc::Service::RequestAsyncUnary(0, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
-  typedef WithAsyncMethod_KickUser<Service > AsyncService;
+  template <class BaseClass>
+  class WithAsyncMethod_KickUsers : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_KickUsers() {
+      ::grpc::Service::MarkMethodAsync(1);
+    }
+    ~WithAsyncMethod_KickUsers() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status KickUsers(::grpc::ServerContext* /*context*/, const ::chat::KickUsersReq* /*request*/, ::chat::KickUsersResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestKickUsers(::grpc::ServerContext* context, ::chat::KickUsersReq* request, ::grpc::ServerAsyncResponseWriter< ::chat::KickUsersResp>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  typedef WithAsyncMethod_KickUser<WithAsyncMethod_KickUsers<Service > > AsyncService;
   template <class BaseClass>
   class WithCallbackMethod_KickUser : public BaseClass {
    private:
@@ -145,7 +192,34 @@ class ChatService final {
     virtual ::grpc::ServerUnaryReactor* KickUser(
       ::grpc::CallbackServerContext* /*context*/, const ::chat::KickUserReq* /*request*/, ::chat::KickUserResp* /*response*/)  { return nullptr; }
   };
-  typedef WithCallbackMethod_KickUser<Service > CallbackService;
+  template <class BaseClass>
+  class WithCallbackMethod_KickUsers : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_KickUsers() {
+      ::grpc::Service::MarkMethodCallback(1,
+          new ::grpc::internal::CallbackUnaryHandler< ::chat::KickUsersReq, ::chat::KickUsersResp>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::chat::KickUsersReq* request, ::chat::KickUsersResp* response) { return this->KickUsers(context, request, response); }));}
+    void SetMessageAllocatorFor_KickUsers(
+        ::grpc::MessageAllocator< ::chat::KickUsersReq, ::chat::KickUsersResp>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(1);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::chat::KickUsersReq, ::chat::KickUsersResp>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_KickUsers() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status KickUsers(::grpc::ServerContext* /*context*/, const ::chat::KickUsersReq* /*request*/, ::chat::KickUsersResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* KickUsers(
+      ::grpc::CallbackServerContext* /*context*/, const ::chat::KickUsersReq* /*request*/, ::chat::KickUsersResp* /*response*/)  { return nullptr; }
+  };
+  typedef WithCallbackMethod_KickUser<WithCallbackMethod_KickUsers<Service > > CallbackService;
   typedef CallbackService ExperimentalCallbackService;
   template <class BaseClass>
   class WithGenericMethod_KickUser : public BaseClass {
@@ -165,6 +239,23 @@ class ChatService final {
     }
   };
   template <class BaseClass>
+  class WithGenericMethod_KickUsers : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_KickUsers() {
+      ::grpc::Service::MarkMethodGeneric(1);
+    }
+    ~WithGenericMethod_KickUsers() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status KickUsers(::grpc::ServerContext* /*context*/, const ::chat::KickUsersReq* /*request*/, ::chat::KickUsersResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
   class WithRawMethod_KickUser : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -185,6 +276,26 @@ class ChatService final {
     }
   };
   template <class BaseClass>
+  class WithRawMethod_KickUsers : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_KickUsers() {
+      ::grpc::Service::MarkMethodRaw(1);
+    }
+    ~WithRawMethod_KickUsers() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status KickUsers(::grpc::ServerContext* /*context*/, const ::chat::KickUsersReq* /*request*/, ::chat::KickUsersResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestKickUsers(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
   class WithRawCallbackMethod_KickUser : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -207,6 +318,28 @@ class ChatService final {
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithRawCallbackMethod_KickUsers : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_KickUsers() {
+      ::grpc::Service::MarkMethodRawCallback(1,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->KickUsers(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_KickUsers() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status KickUsers(::grpc::ServerContext* /*context*/, const ::chat::KickUsersReq* /*request*/, ::chat::KickUsersResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* KickUsers(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
   class WithStreamedUnaryMethod_KickUser : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -233,9 +366,36 @@ class ChatService final {
     // replace default version of method with streamed unary
     virtual ::grpc::Status StreamedKickUser(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::chat::KickUserReq,::chat::KickUserResp>* server_unary_streamer) = 0;
   };
-  typedef WithStreamedUnaryMethod_KickUser<Service > StreamedUnaryService;
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_KickUsers : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_KickUsers() {
+      ::grpc::Service::MarkMethodStreamed(1,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::chat::KickUsersReq, ::chat::KickUsersResp>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::chat::KickUsersReq, ::chat::KickUsersResp>* streamer) {
+                       return this->StreamedKickUsers(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_KickUsers() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status KickUsers(::grpc::ServerContext* /*context*/, const ::chat::KickUsersReq* /*request*/, ::chat::KickUsersResp* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedKickUsers(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::chat::KickUsersReq,::chat::KickUsersResp>* server_unary_streamer) = 0;
+  };
+  typedef WithStreamedUnaryMethod_KickUser<WithStreamedUnaryMethod_KickUsers<Service > > StreamedUnaryService;
   typedef Service SplitStreamedService;
-  typedef WithStreamedUnaryMethod_KickUser<Service > StreamedService;
+  typedef WithStreamedUnaryMethod_KickUser<WithStreamedUnaryMethod_KickUsers<Service > > StreamedService;
 };
 
 }  // namespace chat
@@ -26,6 +26,32 @@ namespace _pbi = ::google::protobuf::internal;
 namespace _fl = ::google::protobuf::internal::field_layout;
 namespace chat {
 
+inline constexpr KickUsersResp::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : error_{0},
+        kicked_{0},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR KickUsersResp::KickUsersResp(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct KickUsersRespDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR KickUsersRespDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~KickUsersRespDefaultTypeInternal() {}
+  union {
+    KickUsersResp _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 KickUsersRespDefaultTypeInternal _KickUsersResp_default_instance_;
+
 inline constexpr KickUserResp::Impl_::Impl_(
     ::_pbi::ConstantInitialized) noexcept
       : error_{0},
@@ -56,6 +82,7 @@ inline constexpr KickUserReq::Impl_::Impl_(
       : uid_(
             &::google::protobuf::internal::fixed_address_empty_string,
             ::_pbi::ConstantInitialized()),
+        generation_{::int64_t{0}},
         reason_{0},
         _cached_size_{0} {}
 
@@ -78,6 +105,31 @@ struct KickUserReqDefaultTypeInternal {
 
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
     PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 KickUserReqDefaultTypeInternal _KickUserReq_default_instance_;
+
+inline constexpr KickUsersReq::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : kicks_{},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR KickUsersReq::KickUsersReq(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct KickUsersReqDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR KickUsersReqDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~KickUsersReqDefaultTypeInternal() {}
+  union {
+    KickUsersReq _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 KickUsersReqDefaultTypeInternal _KickUsersReq_default_instance_;
 }  // namespace chat
 static constexpr const ::_pb::EnumDescriptor**
     file_level_enum_descriptors_chat_2eproto = nullptr;
@@ -96,6 +148,7 @@ const ::uint32_t
         ~0u,  // no sizeof(Split)
         PROTOBUF_FIELD_OFFSET(::chat::KickUserReq, _impl_.uid_),
         PROTOBUF_FIELD_OFFSET(::chat::KickUserReq, _impl_.reason_),
+        PROTOBUF_FIELD_OFFSET(::chat::KickUserReq, _impl_.generation_),
         ~0u,  // no _has_bits_
         PROTOBUF_FIELD_OFFSET(::chat::KickUserResp, _internal_metadata_),
         ~0u,  // no _extensions_
@@ -105,24 +158,52 @@ const ::uint32_t
         ~0u,  // no _split_
         ~0u,  // no sizeof(Split)
         PROTOBUF_FIELD_OFFSET(::chat::KickUserResp, _impl_.error_),
+        ~0u,  // no _has_bits_
+        PROTOBUF_FIELD_OFFSET(::chat::KickUsersReq, _internal_metadata_),
+        ~0u,  // no _extensions_
+        ~0u,  // no _oneof_case_
+        ~0u,  // no _weak_field_map_
+        ~0u,  // no _inlined_string_donated_
+        ~0u,  // no _split_
+        ~0u,  // no sizeof(Split)
+        PROTOBUF_FIELD_OFFSET(::chat::KickUsersReq, _impl_.kicks_),
+        ~0u,  // no _has_bits_
+        PROTOBUF_FIELD_OFFSET(::chat::KickUsersResp, _internal_metadata_),
+        ~0u,  // no _extensions_
+        ~0u,  // no _oneof_case_
+        ~0u,  // no _weak_field_map_
+        ~0u,  // no _inlined_string_donated_
+        ~0u,  // no _split_
+        ~0u,  // no sizeof(Split)
+        PROTOBUF_FIELD_OFFSET(::chat::KickUsersResp, _impl_.error_),
+        PROTOBUF_FIELD_OFFSET(::chat::KickUsersResp, _impl_.kicked_),
 };
 
 static const ::_pbi::MigrationSchema
     schemas[] ABSL_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
         {0, -1, -1, sizeof(::chat::KickUserReq)},
-        {10, -1, -1, sizeof(::chat::KickUserResp)},
+        {11, -1, -1, sizeof(::chat::KickUserResp)},
+        {20, -1, -1, sizeof(::chat::KickUsersReq)},
+        {29, -1, -1, sizeof(::chat::KickUsersResp)},
 };
 static const ::_pb::Message* const file_default_instances[] = {
     &::chat::_KickUserReq_default_instance_._instance,
     &::chat::_KickUserResp_default_instance_._instance,
+    &::chat::_KickUsersReq_default_instance_._instance,
+    &::chat::_KickUsersResp_default_instance_._instance,
 };
 const char descriptor_table_protodef_chat_2eproto[] ABSL_ATTRIBUTE_SECTION_VARIABLE(
     protodesc_cold) = {
     "\n\nchat.proto\022\004chat\032\037google/protobuf/time"
-    "stamp.proto\"*\n\013KickUserReq\022\013\n\003uid\030\001 \001(\t\022"
-    "\016\n\006reason\030\002 \001(\005\"\035\n\014KickUserResp\022\r\n\005error"
-    "\030\001 \001(\0052@\n\013ChatService\0221\n\010KickUser\022\021.chat"
-    ".KickUserReq\032\022.chat.KickUserRespb\006proto3"
+    "stamp.proto\">\n\013KickUserReq\022\013\n\003uid\030\001 \001(\t\022"
+    "\016\n\006reason\030\002 \001(\005\022\022\n\ngeneration\030\003 \001(\003\"\035\n\014K"
+    "ickUserResp\022\r\n\005error\030\001 \001(\005\"0\n\014KickUsersR"
+    "eq\022 \n\005kicks\030\001 \003(\0132\021.chat.KickUserReq\".\n\r"
+    "KickUsersResp\022\r\n\005error\030\001 \001(\005\022\016\n\006kicked\030\002"
+    " \001(\0052v\n\013ChatService\0221\n\010KickUser\022\021.chat.K"
+    "ickUserReq\032\022.chat.KickUserResp\0224\n\tKickUs"
+    "ers\022\022.chat.KickUsersReq\032\023.chat.KickUsers"
+    "Respb\006proto3"
 };
 static const ::_pbi::DescriptorTable* const descriptor_table_chat_2eproto_deps[1] =
     {
@@ -132,13 +213,13 @@ static ::absl::once_flag descriptor_table_chat_2eproto_once;
 PROTOBUF_CONSTINIT const ::_pbi::DescriptorTable descriptor_table_chat_2eproto = {
     false,
     false,
-    200,
+    372,
     descriptor_table_protodef_chat_2eproto,
     "chat.proto",
     &descriptor_table_chat_2eproto_once,
     descriptor_table_chat_2eproto_deps,
     1,
-    2,
+    4,
     schemas,
     file_default_instances,
     TableStruct_chat_2eproto::offsets,
@@ -180,7 +261,13 @@ KickUserReq::KickUserReq(
   _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
       from._internal_metadata_);
   new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  _impl_.reason_ = from._impl_.reason_;
+  ::memcpy(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, generation_),
+           reinterpret_cast<const char *>(&from._impl_) +
+               offsetof(Impl_, generation_),
+           offsetof(Impl_, reason_) -
+               offsetof(Impl_, generation_) +
+               sizeof(Impl_::reason_));
 
   // @@protoc_insertion_point(copy_constructor:chat.KickUserReq)
 }
@@ -192,7 +279,12 @@ inline PROTOBUF_NDEBUG_INLINE KickUserReq::Impl_::Impl_(
 
 inline void KickUserReq::SharedCtor(::_pb::Arena* arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.reason_ = {};
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, generation_),
+           0,
+           offsetof(Impl_, reason_) -
+               offsetof(Impl_, generation_) +
+               sizeof(Impl_::reason_));
 }
 KickUserReq::~KickUserReq() {
   // @@protoc_insertion_point(destructor:chat.KickUserReq)
@@ -242,15 +334,15 @@ const ::google::protobuf::internal::ClassData* KickUserReq::GetClassData() const
   return _class_data_.base();
 }
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 0, 28, 2> KickUserReq::_table_ = {
+const ::_pbi::TcParseTable<2, 3, 0, 28, 2> KickUserReq::_table_ = {
   {
     0,  // no _has_bits_
     0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
+    3, 24,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
+    4294967288,  // skipmap
     offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
+    3,  // num_field_entries
     0,  // num_aux_entries
     offsetof(decltype(_table_), field_names),  // no aux_entries
     _class_data_.base(),
@@ -260,12 +352,16 @@ const ::_pbi::TcParseTable<1, 2, 0, 28, 2> KickUserReq::_table_ = {
     ::_pbi::TcParser::GetTable<::chat::KickUserReq>(),  // to_prefetch
     #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
   }, {{
-    // int32 reason = 2;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(KickUserReq, _impl_.reason_), 63>(),
-     {16, 63, 0, PROTOBUF_FIELD_OFFSET(KickUserReq, _impl_.reason_)}},
+    {::_pbi::TcParser::MiniParse, {}},
     // string uid = 1;
     {::_pbi::TcParser::FastUS1,
      {10, 63, 0, PROTOBUF_FIELD_OFFSET(KickUserReq, _impl_.uid_)}},
+    // int32 reason = 2;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(KickUserReq, _impl_.reason_), 63>(),
+     {16, 63, 0, PROTOBUF_FIELD_OFFSET(KickUserReq, _impl_.reason_)}},
+    // int64 generation = 3;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(KickUserReq, _impl_.generation_), 63>(),
+     {24, 63, 0, PROTOBUF_FIELD_OFFSET(KickUserReq, _impl_.generation_)}},
   }}, {{
     65535, 65535
   }}, {{
@@ -275,6 +371,9 @@ const ::_pbi::TcParseTable<1, 2, 0, 28, 2> KickUserReq::_table_ = {
     // int32 reason = 2;
     {PROTOBUF_FIELD_OFFSET(KickUserReq, _impl_.reason_), 0, 0,
     (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+    // int64 generation = 3;
+    {PROTOBUF_FIELD_OFFSET(KickUserReq, _impl_.generation_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt64)},
   }},
   // no aux_entries
   {{
@@ -292,7 +391,9 @@ PROTOBUF_NOINLINE void KickUserReq::Clear() {
   (void) cached_has_bits;
 
   _impl_.uid_.ClearToEmpty();
-  _impl_.reason_ = 0;
+  ::memset(&_impl_.generation_, 0, static_cast<::size_t>(
+      reinterpret_cast<char*>(&_impl_.reason_) -
+      reinterpret_cast<char*>(&_impl_.generation_)) + sizeof(_impl_.reason_));
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
 
@@ -326,6 +427,13 @@ PROTOBUF_NOINLINE void KickUserReq::Clear() {
                     stream, this_._internal_reason(), target);
           }
 
+          // int64 generation = 3;
+          if (this_._internal_generation() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt64ToArrayWithField<3>(
+                    stream, this_._internal_generation(), target);
+          }
+
           if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
             target =
                 ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
@@ -356,6 +464,11 @@ PROTOBUF_NOINLINE void KickUserReq::Clear() {
               total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
                                               this_._internal_uid());
             }
+            // int64 generation = 3;
+            if (this_._internal_generation() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(
+                  this_._internal_generation());
+            }
             // int32 reason = 2;
             if (this_._internal_reason() != 0) {
               total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
@@ -377,6 +490,9 @@ void KickUserReq::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::goo
   if (!from._internal_uid().empty()) {
     _this->_internal_set_uid(from._internal_uid());
   }
+  if (from._internal_generation() != 0) {
+    _this->_impl_.generation_ = from._impl_.generation_;
+  }
   if (from._internal_reason() != 0) {
     _this->_impl_.reason_ = from._impl_.reason_;
   }
@@ -397,7 +513,12 @@ void KickUserReq::InternalSwap(KickUserReq* PROTOBUF_RESTRICT other) {
   ABSL_DCHECK_EQ(arena, other->GetArena());
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.uid_, &other->_impl_.uid_, arena);
-        swap(_impl_.reason_, other->_impl_.reason_);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(KickUserReq, _impl_.reason_)
+      + sizeof(KickUserReq::_impl_.reason_)
+      - PROTOBUF_FIELD_OFFSET(KickUserReq, _impl_.generation_)>(
+          reinterpret_cast<char*>(&_impl_.generation_),
+          reinterpret_cast<char*>(&other->_impl_.generation_));
 }
 
 ::google::protobuf::Metadata KickUserReq::GetMetadata() const {
@@ -610,6 +731,488 @@ void KickUserResp::InternalSwap(KickUserResp* PROTOBUF_RESTRICT other) {
 ::google::protobuf::Metadata KickUserResp::GetMetadata() const {
   return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
 }
+// ===================================================================
+
+class KickUsersReq::_Internal {
+ public:
+};
+
+KickUsersReq::KickUsersReq(::google::protobuf::Arena* arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:chat.KickUsersReq)
+}
+inline PROTOBUF_NDEBUG_INLINE KickUsersReq::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from, const ::chat::KickUsersReq& from_msg)
+      : kicks_{visibility, arena, from.kicks_},
+        _cached_size_{0} {}
+
+KickUsersReq::KickUsersReq(
+    ::google::protobuf::Arena* arena,
+    const KickUsersReq& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  KickUsersReq* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+
+  // @@protoc_insertion_point(copy_constructor:chat.KickUsersReq)
+}
+inline PROTOBUF_NDEBUG_INLINE KickUsersReq::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : kicks_{visibility, arena},
+        _cached_size_{0} {}
+
+inline void KickUsersReq::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+KickUsersReq::~KickUsersReq() {
+  // @@protoc_insertion_point(destructor:chat.KickUsersReq)
+  SharedDtor(*this);
+}
+inline void KickUsersReq::SharedDtor(MessageLite& self) {
+  KickUsersReq& this_ = static_cast<KickUsersReq&>(self);
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.~Impl_();
+}
+
+inline void* KickUsersReq::PlacementNew_(const void*, void* mem,
+                                        ::google::protobuf::Arena* arena) {
+  return ::new (mem) KickUsersReq(arena);
+}
+constexpr auto KickUsersReq::InternalNewImpl_() {
+  constexpr auto arena_bits = ::google::protobuf::internal::EncodePlacementArenaOffsets({
+      PROTOBUF_FIELD_OFFSET(KickUsersReq, _impl_.kicks_) +
+          decltype(KickUsersReq::_impl_.kicks_)::
+              InternalGetArenaOffset(
+                  ::google::protobuf::Message::internal_visibility()),
+  });
+  if (arena_bits.has_value()) {
+    return ::google::protobuf::internal::MessageCreator::ZeroInit(
+        sizeof(KickUsersReq), alignof(KickUsersReq), *arena_bits);
+  } else {
+    return ::google::protobuf::internal::MessageCreator(&KickUsersReq::PlacementNew_,
+                                 sizeof(KickUsersReq),
+                                 alignof(KickUsersReq));
+  }
+}
+PROTOBUF_CONSTINIT
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::google::protobuf::internal::ClassDataFull KickUsersReq::_class_data_ = {
+    ::google::protobuf::internal::ClassData{
+        &_KickUsersReq_default_instance_._instance,
+        &_table_.header,
+        nullptr,  // OnDemandRegisterArenaDtor
+        nullptr,  // IsInitialized
+        &KickUsersReq::MergeImpl,
+        ::google::protobuf::Message::GetNewImpl<KickUsersReq>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        &KickUsersReq::SharedDtor,
+        ::google::protobuf::Message::GetClearImpl<KickUsersReq>(), &KickUsersReq::ByteSizeLong,
+            &KickUsersReq::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+        PROTOBUF_FIELD_OFFSET(KickUsersReq, _impl_._cached_size_),
+        false,
+    },
+    &KickUsersReq::kDescriptorMethods,
+    &descriptor_table_chat_2eproto,
+    nullptr,  // tracker
+};
+const ::google::protobuf::internal::ClassData* KickUsersReq::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
+  return _class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 1, 0, 2> KickUsersReq::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    1, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967294,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    1,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    _class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::chat::KickUsersReq>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    // repeated .chat.KickUserReq kicks = 1;
+    {::_pbi::TcParser::FastMtR1,
+     {10, 63, 0, PROTOBUF_FIELD_OFFSET(KickUsersReq, _impl_.kicks_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // repeated .chat.KickUserReq kicks = 1;
+    {PROTOBUF_FIELD_OFFSET(KickUsersReq, _impl_.kicks_), 0, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+  }}, {{
+    {::_pbi::TcParser::GetTable<::chat::KickUserReq>()},
+  }}, {{
+  }},
+};
+
+PROTOBUF_NOINLINE void KickUsersReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.KickUsersReq)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.kicks_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::uint8_t* KickUsersReq::_InternalSerialize(
+            const MessageLite& base, ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) {
+          const KickUsersReq& this_ = static_cast<const KickUsersReq&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::uint8_t* KickUsersReq::_InternalSerialize(
+            ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+          const KickUsersReq& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(serialize_to_array_start:chat.KickUsersReq)
+          ::uint32_t cached_has_bits = 0;
+          (void)cached_has_bits;
+
+          // repeated .chat.KickUserReq kicks = 1;
+          for (unsigned i = 0, n = static_cast<unsigned>(
+                                   this_._internal_kicks_size());
+               i < n; i++) {
+            const auto& repfield = this_._internal_kicks().Get(i);
+            target =
+                ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+                    1, repfield, repfield.GetCachedSize(),
+                    target, stream);
+          }
+
+          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+            target =
+                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+          }
+          // @@protoc_insertion_point(serialize_to_array_end:chat.KickUsersReq)
+          return target;
+        }
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::size_t KickUsersReq::ByteSizeLong(const MessageLite& base) {
+          const KickUsersReq& this_ = static_cast<const KickUsersReq&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::size_t KickUsersReq::ByteSizeLong() const {
+          const KickUsersReq& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(message_byte_size_start:chat.KickUsersReq)
+          ::size_t total_size = 0;
+
+          ::uint32_t cached_has_bits = 0;
+          // Prevent compiler warnings about cached_has_bits being unused
+          (void)cached_has_bits;
+
+           {
+            // repeated .chat.KickUserReq kicks = 1;
+            {
+              total_size += 1UL * this_._internal_kicks_size();
+              for (const auto& msg : this_._internal_kicks()) {
+                total_size += ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+              }
+            }
+          }
+          return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                                     &this_._impl_._cached_size_);
+        }
+
+void KickUsersReq::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+  auto* const _this = static_cast<KickUsersReq*>(&to_msg);
+  auto& from = static_cast<const KickUsersReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.KickUsersReq)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_internal_mutable_kicks()->MergeFrom(
+      from._internal_kicks());
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void KickUsersReq::CopyFrom(const KickUsersReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.KickUsersReq)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void KickUsersReq::InternalSwap(KickUsersReq* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.kicks_.InternalSwap(&other->_impl_.kicks_);
+}
+
+::google::protobuf::Metadata KickUsersReq::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class KickUsersResp::_Internal {
+ public:
+};
+
+KickUsersResp::KickUsersResp(::google::protobuf::Arena* arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:chat.KickUsersResp)
+}
+KickUsersResp::KickUsersResp(
+    ::google::protobuf::Arena* arena, const KickUsersResp& from)
+    : KickUsersResp(arena) {
+  MergeFrom(from);
+}
+inline PROTOBUF_NDEBUG_INLINE KickUsersResp::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : _cached_size_{0} {}
+
+inline void KickUsersResp::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, error_),
+           0,
+           offsetof(Impl_, kicked_) -
+               offsetof(Impl_, error_) +
+               sizeof(Impl_::kicked_));
+}
+KickUsersResp::~KickUsersResp() {
+  // @@protoc_insertion_point(destructor:chat.KickUsersResp)
+  SharedDtor(*this);
+}
+inline void KickUsersResp::SharedDtor(MessageLite& self) {
+  KickUsersResp& this_ = static_cast<KickUsersResp&>(self);
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.~Impl_();
+}
+
+inline void* KickUsersResp::PlacementNew_(const void*, void* mem,
+                                        ::google::protobuf::Arena* arena) {
+  return ::new (mem) KickUsersResp(arena);
+}
+constexpr auto KickUsersResp::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(KickUsersResp),
+                                            alignof(KickUsersResp));
+}
+PROTOBUF_CONSTINIT
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::google::protobuf::internal::ClassDataFull KickUsersResp::_class_data_ = {
+    ::google::protobuf::internal::ClassData{
+        &_KickUsersResp_default_instance_._instance,
+        &_table_.header,
+        nullptr,  // OnDemandRegisterArenaDtor
+        nullptr,  // IsInitialized
+        &KickUsersResp::MergeImpl,
+        ::google::protobuf::Message::GetNewImpl<KickUsersResp>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        &KickUsersResp::SharedDtor,
+        ::google::protobuf::Message::GetClearImpl<KickUsersResp>(), &KickUsersResp::ByteSizeLong,
+            &KickUsersResp::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+        PROTOBUF_FIELD_OFFSET(KickUsersResp, _impl_._cached_size_),
+        false,
+    },
+    &KickUsersResp::kDescriptorMethods,
+    &descriptor_table_chat_2eproto,
+    nullptr,  // tracker
+};
+const ::google::protobuf::internal::ClassData* KickUsersResp::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
+  return _class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<1, 2, 0, 0, 2> KickUsersResp::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    2, 8,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967292,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    2,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    _class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::chat::KickUsersResp>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    // int32 kicked = 2;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(KickUsersResp, _impl_.kicked_), 63>(),
+     {16, 63, 0, PROTOBUF_FIELD_OFFSET(KickUsersResp, _impl_.kicked_)}},
+    // int32 error = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(KickUsersResp, _impl_.error_), 63>(),
+     {8, 63, 0, PROTOBUF_FIELD_OFFSET(KickUsersResp, _impl_.error_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // int32 error = 1;
+    {PROTOBUF_FIELD_OFFSET(KickUsersResp, _impl_.error_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+    // int32 kicked = 2;
+    {PROTOBUF_FIELD_OFFSET(KickUsersResp, _impl_.kicked_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+  }},
+  // no aux_entries
+  {{
+  }},
+};
+
+PROTOBUF_NOINLINE void KickUsersResp::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.KickUsersResp)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.error_, 0, static_cast<::size_t>(
+      reinterpret_cast<char*>(&_impl_.kicked_) -
+      reinterpret_cast<char*>(&_impl_.error_)) + sizeof(_impl_.kicked_));
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::uint8_t* KickUsersResp::_InternalSerialize(
+            const MessageLite& base, ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) {
+          const KickUsersResp& this_ = static_cast<const KickUsersResp&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::uint8_t* KickUsersResp::_InternalSerialize(
+            ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+          const KickUsersResp& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(serialize_to_array_start:chat.KickUsersResp)
+          ::uint32_t cached_has_bits = 0;
+          (void)cached_has_bits;
+
+          // int32 error = 1;
+          if (this_._internal_error() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt32ToArrayWithField<1>(
+                    stream, this_._internal_error(), target);
+          }
+
+          // int32 kicked = 2;
+          if (this_._internal_kicked() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt32ToArrayWithField<2>(
+                    stream, this_._internal_kicked(), target);
+          }
+
+          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+            target =
+                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+          }
+          // @@protoc_insertion_point(serialize_to_array_end:chat.KickUsersResp)
+          return target;
+        }
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::size_t KickUsersResp::ByteSizeLong(const MessageLite& base) {
+          const KickUsersResp& this_ = static_cast<const KickUsersResp&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::size_t KickUsersResp::ByteSizeLong() const {
+          const KickUsersResp& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(message_byte_size_start:chat.KickUsersResp)
+          ::size_t total_size = 0;
+
+          ::uint32_t cached_has_bits = 0;
+          // Prevent compiler warnings about cached_has_bits being unused
+          (void)cached_has_bits;
+
+          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+           {
+            // int32 error = 1;
+            if (this_._internal_error() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+                  this_._internal_error());
+            }
+            // int32 kicked = 2;
+            if (this_._internal_kicked() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+                  this_._internal_kicked());
+            }
+          }
+          return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                                     &this_._impl_._cached_size_);
+        }
+
+void KickUsersResp::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+  auto* const _this = static_cast<KickUsersResp*>(&to_msg);
+  auto& from = static_cast<const KickUsersResp&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.KickUsersResp)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_error() != 0) {
+    _this->_impl_.error_ = from._impl_.error_;
+  }
+  if (from._internal_kicked() != 0) {
+    _this->_impl_.kicked_ = from._impl_.kicked_;
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void KickUsersResp::CopyFrom(const KickUsersResp& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.KickUsersResp)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void KickUsersResp::InternalSwap(KickUsersResp* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(KickUsersResp, _impl_.kicked_)
+      + sizeof(KickUsersResp::_impl_.kicked_)
+      - PROTOBUF_FIELD_OFFSET(KickUsersResp, _impl_.error_)>(
+          reinterpret_cast<char*>(&_impl_.error_),
+          reinterpret_cast<char*>(&other->_impl_.error_));
+}
+
+::google::protobuf::Metadata KickUsersResp::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace chat
 namespace google {
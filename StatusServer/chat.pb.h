@@ -59,6 +59,12 @@ extern KickUserReqDefaultTypeInternal _KickUserReq_default_instance_;
 class KickUserResp;
 struct KickUserRespDefaultTypeInternal;
 extern KickUserRespDefaultTypeInternal _KickUserResp_default_instance_;
+class KickUsersReq;
+struct KickUsersReqDefaultTypeInternal;
+extern KickUsersReqDefaultTypeInternal _KickUsersReq_default_instance_;
+class KickUsersResp;
+struct KickUsersRespDefaultTypeInternal;
+extern KickUsersRespDefaultTypeInternal _KickUsersResp_default_instance_;
 }  // namespace chat
 namespace google {
 namespace protobuf {
@@ -72,6 +78,208 @@ namespace chat {
 
 // -------------------------------------------------------------------
 
+class KickUsersResp final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:chat.KickUsersResp) */ {
+ public:
+  inline KickUsersResp() : KickUsersResp(nullptr) {}
+  ~KickUsersResp() PROTOBUF_FINAL;
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+  void operator delete(KickUsersResp* msg, std::destroying_delete_t) {
+    SharedDtor(*msg);
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(KickUsersResp));
+  }
+#endif
+
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR KickUsersResp(
+      ::google::protobuf::internal::ConstantInitialized);
+
+  inline KickUsersResp(const KickUsersResp& from) : KickUsersResp(nullptr, from) {}
+  inline KickUsersResp(KickUsersResp&& from) noexcept
+      : KickUsersResp(nullptr, std::move(from)) {}
+  inline KickUsersResp& operator=(const KickUsersResp& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline KickUsersResp& operator=(KickUsersResp&& from) noexcept {
+    if (this == &from) return *this;
+    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const KickUsersResp& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const KickUsersResp* internal_default_instance() {
+    return reinterpret_cast<const KickUsersResp*>(
+        &_KickUsersResp_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages = 3;
+  friend void swap(KickUsersResp& a, KickUsersResp& b) { a.Swap(&b); }
+  inline void Swap(KickUsersResp* other) {
+    if (other == this) return;
+    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(KickUsersResp* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  KickUsersResp* New(::google::protobuf::Arena* arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<KickUsersResp>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const KickUsersResp& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom(const KickUsersResp& from) { KickUsersResp::MergeImpl(*this, from); }
+
+  private:
+  static void MergeImpl(
+      ::google::protobuf::MessageLite& to_msg,
+      const ::google::protobuf::MessageLite& from_msg);
+
+  public:
+  bool IsInitialized() const {
+    return true;
+  }
+  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
+  #if defined(PROTOBUF_CUSTOM_VTABLE)
+  private:
+  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
+  static ::uint8_t* _InternalSerialize(
+      const MessageLite& msg, ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream);
+
+  public:
+  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+    return _InternalSerialize(*this, target, stream);
+  }
+  #else   // PROTOBUF_CUSTOM_VTABLE
+  ::size_t ByteSizeLong() const final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  #endif  // PROTOBUF_CUSTOM_VTABLE
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::google::protobuf::Arena* arena);
+  static void SharedDtor(MessageLite& self);
+  void InternalSwap(KickUsersResp* other);
+ private:
+  template <typename T>
+  friend ::absl::string_view(
+      ::google::protobuf::internal::GetAnyMessageName)();
+  static ::absl::string_view FullMessageName() { return "chat.KickUsersResp"; }
+
+ protected:
+  explicit KickUsersResp(::google::protobuf::Arena* arena);
+  KickUsersResp(::google::protobuf::Arena* arena, const KickUsersResp& from);
+  KickUsersResp(::google::protobuf::Arena* arena, KickUsersResp&& from) noexcept
+      : KickUsersResp(arena) {
+    *this = ::std::move(from);
+  }
+  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
+  static void* PlacementNew_(const void*, void* mem,
+                             ::google::protobuf::Arena* arena);
+  static constexpr auto InternalNewImpl_();
+  static const ::google::protobuf::internal::ClassDataFull _class_data_;
+
+ public:
+  ::google::protobuf::Metadata GetMetadata() const;
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+  enum : int {
+    kErrorFieldNumber = 1,
+    kKickedFieldNumber = 2,
+  };
+  // int32 error = 1;
+  void clear_error() ;
+  ::int32_t error() const;
+  void set_error(::int32_t value);
+
+  private:
+  ::int32_t _internal_error() const;
+  void _internal_set_error(::int32_t value);
+
+  public:
+  // int32 kicked = 2;
+  void clear_kicked() ;
+  ::int32_t kicked() const;
+  void set_kicked(::int32_t value);
+
+  private:
+  ::int32_t _internal_kicked() const;
+  void _internal_set_kicked(::int32_t value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:chat.KickUsersResp)
+ private:
+  class _Internal;
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      1, 2, 0,
+      0, 2>
+      _table_;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+    inline explicit constexpr Impl_(
+        ::google::protobuf::internal::ConstantInitialized) noexcept;
+    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                          ::google::protobuf::Arena* arena);
+    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                          ::google::protobuf::Arena* arena, const Impl_& from,
+                          const KickUsersResp& from_msg);
+    ::int32_t error_;
+    ::int32_t kicked_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
 class KickUserResp final : public ::google::protobuf::Message
 /* @@protoc_insertion_point(class_definition:chat.KickUserResp) */ {
  public:
@@ -409,6 +617,7 @@ class KickUserReq final : public ::google::protobuf::Message
   // accessors -------------------------------------------------------
   enum : int {
     kUidFieldNumber = 1,
+    kGenerationFieldNumber = 3,
     kReasonFieldNumber = 2,
   };
   // string uid = 1;
@@ -426,6 +635,16 @@ class KickUserReq final : public ::google::protobuf::Message
       const std::string& value);
   std::string* _internal_mutable_uid();
 
+  public:
+  // int64 generation = 3;
+  void clear_generation() ;
+  ::int64_t generation() const;
+  void set_generation(::int64_t value);
+
+  private:
+  ::int64_t _internal_generation() const;
+  void _internal_set_generation(::int64_t value);
+
   public:
   // int32 reason = 2;
   void clear_reason() ;
@@ -442,7 +661,7 @@ class KickUserReq final : public ::google::protobuf::Message
   class _Internal;
   friend class ::google::protobuf::internal::TcParser;
   static const ::google::protobuf::internal::TcParseTable<
-      1, 2, 0,
+      2, 3, 0,
       28, 2>
       _table_;
 
@@ -461,6 +680,7 @@ class KickUserReq final : public ::google::protobuf::Message
                           ::google::protobuf::Arena* arena, const Impl_& from,
                           const KickUserReq& from_msg);
     ::google::protobuf::internal::ArenaStringPtr uid_;
+    ::int64_t generation_;
     ::int32_t reason_;
     ::google::protobuf::internal::CachedSize _cached_size_;
     PROTOBUF_TSAN_DECLARE_MEMBER
@@ -468,6 +688,203 @@ class KickUserReq final : public ::google::protobuf::Message
   union { Impl_ _impl_; };
   friend struct ::TableStruct_chat_2eproto;
 };
+// -------------------------------------------------------------------
+
+class KickUsersReq final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:chat.KickUsersReq) */ {
+ public:
+  inline KickUsersReq() : KickUsersReq(nullptr) {}
+  ~KickUsersReq() PROTOBUF_FINAL;
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+  void operator delete(KickUsersReq* msg, std::destroying_delete_t) {
+    SharedDtor(*msg);
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(KickUsersReq));
+  }
+#endif
+
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR KickUsersReq(
+      ::google::protobuf::internal::ConstantInitialized);
+
+  inline KickUsersReq(const KickUsersReq& from) : KickUsersReq(nullptr, from) {}
+  inline KickUsersReq(KickUsersReq&& from) noexcept
+      : KickUsersReq(nullptr, std::move(from)) {}
+  inline KickUsersReq& operator=(const KickUsersReq& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline KickUsersReq& operator=(KickUsersReq&& from) noexcept {
+    if (this == &from) return *this;
+    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const KickUsersReq& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const KickUsersReq* internal_default_instance() {
+    return reinterpret_cast<const KickUsersReq*>(
+        &_KickUsersReq_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages = 2;
+  friend void swap(KickUsersReq& a, KickUsersReq& b) { a.Swap(&b); }
+  inline void Swap(KickUsersReq* other) {
+    if (other == this) return;
+    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(KickUsersReq* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  KickUsersReq* New(::google::protobuf::Arena* arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<KickUsersReq>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const KickUsersReq& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom(const KickUsersReq& from) { KickUsersReq::MergeImpl(*this, from); }
+
+  private:
+  static void MergeImpl(
+      ::google::protobuf::MessageLite& to_msg,
+      const ::google::protobuf::MessageLite& from_msg);
+
+  public:
+  bool IsInitialized() const {
+    return true;
+  }
+  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
+  #if defined(PROTOBUF_CUSTOM_VTABLE)
+  private:
+  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
+  static ::uint8_t* _InternalSerialize(
+      const MessageLite& msg, ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream);
+
+  public:
+  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+    return _InternalSerialize(*this, target, stream);
+  }
+  #else   // PROTOBUF_CUSTOM_VTABLE
+  ::size_t ByteSizeLong() const final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  #endif  // PROTOBUF_CUSTOM_VTABLE
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::google::protobuf::Arena* arena);
+  static void SharedDtor(MessageLite& self);
+  void InternalSwap(KickUsersReq* other);
+ private:
+  template <typename T>
+  friend ::absl::string_view(
+      ::google::protobuf::internal::GetAnyMessageName)();
+  static ::absl::string_view FullMessageName() { return "chat.KickUsersReq"; }
+
+ protected:
+  explicit KickUsersReq(::google::protobuf::Arena* arena);
+  KickUsersReq(::google::protobuf::Arena* arena, const KickUsersReq& from);
+  KickUsersReq(::google::protobuf::Arena* arena, KickUsersReq&& from) noexcept
+      : KickUsersReq(arena) {
+    *this = ::std::move(from);
+  }
+  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
+  static void* PlacementNew_(const void*, void* mem,
+                             ::google::protobuf::Arena* arena);
+  static constexpr auto InternalNewImpl_();
+  static const ::google::protobuf::internal::ClassDataFull _class_data_;
+
+ public:
+  ::google::protobuf::Metadata GetMetadata() const;
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+  enum : int {
+    kKicksFieldNumber = 1,
+  };
+  // repeated .chat.KickUserReq kicks = 1;
+  int kicks_size() const;
+  private:
+  int _internal_kicks_size() const;
+
+  public:
+  void clear_kicks() ;
+  ::chat::KickUserReq* mutable_kicks(int index);
+  ::google::protobuf::RepeatedPtrField<::chat::KickUserReq>* mutable_kicks();
+
+  private:
+  const ::google::protobuf::RepeatedPtrField<::chat::KickUserReq>& _internal_kicks() const;
+  ::google::protobuf::RepeatedPtrField<::chat::KickUserReq>* _internal_mutable_kicks();
+  public:
+  const ::chat::KickUserReq& kicks(int index) const;
+  ::chat::KickUserReq* add_kicks();
+  const ::google::protobuf::RepeatedPtrField<::chat::KickUserReq>& kicks() const;
+  // @@protoc_insertion_point(class_scope:chat.KickUsersReq)
+ private:
+  class _Internal;
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 1, 1,
+      0, 2>
+      _table_;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+    inline explicit constexpr Impl_(
+        ::google::protobuf::internal::ConstantInitialized) noexcept;
+    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                          ::google::protobuf::Arena* arena);
+    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                          ::google::protobuf::Arena* arena, const Impl_& from,
+                          const KickUsersReq& from_msg);
+    ::google::protobuf::RepeatedPtrField< ::chat::KickUserReq > kicks_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
 
 // ===================================================================
 
@@ -555,6 +972,28 @@ inline void KickUserReq::_internal_set_reason(::int32_t value) {
   _impl_.reason_ = value;
 }
 
+// int64 generation = 3;
+inline void KickUserReq::clear_generation() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.generation_ = ::int64_t{0};
+}
+inline ::int64_t KickUserReq::generation() const {
+  // @@protoc_insertion_point(field_get:chat.KickUserReq.generation)
+  return _internal_generation();
+}
+inline void KickUserReq::set_generation(::int64_t value) {
+  _internal_set_generation(value);
+  // @@protoc_insertion_point(field_set:chat.KickUserReq.generation)
+}
+inline ::int64_t KickUserReq::_internal_generation() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.generation_;
+}
+inline void KickUserReq::_internal_set_generation(::int64_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.generation_ = value;
+}
+
 // -------------------------------------------------------------------
 
 // KickUserResp
@@ -581,6 +1020,107 @@ inline void KickUserResp::_internal_set_error(::int32_t value) {
   _impl_.error_ = value;
 }
 
+// -------------------------------------------------------------------
+
+// KickUsersReq
+
+// repeated .chat.KickUserReq kicks = 1;
+inline int KickUsersReq::_internal_kicks_size() const {
+  return _internal_kicks().size();
+}
+inline int KickUsersReq::kicks_size() const {
+  return _internal_kicks_size();
+}
+inline void KickUsersReq::clear_kicks() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.kicks_.Clear();
+}
+inline ::chat::KickUserReq* KickUsersReq::mutable_kicks(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:chat.KickUsersReq.kicks)
+  return _internal_mutable_kicks()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::chat::KickUserReq>* KickUsersReq::mutable_kicks()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:chat.KickUsersReq.kicks)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _internal_mutable_kicks();
+}
+inline const ::chat::KickUserReq& KickUsersReq::kicks(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:chat.KickUsersReq.kicks)
+  return _internal_kicks().Get(index);
+}
+inline ::chat::KickUserReq* KickUsersReq::add_kicks() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::chat::KickUserReq* _add = _internal_mutable_kicks()->Add();
+  // @@protoc_insertion_point(field_add:chat.KickUsersReq.kicks)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::chat::KickUserReq>& KickUsersReq::kicks() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:chat.KickUsersReq.kicks)
+  return _internal_kicks();
+}
+inline const ::google::protobuf::RepeatedPtrField<::chat::KickUserReq>&
+KickUsersReq::_internal_kicks() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.kicks_;
+}
+inline ::google::protobuf::RepeatedPtrField<::chat::KickUserReq>*
+KickUsersReq::_internal_mutable_kicks() {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return &_impl_.kicks_;
+}
+
+// -------------------------------------------------------------------
+
+// KickUsersResp
+
+// int32 error = 1;
+inline void KickUsersResp::clear_error() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.error_ = 0;
+}
+inline ::int32_t KickUsersResp::error() const {
+  // @@protoc_insertion_point(field_get:chat.KickUsersResp.error)
+  return _internal_error();
+}
+inline void KickUsersResp::set_error(::int32_t value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:chat.KickUsersResp.error)
+}
+inline ::int32_t KickUsersResp::_internal_error() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.error_;
+}
+inline void KickUsersResp::_internal_set_error(::int32_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.error_ = value;
+}
+
+// int32 kicked = 2;
+inline void KickUsersResp::clear_kicked() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.kicked_ = 0;
+}
+inline ::int32_t KickUsersResp::kicked() const {
+  // @@protoc_insertion_point(field_get:chat.KickUsersResp.kicked)
+  return _internal_kicked();
+}
+inline void KickUsersResp::set_kicked(::int32_t value) {
+  _internal_set_kicked(value);
+  // @@protoc_insertion_point(field_set:chat.KickUsersResp.kicked)
+}
+inline ::int32_t KickUsersResp::_internal_kicked() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.kicked_;
+}
+inline void KickUsersResp::_internal_set_kicked(::int32_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.kicked_ = value;
+}
+
 #ifdef __GNUC__
 #pragma GCC diagnostic pop
 #endif  // __GNUC__
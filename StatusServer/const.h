@@ -2,7 +2,6 @@
 
 namespace StatusServerCode {
 	constexpr auto UserRouteKey = "status_user:";
-	constexpr auto NodeLoadKey = "status_node_load:";
 	constexpr auto NodeKey = "status_node:";
 };
 
@@ -15,6 +14,7 @@ enum class ErrorCodes
 	UID_INVALID = 1003,
 	TOKEN_INVALID = 1004,
 	REPEATED_LOGIN = 1005,
+	NODE_NOT_FOUND = 1006, // heartbeat from a node that isn't registered
 };
 
 
@@ -1,4 +1,8 @@
 -- Atomic assignment lua script for StatusServer
+-- Touches only its one key, so it runs on the Redis node owning the user;
+-- node load counters live elsewhere and are updated by the caller.
+-- KEYS:
+-- 1 status_user:{uid}
 -- ARGV:
 -- 1 uid
 -- 2 new_name
@@ -7,6 +11,8 @@
 -- 5 new_token
 -- 6 expires_at
 -- 7 now
+-- 8 value format, "msgpack" or "json" (see ValueCodec)
+-- 9 route ttl in seconds
 local uid = ARGV[1]
 local new_name = ARGV[2]
 local new_host = ARGV[3]
@@ -14,22 +20,12 @@ local new_port = tonumber(ARGV[4])
 local new_token = ARGV[5]
 local expires_at = tonumber(ARGV[6])
 local now = tonumber(ARGV[7])
+local format = ARGV[8]
+local ttl = tonumber(ARGV[9])
 
-local key_user = "status_user:" .. uid
-local key_new_load = "status_node_load:" .. new_name
+local key_user = KEYS[1]
 
 local prev_raw = redis.call("GET", key_user)
-local prev_tbl = nil
-if prev_raw and prev_raw ~= false and prev_raw ~= "" then
-    prev_tbl = cjson.decode(prev_raw)
-    local prev_name = prev_tbl["server_name"]
-    if prev_name and prev_name ~= "" and prev_name ~= new_name then
-        local key_prev_load = "status_node_load:" .. prev_name
-        redis.call("DECR", key_prev_load)
-    end
-end
-
-redis.call("INCR", key_new_load)
 
 local new_route = {
     assigned = true,
@@ -42,7 +38,13 @@ local new_route = {
     last_update = now
 }
 
-redis.call("SET", key_user, cjson.encode(new_route))
+local encoded
+if format == "json" then
+    encoded = cjson.encode(new_route)
+else
+    encoded = cmsgpack.pack(new_route)
+end
+redis.call("SET", key_user, encoded, "EX", ttl)
 
 if prev_raw and prev_raw ~= false and prev_raw ~= "" then
     return prev_raw
@@ -29,6 +29,7 @@ static const char* StatusService_method_names[] = {
   "/status.StatusService/ReportOnline",
   "/status.StatusService/ReportOffline",
   "/status.StatusService/QueryUserRoute",
+  "/status.StatusService/VerifyToken",
   "/status.StatusService/KickUser",
   "/status.StatusService/GetNodes",
 };
@@ -47,8 +48,9 @@ StatusService::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& chan
   , rpcmethod_ReportOnline_(StatusService_method_names[4], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_ReportOffline_(StatusService_method_names[5], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_QueryUserRoute_(StatusService_method_names[6], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_KickUser_(StatusService_method_names[7], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_GetNodes_(StatusService_method_names[8], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_VerifyToken_(StatusService_method_names[7], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_KickUser_(StatusService_method_names[8], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_GetNodes_(StatusService_method_names[9], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   {}
 
 ::grpc::Status StatusService::Stub::RegisterNode(::grpc::ClientContext* context, const ::status::RegisterNodeReq& request, ::status::RegisterNodeResp* response) {
@@ -212,6 +214,29 @@ void StatusService::Stub::async::QueryUserRoute(::grpc::ClientContext* context,
   return result;
 }
 
+::grpc::Status StatusService::Stub::VerifyToken(::grpc::ClientContext* context, const ::status::VerifyTokenReq& request, ::status::VerifyTokenResp* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::status::VerifyTokenReq, ::status::VerifyTokenResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_VerifyToken_, context, request, response);
+}
+
+void StatusService::Stub::async::VerifyToken(::grpc::ClientContext* context, const ::status::VerifyTokenReq* request, ::status::VerifyTokenResp* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::status::VerifyTokenReq, ::status::VerifyTokenResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_VerifyToken_, context, request, response, std::move(f));
+}
+
+void StatusService::Stub::async::VerifyToken(::grpc::ClientContext* context, const ::status::VerifyTokenReq* request, ::status::VerifyTokenResp* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_VerifyToken_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::status::VerifyTokenResp>* StatusService::Stub::PrepareAsyncVerifyTokenRaw(::grpc::ClientContext* context, const ::status::VerifyTokenReq& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::status::VerifyTokenResp, ::status::VerifyTokenReq, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_VerifyToken_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::status::VerifyTokenResp>* StatusService::Stub::AsyncVerifyTokenRaw(::grpc::ClientContext* context, const ::status::VerifyTokenReq& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncVerifyTokenRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
 ::grpc::Status StatusService::Stub::KickUser(::grpc::ClientContext* context, const ::status::KickUserReq& request, ::status::KickUserResp* response) {
   return ::grpc::internal::BlockingUnaryCall< ::status::KickUserReq, ::status::KickUserResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_KickUser_, context, request, response);
 }
@@ -332,6 +357,16 @@ StatusService::Service::Service() {
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       StatusService_method_names[7],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< StatusService::Service, ::status::VerifyTokenReq, ::status::VerifyTokenResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](StatusService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::status::VerifyTokenReq* req,
+             ::status::VerifyTokenResp* resp) {
+               return service->VerifyToken(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      StatusService_method_names[8],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< StatusService::Service, ::status::KickUserReq, ::status::KickUserResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](StatusService::Service* service,
              ::grpc::ServerContext* ctx,
@@ -340,7 +375,7 @@ StatusService::Service::Service() {
                return service->KickUser(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      StatusService_method_names[8],
+      StatusService_method_names[9],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< StatusService::Service, ::status::GetNodesReq, ::status::GetNodesResp, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](StatusService::Service* service,
@@ -403,6 +438,13 @@ StatusService::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status StatusService::Service::VerifyToken(::grpc::ServerContext* context, const ::status::VerifyTokenReq* request, ::status::VerifyTokenResp* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 ::grpc::Status StatusService::Service::KickUser(::grpc::ServerContext* context, const ::status::KickUserReq* request, ::status::KickUserResp* response) {
   (void) context;
   (void) request;
@@ -111,6 +111,12 @@ extern RouteReqDefaultTypeInternal _RouteReq_default_instance_;
 class RouteResp;
 struct RouteRespDefaultTypeInternal;
 extern RouteRespDefaultTypeInternal _RouteResp_default_instance_;
+class VerifyTokenReq;
+struct VerifyTokenReqDefaultTypeInternal;
+extern VerifyTokenReqDefaultTypeInternal _VerifyTokenReq_default_instance_;
+class VerifyTokenResp;
+struct VerifyTokenRespDefaultTypeInternal;
+extern VerifyTokenRespDefaultTypeInternal _VerifyTokenResp_default_instance_;
 }  // namespace status
 namespace google {
 namespace protobuf {
@@ -124,6 +130,452 @@ namespace status {
 
 // -------------------------------------------------------------------
 
+class VerifyTokenResp final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:status.VerifyTokenResp) */ {
+ public:
+  inline VerifyTokenResp() : VerifyTokenResp(nullptr) {}
+  ~VerifyTokenResp() PROTOBUF_FINAL;
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+  void operator delete(VerifyTokenResp* msg, std::destroying_delete_t) {
+    SharedDtor(*msg);
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(VerifyTokenResp));
+  }
+#endif
+
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR VerifyTokenResp(
+      ::google::protobuf::internal::ConstantInitialized);
+
+  inline VerifyTokenResp(const VerifyTokenResp& from) : VerifyTokenResp(nullptr, from) {}
+  inline VerifyTokenResp(VerifyTokenResp&& from) noexcept
+      : VerifyTokenResp(nullptr, std::move(from)) {}
+  inline VerifyTokenResp& operator=(const VerifyTokenResp& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline VerifyTokenResp& operator=(VerifyTokenResp&& from) noexcept {
+    if (this == &from) return *this;
+    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const VerifyTokenResp& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const VerifyTokenResp* internal_default_instance() {
+    return reinterpret_cast<const VerifyTokenResp*>(
+        &_VerifyTokenResp_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages = 15;
+  friend void swap(VerifyTokenResp& a, VerifyTokenResp& b) { a.Swap(&b); }
+  inline void Swap(VerifyTokenResp* other) {
+    if (other == this) return;
+    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(VerifyTokenResp* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  VerifyTokenResp* New(::google::protobuf::Arena* arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<VerifyTokenResp>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const VerifyTokenResp& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom(const VerifyTokenResp& from) { VerifyTokenResp::MergeImpl(*this, from); }
+
+  private:
+  static void MergeImpl(
+      ::google::protobuf::MessageLite& to_msg,
+      const ::google::protobuf::MessageLite& from_msg);
+
+  public:
+  bool IsInitialized() const {
+    return true;
+  }
+  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
+  #if defined(PROTOBUF_CUSTOM_VTABLE)
+  private:
+  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
+  static ::uint8_t* _InternalSerialize(
+      const MessageLite& msg, ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream);
+
+  public:
+  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+    return _InternalSerialize(*this, target, stream);
+  }
+  #else   // PROTOBUF_CUSTOM_VTABLE
+  ::size_t ByteSizeLong() const final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  #endif  // PROTOBUF_CUSTOM_VTABLE
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::google::protobuf::Arena* arena);
+  static void SharedDtor(MessageLite& self);
+  void InternalSwap(VerifyTokenResp* other);
+ private:
+  template <typename T>
+  friend ::absl::string_view(
+      ::google::protobuf::internal::GetAnyMessageName)();
+  static ::absl::string_view FullMessageName() { return "status.VerifyTokenResp"; }
+
+ protected:
+  explicit VerifyTokenResp(::google::protobuf::Arena* arena);
+  VerifyTokenResp(::google::protobuf::Arena* arena, const VerifyTokenResp& from);
+  VerifyTokenResp(::google::protobuf::Arena* arena, VerifyTokenResp&& from) noexcept
+      : VerifyTokenResp(arena) {
+    *this = ::std::move(from);
+  }
+  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
+  static void* PlacementNew_(const void*, void* mem,
+                             ::google::protobuf::Arena* arena);
+  static constexpr auto InternalNewImpl_();
+  static const ::google::protobuf::internal::ClassDataFull _class_data_;
+
+ public:
+  ::google::protobuf::Metadata GetMetadata() const;
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+  enum : int {
+    kErrorFieldNumber = 1,
+    kValidFieldNumber = 2,
+    kExpiresAtFieldNumber = 3,
+  };
+  // int32 error = 1;
+  void clear_error() ;
+  ::int32_t error() const;
+  void set_error(::int32_t value);
+
+  private:
+  ::int32_t _internal_error() const;
+  void _internal_set_error(::int32_t value);
+
+  public:
+  // bool valid = 2;
+  void clear_valid() ;
+  bool valid() const;
+  void set_valid(bool value);
+
+  private:
+  bool _internal_valid() const;
+  void _internal_set_valid(bool value);
+
+  public:
+  // int64 expires_at = 3;
+  void clear_expires_at() ;
+  ::int64_t expires_at() const;
+  void set_expires_at(::int64_t value);
+
+  private:
+  ::int64_t _internal_expires_at() const;
+  void _internal_set_expires_at(::int64_t value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:status.VerifyTokenResp)
+ private:
+  class _Internal;
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      2, 3, 0,
+      0, 2>
+      _table_;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+    inline explicit constexpr Impl_(
+        ::google::protobuf::internal::ConstantInitialized) noexcept;
+    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                          ::google::protobuf::Arena* arena);
+    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                          ::google::protobuf::Arena* arena, const Impl_& from,
+                          const VerifyTokenResp& from_msg);
+    ::int32_t error_;
+    bool valid_;
+    ::int64_t expires_at_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_status_2eproto;
+};
+// -------------------------------------------------------------------
+
+class VerifyTokenReq final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:status.VerifyTokenReq) */ {
+ public:
+  inline VerifyTokenReq() : VerifyTokenReq(nullptr) {}
+  ~VerifyTokenReq() PROTOBUF_FINAL;
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+  void operator delete(VerifyTokenReq* msg, std::destroying_delete_t) {
+    SharedDtor(*msg);
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(VerifyTokenReq));
+  }
+#endif
+
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR VerifyTokenReq(
+      ::google::protobuf::internal::ConstantInitialized);
+
+  inline VerifyTokenReq(const VerifyTokenReq& from) : VerifyTokenReq(nullptr, from) {}
+  inline VerifyTokenReq(VerifyTokenReq&& from) noexcept
+      : VerifyTokenReq(nullptr, std::move(from)) {}
+  inline VerifyTokenReq& operator=(const VerifyTokenReq& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline VerifyTokenReq& operator=(VerifyTokenReq&& from) noexcept {
+    if (this == &from) return *this;
+    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const VerifyTokenReq& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const VerifyTokenReq* internal_default_instance() {
+    return reinterpret_cast<const VerifyTokenReq*>(
+        &_VerifyTokenReq_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages = 14;
+  friend void swap(VerifyTokenReq& a, VerifyTokenReq& b) { a.Swap(&b); }
+  inline void Swap(VerifyTokenReq* other) {
+    if (other == this) return;
+    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(VerifyTokenReq* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  VerifyTokenReq* New(::google::protobuf::Arena* arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<VerifyTokenReq>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const VerifyTokenReq& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom(const VerifyTokenReq& from) { VerifyTokenReq::MergeImpl(*this, from); }
+
+  private:
+  static void MergeImpl(
+      ::google::protobuf::MessageLite& to_msg,
+      const ::google::protobuf::MessageLite& from_msg);
+
+  public:
+  bool IsInitialized() const {
+    return true;
+  }
+  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
+  #if defined(PROTOBUF_CUSTOM_VTABLE)
+  private:
+  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
+  static ::uint8_t* _InternalSerialize(
+      const MessageLite& msg, ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream);
+
+  public:
+  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+    return _InternalSerialize(*this, target, stream);
+  }
+  #else   // PROTOBUF_CUSTOM_VTABLE
+  ::size_t ByteSizeLong() const final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  #endif  // PROTOBUF_CUSTOM_VTABLE
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::google::protobuf::Arena* arena);
+  static void SharedDtor(MessageLite& self);
+  void InternalSwap(VerifyTokenReq* other);
+ private:
+  template <typename T>
+  friend ::absl::string_view(
+      ::google::protobuf::internal::GetAnyMessageName)();
+  static ::absl::string_view FullMessageName() { return "status.VerifyTokenReq"; }
+
+ protected:
+  explicit VerifyTokenReq(::google::protobuf::Arena* arena);
+  VerifyTokenReq(::google::protobuf::Arena* arena, const VerifyTokenReq& from);
+  VerifyTokenReq(::google::protobuf::Arena* arena, VerifyTokenReq&& from) noexcept
+      : VerifyTokenReq(arena) {
+    *this = ::std::move(from);
+  }
+  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
+  static void* PlacementNew_(const void*, void* mem,
+                             ::google::protobuf::Arena* arena);
+  static constexpr auto InternalNewImpl_();
+  static const ::google::protobuf::internal::ClassDataFull _class_data_;
+
+ public:
+  ::google::protobuf::Metadata GetMetadata() const;
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+  enum : int {
+    kUidFieldNumber = 1,
+    kTokenFieldNumber = 2,
+    kServerNameFieldNumber = 3,
+  };
+  // string uid = 1;
+  void clear_uid() ;
+  const std::string& uid() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_uid(Arg_&& arg, Args_... args);
+  std::string* mutable_uid();
+  PROTOBUF_NODISCARD std::string* release_uid();
+  void set_allocated_uid(std::string* value);
+
+  private:
+  const std::string& _internal_uid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uid(
+      const std::string& value);
+  std::string* _internal_mutable_uid();
+
+  public:
+  // string token = 2;
+  void clear_token() ;
+  const std::string& token() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_token(Arg_&& arg, Args_... args);
+  std::string* mutable_token();
+  PROTOBUF_NODISCARD std::string* release_token();
+  void set_allocated_token(std::string* value);
+
+  private:
+  const std::string& _internal_token() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_token(
+      const std::string& value);
+  std::string* _internal_mutable_token();
+
+  public:
+  // string server_name = 3;
+  void clear_server_name() ;
+  const std::string& server_name() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_server_name(Arg_&& arg, Args_... args);
+  std::string* mutable_server_name();
+  PROTOBUF_NODISCARD std::string* release_server_name();
+  void set_allocated_server_name(std::string* value);
+
+  private:
+  const std::string& _internal_server_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_server_name(
+      const std::string& value);
+  std::string* _internal_mutable_server_name();
+
+  public:
+  // @@protoc_insertion_point(class_scope:status.VerifyTokenReq)
+ private:
+  class _Internal;
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      2, 3, 0,
+      49, 2>
+      _table_;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+    inline explicit constexpr Impl_(
+        ::google::protobuf::internal::ConstantInitialized) noexcept;
+    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                          ::google::protobuf::Arena* arena);
+    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                          ::google::protobuf::Arena* arena, const Impl_& from,
+                          const VerifyTokenReq& from_msg);
+    ::google::protobuf::internal::ArenaStringPtr uid_;
+    ::google::protobuf::internal::ArenaStringPtr token_;
+    ::google::protobuf::internal::ArenaStringPtr server_name_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_status_2eproto;
+};
+// -------------------------------------------------------------------
+
 class RouteResp final : public ::google::protobuf::Message
 /* @@protoc_insertion_point(class_definition:status.RouteResp) */ {
  public:
@@ -940,6 +1392,7 @@ class RegisterNodeReq final : public ::google::protobuf::Message
     kServerHostFieldNumber = 2,
     kServerPortFieldNumber = 3,
     kCapacityFieldNumber = 4,
+    kRpcPortFieldNumber = 5,
   };
   // string name = 1;
   void clear_name() ;
@@ -992,13 +1445,23 @@ class RegisterNodeReq final : public ::google::protobuf::Message
   ::int32_t _internal_capacity() const;
   void _internal_set_capacity(::int32_t value);
 
+  public:
+  // int32 rpc_port = 5;
+  void clear_rpc_port() ;
+  ::int32_t rpc_port() const;
+  void set_rpc_port(::int32_t value);
+
+  private:
+  ::int32_t _internal_rpc_port() const;
+  void _internal_set_rpc_port(::int32_t value);
+
   public:
   // @@protoc_insertion_point(class_scope:status.RegisterNodeReq)
  private:
   class _Internal;
   friend class ::google::protobuf::internal::TcParser;
   static const ::google::protobuf::internal::TcParseTable<
-      2, 4, 0,
+      3, 5, 0,
       46, 2>
       _table_;
 
@@ -1020,6 +1483,7 @@ class RegisterNodeReq final : public ::google::protobuf::Message
     ::google::protobuf::internal::ArenaStringPtr server_host_;
     ::int32_t server_port_;
     ::int32_t capacity_;
+    ::int32_t rpc_port_;
     ::google::protobuf::internal::CachedSize _cached_size_;
     PROTOBUF_TSAN_DECLARE_MEMBER
   };
@@ -1368,6 +1832,7 @@ class OnlineReportReq final : public ::google::protobuf::Message
     kServerNameFieldNumber = 2,
     kServerHostFieldNumber = 3,
     kTokenFieldNumber = 5,
+    kGenerationFieldNumber = 6,
     kServerPortFieldNumber = 4,
   };
   // string uid = 1;
@@ -1433,6 +1898,16 @@ class OnlineReportReq final : public ::google::protobuf::Message
       const std::string& value);
   std::string* _internal_mutable_token();
 
+  public:
+  // int64 generation = 6;
+  void clear_generation() ;
+  ::int64_t generation() const;
+  void set_generation(::int64_t value);
+
+  private:
+  ::int64_t _internal_generation() const;
+  void _internal_set_generation(::int64_t value);
+
   public:
   // int32 server_port = 4;
   void clear_server_port() ;
@@ -1449,7 +1924,7 @@ class OnlineReportReq final : public ::google::protobuf::Message
   class _Internal;
   friend class ::google::protobuf::internal::TcParser;
   static const ::google::protobuf::internal::TcParseTable<
-      3, 5, 0,
+      3, 6, 0,
       61, 2>
       _table_;
 
@@ -1471,6 +1946,7 @@ class OnlineReportReq final : public ::google::protobuf::Message
     ::google::protobuf::internal::ArenaStringPtr server_name_;
     ::google::protobuf::internal::ArenaStringPtr server_host_;
     ::google::protobuf::internal::ArenaStringPtr token_;
+    ::int64_t generation_;
     ::int32_t server_port_;
     ::google::protobuf::internal::CachedSize _cached_size_;
     PROTOBUF_TSAN_DECLARE_MEMBER
@@ -1817,6 +2293,7 @@ class OfflineReportReq final : public ::google::protobuf::Message
   // accessors -------------------------------------------------------
   enum : int {
     kUidFieldNumber = 1,
+    kServerNameFieldNumber = 2,
   };
   // string uid = 1;
   void clear_uid() ;
@@ -1833,14 +2310,30 @@ class OfflineReportReq final : public ::google::protobuf::Message
       const std::string& value);
   std::string* _internal_mutable_uid();
 
+  public:
+  // string server_name = 2;
+  void clear_server_name() ;
+  const std::string& server_name() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_server_name(Arg_&& arg, Args_... args);
+  std::string* mutable_server_name();
+  PROTOBUF_NODISCARD std::string* release_server_name();
+  void set_allocated_server_name(std::string* value);
+
+  private:
+  const std::string& _internal_server_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_server_name(
+      const std::string& value);
+  std::string* _internal_mutable_server_name();
+
   public:
   // @@protoc_insertion_point(class_scope:status.OfflineReportReq)
  private:
   class _Internal;
   friend class ::google::protobuf::internal::TcParser;
   static const ::google::protobuf::internal::TcParseTable<
-      0, 1, 0,
-      35, 2>
+      1, 2, 0,
+      46, 2>
       _table_;
 
   friend class ::google::protobuf::MessageLite;
@@ -1858,6 +2351,7 @@ class OfflineReportReq final : public ::google::protobuf::Message
                           ::google::protobuf::Arena* arena, const Impl_& from,
                           const OfflineReportReq& from_msg);
     ::google::protobuf::internal::ArenaStringPtr uid_;
+    ::google::protobuf::internal::ArenaStringPtr server_name_;
     ::google::protobuf::internal::CachedSize _cached_size_;
     PROTOBUF_TSAN_DECLARE_MEMBER
   };
@@ -1925,7 +2419,7 @@ class NodeInfo final : public ::google::protobuf::Message
     return reinterpret_cast<const NodeInfo*>(
         &_NodeInfo_default_instance_);
   }
-  static constexpr int kIndexInFileMessages = 17;
+  static constexpr int kIndexInFileMessages = 19;
   friend void swap(NodeInfo& a, NodeInfo& b) { a.Swap(&b); }
   inline void Swap(NodeInfo* other) {
     if (other == this) return;
@@ -2018,6 +2512,11 @@ class NodeInfo final : public ::google::protobuf::Message
     kCurrentLoadFieldNumber = 4,
     kLastHeartbeatFieldNumber = 6,
     kCapacityFieldNumber = 5,
+    kRpcPortFieldNumber = 7,
+    kMeasuredFieldNumber = 8,
+    kSessionsFieldNumber = 9,
+    kQueueDepthFieldNumber = 10,
+    kCpuFieldNumber = 11,
   };
   // string name = 1;
   void clear_name() ;
@@ -2090,14 +2589,64 @@ class NodeInfo final : public ::google::protobuf::Message
   ::int32_t _internal_capacity() const;
   void _internal_set_capacity(::int32_t value);
 
+  public:
+  // int32 rpc_port = 7;
+  void clear_rpc_port() ;
+  ::int32_t rpc_port() const;
+  void set_rpc_port(::int32_t value);
+
+  private:
+  ::int32_t _internal_rpc_port() const;
+  void _internal_set_rpc_port(::int32_t value);
+
+  public:
+  // bool measured = 8;
+  void clear_measured() ;
+  bool measured() const;
+  void set_measured(bool value);
+
+  private:
+  bool _internal_measured() const;
+  void _internal_set_measured(bool value);
+
+  public:
+  // int32 sessions = 9;
+  void clear_sessions() ;
+  ::int32_t sessions() const;
+  void set_sessions(::int32_t value);
+
+  private:
+  ::int32_t _internal_sessions() const;
+  void _internal_set_sessions(::int32_t value);
+
+  public:
+  // int32 queue_depth = 10;
+  void clear_queue_depth() ;
+  ::int32_t queue_depth() const;
+  void set_queue_depth(::int32_t value);
+
+  private:
+  ::int32_t _internal_queue_depth() const;
+  void _internal_set_queue_depth(::int32_t value);
+
+  public:
+  // int32 cpu = 11;
+  void clear_cpu() ;
+  ::int32_t cpu() const;
+  void set_cpu(::int32_t value);
+
+  private:
+  ::int32_t _internal_cpu() const;
+  void _internal_set_cpu(::int32_t value);
+
   public:
   // @@protoc_insertion_point(class_scope:status.NodeInfo)
  private:
   class _Internal;
   friend class ::google::protobuf::internal::TcParser;
   static const ::google::protobuf::internal::TcParseTable<
-      3, 6, 0,
-      39, 2>
+      4, 11, 0,
+      47, 2>
       _table_;
 
   friend class ::google::protobuf::MessageLite;
@@ -2120,6 +2669,11 @@ class NodeInfo final : public ::google::protobuf::Message
     ::int32_t current_load_;
     ::int64_t last_heartbeat_;
     ::int32_t capacity_;
+    ::int32_t rpc_port_;
+    bool measured_;
+    ::int32_t sessions_;
+    ::int32_t queue_depth_;
+    ::int32_t cpu_;
     ::google::protobuf::internal::CachedSize _cached_size_;
     PROTOBUF_TSAN_DECLARE_MEMBER
   };
@@ -2187,7 +2741,7 @@ class KickUserResp final : public ::google::protobuf::Message
     return reinterpret_cast<const KickUserResp*>(
         &_KickUserResp_default_instance_);
   }
-  static constexpr int kIndexInFileMessages = 15;
+  static constexpr int kIndexInFileMessages = 17;
   friend void swap(KickUserResp& a, KickUserResp& b) { a.Swap(&b); }
   inline void Swap(KickUserResp* other) {
     if (other == this) return;
@@ -2377,7 +2931,7 @@ class KickUserReq final : public ::google::protobuf::Message
     return reinterpret_cast<const KickUserReq*>(
         &_KickUserReq_default_instance_);
   }
-  static constexpr int kIndexInFileMessages = 14;
+  static constexpr int kIndexInFileMessages = 16;
   friend void swap(KickUserReq& a, KickUserReq& b) { a.Swap(&b); }
   inline void Swap(KickUserReq* other) {
     if (other == this) return;
@@ -2865,6 +3419,10 @@ class HeartbeatReq final : public ::google::protobuf::Message
     kNameFieldNumber = 1,
     kServerHostFieldNumber = 2,
     kServerPortFieldNumber = 3,
+    kMeasuredFieldNumber = 4,
+    kSessionsFieldNumber = 5,
+    kQueueDepthFieldNumber = 6,
+    kCpuFieldNumber = 7,
   };
   // string name = 1;
   void clear_name() ;
@@ -2907,13 +3465,53 @@ class HeartbeatReq final : public ::google::protobuf::Message
   ::int32_t _internal_server_port() const;
   void _internal_set_server_port(::int32_t value);
 
+  public:
+  // bool measured = 4;
+  void clear_measured() ;
+  bool measured() const;
+  void set_measured(bool value);
+
+  private:
+  bool _internal_measured() const;
+  void _internal_set_measured(bool value);
+
+  public:
+  // int32 sessions = 5;
+  void clear_sessions() ;
+  ::int32_t sessions() const;
+  void set_sessions(::int32_t value);
+
+  private:
+  ::int32_t _internal_sessions() const;
+  void _internal_set_sessions(::int32_t value);
+
+  public:
+  // int32 queue_depth = 6;
+  void clear_queue_depth() ;
+  ::int32_t queue_depth() const;
+  void set_queue_depth(::int32_t value);
+
+  private:
+  ::int32_t _internal_queue_depth() const;
+  void _internal_set_queue_depth(::int32_t value);
+
+  public:
+  // int32 cpu = 7;
+  void clear_cpu() ;
+  ::int32_t cpu() const;
+  void set_cpu(::int32_t value);
+
+  private:
+  ::int32_t _internal_cpu() const;
+  void _internal_set_cpu(::int32_t value);
+
   public:
   // @@protoc_insertion_point(class_scope:status.HeartbeatReq)
  private:
   class _Internal;
   friend class ::google::protobuf::internal::TcParser;
   static const ::google::protobuf::internal::TcParseTable<
-      2, 3, 0,
+      3, 7, 0,
       43, 2>
       _table_;
 
@@ -2934,6 +3532,10 @@ class HeartbeatReq final : public ::google::protobuf::Message
     ::google::protobuf::internal::ArenaStringPtr name_;
     ::google::protobuf::internal::ArenaStringPtr server_host_;
     ::int32_t server_port_;
+    bool measured_;
+    ::int32_t sessions_;
+    ::int32_t queue_depth_;
+    ::int32_t cpu_;
     ::google::protobuf::internal::CachedSize _cached_size_;
     PROTOBUF_TSAN_DECLARE_MEMBER
   };
@@ -3000,7 +3602,7 @@ class GetNodesReq final : public ::google::protobuf::internal::ZeroFieldsBase
     return reinterpret_cast<const GetNodesReq*>(
         &_GetNodesReq_default_instance_);
   }
-  static constexpr int kIndexInFileMessages = 16;
+  static constexpr int kIndexInFileMessages = 18;
   friend void swap(GetNodesReq& a, GetNodesReq& b) { a.Swap(&b); }
   inline void Swap(GetNodesReq* other) {
     if (other == this) return;
@@ -4008,7 +4610,7 @@ class GetNodesResp final : public ::google::protobuf::Message
     return reinterpret_cast<const GetNodesResp*>(
         &_GetNodesResp_default_instance_);
   }
-  static constexpr int kIndexInFileMessages = 18;
+  static constexpr int kIndexInFileMessages = 20;
   friend void swap(GetNodesResp& a, GetNodesResp& b) { a.Swap(&b); }
   inline void Swap(GetNodesResp* other) {
     if (other == this) return;
@@ -4313,6 +4915,28 @@ inline void RegisterNodeReq::_internal_set_capacity(::int32_t value) {
   _impl_.capacity_ = value;
 }
 
+// int32 rpc_port = 5;
+inline void RegisterNodeReq::clear_rpc_port() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.rpc_port_ = 0;
+}
+inline ::int32_t RegisterNodeReq::rpc_port() const {
+  // @@protoc_insertion_point(field_get:status.RegisterNodeReq.rpc_port)
+  return _internal_rpc_port();
+}
+inline void RegisterNodeReq::set_rpc_port(::int32_t value) {
+  _internal_set_rpc_port(value);
+  // @@protoc_insertion_point(field_set:status.RegisterNodeReq.rpc_port)
+}
+inline ::int32_t RegisterNodeReq::_internal_rpc_port() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.rpc_port_;
+}
+inline void RegisterNodeReq::_internal_set_rpc_port(::int32_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.rpc_port_ = value;
+}
+
 // -------------------------------------------------------------------
 
 // RegisterNodeResp
@@ -4508,35 +5132,123 @@ inline std::string* HeartbeatReq::release_server_host() {
   // @@protoc_insertion_point(field_release:status.HeartbeatReq.server_host)
   return _impl_.server_host_.Release();
 }
-inline void HeartbeatReq::set_allocated_server_host(std::string* value) {
+inline void HeartbeatReq::set_allocated_server_host(std::string* value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.server_host_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.server_host_.IsDefault()) {
+    _impl_.server_host_.Set("", GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:status.HeartbeatReq.server_host)
+}
+
+// int32 server_port = 3;
+inline void HeartbeatReq::clear_server_port() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.server_port_ = 0;
+}
+inline ::int32_t HeartbeatReq::server_port() const {
+  // @@protoc_insertion_point(field_get:status.HeartbeatReq.server_port)
+  return _internal_server_port();
+}
+inline void HeartbeatReq::set_server_port(::int32_t value) {
+  _internal_set_server_port(value);
+  // @@protoc_insertion_point(field_set:status.HeartbeatReq.server_port)
+}
+inline ::int32_t HeartbeatReq::_internal_server_port() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.server_port_;
+}
+inline void HeartbeatReq::_internal_set_server_port(::int32_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.server_port_ = value;
+}
+
+// bool measured = 4;
+inline void HeartbeatReq::clear_measured() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.measured_ = false;
+}
+inline bool HeartbeatReq::measured() const {
+  // @@protoc_insertion_point(field_get:status.HeartbeatReq.measured)
+  return _internal_measured();
+}
+inline void HeartbeatReq::set_measured(bool value) {
+  _internal_set_measured(value);
+  // @@protoc_insertion_point(field_set:status.HeartbeatReq.measured)
+}
+inline bool HeartbeatReq::_internal_measured() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.measured_;
+}
+inline void HeartbeatReq::_internal_set_measured(bool value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.measured_ = value;
+}
+
+// int32 sessions = 5;
+inline void HeartbeatReq::clear_sessions() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.sessions_ = 0;
+}
+inline ::int32_t HeartbeatReq::sessions() const {
+  // @@protoc_insertion_point(field_get:status.HeartbeatReq.sessions)
+  return _internal_sessions();
+}
+inline void HeartbeatReq::set_sessions(::int32_t value) {
+  _internal_set_sessions(value);
+  // @@protoc_insertion_point(field_set:status.HeartbeatReq.sessions)
+}
+inline ::int32_t HeartbeatReq::_internal_sessions() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.sessions_;
+}
+inline void HeartbeatReq::_internal_set_sessions(::int32_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.sessions_ = value;
+}
+
+// int32 queue_depth = 6;
+inline void HeartbeatReq::clear_queue_depth() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.queue_depth_ = 0;
+}
+inline ::int32_t HeartbeatReq::queue_depth() const {
+  // @@protoc_insertion_point(field_get:status.HeartbeatReq.queue_depth)
+  return _internal_queue_depth();
+}
+inline void HeartbeatReq::set_queue_depth(::int32_t value) {
+  _internal_set_queue_depth(value);
+  // @@protoc_insertion_point(field_set:status.HeartbeatReq.queue_depth)
+}
+inline ::int32_t HeartbeatReq::_internal_queue_depth() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.queue_depth_;
+}
+inline void HeartbeatReq::_internal_set_queue_depth(::int32_t value) {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.server_host_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.server_host_.IsDefault()) {
-    _impl_.server_host_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:status.HeartbeatReq.server_host)
+  _impl_.queue_depth_ = value;
 }
 
-// int32 server_port = 3;
-inline void HeartbeatReq::clear_server_port() {
+// int32 cpu = 7;
+inline void HeartbeatReq::clear_cpu() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.server_port_ = 0;
+  _impl_.cpu_ = 0;
 }
-inline ::int32_t HeartbeatReq::server_port() const {
-  // @@protoc_insertion_point(field_get:status.HeartbeatReq.server_port)
-  return _internal_server_port();
+inline ::int32_t HeartbeatReq::cpu() const {
+  // @@protoc_insertion_point(field_get:status.HeartbeatReq.cpu)
+  return _internal_cpu();
 }
-inline void HeartbeatReq::set_server_port(::int32_t value) {
-  _internal_set_server_port(value);
-  // @@protoc_insertion_point(field_set:status.HeartbeatReq.server_port)
+inline void HeartbeatReq::set_cpu(::int32_t value) {
+  _internal_set_cpu(value);
+  // @@protoc_insertion_point(field_set:status.HeartbeatReq.cpu)
 }
-inline ::int32_t HeartbeatReq::_internal_server_port() const {
+inline ::int32_t HeartbeatReq::_internal_cpu() const {
   ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.server_port_;
+  return _impl_.cpu_;
 }
-inline void HeartbeatReq::_internal_set_server_port(::int32_t value) {
+inline void HeartbeatReq::_internal_set_cpu(::int32_t value) {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.server_port_ = value;
+  _impl_.cpu_ = value;
 }
 
 // -------------------------------------------------------------------
@@ -5071,6 +5783,28 @@ inline void OnlineReportReq::set_allocated_token(std::string* value) {
   // @@protoc_insertion_point(field_set_allocated:status.OnlineReportReq.token)
 }
 
+// int64 generation = 6;
+inline void OnlineReportReq::clear_generation() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.generation_ = ::int64_t{0};
+}
+inline ::int64_t OnlineReportReq::generation() const {
+  // @@protoc_insertion_point(field_get:status.OnlineReportReq.generation)
+  return _internal_generation();
+}
+inline void OnlineReportReq::set_generation(::int64_t value) {
+  _internal_set_generation(value);
+  // @@protoc_insertion_point(field_set:status.OnlineReportReq.generation)
+}
+inline ::int64_t OnlineReportReq::_internal_generation() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.generation_;
+}
+inline void OnlineReportReq::_internal_set_generation(::int64_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.generation_ = value;
+}
+
 // -------------------------------------------------------------------
 
 // OnlineReportResp
@@ -5149,6 +5883,54 @@ inline void OfflineReportReq::set_allocated_uid(std::string* value) {
   // @@protoc_insertion_point(field_set_allocated:status.OfflineReportReq.uid)
 }
 
+// string server_name = 2;
+inline void OfflineReportReq::clear_server_name() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.server_name_.ClearToEmpty();
+}
+inline const std::string& OfflineReportReq::server_name() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:status.OfflineReportReq.server_name)
+  return _internal_server_name();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void OfflineReportReq::set_server_name(Arg_&& arg,
+                                                     Args_... args) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.server_name_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:status.OfflineReportReq.server_name)
+}
+inline std::string* OfflineReportReq::mutable_server_name() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_server_name();
+  // @@protoc_insertion_point(field_mutable:status.OfflineReportReq.server_name)
+  return _s;
+}
+inline const std::string& OfflineReportReq::_internal_server_name() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.server_name_.Get();
+}
+inline void OfflineReportReq::_internal_set_server_name(const std::string& value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.server_name_.Set(value, GetArena());
+}
+inline std::string* OfflineReportReq::_internal_mutable_server_name() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _impl_.server_name_.Mutable( GetArena());
+}
+inline std::string* OfflineReportReq::release_server_name() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:status.OfflineReportReq.server_name)
+  return _impl_.server_name_.Release();
+}
+inline void OfflineReportReq::set_allocated_server_name(std::string* value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.server_name_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.server_name_.IsDefault()) {
+    _impl_.server_name_.Set("", GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:status.OfflineReportReq.server_name)
+}
+
 // -------------------------------------------------------------------
 
 // OfflineReportResp
@@ -5465,6 +6247,224 @@ inline void RouteResp::_internal_set_last_logout(::int64_t value) {
 
 // -------------------------------------------------------------------
 
+// VerifyTokenReq
+
+// string uid = 1;
+inline void VerifyTokenReq::clear_uid() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.uid_.ClearToEmpty();
+}
+inline const std::string& VerifyTokenReq::uid() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:status.VerifyTokenReq.uid)
+  return _internal_uid();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void VerifyTokenReq::set_uid(Arg_&& arg,
+                                                     Args_... args) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.uid_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:status.VerifyTokenReq.uid)
+}
+inline std::string* VerifyTokenReq::mutable_uid() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_uid();
+  // @@protoc_insertion_point(field_mutable:status.VerifyTokenReq.uid)
+  return _s;
+}
+inline const std::string& VerifyTokenReq::_internal_uid() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.uid_.Get();
+}
+inline void VerifyTokenReq::_internal_set_uid(const std::string& value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.uid_.Set(value, GetArena());
+}
+inline std::string* VerifyTokenReq::_internal_mutable_uid() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _impl_.uid_.Mutable( GetArena());
+}
+inline std::string* VerifyTokenReq::release_uid() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:status.VerifyTokenReq.uid)
+  return _impl_.uid_.Release();
+}
+inline void VerifyTokenReq::set_allocated_uid(std::string* value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.uid_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.uid_.IsDefault()) {
+    _impl_.uid_.Set("", GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:status.VerifyTokenReq.uid)
+}
+
+// string token = 2;
+inline void VerifyTokenReq::clear_token() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.token_.ClearToEmpty();
+}
+inline const std::string& VerifyTokenReq::token() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:status.VerifyTokenReq.token)
+  return _internal_token();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void VerifyTokenReq::set_token(Arg_&& arg,
+                                                     Args_... args) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.token_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:status.VerifyTokenReq.token)
+}
+inline std::string* VerifyTokenReq::mutable_token() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_token();
+  // @@protoc_insertion_point(field_mutable:status.VerifyTokenReq.token)
+  return _s;
+}
+inline const std::string& VerifyTokenReq::_internal_token() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.token_.Get();
+}
+inline void VerifyTokenReq::_internal_set_token(const std::string& value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.token_.Set(value, GetArena());
+}
+inline std::string* VerifyTokenReq::_internal_mutable_token() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _impl_.token_.Mutable( GetArena());
+}
+inline std::string* VerifyTokenReq::release_token() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:status.VerifyTokenReq.token)
+  return _impl_.token_.Release();
+}
+inline void VerifyTokenReq::set_allocated_token(std::string* value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.token_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.token_.IsDefault()) {
+    _impl_.token_.Set("", GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:status.VerifyTokenReq.token)
+}
+
+// string server_name = 3;
+inline void VerifyTokenReq::clear_server_name() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.server_name_.ClearToEmpty();
+}
+inline const std::string& VerifyTokenReq::server_name() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:status.VerifyTokenReq.server_name)
+  return _internal_server_name();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void VerifyTokenReq::set_server_name(Arg_&& arg,
+                                                     Args_... args) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.server_name_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:status.VerifyTokenReq.server_name)
+}
+inline std::string* VerifyTokenReq::mutable_server_name() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_server_name();
+  // @@protoc_insertion_point(field_mutable:status.VerifyTokenReq.server_name)
+  return _s;
+}
+inline const std::string& VerifyTokenReq::_internal_server_name() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.server_name_.Get();
+}
+inline void VerifyTokenReq::_internal_set_server_name(const std::string& value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.server_name_.Set(value, GetArena());
+}
+inline std::string* VerifyTokenReq::_internal_mutable_server_name() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _impl_.server_name_.Mutable( GetArena());
+}
+inline std::string* VerifyTokenReq::release_server_name() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:status.VerifyTokenReq.server_name)
+  return _impl_.server_name_.Release();
+}
+inline void VerifyTokenReq::set_allocated_server_name(std::string* value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.server_name_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.server_name_.IsDefault()) {
+    _impl_.server_name_.Set("", GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:status.VerifyTokenReq.server_name)
+}
+
+// -------------------------------------------------------------------
+
+// VerifyTokenResp
+
+// int32 error = 1;
+inline void VerifyTokenResp::clear_error() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.error_ = 0;
+}
+inline ::int32_t VerifyTokenResp::error() const {
+  // @@protoc_insertion_point(field_get:status.VerifyTokenResp.error)
+  return _internal_error();
+}
+inline void VerifyTokenResp::set_error(::int32_t value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:status.VerifyTokenResp.error)
+}
+inline ::int32_t VerifyTokenResp::_internal_error() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.error_;
+}
+inline void VerifyTokenResp::_internal_set_error(::int32_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.error_ = value;
+}
+
+// bool valid = 2;
+inline void VerifyTokenResp::clear_valid() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.valid_ = false;
+}
+inline bool VerifyTokenResp::valid() const {
+  // @@protoc_insertion_point(field_get:status.VerifyTokenResp.valid)
+  return _internal_valid();
+}
+inline void VerifyTokenResp::set_valid(bool value) {
+  _internal_set_valid(value);
+  // @@protoc_insertion_point(field_set:status.VerifyTokenResp.valid)
+}
+inline bool VerifyTokenResp::_internal_valid() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.valid_;
+}
+inline void VerifyTokenResp::_internal_set_valid(bool value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.valid_ = value;
+}
+
+// int64 expires_at = 3;
+inline void VerifyTokenResp::clear_expires_at() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.expires_at_ = ::int64_t{0};
+}
+inline ::int64_t VerifyTokenResp::expires_at() const {
+  // @@protoc_insertion_point(field_get:status.VerifyTokenResp.expires_at)
+  return _internal_expires_at();
+}
+inline void VerifyTokenResp::set_expires_at(::int64_t value) {
+  _internal_set_expires_at(value);
+  // @@protoc_insertion_point(field_set:status.VerifyTokenResp.expires_at)
+}
+inline ::int64_t VerifyTokenResp::_internal_expires_at() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.expires_at_;
+}
+inline void VerifyTokenResp::_internal_set_expires_at(::int64_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.expires_at_ = value;
+}
+
+// -------------------------------------------------------------------
+
 // KickUserReq
 
 // string uid = 1;
@@ -5755,6 +6755,116 @@ inline void NodeInfo::_internal_set_last_heartbeat(::int64_t value) {
   _impl_.last_heartbeat_ = value;
 }
 
+// int32 rpc_port = 7;
+inline void NodeInfo::clear_rpc_port() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.rpc_port_ = 0;
+}
+inline ::int32_t NodeInfo::rpc_port() const {
+  // @@protoc_insertion_point(field_get:status.NodeInfo.rpc_port)
+  return _internal_rpc_port();
+}
+inline void NodeInfo::set_rpc_port(::int32_t value) {
+  _internal_set_rpc_port(value);
+  // @@protoc_insertion_point(field_set:status.NodeInfo.rpc_port)
+}
+inline ::int32_t NodeInfo::_internal_rpc_port() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.rpc_port_;
+}
+inline void NodeInfo::_internal_set_rpc_port(::int32_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.rpc_port_ = value;
+}
+
+// bool measured = 8;
+inline void NodeInfo::clear_measured() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.measured_ = false;
+}
+inline bool NodeInfo::measured() const {
+  // @@protoc_insertion_point(field_get:status.NodeInfo.measured)
+  return _internal_measured();
+}
+inline void NodeInfo::set_measured(bool value) {
+  _internal_set_measured(value);
+  // @@protoc_insertion_point(field_set:status.NodeInfo.measured)
+}
+inline bool NodeInfo::_internal_measured() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.measured_;
+}
+inline void NodeInfo::_internal_set_measured(bool value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.measured_ = value;
+}
+
+// int32 sessions = 9;
+inline void NodeInfo::clear_sessions() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.sessions_ = 0;
+}
+inline ::int32_t NodeInfo::sessions() const {
+  // @@protoc_insertion_point(field_get:status.NodeInfo.sessions)
+  return _internal_sessions();
+}
+inline void NodeInfo::set_sessions(::int32_t value) {
+  _internal_set_sessions(value);
+  // @@protoc_insertion_point(field_set:status.NodeInfo.sessions)
+}
+inline ::int32_t NodeInfo::_internal_sessions() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.sessions_;
+}
+inline void NodeInfo::_internal_set_sessions(::int32_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.sessions_ = value;
+}
+
+// int32 queue_depth = 10;
+inline void NodeInfo::clear_queue_depth() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.queue_depth_ = 0;
+}
+inline ::int32_t NodeInfo::queue_depth() const {
+  // @@protoc_insertion_point(field_get:status.NodeInfo.queue_depth)
+  return _internal_queue_depth();
+}
+inline void NodeInfo::set_queue_depth(::int32_t value) {
+  _internal_set_queue_depth(value);
+  // @@protoc_insertion_point(field_set:status.NodeInfo.queue_depth)
+}
+inline ::int32_t NodeInfo::_internal_queue_depth() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.queue_depth_;
+}
+inline void NodeInfo::_internal_set_queue_depth(::int32_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.queue_depth_ = value;
+}
+
+// int32 cpu = 11;
+inline void NodeInfo::clear_cpu() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.cpu_ = 0;
+}
+inline ::int32_t NodeInfo::cpu() const {
+  // @@protoc_insertion_point(field_get:status.NodeInfo.cpu)
+  return _internal_cpu();
+}
+inline void NodeInfo::set_cpu(::int32_t value) {
+  _internal_set_cpu(value);
+  // @@protoc_insertion_point(field_set:status.NodeInfo.cpu)
+}
+inline ::int32_t NodeInfo::_internal_cpu() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.cpu_;
+}
+inline void NodeInfo::_internal_set_cpu(::int32_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.cpu_ = value;
+}
+
 // -------------------------------------------------------------------
 
 // GetNodesResp
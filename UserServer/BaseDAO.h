@@ -1,4 +1,6 @@
 #pragma once
+#include <algorithm>
+#include <iterator>
 #include <string>
 #include <vector>
 #include <memory>
@@ -8,6 +10,7 @@ template <typename T>
 class BaseDAO
 {
 public:
+	explicit BaseDAO(MySQLConPool& pool = MySQLConPool::GetInstance()) : _pool(pool) {}
 	virtual ~BaseDAO() = default;
 	
 	virtual bool Insert(const T&) = 0;
@@ -17,10 +20,48 @@ public:
 
 protected:
 	std::unique_ptr<mysqlx::Session> GetConnection() {
-		return MySQLConPool::GetInstance().GetConnection();
+		return _pool.GetConnection();
 	}
 	void ReleaseConnection(std::unique_ptr<mysqlx::Session> conn) {
-		MySQLConPool::GetInstance().ReleaseConnection(std::move(conn));
+		_pool.ReleaseConnection(std::move(conn));
+	}
+	// after a MySQL error, so the pool pings the session before reusing it
+	void MarkSuspect(const std::unique_ptr<mysqlx::Session>& conn) {
+		_pool.MarkSuspect(conn.get());
+	}
+
+	/**
+	 * @brief Read a procedure call without a second round trip
+	 *
+	 * Procedures report their status as their last result set (`SELECT success, ...`);
+	 * any result sets before it carry the procedure's data rows.
+	 *
+	 * @param result of conn->sql("CALL ...").execute()
+	 * @param rows receives the data rows, may be null
+	 * @return mysqlx::Row the status row, null if the procedure selected nothing
+	 */
+	static mysqlx::Row ReadCall(mysqlx::SqlResult& result, std::vector<mysqlx::Row>* rows = nullptr) {
+		std::vector<mysqlx::Row> current;
+		do {
+			if (!result.hasData()) {
+				continue;
+			}
+			if (rows != nullptr) {
+				std::move(current.begin(), current.end(), std::back_inserter(*rows));
+			}
+			current.clear();
+			for (auto row = result.fetchOne(); row; row = result.fetchOne()) {
+				current.push_back(std::move(row));
+			}
+		} while (result.nextResult());
+
+		return current.empty() ? mysqlx::Row() : current.front();
+	}
+
+	static bool IsSuccess(const mysqlx::Row& status) {
+		return status && status[0].get<bool>();
 	}
-};
 
+private:
+	MySQLConPool& _pool;
+};
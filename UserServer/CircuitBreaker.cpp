@@ -0,0 +1,148 @@
+#include "CircuitBreaker.h"
+#include "Logger.h"
+
+#include <algorithm>
+
+CircuitBreaker::CircuitBreaker(const std::string& name, const Options& options) :
+	_name(name), _options(options), _state(State::CLOSED), _rejected(0),
+	_outcomes(options.window, false), _next(0), _count(0), _failures(0),
+	_trialInFlight(false), _trialSuccesses(0)
+{
+	_options.minCalls = std::max<std::size_t>(1, std::min(_options.minCalls, _options.window));
+	_options.trials = std::max<std::size_t>(1, _options.trials);
+}
+
+bool CircuitBreaker::Allow()
+{
+	if (_options.window == 0 || _state.load(std::memory_order_acquire) == State::CLOSED) {
+		return true;
+	}
+
+	std::lock_guard<std::mutex> lock(_mutex);
+	auto now = Clock::now();
+	auto state = _state.load(std::memory_order_relaxed);
+	if (state == State::OPEN) {
+		if (now - _openedAt < _options.openTime) {
+			_rejected.fetch_add(1, std::memory_order_relaxed);
+			return false;
+		}
+		LOG_INFO("Circuit [{}] half-open, probing", _name);
+		_state = State::HALF_OPEN;
+		_trialInFlight = false;
+		_trialSuccesses = 0;
+		state = State::HALF_OPEN;
+	}
+
+	if (state == State::HALF_OPEN) {
+		// a trial that never reported back must not block probing forever
+		if (_trialInFlight && now - _trialStartedAt < _options.openTime) {
+			_rejected.fetch_add(1, std::memory_order_relaxed);
+			return false;
+		}
+		_trialInFlight = true;
+		_trialStartedAt = now;
+	}
+	return true;
+}
+
+void CircuitBreaker::OnSuccess()
+{
+	if (_options.window == 0) {
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(_mutex);
+	switch (_state.load(std::memory_order_relaxed)) {
+	case State::CLOSED:
+		Record(false);
+		break;
+	case State::HALF_OPEN:
+		_trialInFlight = false;
+		if (++_trialSuccesses >= _options.trials) {
+			Close();
+		}
+		break;
+	case State::OPEN:
+		break;
+	}
+}
+
+void CircuitBreaker::OnFailure()
+{
+	if (_options.window == 0) {
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(_mutex);
+	switch (_state.load(std::memory_order_relaxed)) {
+	case State::CLOSED:
+		Record(true);
+		if (_count >= _options.minCalls
+			&& _failures * 100 >= static_cast<std::size_t>(_options.failurePercent) * _count) {
+			LOG_WARN("Circuit [{}] - {} of the last {} calls failed", _name, _failures, _count);
+			Open();
+		}
+		break;
+	case State::HALF_OPEN:
+		LOG_WARN("Circuit [{}] - trial call failed", _name);
+		Open();
+		break;
+	case State::OPEN:
+		break;
+	}
+}
+
+CircuitBreaker::State CircuitBreaker::GetState() const
+{
+	return _state.load(std::memory_order_acquire);
+}
+
+uint64_t CircuitBreaker::Rejected() const
+{
+	return _rejected.load(std::memory_order_relaxed);
+}
+
+const char* CircuitBreaker::StateName(State state)
+{
+	switch (state) {
+	case State::CLOSED:
+		return "closed";
+	case State::OPEN:
+		return "open";
+	case State::HALF_OPEN:
+		return "half-open";
+	}
+	return "unknown";
+}
+
+void CircuitBreaker::Record(bool failed)
+{
+	if (_count == _outcomes.size()) {
+		// the window is full, the oldest outcome drops out
+		_failures -= _outcomes[_next] ? 1 : 0;
+	}
+	else {
+		++_count;
+	}
+	_outcomes[_next] = failed;
+	_failures += failed ? 1 : 0;
+	_next = (_next + 1) % _outcomes.size();
+}
+
+void CircuitBreaker::Open()
+{
+	LOG_WARN("Circuit [{}] open, failing fast for {}ms", _name, _options.openTime.count());
+	_state = State::OPEN;
+	_openedAt = Clock::now();
+	_trialInFlight = false;
+}
+
+void CircuitBreaker::Close()
+{
+	LOG_INFO("Circuit [{}] closed after {} successful trials", _name, _trialSuccesses);
+	_state = State::CLOSED;
+	std::fill(_outcomes.begin(), _outcomes.end(), false);
+	_next = 0;
+	_count = 0;
+	_failures = 0;
+}
@@ -68,6 +68,22 @@ ConfigManager::ConfigManager()
     LOG_INFO("Loading config.ini Success");
 }
 
+int ConfigManager::getIntValue(const std::string& section, const std::string& key, int defaultValue)
+{
+	auto value = (*this)[section][key];
+	if (value.empty()) {
+		return defaultValue;
+	}
+
+	try {
+		return std::stoi(value);
+	}
+	catch (const std::exception&) {
+		LOG_WARN("Invalid integer for [{}] {}: {}, using {}", section, key, value, defaultValue);
+		return defaultValue;
+	}
+}
+
 SectionInfo ConfigManager::operator[](const std::string& section)
 {
 	if (_configMap.find(section) == _configMap.end()) {
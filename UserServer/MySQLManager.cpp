@@ -7,7 +7,7 @@
 bool MySQLManager::RegisterUser(UserInfo& user)
 {
 	LOG_INFO("Processing user registration request - Email: {}", user.email);
-	auto verify = _userDAO.VerifyUser(user.email, user.password, user.uid);
+	auto verify = VerifyOnAnyShard(user.email, user.password, user.uid);
 	if (verify) {
 		LOG_WARN("Registration failed - User already exists - Email: {}", user.email);
 		return false;
@@ -44,7 +44,8 @@ bool MySQLManager::RegisterUser(UserInfo& user)
 	}
 
 	try {
-		_userDAO.Insert(user);
+		UserDAO(ShardMap::GetInstance()->Primary(user.uid)).Insert(user);
+		ShardMap::GetInstance()->Router(user.uid).NoteWrite(user.uid);
 		LOG_INFO("User registration successful - Email: {}, UID: {}", user.email, user.uid);
 		return true;
 	}
@@ -56,10 +57,33 @@ bool MySQLManager::RegisterUser(UserInfo& user)
 
 bool MySQLManager::ResetPassword(UserInfo& user)
 {
-	LOG_INFO("Processing password reset request - UID: {}", user.uid);
+	LOG_INFO("Processing password reset request - Email: {}, UID: {}", user.email, user.uid);
 
 	try {
-		bool result = _userDAO.Update(user);
+		// the uid picks the shard; when an email is given it is the verified one and decides the user
+		if (!user.email.empty()) {
+			std::string uid;
+			if (!FindUidOnAnyShard(user.email, uid) || (!user.uid.empty() && user.uid != uid)) {
+				LOG_WARN("Password reset failed - User not found - Email: {}, UID: {}", user.email, user.uid);
+				return false;
+			}
+			user.uid = uid;
+		}
+		if (user.uid.empty()) {
+			LOG_WARN("Password reset failed - Neither email nor UID given");
+			return false;
+		}
+
+		auto shards = ShardMap::GetInstance();
+		UserDAO dao(shards->Primary(user.uid));
+		// Update writes the whole row, so keep the rest of the stored profile
+		auto stored = dao.Search(user.uid);
+		bool result = false;
+		if (stored != nullptr) {
+			stored->password = user.password;
+			result = dao.Update(*stored);
+		}
+		shards->Router(user.uid).NoteWrite(user.uid);
 		if (result) {
 			LOG_INFO("Password reset successful - UID: {}", user.uid);
 		}
@@ -78,7 +102,7 @@ bool MySQLManager::UserLogin(UserInfo& user)
 {
 	if (!user.email.empty()) {
 		LOG_DEBUG("Attempting login with email: {}", user.email);
-		auto verify = _userDAO.VerifyUser(user.email, user.password, user.uid);
+		auto verify = VerifyOnAnyShard(user.email, user.password, user.uid);
 		if (verify) {
 			LOG_INFO("Login successful - Email: {}", user.email);
 		}
@@ -90,7 +114,7 @@ bool MySQLManager::UserLogin(UserInfo& user)
 
 	if (!user.uid.empty()) {
 		LOG_DEBUG("Attempting login with UID: {}", user.uid);
-		auto sqlUser = _userDAO.Search(user.uid);
+		auto sqlUser = UserDAO(ShardMap::GetInstance()->Primary(user.uid)).Search(user.uid);
 		if (sqlUser == nullptr) {
 			LOG_WARN("Login failed - User not found - UID: {}", user.uid);
 			return false;
@@ -111,7 +135,7 @@ std::unique_ptr<UserInfo> MySQLManager::GetUser(const std::string& uid)
 {
 	LOG_DEBUG("Fetching user info - UID: {}", uid);
 
-	auto user = _userDAO.Search(uid);
+	auto user = UserDAO(ShardMap::GetInstance()->Router(uid).ForRead(uid)).Search(uid);
 	if (user) {
 		LOG_DEBUG("User info found - UID: {}, Email: {}", uid, user->email);
 	}
@@ -121,4 +145,38 @@ std::unique_ptr<UserInfo> MySQLManager::GetUser(const std::string& uid)
 	return user;
 }
 
+bool MySQLManager::LoadAllUsers(const std::function<void(UserInfo&&)>& onUser)
+{
+	// a full scan is exactly the load replicas are for
+	auto shards = ShardMap::GetInstance();
+	for (std::size_t shard = 0; shard < shards->Count(); ++shard) {
+		if (!UserDAO(shards->Router(shard).ForRead()).ListUsers(onUser)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool MySQLManager::VerifyOnAnyShard(const std::string& email, const std::string& password, std::string& uid)
+{
+	auto shards = ShardMap::GetInstance();
+	for (std::size_t shard = 0; shard < shards->Count(); ++shard) {
+		if (UserDAO(shards->Primary(shard)).VerifyUser(email, password, uid)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+bool MySQLManager::FindUidOnAnyShard(const std::string& email, std::string& uid)
+{
+	auto shards = ShardMap::GetInstance();
+	for (std::size_t shard = 0; shard < shards->Count(); ++shard) {
+		if (UserDAO(shards->Primary(shard)).FindUid(email, uid)) {
+			return true;
+		}
+	}
+	return false;
+}
+
 
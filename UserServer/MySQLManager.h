@@ -1,7 +1,9 @@
 #pragma once
 #include "Singleton.h"
 #include "UserDAO.h"
+#include "ShardMap.h"
 
+// Writes and logins use the owning shard's primary; reads go through its ReplicaRouter
 class MySQLManager :public Singleton<MySQLManager>
 {
 	friend class Singleton<MySQLManager>;
@@ -12,10 +14,13 @@ public:
 	bool ResetPassword(UserInfo& user);
 	bool UserLogin(UserInfo& user);
 	std::unique_ptr<UserInfo> GetUser(const std::string& uid);
+	bool LoadAllUsers(const std::function<void(UserInfo&&)>& onUser);
 
 private:
 	MySQLManager() = default;
 
-	UserDAO _userDAO;
+	// the email is not a shard key, so every shard is asked in turn
+	bool VerifyOnAnyShard(const std::string& email, const std::string& password, std::string& uid);
+	bool FindUidOnAnyShard(const std::string& email, std::string& uid);
 };
 
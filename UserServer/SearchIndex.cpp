@@ -0,0 +1,269 @@
+#include "SearchIndex.h"
+#include "MySQLManager.h"
+#include "Logger.h"
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <iterator>
+#include <mutex>
+#include <unordered_set>
+
+namespace {
+	constexpr std::size_t TRIGRAM_LENGTH = 3;
+	constexpr std::size_t COMPACT_MIN_DEAD = 1024;
+	constexpr std::size_t PREFIX_SCAN_FACTOR = 8;
+}
+
+bool SearchIndex::Build()
+{
+	auto start = std::chrono::steady_clock::now();
+
+	std::vector<UserInfo> users;
+	bool ok = MySQLManager::GetInstance()->LoadAllUsers(
+		[&users](UserInfo&& user) {
+			users.emplace_back(std::move(user));
+		}
+	);
+	if (!ok) {
+		LOG_ERROR("Search index build failed, keeping {} indexed users", Size());
+		return false;
+	}
+
+	std::unique_lock<std::shared_mutex> lock(_mutex);
+	_docs.clear();
+	_uidToDoc.clear();
+	_trigrams.clear();
+	_prefixes.clear();
+	_deadCount = 0;
+
+	_docs.reserve(users.size());
+	_prefixes.reserve(users.size() * 3);
+	for (const auto& user : users) {
+		AddLocked(user);
+	}
+	std::sort(_prefixes.begin(), _prefixes.end());
+	for (auto& [gram, postings] : _trigrams) {
+		postings.shrink_to_fit();
+	}
+
+	auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+	LOG_INFO("Search index built: {} users, {} trigrams, {} prefixes in {}ms",
+		_docs.size(), _trigrams.size(), _prefixes.size(), elapsed.count());
+	return true;
+}
+
+void SearchIndex::Upsert(const UserInfo& user)
+{
+	if (user.uid.empty()) {
+		return;
+	}
+
+	std::unique_lock<std::shared_mutex> lock(_mutex);
+	auto iter = _uidToDoc.find(user.uid);
+	if (iter != _uidToDoc.end()) {
+		RemoveLocked(iter->second);
+	}
+
+	auto first = _prefixes.size();
+	AddLocked(user);
+	// keep the prefix table sorted: merge the few entries appended by AddLocked
+	std::sort(_prefixes.begin() + first, _prefixes.end());
+	std::inplace_merge(_prefixes.begin(), _prefixes.begin() + first, _prefixes.end());
+
+	if (_deadCount >= COMPACT_MIN_DEAD && _deadCount * 4 > _docs.size()) {
+		CompactLocked();
+	}
+	LOG_DEBUG("Search index updated for uid {}", user.uid);
+}
+
+std::vector<SearchIndex::Hit> SearchIndex::Search(const std::string& pattern, const std::string& excludeUid, std::size_t limit) const
+{
+	std::vector<Hit> hits;
+	auto needle = Normalize(pattern);
+	if (needle.empty() || limit == 0) {
+		return hits;
+	}
+
+	std::shared_lock<std::shared_mutex> lock(_mutex);
+
+	std::vector<std::pair<int, DocId>> ranked;
+	auto consider = [&](DocId id) {
+		const auto& doc = _docs[id];
+		if (!doc.alive || doc.uid == excludeUid) {
+			return;
+		}
+		int rank = Rank(doc, needle);
+		if (rank >= 0) {
+			ranked.emplace_back(rank, id);
+		}
+	};
+
+	if (needle.size() >= TRIGRAM_LENGTH) {
+		std::vector<const PostingList*> lists;
+		for (std::size_t i = 0; i + TRIGRAM_LENGTH <= needle.size(); ++i) {
+			auto iter = _trigrams.find(Trigram(needle.data() + i));
+			if (iter == _trigrams.end()) {
+				return hits;
+			}
+			lists.push_back(&iter->second);
+		}
+		std::sort(lists.begin(), lists.end(),
+			[](const PostingList* a, const PostingList* b) {
+				return a->size() < b->size();
+			}
+		);
+		lists.erase(std::unique(lists.begin(), lists.end()), lists.end());
+
+		PostingList candidates = *lists.front();
+		PostingList next;
+		for (std::size_t i = 1; i < lists.size() && !candidates.empty(); ++i) {
+			next.clear();
+			std::set_intersection(candidates.begin(), candidates.end(),
+				lists[i]->begin(), lists[i]->end(), std::back_inserter(next));
+			candidates.swap(next);
+		}
+		for (auto id : candidates) {
+			consider(id);
+		}
+	}
+	else {
+		// Short patterns only match prefixes; bound the scan so one-letter queries stay cheap
+		std::size_t budget = std::max<std::size_t>(limit * PREFIX_SCAN_FACTOR, 256);
+		std::unordered_set<DocId> seen;
+		auto iter = std::lower_bound(_prefixes.begin(), _prefixes.end(), std::make_pair(needle, DocId(0)));
+		for (; iter != _prefixes.end() && budget > 0; ++iter, --budget) {
+			if (iter->first.compare(0, needle.size(), needle) != 0) {
+				break;
+			}
+			if (seen.insert(iter->second).second) {
+				consider(iter->second);
+			}
+		}
+	}
+
+	auto count = std::min(limit, ranked.size());
+	std::partial_sort(ranked.begin(), ranked.begin() + count, ranked.end());
+
+	hits.reserve(count);
+	for (std::size_t i = 0; i < count; ++i) {
+		const auto& doc = _docs[ranked[i].second];
+		hits.push_back(Hit{ doc.uid, doc.username, doc.email, doc.avatar });
+	}
+	return hits;
+}
+
+std::size_t SearchIndex::Size() const
+{
+	std::shared_lock<std::shared_mutex> lock(_mutex);
+	return _docs.size() - _deadCount;
+}
+
+void SearchIndex::AddLocked(const UserInfo& user)
+{
+	auto id = static_cast<DocId>(_docs.size());
+	_docs.push_back(Document{ user.uid, user.username, user.email, user.avatar, true });
+	_uidToDoc[user.uid] = id;
+
+	for (const auto& field : { user.uid, user.username, user.email }) {
+		auto key = Normalize(field);
+		if (key.empty()) {
+			continue;
+		}
+
+		_prefixes.emplace_back(key, id);
+		for (std::size_t i = 0; i + TRIGRAM_LENGTH <= key.size(); ++i) {
+			// ids only grow, so appending keeps every posting list sorted
+			auto& postings = _trigrams[Trigram(key.data() + i)];
+			if (postings.empty() || postings.back() != id) {
+				postings.push_back(id);
+			}
+		}
+	}
+}
+
+void SearchIndex::RemoveLocked(DocId id)
+{
+	auto& doc = _docs[id];
+	if (!doc.alive) {
+		return;
+	}
+
+	for (const auto& field : { doc.uid, doc.username, doc.email }) {
+		auto entry = std::make_pair(Normalize(field), id);
+		auto iter = std::lower_bound(_prefixes.begin(), _prefixes.end(), entry);
+		if (iter != _prefixes.end() && *iter == entry) {
+			_prefixes.erase(iter);
+		}
+	}
+
+	// posting lists keep the id; Search skips dead documents until the next compaction
+	doc.alive = false;
+	_uidToDoc.erase(doc.uid);
+	++_deadCount;
+}
+
+void SearchIndex::CompactLocked()
+{
+	std::vector<UserInfo> users;
+	users.reserve(_docs.size() - _deadCount);
+	for (const auto& doc : _docs) {
+		if (doc.alive) {
+			users.emplace_back(doc.uid, doc.email, doc.username, "", "", doc.avatar);
+		}
+	}
+
+	LOG_INFO("Compacting search index: {} documents, {} dead", _docs.size(), _deadCount);
+	_docs.clear();
+	_uidToDoc.clear();
+	_trigrams.clear();
+	_prefixes.clear();
+	_deadCount = 0;
+
+	for (const auto& user : users) {
+		AddLocked(user);
+	}
+	std::sort(_prefixes.begin(), _prefixes.end());
+}
+
+std::string SearchIndex::Normalize(const std::string& text)
+{
+	auto begin = text.find_first_not_of(" \t");
+	if (begin == std::string::npos) {
+		return std::string();
+	}
+	auto end = text.find_last_not_of(" \t");
+
+	std::string key = text.substr(begin, end - begin + 1);
+	std::transform(key.begin(), key.end(), key.begin(),
+		[](unsigned char ch) {
+			return static_cast<char>(std::tolower(ch));
+		}
+	);
+	return key;
+}
+
+uint32_t SearchIndex::Trigram(const char* p)
+{
+	return (static_cast<uint32_t>(static_cast<unsigned char>(p[0])) << 16)
+		| (static_cast<uint32_t>(static_cast<unsigned char>(p[1])) << 8)
+		| static_cast<uint32_t>(static_cast<unsigned char>(p[2]));
+}
+
+int SearchIndex::Rank(const Document& doc, const std::string& pattern) const
+{
+	int best = -1;
+	for (const auto& field : { doc.uid, doc.username, doc.email }) {
+		auto key = Normalize(field);
+		auto pos = key.find(pattern);
+		if (pos == std::string::npos) {
+			continue;
+		}
+
+		int rank = key.size() == pattern.size() ? 0 : (pos == 0 ? 1 : 2);
+		if (best < 0 || rank < best) {
+			best = rank;
+		}
+	}
+	return best;
+}
@@ -0,0 +1,91 @@
+#pragma once
+#include <cstdint>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "Singleton.h"
+#include "UserInfo.h"
+
+/**
+ * @class SearchIndex
+ * @brief In-memory index over uid, username and email for FuzzySearchUser.
+ *
+ * Patterns of three bytes or more are answered from trigram posting lists
+ * (sorted document ids, intersected smallest first); shorter patterns use a
+ * sorted prefix table. Built once from MySQL at startup and updated in place
+ * on registration and profile changes.
+ */
+class SearchIndex : public Singleton<SearchIndex>
+{
+	friend class Singleton<SearchIndex>;
+
+public:
+	struct Hit {
+		std::string uid;
+		std::string username;
+		std::string email;
+		std::string avatar;
+	};
+
+	~SearchIndex() = default;
+
+	/**
+	 * @brief Load every user from MySQL and replace the current index
+	 *
+	 * @return true on success
+	 */
+	bool Build();
+
+	/**
+	 * @brief Insert a new user or replace the indexed fields of an existing one
+	 *
+	 * @param user
+	 */
+	void Upsert(const UserInfo& user);
+
+	/**
+	 * @brief Top-k users whose uid, username or email contains pattern
+	 *
+	 * Exact matches rank before prefix matches, which rank before substring matches.
+	 *
+	 * @param pattern case-insensitive
+	 * @param excludeUid usually the searching user
+	 * @param limit
+	 * @return std::vector<Hit>
+	 */
+	std::vector<Hit> Search(const std::string& pattern, const std::string& excludeUid, std::size_t limit) const;
+
+	std::size_t Size() const;
+
+private:
+	struct Document {
+		std::string uid;
+		std::string username;
+		std::string email;
+		std::string avatar;
+		bool alive;
+	};
+
+	using DocId = uint32_t;
+	using PostingList = std::vector<DocId>;
+
+	SearchIndex() = default;
+
+	void AddLocked(const UserInfo& user);
+	void RemoveLocked(DocId id);
+	void CompactLocked();
+
+	static std::string Normalize(const std::string& text);
+	static uint32_t Trigram(const char* p);
+	int Rank(const Document& doc, const std::string& pattern) const;
+
+	std::vector<Document> _docs;
+	std::unordered_map<std::string, DocId> _uidToDoc;
+	std::unordered_map<uint32_t, PostingList> _trigrams;
+	std::vector<std::pair<std::string, DocId>> _prefixes;
+	std::size_t _deadCount = 0;
+
+	mutable std::shared_mutex _mutex;
+};
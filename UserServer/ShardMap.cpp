@@ -0,0 +1,107 @@
+#include "ShardMap.h"
+#include "ConfigManager.h"
+#include "Logger.h"
+
+#include <sstream>
+
+ShardMap::ShardMap()
+{
+	auto& cfg = ConfigManager::GetInstance();
+
+	std::vector<std::string> sections;
+	std::stringstream ss(cfg["MySQL"]["Shards"]);
+	std::string section;
+	while (std::getline(ss, section, ',')) {
+		section.erase(0, section.find_first_not_of(' '));
+		section.erase(section.find_last_not_of(' ') + 1);
+		if (!section.empty()) {
+			sections.push_back(section);
+		}
+	}
+	if (sections.empty()) {
+		sections.push_back("MySQL");
+	}
+
+	// A shard that cannot be reached must not be skipped: that would silently remap its uids
+	for (const auto& name : sections) {
+		auto shard = std::make_unique<Shard>();
+		shard->section = name;
+		if (name == "MySQL") {
+			shard->primary = &MySQLConPool::GetInstance();
+		}
+		else {
+			shard->pool = std::make_unique<MySQLConPool>(name);
+			shard->primary = shard->pool.get();
+		}
+		shard->router = std::make_unique<ReplicaRouter>(name, *shard->primary);
+		_shards.push_back(std::move(shard));
+	}
+
+	LOG_INFO("Shard map initialized - shards: {}", _shards.size());
+}
+
+std::size_t ShardMap::Count() const
+{
+	return _shards.size();
+}
+
+std::size_t ShardMap::ShardOf(const std::string& uid) const
+{
+	if (_shards.size() == 1) {
+		return 0;
+	}
+	return static_cast<std::size_t>(JumpHash(Hash(uid), static_cast<int32_t>(_shards.size())));
+}
+
+MySQLConPool& ShardMap::Primary(std::size_t shard)
+{
+	return *_shards[shard]->primary;
+}
+
+MySQLConPool& ShardMap::Primary(const std::string& uid)
+{
+	return Primary(ShardOf(uid));
+}
+
+ReplicaRouter& ShardMap::Router(std::size_t shard)
+{
+	return *_shards[shard]->router;
+}
+
+ReplicaRouter& ShardMap::Router(const std::string& uid)
+{
+	return Router(ShardOf(uid));
+}
+
+std::map<std::size_t, std::vector<std::string>> ShardMap::Partition(const std::vector<std::string>& uids) const
+{
+	std::map<std::size_t, std::vector<std::string>> parts;
+	for (const auto& uid : uids) {
+		parts[ShardOf(uid)].push_back(uid);
+	}
+	return parts;
+}
+
+uint64_t ShardMap::Hash(const std::string& uid)
+{
+	// FNV-1a: unlike std::hash, identical across builds and platforms
+	uint64_t hash = 14695981039346656037ULL;
+	for (unsigned char ch : uid) {
+		hash ^= ch;
+		hash *= 1099511628211ULL;
+	}
+	return hash;
+}
+
+int32_t ShardMap::JumpHash(uint64_t key, int32_t buckets)
+{
+	// Lamping & Veach, "A Fast, Minimal Memory, Consistent Hash Algorithm"
+	int64_t b = -1;
+	int64_t j = 0;
+	while (j < buckets) {
+		b = j;
+		key = key * 2862933555777941757ULL + 1;
+		j = static_cast<int64_t>((b + 1) * (static_cast<double>(1LL << 31) / static_cast<double>((key >> 33) + 1)));
+	}
+	return static_cast<int32_t>(b);
+}
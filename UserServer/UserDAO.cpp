@@ -11,8 +11,12 @@ bool UserDAO::Insert(const UserInfo& user)
 	};
 
 	try {
+		if (!conn) {
+			return {};
+		}
+
 		LOG_INFO("Inserting user: uid={}, email={}", user.uid, user.email);
-		auto result = conn->sql("CALL sp_insert_user(?, ?, ?, ?, ?, ?, ?, ?, @success)")
+		auto result = conn->sql("CALL sp_insert_user(?, ?, ?, ?, ?, ?, ?, ?)")
 			.bind(user.uid)
 			.bind(user.email)
 			.bind(user.username)
@@ -23,9 +27,7 @@ bool UserDAO::Insert(const UserInfo& user)
 			.bind(user.avatar.empty() ? ("./avatars/" + user.uid + ".png") : user.avatar)
 			.execute();
 
-		auto statusResult = conn->sql("SELECT @success").execute();
-		auto row = statusResult.fetchOne();
-		bool success = row[0].get<bool>();
+		bool success = IsSuccess(ReadCall(result));
 
 
 		if (success) {
@@ -37,6 +39,7 @@ bool UserDAO::Insert(const UserInfo& user)
 		return success;
 	}
 	catch (const mysqlx::Error& error) {
+		MarkSuspect(conn);
 		LOG_ERROR("MySQL Error on insert: {} (uid={}, email={})", error.what(), user.uid, user.email);
 		return false;
 	}
@@ -50,8 +53,12 @@ bool UserDAO::Update(const UserInfo& user)
 	};
 
 	try {
+		if (!conn) {
+			return {};
+		}
+
 		LOG_INFO("Updating user: uid={}, email={}", user.uid, user.email);
-		auto result = conn->sql("CALL sp_update_user(?, ?, ?, ?, ?, ?, ?, @success)")
+		auto result = conn->sql("CALL sp_update_user(?, ?, ?, ?, ?, ?, ?)")
 			.bind(user.uid)
 			.bind(user.email)
 			.bind(user.password)
@@ -61,9 +68,7 @@ bool UserDAO::Update(const UserInfo& user)
 			.bind(user.avatar.empty() ? ("./avatars/" + user.uid + ".png") : user.avatar)
 			.execute();
 
-		auto statusResult = conn->sql("SELECT @success").execute();
-		auto row = statusResult.fetchOne();
-		bool success = row[0].get<bool>();
+		bool success = IsSuccess(ReadCall(result));
 
 		if (success) {
 			LOG_INFO("Update user success: uid={}", user.uid);
@@ -74,6 +79,7 @@ bool UserDAO::Update(const UserInfo& user)
 		return success;
 	}
 	catch (const mysqlx::Error& error) {
+		MarkSuspect(conn);
 		LOG_ERROR("MySQL Error on update: {} (uid={}, email={})", error.what(), user.uid, user.email);
 		return false;
 	}
@@ -87,14 +93,16 @@ bool UserDAO::Delete(const std::string& uid)
 	};
 
 	try {
+		if (!conn) {
+			return {};
+		}
+
 		LOG_INFO("Deleting user: uid={}", uid);
-		auto result = conn->sql("CALL sp_delete_user(?, @success)")
+		auto result = conn->sql("CALL sp_delete_user(?)")
 			.bind(uid)
 			.execute();
 
-		auto statusResult = conn->sql("SELECT @success").execute();
-		auto row = statusResult.fetchOne();
-		bool success = row && row[0].get<bool>();
+		bool success = IsSuccess(ReadCall(result));
 
 		if (success) {
 			LOG_INFO("Delete user success: uid={}", uid);
@@ -105,6 +113,7 @@ bool UserDAO::Delete(const std::string& uid)
 		return success;
 	}
 	catch (const mysqlx::Error& error) {
+		MarkSuspect(conn);
 		LOG_ERROR("MySQL Error on delete: {} (uid={})", error.what(), uid);
 		return false;
 	}
@@ -118,23 +127,26 @@ std::unique_ptr<UserInfo> UserDAO::Search(const std::string& uid)
 	};
 
 	try {
+		if (!conn) {
+			return {};
+		}
+
 		LOG_INFO("Searching user: uid={}", uid);
-		auto result = conn->sql("CALL sp_search_user(?, ?, @success)")
+		auto result = conn->sql("CALL sp_search_user(?, ?)")
 			.bind(uid)
 			.bind(ENCRYPTION_KEY)
 			.execute();
 
-		auto statusResult = conn->sql("SELECT @success").execute();
-		auto statusRow = statusResult.fetchOne();
-		bool found = statusRow && statusRow[0].get<bool>();
+		std::vector<mysqlx::Row> rows;
+		bool found = IsSuccess(ReadCall(result, &rows));
 
 		if (!found) {
 			LOG_WARN("User not found: uid={}", uid);
 			return nullptr; // 用户未找到
 		}
 
-		auto row = result.fetchOne();
-		if (row) {
+		if (!rows.empty()) {
+			const auto& row = rows.front();
 			auto userInfo = std::make_unique<UserInfo>(
 				row[0].get<std::string>(),  // uid
 				row[1].get<std::string>(),  // email
@@ -152,6 +164,7 @@ std::unique_ptr<UserInfo> UserDAO::Search(const std::string& uid)
 		return nullptr;
 	}
 	catch (const mysqlx::Error& error) {
+		MarkSuspect(conn);
 		LOG_ERROR("MySQL Error on search: {} (uid={})", error.what(), uid);
 		return nullptr;
 	}
@@ -165,15 +178,18 @@ bool UserDAO::VerifyUser(const std::string& email, const std::string& password,
 	};
 
 	try {
+		if (!conn) {
+			return {};
+		}
+
 		LOG_INFO("Verifying user: email={}", email);
-		auto result = conn->sql("CALL sp_verify_user(?,?,?,@out_uid,@success)")
+		auto result = conn->sql("CALL sp_verify_user(?,?,?)")
 			.bind(email)
 			.bind(password)
 			.bind(ENCRYPTION_KEY)
 			.execute();
 
-		auto statusResult = conn->sql("SELECT @success, @out_uid").execute();
-		auto row = statusResult.fetchOne();
+		auto row = ReadCall(result);
 
 		if (row && row[0].get<bool>()) {
 			uid = row[1].get<std::string>();
@@ -185,7 +201,76 @@ bool UserDAO::VerifyUser(const std::string& email, const std::string& password,
 		return false;
 	}
 	catch (const mysqlx::Error& error) {
+		MarkSuspect(conn);
 		LOG_ERROR("MySQL Error on verify: {} (email={})", error.what(), email);
 		return false;
 	}
 }
+
+bool UserDAO::FindUid(const std::string& email, std::string& uid)
+{
+	auto conn = GetConnection();
+	defer{
+		ReleaseConnection(std::move(conn));
+	};
+
+	try {
+		if (!conn) {
+			return {};
+		}
+
+		auto result = conn->sql("CALL sp_find_uid_by_email(?)")
+			.bind(email)
+			.execute();
+
+		auto row = ReadCall(result);
+
+		if (row && row[0].get<bool>()) {
+			uid = row[1].get<std::string>();
+			return true;
+		}
+		return false;
+	}
+	catch (const mysqlx::Error& error) {
+		MarkSuspect(conn);
+		LOG_ERROR("MySQL Error on find uid: {} (email={})", error.what(), email);
+		return false;
+	}
+}
+
+bool UserDAO::ListUsers(const std::function<void(UserInfo&&)>& onUser)
+{
+	auto conn = GetConnection();
+	defer{
+		ReleaseConnection(std::move(conn));
+	};
+
+	try {
+		if (!conn) {
+			return {};
+		}
+
+		LOG_INFO("Listing users for search index");
+		// sp_list_users returns uid, email, name, avatar; no secrets are decrypted
+		auto result = conn->sql("CALL sp_list_users()").execute();
+
+		std::size_t count = 0;
+		for (auto row = result.fetchOne(); row; row = result.fetchOne()) {
+			UserInfo user;
+			user.uid = row[0].get<std::string>();
+			user.email = row[1].get<std::string>();
+			user.username = row[2].get<std::string>();
+			user.avatar = row[3].isNull() ? "" : row[3].get<std::string>();
+			onUser(std::move(user));
+			++count;
+		}
+
+		LOG_INFO("Listed {} users", count);
+		return true;
+	}
+	catch (const mysqlx::Error& error) {
+		MarkSuspect(conn);
+		LOG_ERROR("MySQL Error on list users: {}", error.what());
+		return false;
+	}
+}
@@ -2,10 +2,13 @@
 #include "BaseDAO.h"
 #include "UserInfo.h"
 #include <mysqlx/xdevapi.h>
+#include <functional>
 
 class UserDAO :public BaseDAO<UserInfo>
 {
 public:
+	using BaseDAO<UserInfo>::BaseDAO;
+
 	bool Insert(const UserInfo& user) override;
 	bool Update(const UserInfo& user) override;
 	bool Delete(const std::string& uid) override;
@@ -13,6 +16,17 @@ public:
 
 
 	bool VerifyUser(const std::string& email, const std::string& password, std::string& uid);
+
+	// uid of the user registered with email, without checking a password
+	bool FindUid(const std::string& email, std::string& uid);
+
+	/**
+	 * @brief Stream the searchable columns of every user (uid, email, name, avatar)
+	 *
+	 * @param onUser called once per row
+	 * @return false on a MySQL error
+	 */
+	bool ListUsers(const std::function<void(UserInfo&&)>& onUser);
 private:
 	const std::string ENCRYPTION_KEY = "printf-secret-key";
 };
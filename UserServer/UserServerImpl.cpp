@@ -4,6 +4,7 @@
 #include "ConfigManager.h"
 #include "Logger.h"
 #include "MySQLManager.h"
+#include "SearchIndex.h"
 
 #include <nlohmann/json.hpp>
 
@@ -12,12 +13,14 @@ using json = nlohmann::json;
 UserServerImpl::UserServerImpl()
 {
 	LOG_INFO("Starting UserServerImpl");
+	_searchTopK = static_cast<std::size_t>(ConfigManager::GetInstance().getIntValue("SearchIndex", "TopK", 50));
 }
 
 grpc::Status UserServerImpl::VerifyEmailCode(grpc::ServerContext* context, const user::VerifyEmailCodeReq* request, user::VerifyEmailCodeResp* response)
 {
 	LOG_INFO("VerifyEmailCode email: {}", request->email());
 
+	// written by the verification service, which only knows the first Redis node
 	auto stored = RedisConPool::GetInstance().get(CODE_PREFIX + request->email()).value();
 	if (stored.empty()) {
 		LOG_WARN("Verify code timeout for email: {}", request->email());
@@ -66,6 +69,23 @@ grpc::Status UserServerImpl::RegisterUser(grpc::ServerContext* context, const us
 
 	LOG_INFO("User registered successfully: {}", request->email());
 
+	// ChatServer may hold a short-lived "unknown uid" tombstone for this uid
+	try {
+		auto key = RedisConPool::UserKey(USER_INFO_PREFIX, outUid);
+		RedisConPool::ForKey(key).del(key);
+	}
+	catch (const sw::redis::Error& e) {
+		LOG_WARN("Failed to clear cached user info for uid {}: {}", outUid, e.what());
+	}
+
+	// ...and "no match" tombstones for searches the new user now matches
+	try {
+		RedisConPool::ForKey(SEARCH_EMPTY_VERSION).incr(SEARCH_EMPTY_VERSION);
+	}
+	catch (const sw::redis::Error& e) {
+		LOG_WARN("Failed to void search tombstones for uid {}: {}", outUid, e.what());
+	}
+
 	response->set_ok(true);
 	response->set_error(static_cast<int>(RegisterResponseCodes::REGISTER_SUCCESS));
 	response->set_uid(outUid);
@@ -136,6 +156,27 @@ grpc::Status UserServerImpl::GetUserProfile(grpc::ServerContext* context, const
 	return grpc::Status::OK;
 }
 
+grpc::Status UserServerImpl::FuzzySearchUser(grpc::ServerContext* context, const user::FuzzySearchUserReq* request, user::FuzzySearchUserResp* response)
+{
+	LOG_INFO("FuzzySearchUser uid: {}, pattern: {}", request->uid(), request->pattern());
+
+	auto hits = SearchIndex::GetInstance()->Search(request->pattern(), request->uid(), _searchTopK);
+	for (const auto& hit : hits) {
+		auto* result = response->add_results();
+		result->set_ok(true);
+		result->set_uid(hit.uid);
+		result->set_username(hit.username);
+		result->set_email(hit.email);
+		if (!hit.avatar.empty()) {
+			result->set_avatar(hit.avatar);
+		}
+	}
+
+	LOG_DEBUG("FuzzySearchUser pattern: {} matched {} users", request->pattern(), hits.size());
+	response->set_error(static_cast<int>(ErrorCodes::SUCCESS));
+	return grpc::Status::OK;
+}
+
 bool UserServerImpl::RegisterUserDB(const user::RegisterUserReq& req, std::string& outUid, int& outError)
 {
 	UserInfo info;
@@ -150,6 +191,11 @@ bool UserServerImpl::RegisterUserDB(const user::RegisterUserReq& req, std::strin
 		return false;
 	}
 
+	if (info.avatar.empty()) {
+		info.avatar = "./avatars/" + info.uid + ".png";
+	}
+	SearchIndex::GetInstance()->Upsert(info);
+
 	outUid = info.uid;
 	outError = static_cast<int>(RegisterResponseCodes::REGISTER_SUCCESS);
 	return true;
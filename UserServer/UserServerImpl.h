@@ -12,11 +12,14 @@ public:
 	grpc::Status VerifyLogin(grpc::ServerContext* context, const user::VerifyLoginReq* request, user::VerifyLoginResp* response) override;
 	grpc::Status ResetPassword(grpc::ServerContext* context, const user::ResetPasswordReq* request, user::ResetPasswordResp* response) override;
 	grpc::Status GetUserProfile(grpc::ServerContext* context, const user::GetUserProfileReq* request, user::GetUserProfileResp* response) override;
+	grpc::Status FuzzySearchUser(grpc::ServerContext* context, const user::FuzzySearchUserReq* request, user::FuzzySearchUserResp* response) override;
 
 private:
 	bool RegisterUserDB(const user::RegisterUserReq& req, std::string& outUid, int& outError);
 	bool VerifyLoginDB(const user::VerifyLoginReq& req, int& outError, std::string& outUid);
 	bool ResetPasswordDB(const user::ResetPasswordReq& req, int& outError);
 	bool GetUserProfileDB(const std::string& uid, user::GetUserProfileResp* resp);
+
+	std::size_t _searchTopK;
 };
 
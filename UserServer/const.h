@@ -1,6 +1,9 @@
 #pragma once
 
 constexpr auto CODE_PREFIX = "code_";
+constexpr auto USER_INFO_PREFIX = "user_info_";
+// ChatServer's search tombstones are keyed by this counter, so bumping it voids them all
+constexpr auto SEARCH_EMPTY_VERSION = "search_empty_version";
 
 enum class ErrorCodes
 {
@@ -3,6 +3,7 @@
 #include "UserServerImpl.h"
 #include "ConfigManager.h"
 #include "Logger.h"
+#include "SearchIndex.h"
 
 
 int main() {
@@ -11,6 +12,10 @@ int main() {
 
 		auto& configManager = ConfigManager::GetInstance();
 
+		if (!SearchIndex::GetInstance()->Build()) {
+			LOG_WARN("Search index is empty until users register");
+		}
+
 		std::string addr(configManager["UserServer"]["host"] + ":" + configManager["UserServer"]["port"]);
 		UserServerImpl service;
 
@@ -0,0 +1,217 @@
+-- Procedures report their status as their last result set instead of OUT parameters
+--
+-- The UserDAO and FriendDAO of ChatServer, ChatServer2 and UserServer call these
+-- without the trailing @success / @out_uid arguments and read the status from
+-- the final `SELECT success[, out_uid]`, any data rows coming first. Deploy this
+-- on every MySQL primary (every [MySQL] Shards section) before the servers.
+--
+-- Tables, unchanged:
+--   user          (uid PK, email UNIQUE, name, pwd = AES_ENCRYPT(password, key), birth, sex, avatar)
+--   friend        (self_uid, friend_uid, status, grouping, remark; PK (self_uid, friend_uid))
+--   friend_apply  (from_uid, to_uid, comments, status, apply_time; PK (from_uid, to_uid))
+-- friend.status is an AddStatusCodes value, friend_apply.status an ApplyStatusCodes one.
+
+DELIMITER $$
+
+-- ---------------------------------------------------------------- user
+
+DROP PROCEDURE IF EXISTS sp_insert_user $$
+CREATE PROCEDURE sp_insert_user(
+    IN p_uid VARCHAR(64), IN p_email VARCHAR(128), IN p_name VARCHAR(64), IN p_password VARCHAR(128),
+    IN p_key VARCHAR(128), IN p_birth DATE, IN p_sex VARCHAR(16), IN p_avatar VARCHAR(256))
+BEGIN
+    DECLARE EXIT HANDLER FOR SQLEXCEPTION
+    BEGIN
+        SELECT FALSE AS success;
+    END;
+
+    INSERT INTO user (uid, email, name, pwd, birth, sex, avatar)
+    VALUES (p_uid, p_email, p_name, AES_ENCRYPT(p_password, p_key), p_birth, p_sex, p_avatar);
+    SELECT TRUE AS success;
+END $$
+
+DROP PROCEDURE IF EXISTS sp_update_user $$
+CREATE PROCEDURE sp_update_user(
+    IN p_uid VARCHAR(64), IN p_email VARCHAR(128), IN p_password VARCHAR(128), IN p_key VARCHAR(128),
+    IN p_birth DATE, IN p_sex VARCHAR(16), IN p_avatar VARCHAR(256))
+BEGIN
+    DECLARE EXIT HANDLER FOR SQLEXCEPTION
+    BEGIN
+        SELECT FALSE AS success;
+    END;
+
+    UPDATE user
+    SET email = p_email, pwd = AES_ENCRYPT(p_password, p_key), birth = p_birth, sex = p_sex, avatar = p_avatar
+    WHERE uid = p_uid;
+    -- ROW_COUNT() is 0 for an unchanged row as well, so check for the user instead
+    SELECT EXISTS(SELECT 1 FROM user WHERE uid = p_uid) AS success;
+END $$
+
+DROP PROCEDURE IF EXISTS sp_delete_user $$
+CREATE PROCEDURE sp_delete_user(IN p_uid VARCHAR(64))
+BEGIN
+    DECLARE EXIT HANDLER FOR SQLEXCEPTION
+    BEGIN
+        SELECT FALSE AS success;
+    END;
+
+    DELETE FROM user WHERE uid = p_uid;
+    SELECT ROW_COUNT() > 0 AS success;
+END $$
+
+DROP PROCEDURE IF EXISTS sp_search_user $$
+CREATE PROCEDURE sp_search_user(IN p_uid VARCHAR(64), IN p_key VARCHAR(128))
+BEGIN
+    SELECT uid, email, name, CAST(AES_DECRYPT(pwd, p_key) AS CHAR) AS password,
+           DATE_FORMAT(birth, '%Y-%m-%d') AS birth, sex, avatar
+    FROM user
+    WHERE uid = p_uid;
+    SELECT FOUND_ROWS() > 0 AS success;
+END $$
+
+DROP PROCEDURE IF EXISTS sp_verify_user $$
+CREATE PROCEDURE sp_verify_user(IN p_email VARCHAR(128), IN p_password VARCHAR(128), IN p_key VARCHAR(128))
+BEGIN
+    DECLARE v_uid VARCHAR(64) DEFAULT NULL;
+
+    SELECT uid INTO v_uid
+    FROM user
+    WHERE email = p_email AND CAST(AES_DECRYPT(pwd, p_key) AS CHAR) = p_password
+    LIMIT 1;
+    SELECT v_uid IS NOT NULL AS success, COALESCE(v_uid, '') AS out_uid;
+END $$
+
+-- ---------------------------------------------------------------- friend
+
+-- One application from p_a to p_b and p_a's side of the relation. No transaction
+-- control of its own, so callers decide: sp_insert_friend wraps it in one, the
+-- batch in a savepoint of the caller's transaction.
+DROP PROCEDURE IF EXISTS sp_insert_friend_row $$
+CREATE PROCEDURE sp_insert_friend_row(
+    IN p_a VARCHAR(64), IN p_b VARCHAR(64), IN p_status INT, IN p_comments VARCHAR(512),
+    IN p_grouping VARCHAR(64), IN p_remark VARCHAR(64), OUT p_ok BOOLEAN)
+BEGIN
+    DECLARE EXIT HANDLER FOR SQLEXCEPTION
+    BEGIN
+        SET p_ok = FALSE;
+    END;
+
+    SET p_ok = FALSE;
+    IF p_a <> p_b THEN
+        INSERT INTO friend_apply (from_uid, to_uid, comments, status, apply_time)
+        VALUES (p_a, p_b, p_comments, 0, NOW())
+        ON DUPLICATE KEY UPDATE comments = VALUES(comments), status = 0, apply_time = NOW();
+
+        INSERT INTO friend (self_uid, friend_uid, status, grouping, remark)
+        VALUES (p_a, p_b, p_status, p_grouping, p_remark)
+        ON DUPLICATE KEY UPDATE grouping = VALUES(grouping), remark = VALUES(remark),
+                                status = GREATEST(status, VALUES(status));
+        SET p_ok = TRUE;
+    END IF;
+END $$
+
+DROP PROCEDURE IF EXISTS sp_insert_friend $$
+CREATE PROCEDURE sp_insert_friend(
+    IN p_a VARCHAR(64), IN p_b VARCHAR(64), IN p_status INT, IN p_comments VARCHAR(512),
+    IN p_grouping VARCHAR(64), IN p_remark VARCHAR(64))
+BEGIN
+    DECLARE v_ok BOOLEAN DEFAULT FALSE;
+
+    START TRANSACTION;
+    CALL sp_insert_friend_row(p_a, p_b, p_status, p_comments, p_grouping, p_remark, v_ok);
+    IF v_ok THEN
+        COMMIT;
+    ELSE
+        ROLLBACK;
+    END IF;
+    SELECT v_ok AS success;
+END $$
+
+-- p_a accepts the application of p_b: both directions become p_status
+DROP PROCEDURE IF EXISTS sp_update_friend $$
+CREATE PROCEDURE sp_update_friend(
+    IN p_a VARCHAR(64), IN p_b VARCHAR(64), IN p_status INT, IN p_grouping VARCHAR(64), IN p_remark VARCHAR(64))
+BEGIN
+    DECLARE EXIT HANDLER FOR SQLEXCEPTION
+    BEGIN
+        ROLLBACK;
+        SELECT FALSE AS success;
+    END;
+
+    START TRANSACTION;
+    UPDATE friend_apply SET status = 1 WHERE from_uid = p_b AND to_uid = p_a;
+
+    INSERT INTO friend (self_uid, friend_uid, status, grouping, remark)
+    VALUES (p_a, p_b, p_status, p_grouping, p_remark)
+    ON DUPLICATE KEY UPDATE status = VALUES(status), grouping = VALUES(grouping), remark = VALUES(remark);
+
+    INSERT INTO friend (self_uid, friend_uid, status, grouping, remark)
+    VALUES (p_b, p_a, p_status, 'MyFriends', p_a)
+    ON DUPLICATE KEY UPDATE status = VALUES(status);
+    COMMIT;
+    SELECT TRUE AS success;
+END $$
+
+DROP PROCEDURE IF EXISTS sp_delete_friend $$
+CREATE PROCEDURE sp_delete_friend(IN p_a VARCHAR(64), IN p_b VARCHAR(64))
+BEGIN
+    DECLARE EXIT HANDLER FOR SQLEXCEPTION
+    BEGIN
+        ROLLBACK;
+        SELECT FALSE AS success;
+    END;
+
+    START TRANSACTION;
+    DELETE FROM friend
+    WHERE (self_uid = p_a AND friend_uid = p_b) OR (self_uid = p_b AND friend_uid = p_a);
+    DELETE FROM friend_apply
+    WHERE (from_uid = p_a AND to_uid = p_b) OR (from_uid = p_b AND to_uid = p_a);
+    COMMIT;
+    SELECT TRUE AS success;
+END $$
+
+-- friends of p_uid with their profiles; passwords are never returned here
+DROP PROCEDURE IF EXISTS sp_search_friend $$
+CREATE PROCEDURE sp_search_friend(IN p_uid VARCHAR(64))
+BEGIN
+    SELECT u.uid, u.email, u.name, '' AS password,
+           COALESCE(DATE_FORMAT(u.birth, '%Y-%m-%d'), '') AS birth,
+           COALESCE(u.avatar, '') AS avatar, COALESCE(u.sex, '') AS sex,
+           f.grouping, f.remark
+    FROM friend f
+    JOIN user u ON u.uid = f.friend_uid
+    WHERE f.self_uid = p_uid AND f.status = 2;
+    SELECT TRUE AS success;
+END $$
+
+-- applications to p_uid, newest first
+DROP PROCEDURE IF EXISTS sp_apply_list_friend $$
+CREATE PROCEDURE sp_apply_list_friend(IN p_uid VARCHAR(64))
+BEGIN
+    SELECT a.from_uid, u.name, COALESCE(u.avatar, '') AS avatar, a.comments,
+           CAST(UNIX_TIMESTAMP(a.apply_time) AS UNSIGNED) AS time, a.status
+    FROM friend_apply a
+    JOIN user u ON u.uid = a.from_uid
+    WHERE a.to_uid = p_uid
+    ORDER BY a.apply_time DESC;
+    SELECT TRUE AS success;
+END $$
+
+-- users whose uid starts with or whose email contains p_pattern, with their
+-- relation to p_uid; LIKE wildcards in the pattern match literally
+DROP PROCEDURE IF EXISTS sp_fuzzy_search_uid_email $$
+CREATE PROCEDURE sp_fuzzy_search_uid_email(IN p_uid VARCHAR(64), IN p_pattern VARCHAR(128))
+BEGIN
+    DECLARE v_escaped VARCHAR(256)
+        DEFAULT REPLACE(REPLACE(REPLACE(p_pattern, '\\', '\\\\'), '%', '\\%'), '_', '\\_');
+
+    SELECT u.uid, u.name, COALESCE(u.avatar, '') AS avatar, COALESCE(f.status, 0) AS add_status
+    FROM user u
+    LEFT JOIN friend f ON f.self_uid = p_uid AND f.friend_uid = u.uid
+    WHERE u.uid <> p_uid
+      AND (u.uid LIKE CONCAT(v_escaped, '%') OR u.email LIKE CONCAT('%', v_escaped, '%'))
+    LIMIT 200;
+    SELECT TRUE AS success;
+END $$
+
+DELIMITER ;
@@ -0,0 +1,20 @@
+-- sp_search_users: profiles of several users in one round trip
+--
+-- Called by ChatServer's UserDAO::SearchBatch with a JSON array of uids. The
+-- array is expanded with JSON_TABLE (MySQL 8.0) and joined on user.uid, so every
+-- uid is a primary key lookup. Selects the same columns as sp_search_user for the
+-- uids that exist and, unlike the single-user procedures, no status row: the
+-- caller takes every row it gets as a user.
+
+DELIMITER $$
+
+DROP PROCEDURE IF EXISTS sp_search_users $$
+CREATE PROCEDURE sp_search_users(IN p_uids JSON, IN p_key VARCHAR(128))
+BEGIN
+    SELECT u.uid, u.email, u.name, CAST(AES_DECRYPT(u.pwd, p_key) AS CHAR) AS password,
+           DATE_FORMAT(u.birth, '%Y-%m-%d') AS birth, u.sex, u.avatar
+    FROM JSON_TABLE(p_uids, '$[*]' COLUMNS (uid VARCHAR(64) PATH '$')) AS wanted
+    JOIN user u ON u.uid = wanted.uid;
+END $$
+
+DELIMITER ;
@@ -0,0 +1,16 @@
+-- sp_list_users: every user, for the UserServer's in-memory search index
+--
+-- UserDAO::ListUsers streams the single result set at startup. Only the columns
+-- the index holds are selected, so no password is decrypted, and there is no
+-- status row.
+
+DELIMITER $$
+
+DROP PROCEDURE IF EXISTS sp_list_users $$
+CREATE PROCEDURE sp_list_users()
+BEGIN
+    SELECT uid, email, name, avatar
+    FROM user;
+END $$
+
+DELIMITER ;
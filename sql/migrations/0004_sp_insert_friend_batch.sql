@@ -0,0 +1,53 @@
+-- sp_insert_friend_batch: one group commit of friend applications
+--
+-- FriendApplyWriter collects the applications of one shard and FriendDAO::InsertApplyBatch
+-- calls this inside its own transaction with a JSON array of
+--   {"a_uid", "b_uid", "status", "comments", "group", "remark"}
+-- so it issues no START TRANSACTION / COMMIT itself. Every element runs
+-- sp_insert_friend_row (0001) under a savepoint: a row that fails is rolled back
+-- alone and reported, the others stay in the caller's transaction.
+--
+-- Result sets: (idx, success) for every element, idx counting from 0, then the
+-- status row. success is FALSE only when the batch as a whole broke (for example
+-- a deadlock rolled the transaction back); the caller then rolls back and retries
+-- the rows one by one through sp_insert_friend.
+
+DELIMITER $$
+
+DROP PROCEDURE IF EXISTS sp_insert_friend_batch $$
+CREATE PROCEDURE sp_insert_friend_batch(IN p_rows JSON)
+BEGIN
+    DECLARE v_idx INT DEFAULT 0;
+    DECLARE v_count INT DEFAULT JSON_LENGTH(p_rows);
+    DECLARE v_row JSON;
+    DECLARE v_ok BOOLEAN;
+    DECLARE v_results JSON DEFAULT JSON_ARRAY();
+    DECLARE EXIT HANDLER FOR SQLEXCEPTION
+    BEGIN
+        SELECT FALSE AS success;
+    END;
+
+    WHILE v_idx < v_count DO
+        SET v_row = JSON_EXTRACT(p_rows, CONCAT('$[', v_idx, ']'));
+        SAVEPOINT friend_batch_row;
+        CALL sp_insert_friend_row(
+            JSON_UNQUOTE(JSON_EXTRACT(v_row, '$.a_uid')),
+            JSON_UNQUOTE(JSON_EXTRACT(v_row, '$.b_uid')),
+            JSON_EXTRACT(v_row, '$.status'),
+            JSON_UNQUOTE(JSON_EXTRACT(v_row, '$.comments')),
+            JSON_UNQUOTE(JSON_EXTRACT(v_row, '$.group')),
+            JSON_UNQUOTE(JSON_EXTRACT(v_row, '$.remark')),
+            v_ok);
+        IF NOT v_ok THEN
+            ROLLBACK TO SAVEPOINT friend_batch_row;
+        END IF;
+        SET v_results = JSON_ARRAY_APPEND(v_results, '$', IF(v_ok, 1, 0));
+        SET v_idx = v_idx + 1;
+    END WHILE;
+
+    SELECT r.idx - 1 AS idx, r.ok AS success
+    FROM JSON_TABLE(v_results, '$[*]' COLUMNS (idx FOR ORDINALITY, ok INT PATH '$')) AS r;
+    SELECT TRUE AS success;
+END $$
+
+DELIMITER ;
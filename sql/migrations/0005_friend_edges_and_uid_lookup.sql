@@ -0,0 +1,45 @@
+-- Shard-local reads for cross-shard friend lists, and the uid of an email
+--
+-- With users sharded by uid, a user's friends and applicants live on other
+-- shards. FriendDAO::GetUserFriendEdges / GetApplyEdges read only the
+-- relation rows from the user's own shard; MySQLManager then fetches the
+-- profiles from each friend's shard. Both end with the status row.
+--
+-- sp_find_uid_by_email serves password resets, which name the user by email
+-- only: MySQLManager::ResetPassword asks every shard in turn, then writes to
+-- the one owning the uid. Its status row is (success, out_uid), as for
+-- sp_verify_user.
+
+DELIMITER $$
+
+-- (friend_uid, grouping, remark) of p_uid's friends
+DROP PROCEDURE IF EXISTS sp_search_friend_edges $$
+CREATE PROCEDURE sp_search_friend_edges(IN p_uid VARCHAR(64))
+BEGIN
+    SELECT friend_uid, grouping, remark
+    FROM friend
+    WHERE self_uid = p_uid AND status = 2;
+    SELECT TRUE AS success;
+END $$
+
+-- (from_uid, comments, time, status) of the applications to p_uid, newest first
+DROP PROCEDURE IF EXISTS sp_apply_list_edges $$
+CREATE PROCEDURE sp_apply_list_edges(IN p_uid VARCHAR(64))
+BEGIN
+    SELECT from_uid, comments, CAST(UNIX_TIMESTAMP(apply_time) AS UNSIGNED) AS time, status
+    FROM friend_apply
+    WHERE to_uid = p_uid
+    ORDER BY apply_time DESC;
+    SELECT TRUE AS success;
+END $$
+
+DROP PROCEDURE IF EXISTS sp_find_uid_by_email $$
+CREATE PROCEDURE sp_find_uid_by_email(IN p_email VARCHAR(128))
+BEGIN
+    DECLARE v_uid VARCHAR(64) DEFAULT NULL;
+
+    SELECT uid INTO v_uid FROM user WHERE email = p_email LIMIT 1;
+    SELECT v_uid IS NOT NULL AS success, COALESCE(v_uid, '') AS out_uid;
+END $$
+
+DELIMITER ;
@@ -0,0 +1,20 @@
+-- sp_sent_apply_edges: applications a user made that are still waiting on consent
+--
+-- Login loads them into FriendCache next to the received ones, so a user
+-- searching again after logging back in still sees who they already asked.
+-- The applicant's friend row (status NotConsent = 1) is written on their own
+-- shard by sp_insert_friend_row, so this reads the local shard only. Same
+-- columns as sp_search_friend_edges, then the status row.
+
+DELIMITER $$
+
+DROP PROCEDURE IF EXISTS sp_sent_apply_edges $$
+CREATE PROCEDURE sp_sent_apply_edges(IN p_uid VARCHAR(64))
+BEGIN
+    SELECT friend_uid, grouping, remark
+    FROM friend
+    WHERE self_uid = p_uid AND status = 1;
+    SELECT TRUE AS success;
+END $$
+
+DELIMITER ;